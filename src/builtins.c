@@ -33,6 +33,11 @@
 #include "sl_execution.h"
 #endif
 
+#ifndef SL_SIMD_H_INCLUDED
+#define SL_SIMD_H_INCLUDED
+#include "sl_simd.h"
+#endif
+
 #define SL_PI 3.1415926535897932384626433
 
 void builtin_not_implemented_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
@@ -45,10 +50,10 @@ void builtin_not_implemented_eval(struct sl_type_base *tb, const struct sl_expr
 
 
 void builtin_radians_f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float * restrict opd_column = FLOAT_REG_PTR(x->children_[0], 0); 
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) (((float)SL_PI)*(opd)/180.f)
 #define UNOP_SNIPPET_TYPE float
@@ -58,10 +63,10 @@ void builtin_radians_f_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_radians_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict result_column;
   float * restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) (((float)SL_PI)*(opd)/180.f)
 #define UNOP_SNIPPET_TYPE float
@@ -80,10 +85,10 @@ void builtin_radians_v2_runtime(struct sl_execution *exec, int exec_chain, struc
 }
 
 void builtin_radians_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) (((float)SL_PI)*(opd)/180.f)
 #define UNOP_SNIPPET_TYPE float
@@ -109,10 +114,10 @@ void builtin_radians_v3_runtime(struct sl_execution *exec, int exec_chain, struc
 }
 
 void builtin_radians_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) (((float)SL_PI)*(opd)/180.f)
 #define UNOP_SNIPPET_TYPE float
@@ -186,10 +191,10 @@ void builtin_radians_v4_eval(struct sl_type_base *tb, const struct sl_expr *x, s
 }
 
 void builtin_degrees_f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict opd_column = FLOAT_REG_PTR(x->children_[0], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) (180.f*(opd)/((float)SL_PI))
 #define UNOP_SNIPPET_TYPE float
@@ -199,10 +204,10 @@ void builtin_degrees_f_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_degrees_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict result_column;
   float * restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) (180.f*(opd)/((float)SL_PI))
 #define UNOP_SNIPPET_TYPE float
@@ -222,10 +227,10 @@ void builtin_degrees_v2_runtime(struct sl_execution *exec, int exec_chain, struc
 }
 
 void builtin_degrees_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) (180.f*(opd)/((float)SL_PI))
 #define UNOP_SNIPPET_TYPE float
@@ -251,10 +256,10 @@ void builtin_degrees_v3_runtime(struct sl_execution *exec, int exec_chain, struc
 }
 
 void builtin_degrees_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) (180.f*(opd)/((float)SL_PI))
 #define UNOP_SNIPPET_TYPE float
@@ -330,25 +335,28 @@ void builtin_degrees_v4_eval(struct sl_type_base *tb, const struct sl_expr *x, s
 
 
 void builtin_sin_f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict opd_column = FLOAT_REG_PTR(x->children_[0], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) sinf(opd)
+#define UNOP_SNIPPET_SIMD_KERNEL (exec->accuracy_ == SLEA_SPEC ? g_sl_simd_.f_sin_ : NULL)
 #define UNOP_SNIPPET_TYPE float
 #include "sl_unop_snippet_inc.h"
 #undef UNOP_SNIPPET_OPERATOR
+#undef UNOP_SNIPPET_SIMD_KERNEL
 #undef UNOP_SNIPPET_TYPE
 }
 
 void builtin_sin_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict result_column;
   float * restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) sinf(opd)
+#define UNOP_SNIPPET_SIMD_KERNEL (exec->accuracy_ == SLEA_SPEC ? g_sl_simd_.f_sin_ : NULL)
 #define UNOP_SNIPPET_TYPE float
   result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   opd_column = FLOAT_REG_PTR(x->children_[0], 0);
@@ -362,16 +370,18 @@ void builtin_sin_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl
 #include "sl_unop_snippet_inc.h"
 
 #undef UNOP_SNIPPET_OPERATOR
+#undef UNOP_SNIPPET_SIMD_KERNEL
 #undef UNOP_SNIPPET_TYPE
 }
 
 void builtin_sin_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) sinf(opd)
+#define UNOP_SNIPPET_SIMD_KERNEL (exec->accuracy_ == SLEA_SPEC ? g_sl_simd_.f_sin_ : NULL)
 #define UNOP_SNIPPET_TYPE float
   result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   opd_column = FLOAT_REG_PTR(x->children_[0], 0);
@@ -391,16 +401,18 @@ void builtin_sin_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl
 #include "sl_unop_snippet_inc.h"
 
 #undef UNOP_SNIPPET_OPERATOR
+#undef UNOP_SNIPPET_SIMD_KERNEL
 #undef UNOP_SNIPPET_TYPE
 }
 
 void builtin_sin_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) sinf(opd)
+#define UNOP_SNIPPET_SIMD_KERNEL (exec->accuracy_ == SLEA_SPEC ? g_sl_simd_.f_sin_ : NULL)
 #define UNOP_SNIPPET_TYPE float
   result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   opd_column = FLOAT_REG_PTR(x->children_[0], 0);
@@ -426,6 +438,7 @@ void builtin_sin_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl
 #include "sl_unop_snippet_inc.h"
 
 #undef UNOP_SNIPPET_OPERATOR
+#undef UNOP_SNIPPET_SIMD_KERNEL
 #undef UNOP_SNIPPET_TYPE
 }
 
@@ -470,25 +483,28 @@ void builtin_sin_v4_eval(struct sl_type_base *tb, const struct sl_expr *x, struc
 }
 
 void builtin_cos_f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict opd_column = FLOAT_REG_PTR(x->children_[0], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) cosf(opd)
+#define UNOP_SNIPPET_SIMD_KERNEL (exec->accuracy_ == SLEA_SPEC ? g_sl_simd_.f_cos_ : NULL)
 #define UNOP_SNIPPET_TYPE float
 #include "sl_unop_snippet_inc.h"
 #undef UNOP_SNIPPET_OPERATOR
+#undef UNOP_SNIPPET_SIMD_KERNEL
 #undef UNOP_SNIPPET_TYPE
 }
 
 void builtin_cos_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict result_column;
   float * restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) cosf(opd)
+#define UNOP_SNIPPET_SIMD_KERNEL (exec->accuracy_ == SLEA_SPEC ? g_sl_simd_.f_cos_ : NULL)
 #define UNOP_SNIPPET_TYPE float
   result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   opd_column = FLOAT_REG_PTR(x->children_[0], 0);
@@ -502,16 +518,18 @@ void builtin_cos_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl
 #include "sl_unop_snippet_inc.h"
 
 #undef UNOP_SNIPPET_OPERATOR
+#undef UNOP_SNIPPET_SIMD_KERNEL
 #undef UNOP_SNIPPET_TYPE
 }
 
 void builtin_cos_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) cosf(opd)
+#define UNOP_SNIPPET_SIMD_KERNEL (exec->accuracy_ == SLEA_SPEC ? g_sl_simd_.f_cos_ : NULL)
 #define UNOP_SNIPPET_TYPE float
   result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   opd_column = FLOAT_REG_PTR(x->children_[0], 0);
@@ -531,16 +549,18 @@ void builtin_cos_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl
 #include "sl_unop_snippet_inc.h"
 
 #undef UNOP_SNIPPET_OPERATOR
+#undef UNOP_SNIPPET_SIMD_KERNEL
 #undef UNOP_SNIPPET_TYPE
 }
 
 void builtin_cos_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) cosf(opd)
+#define UNOP_SNIPPET_SIMD_KERNEL (exec->accuracy_ == SLEA_SPEC ? g_sl_simd_.f_cos_ : NULL)
 #define UNOP_SNIPPET_TYPE float
   result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   opd_column = FLOAT_REG_PTR(x->children_[0], 0);
@@ -566,6 +586,7 @@ void builtin_cos_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl
 #include "sl_unop_snippet_inc.h"
 
 #undef UNOP_SNIPPET_OPERATOR
+#undef UNOP_SNIPPET_SIMD_KERNEL
 #undef UNOP_SNIPPET_TYPE
 }
 
@@ -616,10 +637,10 @@ void builtin_cos_v4_eval(struct sl_type_base *tb, const struct sl_expr *x, struc
 }
 
 void builtin_tan_f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float * restrict opd_column = FLOAT_REG_PTR(x->children_[0], 0); 
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) tanf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -629,10 +650,10 @@ void builtin_tan_f_runtime(struct sl_execution *exec, int exec_chain, struct sl_
 }
 
 void builtin_tan_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict result_column;
   float * restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) tanf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -652,10 +673,10 @@ void builtin_tan_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl
 }
 
 void builtin_tan_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) tanf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -681,10 +702,10 @@ void builtin_tan_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl
 }
 
 void builtin_tan_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) tanf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -762,10 +783,10 @@ void builtin_tan_v4_eval(struct sl_type_base *tb, const struct sl_expr *x, struc
 }
 
 void builtin_asin_f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict opd_column = FLOAT_REG_PTR(x->children_[0], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) asinf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -775,10 +796,10 @@ void builtin_asin_f_runtime(struct sl_execution *exec, int exec_chain, struct sl
 }
 
 void builtin_asin_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict result_column;
   float * restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) asinf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -798,10 +819,10 @@ void builtin_asin_v2_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_asin_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) asinf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -827,10 +848,10 @@ void builtin_asin_v3_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_asin_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) asinf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -908,10 +929,10 @@ void builtin_asin_v4_eval(struct sl_type_base *tb, const struct sl_expr *x, stru
 }
 
 void builtin_acos_f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float * restrict opd_column = FLOAT_REG_PTR(x->children_[0], 0); 
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) acosf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -921,10 +942,10 @@ void builtin_acos_f_runtime(struct sl_execution *exec, int exec_chain, struct sl
 }
 
 void builtin_acos_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict result_column;
   float * restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) acosf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -944,10 +965,10 @@ void builtin_acos_v2_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_acos_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) acosf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -973,10 +994,10 @@ void builtin_acos_v3_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_acos_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) acosf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -1054,10 +1075,10 @@ void builtin_acos_v4_eval(struct sl_type_base *tb, const struct sl_expr *x, stru
 }
 
 void builtin_atan_f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float * restrict opd_column = FLOAT_REG_PTR(x->children_[0], 0); 
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) atanf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -1067,10 +1088,10 @@ void builtin_atan_f_runtime(struct sl_execution *exec, int exec_chain, struct sl
 }
 
 void builtin_atan_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict result_column;
   float * restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) atanf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -1090,10 +1111,10 @@ void builtin_atan_v2_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_atan_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) atanf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -1119,10 +1140,10 @@ void builtin_atan_v3_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_atan_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) atanf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -1200,11 +1221,11 @@ void builtin_atan_v4_eval(struct sl_type_base *tb, const struct sl_expr *x, stru
 }
 
 void builtin_atan_ff_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float * restrict left_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict right_column = FLOAT_REG_PTR(x->children_[1], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(y, x) atanf(y/x)
 #define BINOP_SNIPPET_TYPE float
@@ -1214,11 +1235,11 @@ void builtin_atan_ff_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_atan_v2v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(y, x) atanf(y/x)
 #define BINOP_SNIPPET_TYPE float
@@ -1240,11 +1261,11 @@ void builtin_atan_v2v2_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_atan_v3v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(y, x) atanf(y/x)
 #define BINOP_SNIPPET_TYPE float
@@ -1273,11 +1294,11 @@ void builtin_atan_v3v3_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_atan_v4v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(y, x) atanf(y/x)
 #define BINOP_SNIPPET_TYPE float
@@ -1386,27 +1407,30 @@ void builtin_atan_v4v4_eval(struct sl_type_base *tb, const struct sl_expr *x, st
 /* Exponential functions */
 
 void builtin_pow_ff_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict left_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict right_column = FLOAT_REG_PTR(x->children_[1], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) powf(x, y)
+#define BINOP_SNIPPET_SIMD_KERNEL (exec->accuracy_ == SLEA_SPEC ? g_sl_simd_.f_pow_ : NULL)
 #define BINOP_SNIPPET_TYPE float
 #include "sl_binop_snippet_inc.h"
 #undef BINOP_SNIPPET_OPERATOR
+#undef BINOP_SNIPPET_SIMD_KERNEL
 #undef BINOP_SNIPPET_TYPE
 }
 
 void builtin_pow_v2v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) powf(x, y)
+#define BINOP_SNIPPET_SIMD_KERNEL (exec->accuracy_ == SLEA_SPEC ? g_sl_simd_.f_pow_ : NULL)
 #define BINOP_SNIPPET_TYPE float
   left_column = FLOAT_REG_PTR(x->children_[0], 0);
   right_column = FLOAT_REG_PTR(x->children_[1], 0);
@@ -1422,17 +1446,19 @@ void builtin_pow_v2v2_runtime(struct sl_execution *exec, int exec_chain, struct
 #include "sl_binop_snippet_inc.h"
 
 #undef BINOP_SNIPPET_OPERATOR
+#undef BINOP_SNIPPET_SIMD_KERNEL
 #undef BINOP_SNIPPET_TYPE
 }
 
 void builtin_pow_v3v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) powf(x, y)
+#define BINOP_SNIPPET_SIMD_KERNEL (exec->accuracy_ == SLEA_SPEC ? g_sl_simd_.f_pow_ : NULL)
 #define BINOP_SNIPPET_TYPE float
   left_column = FLOAT_REG_PTR(x->children_[0], 0);
   right_column = FLOAT_REG_PTR(x->children_[1], 0);
@@ -1455,17 +1481,19 @@ void builtin_pow_v3v3_runtime(struct sl_execution *exec, int exec_chain, struct
 #include "sl_binop_snippet_inc.h"
 
 #undef BINOP_SNIPPET_OPERATOR
+#undef BINOP_SNIPPET_SIMD_KERNEL
 #undef BINOP_SNIPPET_TYPE
 }
 
 void builtin_pow_v4v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) powf(x, y)
+#define BINOP_SNIPPET_SIMD_KERNEL (exec->accuracy_ == SLEA_SPEC ? g_sl_simd_.f_pow_ : NULL)
 #define BINOP_SNIPPET_TYPE float
   left_column = FLOAT_REG_PTR(x->children_[0], 0);
   right_column = FLOAT_REG_PTR(x->children_[1], 0);
@@ -1495,6 +1523,7 @@ void builtin_pow_v4v4_runtime(struct sl_execution *exec, int exec_chain, struct
 #include "sl_binop_snippet_inc.h"
 
 #undef BINOP_SNIPPET_OPERATOR
+#undef BINOP_SNIPPET_SIMD_KERNEL
 #undef BINOP_SNIPPET_TYPE
 }
 
@@ -1568,25 +1597,28 @@ void builtin_pow_v4v4_eval(struct sl_type_base *tb, const struct sl_expr *x, str
                             powf(opd0.v_.v_[3], opd1.v_.v_[3]));
 }
 void builtin_exp_f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict opd_column = FLOAT_REG_PTR(x->children_[0], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) expf(opd)
+#define UNOP_SNIPPET_SIMD_KERNEL (exec->accuracy_ == SLEA_SPEC ? g_sl_simd_.f_exp_ : NULL)
 #define UNOP_SNIPPET_TYPE float
 #include "sl_unop_snippet_inc.h"
 #undef UNOP_SNIPPET_OPERATOR
+#undef UNOP_SNIPPET_SIMD_KERNEL
 #undef UNOP_SNIPPET_TYPE
 }
 
 void builtin_exp_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict result_column;
   float * restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) expf(opd)
+#define UNOP_SNIPPET_SIMD_KERNEL (exec->accuracy_ == SLEA_SPEC ? g_sl_simd_.f_exp_ : NULL)
 #define UNOP_SNIPPET_TYPE float
   result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   opd_column = FLOAT_REG_PTR(x->children_[0], 0);
@@ -1600,16 +1632,18 @@ void builtin_exp_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl
 #include "sl_unop_snippet_inc.h"
 
 #undef UNOP_SNIPPET_OPERATOR
+#undef UNOP_SNIPPET_SIMD_KERNEL
 #undef UNOP_SNIPPET_TYPE
 }
 
 void builtin_exp_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) expf(opd)
+#define UNOP_SNIPPET_SIMD_KERNEL (exec->accuracy_ == SLEA_SPEC ? g_sl_simd_.f_exp_ : NULL)
 #define UNOP_SNIPPET_TYPE float
   result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   opd_column = FLOAT_REG_PTR(x->children_[0], 0);
@@ -1629,16 +1663,18 @@ void builtin_exp_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl
 #include "sl_unop_snippet_inc.h"
 
 #undef UNOP_SNIPPET_OPERATOR
+#undef UNOP_SNIPPET_SIMD_KERNEL
 #undef UNOP_SNIPPET_TYPE
 }
 
 void builtin_exp_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) expf(opd)
+#define UNOP_SNIPPET_SIMD_KERNEL (exec->accuracy_ == SLEA_SPEC ? g_sl_simd_.f_exp_ : NULL)
 #define UNOP_SNIPPET_TYPE float
   result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   opd_column = FLOAT_REG_PTR(x->children_[0], 0);
@@ -1664,6 +1700,7 @@ void builtin_exp_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl
 #include "sl_unop_snippet_inc.h"
 
 #undef UNOP_SNIPPET_OPERATOR
+#undef UNOP_SNIPPET_SIMD_KERNEL
 #undef UNOP_SNIPPET_TYPE
 }
 
@@ -1708,25 +1745,28 @@ void builtin_exp_v4_eval(struct sl_type_base *tb, const struct sl_expr *x, struc
 }
 
 void builtin_log_f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict opd_column = FLOAT_REG_PTR(x->children_[0], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) logf(opd)
+#define UNOP_SNIPPET_SIMD_KERNEL (exec->accuracy_ == SLEA_SPEC ? g_sl_simd_.f_log_ : NULL)
 #define UNOP_SNIPPET_TYPE float
 #include "sl_unop_snippet_inc.h"
 #undef UNOP_SNIPPET_OPERATOR
+#undef UNOP_SNIPPET_SIMD_KERNEL
 #undef UNOP_SNIPPET_TYPE
 }
 
 void builtin_log_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict result_column;
   float * restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) logf(opd)
+#define UNOP_SNIPPET_SIMD_KERNEL (exec->accuracy_ == SLEA_SPEC ? g_sl_simd_.f_log_ : NULL)
 #define UNOP_SNIPPET_TYPE float
   result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   opd_column = FLOAT_REG_PTR(x->children_[0], 0);
@@ -1740,16 +1780,18 @@ void builtin_log_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl
 #include "sl_unop_snippet_inc.h"
 
 #undef UNOP_SNIPPET_OPERATOR
+#undef UNOP_SNIPPET_SIMD_KERNEL
 #undef UNOP_SNIPPET_TYPE
 }
 
 void builtin_log_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) logf(opd)
+#define UNOP_SNIPPET_SIMD_KERNEL (exec->accuracy_ == SLEA_SPEC ? g_sl_simd_.f_log_ : NULL)
 #define UNOP_SNIPPET_TYPE float
   result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   opd_column = FLOAT_REG_PTR(x->children_[0], 0);
@@ -1769,16 +1811,18 @@ void builtin_log_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl
 #include "sl_unop_snippet_inc.h"
 
 #undef UNOP_SNIPPET_OPERATOR
+#undef UNOP_SNIPPET_SIMD_KERNEL
 #undef UNOP_SNIPPET_TYPE
 }
 
 void builtin_log_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) logf(opd)
+#define UNOP_SNIPPET_SIMD_KERNEL (exec->accuracy_ == SLEA_SPEC ? g_sl_simd_.f_log_ : NULL)
 #define UNOP_SNIPPET_TYPE float
   result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   opd_column = FLOAT_REG_PTR(x->children_[0], 0);
@@ -1804,6 +1848,7 @@ void builtin_log_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl
 #include "sl_unop_snippet_inc.h"
 
 #undef UNOP_SNIPPET_OPERATOR
+#undef UNOP_SNIPPET_SIMD_KERNEL
 #undef UNOP_SNIPPET_TYPE
 }
 
@@ -1848,25 +1893,28 @@ void builtin_log_v4_eval(struct sl_type_base *tb, const struct sl_expr *x, struc
 }
 
 void builtin_exp2_f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict opd_column = FLOAT_REG_PTR(x->children_[0], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) exp2f(opd)
+#define UNOP_SNIPPET_SIMD_KERNEL (exec->accuracy_ == SLEA_SPEC ? g_sl_simd_.f_exp2_ : NULL)
 #define UNOP_SNIPPET_TYPE float
 #include "sl_unop_snippet_inc.h"
 #undef UNOP_SNIPPET_OPERATOR
+#undef UNOP_SNIPPET_SIMD_KERNEL
 #undef UNOP_SNIPPET_TYPE
 }
 
 void builtin_exp2_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict result_column;
   float * restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) exp2f(opd)
+#define UNOP_SNIPPET_SIMD_KERNEL (exec->accuracy_ == SLEA_SPEC ? g_sl_simd_.f_exp2_ : NULL)
 #define UNOP_SNIPPET_TYPE float
   result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   opd_column = FLOAT_REG_PTR(x->children_[0], 0);
@@ -1880,16 +1928,18 @@ void builtin_exp2_v2_runtime(struct sl_execution *exec, int exec_chain, struct s
 #include "sl_unop_snippet_inc.h"
 
 #undef UNOP_SNIPPET_OPERATOR
+#undef UNOP_SNIPPET_SIMD_KERNEL
 #undef UNOP_SNIPPET_TYPE
 }
 
 void builtin_exp2_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) exp2f(opd)
+#define UNOP_SNIPPET_SIMD_KERNEL (exec->accuracy_ == SLEA_SPEC ? g_sl_simd_.f_exp2_ : NULL)
 #define UNOP_SNIPPET_TYPE float
   result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   opd_column = FLOAT_REG_PTR(x->children_[0], 0);
@@ -1909,16 +1959,18 @@ void builtin_exp2_v3_runtime(struct sl_execution *exec, int exec_chain, struct s
 #include "sl_unop_snippet_inc.h"
 
 #undef UNOP_SNIPPET_OPERATOR
+#undef UNOP_SNIPPET_SIMD_KERNEL
 #undef UNOP_SNIPPET_TYPE
 }
 
 void builtin_exp2_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) exp2f(opd)
+#define UNOP_SNIPPET_SIMD_KERNEL (exec->accuracy_ == SLEA_SPEC ? g_sl_simd_.f_exp2_ : NULL)
 #define UNOP_SNIPPET_TYPE float
   result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   opd_column = FLOAT_REG_PTR(x->children_[0], 0);
@@ -1944,6 +1996,7 @@ void builtin_exp2_v4_runtime(struct sl_execution *exec, int exec_chain, struct s
 #include "sl_unop_snippet_inc.h"
 
 #undef UNOP_SNIPPET_OPERATOR
+#undef UNOP_SNIPPET_SIMD_KERNEL
 #undef UNOP_SNIPPET_TYPE
 }
 
@@ -1988,25 +2041,28 @@ void builtin_exp2_v4_eval(struct sl_type_base *tb, const struct sl_expr *x, stru
 }
 
 void builtin_log2_f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict opd_column = FLOAT_REG_PTR(x->children_[0], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) log2f(opd)
+#define UNOP_SNIPPET_SIMD_KERNEL (exec->accuracy_ == SLEA_SPEC ? g_sl_simd_.f_log2_ : NULL)
 #define UNOP_SNIPPET_TYPE float
 #include "sl_unop_snippet_inc.h"
 #undef UNOP_SNIPPET_OPERATOR
+#undef UNOP_SNIPPET_SIMD_KERNEL
 #undef UNOP_SNIPPET_TYPE
 }
 
 void builtin_log2_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict result_column;
   float * restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) log2f(opd)
+#define UNOP_SNIPPET_SIMD_KERNEL (exec->accuracy_ == SLEA_SPEC ? g_sl_simd_.f_log2_ : NULL)
 #define UNOP_SNIPPET_TYPE float
   result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   opd_column = FLOAT_REG_PTR(x->children_[0], 0);
@@ -2020,16 +2076,18 @@ void builtin_log2_v2_runtime(struct sl_execution *exec, int exec_chain, struct s
 #include "sl_unop_snippet_inc.h"
 
 #undef UNOP_SNIPPET_OPERATOR
+#undef UNOP_SNIPPET_SIMD_KERNEL
 #undef UNOP_SNIPPET_TYPE
 }
 
 void builtin_log2_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) log2f(opd)
+#define UNOP_SNIPPET_SIMD_KERNEL (exec->accuracy_ == SLEA_SPEC ? g_sl_simd_.f_log2_ : NULL)
 #define UNOP_SNIPPET_TYPE float
   result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   opd_column = FLOAT_REG_PTR(x->children_[0], 0);
@@ -2049,16 +2107,18 @@ void builtin_log2_v3_runtime(struct sl_execution *exec, int exec_chain, struct s
 #include "sl_unop_snippet_inc.h"
 
 #undef UNOP_SNIPPET_OPERATOR
+#undef UNOP_SNIPPET_SIMD_KERNEL
 #undef UNOP_SNIPPET_TYPE
 }
 
 void builtin_log2_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) log2f(opd)
+#define UNOP_SNIPPET_SIMD_KERNEL (exec->accuracy_ == SLEA_SPEC ? g_sl_simd_.f_log2_ : NULL)
 #define UNOP_SNIPPET_TYPE float
   result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   opd_column = FLOAT_REG_PTR(x->children_[0], 0);
@@ -2084,6 +2144,7 @@ void builtin_log2_v4_runtime(struct sl_execution *exec, int exec_chain, struct s
 #include "sl_unop_snippet_inc.h"
 
 #undef UNOP_SNIPPET_OPERATOR
+#undef UNOP_SNIPPET_SIMD_KERNEL
 #undef UNOP_SNIPPET_TYPE
 }
 
@@ -2128,10 +2189,10 @@ void builtin_log2_v4_eval(struct sl_type_base *tb, const struct sl_expr *x, stru
 }
 
 void builtin_sqrt_f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict opd_column = FLOAT_REG_PTR(x->children_[0], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) sqrtf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -2141,10 +2202,10 @@ void builtin_sqrt_f_runtime(struct sl_execution *exec, int exec_chain, struct sl
 }
 
 void builtin_sqrt_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict result_column;
   float * restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) sqrtf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -2164,10 +2225,10 @@ void builtin_sqrt_v2_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_sqrt_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) sqrtf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -2193,10 +2254,10 @@ void builtin_sqrt_v3_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_sqrt_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) sqrtf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -2268,25 +2329,28 @@ void builtin_sqrt_v4_eval(struct sl_type_base *tb, const struct sl_expr *x, stru
 }
 
 void builtin_inversesqrt_f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict opd_column = FLOAT_REG_PTR(x->children_[0], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) 1.f/sqrtf(opd)
+#define UNOP_SNIPPET_SIMD_KERNEL g_sl_simd_.f_inversesqrt_
 #define UNOP_SNIPPET_TYPE float
 #include "sl_unop_snippet_inc.h"
 #undef UNOP_SNIPPET_OPERATOR
+#undef UNOP_SNIPPET_SIMD_KERNEL
 #undef UNOP_SNIPPET_TYPE
 }
 
 void builtin_inversesqrt_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict result_column;
   float * restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) 1.f/sqrtf(opd)
+#define UNOP_SNIPPET_SIMD_KERNEL g_sl_simd_.f_inversesqrt_
 #define UNOP_SNIPPET_TYPE float
   result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   opd_column = FLOAT_REG_PTR(x->children_[0], 0);
@@ -2300,16 +2364,18 @@ void builtin_inversesqrt_v2_runtime(struct sl_execution *exec, int exec_chain, s
 #include "sl_unop_snippet_inc.h"
 
 #undef UNOP_SNIPPET_OPERATOR
+#undef UNOP_SNIPPET_SIMD_KERNEL
 #undef UNOP_SNIPPET_TYPE
 }
 
 void builtin_inversesqrt_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) 1.f/sqrtf(opd)
+#define UNOP_SNIPPET_SIMD_KERNEL g_sl_simd_.f_inversesqrt_
 #define UNOP_SNIPPET_TYPE float
   result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   opd_column = FLOAT_REG_PTR(x->children_[0], 0);
@@ -2329,16 +2395,18 @@ void builtin_inversesqrt_v3_runtime(struct sl_execution *exec, int exec_chain, s
 #include "sl_unop_snippet_inc.h"
 
 #undef UNOP_SNIPPET_OPERATOR
+#undef UNOP_SNIPPET_SIMD_KERNEL
 #undef UNOP_SNIPPET_TYPE
 }
 
 void builtin_inversesqrt_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) 1.f/sqrtf(opd)
+#define UNOP_SNIPPET_SIMD_KERNEL g_sl_simd_.f_inversesqrt_
 #define UNOP_SNIPPET_TYPE float
   result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   opd_column = FLOAT_REG_PTR(x->children_[0], 0);
@@ -2364,6 +2432,7 @@ void builtin_inversesqrt_v4_runtime(struct sl_execution *exec, int exec_chain, s
 #include "sl_unop_snippet_inc.h"
 
 #undef UNOP_SNIPPET_OPERATOR
+#undef UNOP_SNIPPET_SIMD_KERNEL
 #undef UNOP_SNIPPET_TYPE
 }
 
@@ -2440,10 +2509,10 @@ static float aex_smoothstepf(float edge0, float edge1, float x) {
 }
 
 void builtin_abs_f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict opd_column = FLOAT_REG_PTR(x->children_[0], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) fabsf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -2453,10 +2522,10 @@ void builtin_abs_f_runtime(struct sl_execution *exec, int exec_chain, struct sl_
 }
 
 void builtin_abs_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict result_column;
   float * restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) fabsf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -2476,10 +2545,10 @@ void builtin_abs_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl
 }
 
 void builtin_abs_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) fabsf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -2505,10 +2574,10 @@ void builtin_abs_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl
 }
 
 void builtin_abs_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) fabsf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -2580,10 +2649,10 @@ void builtin_abs_v4_eval(struct sl_type_base *tb, const struct sl_expr *x, struc
 }
 
 void builtin_sign_f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict opd_column = FLOAT_REG_PTR(x->children_[0], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) aex_signf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -2593,10 +2662,10 @@ void builtin_sign_f_runtime(struct sl_execution *exec, int exec_chain, struct sl
 }
 
 void builtin_sign_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict result_column;
   float * restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) aex_signf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -2616,10 +2685,10 @@ void builtin_sign_v2_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_sign_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) aex_signf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -2645,10 +2714,10 @@ void builtin_sign_v3_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_sign_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) aex_signf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -2720,10 +2789,10 @@ void builtin_sign_v4_eval(struct sl_type_base *tb, const struct sl_expr *x, stru
 }
 
 void builtin_floor_f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict opd_column = FLOAT_REG_PTR(x->children_[0], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) floorf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -2733,10 +2802,10 @@ void builtin_floor_f_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_floor_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict result_column;
   float * restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) floorf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -2756,10 +2825,10 @@ void builtin_floor_v2_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_floor_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) floorf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -2785,10 +2854,10 @@ void builtin_floor_v3_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_floor_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) floorf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -2860,10 +2929,10 @@ void builtin_floor_v4_eval(struct sl_type_base *tb, const struct sl_expr *x, str
 }
 
 void builtin_ceil_f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict opd_column = FLOAT_REG_PTR(x->children_[0], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) ceilf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -2873,10 +2942,10 @@ void builtin_ceil_f_runtime(struct sl_execution *exec, int exec_chain, struct sl
 }
 
 void builtin_ceil_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict result_column;
   float * restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) ceilf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -2896,10 +2965,10 @@ void builtin_ceil_v2_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_ceil_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) ceilf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -2925,10 +2994,10 @@ void builtin_ceil_v3_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_ceil_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) ceilf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -3000,10 +3069,10 @@ void builtin_ceil_v4_eval(struct sl_type_base *tb, const struct sl_expr *x, stru
 }
 
 void builtin_fract_f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict opd_column = FLOAT_REG_PTR(x->children_[0], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) aex_fractf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -3013,10 +3082,10 @@ void builtin_fract_f_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_fract_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict result_column;
   float * restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) aex_fractf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -3036,10 +3105,10 @@ void builtin_fract_v2_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_fract_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) aex_fractf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -3065,10 +3134,10 @@ void builtin_fract_v3_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_fract_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) aex_fractf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -3141,11 +3210,11 @@ void builtin_fract_v4_eval(struct sl_type_base *tb, const struct sl_expr *x, str
 
 
 void builtin_mod_ff_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict left_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict right_column = FLOAT_REG_PTR(x->children_[1], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_modf(x, y)
 #define BINOP_SNIPPET_TYPE float
@@ -3155,11 +3224,11 @@ void builtin_mod_ff_runtime(struct sl_execution *exec, int exec_chain, struct sl
 }
 
 void builtin_mod_v2v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_modf(x, y)
 #define BINOP_SNIPPET_TYPE float
@@ -3181,11 +3250,11 @@ void builtin_mod_v2v2_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_mod_v3v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_modf(x, y)
 #define BINOP_SNIPPET_TYPE float
@@ -3214,11 +3283,11 @@ void builtin_mod_v3v3_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_mod_v4v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_modf(x, y)
 #define BINOP_SNIPPET_TYPE float
@@ -3254,11 +3323,11 @@ void builtin_mod_v4v4_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_mod_v2f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_modf(x, y)
 #define BINOP_SNIPPET_TYPE float
@@ -3280,11 +3349,11 @@ void builtin_mod_v2f_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_mod_v3f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_modf(x, y)
 #define BINOP_SNIPPET_TYPE float
@@ -3313,11 +3382,11 @@ void builtin_mod_v3f_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_mod_v4f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_modf(x, y)
 #define BINOP_SNIPPET_TYPE float
@@ -3477,11 +3546,11 @@ void builtin_mod_v4f_eval(struct sl_type_base *tb, const struct sl_expr *x, stru
 }
 
 void builtin_min_ff_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict left_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict right_column = FLOAT_REG_PTR(x->children_[1], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) fminf(x, y)
 #define BINOP_SNIPPET_TYPE float
@@ -3491,11 +3560,11 @@ void builtin_min_ff_runtime(struct sl_execution *exec, int exec_chain, struct sl
 }
 
 void builtin_min_v2v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) fminf(x, y)
 #define BINOP_SNIPPET_TYPE float
@@ -3517,11 +3586,11 @@ void builtin_min_v2v2_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_min_v3v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) fminf(x, y)
 #define BINOP_SNIPPET_TYPE float
@@ -3550,11 +3619,11 @@ void builtin_min_v3v3_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_min_v4v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) fminf(x, y)
 #define BINOP_SNIPPET_TYPE float
@@ -3590,11 +3659,11 @@ void builtin_min_v4v4_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_min_v2f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) fminf(x, y)
 #define BINOP_SNIPPET_TYPE float
@@ -3616,11 +3685,11 @@ void builtin_min_v2f_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_min_v3f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) fminf(x, y)
 #define BINOP_SNIPPET_TYPE float
@@ -3649,11 +3718,11 @@ void builtin_min_v3f_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_min_v4f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) fminf(x, y)
 #define BINOP_SNIPPET_TYPE float
@@ -3813,11 +3882,11 @@ void builtin_min_v4f_eval(struct sl_type_base *tb, const struct sl_expr *x, stru
 }
 
 void builtin_max_ff_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict left_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict right_column = FLOAT_REG_PTR(x->children_[1], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) fmaxf(x, y)
 #define BINOP_SNIPPET_TYPE float
@@ -3827,11 +3896,11 @@ void builtin_max_ff_runtime(struct sl_execution *exec, int exec_chain, struct sl
 }
 
 void builtin_max_v2v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) fmaxf(x, y)
 #define BINOP_SNIPPET_TYPE float
@@ -3853,11 +3922,11 @@ void builtin_max_v2v2_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_max_v3v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) fmaxf(x, y)
 #define BINOP_SNIPPET_TYPE float
@@ -3886,11 +3955,11 @@ void builtin_max_v3v3_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_max_v4v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) fmaxf(x, y)
 #define BINOP_SNIPPET_TYPE float
@@ -3926,11 +3995,11 @@ void builtin_max_v4v4_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_max_v2f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) fmaxf(x, y)
 #define BINOP_SNIPPET_TYPE float
@@ -3952,11 +4021,11 @@ void builtin_max_v2f_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_max_v3f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) fmaxf(x, y)
 #define BINOP_SNIPPET_TYPE float
@@ -3985,11 +4054,11 @@ void builtin_max_v3f_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_max_v4f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) fmaxf(x, y)
 #define BINOP_SNIPPET_TYPE float
@@ -4149,29 +4218,32 @@ void builtin_max_v4f_eval(struct sl_type_base *tb, const struct sl_expr *x, stru
 }
 
 void builtin_clamp_fff_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict first_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict second_column = FLOAT_REG_PTR(x->children_[1], 0);
   float *restrict third_column = FLOAT_REG_PTR(x->children_[2], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define TERNOP_SNIPPET_OPERATOR(x, a, b) aex_clampf(x, a, b)
+#define TERNOP_SNIPPET_SIMD_KERNEL g_sl_simd_.f_clamp_
 #define TERNOP_SNIPPET_TYPE float
 #include "sl_ternop_snippet_inc.h"
 #undef TERNOP_SNIPPET_OPERATOR
 #undef TERNOP_SNIPPET_TYPE
+#undef TERNOP_SNIPPET_SIMD_KERNEL
 }
 
 void builtin_clamp_v2v2v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict first_column;
   float *restrict second_column;
   float *restrict third_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define TERNOP_SNIPPET_OPERATOR(x, a, b) aex_clampf(x, a, b)
+#define TERNOP_SNIPPET_SIMD_KERNEL g_sl_simd_.f_clamp_
 #define TERNOP_SNIPPET_TYPE float
   first_column = FLOAT_REG_PTR(x->children_[0], 0);
   second_column = FLOAT_REG_PTR(x->children_[1], 0);
@@ -4190,17 +4262,19 @@ void builtin_clamp_v2v2v2_runtime(struct sl_execution *exec, int exec_chain, str
 
 #undef TERNOP_SNIPPET_OPERATOR
 #undef TERNOP_SNIPPET_TYPE
+#undef TERNOP_SNIPPET_SIMD_KERNEL
 }
 
 void builtin_clamp_v3v3v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict first_column;
   float *restrict second_column;
   float *restrict third_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define TERNOP_SNIPPET_OPERATOR(x, a, b) aex_clampf(x, a, b)
+#define TERNOP_SNIPPET_SIMD_KERNEL g_sl_simd_.f_clamp_
 #define TERNOP_SNIPPET_TYPE float
   first_column = FLOAT_REG_PTR(x->children_[0], 0);
   second_column = FLOAT_REG_PTR(x->children_[1], 0);
@@ -4227,17 +4301,19 @@ void builtin_clamp_v3v3v3_runtime(struct sl_execution *exec, int exec_chain, str
 
 #undef TERNOP_SNIPPET_OPERATOR
 #undef TERNOP_SNIPPET_TYPE
+#undef TERNOP_SNIPPET_SIMD_KERNEL
 }
 
 void builtin_clamp_v4v4v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict first_column;
   float *restrict second_column;
   float *restrict third_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define TERNOP_SNIPPET_OPERATOR(x, a, b) aex_clampf(x, a, b)
+#define TERNOP_SNIPPET_SIMD_KERNEL g_sl_simd_.f_clamp_
 #define TERNOP_SNIPPET_TYPE float
   first_column = FLOAT_REG_PTR(x->children_[0], 0);
   second_column = FLOAT_REG_PTR(x->children_[1], 0);
@@ -4272,17 +4348,19 @@ void builtin_clamp_v4v4v4_runtime(struct sl_execution *exec, int exec_chain, str
 
 #undef TERNOP_SNIPPET_OPERATOR
 #undef TERNOP_SNIPPET_TYPE
+#undef TERNOP_SNIPPET_SIMD_KERNEL
 }
 
 void builtin_clamp_v2ff_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict first_column;
   float *restrict second_column;
   float *restrict third_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define TERNOP_SNIPPET_OPERATOR(x, a, b) aex_clampf(x, a, b)
+#define TERNOP_SNIPPET_SIMD_KERNEL g_sl_simd_.f_clamp_
 #define TERNOP_SNIPPET_TYPE float
   first_column = FLOAT_REG_PTR(x->children_[0], 0);
   second_column = FLOAT_REG_PTR(x->children_[1], 0);
@@ -4301,17 +4379,19 @@ void builtin_clamp_v2ff_runtime(struct sl_execution *exec, int exec_chain, struc
 
 #undef TERNOP_SNIPPET_OPERATOR
 #undef TERNOP_SNIPPET_TYPE
+#undef TERNOP_SNIPPET_SIMD_KERNEL
 }
 
 void builtin_clamp_v3ff_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict first_column;
   float *restrict second_column;
   float *restrict third_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define TERNOP_SNIPPET_OPERATOR(x, a, b) aex_clampf(x, a, b)
+#define TERNOP_SNIPPET_SIMD_KERNEL g_sl_simd_.f_clamp_
 #define TERNOP_SNIPPET_TYPE float
   first_column = FLOAT_REG_PTR(x->children_[0], 0);
   second_column = FLOAT_REG_PTR(x->children_[1], 0);
@@ -4338,17 +4418,19 @@ void builtin_clamp_v3ff_runtime(struct sl_execution *exec, int exec_chain, struc
 
 #undef TERNOP_SNIPPET_OPERATOR
 #undef TERNOP_SNIPPET_TYPE
+#undef TERNOP_SNIPPET_SIMD_KERNEL
 }
 
 void builtin_clamp_v4ff_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict first_column;
   float *restrict second_column;
   float *restrict third_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define TERNOP_SNIPPET_OPERATOR(x, a, b) aex_clampf(x, a, b)
+#define TERNOP_SNIPPET_SIMD_KERNEL g_sl_simd_.f_clamp_
 #define TERNOP_SNIPPET_TYPE float
   first_column = FLOAT_REG_PTR(x->children_[0], 0);
   second_column = FLOAT_REG_PTR(x->children_[1], 0);
@@ -4383,6 +4465,7 @@ void builtin_clamp_v4ff_runtime(struct sl_execution *exec, int exec_chain, struc
 
 #undef TERNOP_SNIPPET_OPERATOR
 #undef TERNOP_SNIPPET_TYPE
+#undef TERNOP_SNIPPET_SIMD_KERNEL
 }
 
 void builtin_clamp_fff_eval(struct sl_type_base *tb, const struct sl_expr *x, struct sl_expr_temp *r) {
@@ -4559,29 +4642,32 @@ void builtin_clamp_v4ff_eval(struct sl_type_base *tb, const struct sl_expr *x, s
 }
 
 void builtin_mix_fff_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict first_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict second_column = FLOAT_REG_PTR(x->children_[1], 0);
   float *restrict third_column = FLOAT_REG_PTR(x->children_[2], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define TERNOP_SNIPPET_OPERATOR(x, a, b) aex_mixf(x, a, b)
+#define TERNOP_SNIPPET_SIMD_KERNEL g_sl_simd_.f_mix_
 #define TERNOP_SNIPPET_TYPE float
 #include "sl_ternop_snippet_inc.h"
 #undef TERNOP_SNIPPET_OPERATOR
 #undef TERNOP_SNIPPET_TYPE
+#undef TERNOP_SNIPPET_SIMD_KERNEL
 }
 
 void builtin_mix_v2v2v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict first_column;
   float *restrict second_column;
   float *restrict third_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define TERNOP_SNIPPET_OPERATOR(x, a, b) aex_mixf(x, a, b)
+#define TERNOP_SNIPPET_SIMD_KERNEL g_sl_simd_.f_mix_
 #define TERNOP_SNIPPET_TYPE float
   first_column = FLOAT_REG_PTR(x->children_[0], 0);
   second_column = FLOAT_REG_PTR(x->children_[1], 0);
@@ -4600,17 +4686,19 @@ void builtin_mix_v2v2v2_runtime(struct sl_execution *exec, int exec_chain, struc
 
 #undef TERNOP_SNIPPET_OPERATOR
 #undef TERNOP_SNIPPET_TYPE
+#undef TERNOP_SNIPPET_SIMD_KERNEL
 }
 
 void builtin_mix_v3v3v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict first_column;
   float *restrict second_column;
   float *restrict third_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define TERNOP_SNIPPET_OPERATOR(x, a, b) aex_mixf(x, a, b)
+#define TERNOP_SNIPPET_SIMD_KERNEL g_sl_simd_.f_mix_
 #define TERNOP_SNIPPET_TYPE float
   first_column = FLOAT_REG_PTR(x->children_[0], 0);
   second_column = FLOAT_REG_PTR(x->children_[1], 0);
@@ -4637,17 +4725,19 @@ void builtin_mix_v3v3v3_runtime(struct sl_execution *exec, int exec_chain, struc
 
 #undef TERNOP_SNIPPET_OPERATOR
 #undef TERNOP_SNIPPET_TYPE
+#undef TERNOP_SNIPPET_SIMD_KERNEL
 }
 
 void builtin_mix_v4v4v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict first_column;
   float *restrict second_column;
   float *restrict third_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define TERNOP_SNIPPET_OPERATOR(x, a, b) aex_mixf(x, a, b)
+#define TERNOP_SNIPPET_SIMD_KERNEL g_sl_simd_.f_mix_
 #define TERNOP_SNIPPET_TYPE float
   first_column = FLOAT_REG_PTR(x->children_[0], 0);
   second_column = FLOAT_REG_PTR(x->children_[1], 0);
@@ -4682,17 +4772,19 @@ void builtin_mix_v4v4v4_runtime(struct sl_execution *exec, int exec_chain, struc
 
 #undef TERNOP_SNIPPET_OPERATOR
 #undef TERNOP_SNIPPET_TYPE
+#undef TERNOP_SNIPPET_SIMD_KERNEL
 }
 
 void builtin_mix_v2v2f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict first_column;
   float *restrict second_column;
   float *restrict third_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define TERNOP_SNIPPET_OPERATOR(x, a, b) aex_mixf(x, a, b)
+#define TERNOP_SNIPPET_SIMD_KERNEL g_sl_simd_.f_mix_
 #define TERNOP_SNIPPET_TYPE float
   first_column = FLOAT_REG_PTR(x->children_[0], 0);
   second_column = FLOAT_REG_PTR(x->children_[1], 0);
@@ -4711,17 +4803,19 @@ void builtin_mix_v2v2f_runtime(struct sl_execution *exec, int exec_chain, struct
 
 #undef TERNOP_SNIPPET_OPERATOR
 #undef TERNOP_SNIPPET_TYPE
+#undef TERNOP_SNIPPET_SIMD_KERNEL
 }
 
 void builtin_mix_v3v3f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict first_column;
   float *restrict second_column;
   float *restrict third_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define TERNOP_SNIPPET_OPERATOR(x, a, b) aex_mixf(x, a, b)
+#define TERNOP_SNIPPET_SIMD_KERNEL g_sl_simd_.f_mix_
 #define TERNOP_SNIPPET_TYPE float
   first_column = FLOAT_REG_PTR(x->children_[0], 0);
   second_column = FLOAT_REG_PTR(x->children_[1], 0);
@@ -4748,17 +4842,19 @@ void builtin_mix_v3v3f_runtime(struct sl_execution *exec, int exec_chain, struct
 
 #undef TERNOP_SNIPPET_OPERATOR
 #undef TERNOP_SNIPPET_TYPE
+#undef TERNOP_SNIPPET_SIMD_KERNEL
 }
 
 void builtin_mix_v4v4f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict first_column;
   float *restrict second_column;
   float *restrict third_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define TERNOP_SNIPPET_OPERATOR(x, a, b) aex_mixf(x, a, b)
+#define TERNOP_SNIPPET_SIMD_KERNEL g_sl_simd_.f_mix_
 #define TERNOP_SNIPPET_TYPE float
   first_column = FLOAT_REG_PTR(x->children_[0], 0);
   second_column = FLOAT_REG_PTR(x->children_[1], 0);
@@ -4793,6 +4889,7 @@ void builtin_mix_v4v4f_runtime(struct sl_execution *exec, int exec_chain, struct
 
 #undef TERNOP_SNIPPET_OPERATOR
 #undef TERNOP_SNIPPET_TYPE
+#undef TERNOP_SNIPPET_SIMD_KERNEL
 }
 
 void builtin_mix_fff_eval(struct sl_type_base *tb, const struct sl_expr *x, struct sl_expr_temp *r) {
@@ -4969,11 +5066,11 @@ void builtin_mix_v4v4f_eval(struct sl_type_base *tb, const struct sl_expr *x, st
 }
 
 void builtin_step_ff_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict left_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict right_column = FLOAT_REG_PTR(x->children_[1], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_stepf(x, y)
 #define BINOP_SNIPPET_TYPE float
@@ -4983,11 +5080,11 @@ void builtin_step_ff_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_step_v2v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_stepf(x, y)
 #define BINOP_SNIPPET_TYPE float
@@ -5009,11 +5106,11 @@ void builtin_step_v2v2_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_step_v3v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_stepf(x, y)
 #define BINOP_SNIPPET_TYPE float
@@ -5042,11 +5139,11 @@ void builtin_step_v3v3_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_step_v4v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_stepf(x, y)
 #define BINOP_SNIPPET_TYPE float
@@ -5082,11 +5179,11 @@ void builtin_step_v4v4_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_step_fv2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_stepf(x, y)
 #define BINOP_SNIPPET_TYPE float
@@ -5108,11 +5205,11 @@ void builtin_step_fv2_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_step_fv3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_stepf(x, y)
 #define BINOP_SNIPPET_TYPE float
@@ -5141,11 +5238,11 @@ void builtin_step_fv3_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_step_fv4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_stepf(x, y)
 #define BINOP_SNIPPET_TYPE float
@@ -5305,12 +5402,12 @@ void builtin_step_fv4_eval(struct sl_type_base *tb, const struct sl_expr *x, str
 }
 
 void builtin_smoothstep_fff_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict first_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict second_column = FLOAT_REG_PTR(x->children_[1], 0);
   float *restrict third_column = FLOAT_REG_PTR(x->children_[2], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define TERNOP_SNIPPET_OPERATOR(x, a, b) aex_smoothstepf(x, a, b)
 #define TERNOP_SNIPPET_TYPE float
@@ -5320,12 +5417,12 @@ void builtin_smoothstep_fff_runtime(struct sl_execution *exec, int exec_chain, s
 }
 
 void builtin_smoothstep_v2v2v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict first_column;
   float *restrict second_column;
   float *restrict third_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define TERNOP_SNIPPET_OPERATOR(x, a, b) aex_smoothstepf(x, a, b)
 #define TERNOP_SNIPPET_TYPE float
@@ -5349,12 +5446,12 @@ void builtin_smoothstep_v2v2v2_runtime(struct sl_execution *exec, int exec_chain
 }
 
 void builtin_smoothstep_v3v3v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict first_column;
   float *restrict second_column;
   float *restrict third_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define TERNOP_SNIPPET_OPERATOR(x, a, b) aex_smoothstepf(x, a, b)
 #define TERNOP_SNIPPET_TYPE float
@@ -5386,12 +5483,12 @@ void builtin_smoothstep_v3v3v3_runtime(struct sl_execution *exec, int exec_chain
 }
 
 void builtin_smoothstep_v4v4v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict first_column;
   float *restrict second_column;
   float *restrict third_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define TERNOP_SNIPPET_OPERATOR(x, a, b) aex_smoothstepf(x, a, b)
 #define TERNOP_SNIPPET_TYPE float
@@ -5431,12 +5528,12 @@ void builtin_smoothstep_v4v4v4_runtime(struct sl_execution *exec, int exec_chain
 }
 
 void builtin_smoothstep_ffv2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict first_column;
   float *restrict second_column;
   float *restrict third_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define TERNOP_SNIPPET_OPERATOR(x, a, b) aex_smoothstepf(x, a, b)
 #define TERNOP_SNIPPET_TYPE float
@@ -5460,12 +5557,12 @@ void builtin_smoothstep_ffv2_runtime(struct sl_execution *exec, int exec_chain,
 }
 
 void builtin_smoothstep_ffv3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict first_column;
   float *restrict second_column;
   float *restrict third_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define TERNOP_SNIPPET_OPERATOR(x, a, b) aex_smoothstepf(x, a, b)
 #define TERNOP_SNIPPET_TYPE float
@@ -5497,12 +5594,12 @@ void builtin_smoothstep_ffv3_runtime(struct sl_execution *exec, int exec_chain,
 }
 
 void builtin_smoothstep_ffv4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict first_column;
   float *restrict second_column;
   float *restrict third_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define TERNOP_SNIPPET_OPERATOR(x, a, b) aex_smoothstepf(x, a, b)
 #define TERNOP_SNIPPET_TYPE float
@@ -5718,10 +5815,10 @@ void builtin_smoothstep_ffv4_eval(struct sl_type_base *tb, const struct sl_expr
 /* Geometric Functions */
 
 void builtin_length_f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict opd_column = FLOAT_REG_PTR(x->children_[0], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) fabsf(opd)
 #define UNOP_SNIPPET_TYPE float
@@ -5731,11 +5828,11 @@ void builtin_length_f_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_length_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict left_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict right_column = FLOAT_REG_PTR(x->children_[0], 1);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) sqrtf(x * x + y * y)
 #define BINOP_SNIPPET_TYPE float
@@ -5745,12 +5842,12 @@ void builtin_length_v2_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_length_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict first_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict second_column = FLOAT_REG_PTR(x->children_[0], 1);
   float *restrict third_column = FLOAT_REG_PTR(x->children_[0], 2);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define TERNOP_SNIPPET_OPERATOR(x, y, z) sqrtf(x * x + y * y + z * z)
 #define TERNOP_SNIPPET_TYPE float
@@ -5760,13 +5857,13 @@ void builtin_length_v3_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_length_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict first_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict second_column = FLOAT_REG_PTR(x->children_[0], 1);
   float *restrict third_column = FLOAT_REG_PTR(x->children_[0], 2);
   float *restrict fourth_column = FLOAT_REG_PTR(x->children_[0], 3);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define QUADOP_SNIPPET_OPERATOR(x, y, z, w) sqrtf(x * x + y * y + z * z + w * w)
 #define QUADOP_SNIPPET_TYPE float
@@ -5816,11 +5913,11 @@ void builtin_length_v4_eval(struct sl_type_base *tb, const struct sl_expr *x, st
 }
 
 void builtin_distance_ff_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict left_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict right_column = FLOAT_REG_PTR(x->children_[1], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) fabsf(x - y)
 #define BINOP_SNIPPET_TYPE float
@@ -5830,13 +5927,13 @@ void builtin_distance_ff_runtime(struct sl_execution *exec, int exec_chain, stru
 }
 
 void builtin_distance_v2v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict first_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict second_column = FLOAT_REG_PTR(x->children_[0], 1);
   float *restrict third_column = FLOAT_REG_PTR(x->children_[1], 0);
   float *restrict fourth_column = FLOAT_REG_PTR(x->children_[1], 1);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define QUADOP_SNIPPET_OPERATOR(x0, y0, x1, y1) sqrtf((x0 - x1) * (x0 - x1) + (y0 - y1) * (y0 - y1))
 #define QUADOP_SNIPPET_TYPE float
@@ -5846,7 +5943,7 @@ void builtin_distance_v2v2_runtime(struct sl_execution *exec, int exec_chain, st
 }
 
 void builtin_distance_v3v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict first_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict second_column = FLOAT_REG_PTR(x->children_[0], 1);
@@ -5854,7 +5951,7 @@ void builtin_distance_v3v3_runtime(struct sl_execution *exec, int exec_chain, st
   float *restrict fourth_column = FLOAT_REG_PTR(x->children_[1], 0);
   float *restrict fifth_column = FLOAT_REG_PTR(x->children_[1], 1);
   float *restrict sixth_column = FLOAT_REG_PTR(x->children_[1], 2);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define SENOP_SNIPPET_OPERATOR(x0, y0, z0, x1, y1, z1) sqrtf((x0 - x1) * (x0 - x1) + (y0 - y1) * (y0 - y1) + (z0 - z1) * (z0 - z1))
 #define SENOP_SNIPPET_TYPE float
@@ -5864,7 +5961,7 @@ void builtin_distance_v3v3_runtime(struct sl_execution *exec, int exec_chain, st
 }
 
 void builtin_distance_v4v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict first_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict second_column = FLOAT_REG_PTR(x->children_[0], 1);
@@ -5874,7 +5971,7 @@ void builtin_distance_v4v4_runtime(struct sl_execution *exec, int exec_chain, st
   float *restrict sixth_column = FLOAT_REG_PTR(x->children_[1], 1);
   float *restrict seventh_column = FLOAT_REG_PTR(x->children_[1], 2);
   float *restrict eighth_column = FLOAT_REG_PTR(x->children_[1], 3);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define OCTONOP_SNIPPET_OPERATOR(x0, y0, z0, w0, x1, y1, z1, w1) sqrtf((x0 - x1) * (x0 - x1) + (y0 - y1) * (y0 - y1) + (z0 - z1) * (z0 - z1) + (w0 - w1) * (w0 - w1))
 #define OCTONOP_SNIPPET_TYPE float
@@ -5954,11 +6051,11 @@ void builtin_distance_v4v4_eval(struct sl_type_base *tb, const struct sl_expr *x
 }
 
 void builtin_dot_ff_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict left_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict right_column = FLOAT_REG_PTR(x->children_[1], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) (x*y)
 #define BINOP_SNIPPET_TYPE float
@@ -5968,13 +6065,13 @@ void builtin_dot_ff_runtime(struct sl_execution *exec, int exec_chain, struct sl
 }
 
 void builtin_dot_v2v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict first_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict second_column = FLOAT_REG_PTR(x->children_[0], 1);
   float *restrict third_column = FLOAT_REG_PTR(x->children_[1], 0);
   float *restrict fourth_column = FLOAT_REG_PTR(x->children_[1], 1);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define QUADOP_SNIPPET_OPERATOR(x0, y0, x1, y1) (x0*x1 + y0*y1)
 #define QUADOP_SNIPPET_TYPE float
@@ -5984,7 +6081,7 @@ void builtin_dot_v2v2_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_dot_v3v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict first_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict second_column = FLOAT_REG_PTR(x->children_[0], 1);
@@ -5992,7 +6089,7 @@ void builtin_dot_v3v3_runtime(struct sl_execution *exec, int exec_chain, struct
   float *restrict fourth_column = FLOAT_REG_PTR(x->children_[1], 0);
   float *restrict fifth_column = FLOAT_REG_PTR(x->children_[1], 1);
   float *restrict sixth_column = FLOAT_REG_PTR(x->children_[1], 2);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define SENOP_SNIPPET_OPERATOR(x0, y0, z0, x1, y1, z1) (x0*x1 + y0*y1 + z0*z1)
 #define SENOP_SNIPPET_TYPE float
@@ -6002,7 +6099,7 @@ void builtin_dot_v3v3_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_dot_v4v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict first_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict second_column = FLOAT_REG_PTR(x->children_[0], 1);
@@ -6012,7 +6109,7 @@ void builtin_dot_v4v4_runtime(struct sl_execution *exec, int exec_chain, struct
   float *restrict sixth_column = FLOAT_REG_PTR(x->children_[1], 1);
   float *restrict seventh_column = FLOAT_REG_PTR(x->children_[1], 2);
   float *restrict eighth_column = FLOAT_REG_PTR(x->children_[1], 3);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define OCTONOP_SNIPPET_OPERATOR(x0, y0, z0, w0, x1, y1, z1, w1) (x0*x1 + y0*y1 + z0*z1 + w0*w1)
 #define OCTONOP_SNIPPET_TYPE float
@@ -6092,13 +6189,13 @@ void builtin_dot_v4v4_eval(struct sl_type_base *tb, const struct sl_expr *x, str
 }
 
 void builtin_cross_v3v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column;
   float *restrict first_column;
   float *restrict second_column;
   float *restrict third_column;
   float *restrict fourth_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define QUADOP_SNIPPET_OPERATOR(a, b, c, d) (a*b - c*d)
 #define QUADOP_SNIPPET_TYPE float
@@ -6149,10 +6246,10 @@ void builtin_cross_v3v3_eval(struct sl_type_base *tb, const struct sl_expr *x, s
 }
 
 void builtin_normalize_f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict opd_column = FLOAT_REG_PTR(x->children_[0], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) (opd < 0.f) ? -1.f : 1.f
 #define UNOP_SNIPPET_TYPE float
@@ -6162,18 +6259,17 @@ void builtin_normalize_f_runtime(struct sl_execution *exec, int exec_chain, stru
 }
 
 void builtin_normalize_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_x_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict result_y_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict x_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict y_column = FLOAT_REG_PTR(x->children_[0], 1);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
+    sl_exec_row_t delta;
 
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict result_x = result_x_column + row;
         float *restrict result_y = result_y_column + row;
@@ -6187,12 +6283,12 @@ void builtin_normalize_v2_runtime(struct sl_execution *exec, int exec_chain, str
           result_y[n] = y[n] / len;
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict result_x = result_x_column + row;
         float *restrict result_y = result_y_column + row;
@@ -6205,10 +6301,10 @@ void builtin_normalize_v2_runtime(struct sl_execution *exec, int exec_chain, str
           result_x[n] = x[n] / len;
           result_y[n] = y[n] / len;
         }
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -6226,20 +6322,19 @@ void builtin_normalize_v2_runtime(struct sl_execution *exec, int exec_chain, str
 }
 
 void builtin_normalize_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_x_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict result_y_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict result_z_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 2);
   float *restrict x_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict y_column = FLOAT_REG_PTR(x->children_[0], 1);
   float *restrict z_column = FLOAT_REG_PTR(x->children_[0], 2);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
+    sl_exec_row_t delta;
 
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict result_x = result_x_column + row;
         float *restrict result_y = result_y_column + row;
@@ -6256,12 +6351,12 @@ void builtin_normalize_v3_runtime(struct sl_execution *exec, int exec_chain, str
           result_z[n] = z[n] / len;
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict result_x = result_x_column + row;
         float *restrict result_y = result_y_column + row;
@@ -6277,10 +6372,10 @@ void builtin_normalize_v3_runtime(struct sl_execution *exec, int exec_chain, str
           result_y[n] = y[n] / len;
           result_z[n] = z[n] / len;
         }
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -6299,7 +6394,7 @@ void builtin_normalize_v3_runtime(struct sl_execution *exec, int exec_chain, str
 }
 
 void builtin_normalize_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_x_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict result_y_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict result_z_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 2);
@@ -6308,13 +6403,12 @@ void builtin_normalize_v4_runtime(struct sl_execution *exec, int exec_chain, str
   float *restrict y_column = FLOAT_REG_PTR(x->children_[0], 1);
   float *restrict z_column = FLOAT_REG_PTR(x->children_[0], 2);
   float *restrict w_column = FLOAT_REG_PTR(x->children_[0], 3);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
+    sl_exec_row_t delta;
 
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict result_x = result_x_column + row;
         float *restrict result_y = result_y_column + row;
@@ -6334,12 +6428,12 @@ void builtin_normalize_v4_runtime(struct sl_execution *exec, int exec_chain, str
           result_w[n] = w[n] / len;
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict result_x = result_x_column + row;
         float *restrict result_y = result_y_column + row;
@@ -6358,10 +6452,10 @@ void builtin_normalize_v4_runtime(struct sl_execution *exec, int exec_chain, str
           result_z[n] = z[n] / len;
           result_w[n] = w[n] / len;
         }
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -6424,18 +6518,17 @@ void builtin_normalize_v4_eval(struct sl_type_base *tb, const struct sl_expr *x,
 }
 
 void builtin_faceforward_fff_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict N_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict I_column = FLOAT_REG_PTR(x->children_[1], 0);
   float *restrict Nref_column = FLOAT_REG_PTR(x->children_[2], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
+    sl_exec_row_t delta;
 
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict result = result_column + row;
         const float *restrict N = N_column + row;
@@ -6448,12 +6541,12 @@ void builtin_faceforward_fff_runtime(struct sl_execution *exec, int exec_chain,
           result[n] = (dot_nref_i < 0) ? N[n] : -N[n];
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict result = result_column + row;
         const float *restrict N = N_column + row;
@@ -6465,10 +6558,10 @@ void builtin_faceforward_fff_runtime(struct sl_execution *exec, int exec_chain,
           float dot_nref_i = Nref[n] * I[n];
           result[n] = (dot_nref_i < 0) ? N[n] : -N[n];
         }
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -6485,7 +6578,7 @@ void builtin_faceforward_fff_runtime(struct sl_execution *exec, int exec_chain,
 }
 
 void builtin_faceforward_v2v2v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict resultx_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict resulty_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict Nx_column = FLOAT_REG_PTR(x->children_[0], 0);
@@ -6494,13 +6587,12 @@ void builtin_faceforward_v2v2v2_runtime(struct sl_execution *exec, int exec_chai
   float *restrict Iy_column = FLOAT_REG_PTR(x->children_[1], 1);
   float *restrict Nrefx_column = FLOAT_REG_PTR(x->children_[2], 0);
   float *restrict Nrefy_column = FLOAT_REG_PTR(x->children_[2], 1);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
+    sl_exec_row_t delta;
 
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict result_x = resultx_column + row;
         float *restrict result_y = resulty_column + row;
@@ -6518,12 +6610,12 @@ void builtin_faceforward_v2v2v2_runtime(struct sl_execution *exec, int exec_chai
           result_y[n] = (dot_nref_i < 0) ? N_y[n] : -N_y[n];
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict result_x = resultx_column + row;
         float *restrict result_y = resulty_column + row;
@@ -6540,10 +6632,10 @@ void builtin_faceforward_v2v2v2_runtime(struct sl_execution *exec, int exec_chai
           result_x[n] = (dot_nref_i < 0) ? N_x[n] : -N_x[n];
           result_y[n] = (dot_nref_i < 0) ? N_y[n] : -N_y[n];
         }
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -6561,7 +6653,7 @@ void builtin_faceforward_v2v2v2_runtime(struct sl_execution *exec, int exec_chai
 }
 
 void builtin_faceforward_v3v3v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict resultx_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict resulty_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict resultz_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 2);
@@ -6574,13 +6666,12 @@ void builtin_faceforward_v3v3v3_runtime(struct sl_execution *exec, int exec_chai
   float *restrict Nrefx_column = FLOAT_REG_PTR(x->children_[2], 0);
   float *restrict Nrefy_column = FLOAT_REG_PTR(x->children_[2], 1);
   float *restrict Nrefz_column = FLOAT_REG_PTR(x->children_[2], 2);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
+    sl_exec_row_t delta;
 
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict result_x = resultx_column + row;
         float *restrict result_y = resulty_column + row;
@@ -6603,12 +6694,12 @@ void builtin_faceforward_v3v3v3_runtime(struct sl_execution *exec, int exec_chai
           result_z[n] = (dot_nref_i < 0) ? N_z[n] : -N_z[n];
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict result_x = resultx_column + row;
         float *restrict result_y = resulty_column + row;
@@ -6630,10 +6721,10 @@ void builtin_faceforward_v3v3v3_runtime(struct sl_execution *exec, int exec_chai
           result_y[n] = (dot_nref_i < 0) ? N_y[n] : -N_y[n];
           result_z[n] = (dot_nref_i < 0) ? N_z[n] : -N_z[n];
         }
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -6652,7 +6743,7 @@ void builtin_faceforward_v3v3v3_runtime(struct sl_execution *exec, int exec_chai
 }
 
 void builtin_faceforward_v4v4v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict resultx_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict resulty_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict resultz_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 2);
@@ -6669,13 +6760,12 @@ void builtin_faceforward_v4v4v4_runtime(struct sl_execution *exec, int exec_chai
   float *restrict Nrefy_column = FLOAT_REG_PTR(x->children_[2], 1);
   float *restrict Nrefz_column = FLOAT_REG_PTR(x->children_[2], 2);
   float *restrict Nrefw_column = FLOAT_REG_PTR(x->children_[2], 3);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
+    sl_exec_row_t delta;
 
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict result_x = resultx_column + row;
         float *restrict result_y = resulty_column + row;
@@ -6703,12 +6793,12 @@ void builtin_faceforward_v4v4v4_runtime(struct sl_execution *exec, int exec_chai
           result_w[n] = (dot_nref_i < 0) ? N_w[n] : -N_w[n];
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict result_x = resultx_column + row;
         float *restrict result_y = resulty_column + row;
@@ -6735,10 +6825,10 @@ void builtin_faceforward_v4v4v4_runtime(struct sl_execution *exec, int exec_chai
           result_z[n] = (dot_nref_i < 0) ? N_z[n] : -N_z[n];
           result_w[n] = (dot_nref_i < 0) ? N_w[n] : -N_w[n];
         }
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -6864,17 +6954,16 @@ void builtin_faceforward_v4v4v4_eval(struct sl_type_base *tb, const struct sl_ex
 }
 
 void builtin_reflect_ff_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict I_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict N_column = FLOAT_REG_PTR(x->children_[1], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
+    sl_exec_row_t delta;
 
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict result = result_column + row;
         const float *restrict I = I_column + row;
@@ -6886,12 +6975,12 @@ void builtin_reflect_ff_runtime(struct sl_execution *exec, int exec_chain, struc
           result[n] = I[n] - two_dot_n_i * N[n];
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict result = result_column + row;
         const float *restrict I = I_column + row;
@@ -6902,10 +6991,10 @@ void builtin_reflect_ff_runtime(struct sl_execution *exec, int exec_chain, struc
           float two_dot_n_i = 2.f * N[n] * I[n];
           result[n] = I[n] - two_dot_n_i * N[n];
         }
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -6922,20 +7011,19 @@ void builtin_reflect_ff_runtime(struct sl_execution *exec, int exec_chain, struc
 }
 
 void builtin_reflect_v2v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict resultx_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict resulty_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict Ix_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict Iy_column = FLOAT_REG_PTR(x->children_[0], 1);
   float *restrict Nx_column = FLOAT_REG_PTR(x->children_[1], 0);
   float *restrict Ny_column = FLOAT_REG_PTR(x->children_[1], 1);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
+    sl_exec_row_t delta;
 
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict resultx = resultx_column + row;
         float *restrict resulty = resulty_column + row;
@@ -6951,12 +7039,12 @@ void builtin_reflect_v2v2_runtime(struct sl_execution *exec, int exec_chain, str
           resulty[n] = Iy[n] - two_dot_n_i * Ny[n];
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict resultx = resultx_column + row;
         float *restrict resulty = resulty_column + row;
@@ -6971,10 +7059,10 @@ void builtin_reflect_v2v2_runtime(struct sl_execution *exec, int exec_chain, str
           resultx[n] = Ix[n] - two_dot_n_i * Nx[n];
           resulty[n] = Iy[n] - two_dot_n_i * Ny[n];
         }
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -6992,7 +7080,7 @@ void builtin_reflect_v2v2_runtime(struct sl_execution *exec, int exec_chain, str
 }
 
 void builtin_reflect_v3v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict resultx_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict resulty_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict resultz_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 2);
@@ -7002,13 +7090,12 @@ void builtin_reflect_v3v3_runtime(struct sl_execution *exec, int exec_chain, str
   float *restrict Nx_column = FLOAT_REG_PTR(x->children_[1], 0);
   float *restrict Ny_column = FLOAT_REG_PTR(x->children_[1], 1);
   float *restrict Nz_column = FLOAT_REG_PTR(x->children_[1], 2);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
+    sl_exec_row_t delta;
 
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict resultx = resultx_column + row;
         float *restrict resulty = resulty_column + row;
@@ -7028,12 +7115,12 @@ void builtin_reflect_v3v3_runtime(struct sl_execution *exec, int exec_chain, str
           resultz[n] = Iz[n] - two_dot_n_i * Nz[n];
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict resultx = resultx_column + row;
         float *restrict resulty = resulty_column + row;
@@ -7052,10 +7139,10 @@ void builtin_reflect_v3v3_runtime(struct sl_execution *exec, int exec_chain, str
           resulty[n] = Iy[n] - two_dot_n_i * Ny[n];
           resultz[n] = Iz[n] - two_dot_n_i * Nz[n];
         }
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -7074,7 +7161,7 @@ void builtin_reflect_v3v3_runtime(struct sl_execution *exec, int exec_chain, str
 }
 
 void builtin_reflect_v4v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict resultx_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict resulty_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict resultz_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 2);
@@ -7087,13 +7174,12 @@ void builtin_reflect_v4v4_runtime(struct sl_execution *exec, int exec_chain, str
   float *restrict Ny_column = FLOAT_REG_PTR(x->children_[1], 1);
   float *restrict Nz_column = FLOAT_REG_PTR(x->children_[1], 2);
   float *restrict Nw_column = FLOAT_REG_PTR(x->children_[1], 3);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
+    sl_exec_row_t delta;
 
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict resultx = resultx_column + row;
         float *restrict resulty = resulty_column + row;
@@ -7117,12 +7203,12 @@ void builtin_reflect_v4v4_runtime(struct sl_execution *exec, int exec_chain, str
           resultw[n] = Iw[n] - two_dot_n_i * Nw[n];
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict resultx = resultx_column + row;
         float *restrict resulty = resulty_column + row;
@@ -7145,10 +7231,10 @@ void builtin_reflect_v4v4_runtime(struct sl_execution *exec, int exec_chain, str
           resultz[n] = Iz[n] - two_dot_n_i * Nz[n];
           resultw[n] = Iw[n] - two_dot_n_i * Nw[n];
         }
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -7246,18 +7332,17 @@ void builtin_reflect_v4v4_eval(struct sl_type_base *tb, const struct sl_expr *x,
 }
 
 void builtin_refract_fff_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict I_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict N_column = FLOAT_REG_PTR(x->children_[1], 0);
   float *restrict eta_column = FLOAT_REG_PTR(x->children_[2], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
+    sl_exec_row_t delta;
 
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict result = result_column + row;
         const float *restrict N = N_column + row;
@@ -7276,12 +7361,12 @@ void builtin_refract_fff_runtime(struct sl_execution *exec, int exec_chain, stru
           }
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict result = result_column + row;
         const float *restrict N = N_column + row;
@@ -7299,10 +7384,10 @@ void builtin_refract_fff_runtime(struct sl_execution *exec, int exec_chain, stru
             result[n] = eta[n] * I[n] - (eta[n] * dot_n_i + sqrtf(k)) * N[n];
           }
         }
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -7325,7 +7410,7 @@ void builtin_refract_fff_runtime(struct sl_execution *exec, int exec_chain, stru
 }
 
 void builtin_refract_v2v2f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict resultx_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict resulty_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict Ix_column = FLOAT_REG_PTR(x->children_[0], 0);
@@ -7333,13 +7418,12 @@ void builtin_refract_v2v2f_runtime(struct sl_execution *exec, int exec_chain, st
   float *restrict Nx_column = FLOAT_REG_PTR(x->children_[1], 0);
   float *restrict Ny_column = FLOAT_REG_PTR(x->children_[1], 1);
   float *restrict eta_column = FLOAT_REG_PTR(x->children_[2], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
+    sl_exec_row_t delta;
 
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict resultx = resultx_column + row;
         float *restrict resulty = resulty_column + row;
@@ -7363,12 +7447,12 @@ void builtin_refract_v2v2f_runtime(struct sl_execution *exec, int exec_chain, st
           }
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict resultx = resultx_column + row;
         float *restrict resulty = resulty_column + row;
@@ -7391,10 +7475,10 @@ void builtin_refract_v2v2f_runtime(struct sl_execution *exec, int exec_chain, st
             resulty[n] = eta[n] * Iy[n] - (eta[n] * dot_n_i + sqrtf(k)) * Ny[n];
           }
         }
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -7419,7 +7503,7 @@ void builtin_refract_v2v2f_runtime(struct sl_execution *exec, int exec_chain, st
 }
 
 void builtin_refract_v3v3f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict resultx_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict resulty_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict resultz_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 2);
@@ -7430,13 +7514,12 @@ void builtin_refract_v3v3f_runtime(struct sl_execution *exec, int exec_chain, st
   float *restrict Ny_column = FLOAT_REG_PTR(x->children_[1], 1);
   float *restrict Nz_column = FLOAT_REG_PTR(x->children_[1], 2);
   float *restrict eta_column = FLOAT_REG_PTR(x->children_[2], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
+    sl_exec_row_t delta;
 
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict resultx = resultx_column + row;
         float *restrict resulty = resulty_column + row;
@@ -7465,12 +7548,12 @@ void builtin_refract_v3v3f_runtime(struct sl_execution *exec, int exec_chain, st
           }
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict resultx = resultx_column + row;
         float *restrict resulty = resulty_column + row;
@@ -7498,10 +7581,10 @@ void builtin_refract_v3v3f_runtime(struct sl_execution *exec, int exec_chain, st
             resultz[n] = eta[n] * Iz[n] - (eta[n] * dot_n_i + sqrtf(k)) * Nz[n];
           }
         }
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -7528,7 +7611,7 @@ void builtin_refract_v3v3f_runtime(struct sl_execution *exec, int exec_chain, st
 }
 
 void builtin_refract_v4v4f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict resultx_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict resulty_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict resultz_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 2);
@@ -7542,13 +7625,12 @@ void builtin_refract_v4v4f_runtime(struct sl_execution *exec, int exec_chain, st
   float *restrict Nz_column = FLOAT_REG_PTR(x->children_[1], 2);
   float *restrict Nw_column = FLOAT_REG_PTR(x->children_[1], 3);
   float *restrict eta_column = FLOAT_REG_PTR(x->children_[2], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
+    sl_exec_row_t delta;
 
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict resultx = resultx_column + row;
         float *restrict resulty = resulty_column + row;
@@ -7582,12 +7664,12 @@ void builtin_refract_v4v4f_runtime(struct sl_execution *exec, int exec_chain, st
           }
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict resultx = resultx_column + row;
         float *restrict resulty = resulty_column + row;
@@ -7620,10 +7702,10 @@ void builtin_refract_v4v4f_runtime(struct sl_execution *exec, int exec_chain, st
             resultw[n] = eta[n] * Iw[n] - (eta[n] * dot_n_i + sqrtf(k)) * Nw[n];
           }
         }
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -7782,17 +7864,16 @@ static void builtin_matrixCompMult_mNmN_runtime(struct sl_execution *exec, int e
   size_t component_index;
 
   for (component_index = 0; component_index < N; ++component_index) {
-    uint8_t *restrict chain_column = exec->exec_chain_reg_;
+    sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
     float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, component_index);
     float *restrict first_opd_column = FLOAT_REG_PTR(x->children_[0], component_index);
     float *restrict second_opd_column = FLOAT_REG_PTR(x->children_[1], component_index);
-    uint8_t row = exec_chain;
+    sl_exec_row_t row = exec_chain;
 
     for (;;) {
-      uint64_t chain;
-      uint8_t delta;
+      sl_exec_row_t delta;
 
-      if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+      if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
         do {
           float *restrict result = result_column + row;
           const float *first_opd = first_opd_column + row;
@@ -7803,12 +7884,12 @@ static void builtin_matrixCompMult_mNmN_runtime(struct sl_execution *exec, int e
             result[n] = first_opd[n] * second_opd[n];
           }
 
-          delta = (chain & 0xFF00000000000000) >> 56;
+          delta = chain_column[row + 7];
           if (!delta) break;
           row += 7 + delta;
-        } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+        } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
       }
-      else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+      else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
         do {
           float *restrict result = result_column + row;
           const float *first_opd = first_opd_column + row;
@@ -7818,10 +7899,10 @@ static void builtin_matrixCompMult_mNmN_runtime(struct sl_execution *exec, int e
           for (n = 0; n < 4; n++) {
             result[n] = first_opd[n] * second_opd[n];
           }
-          delta = (chain & 0xFF000000) >> 24;
+          delta = chain_column[row + 3];
           if (!delta) break;
           row += 3 + delta;
-        } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+        } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
       }
       else {
         do {
@@ -7902,11 +7983,11 @@ void builtin_matrixCompMult_m4m4_eval(struct sl_type_base *tb, const struct sl_e
 #define aex_not_equalb(a,b) (uint8_t)(0x100 - (!(a)!=!(b)))
 
 void builtin_lessThan_v2v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_less_thanf(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
@@ -7930,11 +8011,11 @@ void builtin_lessThan_v2v2_runtime(struct sl_execution *exec, int exec_chain, st
 }
 
 void builtin_lessThan_v3v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_less_thanf(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
@@ -7965,11 +8046,11 @@ void builtin_lessThan_v3v3_runtime(struct sl_execution *exec, int exec_chain, st
 }
 
 void builtin_lessThan_v4v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_less_thanf(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
@@ -8061,15 +8142,15 @@ void builtin_lessThan_v4v4_eval(struct sl_type_base *tb, const struct sl_expr *x
 }
 
 void builtin_lessThan_iv2iv2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
-  int64_t *restrict left_column;
-  int64_t *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_int_t *restrict left_column;
+  sl_exec_int_t *restrict right_column;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_less_thani(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
-#define BINOP_SNIPPET_TYPE int64_t
+#define BINOP_SNIPPET_TYPE sl_exec_int_t
   left_column = INT_REG_PTR(x->children_[0], 0);
   right_column = INT_REG_PTR(x->children_[1], 0);
   result_column = BOOL_REG_PTR_NRV(&x->base_regs_, 0);
@@ -8089,15 +8170,15 @@ void builtin_lessThan_iv2iv2_runtime(struct sl_execution *exec, int exec_chain,
 }
 
 void builtin_lessThan_iv3iv3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
-  int64_t *restrict left_column;
-  int64_t *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_int_t *restrict left_column;
+  sl_exec_int_t *restrict right_column;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_less_thani(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
-#define BINOP_SNIPPET_TYPE int64_t
+#define BINOP_SNIPPET_TYPE sl_exec_int_t
   left_column = INT_REG_PTR(x->children_[0], 0);
   right_column = INT_REG_PTR(x->children_[1], 0);
   result_column = BOOL_REG_PTR_NRV(&x->base_regs_, 0);
@@ -8124,15 +8205,15 @@ void builtin_lessThan_iv3iv3_runtime(struct sl_execution *exec, int exec_chain,
 }
 
 void builtin_lessThan_iv4iv4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
-  int64_t *restrict left_column;
-  int64_t *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_int_t *restrict left_column;
+  sl_exec_int_t *restrict right_column;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_less_thani(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
-#define BINOP_SNIPPET_TYPE int64_t 
+#define BINOP_SNIPPET_TYPE sl_exec_int_t 
   left_column = INT_REG_PTR(x->children_[0], 0);
   right_column = INT_REG_PTR(x->children_[1], 0);
   result_column = BOOL_REG_PTR_NRV(&x->base_regs_, 0);
@@ -8220,11 +8301,11 @@ void builtin_lessThan_iv4iv4_eval(struct sl_type_base *tb, const struct sl_expr
 }
 
 void builtin_lessThanEqual_v2v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_less_than_equalf(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
@@ -8248,11 +8329,11 @@ void builtin_lessThanEqual_v2v2_runtime(struct sl_execution *exec, int exec_chai
 }
 
 void builtin_lessThanEqual_v3v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_less_than_equalf(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
@@ -8283,11 +8364,11 @@ void builtin_lessThanEqual_v3v3_runtime(struct sl_execution *exec, int exec_chai
 }
 
 void builtin_lessThanEqual_v4v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_less_than_equalf(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
@@ -8379,15 +8460,15 @@ void builtin_lessThanEqual_v4v4_eval(struct sl_type_base *tb, const struct sl_ex
 }
 
 void builtin_lessThanEqual_iv2iv2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
-  int64_t *restrict left_column;
-  int64_t *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_int_t *restrict left_column;
+  sl_exec_int_t *restrict right_column;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_less_than_equali(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
-#define BINOP_SNIPPET_TYPE int64_t
+#define BINOP_SNIPPET_TYPE sl_exec_int_t
   left_column = INT_REG_PTR(x->children_[0], 0);
   right_column = INT_REG_PTR(x->children_[1], 0);
   result_column = BOOL_REG_PTR_NRV(&x->base_regs_, 0);
@@ -8407,15 +8488,15 @@ void builtin_lessThanEqual_iv2iv2_runtime(struct sl_execution *exec, int exec_ch
 }
 
 void builtin_lessThanEqual_iv3iv3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
-  int64_t *restrict left_column;
-  int64_t *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_int_t *restrict left_column;
+  sl_exec_int_t *restrict right_column;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_less_than_equali(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
-#define BINOP_SNIPPET_TYPE int64_t
+#define BINOP_SNIPPET_TYPE sl_exec_int_t
   left_column = INT_REG_PTR(x->children_[0], 0);
   right_column = INT_REG_PTR(x->children_[1], 0);
   result_column = BOOL_REG_PTR_NRV(&x->base_regs_, 0);
@@ -8442,15 +8523,15 @@ void builtin_lessThanEqual_iv3iv3_runtime(struct sl_execution *exec, int exec_ch
 }
 
 void builtin_lessThanEqual_iv4iv4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
-  int64_t *restrict left_column;
-  int64_t *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_int_t *restrict left_column;
+  sl_exec_int_t *restrict right_column;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_less_than_equali(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
-#define BINOP_SNIPPET_TYPE int64_t 
+#define BINOP_SNIPPET_TYPE sl_exec_int_t 
   left_column = INT_REG_PTR(x->children_[0], 0);
   right_column = INT_REG_PTR(x->children_[1], 0);
   result_column = BOOL_REG_PTR_NRV(&x->base_regs_, 0);
@@ -8538,11 +8619,11 @@ void builtin_lessThanEqual_iv4iv4_eval(struct sl_type_base *tb, const struct sl_
 }
 
 void builtin_greaterThan_v2v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_greater_thanf(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
@@ -8566,11 +8647,11 @@ void builtin_greaterThan_v2v2_runtime(struct sl_execution *exec, int exec_chain,
 }
 
 void builtin_greaterThan_v3v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_greater_thanf(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
@@ -8601,11 +8682,11 @@ void builtin_greaterThan_v3v3_runtime(struct sl_execution *exec, int exec_chain,
 }
 
 void builtin_greaterThan_v4v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_greater_thanf(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
@@ -8697,15 +8778,15 @@ void builtin_greaterThan_v4v4_eval(struct sl_type_base *tb, const struct sl_expr
 }
 
 void builtin_greaterThan_iv2iv2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
-  int64_t *restrict left_column;
-  int64_t *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_int_t *restrict left_column;
+  sl_exec_int_t *restrict right_column;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_greater_thani(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
-#define BINOP_SNIPPET_TYPE int64_t
+#define BINOP_SNIPPET_TYPE sl_exec_int_t
   left_column = INT_REG_PTR(x->children_[0], 0);
   right_column = INT_REG_PTR(x->children_[1], 0);
   result_column = BOOL_REG_PTR_NRV(&x->base_regs_, 0);
@@ -8725,15 +8806,15 @@ void builtin_greaterThan_iv2iv2_runtime(struct sl_execution *exec, int exec_chai
 }
 
 void builtin_greaterThan_iv3iv3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
-  int64_t *restrict left_column;
-  int64_t *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_int_t *restrict left_column;
+  sl_exec_int_t *restrict right_column;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_greater_thani(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
-#define BINOP_SNIPPET_TYPE int64_t
+#define BINOP_SNIPPET_TYPE sl_exec_int_t
   left_column = INT_REG_PTR(x->children_[0], 0);
   right_column = INT_REG_PTR(x->children_[1], 0);
   result_column = BOOL_REG_PTR_NRV(&x->base_regs_, 0);
@@ -8760,15 +8841,15 @@ void builtin_greaterThan_iv3iv3_runtime(struct sl_execution *exec, int exec_chai
 }
 
 void builtin_greaterThan_iv4iv4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
-  int64_t *restrict left_column;
-  int64_t *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_int_t *restrict left_column;
+  sl_exec_int_t *restrict right_column;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_greater_thani(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
-#define BINOP_SNIPPET_TYPE int64_t 
+#define BINOP_SNIPPET_TYPE sl_exec_int_t 
   left_column = INT_REG_PTR(x->children_[0], 0);
   right_column = INT_REG_PTR(x->children_[1], 0);
   result_column = BOOL_REG_PTR_NRV(&x->base_regs_, 0);
@@ -8856,11 +8937,11 @@ void builtin_greaterThan_iv4iv4_eval(struct sl_type_base *tb, const struct sl_ex
 }
 
 void builtin_greaterThanEqual_v2v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_greater_than_equalf(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
@@ -8884,11 +8965,11 @@ void builtin_greaterThanEqual_v2v2_runtime(struct sl_execution *exec, int exec_c
 }
 
 void builtin_greaterThanEqual_v3v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_greater_than_equalf(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
@@ -8919,11 +9000,11 @@ void builtin_greaterThanEqual_v3v3_runtime(struct sl_execution *exec, int exec_c
 }
 
 void builtin_greaterThanEqual_v4v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_greater_than_equalf(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
@@ -9015,15 +9096,15 @@ void builtin_greaterThanEqual_v4v4_eval(struct sl_type_base *tb, const struct sl
 }
 
 void builtin_greaterThanEqual_iv2iv2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
-  int64_t *restrict left_column;
-  int64_t *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_int_t *restrict left_column;
+  sl_exec_int_t *restrict right_column;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_greater_than_equali(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
-#define BINOP_SNIPPET_TYPE int64_t
+#define BINOP_SNIPPET_TYPE sl_exec_int_t
   left_column = INT_REG_PTR(x->children_[0], 0);
   right_column = INT_REG_PTR(x->children_[1], 0);
   result_column = BOOL_REG_PTR_NRV(&x->base_regs_, 0);
@@ -9043,15 +9124,15 @@ void builtin_greaterThanEqual_iv2iv2_runtime(struct sl_execution *exec, int exec
 }
 
 void builtin_greaterThanEqual_iv3iv3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
-  int64_t *restrict left_column;
-  int64_t *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_int_t *restrict left_column;
+  sl_exec_int_t *restrict right_column;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_greater_than_equali(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
-#define BINOP_SNIPPET_TYPE int64_t
+#define BINOP_SNIPPET_TYPE sl_exec_int_t
   left_column = INT_REG_PTR(x->children_[0], 0);
   right_column = INT_REG_PTR(x->children_[1], 0);
   result_column = BOOL_REG_PTR_NRV(&x->base_regs_, 0);
@@ -9078,15 +9159,15 @@ void builtin_greaterThanEqual_iv3iv3_runtime(struct sl_execution *exec, int exec
 }
 
 void builtin_greaterThanEqual_iv4iv4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
-  int64_t *restrict left_column;
-  int64_t *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_int_t *restrict left_column;
+  sl_exec_int_t *restrict right_column;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_greater_than_equali(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
-#define BINOP_SNIPPET_TYPE int64_t 
+#define BINOP_SNIPPET_TYPE sl_exec_int_t 
   left_column = INT_REG_PTR(x->children_[0], 0);
   right_column = INT_REG_PTR(x->children_[1], 0);
   result_column = BOOL_REG_PTR_NRV(&x->base_regs_, 0);
@@ -9175,11 +9256,11 @@ void builtin_greaterThanEqual_iv4iv4_eval(struct sl_type_base *tb, const struct
 
 
 void builtin_equal_v2v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_equalf(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
@@ -9203,11 +9284,11 @@ void builtin_equal_v2v2_runtime(struct sl_execution *exec, int exec_chain, struc
 }
 
 void builtin_equal_v3v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_equalf(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
@@ -9238,11 +9319,11 @@ void builtin_equal_v3v3_runtime(struct sl_execution *exec, int exec_chain, struc
 }
 
 void builtin_equal_v4v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_equalf(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
@@ -9334,15 +9415,15 @@ void builtin_equal_v4v4_eval(struct sl_type_base *tb, const struct sl_expr *x, s
 }
 
 void builtin_equal_iv2iv2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
-  int64_t *restrict left_column;
-  int64_t *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_int_t *restrict left_column;
+  sl_exec_int_t *restrict right_column;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_equali(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
-#define BINOP_SNIPPET_TYPE int64_t
+#define BINOP_SNIPPET_TYPE sl_exec_int_t
   left_column = INT_REG_PTR(x->children_[0], 0);
   right_column = INT_REG_PTR(x->children_[1], 0);
   result_column = BOOL_REG_PTR_NRV(&x->base_regs_, 0);
@@ -9362,15 +9443,15 @@ void builtin_equal_iv2iv2_runtime(struct sl_execution *exec, int exec_chain, str
 }
 
 void builtin_equal_iv3iv3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
-  int64_t *restrict left_column;
-  int64_t *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_int_t *restrict left_column;
+  sl_exec_int_t *restrict right_column;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_equali(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
-#define BINOP_SNIPPET_TYPE int64_t
+#define BINOP_SNIPPET_TYPE sl_exec_int_t
   left_column = INT_REG_PTR(x->children_[0], 0);
   right_column = INT_REG_PTR(x->children_[1], 0);
   result_column = BOOL_REG_PTR_NRV(&x->base_regs_, 0);
@@ -9397,15 +9478,15 @@ void builtin_equal_iv3iv3_runtime(struct sl_execution *exec, int exec_chain, str
 }
 
 void builtin_equal_iv4iv4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
-  int64_t *restrict left_column;
-  int64_t *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_int_t *restrict left_column;
+  sl_exec_int_t *restrict right_column;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_equali(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
-#define BINOP_SNIPPET_TYPE int64_t 
+#define BINOP_SNIPPET_TYPE sl_exec_int_t 
   left_column = INT_REG_PTR(x->children_[0], 0);
   right_column = INT_REG_PTR(x->children_[1], 0);
   result_column = BOOL_REG_PTR_NRV(&x->base_regs_, 0);
@@ -9493,11 +9574,11 @@ void builtin_equal_iv4iv4_eval(struct sl_type_base *tb, const struct sl_expr *x,
 }
 
 void builtin_equal_bv2bv2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
   uint8_t *restrict left_column;
   uint8_t *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_equalb(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
@@ -9521,11 +9602,11 @@ void builtin_equal_bv2bv2_runtime(struct sl_execution *exec, int exec_chain, str
 }
 
 void builtin_equal_bv3bv3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
   uint8_t *restrict left_column;
   uint8_t *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_equalb(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
@@ -9556,11 +9637,11 @@ void builtin_equal_bv3bv3_runtime(struct sl_execution *exec, int exec_chain, str
 }
 
 void builtin_equal_bv4bv4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
   uint8_t *restrict left_column;
   uint8_t *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_equalb(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
@@ -9652,11 +9733,11 @@ void builtin_equal_bv4bv4_eval(struct sl_type_base *tb, const struct sl_expr *x,
 }
 
 void builtin_notEqual_v2v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_not_equalf(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
@@ -9680,11 +9761,11 @@ void builtin_notEqual_v2v2_runtime(struct sl_execution *exec, int exec_chain, st
 }
 
 void builtin_notEqual_v3v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_not_equalf(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
@@ -9715,11 +9796,11 @@ void builtin_notEqual_v3v3_runtime(struct sl_execution *exec, int exec_chain, st
 }
 
 void builtin_notEqual_v4v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
   float *restrict left_column;
   float *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_not_equalf(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
@@ -9811,15 +9892,15 @@ void builtin_notEqual_v4v4_eval(struct sl_type_base *tb, const struct sl_expr *x
 }
 
 void builtin_notEqual_iv2iv2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
-  int64_t *restrict left_column;
-  int64_t *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_int_t *restrict left_column;
+  sl_exec_int_t *restrict right_column;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_not_equali(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
-#define BINOP_SNIPPET_TYPE int64_t
+#define BINOP_SNIPPET_TYPE sl_exec_int_t
   left_column = INT_REG_PTR(x->children_[0], 0);
   right_column = INT_REG_PTR(x->children_[1], 0);
   result_column = BOOL_REG_PTR_NRV(&x->base_regs_, 0);
@@ -9839,15 +9920,15 @@ void builtin_notEqual_iv2iv2_runtime(struct sl_execution *exec, int exec_chain,
 }
 
 void builtin_notEqual_iv3iv3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
-  int64_t *restrict left_column;
-  int64_t *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_int_t *restrict left_column;
+  sl_exec_int_t *restrict right_column;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_not_equali(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
-#define BINOP_SNIPPET_TYPE int64_t
+#define BINOP_SNIPPET_TYPE sl_exec_int_t
   left_column = INT_REG_PTR(x->children_[0], 0);
   right_column = INT_REG_PTR(x->children_[1], 0);
   result_column = BOOL_REG_PTR_NRV(&x->base_regs_, 0);
@@ -9874,15 +9955,15 @@ void builtin_notEqual_iv3iv3_runtime(struct sl_execution *exec, int exec_chain,
 }
 
 void builtin_notEqual_iv4iv4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
-  int64_t *restrict left_column;
-  int64_t *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_int_t *restrict left_column;
+  sl_exec_int_t *restrict right_column;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_not_equali(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
-#define BINOP_SNIPPET_TYPE int64_t 
+#define BINOP_SNIPPET_TYPE sl_exec_int_t 
   left_column = INT_REG_PTR(x->children_[0], 0);
   right_column = INT_REG_PTR(x->children_[1], 0);
   result_column = BOOL_REG_PTR_NRV(&x->base_regs_, 0);
@@ -9970,11 +10051,11 @@ void builtin_notEqual_iv4iv4_eval(struct sl_type_base *tb, const struct sl_expr
 }
 
 void builtin_notEqual_bv2bv2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
   uint8_t *restrict left_column;
   uint8_t *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_not_equalb(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
@@ -9998,11 +10079,11 @@ void builtin_notEqual_bv2bv2_runtime(struct sl_execution *exec, int exec_chain,
 }
 
 void builtin_notEqual_bv3bv3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
   uint8_t *restrict left_column;
   uint8_t *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_not_equalb(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
@@ -10033,11 +10114,11 @@ void builtin_notEqual_bv3bv3_runtime(struct sl_execution *exec, int exec_chain,
 }
 
 void builtin_notEqual_bv4bv4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column;
   uint8_t *restrict left_column;
   uint8_t *restrict right_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) aex_not_equalb(x, y)
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
@@ -10129,11 +10210,11 @@ void builtin_notEqual_bv4bv4_eval(struct sl_type_base *tb, const struct sl_expr
 }
 
 void builtin_any_bv2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column = BOOL_REG_PTR_NRV(&x->base_regs_, 0);
   uint8_t *restrict left_column = BOOL_REG_PTR(x->children_[0], 0);
   uint8_t *restrict right_column = BOOL_REG_PTR(x->children_[0], 1);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) ((x) || (y))
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
@@ -10147,12 +10228,12 @@ void builtin_any_bv2_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_any_bv3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column = BOOL_REG_PTR_NRV(&x->base_regs_, 0);
   uint8_t *restrict first_column = BOOL_REG_PTR(x->children_[0], 0);
   uint8_t *restrict second_column = BOOL_REG_PTR(x->children_[0], 1);
   uint8_t *restrict third_column = BOOL_REG_PTR(x->children_[0], 2);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define TERNOP_SNIPPET_OPERATOR(a, b, c) ((a) || (b) || (c))
 #define TERNOP_SNIPPET_TYPE uint8_t
@@ -10162,13 +10243,13 @@ void builtin_any_bv3_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_any_bv4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column = BOOL_REG_PTR_NRV(&x->base_regs_, 0);
   uint8_t *restrict first_column = BOOL_REG_PTR(x->children_[0], 0);
   uint8_t *restrict second_column = BOOL_REG_PTR(x->children_[0], 1);
   uint8_t *restrict third_column = BOOL_REG_PTR(x->children_[0], 2);
   uint8_t *restrict fourth_column = BOOL_REG_PTR(x->children_[0], 3);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define QUADOP_SNIPPET_OPERATOR(a, b, c, d) ((a) || (b) || (c) || (d))
 #define QUADOP_SNIPPET_TYPE uint8_t
@@ -10208,11 +10289,11 @@ void builtin_any_bv4_eval(struct sl_type_base *tb, const struct sl_expr *x, stru
 }
 
 void builtin_all_bv2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column = BOOL_REG_PTR_NRV(&x->base_regs_, 0);
   uint8_t *restrict left_column = BOOL_REG_PTR(x->children_[0], 0);
   uint8_t *restrict right_column = BOOL_REG_PTR(x->children_[0], 1);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define BINOP_SNIPPET_OPERATOR(x, y) ((x) && (y))
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
@@ -10226,12 +10307,12 @@ void builtin_all_bv2_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_all_bv3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column = BOOL_REG_PTR_NRV(&x->base_regs_, 0);
   uint8_t *restrict first_column = BOOL_REG_PTR(x->children_[0], 0);
   uint8_t *restrict second_column = BOOL_REG_PTR(x->children_[0], 1);
   uint8_t *restrict third_column = BOOL_REG_PTR(x->children_[0], 2);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define TERNOP_SNIPPET_OPERATOR(a, b, c) ((a) && (b) && (c))
 #define TERNOP_SNIPPET_TYPE uint8_t
@@ -10241,13 +10322,13 @@ void builtin_all_bv3_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_all_bv4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint8_t *restrict result_column = BOOL_REG_PTR_NRV(&x->base_regs_, 0);
   uint8_t *restrict first_column = BOOL_REG_PTR(x->children_[0], 0);
   uint8_t *restrict second_column = BOOL_REG_PTR(x->children_[0], 1);
   uint8_t *restrict third_column = BOOL_REG_PTR(x->children_[0], 2);
   uint8_t *restrict fourth_column = BOOL_REG_PTR(x->children_[0], 3);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define QUADOP_SNIPPET_OPERATOR(a, b, c, d) ((a) && (b) && (c) && (d))
 #define QUADOP_SNIPPET_TYPE uint8_t
@@ -10288,10 +10369,10 @@ void builtin_all_bv4_eval(struct sl_type_base *tb, const struct sl_expr *x, stru
 
 
 void builtin_not_bv2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict result_column;
   uint8_t * restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) (uint8_t)(0x100 - !(opd))
 #define UNOP_SNIPPET_TYPE uint8_t 
@@ -10310,10 +10391,10 @@ void builtin_not_bv2_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_not_bv3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict result_column;
   uint8_t * restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) (uint8_t)(0x100 - !(opd))
 #define UNOP_SNIPPET_TYPE uint8_t 
@@ -10337,10 +10418,10 @@ void builtin_not_bv3_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_not_bv4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict result_column;
   uint8_t * restrict opd_column;
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
 #define UNOP_SNIPPET_OPERATOR(opd) (uint8_t)(0x100 - !(opd))
 #define UNOP_SNIPPET_TYPE uint8_t 
@@ -10400,16 +10481,15 @@ void builtin_not_bv4_eval(struct sl_type_base *tb, const struct sl_expr *x, stru
 }
 
 void builtin_dFdx_f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict opd_column = FLOAT_REG_PTR(x->children_[0], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
+    sl_exec_row_t delta;
 
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict result = result_column + row;
         const float *restrict opd = opd_column + row;
@@ -10427,12 +10507,12 @@ void builtin_dFdx_f_runtime(struct sl_execution *exec, int exec_chain, struct sl
           result[n + 1] = dFdx;
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict result = result_column + row;
         const float *restrict opd = opd_column + row;
@@ -10445,10 +10525,10 @@ void builtin_dFdx_f_runtime(struct sl_execution *exec, int exec_chain, struct sl
           result[n] = dFdx;
           result[n + 1] = dFdx;
         }
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -10471,18 +10551,17 @@ void builtin_dFdx_f_runtime(struct sl_execution *exec, int exec_chain, struct sl
 }
 
 void builtin_dFdx_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result0_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict result1_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict opd0_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict opd1_column = FLOAT_REG_PTR(x->children_[0], 1);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
+    sl_exec_row_t delta;
 
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict result0 = result0_column + row;
         float *restrict result1 = result1_column + row;
@@ -10508,12 +10587,12 @@ void builtin_dFdx_v2_runtime(struct sl_execution *exec, int exec_chain, struct s
           result1[n + 1] = dFdx_1;
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict result0 = result0_column + row;
         float *restrict result1 = result1_column + row;
@@ -10534,10 +10613,10 @@ void builtin_dFdx_v2_runtime(struct sl_execution *exec, int exec_chain, struct s
           result1[n] = dFdx_1;
           result1[n + 1] = dFdx_1;
         }
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -10565,20 +10644,19 @@ void builtin_dFdx_v2_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_dFdx_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result0_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict result1_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict result2_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 2);
   float *restrict opd0_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict opd1_column = FLOAT_REG_PTR(x->children_[0], 1);
   float *restrict opd2_column = FLOAT_REG_PTR(x->children_[0], 2);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
+    sl_exec_row_t delta;
 
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict result0 = result0_column + row;
         float *restrict result1 = result1_column + row;
@@ -10612,12 +10690,12 @@ void builtin_dFdx_v3_runtime(struct sl_execution *exec, int exec_chain, struct s
           result2[n + 1] = dFdx_2;
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict result0 = result0_column + row;
         float *restrict result1 = result1_column + row;
@@ -10646,10 +10724,10 @@ void builtin_dFdx_v3_runtime(struct sl_execution *exec, int exec_chain, struct s
           result2[n] = dFdx_2;
           result2[n + 1] = dFdx_2;
         }
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -10682,7 +10760,7 @@ void builtin_dFdx_v3_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_dFdx_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result0_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict result1_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict result2_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 2);
@@ -10691,13 +10769,12 @@ void builtin_dFdx_v4_runtime(struct sl_execution *exec, int exec_chain, struct s
   float *restrict opd1_column = FLOAT_REG_PTR(x->children_[0], 1);
   float *restrict opd2_column = FLOAT_REG_PTR(x->children_[0], 2);
   float *restrict opd3_column = FLOAT_REG_PTR(x->children_[0], 3);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
+    sl_exec_row_t delta;
 
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict result0 = result0_column + row;
         float *restrict result1 = result1_column + row;
@@ -10733,12 +10810,12 @@ void builtin_dFdx_v4_runtime(struct sl_execution *exec, int exec_chain, struct s
           result2[n + 1] = dFdx_2;
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict result0 = result0_column + row;
         float *restrict result1 = result1_column + row;
@@ -10775,10 +10852,10 @@ void builtin_dFdx_v4_runtime(struct sl_execution *exec, int exec_chain, struct s
           result3[n] = dFdx_3;
           result3[n + 1] = dFdx_3;
         }
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -10816,16 +10893,15 @@ void builtin_dFdx_v4_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_dFdy_f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict opd_column = FLOAT_REG_PTR(x->children_[0], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
+    sl_exec_row_t delta;
 
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict result = result_column + row;
         const float *restrict opd = opd_column + row;
@@ -10845,12 +10921,12 @@ void builtin_dFdy_f_runtime(struct sl_execution *exec, int exec_chain, struct sl
           }
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict result = result_column + row;
         const float *restrict opd = opd_column + row;
@@ -10864,10 +10940,10 @@ void builtin_dFdy_f_runtime(struct sl_execution *exec, int exec_chain, struct sl
           result[k + 2] = dFdy;
         }
 
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -10890,18 +10966,17 @@ void builtin_dFdy_f_runtime(struct sl_execution *exec, int exec_chain, struct sl
 }
 
 void builtin_dFdy_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result0_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict result1_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict opd0_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict opd1_column = FLOAT_REG_PTR(x->children_[0], 1);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
+    sl_exec_row_t delta;
 
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict result0 = result0_column + row;
         float *restrict result1 = result1_column + row;
@@ -10929,12 +11004,12 @@ void builtin_dFdy_v2_runtime(struct sl_execution *exec, int exec_chain, struct s
           }
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict result0 = result0_column + row;
         float *restrict result1 = result1_column + row;
@@ -10956,10 +11031,10 @@ void builtin_dFdy_v2_runtime(struct sl_execution *exec, int exec_chain, struct s
           result1[k + 2] = dFdy_1;
         }
 
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -10987,20 +11062,19 @@ void builtin_dFdy_v2_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_dFdy_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result0_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict result1_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict result2_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 2);
   float *restrict opd0_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict opd1_column = FLOAT_REG_PTR(x->children_[0], 1);
   float *restrict opd2_column = FLOAT_REG_PTR(x->children_[0], 2);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
+    sl_exec_row_t delta;
 
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict result0 = result0_column + row;
         float *restrict result1 = result1_column + row;
@@ -11036,12 +11110,12 @@ void builtin_dFdy_v3_runtime(struct sl_execution *exec, int exec_chain, struct s
           }
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict result0 = result0_column + row;
         float *restrict result1 = result1_column + row;
@@ -11071,10 +11145,10 @@ void builtin_dFdy_v3_runtime(struct sl_execution *exec, int exec_chain, struct s
           result2[k + 2] = dFdy_2;
         }
 
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -11107,7 +11181,7 @@ void builtin_dFdy_v3_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_dFdy_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result0_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict result1_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict result2_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 2);
@@ -11116,13 +11190,12 @@ void builtin_dFdy_v4_runtime(struct sl_execution *exec, int exec_chain, struct s
   float *restrict opd1_column = FLOAT_REG_PTR(x->children_[0], 1);
   float *restrict opd2_column = FLOAT_REG_PTR(x->children_[0], 2);
   float *restrict opd3_column = FLOAT_REG_PTR(x->children_[0], 3);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
+    sl_exec_row_t delta;
 
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict result0 = result0_column + row;
         float *restrict result1 = result1_column + row;
@@ -11166,12 +11239,12 @@ void builtin_dFdy_v4_runtime(struct sl_execution *exec, int exec_chain, struct s
           }
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict result0 = result0_column + row;
         float *restrict result1 = result1_column + row;
@@ -11209,10 +11282,10 @@ void builtin_dFdy_v4_runtime(struct sl_execution *exec, int exec_chain, struct s
           result3[k + 2] = dFdy_3;
         }
 
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -11250,16 +11323,15 @@ void builtin_dFdy_v4_runtime(struct sl_execution *exec, int exec_chain, struct s
 }
 
 void builtin_fwidth_f_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict opd_column = FLOAT_REG_PTR(x->children_[0], 0);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
+    sl_exec_row_t delta;
 
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict result = result_column + row;
         const float *restrict opd = opd_column + row;
@@ -11280,12 +11352,12 @@ void builtin_fwidth_f_runtime(struct sl_execution *exec, int exec_chain, struct
           result[n] = fabsf(dFdx) + fabsf(dFdy);
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict result = result_column + row;
         const float *restrict opd = opd_column + row;
@@ -11302,10 +11374,10 @@ void builtin_fwidth_f_runtime(struct sl_execution *exec, int exec_chain, struct
           result[n] = fabsf(dFdx) + fabsf(dFdy);
         }
 
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -11331,18 +11403,17 @@ void builtin_fwidth_f_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_fwidth_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result0_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict result1_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict opd0_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict opd1_column = FLOAT_REG_PTR(x->children_[0], 1);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
+    sl_exec_row_t delta;
 
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict result0 = result0_column + row;
         float *restrict result1 = result1_column + row;
@@ -11374,12 +11445,12 @@ void builtin_fwidth_v2_runtime(struct sl_execution *exec, int exec_chain, struct
           result1[n] = fabsf(dFdx_1) + fabsf(dFdy_1);
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict result0 = result0_column + row;
         float *restrict result1 = result1_column + row;
@@ -11407,10 +11478,10 @@ void builtin_fwidth_v2_runtime(struct sl_execution *exec, int exec_chain, struct
           result1[n] = fabsf(dFdx_1) + fabsf(dFdy_1);
         }
 
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -11444,20 +11515,19 @@ void builtin_fwidth_v2_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_fwidth_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result0_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict result1_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict result2_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 2);
   float *restrict opd0_column = FLOAT_REG_PTR(x->children_[0], 0);
   float *restrict opd1_column = FLOAT_REG_PTR(x->children_[0], 1);
   float *restrict opd2_column = FLOAT_REG_PTR(x->children_[0], 2);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
+    sl_exec_row_t delta;
 
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict result0 = result0_column + row;
         float *restrict result1 = result1_column + row;
@@ -11500,12 +11570,12 @@ void builtin_fwidth_v3_runtime(struct sl_execution *exec, int exec_chain, struct
           result2[n] = fabsf(dFdx_2) + fabsf(dFdy_2);
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict result0 = result0_column + row;
         float *restrict result1 = result1_column + row;
@@ -11544,10 +11614,10 @@ void builtin_fwidth_v3_runtime(struct sl_execution *exec, int exec_chain, struct
           result2[n] = fabsf(dFdx_2) + fabsf(dFdy_2);
         }
 
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -11589,7 +11659,7 @@ void builtin_fwidth_v3_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_fwidth_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict result0_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict result1_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict result2_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 2);
@@ -11598,13 +11668,12 @@ void builtin_fwidth_v4_runtime(struct sl_execution *exec, int exec_chain, struct
   float *restrict opd1_column = FLOAT_REG_PTR(x->children_[0], 1);
   float *restrict opd2_column = FLOAT_REG_PTR(x->children_[0], 2);
   float *restrict opd3_column = FLOAT_REG_PTR(x->children_[0], 3);
-  uint8_t row = exec_chain;
+  sl_exec_row_t row = exec_chain;
 
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
+    sl_exec_row_t delta;
 
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict result0 = result0_column + row;
         float *restrict result1 = result1_column + row;
@@ -11658,12 +11727,12 @@ void builtin_fwidth_v4_runtime(struct sl_execution *exec, int exec_chain, struct
           result3[n] = fabsf(dFdx_3) + fabsf(dFdy_3);
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict result0 = result0_column + row;
         float *restrict result1 = result1_column + row;
@@ -11713,10 +11782,10 @@ void builtin_fwidth_v4_runtime(struct sl_execution *exec, int exec_chain, struct
           result3[n] = fabsf(dFdx_3) + fabsf(dFdy_3);
         }
 
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
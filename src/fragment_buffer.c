@@ -35,6 +35,7 @@
 
 void fragment_buffer_init(struct fragment_buffer *fb) {
   fb->num_rows_ = 0;
+  fb->max_num_rows_ = FRAGMENT_BUFFER_MAX_ROWS;
   fb->num_cols_ = 0;
   fb->column_descriptions_ = NULL;
   fb->column_data_ = NULL;
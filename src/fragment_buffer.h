@@ -16,6 +16,11 @@
 #ifndef FRAGMENT_BUFFER_H
 #define FRAGMENT_BUFFER_H
 
+#ifndef SL_EXECUTION_H_INCLUDED
+#define SL_EXECUTION_H_INCLUDED
+#include "sl_execution.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -23,8 +28,9 @@ extern "C" {
 /* Number of rows in the fragment buffer.
  * Best keep this a multiple of 16 as small FBCT_UINT8 datatypes then don't
  * cause misalignment issues (there is no sophistication in the layout of the
- * initial buffers.) */
-#define FRAGMENT_BUFFER_MAX_ROWS 256
+ * initial buffers.) The fragment shader runs over all rows in one go, so this
+ * follows the execution batch width. */
+#define FRAGMENT_BUFFER_MAX_ROWS SL_EXEC_CHAIN_MAX_NUM_ROWS
 
 typedef enum fragment_buffer_data_type {
   FBDT_NONE,
@@ -109,9 +115,13 @@ struct fragment_buffer_column_descriptor {
 };
 
 struct fragment_buffer {
-  /* Number of rows, maximum is FRAGMENT_BUFFER_MAX_ROWS */
+  /* Number of rows, maximum is max_num_rows_ */
   size_t num_rows_;
 
+  /* Number of rows the fragment buffer is flushed at; this is the number of rows the fragment shader
+   * has its registers allocated for, at most FRAGMENT_BUFFER_MAX_ROWS. */
+  size_t max_num_rows_;
+
   size_t num_cols_;
   
   /* Orientation of the fragments in the fragment buffer.
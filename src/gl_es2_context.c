@@ -42,6 +42,11 @@
 #include "sl_defs.h"
 #endif
 
+#ifndef SL_SIMD_H_INCLUDED
+#define SL_SIMD_H_INCLUDED
+#include "sl_simd.h"
+#endif
+
 void gl_es2_framebuffer_attachment_init(struct gl_es2_framebuffer *fb, struct gl_es2_framebuffer_attachment *fa) {
   fa->kind_ = gl_es2_faot_none;
   fa->v_.rb_ = NULL;
@@ -589,6 +594,9 @@ void gl_es2_shader_cleanup(struct gl_es2_shader *shad) {
 
 
 void gl_es2_ctx_init(struct gl_es2_context *c) {
+  /* Picks the SIMD kernels for the host, once for the process */
+  sl_simd_init();
+
   thread_mutex_init(&c->lock_);
   c->is_egl_context_ = 0; /* EGL will override this if we're called from there */
   c->is_detailed_debug_frame_ = 0; /* Set to true by EGL */
@@ -636,6 +644,8 @@ void gl_es2_ctx_init(struct gl_es2_context *c) {
     c->sampler_2D_uniform_loading_table_[n] = NULL;
     c->sampler_Cube_uniform_loading_table_[n] = NULL;
   }
+  c->texture_bindings_version_ = 1;
+  c->sampler_uniform_loading_tables_version_ = 0;
 
   c->array_buffer_ = NULL;
   c->element_array_buffer_ = NULL;
@@ -801,6 +811,23 @@ int gl_es2_ctx_complete_initialization(struct gl_es2_context *c) {
   return r;
 }
 
+void gl_es2_ctx_prepare_program_for_execution(struct gl_es2_context *c, struct gl_es2_program *prog) {
+  size_t n;
+  if (c->sampler_uniform_loading_tables_version_ != c->texture_bindings_version_) {
+    for (n = 0; n < GL_ES2_IMPL_MAX_NUM_TEXTURE_UNITS; ++n) {
+      c->sampler_2D_uniform_loading_table_[n] = &c->active_texture_units_[n].texture_2d_->texture_2d_;
+      c->sampler_Cube_uniform_loading_table_[n] = c->active_texture_units_[n].texture_cube_map_->texture_cube_maps_;
+    }
+    c->sampler_uniform_loading_tables_version_ = c->texture_bindings_version_;
+  }
+  /* Only loads the uniforms changed since this program last ran */
+  sl_program_load_uniforms_for_execution(&prog->program_, GL_ES2_IMPL_MAX_NUM_TEXTURE_UNITS,
+                                         c->sampler_2D_uniform_loading_table_, c->sampler_Cube_uniform_loading_table_,
+                                         c->sampler_uniform_loading_tables_version_);
+  /* Run the code specialized on the uniforms now loaded, if any */
+  sl_program_select_variants(&prog->program_);
+}
+
 void gl_es2_ctx_get_normalized_scissor_rect(struct gl_es2_context *c, uint32_t *left, uint32_t *top, uint32_t *right, uint32_t *bottom) {
   /* Normalize scissor rect from "bottom-left positive-y is up" coordinate system to
    * "top-left positive-y is down" coordinate system that rasterizer expects.
@@ -333,6 +333,12 @@ struct gl_es2_context {
   void *sampler_2D_uniform_loading_table_[GL_ES2_IMPL_MAX_NUM_TEXTURE_UNITS];
   void *sampler_Cube_uniform_loading_table_[GL_ES2_IMPL_MAX_NUM_TEXTURE_UNITS];
 
+  /* Incremented whenever the texture bound to any of the texture units changes; the loading tables above
+   * are rebuilt (and the programs' sampler uniforms reloaded) upon the next draw when it differs from
+   * sampler_uniform_loading_tables_version_. */
+  uint64_t texture_bindings_version_;
+  uint64_t sampler_uniform_loading_tables_version_;
+
   /* glBindBuffer(GL_ARRAY_BUFFER); NULL means use client memory */
   struct gl_es2_buffer *array_buffer_;
 
@@ -491,6 +497,10 @@ struct gl_es2_context *gl_es2_ctx_dont_lock(void);
 /* Release the gl_es2_context::lock_ lock (typically as acquired inside gl_es2_ctx()). */
 void gl_es2_ctx_release(struct gl_es2_context *c);
 
+/* Loads the uniforms of prog changed since it last ran, with its samplers bound to the current texture units, into
+ * its shaders and selects the variant of their code specialized on them, if any; called before each draw. */
+void gl_es2_ctx_prepare_program_for_execution(struct gl_es2_context *c, struct gl_es2_program *prog);
+
 void gl_es2_ctx_get_normalized_scissor_rect(struct gl_es2_context *c, uint32_t *left, uint32_t *top, uint32_t *right, uint32_t *bottom);
 
 void gl_es2_framebuffer_attachment_init(struct gl_es2_framebuffer *fb, struct gl_es2_framebuffer_attachment *fa);
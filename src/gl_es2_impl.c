@@ -593,7 +593,10 @@ GL_ES2_DECL_SPEC void GL_ES2_DECLARATOR_ATTRIB GL_ES2_FUNCTION_ID(BindTexture)(g
         gl_es2_ctx_release(c);
         return;
       }
-      c->active_texture_units_[c->current_active_texture_unit_].texture_2d_ = tex;
+      if (c->active_texture_units_[c->current_active_texture_unit_].texture_2d_ != tex) {
+        c->active_texture_units_[c->current_active_texture_unit_].texture_2d_ = tex;
+        c->texture_bindings_version_++;
+      }
       break;
     case GL_ES2_TEXTURE_CUBE_MAP:
       if (tex->kind_ != gl_es2_texture_cube_map) {
@@ -602,7 +605,10 @@ GL_ES2_DECL_SPEC void GL_ES2_DECLARATOR_ATTRIB GL_ES2_FUNCTION_ID(BindTexture)(g
         gl_es2_ctx_release(c);
         return;
       }
-      c->active_texture_units_[c->current_active_texture_unit_].texture_cube_map_ = tex;
+      if (c->active_texture_units_[c->current_active_texture_unit_].texture_cube_map_ != tex) {
+        c->active_texture_units_[c->current_active_texture_unit_].texture_cube_map_ = tex;
+        c->texture_bindings_version_++;
+      }
       break;
     default:
       /* other cases already ruled out (see check at entry) */
@@ -2299,9 +2305,11 @@ GL_ES2_DECL_SPEC void GL_ES2_DECLARATOR_ATTRIB GL_ES2_FUNCTION_ID(DeleteTextures
           for (m = 0; m < c->num_active_texture_units_; ++m) {
             if (c->active_texture_units_[m].texture_2d_ == tex) {
               c->active_texture_units_[m].texture_2d_ = default_tex;
+              c->texture_bindings_version_++;
             }
             else if (c->active_texture_units_[m].texture_cube_map_ == tex) {
               c->active_texture_units_[m].texture_cube_map_ = default_tex;
+              c->texture_bindings_version_++;
             }
           }
           not_remove(&c->texture_not_, &tex->no_);
@@ -2626,12 +2634,7 @@ static void perform_draw(primitive_assembly_mode_t mode,
     dst_alpha_fn = BF_ZERO;
   }
 
-  size_t n;
-  for (n = 0; n < GL_ES2_IMPL_MAX_NUM_TEXTURE_UNITS; ++n) {
-    c->sampler_2D_uniform_loading_table_[n] = &c->active_texture_units_[n].texture_2d_->texture_2d_;
-    c->sampler_Cube_uniform_loading_table_[n] = c->active_texture_units_[n].texture_cube_map_->texture_cube_maps_;
-  }
-  sl_program_load_uniforms_for_execution(prog, GL_ES2_IMPL_MAX_NUM_TEXTURE_UNITS, c->sampler_2D_uniform_loading_table_, c->sampler_Cube_uniform_loading_table_);
+  gl_es2_ctx_prepare_program_for_execution(c, c->current_program_);
 
   primitive_assembly_draw_elements(&prog->pa_, &c->attribs_, prog->vertex_shader_, &prog->ar_, &prog->cs_, &c->ras_, 
                                    &prog->fragbuf_, prog->fragment_shader_,
@@ -6827,7 +6830,7 @@ GL_ES2_DECL_SPEC void GL_ES2_DECLARATOR_ATTRIB GL_ES2_FUNCTION_ID(Uniform1f)(gl_
   int r;
   void *mem = NULL;
   sl_reg_alloc_kind_t slrak = slrak_void;
-  r = sl_uniform_get_location_info(&prog->program_.uniforms_, location, &mem, &slrak, NULL, NULL, NULL, NULL);
+  r = sl_uniform_get_location_info_for_update(&prog->program_.uniforms_, location, &mem, &slrak, NULL, NULL);
   if (r != SL_ERR_OK) {
     if (r == SL_ERR_NO_MEM) {
       set_gl_err(GL_ES2_OUT_OF_MEMORY);
@@ -6890,7 +6893,7 @@ GL_ES2_DECL_SPEC void GL_ES2_DECLARATOR_ATTRIB GL_ES2_FUNCTION_ID(Uniform1fv)(gl
   void *mem = NULL;
   sl_reg_alloc_kind_t slrak = slrak_void;
   size_t final_array_size = 0, entry_in_final_array = 0;
-  r = sl_uniform_get_location_info(&prog->program_.uniforms_, location, &mem, &slrak, NULL, NULL, &final_array_size, &entry_in_final_array);
+  r = sl_uniform_get_location_info_for_update(&prog->program_.uniforms_, location, &mem, &slrak, &final_array_size, &entry_in_final_array);
   size_t entries_remaining = final_array_size - entry_in_final_array;
   size_t num_entries = (size_t)count;
   size_t n;
@@ -6974,7 +6977,7 @@ GL_ES2_DECL_SPEC void GL_ES2_DECLARATOR_ATTRIB GL_ES2_FUNCTION_ID(Uniform1i)(gl_
   int r;
   void *mem = NULL;
   sl_reg_alloc_kind_t slrak = slrak_void;
-  r = sl_uniform_get_location_info(&prog->program_.uniforms_, location, &mem, &slrak, NULL, NULL, NULL, NULL);
+  r = sl_uniform_get_location_info_for_update(&prog->program_.uniforms_, location, &mem, &slrak, NULL, NULL);
   if (r != SL_ERR_OK) {
     if (r == SL_ERR_NO_MEM) {
       set_gl_err(GL_ES2_OUT_OF_MEMORY);
@@ -7039,7 +7042,7 @@ GL_ES2_DECL_SPEC void GL_ES2_DECLARATOR_ATTRIB GL_ES2_FUNCTION_ID(Uniform1iv)(gl
   void *mem = NULL;
   sl_reg_alloc_kind_t slrak = slrak_void;
   size_t final_array_size = 0, entry_in_final_array = 0;
-  r = sl_uniform_get_location_info(&prog->program_.uniforms_, location, &mem, &slrak, NULL, NULL, &final_array_size, &entry_in_final_array);
+  r = sl_uniform_get_location_info_for_update(&prog->program_.uniforms_, location, &mem, &slrak, &final_array_size, &entry_in_final_array);
   size_t entries_remaining = final_array_size - entry_in_final_array;
   size_t num_entries = (size_t)count;
   size_t n;
@@ -7134,7 +7137,7 @@ GL_ES2_DECL_SPEC void GL_ES2_DECLARATOR_ATTRIB GL_ES2_FUNCTION_ID(Uniform2f)(gl_
   int r;
   void *mem = NULL;
   sl_reg_alloc_kind_t slrak = slrak_void;
-  r = sl_uniform_get_location_info(&prog->program_.uniforms_, location, &mem, &slrak, NULL, NULL, NULL, NULL);
+  r = sl_uniform_get_location_info_for_update(&prog->program_.uniforms_, location, &mem, &slrak, NULL, NULL);
   if (r != SL_ERR_OK) {
     if (r == SL_ERR_NO_MEM) {
       set_gl_err(GL_ES2_OUT_OF_MEMORY);
@@ -7203,7 +7206,7 @@ GL_ES2_DECL_SPEC void GL_ES2_DECLARATOR_ATTRIB GL_ES2_FUNCTION_ID(Uniform2fv)(gl
   void *mem = NULL;
   sl_reg_alloc_kind_t slrak = slrak_void;
   size_t final_array_size = 0, entry_in_final_array = 0;
-  r = sl_uniform_get_location_info(&prog->program_.uniforms_, location, &mem, &slrak, NULL, NULL, &final_array_size, &entry_in_final_array);
+  r = sl_uniform_get_location_info_for_update(&prog->program_.uniforms_, location, &mem, &slrak, &final_array_size, &entry_in_final_array);
   size_t entries_remaining = final_array_size - entry_in_final_array;
   size_t num_entries = (size_t)count;
   size_t n;
@@ -7289,7 +7292,7 @@ GL_ES2_DECL_SPEC void GL_ES2_DECLARATOR_ATTRIB GL_ES2_FUNCTION_ID(Uniform2i)(gl_
   int r;
   void *mem = NULL;
   sl_reg_alloc_kind_t slrak = slrak_void;
-  r = sl_uniform_get_location_info(&prog->program_.uniforms_, location, &mem, &slrak, NULL, NULL, NULL, NULL);
+  r = sl_uniform_get_location_info_for_update(&prog->program_.uniforms_, location, &mem, &slrak, NULL, NULL);
   if (r != SL_ERR_OK) {
     if (r == SL_ERR_NO_MEM) {
       set_gl_err(GL_ES2_OUT_OF_MEMORY);
@@ -7358,7 +7361,7 @@ GL_ES2_DECL_SPEC void GL_ES2_DECLARATOR_ATTRIB GL_ES2_FUNCTION_ID(Uniform2iv)(gl
   void *mem = NULL;
   sl_reg_alloc_kind_t slrak = slrak_void;
   size_t final_array_size = 0, entry_in_final_array = 0;
-  r = sl_uniform_get_location_info(&prog->program_.uniforms_, location, &mem, &slrak, NULL, NULL, &final_array_size, &entry_in_final_array);
+  r = sl_uniform_get_location_info_for_update(&prog->program_.uniforms_, location, &mem, &slrak, &final_array_size, &entry_in_final_array);
   size_t entries_remaining = final_array_size - entry_in_final_array;
   size_t num_entries = (size_t)count;
   size_t n;
@@ -7444,7 +7447,7 @@ GL_ES2_DECL_SPEC void GL_ES2_DECLARATOR_ATTRIB GL_ES2_FUNCTION_ID(Uniform3f)(gl_
   int r;
   void *mem = NULL;
   sl_reg_alloc_kind_t slrak = slrak_void;
-  r = sl_uniform_get_location_info(&prog->program_.uniforms_, location, &mem, &slrak, NULL, NULL, NULL, NULL);
+  r = sl_uniform_get_location_info_for_update(&prog->program_.uniforms_, location, &mem, &slrak, NULL, NULL);
   if (r != SL_ERR_OK) {
     if (r == SL_ERR_NO_MEM) {
       set_gl_err(GL_ES2_OUT_OF_MEMORY);
@@ -7515,7 +7518,7 @@ GL_ES2_DECL_SPEC void GL_ES2_DECLARATOR_ATTRIB GL_ES2_FUNCTION_ID(Uniform3fv)(gl
   void *mem = NULL;
   sl_reg_alloc_kind_t slrak = slrak_void;
   size_t final_array_size = 0, entry_in_final_array = 0;
-  r = sl_uniform_get_location_info(&prog->program_.uniforms_, location, &mem, &slrak, NULL, NULL, &final_array_size, &entry_in_final_array);
+  r = sl_uniform_get_location_info_for_update(&prog->program_.uniforms_, location, &mem, &slrak, &final_array_size, &entry_in_final_array);
   size_t entries_remaining = final_array_size - entry_in_final_array;
   size_t num_entries = (size_t)count;
   size_t n;
@@ -7603,7 +7606,7 @@ GL_ES2_DECL_SPEC void GL_ES2_DECLARATOR_ATTRIB GL_ES2_FUNCTION_ID(Uniform3i)(gl_
   int r;
   void *mem = NULL;
   sl_reg_alloc_kind_t slrak = slrak_void;
-  r = sl_uniform_get_location_info(&prog->program_.uniforms_, location, &mem, &slrak, NULL, NULL, NULL, NULL);
+  r = sl_uniform_get_location_info_for_update(&prog->program_.uniforms_, location, &mem, &slrak, NULL, NULL);
   if (r != SL_ERR_OK) {
     if (r == SL_ERR_NO_MEM) {
       set_gl_err(GL_ES2_OUT_OF_MEMORY);
@@ -7674,7 +7677,7 @@ GL_ES2_DECL_SPEC void GL_ES2_DECLARATOR_ATTRIB GL_ES2_FUNCTION_ID(Uniform3iv)(gl
   void *mem = NULL;
   sl_reg_alloc_kind_t slrak = slrak_void;
   size_t final_array_size = 0, entry_in_final_array = 0;
-  r = sl_uniform_get_location_info(&prog->program_.uniforms_, location, &mem, &slrak, NULL, NULL, &final_array_size, &entry_in_final_array);
+  r = sl_uniform_get_location_info_for_update(&prog->program_.uniforms_, location, &mem, &slrak, &final_array_size, &entry_in_final_array);
   size_t entries_remaining = final_array_size - entry_in_final_array;
   size_t num_entries = (size_t)count;
   size_t n;
@@ -7762,7 +7765,7 @@ GL_ES2_DECL_SPEC void GL_ES2_DECLARATOR_ATTRIB GL_ES2_FUNCTION_ID(Uniform4f)(gl_
   int r;
   void *mem = NULL;
   sl_reg_alloc_kind_t slrak = slrak_void;
-  r = sl_uniform_get_location_info(&prog->program_.uniforms_, location, &mem, &slrak, NULL, NULL, NULL, NULL);
+  r = sl_uniform_get_location_info_for_update(&prog->program_.uniforms_, location, &mem, &slrak, NULL, NULL);
   if (r != SL_ERR_OK) {
     if (r == SL_ERR_NO_MEM) {
       set_gl_err(GL_ES2_OUT_OF_MEMORY);
@@ -7835,7 +7838,7 @@ GL_ES2_DECL_SPEC void GL_ES2_DECLARATOR_ATTRIB GL_ES2_FUNCTION_ID(Uniform4fv)(gl
   void *mem = NULL;
   sl_reg_alloc_kind_t slrak = slrak_void;
   size_t final_array_size = 0, entry_in_final_array = 0;
-  r = sl_uniform_get_location_info(&prog->program_.uniforms_, location, &mem, &slrak, NULL, NULL, &final_array_size, &entry_in_final_array);
+  r = sl_uniform_get_location_info_for_update(&prog->program_.uniforms_, location, &mem, &slrak, &final_array_size, &entry_in_final_array);
   size_t entries_remaining = final_array_size - entry_in_final_array;
   size_t num_entries = (size_t)count;
   size_t n;
@@ -7925,7 +7928,7 @@ GL_ES2_DECL_SPEC void GL_ES2_DECLARATOR_ATTRIB GL_ES2_FUNCTION_ID(Uniform4i)(gl_
   int r;
   void *mem = NULL;
   sl_reg_alloc_kind_t slrak = slrak_void;
-  r = sl_uniform_get_location_info(&prog->program_.uniforms_, location, &mem, &slrak, NULL, NULL, NULL, NULL);
+  r = sl_uniform_get_location_info_for_update(&prog->program_.uniforms_, location, &mem, &slrak, NULL, NULL);
   if (r != SL_ERR_OK) {
     if (r == SL_ERR_NO_MEM) {
       set_gl_err(GL_ES2_OUT_OF_MEMORY);
@@ -7998,7 +8001,7 @@ GL_ES2_DECL_SPEC void GL_ES2_DECLARATOR_ATTRIB GL_ES2_FUNCTION_ID(Uniform4iv)(gl
   void *mem = NULL;
   sl_reg_alloc_kind_t slrak = slrak_void;
   size_t final_array_size = 0, entry_in_final_array = 0;
-  r = sl_uniform_get_location_info(&prog->program_.uniforms_, location, &mem, &slrak, NULL, NULL, &final_array_size, &entry_in_final_array);
+  r = sl_uniform_get_location_info_for_update(&prog->program_.uniforms_, location, &mem, &slrak, &final_array_size, &entry_in_final_array);
   size_t entries_remaining = final_array_size - entry_in_final_array;
   size_t num_entries = (size_t)count;
   size_t n;
@@ -8099,7 +8102,7 @@ GL_ES2_DECL_SPEC void GL_ES2_DECLARATOR_ATTRIB GL_ES2_FUNCTION_ID(UniformMatrix2
   void *mem = NULL;
   sl_reg_alloc_kind_t slrak = slrak_void;
   size_t final_array_size = 0, entry_in_final_array = 0;
-  r = sl_uniform_get_location_info(&prog->program_.uniforms_, location, &mem, &slrak, NULL, NULL, &final_array_size, &entry_in_final_array);
+  r = sl_uniform_get_location_info_for_update(&prog->program_.uniforms_, location, &mem, &slrak, &final_array_size, &entry_in_final_array);
   size_t entries_remaining = final_array_size - entry_in_final_array;
   size_t num_entries = (size_t)count;
   size_t n;
@@ -8191,7 +8194,7 @@ GL_ES2_DECL_SPEC void GL_ES2_DECLARATOR_ATTRIB GL_ES2_FUNCTION_ID(UniformMatrix3
   void *mem = NULL;
   sl_reg_alloc_kind_t slrak = slrak_void;
   size_t final_array_size = 0, entry_in_final_array = 0;
-  r = sl_uniform_get_location_info(&prog->program_.uniforms_, location, &mem, &slrak, NULL, NULL, &final_array_size, &entry_in_final_array);
+  r = sl_uniform_get_location_info_for_update(&prog->program_.uniforms_, location, &mem, &slrak, &final_array_size, &entry_in_final_array);
   size_t entries_remaining = final_array_size - entry_in_final_array;
   size_t num_entries = (size_t)count;
   size_t n;
@@ -8288,7 +8291,7 @@ GL_ES2_DECL_SPEC void GL_ES2_DECLARATOR_ATTRIB GL_ES2_FUNCTION_ID(UniformMatrix4
   void *mem = NULL;
   sl_reg_alloc_kind_t slrak = slrak_void;
   size_t final_array_size = 0, entry_in_final_array = 0;
-  r = sl_uniform_get_location_info(&prog->program_.uniforms_, location, &mem, &slrak, NULL, NULL, &final_array_size, &entry_in_final_array);
+  r = sl_uniform_get_location_info_for_update(&prog->program_.uniforms_, location, &mem, &slrak, &final_array_size, &entry_in_final_array);
   size_t entries_remaining = final_array_size - entry_in_final_array;
   size_t num_entries = (size_t)count;
   size_t n;
@@ -8620,6 +8623,10 @@ GL_ES2_DECL_SPEC void GL_ES2_DECLARATOR_ATTRIB GL_ES2_FUNCTION_ID(Viewport)(gl_e
 }
 
 GL_ES2_DECL_SPEC void GL_ES2_DECLARATOR_ATTRIB GL_ES2_FUNCTION_ID(run_debug_shader)(int program) {
+  GL_ES2_FUNCTION_ID(run_debug_shader_rows)(program, 1);
+}
+
+GL_ES2_DECL_SPEC void GL_ES2_DECLARATOR_ATTRIB GL_ES2_FUNCTION_ID(run_debug_shader_rows)(int program, int num_rows) {
   struct gl_es2_context *c = gl_es2_ctx();
 
   uintptr_t prog_name = (uintptr_t)program;
@@ -8647,9 +8654,25 @@ GL_ES2_DECL_SPEC void GL_ES2_DECLARATOR_ATTRIB GL_ES2_FUNCTION_ID(run_debug_shad
     return;
   }
 
-  /* Set up execution chain of 1 single isolated row only. */
-  uint8_t *exec_chain = debug_shader->exec_.exec_chain_reg_;
-  exec_chain[0] = 0;
+  if ((num_rows < 1) || !debug_shader->exec_.max_num_rows_) {
+    set_gl_err(GL_ES2_INVALID_VALUE);
+    gl_es2_ctx_release(c);
+    return;
+  }
+  if ((size_t)num_rows > debug_shader->exec_.max_num_rows_) {
+    num_rows = (int)debug_shader->exec_.max_num_rows_;
+  }
+
+  /* Uniforms set with glUniformXXX, as for a draw */
+  gl_es2_ctx_prepare_program_for_execution(c, prog);
+
+  /* Set up execution chain of num_rows consecutive rows, all starting out the same. */
+  sl_exec_row_t *exec_chain = debug_shader->exec_.exec_chain_reg_;
+  int row;
+  for (row = 0; row < (num_rows - 1); ++row) {
+    exec_chain[row] = 1;
+  }
+  exec_chain[num_rows - 1] = 0;
 
   r = sl_exec_run(&prog->debug_shader_.shader_->shader_.exec_, vmain, 0);
 
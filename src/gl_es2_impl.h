@@ -519,6 +519,13 @@ GL_ES2_DECL_SPEC int GL_ES2_DECLARATOR_ATTRIB GL_ES2_FUNCTION_ID(context_init)(i
  */
 GL_ES2_DECL_SPEC void GL_ES2_DECLARATOR_ATTRIB GL_ES2_FUNCTION_ID(run_debug_shader)(int program);
 
+/* runs the debug shader inside the specified program like run_debug_shader, but over num_rows rows
+ * at once rather than a single row (clamped to the batch width of the shader, so a large value such
+ * as INT_MAX runs a full batch.) All rows compute the same values, dump() reports the first row. This
+ * exercises the code paths that process runs of 4 or 8 rows at a time.
+ */
+GL_ES2_DECL_SPEC void GL_ES2_DECLARATOR_ATTRIB GL_ES2_FUNCTION_ID(run_debug_shader_rows)(int program, int num_rows);
+
 /* retrieves the debug dump string as logged by the "dump()" builtin function (available only on
  * glCreateShader(AEX_GL_DEBUG_SHADER) type shaders). If no dump() call was made, or an error
  * occurs, an empty string "" is returned. Otherwise a multi-line string is returned whereby,
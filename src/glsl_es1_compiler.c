@@ -68,6 +68,11 @@
 #include "sampler_2d.h"
 #endif
 
+#ifndef SL_IR_H_INCLUDED
+#define SL_IR_H_INCLUDED
+#include "sl_ir.h"
+#endif
+
 void glsl_es1_compiler_init(struct glsl_es1_compiler *cc) {
   dx_diags_init(&cc->default_dx_);
   cc->dx_ = &cc->default_dx_;
@@ -356,6 +361,7 @@ enum glsl_es1_compiler_result glsl_es1_compiler_compile_mem(struct glsl_es1_comp
       assert(!f->builtin_eval_fn_ && !f->builtin_runtime_fn_ && "builtins already set??");
       f->builtin_eval_fn_ = proto_snippets[builtin_idx].eval_fn_;
       f->builtin_runtime_fn_ = proto_snippets[builtin_idx].runtime_fn_;
+      sl_ir_bind_builtin_emit_fn(f);
     }
   }
 
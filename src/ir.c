@@ -339,6 +339,8 @@ static void ir_instr_init(struct ir_instr *instr) {
   instr->instruction_code_ = 0;
   instr->num_args_ = 0;
   instr->args_ = NULL;
+  instr->source_node_ = NULL;
+  instr->source_loc_ = NULL;
 }
 
 static void ir_instr_cleanup(struct ir_instr *instr) {
@@ -500,6 +502,8 @@ void ir_body_init(struct ir_body *body) {
   body->blocks_ = NULL;
   body->alloc_error_ = 0;
   ref_range_allocator_init(&body->rra_virtuals_);
+  body->source_node_ = NULL;
+  body->source_loc_ = NULL;
 }
 
 void ir_body_cleanup(struct ir_body *body) {
@@ -566,6 +570,28 @@ struct ir_block *ir_body_alloc_block(struct ir_body *body) {
   return blk;
 }
 
+int ir_block_add_successor(struct ir_block *from, struct ir_block *to) {
+  if (!from || !to) return -1;
+  struct ir_control_flow_edge *edge = from->successors_;
+  if (edge) {
+    do {
+      if (edge->to_ == to) {
+        /* Already connected */
+        return 0;
+      }
+      edge = edge->next_in_from_;
+    } while (edge != from->successors_);
+  }
+  edge = ir_control_flow_edge_alloc();
+  if (!edge) {
+    if (from->body_) from->body_->alloc_error_ = 1;
+    return -1;
+  }
+  ir_control_flow_edge_attach_from_block(edge, from);
+  ir_control_flow_edge_attach_to_block(edge, to);
+  return 0;
+}
+
 struct ir_temp *ir_body_alloc_temp(struct ir_body *body) {
   struct ir_temp *t = ir_temp_alloc();
   if (t) {
@@ -604,6 +630,7 @@ struct ir_temp *ir_body_alloc_temp_unused_virtual(struct ir_body *body) {
   uintptr_t free_id;
   if (ref_range_alloc(&body->rra_virtuals_, 1, &free_id)) {
     ir_temp_free(t);
+    body->alloc_error_ = 1;
     return NULL;
   }
 
@@ -792,6 +819,9 @@ void ir_print_temp(struct source_gen *sg, struct ireg_registry *ireg, struct ir_
     case IR_LITERAL_DOUBLE:
       sg_printf(sg, "%f", temp->lit_.d_);
       break;
+    case IR_LITERAL_BOOL:
+      sg_printf(sg, "%s", temp->lit_.b_ ? "true" : "false");
+      break;
 
     case IR_BLOCK_ENTRY:
       sg_printf(sg, "L%u", temp->entry_point_block_ ? temp->entry_point_block_->serial_num_ : -1);
@@ -903,14 +933,54 @@ void ir_print_body(struct source_gen *sg, struct ireg_registry *ireg, struct ir_
 }
 
 struct ir_instr *ir_block_append_instr(struct ir_block *blk, int instruction_code) {
+  if (!blk) return NULL;
   struct ir_instr *ins = ir_instr_alloc();
-  if (!ins) return NULL;
+  if (!ins) {
+    if (blk->body_) blk->body_->alloc_error_ = 1;
+    return NULL;
+  }
   ins->instruction_code_ = instruction_code;
+  if (blk->body_) {
+    ins->source_node_ = blk->body_->source_node_;
+    ins->source_loc_ = blk->body_->source_loc_;
+  }
   ir_instr_append_to_block(ins, blk);
   return ins;
 }
 
+struct ir_instr *ir_block_insert_instr_before(struct ir_instr *before, int instruction_code) {
+  if (!before || !before->block_) return NULL;
+  struct ir_block *blk = before->block_;
+  struct ir_instr *ins = ir_instr_alloc();
+  if (!ins) {
+    if (blk->body_) blk->body_->alloc_error_ = 1;
+    return NULL;
+  }
+  ins->instruction_code_ = instruction_code;
+  ins->source_node_ = before->source_node_;
+  ins->source_loc_ = before->source_loc_;
+  ins->block_ = blk;
+  ins->next_in_block_ = before;
+  ins->prev_in_block_ = before->prev_in_block_;
+  ins->next_in_block_->prev_in_block_ = ins;
+  ins->prev_in_block_->next_in_block_ = ins;
+  if (blk->instructions_ == before) {
+    blk->instructions_ = ins;
+  }
+  return ins;
+}
+
+void ir_block_remove_instr(struct ir_instr *instr) {
+  ir_instr_free(instr);
+}
+
+void ir_arg_set_temp(struct ir_arg *arg, struct ir_temp *temp) {
+  enum ir_temp_usage usage = arg->usage_;
+  ir_arg_attach_to_temp(arg, temp, usage != IR_DEF, usage != IR_USE);
+}
+
 struct ir_arg *ir_instr_append_use(struct ir_instr *ins, struct ir_temp *temp) {
+  if (!ins) return NULL;
   struct ir_arg *a = ir_arg_alloc();
   if (!a) {
     if (ins->block_ && ins->block_->body_) {
@@ -927,6 +997,7 @@ struct ir_arg *ir_instr_append_use(struct ir_instr *ins, struct ir_temp *temp) {
 }
 
 struct ir_arg *ir_instr_append_def(struct ir_instr *ins, struct ir_temp *temp) {
+  if (!ins) return NULL;
   struct ir_arg *a = ir_arg_alloc();
   if (!a) {
     if (ins->block_ && ins->block_->body_) {
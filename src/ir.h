@@ -32,6 +32,7 @@ struct ir_control_flow;
 
 struct lob_sym;
 struct source_gen;
+struct situs;
 
 enum ir_temp_type {
   /* Can be any register from a machine dependant register set */
@@ -169,6 +170,12 @@ struct ir_instr {
 
   /* Arguments to this instruction. */
   struct ir_arg **args_;
+
+  /* Source construct the instruction was generated for, NULL if unknown; source_node_ is an opaque key (the
+   * sl_expr or sl_stmt for SLIR) and source_loc_ its location. Taken from ir_body::source_node_ and
+   * source_loc_ when appended, or from the instruction it is inserted before. */
+  const void *source_node_;
+  const struct situs *source_loc_;
 };
 
 /* Association object between basic blocks to model the flow graph */
@@ -228,6 +235,11 @@ struct ir_body {
   /* Allocation map for IR_VIRTUAL, if the ref is non-zero then the virtual 
    * is taken. */
   struct ref_range_allocator rra_virtuals_;
+
+  /* Source construct that instructions appended are generated for, see ir_instr::source_node_; the
+   * front-end sets these as it lowers each construct. */
+  const void *source_node_;
+  const struct situs *source_loc_;
 };
 
 void ir_body_init(struct ir_body *body);
@@ -256,6 +268,18 @@ void ir_block_cleanup(struct ir_block *blk);
 void ir_block_free(struct ir_block *blk);
 
 struct ir_instr *ir_block_append_instr(struct ir_block *blk, int instruction_code);
+
+/* Inserts a new instruction immediately before the instruction "before", in the same block. */
+struct ir_instr *ir_block_insert_instr_before(struct ir_instr *before, int instruction_code);
+
+/* Removes instr from its block and frees it, along with its arguments (but not the temps they reference.) */
+void ir_block_remove_instr(struct ir_instr *instr);
+
+/* Makes arg reference temp instead of the temp it references now, the usage is unchanged. */
+void ir_arg_set_temp(struct ir_arg *arg, struct ir_temp *temp);
+
+/* Adds a control flow edge from block "from" to block "to", if no such edge exists already. */
+int ir_block_add_successor(struct ir_block *from, struct ir_block *to);
 struct ir_arg *ir_instr_append_use(struct ir_instr *ins, struct ir_temp *temp);
 struct ir_arg *ir_instr_append_def(struct ir_instr *ins, struct ir_temp *temp);
 struct ir_arg *ir_instr_append_usedef(struct ir_instr *ins, struct ir_temp *temp);
@@ -116,6 +116,7 @@
 
 void primitive_assembly_init(struct primitive_assembly *pa) {
   pa->num_rows_ = 0;
+  pa->max_num_rows_ = PRIMITIVE_ASSEMBLY_MAX_ROWS;
   pa->num_cols_ = 0;
   pa->num_cols_allocated_ = 0;
   pa->column_descriptors_ = NULL;
@@ -915,7 +916,7 @@ int primitive_assembly_elements_arrayed(struct primitive_assembly *pa, struct at
 int primitive_assembly_gather_attribs(struct primitive_assembly *pa, struct attrib_set *as, struct sl_execution *exec) {
   size_t col;
   size_t row;
-  size_t num_rows = PRIMITIVE_ASSEMBLY_MAX_ROWS - pa->num_rows_;
+  size_t num_rows = pa->max_num_rows_ - pa->num_rows_;
   uint32_t * restrict indices = (uint32_t * restrict)pa->vertex_indices_;
   if (num_rows > pa->num_vertex_indices_) {
     num_rows = pa->num_vertex_indices_;
@@ -1401,7 +1402,7 @@ int primitive_assembly_process_primitives(struct primitive_assembly *pa,
     while (primitive_assembly_gather_attribs(pa, as, &vertex_shader->exec_)) {
 
       /* Set up execution chain */
-      uint8_t * restrict exec_chain = vertex_shader->exec_.exec_chain_reg_;
+      sl_exec_row_t * restrict exec_chain = vertex_shader->exec_.exec_chain_reg_;
       size_t exec_row;
       for (exec_row = 0; exec_row < (pa->num_rows_ - 1); ++exec_row) {
         exec_chain[exec_row] = 1;
@@ -2031,7 +2032,7 @@ int primitive_assembly_process_primitives(struct primitive_assembly *pa,
                     }
                   }
 
-                  while ((fragbuf->num_rows_ == FRAGMENT_BUFFER_MAX_ROWS) ||
+                  while ((fragbuf->num_rows_ == fragbuf->max_num_rows_) ||
                          (fragbuf->num_rows_ && (fragbuf->fragment_orientation_ != orientation))) {
                      /* Full, or stalled because of an triangle - fragbuf orientation mismatch.
                       * Return to caller to process & clear fragbuf.
@@ -2224,7 +2225,7 @@ int primitive_assembly_process_primitives(struct primitive_assembly *pa,
                     }
                   }
               
-                  while ((fragbuf->num_rows_ == FRAGMENT_BUFFER_MAX_ROWS) ||
+                  while ((fragbuf->num_rows_ == fragbuf->max_num_rows_) ||
                          (fragbuf->num_rows_ && (fragbuf->fragment_orientation_ != orientation))) {
                     /* Full, or stalled because of an triangle - fragbuf orientation mismatch.
                      * return to caller to process & clear fragbuf */
@@ -2350,7 +2351,7 @@ void primitive_assembly_process_fragments(struct primitive_assembly *pa,
   int orientation = fragbuf->fragment_orientation_;
 
   /* Set up execution chain */
-  uint8_t * restrict frag_exec_chain = fragment_shader->exec_.exec_chain_reg_;
+  sl_exec_row_t * restrict frag_exec_chain = fragment_shader->exec_.exec_chain_reg_;
   size_t frag_exec_row;
   for (frag_exec_row = 0; frag_exec_row < (fragbuf->num_rows_ - 1); ++frag_exec_row) {
     frag_exec_chain[frag_exec_row] = 1;
@@ -2368,7 +2369,7 @@ void primitive_assembly_process_fragments(struct primitive_assembly *pa,
   /* XXX: Speed this up to take big steps (8 at a time) as per other primitives */
   uint32_t row = fragment_shader->exec_.execution_points_[0].alt_chain_;
   if (row != SL_EXEC_NO_CHAIN) {
-    uint8_t delta;
+    sl_exec_row_t delta;
     do {
       delta = fragment_shader->exec_.exec_chain_reg_[row];
 
@@ -2383,7 +2384,7 @@ void primitive_assembly_process_fragments(struct primitive_assembly *pa,
    * XXX: Super common path, inline everything. */
   row = fragment_shader->exec_.execution_points_[0].post_chain_;
   if (row != SL_EXEC_NO_CHAIN) {
-    uint8_t delta;
+    sl_exec_row_t delta;
     float * restrict red_channel = fragment_shader->exec_.float_regs_[fgl_FragColor->reg_alloc_.v_.regs_[0] ];
     float * restrict green_channel = fragment_shader->exec_.float_regs_[fgl_FragColor->reg_alloc_.v_.regs_[1] ];
     float * restrict blue_channel = fragment_shader->exec_.float_regs_[fgl_FragColor->reg_alloc_.v_.regs_[2] ];
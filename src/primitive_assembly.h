@@ -30,14 +30,19 @@
 #include "rasterizer.h"
 #endif
 
+#ifndef SL_EXECUTION_H_INCLUDED
+#define SL_EXECUTION_H_INCLUDED
+#include "sl_execution.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 struct sl_shader;
 
-/* Number of rows in the primitive assembly buffer. */
-#define PRIMITIVE_ASSEMBLY_MAX_ROWS 256
+/* Number of rows in the primitive assembly buffer; the vertex shader runs over all of them in one go. */
+#define PRIMITIVE_ASSEMBLY_MAX_ROWS SL_EXEC_CHAIN_MAX_NUM_ROWS
 
 typedef enum primitive_assembly_data_type {
   PADT_NONE,
@@ -111,9 +116,13 @@ struct primitive_assembly_column_descriptor {
 };
 
 struct primitive_assembly {
-  /* Current number of rows, maximum is PRIMITIVE_ASSEMBLY_MAX_ROWS */
+  /* Current number of rows, maximum is max_num_rows_ */
   size_t num_rows_;
 
+  /* Number of rows gathered for a single run of the vertex shader; this is the number of rows the vertex
+   * shader has its registers allocated for, at most PRIMITIVE_ASSEMBLY_MAX_ROWS. */
+  size_t max_num_rows_;
+
   /* Array of num_cols_ column descriptions */
   size_t num_cols_;
   size_t num_cols_allocated_;
@@ -118,7 +118,7 @@ for (py = top; py < bottom; py += 2) {
     int64_t Any_Fragment_Valid = TL_Mask | TR_Mask | BL_Mask | BR_Mask;
 
     if (Any_Fragment_Valid) {
-      while ((fragbf->num_rows_ + 4) > FRAGMENT_BUFFER_MAX_ROWS) {
+      while ((fragbf->num_rows_ + 4) > fragbf->max_num_rows_) {
         /* Store context so we can resume from yield */
         rasterizer->direction_xy_flips_ = direction_xy_flips;
         rasterizer->D012_ = D012;
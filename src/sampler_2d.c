@@ -37,6 +37,11 @@
 #include "sl_execution.h"
 #endif
 
+#ifndef SL_SIMD_H_INCLUDED
+#define SL_SIMD_H_INCLUDED
+#include "sl_simd.h"
+#endif
+
 #ifndef SAMPLER_2D_H_INCLUDED
 #define SAMPLER_2D_H_INCLUDED
 #include "sampler_2d.h"
@@ -193,6 +198,12 @@ void sampler_2d_update_completeness(struct sampler_2d *s2d) {
 }
 
 
+/* Converts a texel coordinate to uint32_t; negative coordinates, which the repeat wrap mode leaves as-is for the
+ * repeat mask to take care of, wrap around modulo 2^32. */
+static inline uint32_t s2d_f2u(float f) {
+  return (uint32_t)(int64_t)f;
+}
+
 static void texture2D(float *prgba, struct sampler_2d *s2d, float s, float t, float lg2) {
   if (!s2d->is_complete_ || !s2d->num_maps_) {
     prgba[0] = prgba[1] = prgba[2] = 0.f;
@@ -278,7 +289,7 @@ static void texture2D(float *prgba, struct sampler_2d *s2d, float s, float t, fl
           break;
         }
       }
-      uint32_t tex_s = (uint32_t)(sm * s2dm->width_) & s2dm->repeat_mask_s_;
+      uint32_t tex_s = s2d_f2u(sm * s2dm->width_) & s2dm->repeat_mask_s_;
 
       switch (s2d->wrap_t_) {
         case s2d_clamp_to_edge: {
@@ -299,7 +310,7 @@ static void texture2D(float *prgba, struct sampler_2d *s2d, float s, float t, fl
         }
       }
       /* Flip Y axis as we do this */
-      uint32_t tex_t = s2dm->height_ - ((uint32_t)(tm * s2dm->height_) & s2dm->repeat_mask_t_) - 1;
+      uint32_t tex_t = s2dm->height_ - (s2d_f2u(tm * s2dm->height_) & s2dm->repeat_mask_t_) - 1;
 
       /* Load texel at tex_s and tex_t */
       switch (s2dm->components_) {
@@ -476,7 +487,7 @@ static void texture2D(float *prgba, struct sampler_2d *s2d, float s, float t, fl
        * to offset it to (0,0) so we can range the linear interpolation from
        * 0 to 1 in terms of sub-texel coordinates; this is not the case for
        * the nearest filter, only linear. Same for t coordinate. */
-      uint32_t tex_s_fp8 = ((uint32_t)(sm * s2dm->width_ * 256.f)) - 128;
+      uint32_t tex_s_fp8 = s2d_f2u(sm * s2dm->width_ * 256.f) - 128;
       uint32_t tex_s0 = (tex_s_fp8 >> 8) & s2dm->repeat_mask_s_;
       uint32_t tex_s1 = (tex_s0 + 1) & s2dm->repeat_mask_s_;
       uint32_t tex_s1_fract = tex_s_fp8 & 255;
@@ -502,7 +513,7 @@ static void texture2D(float *prgba, struct sampler_2d *s2d, float s, float t, fl
       }
 
       /* Flip Y axis as we do this */
-      uint32_t tex_t_fp8 = ((uint32_t)((1.f - tm) * s2dm->height_ * 256.f)) - 128;
+      uint32_t tex_t_fp8 = s2d_f2u((1.f - tm) * s2dm->height_ * 256.f) - 128;
       uint32_t tex_t0 = (tex_t_fp8 >> 8) & s2dm->repeat_mask_t_;
       uint32_t tex_t1 = (tex_t0 + 1) & s2dm->repeat_mask_t_;
       uint32_t tex_t1_fract = tex_t_fp8 & 255;
@@ -695,6 +706,371 @@ static void texture2D(float *prgba, struct sampler_2d *s2d, float s, float t, fl
   }
 }
 
+/* Number of rows sampled together by texture2D_8() */
+#define S2D_NUM_LANES 8
+
+/* One level of a batch of rows sampled by texture2D_8(): per lane the map sampled, and the texel channels
+ * (in the order they are stored in the bitmap) after filtering that map. */
+struct s2d_lanes {
+  const struct sampler_2d_map *maps_[S2D_NUM_LANES];
+  uint32_t channels_[4][S2D_NUM_LANES];
+};
+
+/* Applies wrap mode wrap to the coordinates c of the lanes for maps that are size texels across; each mode has a
+ * loop of its own so the mode is not decided per lane. */
+static void s2d_wrap_lanes(enum s2d_wrap wrap, float *restrict c, const float *restrict size) {
+  int n;
+  switch (wrap) {
+    case s2d_clamp_to_edge:
+      for (n = 0; n < S2D_NUM_LANES; ++n) {
+        float min_fc = 1 / (2.f * size[n]);
+        float max_fc = 1.f - min_fc;
+        c[n] = (c[n] < min_fc) ? min_fc : ((c[n] > max_fc) ? max_fc : c[n]);
+      }
+      break;
+    case s2d_repeat:
+      /* leave as-is, mask will take care of it */
+      break;
+    case s2d_mirrored_repeat:
+      for (n = 0; n < S2D_NUM_LANES; ++n) {
+        float floared = floorf(c[n]);
+        float fract = c[n] - floared;
+        c[n] = (1 & (int64_t)floared) ? (1.f - fract) : fract;
+      }
+      break;
+  }
+}
+
+/* Loads the texel at offsets[n] from bitmaps[n] for each lane, packing its components into texels[n] with the
+ * first component in the least significant byte; a loop for each texel size so the loads are not decided per lane. */
+static void s2d_gather_lanes(int num_components, const uint8_t *const *bitmaps, const size_t *offsets, uint32_t *restrict texels) {
+  int n;
+  switch (num_components) {
+    case 1:
+      for (n = 0; n < S2D_NUM_LANES; ++n) {
+        const uint8_t *restrict p = bitmaps[n] + offsets[n];
+        texels[n] = p[0];
+      }
+      break;
+    case 2:
+      for (n = 0; n < S2D_NUM_LANES; ++n) {
+        const uint8_t *restrict p = bitmaps[n] + offsets[n];
+        texels[n] = p[0] | ((uint32_t)p[1] << 8);
+      }
+      break;
+    case 3:
+      for (n = 0; n < S2D_NUM_LANES; ++n) {
+        const uint8_t *restrict p = bitmaps[n] + offsets[n];
+        texels[n] = p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16);
+      }
+      break;
+    case 4:
+      for (n = 0; n < S2D_NUM_LANES; ++n) {
+        const uint8_t *restrict p = bitmaps[n] + offsets[n];
+        texels[n] = p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+      }
+      break;
+  }
+}
+
+/* Per lane size, masks and bitmap of the maps in level->maps_[], so the lane loops need not go through the maps;
+ * the width and height are also kept as float for the texel coordinates. */
+struct s2d_lanes_maps {
+  float widths_[S2D_NUM_LANES], heights_[S2D_NUM_LANES];
+  uint32_t widths_u_[S2D_NUM_LANES], heights_u_[S2D_NUM_LANES];
+  uint32_t repeat_masks_s_[S2D_NUM_LANES], repeat_masks_t_[S2D_NUM_LANES];
+  const uint8_t *bitmaps_[S2D_NUM_LANES];
+};
+
+static void s2d_lanes_maps(const struct s2d_lanes *level, struct s2d_lanes_maps *lm) {
+  int n;
+  for (n = 0; n < S2D_NUM_LANES; ++n) {
+    const struct sampler_2d_map *s2dm = level->maps_[n];
+    lm->widths_[n] = (float)s2dm->width_;
+    lm->heights_[n] = (float)s2dm->height_;
+    lm->widths_u_[n] = (uint32_t)s2dm->width_;
+    lm->heights_u_[n] = (uint32_t)s2dm->height_;
+    lm->repeat_masks_s_[n] = s2dm->repeat_mask_s_;
+    lm->repeat_masks_t_[n] = s2dm->repeat_mask_t_;
+    lm->bitmaps_[n] = (const uint8_t *)s2dm->bitmap_;
+  }
+}
+
+/* Fetches the texels nearest to s and t for each lane from level->maps_[]; same as the nearest filter of
+ * texture2D(). */
+static void s2d_nearest_lanes(const struct sampler_2d *s2d, int num_components, const float *s, const float *t, struct s2d_lanes *level) {
+  struct s2d_lanes_maps lm;
+  float sm[S2D_NUM_LANES], tm[S2D_NUM_LANES];
+  size_t offsets[S2D_NUM_LANES];
+  uint32_t texels[S2D_NUM_LANES];
+  int n, ch;
+  s2d_lanes_maps(level, &lm);
+  for (n = 0; n < S2D_NUM_LANES; ++n) {
+    sm[n] = s[n];
+    tm[n] = t[n];
+  }
+  s2d_wrap_lanes(s2d->wrap_s_, sm, lm.widths_);
+  /* Like texture2D(), t is clamped to the edges by the width */
+  s2d_wrap_lanes(s2d->wrap_t_, tm, lm.widths_);
+
+  for (n = 0; n < S2D_NUM_LANES; ++n) {
+    uint32_t tex_s = s2d_f2u(sm[n] * lm.widths_[n]) & lm.repeat_masks_s_[n];
+    /* Flip Y axis as we do this */
+    uint32_t tex_t = lm.heights_u_[n] - (s2d_f2u(tm[n] * lm.heights_[n]) & lm.repeat_masks_t_[n]) - 1;
+    offsets[n] = num_components * (size_t)(lm.widths_u_[n] * tex_t + tex_s);
+  }
+  s2d_gather_lanes(num_components, lm.bitmaps_, offsets, texels);
+
+  for (ch = 0; ch < num_components; ++ch) {
+    for (n = 0; n < S2D_NUM_LANES; ++n) {
+      level->channels_[ch][n] = (texels[n] >> (8 * ch)) & 255;
+    }
+  }
+}
+
+/* Bilinear filters the 4 texels around s and t for each lane from level->maps_[]; same as the linear filter of
+ * texture2D(), the channels are 65536 times their range. */
+static void s2d_linear_lanes(const struct sampler_2d *s2d, int num_components, const float *s, const float *t, struct s2d_lanes *level) {
+  struct s2d_lanes_maps lm;
+  float sm[S2D_NUM_LANES], tm[S2D_NUM_LANES];
+  /* Per corner, in order 00, 01, 10 and 11; the layout sl_simd_kernels::texel_bilinear_ takes */
+  size_t offsets[4][S2D_NUM_LANES];
+  uint32_t fracts[4][S2D_NUM_LANES];
+  uint32_t texels[4][S2D_NUM_LANES];
+  int n, ch, k;
+  s2d_lanes_maps(level, &lm);
+  for (n = 0; n < S2D_NUM_LANES; ++n) {
+    sm[n] = s[n];
+    tm[n] = t[n];
+  }
+  s2d_wrap_lanes(s2d->wrap_s_, sm, lm.widths_);
+  s2d_wrap_lanes(s2d->wrap_t_, tm, lm.widths_);
+
+  for (n = 0; n < S2D_NUM_LANES; ++n) {
+    /* -128 to move the texel center to (0,0), see texture2D() */
+    uint32_t tex_s_fp8 = s2d_f2u(sm[n] * lm.widths_[n] * 256.f) - 128;
+    uint32_t tex_s0 = (tex_s_fp8 >> 8) & lm.repeat_masks_s_[n];
+    uint32_t tex_s1 = (tex_s0 + 1) & lm.repeat_masks_s_[n];
+    uint32_t tex_s1_fract = tex_s_fp8 & 255;
+    uint32_t tex_s0_fract = 256 - tex_s1_fract;
+
+    /* Flip Y axis as we do this */
+    uint32_t tex_t_fp8 = s2d_f2u((1.f - tm[n]) * lm.heights_[n] * 256.f) - 128;
+    uint32_t tex_t0 = (tex_t_fp8 >> 8) & lm.repeat_masks_t_[n];
+    uint32_t tex_t1 = (tex_t0 + 1) & lm.repeat_masks_t_[n];
+    uint32_t tex_t1_fract = tex_t_fp8 & 255;
+    uint32_t tex_t0_fract = 256 - tex_t1_fract;
+
+    fracts[0][n] = tex_s0_fract * tex_t0_fract;
+    fracts[1][n] = tex_s0_fract * tex_t1_fract;
+    fracts[2][n] = tex_s1_fract * tex_t0_fract;
+    fracts[3][n] = tex_s1_fract * tex_t1_fract;
+
+    offsets[0][n] = num_components * (size_t)(lm.widths_u_[n] * tex_t0 + tex_s0);
+    offsets[1][n] = num_components * (size_t)(lm.widths_u_[n] * tex_t1 + tex_s0);
+    offsets[2][n] = num_components * (size_t)(lm.widths_u_[n] * tex_t0 + tex_s1);
+    offsets[3][n] = num_components * (size_t)(lm.widths_u_[n] * tex_t1 + tex_s1);
+  }
+  for (k = 0; k < 4; ++k) {
+    s2d_gather_lanes(num_components, lm.bitmaps_, offsets[k], texels[k]);
+  }
+
+  /* The weights sum to 65536 so the blend fits 32 bits */
+  if (g_sl_simd_.texel_bilinear_) {
+    g_sl_simd_.texel_bilinear_(num_components, texels[0], fracts[0], level->channels_[0]);
+    return;
+  }
+  for (ch = 0; ch < num_components; ++ch) {
+    for (n = 0; n < S2D_NUM_LANES; ++n) {
+      level->channels_[ch][n] = ((texels[0][n] >> (8 * ch)) & 255) * fracts[0][n]
+                              + ((texels[1][n] >> (8 * ch)) & 255) * fracts[1][n]
+                              + ((texels[2][n] >> (8 * ch)) & 255) * fracts[2][n]
+                              + ((texels[3][n] >> (8 * ch)) & 255) * fracts[3][n];
+    }
+  }
+}
+
+/* Samples 8 rows at once, writing the same values as 8 calls to texture2D() would to red[0..7], green[0..7],
+ * blue[0..7] and alpha[0..7]; lg2 is NULL if the level of detail is 0 for all rows.
+ * The addresses and weights are computed lane by lane in fixed size arrays so the compiler can vectorize them (as
+ * with SLSIMD_GENERIC in sl_simd.c), the texels are loaded a byte at a time per lane, and the blends go through
+ * the g_sl_simd_ kernels where the CPU has them. Rows that do not all take the
+ * same filter (some magnify, others minify) go through texture2D() one at a time. */
+static void texture2D_8(struct sampler_2d *s2d, const float *s, const float *t, const float *lg2,
+                        float *restrict red, float *restrict green, float *restrict blue, float *restrict alpha) {
+  struct s2d_lanes levels[2];
+  uint32_t tau1_fracts[S2D_NUM_LANES], tau2_fracts[S2D_NUM_LANES];
+  float lods[S2D_NUM_LANES];
+  enum s2d_filter filter;
+  float c, scale;
+  int n, ch, num_levels, num_components;
+
+  if (!s2d->is_complete_ || !s2d->num_maps_) goto single_rows;
+
+  for (n = 0; n < S2D_NUM_LANES; ++n) {
+    lods[n] = lg2 ? lg2[n] : 0.f;
+  }
+
+  /* c as meant in section 3.7.8 texture magnification (OpenGL ES 2.0 full spec v2.0.25 page 82) */
+  if ((s2d->mag_filter_ == s2d_linear) &&
+      ((s2d->min_filter_ == s2d_nearest_mipmap_nearest) ||
+       (s2d->min_filter_ == s2d_nearest_mipmap_linear))) {
+    c = 0.5f;
+  }
+  else {
+    c = 0.f;
+  }
+  filter = (lods[0] > c) ? s2d->min_filter_ : s2d->mag_filter_;
+  for (n = 1; n < S2D_NUM_LANES; ++n) {
+    if (((lods[n] > c) ? s2d->min_filter_ : s2d->mag_filter_) != filter) goto single_rows;
+  }
+
+  int last_mipmap = s2d->num_maps_ - 1;
+  if (last_mipmap > s2d->max_mipmap_level_) last_mipmap = s2d->max_mipmap_level_;
+
+  switch (filter) {
+    case s2d_nearest:
+    case s2d_linear:
+      for (n = 0; n < S2D_NUM_LANES; ++n) {
+        levels[0].maps_[n] = s2d->mipmaps_;
+      }
+      num_levels = 1;
+      break;
+    case s2d_nearest_mipmap_nearest:
+    case s2d_linear_mipmap_nearest:
+      for (n = 0; n < S2D_NUM_LANES; ++n) {
+        float lod = lods[n];
+        int nearest_mipmap = (lod <= 0.5f) ? 0 : (lod > (0.5f + (float)last_mipmap)) ? last_mipmap : ((int)(ceilf(lod + 0.5f)) - 1);
+        levels[0].maps_[n] = s2d->mipmaps_ + nearest_mipmap;
+      }
+      num_levels = 1;
+      break;
+    case s2d_nearest_mipmap_linear:
+    case s2d_linear_mipmap_linear:
+      for (n = 0; n < S2D_NUM_LANES; ++n) {
+        float ffloor_lg2 = floorf(lods[n]);
+        float ffract_lg2 = lods[n] - ffloor_lg2;
+        int floor_lg2 = (int)ffloor_lg2;
+        int d1_mipmap = (floor_lg2 >= last_mipmap) ? last_mipmap : floor_lg2;
+        int d2_mipmap = (floor_lg2 >= last_mipmap) ? last_mipmap : d1_mipmap + 1;
+        levels[0].maps_[n] = s2d->mipmaps_ + d1_mipmap;
+        levels[1].maps_[n] = s2d->mipmaps_ + d2_mipmap;
+        tau2_fracts[n] = (uint32_t)(256.f * ffract_lg2);
+        tau1_fracts[n] = 256 - tau2_fracts[n];
+      }
+      num_levels = 2;
+      break;
+    default:
+      goto single_rows;
+  }
+
+  enum s2d_tex_components components = levels[0].maps_[0]->components_;
+  switch (components) {
+    case s2d_alpha: num_components = 1; break;
+    case s2d_luminance: num_components = 1; break;
+    case s2d_luminance_alpha: num_components = 2; break;
+    case s2d_rgb: num_components = 3; break;
+    case s2d_rgba: num_components = 4; break;
+    default:
+      goto single_rows;
+  }
+
+  int level;
+  for (level = 0; level < num_levels; ++level) {
+    if ((filter == s2d_nearest) || (filter == s2d_nearest_mipmap_nearest) || (filter == s2d_nearest_mipmap_linear)) {
+      s2d_nearest_lanes(s2d, num_components, s, t, levels + level);
+    }
+    else {
+      s2d_linear_lanes(s2d, num_components, s, t, levels + level);
+    }
+  }
+
+  if (num_levels == 2) {
+    /* Blend the levels, the tau fractions sum to 256, so a trilinear blend is at most 255 x 65536 x 256 and
+     * still fits 32 bits */
+    if (g_sl_simd_.texel_lerp_) {
+      g_sl_simd_.texel_lerp_(num_components, levels[0].channels_[0], tau1_fracts, levels[1].channels_[0], tau2_fracts);
+    }
+    else {
+      for (ch = 0; ch < num_components; ++ch) {
+        for (n = 0; n < S2D_NUM_LANES; ++n) {
+          levels[0].channels_[ch][n] = levels[0].channels_[ch][n] * tau1_fracts[n] + levels[1].channels_[ch][n] * tau2_fracts[n];
+        }
+      }
+    }
+  }
+
+  switch (filter) {
+    case s2d_nearest:
+    case s2d_nearest_mipmap_nearest:
+      scale = 255.f;
+      break;
+    case s2d_nearest_mipmap_linear:
+      scale = 256.f * 255.f;
+      break;
+    case s2d_linear:
+    case s2d_linear_mipmap_nearest:
+      scale = 65536.f * 255.f;
+      break;
+    default: /* s2d_linear_mipmap_linear */
+      scale = 16777216.f * 255.f;
+      break;
+  }
+
+  const uint32_t *restrict ch0 = levels[0].channels_[0];
+  const uint32_t *restrict ch1 = levels[0].channels_[1];
+  const uint32_t *restrict ch2 = levels[0].channels_[2];
+  const uint32_t *restrict ch3 = levels[0].channels_[3];
+  switch (components) {
+    case s2d_alpha:
+      for (n = 0; n < S2D_NUM_LANES; ++n) {
+        red[n] = green[n] = blue[n] = 0.f;
+        alpha[n] = ((float)ch0[n]) / scale;
+      }
+      break;
+    case s2d_luminance:
+      for (n = 0; n < S2D_NUM_LANES; ++n) {
+        red[n] = ((float)ch0[n]) / scale;
+        green[n] = blue[n] = alpha[n] = 0.f;
+      }
+      break;
+    case s2d_luminance_alpha:
+      for (n = 0; n < S2D_NUM_LANES; ++n) {
+        red[n] = ((float)ch0[n]) / scale;
+        green[n] = blue[n] = 0.f;
+        alpha[n] = ((float)ch1[n]) / scale;
+      }
+      break;
+    case s2d_rgb:
+      for (n = 0; n < S2D_NUM_LANES; ++n) {
+        red[n] = ((float)ch0[n]) / scale;
+        green[n] = ((float)ch1[n]) / scale;
+        blue[n] = ((float)ch2[n]) / scale;
+        alpha[n] = 1.f;
+      }
+      break;
+    case s2d_rgba:
+      for (n = 0; n < S2D_NUM_LANES; ++n) {
+        red[n] = ((float)ch0[n]) / scale;
+        green[n] = ((float)ch1[n]) / scale;
+        blue[n] = ((float)ch2[n]) / scale;
+        alpha[n] = ((float)ch3[n]) / scale;
+      }
+      break;
+  }
+  return;
+
+single_rows:
+  for (n = 0; n < S2D_NUM_LANES; ++n) {
+    float rgba[4];
+    texture2D(rgba, s2d, s[n], t[n], lg2 ? lg2[n] : 0.f);
+    red[n] = rgba[0];
+    green[n] = rgba[1];
+    blue[n] = rgba[2];
+    alpha[n] = rgba[3];
+  }
+}
+
 struct sampler_2d *split_execution_chains_to_cubemap_sampler_tex_chains(struct sl_execution *exec, int exec_chain, 
                                                                         void *restrict *restrict cubemap_sampler_column,
                                                                         float *restrict coord_column_s,
@@ -702,13 +1078,13 @@ struct sampler_2d *split_execution_chains_to_cubemap_sampler_tex_chains(struct s
                                                                         float *restrict coord_column_r,
                                                                         float *restrict flat_s_column,
                                                                         float *restrict flat_t_column) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint32_t row = exec_chain;
   struct sampler_2d *samplers = NULL;
 
   /* Split the rows to each sampler, we want to evaluate all rows such that the sampler is held
    * constant. */
-  uint8_t delta;
+  sl_exec_row_t delta;
   do {
     delta = chain_column[row];
 
@@ -802,7 +1178,7 @@ struct sampler_2d *split_execution_chains_to_cubemap_sampler_tex_chains(struct s
     }
 
     if (s2d) {
-      uint8_t *restrict tex_chain_column = s2d->tex_exec_;
+      sl_exec_row_t *restrict tex_chain_column = s2d->tex_exec_;
 
       if (s2d->last_row_ != SL_EXEC_NO_CHAIN) {
         tex_chain_column[s2d->last_row_] = row - s2d->last_row_;
@@ -829,20 +1205,20 @@ struct sampler_2d *split_execution_chains_to_cubemap_sampler_tex_chains(struct s
 }
 
 struct sampler_2d *split_execution_chains_to_sampler_tex_chains(struct sl_execution *exec, int exec_chain, void * restrict * restrict sampler_column) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   uint32_t row = exec_chain;
   struct sampler_2d *samplers = NULL;
 
   /* Split the rows to each sampler, we want to evaluate all rows such that the sampler is held
    * constant. */
-  uint8_t delta;
+  sl_exec_row_t delta;
   do {
     delta = chain_column[row];
 
     struct sampler_2d *s2d = sampler_column[row];
 
     if (s2d) {
-      uint8_t *restrict tex_chain_column = s2d->tex_exec_;
+      sl_exec_row_t *restrict tex_chain_column = s2d->tex_exec_;
 
       if (s2d->last_row_ != SL_EXEC_NO_CHAIN) {
         tex_chain_column[s2d->last_row_] = row - s2d->last_row_;
@@ -887,7 +1263,7 @@ static void texture_2D_lookup_impl(struct sampler_2d *sampler_chain,
     do {
       s2d = s2d->runtime_active_sampler_chain_;
 
-      uint8_t *restrict tex_chain_column = s2d->tex_exec_;
+      sl_exec_row_t *restrict tex_chain_column = s2d->tex_exec_;
 
       /* terminate each sampler's row chain (strictly speaking we could check for arriving at last_row_ but
        * this makes it consistent with the rest of the code. */
@@ -922,9 +1298,8 @@ static void texture_2D_lookup_impl(struct sampler_2d *sampler_chain,
           float l0_width = (float)s2d->mipmaps_[0].width_;
           float l0_height = (float)s2d->mipmaps_[0].height_;
           for (;;) {
-            uint64_t chain;
-            uint8_t delta;
-            if (!(row & 7) && (((chain = *(uint64_t *)(tex_chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+            sl_exec_row_t delta;
+            if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(tex_chain_column, row)) {
               do {
                 const float *restrict r_s = coord_column_s + row;
                 const float *restrict r_t = coord_column_t + row;
@@ -993,23 +1368,15 @@ static void texture_2D_lookup_impl(struct sampler_2d *sampler_chain,
                   log2f(dmax_squared_len_7) * 0.5f
                 };
 
-                int frag_idx;
-                for (frag_idx = 0; frag_idx < (sizeof(l2)/sizeof(*l2)); ++frag_idx) {
-                  float rgba[4];
-                  texture2D(rgba, s2d, r_s[frag_idx], r_t[frag_idx], l2[frag_idx]);
-                  red_column[row + frag_idx] = rgba[0];
-                  green_column[row + frag_idx] = rgba[1];
-                  blue_column[row + frag_idx] = rgba[2];
-                  alpha_column[row + frag_idx] = rgba[3];
-                }
+                texture2D_8(s2d, r_s, r_t, l2, red_column + row, green_column + row, blue_column + row, alpha_column + row);
 
-                delta = (chain & 0xFF00000000000000) >> 56;
+                delta = tex_chain_column[row + 7];
 
                 if (!delta) break;
                 row += 7 + delta;
-              } while (!(row & 7) && (((chain = *(uint64_t *)(tex_chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+              } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(tex_chain_column, row));
             }
-            else if (!(row & 3) && (((chain = *(uint32_t *)(tex_chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+            else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(tex_chain_column, row)) {
               do {
                 const float *restrict r_s = coord_column_s + row;
                 const float *restrict r_t = coord_column_t + row;
@@ -1066,10 +1433,10 @@ static void texture_2D_lookup_impl(struct sampler_2d *sampler_chain,
                   alpha_column[row + frag_idx] = rgba[3];
                 }
 
-                delta = (chain & 0xFF000000) >> 24;
+                delta = tex_chain_column[row + 3];
                 if (!delta) break;
                 row += 3 + delta;
-              } while (!(row & 3) && ((chain = (*(uint32_t *)(tex_chain_column + row)) & 0xFFFFFF) == 0x010101));
+              } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(tex_chain_column, row));
             }
             else {
               do {
@@ -1107,30 +1474,21 @@ static void texture_2D_lookup_impl(struct sampler_2d *sampler_chain,
         else /* if lg2 not needed */ {
           row = s2d->runtime_rows_;
           for (;;) {
-            uint64_t chain;
-            uint8_t delta;
-            if (!(row & 7) && (((chain = *(uint64_t *)(tex_chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+            sl_exec_row_t delta;
+            if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(tex_chain_column, row)) {
               do {
                 const float *restrict r_s = coord_column_s + row;
                 const float *restrict r_t = coord_column_t + row;
 
-                int frag_idx;
-                for (frag_idx = 0; frag_idx < 8; ++frag_idx) {
-                  float rgba[4];
-                  texture2D(rgba, s2d, r_s[frag_idx], r_t[frag_idx], 0.f);
-                  red_column[row + frag_idx] = rgba[0];
-                  green_column[row + frag_idx] = rgba[1];
-                  blue_column[row + frag_idx] = rgba[2];
-                  alpha_column[row + frag_idx] = rgba[3];
-                }
+                texture2D_8(s2d, r_s, r_t, NULL, red_column + row, green_column + row, blue_column + row, alpha_column + row);
 
-                delta = (chain & 0xFF00000000000000) >> 56;
+                delta = tex_chain_column[row + 7];
 
                 if (!delta) break;
                 row += 7 + delta;
-              } while (!(row & 7) && (((chain = *(uint64_t *)(tex_chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+              } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(tex_chain_column, row));
             }
-            else if (!(row & 3) && (((chain = *(uint32_t *)(tex_chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+            else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(tex_chain_column, row)) {
               do {
                 const float *restrict r_s = coord_column_s + row;
                 const float *restrict r_t = coord_column_t + row;
@@ -1145,10 +1503,10 @@ static void texture_2D_lookup_impl(struct sampler_2d *sampler_chain,
                   alpha_column[row + frag_idx] = rgba[3];
                 }
 
-                delta = (chain & 0xFF000000) >> 24;
+                delta = tex_chain_column[row + 3];
                 if (!delta) break;
                 row += 3 + delta;
-              } while (!(row & 3) && ((chain = (*(uint32_t *)(tex_chain_column + row)) & 0xFFFFFF) == 0x010101));
+              } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(tex_chain_column, row));
             }
             else {
               do {
@@ -1180,9 +1538,8 @@ static void texture_2D_lookup_impl(struct sampler_2d *sampler_chain,
         /* Texture is not complete, function must return (0,0,0,1) */
         row = s2d->runtime_rows_;
         for (;;) {
-          uint64_t chain;
-          uint8_t delta;
-          if (!(row & 7) && (((chain = *(uint64_t *)(tex_chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+          sl_exec_row_t delta;
+          if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(tex_chain_column, row)) {
             do {
               int frag_idx;
               for (frag_idx = 0; frag_idx < 8; ++frag_idx) {
@@ -1192,13 +1549,13 @@ static void texture_2D_lookup_impl(struct sampler_2d *sampler_chain,
                 alpha_column[row + frag_idx] = 1.f;
               }
 
-              delta = (chain & 0xFF00000000000000) >> 56;
+              delta = tex_chain_column[row + 7];
 
               if (!delta) break;
               row += 7 + delta;
-            } while (!(row & 7) && (((chain = *(uint64_t *)(tex_chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+            } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(tex_chain_column, row));
           }
-          else if (!(row & 3) && (((chain = *(uint32_t *)(tex_chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+          else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(tex_chain_column, row)) {
             do {
               int frag_idx;
               for (frag_idx = 0; frag_idx < 4; ++frag_idx) {
@@ -1208,10 +1565,10 @@ static void texture_2D_lookup_impl(struct sampler_2d *sampler_chain,
                 alpha_column[row + frag_idx] = 1.f;
               }
 
-              delta = (chain & 0xFF000000) >> 24;
+              delta = tex_chain_column[row + 3];
               if (!delta) break;
               row += 3 + delta;
-            } while (!(row & 3) && ((chain = (*(uint32_t *)(tex_chain_column + row)) & 0xFFFFFF) == 0x010101));
+            } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(tex_chain_column, row));
           }
           else {
             do {
@@ -1251,7 +1608,7 @@ static void texture_2D_bias_lookup_impl(struct sampler_2d *sampler_chain,
     do {
       s2d = s2d->runtime_active_sampler_chain_;
 
-      uint8_t *restrict tex_chain_column = s2d->tex_exec_;
+      sl_exec_row_t *restrict tex_chain_column = s2d->tex_exec_;
 
       /* terminate each sampler's row chain (strictly speaking we could check for arriving at last_row_ but
        * this makes it consistent with the rest of the code. */
@@ -1286,9 +1643,8 @@ static void texture_2D_bias_lookup_impl(struct sampler_2d *sampler_chain,
           float l0_width = (float)s2d->mipmaps_[0].width_;
           float l0_height = (float)s2d->mipmaps_[0].height_;
           for (;;) {
-            uint64_t chain;
-            uint8_t delta;
-            if (!(row & 7) && (((chain = *(uint64_t *)(tex_chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+            sl_exec_row_t delta;
+            if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(tex_chain_column, row)) {
               do {
                 const float *restrict r_s = coord_column_s + row;
                 const float *restrict r_t = coord_column_t + row;
@@ -1358,23 +1714,15 @@ static void texture_2D_bias_lookup_impl(struct sampler_2d *sampler_chain,
                   log2f(dmax_squared_len_7) * 0.5f + r_bias[7]
                 };
 
-                int frag_idx;
-                for (frag_idx = 0; frag_idx < (sizeof(l2)/sizeof(*l2)); ++frag_idx) {
-                  float rgba[4];
-                  texture2D(rgba, s2d, r_s[frag_idx], r_t[frag_idx], l2[frag_idx]);
-                  red_column[row + frag_idx] = rgba[0];
-                  green_column[row + frag_idx] = rgba[1];
-                  blue_column[row + frag_idx] = rgba[2];
-                  alpha_column[row + frag_idx] = rgba[3];
-                }
+                texture2D_8(s2d, r_s, r_t, l2, red_column + row, green_column + row, blue_column + row, alpha_column + row);
 
-                delta = (chain & 0xFF00000000000000) >> 56;
+                delta = tex_chain_column[row + 7];
 
                 if (!delta) break;
                 row += 7 + delta;
-              } while (!(row & 7) && (((chain = *(uint64_t *)(tex_chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+              } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(tex_chain_column, row));
             }
-            else if (!(row & 3) && (((chain = *(uint32_t *)(tex_chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+            else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(tex_chain_column, row)) {
               do {
                 const float *restrict r_s = coord_column_s + row;
                 const float *restrict r_t = coord_column_t + row;
@@ -1432,10 +1780,10 @@ static void texture_2D_bias_lookup_impl(struct sampler_2d *sampler_chain,
                   alpha_column[row + frag_idx] = rgba[3];
                 }
 
-                delta = (chain & 0xFF000000) >> 24;
+                delta = tex_chain_column[row + 3];
                 if (!delta) break;
                 row += 3 + delta;
-              } while (!(row & 3) && ((chain = (*(uint32_t *)(tex_chain_column + row)) & 0xFFFFFF) == 0x010101));
+              } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(tex_chain_column, row));
             }
             else {
               do {
@@ -1474,30 +1822,21 @@ static void texture_2D_bias_lookup_impl(struct sampler_2d *sampler_chain,
         else /* if lg2 not needed */ {
           row = s2d->runtime_rows_;
           for (;;) {
-            uint64_t chain;
-            uint8_t delta;
-            if (!(row & 7) && (((chain = *(uint64_t *)(tex_chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+            sl_exec_row_t delta;
+            if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(tex_chain_column, row)) {
               do {
                 const float *restrict r_s = coord_column_s + row;
                 const float *restrict r_t = coord_column_t + row;
 
-                int frag_idx;
-                for (frag_idx = 0; frag_idx < 8; ++frag_idx) {
-                  float rgba[4];
-                  texture2D(rgba, s2d, r_s[frag_idx], r_t[frag_idx], 0.f);
-                  red_column[row + frag_idx] = rgba[0];
-                  green_column[row + frag_idx] = rgba[1];
-                  blue_column[row + frag_idx] = rgba[2];
-                  alpha_column[row + frag_idx] = rgba[3];
-                }
+                texture2D_8(s2d, r_s, r_t, NULL, red_column + row, green_column + row, blue_column + row, alpha_column + row);
 
-                delta = (chain & 0xFF00000000000000) >> 56;
+                delta = tex_chain_column[row + 7];
 
                 if (!delta) break;
                 row += 7 + delta;
-              } while (!(row & 7) && (((chain = *(uint64_t *)(tex_chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+              } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(tex_chain_column, row));
             }
-            else if (!(row & 3) && (((chain = *(uint32_t *)(tex_chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+            else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(tex_chain_column, row)) {
               do {
                 const float *restrict r_s = coord_column_s + row;
                 const float *restrict r_t = coord_column_t + row;
@@ -1512,10 +1851,10 @@ static void texture_2D_bias_lookup_impl(struct sampler_2d *sampler_chain,
                   alpha_column[row + frag_idx] = rgba[3];
                 }
 
-                delta = (chain & 0xFF000000) >> 24;
+                delta = tex_chain_column[row + 3];
                 if (!delta) break;
                 row += 3 + delta;
-              } while (!(row & 3) && ((chain = (*(uint32_t *)(tex_chain_column + row)) & 0xFFFFFF) == 0x010101));
+              } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(tex_chain_column, row));
             }
             else {
               do {
@@ -1547,9 +1886,8 @@ static void texture_2D_bias_lookup_impl(struct sampler_2d *sampler_chain,
         /* Texture is not complete, function must return (0,0,0,1) */
         row = s2d->runtime_rows_;
         for (;;) {
-          uint64_t chain;
-          uint8_t delta;
-          if (!(row & 7) && (((chain = *(uint64_t *)(tex_chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+          sl_exec_row_t delta;
+          if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(tex_chain_column, row)) {
             do {
               int frag_idx;
               for (frag_idx = 0; frag_idx < 8; ++frag_idx) {
@@ -1559,13 +1897,13 @@ static void texture_2D_bias_lookup_impl(struct sampler_2d *sampler_chain,
                 alpha_column[row + frag_idx] = 1.f;
               }
 
-              delta = (chain & 0xFF00000000000000) >> 56;
+              delta = tex_chain_column[row + 7];
 
               if (!delta) break;
               row += 7 + delta;
-            } while (!(row & 7) && (((chain = *(uint64_t *)(tex_chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+            } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(tex_chain_column, row));
           }
-          else if (!(row & 3) && (((chain = *(uint32_t *)(tex_chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+          else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(tex_chain_column, row)) {
             do {
               int frag_idx;
               for (frag_idx = 0; frag_idx < 4; ++frag_idx) {
@@ -1575,10 +1913,10 @@ static void texture_2D_bias_lookup_impl(struct sampler_2d *sampler_chain,
                 alpha_column[row + frag_idx] = 1.f;
               }
 
-              delta = (chain & 0xFF000000) >> 24;
+              delta = tex_chain_column[row + 3];
               if (!delta) break;
               row += 3 + delta;
-            } while (!(row & 3) && ((chain = (*(uint32_t *)(tex_chain_column + row)) & 0xFFFFFF) == 0x010101));
+            } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(tex_chain_column, row));
           }
           else {
             do {
@@ -1617,7 +1955,7 @@ static void texture_2D_lod_lookup_impl(struct sampler_2d *sampler_chain,
     do {
       s2d = s2d->runtime_active_sampler_chain_;
 
-      uint8_t *restrict tex_chain_column = s2d->tex_exec_;
+      sl_exec_row_t *restrict tex_chain_column = s2d->tex_exec_;
 
       /* terminate each sampler's row chain (strictly speaking we could check for arriving at last_row_ but
        * this makes it consistent with the rest of the code. */
@@ -1652,31 +1990,22 @@ static void texture_2D_lod_lookup_impl(struct sampler_2d *sampler_chain,
           float l0_width = (float)s2d->mipmaps_[0].width_;
           float l0_height = (float)s2d->mipmaps_[0].height_;
           for (;;) {
-            uint64_t chain;
-            uint8_t delta;
-            if (!(row & 7) && (((chain = *(uint64_t *)(tex_chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+            sl_exec_row_t delta;
+            if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(tex_chain_column, row)) {
               do {
                 const float *restrict r_s = coord_column_s + row;
                 const float *restrict r_t = coord_column_t + row;
                 const float *restrict r_lod = lod_column + row;
 
-                int frag_idx;
-                for (frag_idx = 0; frag_idx < 8; ++frag_idx) {
-                  float rgba[4];
-                  texture2D(rgba, s2d, r_s[frag_idx], r_t[frag_idx], r_lod[frag_idx]);
-                  red_column[row + frag_idx] = rgba[0];
-                  green_column[row + frag_idx] = rgba[1];
-                  blue_column[row + frag_idx] = rgba[2];
-                  alpha_column[row + frag_idx] = rgba[3];
-                }
+                texture2D_8(s2d, r_s, r_t, r_lod, red_column + row, green_column + row, blue_column + row, alpha_column + row);
 
-                delta = (chain & 0xFF00000000000000) >> 56;
+                delta = tex_chain_column[row + 7];
 
                 if (!delta) break;
                 row += 7 + delta;
-              } while (!(row & 7) && (((chain = *(uint64_t *)(tex_chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+              } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(tex_chain_column, row));
             }
-            else if (!(row & 3) && (((chain = *(uint32_t *)(tex_chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+            else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(tex_chain_column, row)) {
               do {
                 const float *restrict r_s = coord_column_s + row;
                 const float *restrict r_t = coord_column_t + row;
@@ -1692,10 +2021,10 @@ static void texture_2D_lod_lookup_impl(struct sampler_2d *sampler_chain,
                   alpha_column[row + frag_idx] = rgba[3];
                 }
 
-                delta = (chain & 0xFF000000) >> 24;
+                delta = tex_chain_column[row + 3];
                 if (!delta) break;
                 row += 3 + delta;
-              } while (!(row & 3) && ((chain = (*(uint32_t *)(tex_chain_column + row)) & 0xFFFFFF) == 0x010101));
+              } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(tex_chain_column, row));
             }
             else {
               do {
@@ -1721,30 +2050,21 @@ static void texture_2D_lod_lookup_impl(struct sampler_2d *sampler_chain,
         else /* if lg2 not needed */ {
           row = s2d->runtime_rows_;
           for (;;) {
-            uint64_t chain;
-            uint8_t delta;
-            if (!(row & 7) && (((chain = *(uint64_t *)(tex_chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+            sl_exec_row_t delta;
+            if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(tex_chain_column, row)) {
               do {
                 const float *restrict r_s = coord_column_s + row;
                 const float *restrict r_t = coord_column_t + row;
 
-                int frag_idx;
-                for (frag_idx = 0; frag_idx < 8; ++frag_idx) {
-                  float rgba[4];
-                  texture2D(rgba, s2d, r_s[frag_idx], r_t[frag_idx], 0.f);
-                  red_column[row + frag_idx] = rgba[0];
-                  green_column[row + frag_idx] = rgba[1];
-                  blue_column[row + frag_idx] = rgba[2];
-                  alpha_column[row + frag_idx] = rgba[3];
-                }
+                texture2D_8(s2d, r_s, r_t, NULL, red_column + row, green_column + row, blue_column + row, alpha_column + row);
 
-                delta = (chain & 0xFF00000000000000) >> 56;
+                delta = tex_chain_column[row + 7];
 
                 if (!delta) break;
                 row += 7 + delta;
-              } while (!(row & 7) && (((chain = *(uint64_t *)(tex_chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+              } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(tex_chain_column, row));
             }
-            else if (!(row & 3) && (((chain = *(uint32_t *)(tex_chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+            else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(tex_chain_column, row)) {
               do {
                 const float *restrict r_s = coord_column_s + row;
                 const float *restrict r_t = coord_column_t + row;
@@ -1759,10 +2079,10 @@ static void texture_2D_lod_lookup_impl(struct sampler_2d *sampler_chain,
                   alpha_column[row + frag_idx] = rgba[3];
                 }
 
-                delta = (chain & 0xFF000000) >> 24;
+                delta = tex_chain_column[row + 3];
                 if (!delta) break;
                 row += 3 + delta;
-              } while (!(row & 3) && ((chain = (*(uint32_t *)(tex_chain_column + row)) & 0xFFFFFF) == 0x010101));
+              } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(tex_chain_column, row));
             }
             else {
               do {
@@ -1794,9 +2114,8 @@ static void texture_2D_lod_lookup_impl(struct sampler_2d *sampler_chain,
         /* Texture is not complete, function must return (0,0,0,1) */
         row = s2d->runtime_rows_;
         for (;;) {
-          uint64_t chain;
-          uint8_t delta;
-          if (!(row & 7) && (((chain = *(uint64_t *)(tex_chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+          sl_exec_row_t delta;
+          if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(tex_chain_column, row)) {
             do {
               int frag_idx;
               for (frag_idx = 0; frag_idx < 8; ++frag_idx) {
@@ -1806,13 +2125,13 @@ static void texture_2D_lod_lookup_impl(struct sampler_2d *sampler_chain,
                 alpha_column[row + frag_idx] = 1.f;
               }
 
-              delta = (chain & 0xFF00000000000000) >> 56;
+              delta = tex_chain_column[row + 7];
 
               if (!delta) break;
               row += 7 + delta;
-            } while (!(row & 7) && (((chain = *(uint64_t *)(tex_chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+            } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(tex_chain_column, row));
           }
-          else if (!(row & 3) && (((chain = *(uint32_t *)(tex_chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+          else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(tex_chain_column, row)) {
             do {
               int frag_idx;
               for (frag_idx = 0; frag_idx < 4; ++frag_idx) {
@@ -1822,10 +2141,10 @@ static void texture_2D_lod_lookup_impl(struct sampler_2d *sampler_chain,
                 alpha_column[row + frag_idx] = 1.f;
               }
 
-              delta = (chain & 0xFF000000) >> 24;
+              delta = tex_chain_column[row + 3];
               if (!delta) break;
               row += 3 + delta;
-            } while (!(row & 3) && ((chain = (*(uint32_t *)(tex_chain_column + row)) & 0xFFFFFF) == 0x010101));
+            } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(tex_chain_column, row));
           }
           else {
             do {
@@ -1855,7 +2174,7 @@ static void texture_2D_lod_lookup_impl(struct sampler_2d *sampler_chain,
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void builtin_texture2D_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict red_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict green_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict blue_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 2);
@@ -1870,7 +2189,7 @@ void builtin_texture2D_runtime(struct sl_execution *exec, int exec_chain, struct
 }
 
 void builtin_texture2D_bias_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict red_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict green_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict blue_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 2);
@@ -1886,7 +2205,7 @@ void builtin_texture2D_bias_runtime(struct sl_execution *exec, int exec_chain, s
 }
 
 void builtin_texture2DProj_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict red_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict green_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict blue_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 2);
@@ -1899,9 +2218,8 @@ void builtin_texture2DProj_v3_runtime(struct sl_execution *exec, int exec_chain,
 
   uint32_t row = exec_chain;
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    sl_exec_row_t delta;
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         int frag_idx;
         for (frag_idx = 0; frag_idx < 8; ++frag_idx) {
@@ -1909,13 +2227,13 @@ void builtin_texture2DProj_v3_runtime(struct sl_execution *exec, int exec_chain,
           projected_t[row + frag_idx] = coord_column_t[row + frag_idx] / proj_column[row + frag_idx];
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
 
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         int frag_idx;
         for (frag_idx = 0; frag_idx < 4; ++frag_idx) {
@@ -1923,10 +2241,10 @@ void builtin_texture2DProj_v3_runtime(struct sl_execution *exec, int exec_chain,
           projected_t[row + frag_idx] = coord_column_t[row + frag_idx] / proj_column[row + frag_idx];
         }
 
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && ((chain = (*(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -1949,7 +2267,7 @@ void builtin_texture2DProj_v3_runtime(struct sl_execution *exec, int exec_chain,
 }
 
 void builtin_texture2DProj_v3_bias_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict red_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict green_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict blue_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 2);
@@ -1963,9 +2281,8 @@ void builtin_texture2DProj_v3_bias_runtime(struct sl_execution *exec, int exec_c
 
   uint32_t row = exec_chain;
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    sl_exec_row_t delta;
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         int frag_idx;
         for (frag_idx = 0; frag_idx < 8; ++frag_idx) {
@@ -1973,13 +2290,13 @@ void builtin_texture2DProj_v3_bias_runtime(struct sl_execution *exec, int exec_c
           projected_t[row + frag_idx] = coord_column_t[row + frag_idx] / proj_column[row + frag_idx];
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
 
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         int frag_idx;
         for (frag_idx = 0; frag_idx < 4; ++frag_idx) {
@@ -1987,10 +2304,10 @@ void builtin_texture2DProj_v3_bias_runtime(struct sl_execution *exec, int exec_c
           projected_t[row + frag_idx] = coord_column_t[row + frag_idx] / proj_column[row + frag_idx];
         }
 
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && ((chain = (*(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -2013,7 +2330,7 @@ void builtin_texture2DProj_v3_bias_runtime(struct sl_execution *exec, int exec_c
 }
 
 void builtin_texture2DProj_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict red_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict green_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict blue_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 2);
@@ -2026,9 +2343,8 @@ void builtin_texture2DProj_v4_runtime(struct sl_execution *exec, int exec_chain,
 
   uint32_t row = exec_chain;
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    sl_exec_row_t delta;
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         int frag_idx;
         for (frag_idx = 0; frag_idx < 8; ++frag_idx) {
@@ -2036,13 +2352,13 @@ void builtin_texture2DProj_v4_runtime(struct sl_execution *exec, int exec_chain,
           projected_t[row + frag_idx] = coord_column_t[row + frag_idx] / proj_column[row + frag_idx];
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
 
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         int frag_idx;
         for (frag_idx = 0; frag_idx < 4; ++frag_idx) {
@@ -2050,10 +2366,10 @@ void builtin_texture2DProj_v4_runtime(struct sl_execution *exec, int exec_chain,
           projected_t[row + frag_idx] = coord_column_t[row + frag_idx] / proj_column[row + frag_idx];
         }
 
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && ((chain = (*(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -2076,7 +2392,7 @@ void builtin_texture2DProj_v4_runtime(struct sl_execution *exec, int exec_chain,
 }
 
 void builtin_texture2DProj_v4_bias_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict red_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict green_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict blue_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 2);
@@ -2090,9 +2406,8 @@ void builtin_texture2DProj_v4_bias_runtime(struct sl_execution *exec, int exec_c
 
   uint32_t row = exec_chain;
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    sl_exec_row_t delta;
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         int frag_idx;
         for (frag_idx = 0; frag_idx < 8; ++frag_idx) {
@@ -2100,13 +2415,13 @@ void builtin_texture2DProj_v4_bias_runtime(struct sl_execution *exec, int exec_c
           projected_t[row + frag_idx] = coord_column_t[row + frag_idx] / proj_column[row + frag_idx];
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
 
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         int frag_idx;
         for (frag_idx = 0; frag_idx < 4; ++frag_idx) {
@@ -2114,10 +2429,10 @@ void builtin_texture2DProj_v4_bias_runtime(struct sl_execution *exec, int exec_c
           projected_t[row + frag_idx] = coord_column_t[row + frag_idx] / proj_column[row + frag_idx];
         }
 
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && ((chain = (*(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -2140,7 +2455,7 @@ void builtin_texture2DProj_v4_bias_runtime(struct sl_execution *exec, int exec_c
 }
 
 void builtin_texture2DLod_v2_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict red_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict green_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict blue_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 2);
@@ -2156,7 +2471,7 @@ void builtin_texture2DLod_v2_runtime(struct sl_execution *exec, int exec_chain,
 }
 
 void builtin_texture2DProjLod_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict red_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict green_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict blue_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 2);
@@ -2170,9 +2485,8 @@ void builtin_texture2DProjLod_v3_runtime(struct sl_execution *exec, int exec_cha
 
   uint32_t row = exec_chain;
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    sl_exec_row_t delta;
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         int frag_idx;
         for (frag_idx = 0; frag_idx < 8; ++frag_idx) {
@@ -2180,13 +2494,13 @@ void builtin_texture2DProjLod_v3_runtime(struct sl_execution *exec, int exec_cha
           projected_t[row + frag_idx] = coord_column_t[row + frag_idx] / proj_column[row + frag_idx];
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
 
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         int frag_idx;
         for (frag_idx = 0; frag_idx < 4; ++frag_idx) {
@@ -2194,10 +2508,10 @@ void builtin_texture2DProjLod_v3_runtime(struct sl_execution *exec, int exec_cha
           projected_t[row + frag_idx] = coord_column_t[row + frag_idx] / proj_column[row + frag_idx];
         }
 
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && ((chain = (*(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -2220,7 +2534,7 @@ void builtin_texture2DProjLod_v3_runtime(struct sl_execution *exec, int exec_cha
 }
 
 void builtin_texture2DProjLod_v4_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict red_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict green_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict blue_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 2);
@@ -2234,9 +2548,8 @@ void builtin_texture2DProjLod_v4_runtime(struct sl_execution *exec, int exec_cha
 
   uint32_t row = exec_chain;
   for (;;) {
-    uint64_t chain;
-    uint8_t delta;
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    sl_exec_row_t delta;
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         int frag_idx;
         for (frag_idx = 0; frag_idx < 8; ++frag_idx) {
@@ -2244,13 +2557,13 @@ void builtin_texture2DProjLod_v4_runtime(struct sl_execution *exec, int exec_cha
           projected_t[row + frag_idx] = coord_column_t[row + frag_idx] / proj_column[row + frag_idx];
         }
 
-        delta = (chain & 0xFF00000000000000) >> 56;
+        delta = chain_column[row + 7];
 
         if (!delta) break;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         int frag_idx;
         for (frag_idx = 0; frag_idx < 4; ++frag_idx) {
@@ -2258,10 +2571,10 @@ void builtin_texture2DProjLod_v4_runtime(struct sl_execution *exec, int exec_cha
           projected_t[row + frag_idx] = coord_column_t[row + frag_idx] / proj_column[row + frag_idx];
         }
 
-        delta = (chain & 0xFF000000) >> 24;
+        delta = chain_column[row + 3];
         if (!delta) break;
         row += 3 + delta;
-      } while (!(row & 3) && ((chain = (*(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -2285,7 +2598,7 @@ void builtin_texture2DProjLod_v4_runtime(struct sl_execution *exec, int exec_cha
 
 
 void builtin_textureCube_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict red_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict green_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict blue_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 2);
@@ -2306,7 +2619,7 @@ void builtin_textureCube_v3_runtime(struct sl_execution *exec, int exec_chain, s
 }
 
 void builtin_textureCube_v3_bias_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict red_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict green_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict blue_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 2);
@@ -2328,7 +2641,7 @@ void builtin_textureCube_v3_bias_runtime(struct sl_execution *exec, int exec_cha
 }
 
 void builtin_textureCubeLod_v3_runtime(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
-  uint8_t *restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
   float *restrict red_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 0);
   float *restrict green_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 1);
   float *restrict blue_column = FLOAT_REG_PTR_NRV(&x->base_regs_, 2);
@@ -100,7 +100,7 @@ struct sampler_2d {
   uint32_t runtime_rows_;
   uint32_t last_row_;
 
-  uint8_t tex_exec_[SL_EXEC_CHAIN_MAX_NUM_ROWS];
+  sl_exec_row_t tex_exec_[SL_EXEC_CHAIN_MAX_NUM_ROWS];
 };
 
 void sampler_2d_init(struct sampler_2d *s2d);
@@ -0,0 +1,474 @@
+/* Copyright 2024 Kinglet B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STDINT_H_INCLUDED
+#define STDINT_H_INCLUDED
+#include <stdint.h>
+#endif
+
+#ifndef STDIO_H_INCLUDED
+#define STDIO_H_INCLUDED
+#include <stdio.h>
+#endif
+
+#ifndef STDLIB_H_INCLUDED
+#define STDLIB_H_INCLUDED
+#include <stdlib.h>
+#endif
+
+#ifndef STRING_H_INCLUDED
+#define STRING_H_INCLUDED
+#include <string.h>
+#endif
+
+#ifdef _WIN32
+#ifndef WINDOWS_H_INCLUDED
+#define WINDOWS_H_INCLUDED
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#endif
+#else
+#ifndef DLFCN_H_INCLUDED
+#define DLFCN_H_INCLUDED
+#include <dlfcn.h>
+#endif
+#ifndef PTHREAD_H_INCLUDED
+#define PTHREAD_H_INCLUDED
+#include <pthread.h>
+#endif
+#endif
+
+#ifndef SOURCE_GEN_H_INCLUDED
+#define SOURCE_GEN_H_INCLUDED
+#include "source_gen.h"
+#endif
+
+#ifndef IR_H_INCLUDED
+#define IR_H_INCLUDED
+#include "ir.h"
+#endif
+
+#ifndef SL_IR_H_INCLUDED
+#define SL_IR_H_INCLUDED
+#include "sl_ir.h"
+#endif
+
+#ifndef SL_EXECUTION_H_INCLUDED
+#define SL_EXECUTION_H_INCLUDED
+#include "sl_execution.h"
+#endif
+
+#ifndef SL_BYTECODE_H_INCLUDED
+#define SL_BYTECODE_H_INCLUDED
+#include "sl_bytecode.h"
+#endif
+
+#ifndef SL_AOT_H_INCLUDED
+#define SL_AOT_H_INCLUDED
+#include "sl_aot.h"
+#endif
+
+#ifdef _WIN32
+#define SL_AOT_PATH_SEPARATOR ';'
+#else
+#define SL_AOT_PATH_SEPARATOR ':'
+#endif
+
+/* Modules loaded from AEX_SL_AOT_MODULES, loaded once for the lifetime of the process */
+static size_t g_sl_aot_num_modules_ = 0;
+static void **g_sl_aot_modules_ = NULL;
+
+/* sl_aot_host::kernels_, filled in along with loading the modules */
+static sl_bytecode_kernel_fn_t g_sl_aot_kernels_[SLBC_COMPACT + 1];
+
+/* Inline binary operators in the generated code, with the C operator */
+static const struct sl_aot_binop {
+  int instruction_code_;
+  const char *fn_;
+  const char *type_;
+  const char *regs_;
+  const char *op_;
+} sl_aot_binops_[] = {
+  { SLIR_ADD_F, "aot_f_add", "float", "float_regs", "+" },
+  { SLIR_SUB_F, "aot_f_sub", "float", "float_regs", "-" },
+  { SLIR_MUL_F, "aot_f_mul", "float", "float_regs", "*" },
+  { SLIR_DIV_F, "aot_f_div", "float", "float_regs", "/" },
+  { SLIR_ADD_I, "aot_i_add", "aex_sl_int_t", "int_regs", "+" },
+  { SLIR_SUB_I, "aot_i_sub", "aex_sl_int_t", "int_regs", "-" },
+  { SLIR_MUL_I, "aot_i_mul", "aex_sl_int_t", "int_regs", "*" }
+};
+
+static const struct sl_aot_binop *sl_aot_find_binop(int instruction_code) {
+  size_t n;
+  for (n = 0; n < sizeof(sl_aot_binops_) / sizeof(*sl_aot_binops_); ++n) {
+    if (sl_aot_binops_[n].instruction_code_ == instruction_code) return sl_aot_binops_ + n;
+  }
+  return NULL;
+}
+
+uint64_t sl_aot_code_checksum(const struct sl_bytecode *bc) {
+  /* FNV-1a over the code */
+  uint64_t h = 0xcbf29ce484222325ULL;
+  size_t n;
+  for (n = 0; n < bc->num_code_; ++n) {
+    uint32_t v = (uint32_t)bc->code_[n];
+    int k;
+    for (k = 0; k < 4; ++k) {
+      h ^= (v >> (k * 8)) & 0xFF;
+      h *= 0x100000001b3ULL;
+    }
+  }
+  return h;
+}
+
+static void sl_aot_emit_preamble(struct source_gen *sg, const uint8_t *binops_used) {
+  size_t n;
+  sg_printf(sg, "#include <stdint.h>\n");
+  sg_printf(sg, "#include <stddef.h>\n");
+  sg_printf(sg, "#include <string.h>\n");
+  sg_printf(sg, "\n");
+  sg_printf(sg, "#ifdef _WIN32\n");
+  sg_printf(sg, "#define AEX_SL_AOT_EXPORT __declspec(dllexport)\n");
+  sg_printf(sg, "#else\n");
+  sg_printf(sg, "#define AEX_SL_AOT_EXPORT __attribute__((visibility(\"default\")))\n");
+  sg_printf(sg, "#endif\n");
+  sg_printf(sg, "\n");
+  sg_printf(sg, "/* Must match sl_aot.h for SL_AOT_ABI_VERSION %d */\n", SL_AOT_ABI_VERSION);
+  sg_printf(sg, "typedef uint%d_t aex_sl_row_t;\n", (int)(sizeof(sl_exec_row_t) * 8));
+  sg_printf(sg, "typedef int%d_t aex_sl_int_t;\n", SL_EXEC_INT_REG_BITS);
+  sg_printf(sg, "\n");
+  sg_printf(sg, "struct sl_aot_host {\n");
+  sg_printf(sg, "void (*exec_instr_)(void *bc, void *exec, size_t pc, uint32_t row);\n");
+  sg_printf(sg, "void (*const *kernels_)(void);\n");
+  sg_printf(sg, "};\n");
+  sg_printf(sg, "\n");
+  sg_printf(sg, "struct sl_aot_shader {\n");
+  sg_printf(sg, "int abi_version_;\n");
+  sg_printf(sg, "uint64_t hash_;\n");
+  sg_printf(sg, "size_t num_code_;\n");
+  sg_printf(sg, "uint64_t code_checksum_;\n");
+  sg_printf(sg, "int max_num_rows_;\n");
+  sg_printf(sg, "int int_reg_bits_;\n");
+  sg_printf(sg, "void (*run_)(const struct sl_aot_host *host, void *bc, void *exec, uint32_t *chains, aex_sl_row_t *chain_column, float **float_regs, aex_sl_int_t **int_regs, unsigned char **bool_regs);\n");
+  sg_printf(sg, "};\n");
+
+  for (n = 0; n < sizeof(sl_aot_binops_) / sizeof(*sl_aot_binops_); ++n) {
+    const struct sl_aot_binop *b = sl_aot_binops_ + n;
+    if (!binops_used[n]) continue;
+    /* Same structure as sl_binop_snippet_inc.h; results go through a temporary so the 8 row case vectorizes
+     * even when the result aliases an operand. */
+    sg_printf(sg, "\n");
+    sg_printf(sg, "static void %s(aex_sl_row_t row, const aex_sl_row_t *chain_column, %s *result, const %s *left, const %s *right) {\n", b->fn_, b->type_, b->type_, b->type_);
+    sg_printf(sg, "for (;;) {\n");
+    sg_printf(sg, "aex_sl_row_t delta;\n");
+    if (sizeof(sl_exec_row_t) == 1) {
+      sg_printf(sg, "uint64_t chain;\n");
+      sg_printf(sg, "if (!(row & 7) && (memcpy(&chain, chain_column + row, sizeof(chain)), ((chain & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101ULL))) {\n");
+    }
+    else {
+      sg_printf(sg, "uint64_t chain[2];\n");
+      sg_printf(sg, "if (!(row & 7) && (memcpy(chain, chain_column + row, sizeof(chain)), ((chain[0] == 0x0001000100010001ULL) && ((chain[1] & 0xFFFFFFFFFFFFULL) == 0x000100010001ULL)))) {\n");
+    }
+    sg_printf(sg, "%s t[8];\n", b->type_);
+    sg_printf(sg, "int n;\n");
+    sg_printf(sg, "for (n = 0; n < 8; n++) t[n] = left[row + n] %s right[row + n];\n", b->op_);
+    sg_printf(sg, "for (n = 0; n < 8; n++) result[row + n] = t[n];\n");
+    sg_printf(sg, "delta = chain_column[row + 7];\n");
+    sg_printf(sg, "if (!delta) break;\n");
+    sg_printf(sg, "row += 7 + delta;\n");
+    sg_printf(sg, "}\n");
+    sg_printf(sg, "else {\n");
+    sg_printf(sg, "result[row] = left[row] %s right[row];\n", b->op_);
+    sg_printf(sg, "delta = chain_column[row];\n");
+    sg_printf(sg, "if (!delta) break;\n");
+    sg_printf(sg, "row += delta;\n");
+    sg_printf(sg, "}\n");
+    sg_printf(sg, "}\n");
+    sg_printf(sg, "}\n");
+  }
+}
+
+/* Emits the call through host->kernels_ of the kernel instruction instr, see sl_bytecode_direct_kernel() for banks */
+static void sl_aot_emit_kernel_call(struct source_gen *sg, const int *instr, const char *banks) {
+  static const char *regs[] = { "float_regs", "int_regs", "bool_regs" };
+  static const char *types[] = { "float", "aex_sl_int_t", "unsigned char" };
+  const int *args = instr + 2;
+  size_t n;
+  sg_printf(sg, "if (chains[%d] != 0xFFFFFFFFu) ((void (*)(aex_sl_row_t, aex_sl_row_t *", args[0]);
+  for (n = 0; banks[n]; ++n) {
+    int bank = (banks[n] == 'i') ? 1 : ((banks[n] == 'b') ? 2 : 0);
+    sg_printf(sg, ", %s%s *", n ? "const " : "", types[bank]);
+  }
+  sg_printf(sg, "))host->kernels_[%d])((aex_sl_row_t)chains[%d], chain_column", instr[0], args[0]);
+  for (n = 0; banks[n]; ++n) {
+    int bank = (banks[n] == 'i') ? 1 : ((banks[n] == 'b') ? 2 : 0);
+    if (banks[n] == '0') sg_printf(sg, ", NULL");
+    else sg_printf(sg, ", %s[%d]", regs[bank], args[1 + n]);
+  }
+  sg_printf(sg, ");\n");
+}
+
+int sl_aot_emit_c(FILE *fp, const struct sl_bytecode *bc, uint64_t hash) {
+  struct source_gen sg;
+  uint8_t binops_used[sizeof(sl_aot_binops_) / sizeof(*sl_aot_binops_)] = { 0 };
+  uint8_t *is_target;
+  size_t pc;
+  int r;
+
+  if (!bc->code_ || !bc->num_code_) return -1;
+
+  /* Find all branch targets, so we only emit the labels we need. */
+  is_target = (uint8_t *)calloc(bc->num_code_ + 1, 1);
+  if (!is_target) return -1;
+  for (pc = 0; pc < bc->num_code_; pc += 2 + (size_t)bc->code_[pc + 1]) {
+    const int *instr = bc->code_ + pc;
+    const struct sl_aot_binop *b;
+    if (instr[0] == GIR_JUMP) {
+      is_target[instr[2]] = 1;
+    }
+    else if (instr[0] == GIR_BRANCH_NOT_EQUAL) {
+      is_target[instr[4]] = 1;
+      is_target[instr[5]] = 1;
+    }
+    else if (NULL != (b = sl_aot_find_binop(instr[0]))) {
+      binops_used[b - sl_aot_binops_] = 1;
+    }
+  }
+
+  sg_init(&sg);
+  sg.fp_ = fp;
+
+  sg_printf(&sg, "/* Generated by Aex-GL for shader %016llx; do not edit. */\n", (unsigned long long)hash);
+  sl_aot_emit_preamble(&sg, binops_used);
+
+  sg_printf(&sg, "\n");
+  sg_printf(&sg, "static void aex_sl_aot_run_%016llx(const struct sl_aot_host *host, void *bc, void *exec, uint32_t *chains, aex_sl_row_t *chain_column, float **float_regs, aex_sl_int_t **int_regs, unsigned char **bool_regs) {\n", (unsigned long long)hash);
+  for (pc = 0; pc < bc->num_code_; pc += 2 + (size_t)bc->code_[pc + 1]) {
+    const int *instr = bc->code_ + pc;
+    const int *args = instr + 2;
+    const struct sl_aot_binop *b;
+    const char *banks;
+    if (is_target[pc]) {
+      sg_printf(&sg, "L%zu:;\n", pc);
+    }
+    switch (instr[0]) {
+      case GIR_MOVE:
+        if (args[1] >= 0) {
+          sg_printf(&sg, "chains[%d] = chains[%d];\n", args[0], args[1]);
+        }
+        else {
+          sg_printf(&sg, "chains[%d] = 0x%08Xu;\n", args[0], (uint32_t)args[2]);
+        }
+        break;
+      case GIR_JUMP:
+        sg_printf(&sg, "goto L%d;\n", args[0]);
+        break;
+      case GIR_BRANCH_NOT_EQUAL:
+        sg_printf(&sg, "if (chains[%d] != 0x%08Xu) goto L%d;\n", args[0], (uint32_t)args[1], args[2]);
+        sg_printf(&sg, "goto L%d;\n", args[3]);
+        break;
+      case GIR_RETURN:
+        sg_printf(&sg, "return;\n");
+        break;
+      case SLIR_SPLIT_EXEC_CHAIN_BY_CONDITION:
+      case SLIR_SPLIT_EXEC_CHAIN_BY_UNIFORM_CONDITION:
+      case SLIR_JOIN_EXEC_CHAINS:
+        sg_printf(&sg, "host->exec_instr_(bc, exec, %zu, 0);\n", pc);
+        break;
+      case SLBC_COMPACT:
+        /* The kernels that follow run as they are */
+        break;
+      default:
+        if (NULL != (b = sl_aot_find_binop(instr[0]))) {
+          sg_printf(&sg, "if (chains[%d] != 0xFFFFFFFFu) %s((aex_sl_row_t)chains[%d], chain_column, %s[%d], %s[%d], %s[%d]);\n",
+                    args[0], b->fn_, args[0], b->regs_, args[1], b->regs_, args[2], b->regs_, args[3]);
+        }
+        else if (sl_bytecode_direct_kernel(instr[0], &banks)) {
+          sl_aot_emit_kernel_call(&sg, instr, banks);
+        }
+        else {
+          sg_printf(&sg, "if (chains[%d] != 0xFFFFFFFFu) host->exec_instr_(bc, exec, %zu, chains[%d]);\n", args[0], pc, args[0]);
+        }
+        break;
+    }
+  }
+  sg_printf(&sg, "}\n");
+
+  sg_printf(&sg, "\n");
+  sg_printf(&sg, "AEX_SL_AOT_EXPORT const struct sl_aot_shader aex_sl_aot_%016llx = {\n", (unsigned long long)hash);
+  sg_printf(&sg, "%d, 0x%016llxULL, %zu, 0x%016llxULL, %d, %d, aex_sl_aot_run_%016llx\n",
+            SL_AOT_ABI_VERSION, (unsigned long long)hash, bc->num_code_, (unsigned long long)sl_aot_code_checksum(bc),
+            SL_EXEC_CHAIN_MAX_NUM_ROWS, SL_EXEC_INT_REG_BITS, (unsigned long long)hash);
+  sg_printf(&sg, "};\n");
+  sg_finish(&sg);
+
+  r = sg.error_;
+  if (!r && ferror(fp)) r = -1;
+  sg_cleanup(&sg);
+  free(is_target);
+  return r;
+}
+
+static void sl_aot_host_exec_instr(void *bc, void *exec, size_t pc, uint32_t row) {
+  struct sl_bytecode *b = (struct sl_bytecode *)bc;
+  const int *instr = b->code_ + pc;
+  if ((instr[0] == SLIR_SPLIT_EXEC_CHAIN_BY_CONDITION) || (instr[0] == SLIR_SPLIT_EXEC_CHAIN_BY_UNIFORM_CONDITION) ||
+      (instr[0] == SLIR_JOIN_EXEC_CHAINS)) {
+    sl_bytecode_exec_chain_instr(b, (struct sl_execution *)exec, instr);
+  }
+  else {
+    /* instr[2] is the chain operand, already resolved to row */
+    sl_bytecode_exec_kernel(b, (struct sl_execution *)exec, instr[0], (sl_exec_row_t)row, instr + 3);
+  }
+}
+
+static const struct sl_aot_host g_sl_aot_host_ = {
+  sl_aot_host_exec_instr,
+  g_sl_aot_kernels_
+};
+
+static void sl_aot_load_module(const char *path) {
+  void *handle;
+  void **new_modules;
+#ifdef _WIN32
+  handle = (void *)LoadLibraryA(path);
+#else
+  handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+#endif
+  if (!handle) return;
+  new_modules = (void **)realloc(g_sl_aot_modules_, sizeof(void *) * (g_sl_aot_num_modules_ + 1));
+  if (!new_modules) {
+#ifdef _WIN32
+    FreeLibrary((HMODULE)handle);
+#else
+    dlclose(handle);
+#endif
+    return;
+  }
+  g_sl_aot_modules_ = new_modules;
+  g_sl_aot_modules_[g_sl_aot_num_modules_++] = handle;
+}
+
+static void sl_aot_load_modules(void) {
+  const char *modules = getenv("AEX_SL_AOT_MODULES");
+  char *paths, *path, *end;
+  int instruction_code;
+  for (instruction_code = 0; instruction_code <= SLBC_COMPACT; ++instruction_code) {
+    const char *banks;
+    g_sl_aot_kernels_[instruction_code] = sl_bytecode_direct_kernel(instruction_code, &banks);
+  }
+  if (!modules) return;
+  paths = (char *)malloc(strlen(modules) + 1);
+  if (!paths) return;
+  strcpy(paths, modules);
+  path = paths;
+  do {
+    end = strchr(path, SL_AOT_PATH_SEPARATOR);
+    if (end) *end = '\0';
+    if (*path) sl_aot_load_module(path);
+    path = end + 1;
+  } while (end);
+  free(paths);
+}
+
+#ifdef _WIN32
+static INIT_ONCE g_sl_aot_load_once_ = INIT_ONCE_STATIC_INIT;
+static BOOL CALLBACK sl_aot_load_modules_once(PINIT_ONCE init_once, PVOID param, PVOID *context) {
+  sl_aot_load_modules();
+  return TRUE;
+}
+#else
+static pthread_once_t g_sl_aot_load_once_ = PTHREAD_ONCE_INIT;
+#endif
+
+static void *sl_aot_find_symbol(void *module, const char *name) {
+#ifdef _WIN32
+  return (void *)GetProcAddress((HMODULE)module, name);
+#else
+  return dlsym(module, name);
+#endif
+}
+
+static void sl_aot_emit_file(const struct sl_bytecode *bc, uint64_t hash) {
+  const char *dir = getenv("AEX_SL_AOT_EMIT_DIR");
+  char *path;
+  FILE *fp;
+  if (!dir) return;
+  path = (char *)malloc(strlen(dir) + 64);
+  if (!path) return;
+  sprintf(path, "%s/aex_sl_%016llx.c", dir, (unsigned long long)hash);
+  fp = fopen(path, "wb");
+  if (fp) {
+    if (sl_aot_emit_c(fp, bc, hash)) {
+      fclose(fp);
+      remove(path);
+    }
+    else {
+      fclose(fp);
+    }
+  }
+  free(path);
+}
+
+void sl_aot_link(struct sl_execution *exec, uint64_t hash) {
+  char symbol[64];
+  uint64_t checksum;
+  size_t n;
+
+  exec->aot_ = NULL;
+  if (!exec->bytecode_) return;
+
+  sl_aot_emit_file(exec->bytecode_, hash);
+
+#ifdef _WIN32
+  InitOnceExecuteOnce(&g_sl_aot_load_once_, sl_aot_load_modules_once, NULL, NULL);
+#else
+  pthread_once(&g_sl_aot_load_once_, sl_aot_load_modules);
+#endif
+  if (!g_sl_aot_num_modules_) return;
+
+  sprintf(symbol, "aex_sl_aot_%016llx", (unsigned long long)hash);
+  checksum = sl_aot_code_checksum(exec->bytecode_);
+  for (n = 0; n < g_sl_aot_num_modules_; ++n) {
+    const struct sl_aot_shader *aot = (const struct sl_aot_shader *)sl_aot_find_symbol(g_sl_aot_modules_[n], symbol);
+    if (!aot) continue;
+    /* Skip stale modules; code generated by a different build of the compiler hardwires different registers */
+    if ((aot->abi_version_ != SL_AOT_ABI_VERSION) || (aot->hash_ != hash) ||
+        (aot->num_code_ != exec->bytecode_->num_code_) || (aot->code_checksum_ != checksum) ||
+        (aot->max_num_rows_ != SL_EXEC_CHAIN_MAX_NUM_ROWS) || (aot->int_reg_bits_ != SL_EXEC_INT_REG_BITS)) {
+      continue;
+    }
+    exec->aot_ = aot;
+    return;
+  }
+}
+
+int sl_aot_run(const struct sl_aot_shader *aot, struct sl_execution *exec, uint32_t exec_chain, uint32_t *psurvivors, uint32_t *pdiscarded) {
+  struct sl_bytecode *bc = exec->bytecode_;
+  size_t n;
+  if (!bc || !exec->num_execution_frames_) return -1;
+  if (sl_bytecode_reserve_chains(bc, exec)) return -1;
+
+  for (n = 0; n < bc->num_chains_; ++n) {
+    exec->bc_chains_[n] = SL_EXEC_NO_CHAIN;
+  }
+  exec->bc_chains_[bc->exec_chain_] = exec_chain;
+
+  aot->run_(&g_sl_aot_host_, bc, exec, exec->bc_chains_, exec->exec_chain_reg_, exec->float_regs_, exec->int_regs_, exec->bool_regs_);
+
+  *psurvivors = exec->bc_chains_[bc->exec_chain_];
+  *pdiscarded = exec->bc_chains_[bc->discard_chain_];
+  return 0;
+}
@@ -0,0 +1,111 @@
+/* Copyright 2024 Kinglet B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SL_AOT_H
+#define SL_AOT_H
+
+#ifndef STDINT_H_INCLUDED
+#define STDINT_H_INCLUDED
+#include <stdint.h>
+#endif
+
+#ifndef STDDEF_H_INCLUDED
+#define STDDEF_H_INCLUDED
+#include <stddef.h>
+#endif
+
+#ifndef STDIO_H_INCLUDED
+#define STDIO_H_INCLUDED
+#include <stdio.h>
+#endif
+
+#ifndef SL_EXECUTION_H_INCLUDED
+#define SL_EXECUTION_H_INCLUDED
+#include "sl_execution.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Ahead-of-time compilation of shaders.
+ *
+ * When the environment variable AEX_SL_AOT_EMIT_DIR is set, linking a program writes the bytecode of each
+ * of its shaders as plain C to "<AEX_SL_AOT_EMIT_DIR>/aex_sl_<hash>.c", where <hash> is the 16 digit hex
+ * sl_shader::hash_. These files are self-contained and can be compiled together into a shared object
+ * (DLL) with any C compiler.
+ *
+ * When the environment variable AEX_SL_AOT_MODULES is set to a list of such shared objects (separated by
+ * ';' on Windows and ':' elsewhere), they are loaded upon the first program link, and any shader whose
+ * hash (and bytecode) matches an entry in one of the modules runs the compiled code instead of the JIT or
+ * interpreter. */
+
+/* Bumped whenever struct sl_aot_host, struct sl_aot_shader, or the generated code's conventions change;
+ * modules built for a different version are ignored. */
+#define SL_AOT_ABI_VERSION 4
+
+struct sl_execution;
+struct sl_bytecode;
+
+/* Functions the generated code calls back into. */
+struct sl_aot_host {
+  /* Executes the instruction at bc->code_[pc] for the chain starting at row (row is ignored for the chain
+   * split and join instructions); for the instructions neither inlined nor in kernels_. */
+  void (*exec_instr_)(void *bc, void *exec, size_t pc, uint32_t row);
+
+  /* Kernels indexed by instruction code, see sl_bytecode_direct_kernel(); the generated code calls these
+   * directly with the register columns of the operands. */
+  void (*const *kernels_)(void);
+};
+
+/* Exported by the generated code as "aex_sl_aot_<hash>" */
+struct sl_aot_shader {
+  int abi_version_;
+  uint64_t hash_;
+
+  /* The bytecode the code was generated from; it must match the bytecode generated at runtime as
+   * the compiled code hardwires register indices. */
+  size_t num_code_;
+  uint64_t code_checksum_;
+
+  /* SL_EXEC_CHAIN_MAX_NUM_ROWS of the build that generated the code, which determines the width of the
+   * execution chain column's deltas. */
+  int max_num_rows_;
+
+  /* SL_EXEC_INT_REG_BITS of the build that generated the code, which determines the width of the
+   * integer registers. */
+  int int_reg_bits_;
+
+  void (*run_)(const struct sl_aot_host *host, void *bc, void *exec, uint32_t *chains,
+               sl_exec_row_t *chain_column, float **float_regs, sl_exec_int_t **int_regs, unsigned char **bool_regs);
+};
+
+/* Returns the checksum of the bytecode as stored in sl_aot_shader::code_checksum_ */
+uint64_t sl_aot_code_checksum(const struct sl_bytecode *bc);
+
+/* Writes the bytecode as C source to fp; returns 0 upon success. */
+int sl_aot_emit_c(FILE *fp, const struct sl_bytecode *bc, uint64_t hash);
+
+/* Called upon program link after sl_exec_prep(); emits the C source for the shader if requested,
+ * and attaches matching compiled code from the loaded modules to exec->aot_. */
+void sl_aot_link(struct sl_execution *exec, uint64_t hash);
+
+/* Runs the compiled code, same semantics as sl_bytecode_run(). */
+int sl_aot_run(const struct sl_aot_shader *aot, struct sl_execution *exec, uint32_t exec_chain, uint32_t *psurvivors, uint32_t *pdiscarded);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* SL_AOT_H */
@@ -24,10 +24,14 @@
  * #define BINOP_SNIPPET_TYPE float
  *
  * It assumes the following variables/parameters are in scope:
- * chain_column: of type "const uint8_t * restrict"; points to the chain column
+ * chain_column: of type "const sl_exec_row_t * restrict"; points to the chain column
  * result_column: of type "BINOP_SNIPPET_TYPE * restrict"; points to the destination
  * left_column: of type "const BINOP_SNIPPET_TYPE * restrict"; points to the left operand
  * right_column: of type "const BINOP_SNIPPET_TYPE * restrict"; points to the right operand
+ *
+ * Optionally, for float kernels, define:
+ * #define BINOP_SNIPPET_SIMD_KERNEL <<kernel function pointer, see struct sl_simd_kernels>>
+ * in which case the kernel is called instead of the generic code below if it is not NULL.
  */
 
 #ifndef BINOP_SNIPPET_RESULT_TYPE
@@ -35,11 +39,16 @@
 #define BINOP_SNIPPET_UNDEF_RESULT_TYPE
 #endif
 
+#ifdef BINOP_SNIPPET_SIMD_KERNEL
+if (BINOP_SNIPPET_SIMD_KERNEL) {
+  BINOP_SNIPPET_SIMD_KERNEL(row, chain_column, result_column, left_column, right_column);
+}
+else
+#endif
 for (;;) {
-  uint64_t chain;
-  uint8_t delta;
+  sl_exec_row_t delta;
 
-  if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+  if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
     do {
       BINOP_SNIPPET_RESULT_TYPE *restrict result = result_column + row;
       const BINOP_SNIPPET_TYPE *restrict left = left_column + row;
@@ -50,12 +59,12 @@ for (;;) {
         result[n] = BINOP_SNIPPET_OPERATOR((left[n]), (right[n]));
       }
 
-      delta = (chain & 0xFF00000000000000) >> 56;
+      delta = chain_column[row + 7];
       if (!delta) break;
       row += 7 + delta;
-    } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+    } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
   }
-  else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+  else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
     do {
       BINOP_SNIPPET_RESULT_TYPE *restrict result = result_column + row;
       const BINOP_SNIPPET_TYPE *restrict left = left_column + row;
@@ -65,10 +74,10 @@ for (;;) {
       for (n = 0; n < 4; n++) {
         result[n] = BINOP_SNIPPET_OPERATOR((left[n]), (right[n]));
       }
-      delta = (chain & 0xFF000000) >> 24;
+      delta = chain_column[row + 3];
       if (!delta) break;
       row += 3 + delta;
-    } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+    } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
   }
   else {
     do {
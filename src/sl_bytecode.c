@@ -0,0 +1,1539 @@
+/* Copyright 2024 Kinglet B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef STDINT_H_INCLUDED
+#define STDINT_H_INCLUDED
+#include <stdint.h>
+#endif
+
+#ifndef STDLIB_H_INCLUDED
+#define STDLIB_H_INCLUDED
+#include <stdlib.h>
+#endif
+
+#ifndef STRING_H_INCLUDED
+#define STRING_H_INCLUDED
+#include <string.h>
+#endif
+
+#ifdef _MSC_VER
+#ifndef INTRIN_H_INCLUDED
+#define INTRIN_H_INCLUDED
+#include <intrin.h>
+#endif
+#endif
+
+#ifndef IR_H_INCLUDED
+#define IR_H_INCLUDED
+#include "ir.h"
+#endif
+
+#ifndef SL_IR_H_INCLUDED
+#define SL_IR_H_INCLUDED
+#include "sl_ir.h"
+#endif
+
+#ifndef SL_EXECUTION_H_INCLUDED
+#define SL_EXECUTION_H_INCLUDED
+#include "sl_execution.h"
+#endif
+
+#ifndef SL_EXPR_H_INCLUDED
+#define SL_EXPR_H_INCLUDED
+#include "sl_expr.h"
+#endif
+
+#ifndef SL_REG_MOVE_H_INCLUDED
+#define SL_REG_MOVE_H_INCLUDED
+#include "sl_reg_move.h"
+#endif
+
+#ifndef SL_PROFILE_H_INCLUDED
+#define SL_PROFILE_H_INCLUDED
+#include "sl_profile.h"
+#endif
+
+#ifndef SITUS_H_INCLUDED
+#define SITUS_H_INCLUDED
+#include "pp/situs.h"
+#endif
+
+#ifndef SL_IR_OPT_H_INCLUDED
+#define SL_IR_OPT_H_INCLUDED
+#include "sl_ir_opt.h"
+#endif
+
+#ifndef SL_BYTECODE_H_INCLUDED
+#define SL_BYTECODE_H_INCLUDED
+#include "sl_bytecode.h"
+#endif
+
+/* Register touched by a series of kernels preceded by SLBC_COMPACT; bank_ is 0 for float, 1 for int and 2 for
+ * bool registers, flags_ are SL_BYTECODE_COMPACT_XXX */
+struct sl_bytecode_compact_reg {
+  int bank_;
+  int reg_;
+  int flags_;
+};
+
+/* Branch target fixup, code_[code_index_] is to be set to the offset of blk_ once all blocks are placed */
+struct sl_bytecode_fixup {
+  size_t code_index_;
+  struct ir_block *blk_;
+};
+
+struct sl_bytecode_builder {
+  struct sl_bytecode *bc_;
+
+  size_t num_fixups_;
+  size_t num_fixups_allocated_;
+  struct sl_bytecode_fixup *fixups_;
+
+  /* Code offset of each block, indexed by serial_num_ - 1 */
+  size_t num_blocks_;
+  size_t *block_offsets_;
+
+  /* sl_execution::float_uniform_flags_ of the registers, or NULL */
+  uint8_t *float_uniform_flags_;
+  size_t num_float_regs_;
+
+  /* Series of kernels appended that may run on compacted rows, see SLBC_COMPACT: the chain they run on (NULL
+   * if none), the offset of the first, the number of kernels and the registers they touch. */
+  struct ir_temp *compact_chain_;
+  size_t compact_start_;
+  size_t compact_num_kernels_;
+  size_t num_compact_regs_;
+  size_t num_compact_regs_allocated_;
+  struct sl_bytecode_compact_reg *compact_regs_;
+};
+
+void sl_bytecode_init(struct sl_bytecode *bc) {
+  bc->f_ = NULL;
+  bc->num_code_ = bc->num_code_allocated_ = 0;
+  bc->code_ = NULL;
+  bc->num_lits_ = bc->num_lits_allocated_ = 0;
+  bc->lits_ = NULL;
+  bc->num_ptrs_ = bc->num_ptrs_allocated_ = 0;
+  bc->ptrs_ = NULL;
+  bc->num_sources_ = bc->num_sources_allocated_ = 0;
+  bc->sources_ = NULL;
+  bc->num_chains_ = 0;
+  bc->exec_chain_ = bc->discard_chain_ = 0;
+  memset(&bc->register_counts_, 0, sizeof(bc->register_counts_));
+  memset(bc->num_fused_, 0, sizeof(bc->num_fused_));
+}
+
+void sl_bytecode_cleanup(struct sl_bytecode *bc) {
+  if (bc->code_) free(bc->code_);
+  if (bc->lits_) free(bc->lits_);
+  if (bc->ptrs_) free(bc->ptrs_);
+  if (bc->sources_) free(bc->sources_);
+}
+
+static int sl_bytecode_append_code(struct sl_bytecode *bc, int val) {
+  if (bc->num_code_ == bc->num_code_allocated_) {
+    size_t new_num_allocated = bc->num_code_allocated_ + bc->num_code_allocated_ + 256;
+    if (new_num_allocated <= bc->num_code_allocated_) return -1;
+    if (new_num_allocated > (SIZE_MAX / sizeof(int))) return -1;
+    int *new_code = (int *)realloc(bc->code_, new_num_allocated * sizeof(int));
+    if (!new_code) return -1;
+    bc->code_ = new_code;
+    bc->num_code_allocated_ = new_num_allocated;
+  }
+  bc->code_[bc->num_code_++] = val;
+  return 0;
+}
+
+static int sl_bytecode_append_lit(struct sl_bytecode *bc, int64_t val) {
+  if (bc->num_lits_ == bc->num_lits_allocated_) {
+    size_t new_num_allocated = bc->num_lits_allocated_ + bc->num_lits_allocated_ + 16;
+    if (new_num_allocated <= bc->num_lits_allocated_) return -1;
+    if (new_num_allocated > (SIZE_MAX / sizeof(int64_t))) return -1;
+    int64_t *new_lits = (int64_t *)realloc(bc->lits_, new_num_allocated * sizeof(int64_t));
+    if (!new_lits) return -1;
+    bc->lits_ = new_lits;
+    bc->num_lits_allocated_ = new_num_allocated;
+  }
+  bc->lits_[bc->num_lits_++] = val;
+  return sl_bytecode_append_code(bc, (int)(bc->num_lits_ - 1));
+}
+
+static int sl_bytecode_append_ptr(struct sl_bytecode *bc, void *ptr) {
+  if (bc->num_ptrs_ == bc->num_ptrs_allocated_) {
+    size_t new_num_allocated = bc->num_ptrs_allocated_ + bc->num_ptrs_allocated_ + 16;
+    if (new_num_allocated <= bc->num_ptrs_allocated_) return -1;
+    if (new_num_allocated > (SIZE_MAX / sizeof(void *))) return -1;
+    void **new_ptrs = (void **)realloc(bc->ptrs_, new_num_allocated * sizeof(void *));
+    if (!new_ptrs) return -1;
+    bc->ptrs_ = new_ptrs;
+    bc->num_ptrs_allocated_ = new_num_allocated;
+  }
+  bc->ptrs_[bc->num_ptrs_++] = ptr;
+  return sl_bytecode_append_code(bc, (int)(bc->num_ptrs_ - 1));
+}
+
+/* Notes that the code appended next is generated from instr, see sl_bytecode_source */
+static int sl_bytecode_append_source(struct sl_bytecode *bc, struct ir_instr *instr) {
+  struct sl_bytecode_source *src;
+  if (bc->num_sources_ && (bc->sources_[bc->num_sources_ - 1].code_offset_ == bc->num_code_)) {
+    /* The previous source generated no code (e.g. an elided jump) */
+    bc->num_sources_--;
+  }
+  src = bc->num_sources_ ? bc->sources_ + bc->num_sources_ - 1 : NULL;
+  if (src ? (src->node_ == instr->source_node_) : !instr->source_node_) return 0;
+  if (bc->num_sources_ == bc->num_sources_allocated_) {
+    size_t new_num_allocated = bc->num_sources_allocated_ + bc->num_sources_allocated_ + 16;
+    if (new_num_allocated <= bc->num_sources_allocated_) return -1;
+    if (new_num_allocated > (SIZE_MAX / sizeof(struct sl_bytecode_source))) return -1;
+    struct sl_bytecode_source *new_sources = (struct sl_bytecode_source *)realloc(bc->sources_, new_num_allocated * sizeof(struct sl_bytecode_source));
+    if (!new_sources) return -1;
+    bc->sources_ = new_sources;
+    bc->num_sources_allocated_ = new_num_allocated;
+  }
+  src = bc->sources_ + bc->num_sources_++;
+  src->code_offset_ = bc->num_code_;
+  src->node_ = instr->source_node_;
+  src->line_ = instr->source_loc_ ? situs_line(instr->source_loc_) : 0;
+  return 0;
+}
+
+static int sl_bytecode_append_fixup(struct sl_bytecode_builder *bcb, struct ir_block *target) {
+  if (bcb->num_fixups_ == bcb->num_fixups_allocated_) {
+    size_t new_num_allocated = bcb->num_fixups_allocated_ + bcb->num_fixups_allocated_ + 16;
+    if (new_num_allocated <= bcb->num_fixups_allocated_) return -1;
+    if (new_num_allocated > (SIZE_MAX / sizeof(struct sl_bytecode_fixup))) return -1;
+    struct sl_bytecode_fixup *new_fixups = (struct sl_bytecode_fixup *)realloc(bcb->fixups_, new_num_allocated * sizeof(struct sl_bytecode_fixup));
+    if (!new_fixups) return -1;
+    bcb->fixups_ = new_fixups;
+    bcb->num_fixups_allocated_ = new_num_allocated;
+  }
+  bcb->fixups_[bcb->num_fixups_].code_index_ = bcb->bc_->num_code_;
+  bcb->fixups_[bcb->num_fixups_].blk_ = target;
+  bcb->num_fixups_++;
+  /* Placeholder for the target */
+  return sl_bytecode_append_code(bcb->bc_, -1);
+}
+
+/* Appends the encoding of operand arg_index of instruction_code, see struct sl_bytecode for the encoding. */
+static int sl_bytecode_append_operand(struct sl_bytecode_builder *bcb, int instruction_code, size_t arg_index, struct ir_temp *temp) {
+  struct sl_bytecode *bc = bcb->bc_;
+  if (!temp) return -1;
+  switch (temp->kind_) {
+    case IR_VIRTUAL:
+      if (temp->external_id_ < 0) return -1;
+      if ((size_t)temp->external_id_ >= bc->num_chains_) bc->num_chains_ = (size_t)temp->external_id_ + 1;
+      return sl_bytecode_append_code(bc, temp->external_id_);
+    case IR_FLOAT_BANK:
+    case IR_INT_BANK:
+    case IR_BOOL_BANK:
+    case IR_SAMPLER2D_BANK:
+    case IR_SAMPLERCUBE_BANK:
+      return sl_bytecode_append_code(bc, temp->temp_value_);
+    case IR_LITERAL_INT:
+      if (((instruction_code == SLIR_INIT_LIT_I) && (arg_index == 2)) ||
+          ((instruction_code == SLIR_MUL_C_AND_ADD) && (arg_index == 3))) {
+        return sl_bytecode_append_lit(bc, temp->lit_.i64_);
+      }
+      if (temp->lit_.i64_ == (int64_t)SL_EXEC_NO_CHAIN) {
+        return sl_bytecode_append_code(bc, -1);
+      }
+      if ((temp->lit_.i64_ < INT_MIN) || (temp->lit_.i64_ > INT_MAX)) return -1;
+      return sl_bytecode_append_code(bc, (int)temp->lit_.i64_);
+    case IR_LITERAL_UINT:
+      return sl_bytecode_append_ptr(bc, (void *)(uintptr_t)temp->lit_.u64_);
+    case IR_LITERAL_FLOAT: {
+      int bits;
+      memcpy(&bits, &temp->lit_.f_, sizeof(bits));
+      return sl_bytecode_append_code(bc, bits);
+    }
+    case IR_LITERAL_BOOL:
+      return sl_bytecode_append_code(bc, temp->lit_.b_);
+    case IR_BLOCK_ENTRY:
+      return sl_bytecode_append_fixup(bcb, temp->entry_point_block_);
+    default:
+      /* Not expected in SLIR (IR_LITERAL_DOUBLE, IR_REGISTER, ..), fails sl_bytecode_compile() */
+      return -1;
+  }
+}
+
+static int sl_bytecode_append_instr(struct sl_bytecode_builder *bcb, struct ir_instr *instr) {
+  size_t n;
+  int r;
+  r = sl_bytecode_append_code(bcb->bc_, instr->instruction_code_);
+  r = r ? r : sl_bytecode_append_code(bcb->bc_, (int)instr->num_args_);
+  for (n = 0; n < instr->num_args_; ++n) {
+    r = r ? r : sl_bytecode_append_operand(bcb, instr->instruction_code_, n, instr->args_[n]->temp_);
+  }
+  return r;
+}
+
+/* Returns the register of temp if it is a float register holding a uniform, or -1 otherwise */
+static int sl_bytecode_uniform_reg(struct sl_bytecode_builder *bcb, struct ir_temp *temp) {
+  if (!bcb->float_uniform_flags_ || !temp || (temp->kind_ != IR_FLOAT_BANK)) return -1;
+  if ((temp->temp_value_ < 0) || ((size_t)temp->temp_value_ >= bcb->num_float_regs_)) return -1;
+  return (bcb->float_uniform_flags_[temp->temp_value_] & SL_EXEC_UNIFORM_SCALAR) ? temp->temp_value_ : -1;
+}
+
+/* Flags all uniform registers as read as a column, for when we cannot tell which are */
+static void sl_bytecode_need_all_uniform_columns(struct sl_bytecode_builder *bcb) {
+  size_t n;
+  if (!bcb->float_uniform_flags_) return;
+  for (n = 0; n < bcb->num_float_regs_; ++n) {
+    if (bcb->float_uniform_flags_[n] & SL_EXEC_UNIFORM_SCALAR) bcb->float_uniform_flags_[n] |= SL_EXEC_UNIFORM_COLUMN;
+  }
+}
+
+/* Flags the uniform registers read by the builtin function call x (see SLIR_CALL_BUILTIN) as read as a
+ * column; builtins read their arguments from the registers of the child expressions. */
+static void sl_bytecode_need_builtin_uniform_columns(struct sl_bytecode_builder *bcb, struct sl_expr *x) {
+  size_t n;
+  if (!bcb->float_uniform_flags_) return;
+  for (n = 0; n < x->num_children_; ++n) {
+    struct sl_expr *child = x->children_[n];
+    if ((child->offset_reg_.kind_ != slrak_void) || child->base_regs_.is_indirect_ || child->rvalue_.is_indirect_) {
+      /* Register is only known at runtime */
+      if (!child->base_regs_.local_frame_) sl_bytecode_need_all_uniform_columns(bcb);
+      continue;
+    }
+    if (!child->base_regs_.local_frame_) {
+      sl_reg_alloc_mark_float_regs(&child->base_regs_, bcb->float_uniform_flags_, bcb->num_float_regs_, SL_EXEC_UNIFORM_COLUMN);
+    }
+    if ((child->rvalue_.kind_ != slrak_void) && !child->rvalue_.local_frame_) {
+      sl_reg_alloc_mark_float_regs(&child->rvalue_, bcb->float_uniform_flags_, bcb->num_float_regs_, SL_EXEC_UNIFORM_COLUMN);
+    }
+  }
+}
+
+/* Appends [instruction_code, num_args, chain, operands..] where the operands are the given args of instr,
+ * in the order given. */
+static int sl_bytecode_append_permuted_instr(struct sl_bytecode_builder *bcb, int instruction_code, struct ir_instr *instr, size_t num_args, const size_t *args) {
+  size_t n;
+  int r;
+  r = sl_bytecode_append_code(bcb->bc_, instruction_code);
+  r = r ? r : sl_bytecode_append_code(bcb->bc_, (int)(num_args + 1));
+  r = r ? r : sl_bytecode_append_operand(bcb, instr->instruction_code_, 0, instr->args_[0]->temp_);
+  for (n = 0; n < num_args; ++n) {
+    r = r ? r : sl_bytecode_append_operand(bcb, instr->instruction_code_, args[n], instr->args_[args[n]]->temp_);
+  }
+  return r;
+}
+
+/* Appends instr, substituting the SLBC_XXX instruction that reads its uniform float operands as scalars if
+ * there is one; the uniform operands that are still read as a column are flagged SL_EXEC_UNIFORM_COLUMN. */
+static int sl_bytecode_append_uniform_instr(struct sl_bytecode_builder *bcb, struct ir_instr *instr) {
+  int code = instr->instruction_code_;
+  size_t n;
+
+  switch (code) {
+    case SLIR_ADD_F:
+    case SLIR_SUB_F:
+    case SLIR_MUL_F:
+    case SLIR_DIV_F: {
+      /* [chain, dst, left, right] */
+      static const size_t as_is[] = { 1, 2, 3 }, swapped[] = { 1, 3, 2 };
+      int left, right;
+      if (instr->num_args_ != 4) break;
+      left = sl_bytecode_uniform_reg(bcb, instr->args_[2]->temp_);
+      right = sl_bytecode_uniform_reg(bcb, instr->args_[3]->temp_);
+      if ((left < 0) && (right < 0)) break;
+      if ((left >= 0) && (right >= 0)) {
+        switch (code) {
+          case SLIR_ADD_F: code = SLBC_ADD_F_SS; break;
+          case SLIR_SUB_F: code = SLBC_SUB_F_SS; break;
+          case SLIR_MUL_F: code = SLBC_MUL_F_SS; break;
+          case SLIR_DIV_F: code = SLBC_DIV_F_SS; break;
+        }
+        return sl_bytecode_append_permuted_instr(bcb, code, instr, 3, as_is);
+      }
+      if (right >= 0) {
+        switch (code) {
+          case SLIR_ADD_F: code = SLBC_ADD_F_CS; break;
+          case SLIR_SUB_F: code = SLBC_SUB_F_CS; break;
+          case SLIR_MUL_F: code = SLBC_MUL_F_CS; break;
+          case SLIR_DIV_F: code = SLBC_DIV_F_CS; break;
+        }
+        return sl_bytecode_append_permuted_instr(bcb, code, instr, 3, as_is);
+      }
+      /* Scalar on the left; addition and multiplication commute */
+      switch (code) {
+        case SLIR_ADD_F: return sl_bytecode_append_permuted_instr(bcb, SLBC_ADD_F_CS, instr, 3, swapped);
+        case SLIR_SUB_F: return sl_bytecode_append_permuted_instr(bcb, SLBC_SUB_F_SC, instr, 3, as_is);
+        case SLIR_MUL_F: return sl_bytecode_append_permuted_instr(bcb, SLBC_MUL_F_CS, instr, 3, swapped);
+        case SLIR_DIV_F: return sl_bytecode_append_permuted_instr(bcb, SLBC_DIV_F_SC, instr, 3, as_is);
+      }
+      break;
+    }
+    case SLIR_DOT2:
+    case SLIR_DOT3:
+    case SLIR_DOT4: {
+      /* [chain, dst, left_0..left_n-1, right_0..right_n-1]; the products commute, so either side may be the
+       * scalar one, as long as it is all scalars. */
+      size_t dim = 2 + (size_t)(code - SLIR_DOT2);
+      size_t args[9];
+      int left_uniform = 1, right_uniform = 1, any_uniform = 0;
+      if (instr->num_args_ != (2 + 2 * dim)) break;
+      for (n = 0; n < dim; ++n) {
+        int left = sl_bytecode_uniform_reg(bcb, instr->args_[2 + n]->temp_);
+        int right = sl_bytecode_uniform_reg(bcb, instr->args_[2 + dim + n]->temp_);
+        if (left < 0) left_uniform = 0;
+        if (right < 0) right_uniform = 0;
+        if ((left >= 0) || (right >= 0)) any_uniform = 1;
+      }
+      if (!any_uniform || (left_uniform == right_uniform)) break;
+      args[0] = 1;
+      for (n = 0; n < dim; ++n) {
+        args[1 + n] = left_uniform ? 2 + n : 2 + dim + n;
+        args[1 + dim + n] = left_uniform ? 2 + dim + n : 2 + n;
+      }
+      return sl_bytecode_append_permuted_instr(bcb, SLBC_DOT2_SC + (int)(dim - 2), instr, 1 + 2 * dim, args);
+    }
+    case SLIR_MAT2_MUL_VEC2:
+    case SLIR_MAT3_MUL_VEC3:
+    case SLIR_MAT4_MUL_VEC4:
+    case SLIR_VEC2_MUL_MAT2:
+    case SLIR_VEC3_MUL_MAT3:
+    case SLIR_VEC4_MUL_MAT4:
+    case SLIR_MAT2_MUL_MAT2:
+    case SLIR_MAT3_MUL_MAT3:
+    case SLIR_MAT4_MUL_MAT4: {
+      /* [chain, dsts, left components, right components]; a side that is all uniforms (e.g. the matrix of
+       * uniform_mat4 * attribute_vec4) is read as scalars, the uniforms on the other side still as columns. */
+      size_t args[48];
+      int num_rows, inner, num_cols;
+      size_t num_dsts, num_left, num_right, columns_from, columns_to;
+      int left_uniform = 1, right_uniform = 1;
+      sl_ir_matrix_product_shape(code, &num_rows, &inner, &num_cols);
+      num_dsts = (size_t)(num_rows * num_cols);
+      num_left = (size_t)(num_rows * inner);
+      num_right = (size_t)(inner * num_cols);
+      if (instr->num_args_ != (1 + num_dsts + num_left + num_right)) break;
+      for (n = 0; n < num_left; ++n) {
+        if (sl_bytecode_uniform_reg(bcb, instr->args_[1 + num_dsts + n]->temp_) < 0) left_uniform = 0;
+      }
+      for (n = 0; n < num_right; ++n) {
+        if (sl_bytecode_uniform_reg(bcb, instr->args_[1 + num_dsts + num_left + n]->temp_) < 0) right_uniform = 0;
+      }
+      if (left_uniform == right_uniform) break;
+      if (left_uniform) {
+        columns_from = 1 + num_dsts + num_left;
+        columns_to = instr->num_args_;
+        code = SLBC_MAT2_MUL_VEC2_SC + (code - SLIR_MAT2_MUL_VEC2);
+      }
+      else {
+        columns_from = 1 + num_dsts;
+        columns_to = 1 + num_dsts + num_left;
+        code = SLBC_MAT2_MUL_VEC2_CS + (code - SLIR_MAT2_MUL_VEC2);
+      }
+      for (n = columns_from; n < columns_to; ++n) {
+        int reg = sl_bytecode_uniform_reg(bcb, instr->args_[n]->temp_);
+        if (reg >= 0) bcb->float_uniform_flags_[reg] |= SL_EXEC_UNIFORM_COLUMN;
+      }
+      for (n = 1; n < instr->num_args_; ++n) {
+        args[n - 1] = n;
+      }
+      return sl_bytecode_append_permuted_instr(bcb, code, instr, instr->num_args_ - 1, args);
+    }
+    case SLIR_REG_MOVE_F_REG_TO_REG: {
+      /* [chain, dst, src] */
+      static const size_t as_is[] = { 1, 2 };
+      if ((instr->num_args_ == 3) && (sl_bytecode_uniform_reg(bcb, instr->args_[2]->temp_) >= 0)) {
+        return sl_bytecode_append_permuted_instr(bcb, SLBC_MOVE_F_SCALAR_TO_REG, instr, 2, as_is);
+      }
+      break;
+    }
+    case SLIR_REG_MOVE_F_OFFSET_REG_TO_REG: {
+      /* [chain, dst, src_base, src_offset, src_fixed_offset, src_offset_stepsize]; a uniform base implies the
+       * entire array indexed is uniform. */
+      static const size_t as_is[] = { 1, 2, 3, 4, 5 };
+      if ((instr->num_args_ == 6) && (sl_bytecode_uniform_reg(bcb, instr->args_[2]->temp_) >= 0)) {
+        return sl_bytecode_append_permuted_instr(bcb, SLBC_MOVE_F_SCALAR_OFFSET_TO_REG, instr, 5, as_is);
+      }
+      break;
+    }
+    case SLIR_CALL_BUILTIN:
+      if ((instr->num_args_ > 1) && instr->args_[1]->temp_ && (instr->args_[1]->temp_->kind_ == IR_LITERAL_UINT)) {
+        sl_bytecode_need_builtin_uniform_columns(bcb, (struct sl_expr *)(uintptr_t)instr->args_[1]->temp_->lit_.u64_);
+      }
+      return sl_bytecode_append_instr(bcb, instr);
+  }
+
+  if ((code >= SLIR_REG_MOVE_F_REG_TO_REG) && (code <= SLIR_REG_MOVE_F2B_INDIR_OFFSET_TO_INDIR_OFFSET)) {
+    /* Move from a float source other than the above; the source follows the destination operands, see
+     * sl_reg_emit_move_instr() for the encoding of the instruction code. */
+    int from_mode = ((code - SLIR_REG_MOVE_F_REG_TO_REG) / 4) % 4;
+    int to_mode = (code - SLIR_REG_MOVE_F_REG_TO_REG) % 4;
+    size_t src = 1 + ((to_mode == 0) ? 1 : (to_mode == 1) ? 2 : 4);
+    if (from_mode == 1 || from_mode == 3) {
+      /* Indirect source, may be any register */
+      sl_bytecode_need_all_uniform_columns(bcb);
+    }
+    else if ((src < instr->num_args_) && (sl_bytecode_uniform_reg(bcb, instr->args_[src]->temp_) >= 0)) {
+      if (from_mode == 0) {
+        bcb->float_uniform_flags_[instr->args_[src]->temp_->temp_value_] |= SL_EXEC_UNIFORM_COLUMN;
+      }
+      else {
+        /* Offset into a uniform array, we don't know its extent here */
+        sl_bytecode_need_all_uniform_columns(bcb);
+      }
+    }
+    return sl_bytecode_append_instr(bcb, instr);
+  }
+
+  /* Any other uniform operand is read as a column */
+  for (n = 0; n < instr->num_args_; ++n) {
+    int reg = sl_bytecode_uniform_reg(bcb, instr->args_[n]->temp_);
+    if (reg >= 0) bcb->float_uniform_flags_[reg] |= SL_EXEC_UNIFORM_COLUMN;
+  }
+  return sl_bytecode_append_instr(bcb, instr);
+}
+
+/* Returns non-zero if instr is a kernel that may run on compacted rows: it runs on an execution chain and only
+ * addresses float, int and bool registers directly. */
+static int sl_bytecode_is_compactable(struct ir_instr *instr) {
+  int code = instr->instruction_code_;
+  size_t n;
+  if ((code < SLIR_NEG_F) || (code >= SLIR_CALL_BUILTIN)) return 0;
+  if ((code >= SLIR_REG_MOVE_F_REG_TO_REG) && (code <= SLIR_REG_MOVE_SC_INDIR_OFFSET_TO_INDIR_OFFSET) &&
+      ((code - SLIR_REG_MOVE_F_REG_TO_REG) % 16)) {
+    /* Indirect or offset source or destination, see sl_reg_emit_move_instr() for the encoding */
+    return 0;
+  }
+  if (!instr->num_args_ || !instr->args_[0]->temp_ || (instr->args_[0]->temp_->kind_ != IR_VIRTUAL)) return 0;
+  for (n = 1; n < instr->num_args_; ++n) {
+    struct ir_temp *temp = instr->args_[n]->temp_;
+    if (!temp) return 0;
+    switch (temp->kind_) {
+      case IR_FLOAT_BANK:
+      case IR_INT_BANK:
+      case IR_BOOL_BANK:
+      case IR_LITERAL_INT:
+      case IR_LITERAL_FLOAT:
+      case IR_LITERAL_BOOL:
+        break;
+      default:
+        return 0;
+    }
+  }
+  return 1;
+}
+
+/* Adds the registers of the compactable kernel instr, just appended, to the series */
+static int sl_bytecode_compact_add_instr(struct sl_bytecode_builder *bcb, struct ir_instr *instr) {
+  size_t n, k;
+  for (n = 1; n < instr->num_args_; ++n) {
+    struct ir_arg *arg = instr->args_[n];
+    int bank, flags;
+    switch (arg->temp_->kind_) {
+      case IR_FLOAT_BANK: bank = 0; break;
+      case IR_INT_BANK: bank = 1; break;
+      case IR_BOOL_BANK: bank = 2; break;
+      default: continue;
+    }
+    flags = ((arg->usage_ != IR_DEF) ? SL_BYTECODE_COMPACT_GATHER : 0) | ((arg->usage_ != IR_USE) ? SL_BYTECODE_COMPACT_SCATTER : 0);
+    for (k = 0; k < bcb->num_compact_regs_; ++k) {
+      if ((bcb->compact_regs_[k].bank_ == bank) && (bcb->compact_regs_[k].reg_ == arg->temp_->temp_value_)) break;
+    }
+    if (k == bcb->num_compact_regs_) {
+      if (bcb->num_compact_regs_ == bcb->num_compact_regs_allocated_) {
+        size_t new_num_allocated = bcb->num_compact_regs_allocated_ + bcb->num_compact_regs_allocated_ + 16;
+        if (new_num_allocated <= bcb->num_compact_regs_allocated_) return -1;
+        if (new_num_allocated > (SIZE_MAX / sizeof(struct sl_bytecode_compact_reg))) return -1;
+        struct sl_bytecode_compact_reg *new_regs = (struct sl_bytecode_compact_reg *)realloc(bcb->compact_regs_, new_num_allocated * sizeof(struct sl_bytecode_compact_reg));
+        if (!new_regs) return -1;
+        bcb->compact_regs_ = new_regs;
+        bcb->num_compact_regs_allocated_ = new_num_allocated;
+      }
+      bcb->compact_regs_[k].bank_ = bank;
+      bcb->compact_regs_[k].reg_ = arg->temp_->temp_value_;
+      bcb->compact_regs_[k].flags_ = 0;
+      bcb->num_compact_regs_++;
+    }
+    bcb->compact_regs_[k].flags_ |= flags;
+  }
+  bcb->compact_num_kernels_++;
+  return 0;
+}
+
+/* Ends the series of compactable kernels, inserting SLBC_COMPACT before it if it is long enough to be worth it */
+static int sl_bytecode_compact_end(struct sl_bytecode_builder *bcb) {
+  struct sl_bytecode *bc = bcb->bc_;
+  size_t num_header = 7 + bcb->num_compact_regs_;
+  size_t num_series, n;
+  int num_per_bank[3] = { 0, 0, 0 };
+  int *header;
+  int r = 0;
+  int bank;
+
+  if (bcb->compact_chain_ && (bcb->compact_num_kernels_ >= SL_BYTECODE_COMPACT_MIN_KERNELS)) {
+    /* Make room, then move the series up; the kernels have no branch targets to fix up */
+    num_series = bc->num_code_ - bcb->compact_start_;
+    for (n = 0; !r && (n < num_header); ++n) {
+      r = sl_bytecode_append_code(bc, 0);
+    }
+    if (!r) {
+      memmove(bc->code_ + bcb->compact_start_ + num_header, bc->code_ + bcb->compact_start_, num_series * sizeof(int));
+      /* The header is charged to the source of the first kernel, the sources that follow it move up */
+      for (n = bc->num_sources_; n && (bc->sources_[n - 1].code_offset_ > bcb->compact_start_); --n) {
+        bc->sources_[n - 1].code_offset_ += num_header;
+      }
+      header = bc->code_ + bcb->compact_start_;
+      header[0] = SLBC_COMPACT;
+      header[1] = (int)(num_header - 2);
+      header[2] = bcb->compact_chain_->external_id_;
+      header[3] = (int)bc->num_code_;
+      for (n = 0; n < bcb->num_compact_regs_; ++n) {
+        num_per_bank[bcb->compact_regs_[n].bank_]++;
+      }
+      header[4] = num_per_bank[0];
+      header[5] = num_per_bank[1];
+      header[6] = num_per_bank[2];
+      header += 7;
+      for (bank = 0; bank < 3; ++bank) {
+        for (n = 0; n < bcb->num_compact_regs_; ++n) {
+          if (bcb->compact_regs_[n].bank_ != bank) continue;
+          *header++ = (bcb->compact_regs_[n].reg_ << SL_BYTECODE_COMPACT_FLAG_BITS) | bcb->compact_regs_[n].flags_;
+        }
+      }
+    }
+  }
+  bcb->compact_chain_ = NULL;
+  bcb->compact_num_kernels_ = 0;
+  bcb->num_compact_regs_ = 0;
+  return r;
+}
+
+int sl_bytecode_from_ir(struct sl_bytecode *bc, struct ir_body *body, struct ir_temp *exec_chain, struct ir_temp *discard_chain,
+                        uint8_t *float_uniform_flags, size_t num_float_regs) {
+  int r = 0;
+  struct sl_bytecode_builder bcb;
+  struct ir_block *blk;
+  size_t n;
+
+  bc->num_code_ = 0;
+  bc->num_lits_ = 0;
+  bc->num_ptrs_ = 0;
+  bc->num_sources_ = 0;
+  bc->num_chains_ = 0;
+
+  bcb.bc_ = bc;
+  bcb.num_fixups_ = bcb.num_fixups_allocated_ = 0;
+  bcb.fixups_ = NULL;
+  bcb.num_blocks_ = 0;
+  bcb.block_offsets_ = NULL;
+  bcb.float_uniform_flags_ = float_uniform_flags;
+  bcb.num_float_regs_ = float_uniform_flags ? num_float_regs : 0;
+  bcb.compact_chain_ = NULL;
+  bcb.compact_start_ = 0;
+  bcb.compact_num_kernels_ = 0;
+  bcb.num_compact_regs_ = bcb.num_compact_regs_allocated_ = 0;
+  bcb.compact_regs_ = NULL;
+
+  if (!body->blocks_) return -1;
+  bcb.num_blocks_ = (size_t)body->blocks_->prev_in_body_->serial_num_;
+  bcb.block_offsets_ = (size_t *)malloc(sizeof(size_t) * bcb.num_blocks_);
+  if (!bcb.block_offsets_) return -1;
+
+  blk = body->blocks_;
+  do {
+    struct ir_instr *instr = blk->instructions_;
+    bcb.block_offsets_[blk->serial_num_ - 1] = bc->num_code_;
+    if (instr) {
+      do {
+        struct ir_instr *next = (instr->next_in_block_ != blk->instructions_) ? instr->next_in_block_ : NULL;
+        int compactable = sl_bytecode_is_compactable(instr);
+        if (!compactable || (instr->args_[0]->temp_ != bcb.compact_chain_)) {
+          /* Series of compactable kernels on the same chain ends */
+          r = sl_bytecode_compact_end(&bcb);
+          if (r) break;
+          if (compactable) {
+            bcb.compact_chain_ = instr->args_[0]->temp_;
+            bcb.compact_start_ = bc->num_code_;
+          }
+        }
+        r = sl_bytecode_append_source(bc, instr);
+        if (r) break;
+        switch (instr->instruction_code_) {
+          case GIR_COMPARE:
+            /* Fuse with the GIR_BRANCH_NOT_EQUAL that follows it; the two are always emitted as a pair.
+             * [GIR_BRANCH_NOT_EQUAL, 4, chain, literal, target_not_equal, target_equal] */
+            if (!next || (next->instruction_code_ != GIR_BRANCH_NOT_EQUAL) || (instr->num_args_ != 2) || (next->num_args_ != 2)) {
+              r = -1;
+              break;
+            }
+            r = sl_bytecode_append_code(bc, GIR_BRANCH_NOT_EQUAL);
+            r = r ? r : sl_bytecode_append_code(bc, 4);
+            r = r ? r : sl_bytecode_append_operand(&bcb, GIR_COMPARE, 0, instr->args_[0]->temp_);
+            r = r ? r : sl_bytecode_append_operand(&bcb, GIR_COMPARE, 1, instr->args_[1]->temp_);
+            r = r ? r : sl_bytecode_append_operand(&bcb, GIR_BRANCH_NOT_EQUAL, 0, next->args_[0]->temp_);
+            r = r ? r : sl_bytecode_append_operand(&bcb, GIR_BRANCH_NOT_EQUAL, 1, next->args_[1]->temp_);
+            next = (next->next_in_block_ != blk->instructions_) ? next->next_in_block_ : NULL;
+            break;
+          case GIR_JUMP:
+            /* Elide jumps to the block that immediately follows */
+            if ((instr->num_args_ == 1) && instr->args_[0]->temp_ && (instr->args_[0]->temp_->kind_ == IR_BLOCK_ENTRY) &&
+                (instr->args_[0]->temp_->entry_point_block_ == blk->next_in_body_) && (blk->next_in_body_ != body->blocks_)) {
+              break;
+            }
+            r = sl_bytecode_append_instr(&bcb, instr);
+            break;
+          case GIR_MOVE: {
+            /* Chain move, either from another chain or from a literal (always SL_EXEC_NO_CHAIN);
+             * [GIR_MOVE, 3, dst, src_chain or -1, literal] */
+            struct ir_temp *src = (instr->num_args_ == 2) ? instr->args_[1]->temp_ : NULL;
+            if (!src) {
+              r = -1;
+              break;
+            }
+            r = sl_bytecode_append_code(bc, GIR_MOVE);
+            r = r ? r : sl_bytecode_append_code(bc, 3);
+            r = r ? r : sl_bytecode_append_operand(&bcb, GIR_MOVE, 0, instr->args_[0]->temp_);
+            if (src->kind_ == IR_VIRTUAL) {
+              r = r ? r : sl_bytecode_append_operand(&bcb, GIR_MOVE, 1, src);
+              r = r ? r : sl_bytecode_append_code(bc, 0);
+            }
+            else {
+              r = r ? r : sl_bytecode_append_code(bc, -1);
+              r = r ? r : sl_bytecode_append_operand(&bcb, GIR_MOVE, 1, src);
+            }
+            break;
+          }
+          default:
+            r = sl_bytecode_append_uniform_instr(&bcb, instr);
+            if (!r && compactable) r = sl_bytecode_compact_add_instr(&bcb, instr);
+            break;
+        }
+        instr = next;
+      } while (!r && instr);
+    }
+    if (!r) r = sl_bytecode_compact_end(&bcb);
+    blk = blk->next_in_body_;
+  } while (!r && (blk != body->blocks_));
+
+  for (n = 0; !r && (n < bcb.num_fixups_); ++n) {
+    struct ir_block *target = bcb.fixups_[n].blk_;
+    if (!target || (target->serial_num_ < 1) || ((size_t)target->serial_num_ > bcb.num_blocks_)) {
+      r = -1;
+      break;
+    }
+    bc->code_[bcb.fixups_[n].code_index_] = (int)bcb.block_offsets_[target->serial_num_ - 1];
+  }
+
+  if (!r && ((exec_chain->kind_ != IR_VIRTUAL) || (discard_chain->kind_ != IR_VIRTUAL))) r = -1;
+  if (!r) {
+    bc->exec_chain_ = exec_chain->external_id_;
+    bc->discard_chain_ = discard_chain->external_id_;
+    if ((size_t)bc->exec_chain_ >= bc->num_chains_) bc->num_chains_ = (size_t)bc->exec_chain_ + 1;
+    if ((size_t)bc->discard_chain_ >= bc->num_chains_) bc->num_chains_ = (size_t)bc->discard_chain_ + 1;
+  }
+
+  if (bcb.fixups_) free(bcb.fixups_);
+  if (bcb.block_offsets_) free(bcb.block_offsets_);
+  if (bcb.compact_regs_) free(bcb.compact_regs_);
+  return r;
+}
+
+int sl_bytecode_compile(struct sl_bytecode *bc, struct sl_compilation_unit *cu, struct sl_function *f,
+                        uint8_t *float_uniform_flags, size_t num_float_regs, size_t inline_threshold,
+                        size_t unroll_max_size, int opt_passes, const struct sl_ir_opt_constant *constants,
+                        size_t num_constants, FILE *opt_dump_fp) {
+  int r;
+  struct ir_body body;
+  struct ir_temp *exec_chain = NULL, *discard_chain = NULL;
+  struct sl_ir_opt_stats opt_stats;
+  ir_body_init(&body);
+  r = sl_ir_lower_function(&body, cu, f, inline_threshold, unroll_max_size, &exec_chain, &discard_chain);
+  r = r ? r : sl_ir_optimize(&body, cu, opt_passes, constants, num_constants, opt_dump_fp, &opt_stats);
+  r = r ? r : sl_bytecode_from_ir(bc, &body, exec_chain, discard_chain, float_uniform_flags, num_float_regs);
+  if (!r) {
+    bc->register_counts_ = opt_stats.reg_counts_after_;
+    memcpy(bc->num_fused_, opt_stats.num_fused_, sizeof(bc->num_fused_));
+  }
+  bc->f_ = r ? NULL : f;
+  ir_body_cleanup(&body);
+  return r;
+}
+
+#define FREG(n) exec->float_regs_[n]
+#define IREG(n) exec->int_regs_[n]
+#define BREG(n) exec->bool_regs_[n]
+#define FUNI(n) exec->float_uniforms_[n]
+
+/* Runs the matrix product instruction_code (SLIR_XXX_MUL_XXX, or the SLBC_XXX_MUL_XXX_SC or _CS substituted for it)
+ * for the rows of the chain from row, or, if mask is not NULL, for the rows in mask. Returns non-zero if
+ * instruction_code is not a matrix product. */
+static int sl_bytecode_exec_matrix_product(struct sl_execution *exec, int instruction_code, sl_exec_row_t row, const uint64_t *mask, const int *args) {
+  float *result_columns[16];
+  const float *left_columns[16];
+  const float *right_columns[16];
+  float left_scalars[16];
+  float right_scalars[16];
+  int scalar_left = 0, scalar_right = 0;
+  int num_rows, inner, num_cols, n;
+  const int *left_args, *right_args;
+  if ((instruction_code >= SLBC_MAT2_MUL_VEC2_SC) && (instruction_code <= SLBC_MAT4_MUL_MAT4_SC)) {
+    instruction_code = SLIR_MAT2_MUL_VEC2 + (instruction_code - SLBC_MAT2_MUL_VEC2_SC);
+    scalar_left = 1;
+  }
+  else if ((instruction_code >= SLBC_MAT2_MUL_VEC2_CS) && (instruction_code <= SLBC_MAT4_MUL_MAT4_CS)) {
+    instruction_code = SLIR_MAT2_MUL_VEC2 + (instruction_code - SLBC_MAT2_MUL_VEC2_CS);
+    scalar_right = 1;
+  }
+  if (!sl_ir_matrix_product_shape(instruction_code, &num_rows, &inner, &num_cols)) return -1;
+  left_args = args + num_rows * num_cols;
+  right_args = left_args + num_rows * inner;
+  for (n = 0; n < num_rows * num_cols; ++n) {
+    result_columns[n] = FREG(args[n]);
+  }
+  for (n = 0; n < num_rows * inner; ++n) {
+    if (scalar_left) left_scalars[n] = FUNI(left_args[n]);
+    else left_columns[n] = FREG(left_args[n]);
+  }
+  for (n = 0; n < inner * num_cols; ++n) {
+    if (scalar_right) right_scalars[n] = FUNI(right_args[n]);
+    else right_columns[n] = FREG(right_args[n]);
+  }
+  if (mask) {
+    sl_exec_f_matrix_product_masked(mask, num_rows, inner, num_cols, result_columns,
+                                    left_columns, scalar_left ? left_scalars : NULL, right_columns, scalar_right ? right_scalars : NULL);
+  }
+  else {
+    sl_exec_f_matrix_product(row, exec->exec_chain_reg_, num_rows, inner, num_cols, result_columns,
+                             left_columns, scalar_left ? left_scalars : NULL, right_columns, scalar_right ? right_scalars : NULL);
+  }
+  return 0;
+}
+
+void sl_bytecode_exec_kernel(struct sl_bytecode *bc, struct sl_execution *exec, int instruction_code, sl_exec_row_t row, const int *args) {
+  sl_exec_row_t *restrict chain_column = exec->exec_chain_reg_;
+  switch (instruction_code) {
+    case SLIR_NEG_F: sl_exec_f_negate(row, chain_column, FREG(args[0]), FREG(args[1])); break;
+    case SLIR_NEG_I: sl_exec_i_negate(row, chain_column, IREG(args[0]), IREG(args[1])); break;
+    case SLIR_NOT: sl_exec_b_logical_not(row, chain_column, BREG(args[0]), BREG(args[1])); break;
+    case SLIR_MUL_F: sl_exec_f_mul(row, chain_column, FREG(args[0]), FREG(args[1]), FREG(args[2])); break;
+    case SLIR_MUL_I: sl_exec_i_mul(row, chain_column, IREG(args[0]), IREG(args[1]), IREG(args[2])); break;
+    case SLIR_DOT2: sl_exec_f_dot_product2(row, chain_column, FREG(args[0]), FREG(args[1]), FREG(args[2]), FREG(args[3]), FREG(args[4])); break;
+    case SLIR_DOT3: sl_exec_f_dot_product3(row, chain_column, FREG(args[0]), FREG(args[1]), FREG(args[2]), FREG(args[3]),
+                                           FREG(args[4]), FREG(args[5]), FREG(args[6])); break;
+    case SLIR_DOT4: sl_exec_f_dot_product4(row, chain_column, FREG(args[0]), FREG(args[1]), FREG(args[2]), FREG(args[3]), FREG(args[4]),
+                                           FREG(args[5]), FREG(args[6]), FREG(args[7]), FREG(args[8])); break;
+    case SLIR_MAX_F: sl_exec_f_max(row, chain_column, FREG(args[0]), FREG(args[1]), FREG(args[2])); break;
+    case SLIR_CLAMP_F: sl_exec_f_clamp(row, chain_column, FREG(args[0]), FREG(args[1]), FREG(args[2]), FREG(args[3])); break;
+    case SLIR_MIX_F: sl_exec_f_mix(row, chain_column, FREG(args[0]), FREG(args[1]), FREG(args[2]), FREG(args[3])); break;
+    case SLIR_MAD_F: sl_exec_f_mad(row, chain_column, FREG(args[0]), FREG(args[1]), FREG(args[2]), FREG(args[3])); break;
+    case SLIR_LERP_F: sl_exec_f_lerp(row, chain_column, FREG(args[0]), FREG(args[1]), FREG(args[2]), FREG(args[3])); break;
+    case SLIR_DOT2_MAX_F: sl_exec_f_dot_product2_clamp(row, chain_column, FREG(args[0]), FREG(args[1]), FREG(args[2]), FREG(args[3]), FREG(args[4]),
+                                                       FREG(args[5]), NULL); break;
+    case SLIR_DOT3_MAX_F: sl_exec_f_dot_product3_clamp(row, chain_column, FREG(args[0]), FREG(args[1]), FREG(args[2]), FREG(args[3]), FREG(args[4]), FREG(args[5]), FREG(args[6]),
+                                                       FREG(args[7]), NULL); break;
+    case SLIR_DOT4_MAX_F: sl_exec_f_dot_product4_clamp(row, chain_column, FREG(args[0]), FREG(args[1]), FREG(args[2]), FREG(args[3]), FREG(args[4]), FREG(args[5]), FREG(args[6]), FREG(args[7]), FREG(args[8]),
+                                                       FREG(args[9]), NULL); break;
+    case SLIR_DOT2_CLAMP_F: sl_exec_f_dot_product2_clamp(row, chain_column, FREG(args[0]), FREG(args[1]), FREG(args[2]), FREG(args[3]), FREG(args[4]),
+                                                         FREG(args[5]), FREG(args[6])); break;
+    case SLIR_DOT3_CLAMP_F: sl_exec_f_dot_product3_clamp(row, chain_column, FREG(args[0]), FREG(args[1]), FREG(args[2]), FREG(args[3]), FREG(args[4]), FREG(args[5]), FREG(args[6]),
+                                                         FREG(args[7]), FREG(args[8])); break;
+    case SLIR_DOT4_CLAMP_F: sl_exec_f_dot_product4_clamp(row, chain_column, FREG(args[0]), FREG(args[1]), FREG(args[2]), FREG(args[3]), FREG(args[4]), FREG(args[5]), FREG(args[6]), FREG(args[7]), FREG(args[8]),
+                                                         FREG(args[9]), FREG(args[10])); break;
+    case SLIR_DIV_F: sl_exec_f_div(row, chain_column, FREG(args[0]), FREG(args[1]), FREG(args[2])); break;
+    case SLIR_DIV_I: sl_exec_i_div(row, chain_column, IREG(args[0]), IREG(args[1]), IREG(args[2])); break;
+    case SLIR_ADD_F: sl_exec_f_add(row, chain_column, FREG(args[0]), FREG(args[1]), FREG(args[2])); break;
+    case SLIR_ADD_I: sl_exec_i_add(row, chain_column, IREG(args[0]), IREG(args[1]), IREG(args[2])); break;
+    case SLIR_SUB_F: sl_exec_f_sub(row, chain_column, FREG(args[0]), FREG(args[1]), FREG(args[2])); break;
+    case SLIR_SUB_I: sl_exec_i_sub(row, chain_column, IREG(args[0]), IREG(args[1]), IREG(args[2])); break;
+    case SLIR_LT_F: sl_exec_f_lt(row, chain_column, BREG(args[0]), FREG(args[1]), FREG(args[2])); break;
+    case SLIR_LT_I: sl_exec_i_lt(row, chain_column, BREG(args[0]), IREG(args[1]), IREG(args[2])); break;
+    case SLIR_LE_F: sl_exec_f_le(row, chain_column, BREG(args[0]), FREG(args[1]), FREG(args[2])); break;
+    case SLIR_LE_I: sl_exec_i_le(row, chain_column, BREG(args[0]), IREG(args[1]), IREG(args[2])); break;
+    case SLIR_GE_F: sl_exec_f_ge(row, chain_column, BREG(args[0]), FREG(args[1]), FREG(args[2])); break;
+    case SLIR_GE_I: sl_exec_i_ge(row, chain_column, BREG(args[0]), IREG(args[1]), IREG(args[2])); break;
+    case SLIR_GT_F: sl_exec_f_gt(row, chain_column, BREG(args[0]), FREG(args[1]), FREG(args[2])); break;
+    case SLIR_GT_I: sl_exec_i_gt(row, chain_column, BREG(args[0]), IREG(args[1]), IREG(args[2])); break;
+    case SLIR_EQ_F: sl_exec_f_eq(row, chain_column, BREG(args[0]), FREG(args[1]), FREG(args[2])); break;
+    case SLIR_EQ_I: sl_exec_i_eq(row, chain_column, BREG(args[0]), IREG(args[1]), IREG(args[2])); break;
+    case SLIR_NE_F: sl_exec_f_ne(row, chain_column, BREG(args[0]), FREG(args[1]), FREG(args[2])); break;
+    case SLIR_NE_I: sl_exec_i_ne(row, chain_column, BREG(args[0]), IREG(args[1]), IREG(args[2])); break;
+    case SLIR_LOG_XOR: sl_exec_logical_or(row, chain_column, BREG(args[0]), BREG(args[1]), BREG(args[2])); break;
+    case SLIR_DEC_F: sl_exec_f_decrement(row, chain_column, FREG(args[0]), FREG(args[1])); break;
+    case SLIR_DEC_I: sl_exec_i_decrement(row, chain_column, IREG(args[0]), IREG(args[1])); break;
+    case SLIR_INC_F: sl_exec_f_increment(row, chain_column, FREG(args[0]), FREG(args[1])); break;
+    case SLIR_INC_I: sl_exec_i_increment(row, chain_column, IREG(args[0]), IREG(args[1])); break;
+    case SLIR_INIT_LIT_F: {
+      float f;
+      memcpy(&f, args + 1, sizeof(f));
+      sl_exec_f_init(row, chain_column, FREG(args[0]), f);
+      break;
+    }
+    case SLIR_INIT_LIT_I: sl_exec_i_init(row, chain_column, IREG(args[0]), (sl_exec_int_t)bc->lits_[args[1]]); break;
+    case SLIR_INIT_LIT_B: sl_exec_b_init(row, chain_column, BREG(args[0]), (uint8_t)args[1]); break;
+    case SLIR_MUL_C_AND_ADD: sl_exec_i_mul_constant_and_add(row, chain_column, IREG(args[0]), IREG(args[1]), IREG(args[3]), (sl_exec_int_t)bc->lits_[args[2]]); break;
+    case SLIR_PICK_FROM_2:
+    case SLIR_PICK_FROM_3:
+    case SLIR_PICK_FROM_4: {
+      sl_exec_int_t choices[4];
+      int n, num_choices = 2 + instruction_code - SLIR_PICK_FROM_2;
+      for (n = 0; n < num_choices; ++n) {
+        choices[n] = args[2 + n];
+      }
+      sl_exec_i_pick(row, chain_column, IREG(args[0]), IREG(args[1]), choices);
+      break;
+    }
+    case SLIR_PICK_FROM_2_INDIRECT:
+    case SLIR_PICK_FROM_3_INDIRECT:
+    case SLIR_PICK_FROM_4_INDIRECT: {
+      sl_exec_int_t *choice_columns[4];
+      int n, num_choices = 2 + instruction_code - SLIR_PICK_FROM_2_INDIRECT;
+      for (n = 0; n < num_choices; ++n) {
+        choice_columns[n] = IREG(args[2 + n]);
+      }
+      sl_exec_i_pick_indirect(row, chain_column, IREG(args[0]), IREG(args[1]), choice_columns);
+      break;
+    }
+    case SLIR_CALL_BUILTIN: {
+      /* Builtins resolve their registers relative to the top execution frame; point it at the frame
+       * the call was inlined into. */
+      struct sl_expr *x = (struct sl_expr *)bc->ptrs_[args[0]];
+      struct sl_execution_frame *ef = exec->execution_frames_ + exec->num_execution_frames_ - 1;
+      struct sl_execution_frame saved_frame = *ef;
+      ef->local_float_offset_ = args[1];
+      ef->local_int_offset_ = args[2];
+      ef->local_bool_offset_ = args[3];
+      ef->local_sampler2D_offset_ = args[4];
+      ef->local_samplerCube_offset_ = args[5];
+      x->function_->builtin_runtime_fn_(exec, row, x);
+      *ef = saved_frame;
+      break;
+    }
+    case SLBC_ADD_F_CS: sl_exec_f_add_scalar(row, chain_column, FREG(args[0]), FREG(args[1]), FUNI(args[2])); break;
+    case SLBC_ADD_F_SS: sl_exec_f_init(row, chain_column, FREG(args[0]), FUNI(args[1]) + FUNI(args[2])); break;
+    case SLBC_SUB_F_CS: sl_exec_f_sub_scalar(row, chain_column, FREG(args[0]), FREG(args[1]), FUNI(args[2])); break;
+    case SLBC_SUB_F_SC: sl_exec_f_scalar_sub(row, chain_column, FREG(args[0]), FUNI(args[1]), FREG(args[2])); break;
+    case SLBC_SUB_F_SS: sl_exec_f_init(row, chain_column, FREG(args[0]), FUNI(args[1]) - FUNI(args[2])); break;
+    case SLBC_MUL_F_CS: sl_exec_f_mul_scalar(row, chain_column, FREG(args[0]), FREG(args[1]), FUNI(args[2])); break;
+    case SLBC_MUL_F_SS: sl_exec_f_init(row, chain_column, FREG(args[0]), FUNI(args[1]) * FUNI(args[2])); break;
+    case SLBC_DIV_F_CS: sl_exec_f_div_scalar(row, chain_column, FREG(args[0]), FREG(args[1]), FUNI(args[2])); break;
+    case SLBC_DIV_F_SC: sl_exec_f_scalar_div(row, chain_column, FREG(args[0]), FUNI(args[1]), FREG(args[2])); break;
+    case SLBC_DIV_F_SS: sl_exec_f_init(row, chain_column, FREG(args[0]), FUNI(args[1]) / FUNI(args[2])); break;
+    case SLBC_DOT2_SC: sl_exec_f_scalar_dot_product2(row, chain_column, FREG(args[0]), FUNI(args[1]), FUNI(args[2]), FREG(args[3]), FREG(args[4])); break;
+    case SLBC_DOT3_SC: sl_exec_f_scalar_dot_product3(row, chain_column, FREG(args[0]), FUNI(args[1]), FUNI(args[2]), FUNI(args[3]),
+                                                     FREG(args[4]), FREG(args[5]), FREG(args[6])); break;
+    case SLBC_DOT4_SC: sl_exec_f_scalar_dot_product4(row, chain_column, FREG(args[0]), FUNI(args[1]), FUNI(args[2]), FUNI(args[3]), FUNI(args[4]),
+                                                     FREG(args[5]), FREG(args[6]), FREG(args[7]), FREG(args[8])); break;
+    case SLBC_MOVE_F_SCALAR_TO_REG: sl_exec_f_init(row, chain_column, FREG(args[0]), FUNI(args[1])); break;
+    case SLBC_MOVE_F_SCALAR_OFFSET_TO_REG:
+      sl_exec_f_gather_scalars(row, chain_column, FREG(args[0]), exec->float_uniforms_, args[1] + args[3], IREG(args[2]), args[4]);
+      break;
+    default:
+      if ((instruction_code >= SLIR_REG_MOVE_F_REG_TO_REG) && (instruction_code <= SLIR_REG_MOVE_SC_INDIR_OFFSET_TO_INDIR_OFFSET)) {
+        sl_reg_move_instr(exec, row, instruction_code, args);
+      }
+      else {
+        sl_bytecode_exec_matrix_product(exec, instruction_code, row, NULL, args);
+      }
+      break;
+  }
+}
+
+sl_bytecode_kernel_fn_t sl_bytecode_direct_kernel(int instruction_code, const char **pbanks) {
+#define SL_BYTECODE_KERNEL(fn, banks) *pbanks = banks; return (sl_bytecode_kernel_fn_t)fn
+  switch (instruction_code) {
+    case SLIR_NEG_F: SL_BYTECODE_KERNEL(sl_exec_f_negate, "ff");
+    case SLIR_NEG_I: SL_BYTECODE_KERNEL(sl_exec_i_negate, "ii");
+    case SLIR_NOT: SL_BYTECODE_KERNEL(sl_exec_b_logical_not, "bb");
+    case SLIR_MUL_F: SL_BYTECODE_KERNEL(sl_exec_f_mul, "fff");
+    case SLIR_MUL_I: SL_BYTECODE_KERNEL(sl_exec_i_mul, "iii");
+    case SLIR_DOT2: SL_BYTECODE_KERNEL(sl_exec_f_dot_product2, "fffff");
+    case SLIR_DOT3: SL_BYTECODE_KERNEL(sl_exec_f_dot_product3, "fffffff");
+    case SLIR_DOT4: SL_BYTECODE_KERNEL(sl_exec_f_dot_product4, "fffffffff");
+    case SLIR_MAX_F: SL_BYTECODE_KERNEL(sl_exec_f_max, "fff");
+    case SLIR_CLAMP_F: SL_BYTECODE_KERNEL(sl_exec_f_clamp, "ffff");
+    case SLIR_MIX_F: SL_BYTECODE_KERNEL(sl_exec_f_mix, "ffff");
+    case SLIR_MAD_F: SL_BYTECODE_KERNEL(sl_exec_f_mad, "ffff");
+    case SLIR_LERP_F: SL_BYTECODE_KERNEL(sl_exec_f_lerp, "ffff");
+    case SLIR_DOT2_MAX_F: SL_BYTECODE_KERNEL(sl_exec_f_dot_product2_clamp, "ffffff0");
+    case SLIR_DOT3_MAX_F: SL_BYTECODE_KERNEL(sl_exec_f_dot_product3_clamp, "ffffffff0");
+    case SLIR_DOT4_MAX_F: SL_BYTECODE_KERNEL(sl_exec_f_dot_product4_clamp, "ffffffffff0");
+    case SLIR_DOT2_CLAMP_F: SL_BYTECODE_KERNEL(sl_exec_f_dot_product2_clamp, "fffffff");
+    case SLIR_DOT3_CLAMP_F: SL_BYTECODE_KERNEL(sl_exec_f_dot_product3_clamp, "fffffffff");
+    case SLIR_DOT4_CLAMP_F: SL_BYTECODE_KERNEL(sl_exec_f_dot_product4_clamp, "fffffffffff");
+    case SLIR_DIV_F: SL_BYTECODE_KERNEL(sl_exec_f_div, "fff");
+    case SLIR_DIV_I: SL_BYTECODE_KERNEL(sl_exec_i_div, "iii");
+    case SLIR_ADD_F: SL_BYTECODE_KERNEL(sl_exec_f_add, "fff");
+    case SLIR_ADD_I: SL_BYTECODE_KERNEL(sl_exec_i_add, "iii");
+    case SLIR_SUB_F: SL_BYTECODE_KERNEL(sl_exec_f_sub, "fff");
+    case SLIR_SUB_I: SL_BYTECODE_KERNEL(sl_exec_i_sub, "iii");
+    case SLIR_LT_F: SL_BYTECODE_KERNEL(sl_exec_f_lt, "bff");
+    case SLIR_LT_I: SL_BYTECODE_KERNEL(sl_exec_i_lt, "bii");
+    case SLIR_LE_F: SL_BYTECODE_KERNEL(sl_exec_f_le, "bff");
+    case SLIR_LE_I: SL_BYTECODE_KERNEL(sl_exec_i_le, "bii");
+    case SLIR_GE_F: SL_BYTECODE_KERNEL(sl_exec_f_ge, "bff");
+    case SLIR_GE_I: SL_BYTECODE_KERNEL(sl_exec_i_ge, "bii");
+    case SLIR_GT_F: SL_BYTECODE_KERNEL(sl_exec_f_gt, "bff");
+    case SLIR_GT_I: SL_BYTECODE_KERNEL(sl_exec_i_gt, "bii");
+    case SLIR_EQ_F: SL_BYTECODE_KERNEL(sl_exec_f_eq, "bff");
+    case SLIR_EQ_I: SL_BYTECODE_KERNEL(sl_exec_i_eq, "bii");
+    case SLIR_NE_F: SL_BYTECODE_KERNEL(sl_exec_f_ne, "bff");
+    case SLIR_NE_I: SL_BYTECODE_KERNEL(sl_exec_i_ne, "bii");
+    case SLIR_LOG_XOR: SL_BYTECODE_KERNEL(sl_exec_logical_or, "bbb");
+    case SLIR_DEC_F: SL_BYTECODE_KERNEL(sl_exec_f_decrement, "ff");
+    case SLIR_DEC_I: SL_BYTECODE_KERNEL(sl_exec_i_decrement, "ii");
+    case SLIR_INC_F: SL_BYTECODE_KERNEL(sl_exec_f_increment, "ff");
+    case SLIR_INC_I: SL_BYTECODE_KERNEL(sl_exec_i_increment, "ii");
+    default:
+      return NULL;
+  }
+#undef SL_BYTECODE_KERNEL
+}
+
+int sl_bytecode_reserve_chains(const struct sl_bytecode *bc, struct sl_execution *exec) {
+  uint32_t *chains;
+  uint64_t *masks;
+  uint8_t *flags;
+  if (exec->num_bc_chains_allocated_ >= bc->num_chains_) return 0;
+  if (bc->num_chains_ > (SIZE_MAX / (sizeof(uint64_t) * SL_BYTECODE_MASK_WORDS))) return -1;
+  chains = (uint32_t *)malloc(sizeof(uint32_t) * bc->num_chains_);
+  masks = (uint64_t *)malloc(sizeof(uint64_t) * SL_BYTECODE_MASK_WORDS * bc->num_chains_);
+  flags = (uint8_t *)malloc(sizeof(uint8_t) * bc->num_chains_);
+  if (!chains || !masks || !flags) {
+    if (chains) free(chains);
+    if (masks) free(masks);
+    if (flags) free(flags);
+    return -1;
+  }
+  if (exec->bc_chains_) free(exec->bc_chains_);
+  if (exec->bc_masks_) free(exec->bc_masks_);
+  if (exec->bc_chain_flags_) free(exec->bc_chain_flags_);
+  exec->bc_chains_ = chains;
+  exec->bc_masks_ = masks;
+  exec->bc_chain_flags_ = flags;
+  exec->num_bc_chains_allocated_ = bc->num_chains_;
+  return 0;
+}
+
+void sl_bytecode_exec_chain_instr(struct sl_bytecode *bc, struct sl_execution *exec, const int *instr) {
+  uint32_t *chains = exec->bc_chains_;
+  const int *args = instr + 2;
+  if (instr[0] == SLIR_SPLIT_EXEC_CHAIN_BY_CONDITION) {
+    uint32_t true_chain, false_chain;
+    sl_exec_split_chains(exec, exec->bool_regs_[args[2]], chains[args[3]], &true_chain, &false_chain);
+    chains[args[0]] = true_chain;
+    chains[args[1]] = false_chain;
+  }
+  else if (instr[0] == SLIR_SPLIT_EXEC_CHAIN_BY_UNIFORM_CONDITION) {
+    uint32_t true_chain, false_chain;
+    sl_exec_split_chains_uniform(exec, exec->bool_regs_[args[2]], chains[args[3]], &true_chain, &false_chain);
+    chains[args[0]] = true_chain;
+    chains[args[1]] = false_chain;
+  }
+  else if (instr[0] == SLIR_JOIN_EXEC_CHAINS) {
+    chains[args[0]] = sl_exec_join_chains(exec, chains[args[1]], chains[args[2]]);
+  }
+}
+
+const struct sl_bytecode_source *sl_bytecode_source_at(const struct sl_bytecode *bc, size_t pc) {
+  /* Last source starting at or before pc */
+  size_t lo = 0, hi = bc->num_sources_;
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (bc->sources_[mid].code_offset_ <= pc) lo = mid + 1;
+    else hi = mid;
+  }
+  if (!lo || !bc->sources_[lo - 1].node_) return NULL;
+  return bc->sources_ + lo - 1;
+}
+
+void sl_bytecode_profile_enter(struct sl_bytecode *bc, struct sl_execution *exec, const int *pc, uint32_t chain, const uint64_t *mask) {
+  const struct sl_bytecode_source *src;
+  struct sl_profile_node *pn;
+  exec->bc_profile_node_index_ = SIZE_MAX;
+  if (!exec->profile_) return;
+  src = sl_bytecode_source_at(bc, (size_t)(pc - bc->code_));
+  pn = src ? sl_profile_node_at_line(exec->profile_, src->node_, src->line_) : NULL;
+  if (pn) {
+    if (!exec->bc_profile_source_ || (exec->bc_profile_source_->node_ != src->node_)) {
+      if (mask) sl_profile_count_mask(pn, mask, SL_BYTECODE_MASK_WORDS);
+      else if (chain != SL_EXEC_NO_CHAIN) sl_profile_count_rows(pn, exec->exec_chain_reg_, chain);
+    }
+    exec->bc_profile_node_index_ = (size_t)(pn - exec->profile_->nodes_);
+  }
+  /* Only instructions that count rows start an invocation */
+  if (mask || (chain != SL_EXEC_NO_CHAIN)) exec->bc_profile_source_ = src;
+  exec->bc_profile_start_ = sl_profile_cycles();
+}
+
+void sl_bytecode_profile_leave(struct sl_execution *exec) {
+  if (!exec->profile_ || (exec->bc_profile_node_index_ == SIZE_MAX)) return;
+  exec->profile_->nodes_[exec->bc_profile_node_index_].cycles_ += sl_profile_cycles() - exec->bc_profile_start_;
+}
+
+static int sl_bytecode_ctz64(uint64_t v) {
+#if defined(_MSC_VER) && defined(_M_X64)
+  unsigned long index;
+  _BitScanForward64(&index, v);
+  return (int)index;
+#elif defined(__GNUC__) || defined(__clang__)
+  return __builtin_ctzll(v);
+#else
+  int n = 0;
+  while (!(v & 1)) {
+    v >>= 1;
+    n++;
+  }
+  return n;
+#endif
+}
+
+static int sl_bytecode_popcount64(uint64_t v) {
+  v = v - ((v >> 1) & 0x5555555555555555ULL);
+  v = (v & 0x3333333333333333ULL) + ((v >> 2) & 0x3333333333333333ULL);
+  v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+  return (int)((v * 0x0101010101010101ULL) >> 56);
+}
+
+/* Executes the masked variant of the kernel instruction for the rows in mask; returns 0 if executed, non-zero
+ * if the instruction has no masked variant. */
+static int sl_bytecode_exec_masked_kernel(struct sl_bytecode *bc, struct sl_execution *exec, int instruction_code, const uint64_t *mask, const int *args) {
+  switch (instruction_code) {
+    case SLIR_NEG_F: sl_exec_f_negate_masked(mask, FREG(args[0]), FREG(args[1])); return 0;
+    case SLIR_MUL_F: sl_exec_f_mul_masked(mask, FREG(args[0]), FREG(args[1]), FREG(args[2])); return 0;
+    case SLIR_DOT2: sl_exec_f_dot_product2_masked(mask, FREG(args[0]), FREG(args[1]), FREG(args[2]), FREG(args[3]), FREG(args[4])); return 0;
+    case SLIR_DOT3: sl_exec_f_dot_product3_masked(mask, FREG(args[0]), FREG(args[1]), FREG(args[2]), FREG(args[3]),
+                                                  FREG(args[4]), FREG(args[5]), FREG(args[6])); return 0;
+    case SLIR_DOT4: sl_exec_f_dot_product4_masked(mask, FREG(args[0]), FREG(args[1]), FREG(args[2]), FREG(args[3]), FREG(args[4]),
+                                                  FREG(args[5]), FREG(args[6]), FREG(args[7]), FREG(args[8])); return 0;
+    case SLIR_MAX_F: sl_exec_f_max_masked(mask, FREG(args[0]), FREG(args[1]), FREG(args[2])); return 0;
+    case SLIR_MAD_F: sl_exec_f_mad_masked(mask, FREG(args[0]), FREG(args[1]), FREG(args[2]), FREG(args[3])); return 0;
+    case SLIR_LERP_F: sl_exec_f_lerp_masked(mask, FREG(args[0]), FREG(args[1]), FREG(args[2]), FREG(args[3])); return 0;
+    case SLIR_DOT2_MAX_F: sl_exec_f_dot_product2_clamp_masked(mask, FREG(args[0]), FREG(args[1]), FREG(args[2]), FREG(args[3]), FREG(args[4]),
+                                                              FREG(args[5]), NULL); return 0;
+    case SLIR_DOT3_MAX_F: sl_exec_f_dot_product3_clamp_masked(mask, FREG(args[0]), FREG(args[1]), FREG(args[2]), FREG(args[3]), FREG(args[4]), FREG(args[5]), FREG(args[6]),
+                                                              FREG(args[7]), NULL); return 0;
+    case SLIR_DOT4_MAX_F: sl_exec_f_dot_product4_clamp_masked(mask, FREG(args[0]), FREG(args[1]), FREG(args[2]), FREG(args[3]), FREG(args[4]), FREG(args[5]), FREG(args[6]), FREG(args[7]), FREG(args[8]),
+                                                              FREG(args[9]), NULL); return 0;
+    case SLIR_DOT2_CLAMP_F: sl_exec_f_dot_product2_clamp_masked(mask, FREG(args[0]), FREG(args[1]), FREG(args[2]), FREG(args[3]), FREG(args[4]),
+                                                                FREG(args[5]), FREG(args[6])); return 0;
+    case SLIR_DOT3_CLAMP_F: sl_exec_f_dot_product3_clamp_masked(mask, FREG(args[0]), FREG(args[1]), FREG(args[2]), FREG(args[3]), FREG(args[4]), FREG(args[5]), FREG(args[6]),
+                                                                FREG(args[7]), FREG(args[8])); return 0;
+    case SLIR_DOT4_CLAMP_F: sl_exec_f_dot_product4_clamp_masked(mask, FREG(args[0]), FREG(args[1]), FREG(args[2]), FREG(args[3]), FREG(args[4]), FREG(args[5]), FREG(args[6]), FREG(args[7]), FREG(args[8]),
+                                                                FREG(args[9]), FREG(args[10])); return 0;
+    case SLIR_DIV_F: sl_exec_f_div_masked(mask, FREG(args[0]), FREG(args[1]), FREG(args[2])); return 0;
+    case SLIR_ADD_F: sl_exec_f_add_masked(mask, FREG(args[0]), FREG(args[1]), FREG(args[2])); return 0;
+    case SLIR_SUB_F: sl_exec_f_sub_masked(mask, FREG(args[0]), FREG(args[1]), FREG(args[2])); return 0;
+    case SLIR_DEC_F: sl_exec_f_decrement_masked(mask, FREG(args[0]), FREG(args[1])); return 0;
+    case SLIR_INC_F: sl_exec_f_increment_masked(mask, FREG(args[0]), FREG(args[1])); return 0;
+    case SLBC_ADD_F_CS: sl_exec_f_add_scalar_masked(mask, FREG(args[0]), FREG(args[1]), FUNI(args[2])); return 0;
+    case SLBC_SUB_F_CS: sl_exec_f_sub_scalar_masked(mask, FREG(args[0]), FREG(args[1]), FUNI(args[2])); return 0;
+    case SLBC_SUB_F_SC: sl_exec_f_scalar_sub_masked(mask, FREG(args[0]), FUNI(args[1]), FREG(args[2])); return 0;
+    case SLBC_MUL_F_CS: sl_exec_f_mul_scalar_masked(mask, FREG(args[0]), FREG(args[1]), FUNI(args[2])); return 0;
+    case SLBC_DIV_F_CS: sl_exec_f_div_scalar_masked(mask, FREG(args[0]), FREG(args[1]), FUNI(args[2])); return 0;
+    case SLBC_DIV_F_SC: sl_exec_f_scalar_div_masked(mask, FREG(args[0]), FUNI(args[1]), FREG(args[2])); return 0;
+    case SLBC_DOT2_SC: sl_exec_f_scalar_dot_product2_masked(mask, FREG(args[0]), FUNI(args[1]), FUNI(args[2]), FREG(args[3]), FREG(args[4])); return 0;
+    case SLBC_DOT3_SC: sl_exec_f_scalar_dot_product3_masked(mask, FREG(args[0]), FUNI(args[1]), FUNI(args[2]), FUNI(args[3]),
+                                                            FREG(args[4]), FREG(args[5]), FREG(args[6])); return 0;
+    case SLBC_DOT4_SC: sl_exec_f_scalar_dot_product4_masked(mask, FREG(args[0]), FUNI(args[1]), FUNI(args[2]), FUNI(args[3]), FUNI(args[4]),
+                                                            FREG(args[5]), FREG(args[6]), FREG(args[7]), FREG(args[8])); return 0;
+  }
+  return sl_bytecode_exec_matrix_product(exec, instruction_code, 0, mask, args);
+}
+
+#undef FREG
+#undef IREG
+#undef BREG
+#undef FUNI
+
+static void sl_bytecode_mask_from_chain(uint64_t *mask, const sl_exec_row_t *chain_column, uint32_t chain) {
+  sl_exec_row_t row, delta;
+  memset(mask, 0, sizeof(uint64_t) * SL_BYTECODE_MASK_WORDS);
+  if (chain == SL_EXEC_NO_CHAIN) return;
+  row = (sl_exec_row_t)chain;
+  do {
+    mask[row >> 6] |= ((uint64_t)1) << (row & 63);
+    delta = chain_column[row];
+    row += delta;
+  } while (delta);
+}
+
+/* Updates the head of chain c from its mask and decides between the masked and chain kernels; the
+ * mask kernels compute all rows of each 8 row block touched, so use them if at least half of the
+ * rows computed are in the chain. */
+static void sl_bytecode_update_chain(struct sl_bytecode *bc, struct sl_execution *exec, int c, uint8_t materialized) {
+  const uint64_t *mask = exec->bc_masks_ + c * SL_BYTECODE_MASK_WORDS;
+  uint32_t head = SL_EXEC_NO_CHAIN;
+  int num_rows = 0, num_blocks = 0;
+  int w;
+  for (w = SL_BYTECODE_MASK_WORDS - 1; w >= 0; --w) {
+    uint64_t blocks = mask[w] | (mask[w] >> 4);
+    blocks |= blocks >> 2;
+    blocks |= blocks >> 1;
+    if (mask[w]) head = (uint32_t)(w * 64 + sl_bytecode_ctz64(mask[w]));
+    num_rows += sl_bytecode_popcount64(mask[w]);
+    num_blocks += sl_bytecode_popcount64(blocks & 0x0101010101010101ULL);
+  }
+  exec->bc_chains_[c] = head;
+  if (exec->predication_ == SLEP_MASKS) {
+    exec->bc_chain_flags_[c] = materialized | SL_BYTECODE_CHAIN_USE_MASK;
+  }
+  else {
+    exec->bc_chain_flags_[c] = materialized | (((num_rows * 2) >= (num_blocks * 8)) ? SL_BYTECODE_CHAIN_USE_MASK : 0);
+  }
+}
+
+/* Writes the deltas of chain c to the execution chain column, if not already current. */
+static void sl_bytecode_materialize_chain(struct sl_bytecode *bc, struct sl_execution *exec, int c) {
+  const uint64_t *mask = exec->bc_masks_ + c * SL_BYTECODE_MASK_WORDS;
+  sl_exec_row_t *chain_column = exec->exec_chain_reg_;
+  int prev = -1;
+  size_t n;
+  int w;
+  if (exec->bc_chain_flags_[c] & SL_BYTECODE_CHAIN_MATERIALIZED) return;
+  for (w = 0; w < SL_BYTECODE_MASK_WORDS; ++w) {
+    uint64_t bits = mask[w];
+    while (bits) {
+      int row = w * 64 + sl_bytecode_ctz64(bits);
+      bits &= bits - 1;
+      if (prev >= 0) chain_column[prev] = (sl_exec_row_t)(row - prev);
+      prev = row;
+    }
+  }
+  if (prev >= 0) chain_column[prev] = 0;
+  exec->bc_chain_flags_[c] |= SL_BYTECODE_CHAIN_MATERIALIZED;
+
+  /* The deltas of any other chain sharing some, but not all, of the rows are now overwritten */
+  for (n = 0; n < bc->num_chains_; ++n) {
+    const uint64_t *other = exec->bc_masks_ + n * SL_BYTECODE_MASK_WORDS;
+    int overlaps = 0, same = 1;
+    if ((n == (size_t)c) || !(exec->bc_chain_flags_[n] & SL_BYTECODE_CHAIN_MATERIALIZED)) continue;
+    for (w = 0; w < SL_BYTECODE_MASK_WORDS; ++w) {
+      if (other[w] & mask[w]) overlaps = 1;
+      if (other[w] != mask[w]) same = 0;
+    }
+    if (overlaps && !same) exec->bc_chain_flags_[n] &= ~SL_BYTECODE_CHAIN_MATERIALIZED;
+  }
+}
+
+/* Gathers the rows of the registers of an SLBC_COMPACT series into scratch columns, substituting those for the
+ * registers in bank */
+#define SL_BYTECODE_COMPACT_GATHER_BANK(type, bank, num_regs) \
+  for (n = 0; n < (size_t)(num_regs); ++n, ++reg) { \
+    int reg_index = *reg >> SL_BYTECODE_COMPACT_FLAG_BITS; \
+    type *column = (type *)scratch; \
+    type *original = (bank)[reg_index]; \
+    saved[reg - regs] = original; \
+    if (!original) continue; /* scalar uniform without a column */ \
+    scratch += sizeof(type) * num_scratch_rows; \
+    if (*reg & SL_BYTECODE_COMPACT_GATHER) { \
+      for (j = 0; j < num_rows; ++j) column[j] = original[rows[j]]; \
+    } \
+    (bank)[reg_index] = column; \
+    num_columns++; \
+  }
+
+/* Scatters the rows of the scratch columns back to the registers they substituted for in bank */
+#define SL_BYTECODE_COMPACT_SCATTER_BANK(type, bank, num_regs) \
+  for (n = 0; n < (size_t)(num_regs); ++n, ++reg) { \
+    int reg_index = *reg >> SL_BYTECODE_COMPACT_FLAG_BITS; \
+    type *column = (bank)[reg_index]; \
+    type *original = (type *)saved[reg - regs]; \
+    if (!original) continue; \
+    if (*reg & SL_BYTECODE_COMPACT_SCATTER) { \
+      for (j = 0; j < num_rows; ++j) original[rows[j]] = column[j]; \
+    } \
+    (bank)[reg_index] = original; \
+  }
+
+/* Runs the series of kernels following the SLBC_COMPACT instruction at pc on compacted rows, if the rows (those of
+ * chain, or if mask is not NULL, those in mask) are sparse enough; returns non-zero if it did, zero if the series
+ * should run as is. */
+static int sl_bytecode_compact(struct sl_bytecode *bc, struct sl_execution *exec, const int *pc, uint32_t chain, const uint64_t *mask) {
+  const int *args = pc + 2;
+  const int *regs = args + 5;
+  const int *reg;
+  const int *instr;
+  const int *end = bc->code_ + args[1];
+  size_t num_regs = (size_t)pc[1] - 5;
+  sl_exec_row_t rows[SL_EXEC_CHAIN_MAX_NUM_ROWS];
+  size_t num_rows = 0, num_scratch_rows, num_columns = 0, size, n, j;
+  sl_exec_row_t *chain_column, *saved_chain_column;
+  void **saved;
+  char *scratch;
+
+  if (mask) {
+    int w;
+    for (w = 0; w < SL_BYTECODE_MASK_WORDS; ++w) {
+      uint64_t bits = mask[w];
+      while (bits) {
+        rows[num_rows++] = (sl_exec_row_t)(w * 64 + sl_bytecode_ctz64(bits));
+        bits &= bits - 1;
+      }
+    }
+  }
+  else if (chain != SL_EXEC_NO_CHAIN) {
+    sl_exec_row_t row = (sl_exec_row_t)chain, delta;
+    do {
+      rows[num_rows++] = row;
+      delta = exec->exec_chain_reg_[row];
+      row += delta;
+    } while (delta);
+  }
+  if (num_rows < SL_BYTECODE_COMPACT_MIN_ROWS) return 0;
+  if ((num_rows * 100) >= (exec->compact_density_ * ((size_t)rows[num_rows - 1] - rows[0] + 1))) return 0;
+
+  /* Scratch: the registers substituted, the columns (widest first, keeping each aligned), the chain */
+  num_scratch_rows = (num_rows + 7) & ~(size_t)7;
+  size = sizeof(void *) * num_regs;
+  size += sizeof(sl_exec_int_t) * num_scratch_rows * (size_t)args[3];
+  size += sizeof(float) * num_scratch_rows * (size_t)args[2];
+  size += sizeof(uint8_t) * num_scratch_rows * (size_t)args[4];
+  size += sizeof(sl_exec_row_t) * num_scratch_rows;
+  if (size > exec->compact_scratch_size_) {
+    void *new_scratch = realloc(exec->compact_scratch_, size);
+    if (!new_scratch) return 0;
+    exec->compact_scratch_ = new_scratch;
+    exec->compact_scratch_size_ = size;
+  }
+  saved = (void **)exec->compact_scratch_;
+  scratch = (char *)(saved + num_regs);
+  if (exec->profile_) sl_bytecode_profile_enter(bc, exec, pc, SL_EXEC_NO_CHAIN, NULL);
+
+  /* Int registers are listed after the float registers, but take the most aligned scratch */
+  reg = regs + args[2];
+  SL_BYTECODE_COMPACT_GATHER_BANK(sl_exec_int_t, exec->int_regs_, args[3]);
+  reg = regs;
+  SL_BYTECODE_COMPACT_GATHER_BANK(float, exec->float_regs_, args[2]);
+  reg = regs + args[2] + args[3];
+  chain_column = (sl_exec_row_t *)scratch;
+  scratch += sizeof(sl_exec_row_t) * num_scratch_rows;
+  SL_BYTECODE_COMPACT_GATHER_BANK(uint8_t, exec->bool_regs_, args[4]);
+
+  for (j = 0; j < num_scratch_rows; ++j) {
+    chain_column[j] = (j < (num_rows - 1)) ? 1 : 0;
+  }
+  saved_chain_column = exec->exec_chain_reg_;
+  exec->exec_chain_reg_ = chain_column;
+  if (exec->profile_) sl_bytecode_profile_leave(exec);
+
+  for (instr = pc + 2 + pc[1]; instr < end; instr += 2 + instr[1]) {
+    if (exec->profile_) sl_bytecode_profile_enter(bc, exec, instr, 0, NULL);
+    sl_bytecode_exec_kernel(bc, exec, instr[0], 0, instr + 3);
+    if (exec->profile_) sl_bytecode_profile_leave(exec);
+    exec->compaction_stats_.kernels_++;
+  }
+
+  exec->exec_chain_reg_ = saved_chain_column;
+  if (exec->profile_) sl_bytecode_profile_enter(bc, exec, pc, SL_EXEC_NO_CHAIN, NULL);
+  reg = regs;
+  SL_BYTECODE_COMPACT_SCATTER_BANK(float, exec->float_regs_, args[2]);
+  SL_BYTECODE_COMPACT_SCATTER_BANK(sl_exec_int_t, exec->int_regs_, args[3]);
+  SL_BYTECODE_COMPACT_SCATTER_BANK(uint8_t, exec->bool_regs_, args[4]);
+  if (exec->profile_) sl_bytecode_profile_leave(exec);
+
+  exec->compaction_stats_.compactions_++;
+  exec->compaction_stats_.rows_ += num_rows;
+  exec->compaction_stats_.columns_ += num_columns;
+  return 1;
+}
+
+#undef SL_BYTECODE_COMPACT_GATHER_BANK
+#undef SL_BYTECODE_COMPACT_SCATTER_BANK
+
+static int sl_bytecode_run_masked(struct sl_bytecode *bc, struct sl_execution *exec, uint32_t exec_chain, uint32_t *psurvivors, uint32_t *pdiscarded) {
+  const int *code = bc->code_;
+  const int *pc = code;
+  uint32_t *chains = exec->bc_chains_;
+  uint64_t *masks = exec->bc_masks_;
+  size_t n;
+
+  memset(masks, 0, sizeof(uint64_t) * SL_BYTECODE_MASK_WORDS * bc->num_chains_);
+  for (n = 0; n < bc->num_chains_; ++n) {
+    chains[n] = SL_EXEC_NO_CHAIN;
+    exec->bc_chain_flags_[n] = SL_BYTECODE_CHAIN_MATERIALIZED;
+  }
+  sl_bytecode_mask_from_chain(masks + bc->exec_chain_ * SL_BYTECODE_MASK_WORDS, exec->exec_chain_reg_, exec_chain);
+  sl_bytecode_update_chain(bc, exec, bc->exec_chain_, SL_BYTECODE_CHAIN_MATERIALIZED);
+  exec->bc_profile_source_ = NULL;
+
+  for (;;) {
+    int instruction_code = pc[0];
+    int num_args = pc[1];
+    const int *args = pc + 2;
+    switch (instruction_code) {
+      case GIR_MOVE:
+        if (args[1] >= 0) {
+          memcpy(masks + args[0] * SL_BYTECODE_MASK_WORDS, masks + args[1] * SL_BYTECODE_MASK_WORDS, sizeof(uint64_t) * SL_BYTECODE_MASK_WORDS);
+          chains[args[0]] = chains[args[1]];
+          exec->bc_chain_flags_[args[0]] = exec->bc_chain_flags_[args[1]];
+        }
+        else {
+          sl_bytecode_mask_from_chain(masks + args[0] * SL_BYTECODE_MASK_WORDS, exec->exec_chain_reg_, (uint32_t)args[2]);
+          sl_bytecode_update_chain(bc, exec, args[0], SL_BYTECODE_CHAIN_MATERIALIZED);
+        }
+        break;
+      case GIR_JUMP:
+        pc = code + args[0];
+        continue;
+      case GIR_BRANCH_NOT_EQUAL:
+        pc = code + ((chains[args[0]] != (uint32_t)args[1]) ? args[2] : args[3]);
+        continue;
+      case GIR_RETURN:
+        sl_bytecode_materialize_chain(bc, exec, bc->exec_chain_);
+        sl_bytecode_materialize_chain(bc, exec, bc->discard_chain_);
+        *psurvivors = chains[bc->exec_chain_];
+        *pdiscarded = chains[bc->discard_chain_];
+        return 0;
+      case SLIR_SPLIT_EXEC_CHAIN_BY_CONDITION: {
+        const uint8_t *cond = exec->bool_regs_[args[2]];
+        const uint64_t *in = masks + args[3] * SL_BYTECODE_MASK_WORDS;
+        uint64_t true_mask[SL_BYTECODE_MASK_WORDS], false_mask[SL_BYTECODE_MASK_WORDS];
+        int w, k;
+        if (exec->profile_) sl_bytecode_profile_enter(bc, exec, pc, SL_EXEC_NO_CHAIN, NULL);
+        for (w = 0; w < SL_BYTECODE_MASK_WORDS; ++w) {
+          uint64_t bits = 0;
+          if (in[w]) {
+            for (k = 0; k < 64; ++k) {
+              bits |= ((uint64_t)!!cond[w * 64 + k]) << k;
+            }
+          }
+          true_mask[w] = in[w] & bits;
+          false_mask[w] = in[w] & ~bits;
+        }
+        memcpy(masks + args[0] * SL_BYTECODE_MASK_WORDS, true_mask, sizeof(true_mask));
+        memcpy(masks + args[1] * SL_BYTECODE_MASK_WORDS, false_mask, sizeof(false_mask));
+        sl_bytecode_update_chain(bc, exec, args[0], 0);
+        sl_bytecode_update_chain(bc, exec, args[1], 0);
+        if (exec->profile_) sl_bytecode_profile_leave(exec);
+        break;
+      }
+      case SLIR_SPLIT_EXEC_CHAIN_BY_UNIFORM_CONDITION: {
+        /* All rows share the condition, the first row decides where the whole mask goes */
+        const uint8_t *cond = exec->bool_regs_[args[2]];
+        const uint64_t *in = masks + args[3] * SL_BYTECODE_MASK_WORDS;
+        uint64_t in_mask[SL_BYTECODE_MASK_WORDS];
+        int w;
+        if (exec->profile_) sl_bytecode_profile_enter(bc, exec, pc, SL_EXEC_NO_CHAIN, NULL);
+        memcpy(in_mask, in, sizeof(in_mask));
+        for (w = 0; w < SL_BYTECODE_MASK_WORDS; ++w) {
+          if (in_mask[w]) break;
+        }
+        int to_true = (w < SL_BYTECODE_MASK_WORDS) && cond[w * 64 + sl_bytecode_ctz64(in_mask[w])];
+        memcpy(masks + (to_true ? args[0] : args[1]) * SL_BYTECODE_MASK_WORDS, in_mask, sizeof(in_mask));
+        memset(masks + (to_true ? args[1] : args[0]) * SL_BYTECODE_MASK_WORDS, 0, sizeof(in_mask));
+        sl_bytecode_update_chain(bc, exec, args[0], 0);
+        sl_bytecode_update_chain(bc, exec, args[1], 0);
+        if (exec->profile_) sl_bytecode_profile_leave(exec);
+        break;
+      }
+      case SLIR_JOIN_EXEC_CHAINS: {
+        const uint64_t *a = masks + args[1] * SL_BYTECODE_MASK_WORDS;
+        const uint64_t *b = masks + args[2] * SL_BYTECODE_MASK_WORDS;
+        uint64_t joined[SL_BYTECODE_MASK_WORDS];
+        int w;
+        if (exec->profile_) sl_bytecode_profile_enter(bc, exec, pc, SL_EXEC_NO_CHAIN, NULL);
+        for (w = 0; w < SL_BYTECODE_MASK_WORDS; ++w) {
+          joined[w] = a[w] | b[w];
+        }
+        memcpy(masks + args[0] * SL_BYTECODE_MASK_WORDS, joined, sizeof(joined));
+        sl_bytecode_update_chain(bc, exec, args[0], 0);
+        if (exec->profile_) sl_bytecode_profile_leave(exec);
+        break;
+      }
+      case SLBC_COMPACT:
+        /* Dense chains run the masked kernels as they are */
+        if ((chains[args[0]] != SL_EXEC_NO_CHAIN) && exec->compact_density_ && !(exec->bc_chain_flags_[args[0]] & SL_BYTECODE_CHAIN_USE_MASK) &&
+            sl_bytecode_compact(bc, exec, pc, SL_EXEC_NO_CHAIN, masks + args[0] * SL_BYTECODE_MASK_WORDS)) {
+          pc = code + args[1];
+          continue;
+        }
+        break;
+      default: {
+        uint32_t chain = chains[args[0]];
+        if (chain == SL_EXEC_NO_CHAIN) break;
+        if (exec->profile_) sl_bytecode_profile_enter(bc, exec, pc, SL_EXEC_NO_CHAIN, masks + args[0] * SL_BYTECODE_MASK_WORDS);
+        if (!(exec->bc_chain_flags_[args[0]] & SL_BYTECODE_CHAIN_USE_MASK) ||
+            sl_bytecode_exec_masked_kernel(bc, exec, instruction_code, masks + args[0] * SL_BYTECODE_MASK_WORDS, args + 1)) {
+          sl_bytecode_materialize_chain(bc, exec, args[0]);
+          sl_bytecode_exec_kernel(bc, exec, instruction_code, (sl_exec_row_t)chain, args + 1);
+        }
+        if (exec->profile_) sl_bytecode_profile_leave(exec);
+        break;
+      }
+    }
+    pc += 2 + num_args;
+  }
+}
+
+int sl_bytecode_run(struct sl_bytecode *bc, struct sl_execution *exec, uint32_t exec_chain, uint32_t *psurvivors, uint32_t *pdiscarded) {
+  const int *code = bc->code_;
+  const int *pc = code;
+  uint32_t *chains;
+  size_t n;
+
+  if (!exec->num_execution_frames_) return -1;
+  if (sl_bytecode_reserve_chains(bc, exec)) return -1;
+  chains = exec->bc_chains_;
+
+  /* The masked kernels compute whole blocks of rows, and the split reads conditions 64 rows at a time,
+   * so need the rows allocated in multiples of 64 */
+  if ((exec->predication_ != SLEP_CHAINS) && !(exec->max_num_rows_ % 64)) {
+    return sl_bytecode_run_masked(bc, exec, exec_chain, psurvivors, pdiscarded);
+  }
+
+  for (n = 0; n < bc->num_chains_; ++n) {
+    chains[n] = SL_EXEC_NO_CHAIN;
+  }
+  chains[bc->exec_chain_] = exec_chain;
+  exec->bc_profile_source_ = NULL;
+
+  for (;;) {
+    int instruction_code = pc[0];
+    int num_args = pc[1];
+    const int *args = pc + 2;
+    switch (instruction_code) {
+      case GIR_MOVE:
+        chains[args[0]] = (args[1] >= 0) ? chains[args[1]] : (uint32_t)args[2];
+        break;
+      case GIR_JUMP:
+        pc = code + args[0];
+        continue;
+      case GIR_BRANCH_NOT_EQUAL:
+        pc = code + ((chains[args[0]] != (uint32_t)args[1]) ? args[2] : args[3]);
+        continue;
+      case GIR_RETURN:
+        *psurvivors = chains[bc->exec_chain_];
+        *pdiscarded = chains[bc->discard_chain_];
+        return 0;
+      case SLIR_SPLIT_EXEC_CHAIN_BY_CONDITION:
+      case SLIR_SPLIT_EXEC_CHAIN_BY_UNIFORM_CONDITION:
+      case SLIR_JOIN_EXEC_CHAINS:
+        if (exec->profile_) sl_bytecode_profile_enter(bc, exec, pc, SL_EXEC_NO_CHAIN, NULL);
+        sl_bytecode_exec_chain_instr(bc, exec, pc);
+        if (exec->profile_) sl_bytecode_profile_leave(exec);
+        break;
+      case SLBC_COMPACT:
+        if ((chains[args[0]] != SL_EXEC_NO_CHAIN) && exec->compact_density_ && sl_bytecode_compact(bc, exec, pc, chains[args[0]], NULL)) {
+          pc = code + args[1];
+          continue;
+        }
+        break;
+      default: {
+        /* All other instructions are kernels whose first operand is the execution chain, skip them for an empty chain */
+        uint32_t chain = chains[args[0]];
+        if (chain != SL_EXEC_NO_CHAIN) {
+          if (exec->profile_) sl_bytecode_profile_enter(bc, exec, pc, chain, NULL);
+          sl_bytecode_exec_kernel(bc, exec, instruction_code, (sl_exec_row_t)chain, args + 1);
+          if (exec->profile_) sl_bytecode_profile_leave(exec);
+        }
+        break;
+      }
+    }
+    pc += 2 + num_args;
+  }
+}
@@ -0,0 +1,259 @@
+/* Copyright 2024 Kinglet B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SL_BYTECODE_H
+#define SL_BYTECODE_H
+
+#ifndef STDINT_H_INCLUDED
+#define STDINT_H_INCLUDED
+#include <stdint.h>
+#endif
+
+#ifndef STDDEF_H_INCLUDED
+#define STDDEF_H_INCLUDED
+#include <stddef.h>
+#endif
+
+#ifndef STDIO_H_INCLUDED
+#define STDIO_H_INCLUDED
+#include <stdio.h>
+#endif
+
+#ifndef SL_EXECUTION_H_INCLUDED
+#define SL_EXECUTION_H_INCLUDED
+#include "sl_execution.h"
+#endif
+
+#ifndef SL_IR_H_INCLUDED
+#define SL_IR_H_INCLUDED
+#include "sl_ir.h"
+#endif
+
+#ifndef SL_IR_OPT_H_INCLUDED
+#define SL_IR_OPT_H_INCLUDED
+#include "sl_ir_opt.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of 64 bit words in the row mask of a chain, see sl_execution::bc_masks_ */
+#define SL_BYTECODE_MASK_WORDS (SL_EXEC_CHAIN_MAX_NUM_ROWS / 64)
+
+/* Flags in sl_execution::bc_chain_flags_ */
+#define SL_BYTECODE_CHAIN_MATERIALIZED 1 /* the deltas of the chain in sl_execution::exec_chain_reg_ are current */
+#define SL_BYTECODE_CHAIN_USE_MASK 2     /* run the masked kernels for the chain */
+
+/* Flags of the registers listed by SLBC_COMPACT, in the low bits of each entry */
+#define SL_BYTECODE_COMPACT_GATHER 1  /* the register is read, gather its rows before the kernels */
+#define SL_BYTECODE_COMPACT_SCATTER 2 /* the register is written, scatter its rows after the kernels */
+#define SL_BYTECODE_COMPACT_FLAG_BITS 2
+
+/* Fewest kernels in a series for sl_bytecode_from_ir() to precede it with SLBC_COMPACT */
+#define SL_BYTECODE_COMPACT_MIN_KERNELS 4
+
+/* Fewest rows in the chain for compaction to be worthwhile, one full group of 8 */
+#define SL_BYTECODE_COMPACT_MIN_ROWS 8
+
+/* Instructions that only exist in bytecode, numbered after the SLIR instructions. sl_bytecode_from_ir()
+ * substitutes these for float arithmetic and register moves that read uniforms, which take the uniform from
+ * sl_execution::float_uniforms_ as a scalar rather than from a column. Operands are those of the SLIR
+ * instruction replaced, with the scalar operands moved to the side indicated in the name:
+ *   [SLBC_XXX_F_CS, 4, chain, dst, column, scalar]
+ *   [SLBC_XXX_F_SC, 4, chain, dst, scalar, column]
+ *   [SLBC_XXX_F_SS, 4, chain, dst, scalar, scalar]
+ *   [SLBC_DOTn_SC, 2 + 2n, chain, dst, n scalars, n columns]
+ *   [SLBC_XXX_MUL_XXX_SC, .., chain, dsts, left scalars, right columns] (operands as for the SLIR matrix product)
+ *   [SLBC_XXX_MUL_XXX_CS, .., chain, dsts, left columns, right scalars]
+ *   [SLBC_MOVE_F_SCALAR_TO_REG, 3, chain, dst, scalar]
+ *   [SLBC_MOVE_F_SCALAR_OFFSET_TO_REG, 6, chain, dst, scalar base, offset int register, fixed offset, offset stepsize]
+ * SLBC_COMPACT precedes a series of kernels on the same chain that only address their registers directly (so no
+ * builtin calls, samplers, or indirect or offset register moves), listing the registers they touch per bank, each
+ * as (register << SL_BYTECODE_COMPACT_FLAG_BITS) | SL_BYTECODE_COMPACT_XXX flags:
+ *   [SLBC_COMPACT, 5 + n, chain, end, num_float_regs, num_int_regs, num_bool_regs, n registers]
+ * end is the offset of the first instruction after the series. If the chain is sparse (see
+ * sl_execution::compact_density_) the interpreter runs the series on compacted rows and continues at end,
+ * otherwise (and for the JIT and AOT code) it is a no-op. */
+enum sl_bytecode_instr_code {
+  SLBC_ADD_F_CS = SLIR_CALL_BUILTIN + 1,
+  SLBC_ADD_F_SS,
+  SLBC_SUB_F_CS,
+  SLBC_SUB_F_SC,
+  SLBC_SUB_F_SS,
+  SLBC_MUL_F_CS,
+  SLBC_MUL_F_SS,
+  SLBC_DIV_F_CS,
+  SLBC_DIV_F_SC,
+  SLBC_DIV_F_SS,
+  SLBC_DOT2_SC,
+  SLBC_DOT3_SC,
+  SLBC_DOT4_SC,
+  SLBC_MAT2_MUL_VEC2_SC,
+  SLBC_MAT3_MUL_VEC3_SC,
+  SLBC_MAT4_MUL_VEC4_SC,
+  SLBC_VEC2_MUL_MAT2_SC,
+  SLBC_VEC3_MUL_MAT3_SC,
+  SLBC_VEC4_MUL_MAT4_SC,
+  SLBC_MAT2_MUL_MAT2_SC,
+  SLBC_MAT3_MUL_MAT3_SC,
+  SLBC_MAT4_MUL_MAT4_SC,
+  SLBC_MAT2_MUL_VEC2_CS,
+  SLBC_MAT3_MUL_VEC3_CS,
+  SLBC_MAT4_MUL_VEC4_CS,
+  SLBC_VEC2_MUL_MAT2_CS,
+  SLBC_VEC3_MUL_MAT3_CS,
+  SLBC_VEC4_MUL_MAT4_CS,
+  SLBC_MAT2_MUL_MAT2_CS,
+  SLBC_MAT3_MUL_MAT3_CS,
+  SLBC_MAT4_MUL_MAT4_CS,
+  SLBC_MOVE_F_SCALAR_TO_REG,
+  SLBC_MOVE_F_SCALAR_OFFSET_TO_REG,
+  SLBC_COMPACT
+};
+
+struct sl_execution;
+struct sl_compilation_unit;
+struct sl_function;
+struct ir_body;
+struct ir_temp;
+
+/* Source of a run of bytecode: the code from code_offset_ up to the code_offset_ of the next sl_bytecode_source
+ * was generated for node_ (the sl_expr or sl_stmt, see ir_instr::source_node_; only used as a key, like
+ * sl_profile_node::node_) which is on line line_ of the source. */
+struct sl_bytecode_source {
+  size_t code_offset_;
+  const void *node_;
+  int line_;
+};
+
+/* Flattened form of the SLIR of a single function (with all calls inlined), ready for interpretation
+ * by sl_bytecode_run(). The code is a sequence of instructions, each encoded as:
+ *   [instruction_code, number_of_operands, operand_0, .. operand_n-1]
+ * Operands are plain ints:
+ *  - registers (IR_XXX_BANK) are the absolute register index,
+ *  - virtuals (IR_VIRTUAL, which in SLIR always hold execution chains) index the chain registers, see
+ *    sl_execution::bc_chains_,
+ *  - block entry points are the offset into code_ of the first instruction of the block,
+ *  - integer literals are their value, except for 64 bit literals (SLIR_INIT_LIT_I and the multiplier of
+ *    SLIR_MUL_C_AND_ADD) which are an index into lits_, and pointers (SLIR_CALL_BUILTIN) index ptrs_,
+ *  - float literals are the bits of the float.
+ * The bytecode is not modified when it runs, all state of a run is in the sl_execution, so several executions
+ * (see sl_exec_init_context()) may run the same bytecode concurrently. */
+struct sl_bytecode {
+  /* Function the bytecode was generated for */
+  struct sl_function *f_;
+
+  size_t num_code_;
+  size_t num_code_allocated_;
+  int *code_;
+
+  size_t num_lits_;
+  size_t num_lits_allocated_;
+  int64_t *lits_;
+
+  size_t num_ptrs_;
+  size_t num_ptrs_allocated_;
+  void **ptrs_;
+
+  /* Source the code was generated for, in order of code_offset_, for the profile (see sl_execution::profile_);
+   * code generated for no particular source has a NULL node_. */
+  size_t num_sources_;
+  size_t num_sources_allocated_;
+  struct sl_bytecode_source *sources_;
+
+  /* Number of chain registers, one for each virtual in the SLIR */
+  size_t num_chains_;
+
+  /* Index in the chain registers of the execution chain (on entry, the rows to run, on exit, the rows that survived)
+   * and of the discard chain (on exit, the rows that were discarded.) */
+  int exec_chain_;
+  int discard_chain_;
+
+  /* Number of registers in each bank the bytecode uses; fewer than the compilation unit's register_counts_
+   * when register allocation let local registers share (see SL_IR_OPT_REG_ALLOC.) */
+  struct sl_exec_call_graph_results register_counts_;
+
+  /* Number of superinstructions of each SL_IR_OPT_FUSED_XXX kind in the bytecode (see SL_IR_OPT_FUSE.) */
+  size_t num_fused_[SL_IR_OPT_NUM_FUSIONS];
+};
+
+void sl_bytecode_init(struct sl_bytecode *bc);
+void sl_bytecode_cleanup(struct sl_bytecode *bc);
+
+/* Flattens the SLIR in body to bytecode; exec_chain and discard_chain are the virtuals of the execution and
+ * discard chains, as returned by sl_ir_lower_function(). float_uniform_flags (num_float_regs entries, or NULL)
+ * are the sl_execution::float_uniform_flags_; registers flagged SL_EXEC_UNIFORM_SCALAR are read as scalars
+ * where an SLBC_XXX instruction allows, and SL_EXEC_UNIFORM_COLUMN is set for those that the bytecode still
+ * reads as a column. Returns 0 upon success. */
+int sl_bytecode_from_ir(struct sl_bytecode *bc, struct ir_body *body, struct ir_temp *exec_chain, struct ir_temp *discard_chain,
+                        uint8_t *float_uniform_flags, size_t num_float_regs);
+
+/* Lowers function f of cu to SLIR (see sl_ir_lower_function() for inline_threshold and unroll_max_size), optimizes it with the
+ * SL_IR_OPT_XXX opt_passes (printing the SLIR before and after to opt_dump_fp, if not NULL) taking the num_constants
+ * registers in constants as known (see sl_ir_optimize()), and then generates bytecode, see sl_bytecode_from_ir() for
+ * float_uniform_flags. Sets bc->register_counts_ and bc->num_fused_.
+ * Returns 0 upon success, or non-zero if the function could not be lowered (e.g. it uses a construct not supported
+ * by the SLIR) or upon allocation failure. */
+int sl_bytecode_compile(struct sl_bytecode *bc, struct sl_compilation_unit *cu, struct sl_function *f,
+                        uint8_t *float_uniform_flags, size_t num_float_regs, size_t inline_threshold,
+                        size_t unroll_max_size, int opt_passes, const struct sl_ir_opt_constant *constants,
+                        size_t num_constants, FILE *opt_dump_fp);
+
+/* Makes room in exec for the chain registers of bc (see sl_execution::bc_chains_); the runners call this before
+ * they start. Returns 0 upon success. */
+int sl_bytecode_reserve_chains(const struct sl_bytecode *bc, struct sl_execution *exec);
+
+/* Executes a single kernel instruction (any instruction other than the GIR control flow and SLIR chain
+ * instructions) for the rows in the chain starting at row; args are the operands following the chain operand. */
+void sl_bytecode_exec_kernel(struct sl_bytecode *bc, struct sl_execution *exec, int instruction_code, sl_exec_row_t row, const int *args);
+
+/* Kernel as returned by sl_bytecode_direct_kernel(), to be cast to its actual type before calling it */
+typedef void (*sl_bytecode_kernel_fn_t)(void);
+
+/* Returns the kernel sl_bytecode_exec_kernel() runs for instruction_code if its arguments are (row, chain_column)
+ * followed by nothing but the register columns of the operands in order, so native code can call it directly,
+ * and sets *pbanks to the bank of each of those columns: 'f' for float, 'i' for int and 'b' for bool registers,
+ * or '0' for a trailing NULL the kernel takes in place of a column. The first column (the result) is non-const,
+ * the others are const. Returns NULL for all other instructions. */
+sl_bytecode_kernel_fn_t sl_bytecode_direct_kernel(int instruction_code, const char **pbanks);
+
+/* Executes the chain instruction (SLIR_SPLIT_EXEC_CHAIN_BY_CONDITION, SLIR_SPLIT_EXEC_CHAIN_BY_UNIFORM_CONDITION or
+ * SLIR_JOIN_EXEC_CHAINS) at instr, operating on exec->bc_chains_. */
+void sl_bytecode_exec_chain_instr(struct sl_bytecode *bc, struct sl_execution *exec, const int *instr);
+
+/* Returns the source of the instruction at code offset pc in bc, or NULL if it has none. */
+const struct sl_bytecode_source *sl_bytecode_source_at(const struct sl_bytecode *bc, size_t pc);
+
+/* Profiling hooks around the instruction at pc, for the runners of bc when exec->profile_ is set: enter counts
+ * an invocation of the instruction's source for the rows in chain (or, if mask is not NULL, the rows in mask,)
+ * unless the previous instruction that counted rows was from the same source, so consecutive kernels generated
+ * from one node count as one invocation of it. Instructions that run for no rows in particular (chain is
+ * SL_EXEC_NO_CHAIN and mask is NULL) count nothing. Leave charges the cycles since enter to the source. */
+void sl_bytecode_profile_enter(struct sl_bytecode *bc, struct sl_execution *exec, const int *pc, uint32_t chain, const uint64_t *mask);
+void sl_bytecode_profile_leave(struct sl_execution *exec);
+
+/* Runs the bytecode on exec for the rows in exec_chain; returns the rows surviving in *psurvivors and
+ * the rows discarded in *pdiscarded. Returns 0 upon success.
+ * Unless exec->predication_ is SLEP_CHAINS, chains are tracked as row masks: splitting and joining them
+ * becomes a bitwise AND/ANDN and OR, float arithmetic runs as masked kernels over whole blocks of rows,
+ * and the deltas in the execution chain column are only written when a kernel without a masked variant
+ * needs them. If exec->profile_ is set, the cost of each instruction is charged to its source. */
+int sl_bytecode_run(struct sl_bytecode *bc, struct sl_execution *exec, uint32_t exec_chain, uint32_t *psurvivors, uint32_t *pdiscarded);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* SL_BYTECODE_H */
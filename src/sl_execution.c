@@ -38,6 +38,11 @@
 #include <inttypes.h>
 #endif
 
+#ifndef MATH_H_INCLUDED
+#define MATH_H_INCLUDED
+#include <math.h>
+#endif
+
 #ifndef ASSERT_H_INCLUDED
 #define ASSERT_H_INCLUDED
 #include <assert.h>
@@ -68,74 +73,112 @@
 #include "sl_reg_move.h"
 #endif
 
+#ifndef SL_IR_OPT_H_INCLUDED
+#define SL_IR_OPT_H_INCLUDED
+#include "sl_ir_opt.h"
+#endif
+
+#ifndef SL_PROFILE_H_INCLUDED
+#define SL_PROFILE_H_INCLUDED
+#include "sl_profile.h"
+#endif
+
+#ifndef SL_BYTECODE_H_INCLUDED
+#define SL_BYTECODE_H_INCLUDED
+#include "sl_bytecode.h"
+#endif
+
+#ifndef SL_JIT_H_INCLUDED
+#define SL_JIT_H_INCLUDED
+#include "sl_jit.h"
+#endif
+
+#ifndef SL_AOT_H_INCLUDED
+#define SL_AOT_H_INCLUDED
+#include "sl_aot.h"
+#endif
+
+#ifndef SL_SIMD_H_INCLUDED
+#define SL_SIMD_H_INCLUDED
+#include "sl_simd.h"
+#endif
+
 static int sl_exec_push_execution_frame(struct sl_execution *exec);
 
-void sl_exec_f_add(uint8_t row, uint8_t *restrict chain_column, float *restrict result_column, const float *restrict left_column, const float *restrict right_column) {
+void sl_exec_f_add(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, const float *restrict left_column, const float *restrict right_column) {
 #define BINOP_SNIPPET_OPERATOR(left, right) left + right
 #define BINOP_SNIPPET_TYPE float
+#define BINOP_SNIPPET_SIMD_KERNEL g_sl_simd_.f_add_
 #include "sl_binop_snippet_inc.h"
 #undef BINOP_SNIPPET_OPERATOR
 #undef BINOP_SNIPPET_TYPE
+#undef BINOP_SNIPPET_SIMD_KERNEL
 }
 
-void sl_exec_i_add(uint8_t row, uint8_t *restrict chain_column, int64_t *restrict result_column, const int64_t *restrict left_column, const int64_t *restrict right_column) {
+void sl_exec_i_add(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, sl_exec_int_t *restrict result_column, const sl_exec_int_t *restrict left_column, const sl_exec_int_t *restrict right_column) {
 #define BINOP_SNIPPET_OPERATOR(left, right) left + right
-#define BINOP_SNIPPET_TYPE int64_t
+#define BINOP_SNIPPET_TYPE sl_exec_int_t
 #include "sl_binop_snippet_inc.h"
 #undef BINOP_SNIPPET_OPERATOR
 #undef BINOP_SNIPPET_TYPE
 }
 
-void sl_exec_f_sub(uint8_t row, uint8_t *restrict chain_column, float *restrict result_column, const float *restrict left_column, const float *restrict right_column) {
+void sl_exec_f_sub(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, const float *restrict left_column, const float *restrict right_column) {
 #define BINOP_SNIPPET_OPERATOR(left, right) left - right
 #define BINOP_SNIPPET_TYPE float
+#define BINOP_SNIPPET_SIMD_KERNEL g_sl_simd_.f_sub_
 #include "sl_binop_snippet_inc.h"
 #undef BINOP_SNIPPET_OPERATOR
 #undef BINOP_SNIPPET_TYPE
+#undef BINOP_SNIPPET_SIMD_KERNEL
 }
 
-void sl_exec_i_sub(uint8_t row, uint8_t *restrict chain_column, int64_t *restrict result_column, const int64_t *restrict left_column, const int64_t *restrict right_column) {
+void sl_exec_i_sub(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, sl_exec_int_t *restrict result_column, const sl_exec_int_t *restrict left_column, const sl_exec_int_t *restrict right_column) {
 #define BINOP_SNIPPET_OPERATOR(left, right) left - right
-#define BINOP_SNIPPET_TYPE int64_t
+#define BINOP_SNIPPET_TYPE sl_exec_int_t
 #include "sl_binop_snippet_inc.h"
 #undef BINOP_SNIPPET_OPERATOR
 #undef BINOP_SNIPPET_TYPE
 }
 
 
-void sl_exec_f_increment(uint8_t row, uint8_t *restrict chain_column, float *restrict result_column, const float *restrict opd_column) {
+void sl_exec_f_increment(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, const float *restrict opd_column) {
 #define UNOP_SNIPPET_OPERATOR(opd) (opd + 1.f)
 #define UNOP_SNIPPET_TYPE float
+#define UNOP_SNIPPET_SIMD_KERNEL g_sl_simd_.f_increment_
 #include "sl_unop_snippet_inc.h"
 #undef UNOP_SNIPPET_OPERATOR
 #undef UNOP_SNIPPET_TYPE
+#undef UNOP_SNIPPET_SIMD_KERNEL
 }
 
-void sl_exec_i_increment(uint8_t row, uint8_t *restrict chain_column, int64_t *restrict result_column, const int64_t *restrict opd_column) {
+void sl_exec_i_increment(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, sl_exec_int_t *restrict result_column, const sl_exec_int_t *restrict opd_column) {
 #define UNOP_SNIPPET_OPERATOR(opd) (opd + 1)
-#define UNOP_SNIPPET_TYPE int64_t
+#define UNOP_SNIPPET_TYPE sl_exec_int_t
 #include "sl_unop_snippet_inc.h"
 #undef UNOP_SNIPPET_OPERATOR
 #undef UNOP_SNIPPET_TYPE
 }
 
-void sl_exec_f_decrement(uint8_t row, uint8_t *restrict chain_column, float *restrict result_column, const float *restrict opd_column) {
+void sl_exec_f_decrement(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, const float *restrict opd_column) {
 #define UNOP_SNIPPET_OPERATOR(opd) (opd - 1.f)
 #define UNOP_SNIPPET_TYPE float
+#define UNOP_SNIPPET_SIMD_KERNEL g_sl_simd_.f_decrement_
 #include "sl_unop_snippet_inc.h"
 #undef UNOP_SNIPPET_OPERATOR
 #undef UNOP_SNIPPET_TYPE
+#undef UNOP_SNIPPET_SIMD_KERNEL
 }
 
-void sl_exec_i_decrement(uint8_t row, uint8_t *restrict chain_column, int64_t *restrict result_column, const int64_t *restrict opd_column) {
+void sl_exec_i_decrement(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, sl_exec_int_t *restrict result_column, const sl_exec_int_t *restrict opd_column) {
 #define UNOP_SNIPPET_OPERATOR(opd) (opd - 1)
-#define UNOP_SNIPPET_TYPE int64_t
+#define UNOP_SNIPPET_TYPE sl_exec_int_t
 #include "sl_unop_snippet_inc.h"
 #undef UNOP_SNIPPET_OPERATOR
 #undef UNOP_SNIPPET_TYPE
 }
 
-void sl_exec_b_logical_not(uint8_t row, uint8_t *restrict chain_column, uint8_t *restrict result_column, const uint8_t *restrict opd_column) {
+void sl_exec_b_logical_not(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, uint8_t *restrict result_column, const uint8_t *restrict opd_column) {
 #define UNOP_SNIPPET_OPERATOR(opd) !opd
 #define UNOP_SNIPPET_TYPE uint8_t
 #include "sl_unop_snippet_inc.h"
@@ -143,71 +186,94 @@ void sl_exec_b_logical_not(uint8_t row, uint8_t *restrict chain_column, uint8_t
 #undef UNOP_SNIPPET_TYPE
 }
 
-void sl_exec_f_negate(uint8_t row, uint8_t *restrict chain_column, float *restrict result_column, const float *restrict opd_column) {
+void sl_exec_f_negate(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, const float *restrict opd_column) {
 #define UNOP_SNIPPET_OPERATOR(opd) -opd
 #define UNOP_SNIPPET_TYPE float
+#define UNOP_SNIPPET_SIMD_KERNEL g_sl_simd_.f_negate_
 #include "sl_unop_snippet_inc.h"
 #undef UNOP_SNIPPET_OPERATOR
 #undef UNOP_SNIPPET_TYPE
+#undef UNOP_SNIPPET_SIMD_KERNEL
 }
 
-void sl_exec_i_negate(uint8_t row, uint8_t *restrict chain_column, int64_t *restrict result_column, const int64_t *restrict opd_column) {
+void sl_exec_i_negate(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, sl_exec_int_t *restrict result_column, const sl_exec_int_t *restrict opd_column) {
 #define UNOP_SNIPPET_OPERATOR(opd) -opd
-#define UNOP_SNIPPET_TYPE int64_t
+#define UNOP_SNIPPET_TYPE sl_exec_int_t
 #include "sl_unop_snippet_inc.h"
 #undef UNOP_SNIPPET_OPERATOR
 #undef UNOP_SNIPPET_TYPE
 }
 
-void sl_exec_f_mul(uint8_t row, uint8_t *restrict chain_column, float *restrict result_column, const float *restrict left_column, const float *restrict right_column) {
+void sl_exec_f_mul(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, const float *restrict left_column, const float *restrict right_column) {
 #define BINOP_SNIPPET_OPERATOR(left, right) left * right
 #define BINOP_SNIPPET_TYPE float
+#define BINOP_SNIPPET_SIMD_KERNEL g_sl_simd_.f_mul_
 #include "sl_binop_snippet_inc.h"
 #undef BINOP_SNIPPET_OPERATOR
 #undef BINOP_SNIPPET_TYPE
+#undef BINOP_SNIPPET_SIMD_KERNEL
 }
 
-void sl_exec_i_mul(uint8_t row, uint8_t *restrict chain_column, int64_t *restrict result_column, const int64_t *restrict left_column, const int64_t *restrict right_column) {
+void sl_exec_i_mul(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, sl_exec_int_t *restrict result_column, const sl_exec_int_t *restrict left_column, const sl_exec_int_t *restrict right_column) {
 #define BINOP_SNIPPET_OPERATOR(left, right) left * right
-#define BINOP_SNIPPET_TYPE int64_t
+#define BINOP_SNIPPET_TYPE sl_exec_int_t
 #include "sl_binop_snippet_inc.h"
 #undef BINOP_SNIPPET_OPERATOR
 #undef BINOP_SNIPPET_TYPE
 }
 
-void sl_exec_i_mul_constant(uint8_t row, uint8_t *restrict chain_column, int64_t *restrict result_column, const int64_t *restrict opd_column, int64_t constant_val) {
+void sl_exec_i_mul_constant(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, sl_exec_int_t *restrict result_column, const sl_exec_int_t *restrict opd_column, sl_exec_int_t constant_val) {
 #define UNOP_SNIPPET_OPERATOR(opd) (opd * constant_val)
-#define UNOP_SNIPPET_TYPE int64_t
+#define UNOP_SNIPPET_TYPE sl_exec_int_t
 #include "sl_unop_snippet_inc.h"
 #undef UNOP_SNIPPET_OPERATOR
 #undef UNOP_SNIPPET_TYPE
 }
 
-void sl_exec_i_mul_constant_and_add(uint8_t row, uint8_t *restrict chain_column, int64_t *restrict result_column, const int64_t *restrict left_column, const int64_t *restrict right_column, int64_t constant_val) {
+void sl_exec_i_mul_constant_and_add(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, sl_exec_int_t *restrict result_column, const sl_exec_int_t *restrict left_column, const sl_exec_int_t *restrict right_column, sl_exec_int_t constant_val) {
 #define BINOP_SNIPPET_OPERATOR(left, right) left * constant_val + right
-#define BINOP_SNIPPET_TYPE int64_t
+#define BINOP_SNIPPET_TYPE sl_exec_int_t
 #include "sl_binop_snippet_inc.h"
 #undef BINOP_SNIPPET_OPERATOR
 #undef BINOP_SNIPPET_TYPE
 }
 
-void sl_exec_f_div(uint8_t row, uint8_t *restrict chain_column, float *restrict result_column, const float *restrict left_column, const float *restrict right_column) {
+void sl_exec_i_pick(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, sl_exec_int_t *restrict result_column, const sl_exec_int_t *restrict opd_column, const sl_exec_int_t *choices) {
+#define UNOP_SNIPPET_OPERATOR(opd) choices[opd]
+#define UNOP_SNIPPET_TYPE sl_exec_int_t
+#include "sl_unop_snippet_inc.h"
+#undef UNOP_SNIPPET_OPERATOR
+#undef UNOP_SNIPPET_TYPE
+}
+
+void sl_exec_i_pick_indirect(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, sl_exec_int_t *restrict result_column, const sl_exec_int_t *restrict opd_column, sl_exec_int_t *const *choice_columns) {
+  sl_exec_row_t delta;
+  do {
+    result_column[row] = choice_columns[opd_column[row]][row];
+    delta = chain_column[row];
+    row += delta;
+  } while (delta);
+}
+
+void sl_exec_f_div(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, const float *restrict left_column, const float *restrict right_column) {
 #define BINOP_SNIPPET_OPERATOR(left, right) left / right
 #define BINOP_SNIPPET_TYPE float
+#define BINOP_SNIPPET_SIMD_KERNEL g_sl_simd_.f_div_
 #include "sl_binop_snippet_inc.h"
 #undef BINOP_SNIPPET_OPERATOR
 #undef BINOP_SNIPPET_TYPE
+#undef BINOP_SNIPPET_SIMD_KERNEL
 }
 
-void sl_exec_i_div(uint8_t row, uint8_t *restrict chain_column, int64_t *restrict result_column, const int64_t *restrict left_column, const int64_t *restrict right_column) {
+void sl_exec_i_div(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, sl_exec_int_t *restrict result_column, const sl_exec_int_t *restrict left_column, const sl_exec_int_t *restrict right_column) {
 #define BINOP_SNIPPET_OPERATOR(left, right) left / right
-#define BINOP_SNIPPET_TYPE int64_t
+#define BINOP_SNIPPET_TYPE sl_exec_int_t
 #include "sl_binop_snippet_inc.h"
 #undef BINOP_SNIPPET_OPERATOR
 #undef BINOP_SNIPPET_TYPE
 }
 
-void sl_exec_logical_or(uint8_t row, uint8_t *restrict chain_column, uint8_t *restrict result_column, const uint8_t *restrict left_column, const uint8_t *restrict right_column) {
+void sl_exec_logical_or(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, uint8_t *restrict result_column, const uint8_t *restrict left_column, const uint8_t *restrict right_column) {
 #define BINOP_SNIPPET_OPERATOR(left, right) (0 - ((left || right) && !(left && right)))
 #define BINOP_SNIPPET_TYPE uint8_t
 #include "sl_binop_snippet_inc.h"
@@ -215,115 +281,127 @@ void sl_exec_logical_or(uint8_t row, uint8_t *restrict chain_column, uint8_t *re
 #undef BINOP_SNIPPET_TYPE
 }
 
-void sl_exec_f_lt(uint8_t row, uint8_t *restrict chain_column, uint8_t *restrict result_column, const float *restrict left_column, const float *restrict right_column) {
+void sl_exec_f_lt(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, uint8_t *restrict result_column, const float *restrict left_column, const float *restrict right_column) {
 #define BINOP_SNIPPET_OPERATOR(left, right) 0 - (left < right)
 #define BINOP_SNIPPET_TYPE float
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
 #include "sl_binop_snippet_inc.h"
 #undef BINOP_SNIPPET_OPERATOR
 #undef BINOP_SNIPPET_TYPE
+#undef BINOP_SNIPPET_RESULT_TYPE
 }
 
-void sl_exec_f_le(uint8_t row, uint8_t *restrict chain_column, uint8_t *restrict result_column, const float *restrict left_column, const float *restrict right_column) {
+void sl_exec_f_le(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, uint8_t *restrict result_column, const float *restrict left_column, const float *restrict right_column) {
 #define BINOP_SNIPPET_OPERATOR(left, right) 0 - (left <= right)
 #define BINOP_SNIPPET_TYPE float
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
 #include "sl_binop_snippet_inc.h"
 #undef BINOP_SNIPPET_OPERATOR
 #undef BINOP_SNIPPET_TYPE
+#undef BINOP_SNIPPET_RESULT_TYPE
 }
 
-void sl_exec_f_gt(uint8_t row, uint8_t *restrict chain_column, uint8_t *restrict result_column, const float *restrict left_column, const float *restrict right_column) {
+void sl_exec_f_gt(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, uint8_t *restrict result_column, const float *restrict left_column, const float *restrict right_column) {
 #define BINOP_SNIPPET_OPERATOR(left, right) 0 - (left > right)
 #define BINOP_SNIPPET_TYPE float
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
 #include "sl_binop_snippet_inc.h"
 #undef BINOP_SNIPPET_OPERATOR
 #undef BINOP_SNIPPET_TYPE
+#undef BINOP_SNIPPET_RESULT_TYPE
 }
 
-void sl_exec_f_ge(uint8_t row, uint8_t *restrict chain_column, uint8_t *restrict result_column, const float *restrict left_column, const float *restrict right_column) {
+void sl_exec_f_ge(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, uint8_t *restrict result_column, const float *restrict left_column, const float *restrict right_column) {
 #define BINOP_SNIPPET_OPERATOR(left, right) 0 - (left >= right)
 #define BINOP_SNIPPET_TYPE float
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
 #include "sl_binop_snippet_inc.h"
 #undef BINOP_SNIPPET_OPERATOR
 #undef BINOP_SNIPPET_TYPE
+#undef BINOP_SNIPPET_RESULT_TYPE
 }
 
-void sl_exec_f_eq(uint8_t row, uint8_t *restrict chain_column, uint8_t *restrict result_column, const float *restrict left_column, const float *restrict right_column) {
+void sl_exec_f_eq(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, uint8_t *restrict result_column, const float *restrict left_column, const float *restrict right_column) {
 #define BINOP_SNIPPET_OPERATOR(left, right) 0 - (left == right)
 #define BINOP_SNIPPET_TYPE float
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
 #include "sl_binop_snippet_inc.h"
 #undef BINOP_SNIPPET_OPERATOR
 #undef BINOP_SNIPPET_TYPE
+#undef BINOP_SNIPPET_RESULT_TYPE
 }
 
-void sl_exec_f_ne(uint8_t row, uint8_t *restrict chain_column, uint8_t *restrict result_column, const float *restrict left_column, const float *restrict right_column) {
+void sl_exec_f_ne(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, uint8_t *restrict result_column, const float *restrict left_column, const float *restrict right_column) {
 #define BINOP_SNIPPET_OPERATOR(left, right) 0 - (left != right)
 #define BINOP_SNIPPET_TYPE float
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
 #include "sl_binop_snippet_inc.h"
 #undef BINOP_SNIPPET_OPERATOR
 #undef BINOP_SNIPPET_TYPE
+#undef BINOP_SNIPPET_RESULT_TYPE
 }
 
-void sl_exec_i_lt(uint8_t row, uint8_t *restrict chain_column, uint8_t *restrict result_column, const int64_t *restrict left_column, const int64_t *restrict right_column) {
+void sl_exec_i_lt(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, uint8_t *restrict result_column, const sl_exec_int_t *restrict left_column, const sl_exec_int_t *restrict right_column) {
 #define BINOP_SNIPPET_OPERATOR(left, right) 0 - (left < right)
-#define BINOP_SNIPPET_TYPE int64_t
+#define BINOP_SNIPPET_TYPE sl_exec_int_t
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
 #include "sl_binop_snippet_inc.h"
 #undef BINOP_SNIPPET_OPERATOR
 #undef BINOP_SNIPPET_TYPE
+#undef BINOP_SNIPPET_RESULT_TYPE
 }
 
-void sl_exec_i_le(uint8_t row, uint8_t *restrict chain_column, uint8_t *restrict result_column, const int64_t *restrict left_column, const int64_t *restrict right_column) {
+void sl_exec_i_le(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, uint8_t *restrict result_column, const sl_exec_int_t *restrict left_column, const sl_exec_int_t *restrict right_column) {
 #define BINOP_SNIPPET_OPERATOR(left, right) 0 - (left <= right)
-#define BINOP_SNIPPET_TYPE int64_t
+#define BINOP_SNIPPET_TYPE sl_exec_int_t
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
 #include "sl_binop_snippet_inc.h"
 #undef BINOP_SNIPPET_OPERATOR
 #undef BINOP_SNIPPET_TYPE
+#undef BINOP_SNIPPET_RESULT_TYPE
 }
 
-void sl_exec_i_gt(uint8_t row, uint8_t *restrict chain_column, uint8_t *restrict result_column, const int64_t *restrict left_column, const int64_t *restrict right_column) {
+void sl_exec_i_gt(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, uint8_t *restrict result_column, const sl_exec_int_t *restrict left_column, const sl_exec_int_t *restrict right_column) {
 #define BINOP_SNIPPET_OPERATOR(left, right) 0 - (left > right)
-#define BINOP_SNIPPET_TYPE int64_t
+#define BINOP_SNIPPET_TYPE sl_exec_int_t
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
 #include "sl_binop_snippet_inc.h"
 #undef BINOP_SNIPPET_OPERATOR
 #undef BINOP_SNIPPET_TYPE
+#undef BINOP_SNIPPET_RESULT_TYPE
 }
 
-void sl_exec_i_ge(uint8_t row, uint8_t *restrict chain_column, uint8_t *restrict result_column, const int64_t *restrict left_column, const int64_t *restrict right_column) {
+void sl_exec_i_ge(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, uint8_t *restrict result_column, const sl_exec_int_t *restrict left_column, const sl_exec_int_t *restrict right_column) {
 #define BINOP_SNIPPET_OPERATOR(left, right) 0 - (left >= right)
-#define BINOP_SNIPPET_TYPE int64_t
+#define BINOP_SNIPPET_TYPE sl_exec_int_t
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
 #include "sl_binop_snippet_inc.h"
 #undef BINOP_SNIPPET_OPERATOR
 #undef BINOP_SNIPPET_TYPE
+#undef BINOP_SNIPPET_RESULT_TYPE
 }
 
-void sl_exec_i_eq(uint8_t row, uint8_t *restrict chain_column, uint8_t *restrict result_column, const int64_t *restrict left_column, const int64_t *restrict right_column) {
+void sl_exec_i_eq(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, uint8_t *restrict result_column, const sl_exec_int_t *restrict left_column, const sl_exec_int_t *restrict right_column) {
 #define BINOP_SNIPPET_OPERATOR(left, right) 0 - (left == right)
-#define BINOP_SNIPPET_TYPE int64_t
+#define BINOP_SNIPPET_TYPE sl_exec_int_t
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
 #include "sl_binop_snippet_inc.h"
 #undef BINOP_SNIPPET_OPERATOR
 #undef BINOP_SNIPPET_TYPE
+#undef BINOP_SNIPPET_RESULT_TYPE
 }
 
-void sl_exec_i_ne(uint8_t row, uint8_t *restrict chain_column, uint8_t *restrict result_column, const int64_t *restrict left_column, const int64_t *restrict right_column) {
+void sl_exec_i_ne(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, uint8_t *restrict result_column, const sl_exec_int_t *restrict left_column, const sl_exec_int_t *restrict right_column) {
 #define BINOP_SNIPPET_OPERATOR(left, right) 0 - (left != right)
-#define BINOP_SNIPPET_TYPE int64_t
+#define BINOP_SNIPPET_TYPE sl_exec_int_t
 #define BINOP_SNIPPET_RESULT_TYPE uint8_t
 #include "sl_binop_snippet_inc.h"
 #undef BINOP_SNIPPET_OPERATOR
 #undef BINOP_SNIPPET_TYPE
+#undef BINOP_SNIPPET_RESULT_TYPE
 }
 
-void sl_exec_b_eq(uint8_t row, uint8_t *restrict chain_column, uint8_t *restrict result_column, const uint8_t *restrict left_column, const uint8_t *restrict right_column) {
+void sl_exec_b_eq(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, uint8_t *restrict result_column, const uint8_t *restrict left_column, const uint8_t *restrict right_column) {
 #define BINOP_SNIPPET_OPERATOR(left, right) 0 - (left == right)
 #define BINOP_SNIPPET_TYPE uint8_t
 #include "sl_binop_snippet_inc.h"
@@ -331,7 +409,7 @@ void sl_exec_b_eq(uint8_t row, uint8_t *restrict chain_column, uint8_t *restrict
 #undef BINOP_SNIPPET_TYPE
 }
 
-void sl_exec_b_ne(uint8_t row, uint8_t *restrict chain_column, uint8_t *restrict result_column, const uint8_t *restrict left_column, const uint8_t *restrict right_column) {
+void sl_exec_b_ne(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, uint8_t *restrict result_column, const uint8_t *restrict left_column, const uint8_t *restrict right_column) {
 #define BINOP_SNIPPET_OPERATOR(left, right) 0 - (left != right)
 #define BINOP_SNIPPET_TYPE uint8_t
 #include "sl_binop_snippet_inc.h"
@@ -339,41 +417,40 @@ void sl_exec_b_ne(uint8_t row, uint8_t *restrict chain_column, uint8_t *restrict
 #undef BINOP_SNIPPET_TYPE
 }
 
-void sl_exec_f_indir_load(uint8_t row, uint8_t *restrict chain_column, float *restrict result_column, const int64_t *restrict src_column, const float * restrict * restrict float_regs) {
+void sl_exec_f_indir_load(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, const sl_exec_int_t *restrict src_column, const float * restrict * restrict float_regs) {
   for (;;) {
-    uint64_t chain;
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict result = result_column + row;
-        const int64_t *restrict src = src_column + row;
+        const sl_exec_int_t *restrict src = src_column + row;
         int n;
         for (n = 0; n < 8; n++) {
           result[n] = ((float_regs[src[n]]) + row)[n];
         }
 
-        uint8_t delta = (chain & 0xFF00000000000000) >> 56;
+        sl_exec_row_t delta = chain_column[row + 7];
         if (!delta) goto done;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict result = result_column + row;
-        const int64_t *restrict src = src_column + row;
+        const sl_exec_int_t *restrict src = src_column + row;
         int n;
         for (n = 0; n < 4; n++) {
           result[n] = ((float_regs[src[n]]) + row)[n];
         }
-        uint8_t delta = (chain & 0xFF000000) >> 24;
+        sl_exec_row_t delta = chain_column[row + 3];
         if (!delta) goto done;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
         /* Not trying to evoke auto-vectorization, just get it done. */
         result_column[row] = (float_regs[src_column[row]])[row];
-        uint8_t delta = chain_column[row];
+        sl_exec_row_t delta = chain_column[row];
         if (!delta) goto done;
         row += delta;
       } while (row & 3);
@@ -382,41 +459,40 @@ void sl_exec_f_indir_load(uint8_t row, uint8_t *restrict chain_column, float *re
 done:;
 }
 
-void sl_exec_i_indir_load(uint8_t row, uint8_t *restrict chain_column, int64_t *restrict result_column, const int64_t *restrict src_column, const int64_t * restrict * restrict int_regs) {
+void sl_exec_i_indir_load(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, sl_exec_int_t *restrict result_column, const sl_exec_int_t *restrict src_column, const sl_exec_int_t * restrict * restrict int_regs) {
   for (;;) {
-    uint64_t chain;
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
-        int64_t *restrict result = result_column + row;
-        const int64_t *restrict src = src_column + row;
+        sl_exec_int_t *restrict result = result_column + row;
+        const sl_exec_int_t *restrict src = src_column + row;
         int n;
         for (n = 0; n < 8; n++) {
           result[n] = ((int_regs[src[n]]) + row)[n];
         }
 
-        uint8_t delta = (chain & 0xFF00000000000000) >> 56;
+        sl_exec_row_t delta = chain_column[row + 7];
         if (!delta) goto done;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
-        int64_t *restrict result = result_column + row;
-        const int64_t *restrict src = src_column + row;
+        sl_exec_int_t *restrict result = result_column + row;
+        const sl_exec_int_t *restrict src = src_column + row;
         int n;
         for (n = 0; n < 4; n++) {
           result[n] = ((int_regs[src[n]]) + row)[n];
         }
-        uint8_t delta = (chain & 0xFF000000) >> 24;
+        sl_exec_row_t delta = chain_column[row + 3];
         if (!delta) goto done;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
         /* Not trying to evoke auto-vectorization, just get it done. */
         result_column[row] = (int_regs[src_column[row]])[row];
-        uint8_t delta = chain_column[row];
+        sl_exec_row_t delta = chain_column[row];
         if (!delta) goto done;
         row += delta;
       } while (row & 3);
@@ -425,41 +501,40 @@ void sl_exec_i_indir_load(uint8_t row, uint8_t *restrict chain_column, int64_t *
 done:;
 }
 
-void sl_exec_b_indir_load(uint8_t row, uint8_t *restrict chain_column, uint8_t *restrict result_column, const int64_t *restrict src_column, const uint8_t * restrict * restrict bool_regs) {
+void sl_exec_b_indir_load(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, uint8_t *restrict result_column, const sl_exec_int_t *restrict src_column, const uint8_t * restrict * restrict bool_regs) {
   for (;;) {
-    uint64_t chain;
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         uint8_t *restrict result = result_column + row;
-        const int64_t *restrict src = src_column + row;
+        const sl_exec_int_t *restrict src = src_column + row;
         int n;
         for (n = 0; n < 8; n++) {
           result[n] = ((bool_regs[src[n]]) + row)[n];
         }
 
-        uint8_t delta = (chain & 0xFF00000000000000) >> 56;
+        sl_exec_row_t delta = chain_column[row + 7];
         if (!delta) goto done;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         uint8_t *restrict result = result_column + row;
-        const int64_t *restrict src = src_column + row;
+        const sl_exec_int_t *restrict src = src_column + row;
         int n;
         for (n = 0; n < 4; n++) {
           result[n] = ((bool_regs[src[n]]) + row)[n];
         }
-        uint8_t delta = (chain & 0xFF000000) >> 24;
+        sl_exec_row_t delta = chain_column[row + 3];
         if (!delta) goto done;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
         /* Not trying to evoke auto-vectorization, just get it done. */
         result_column[row] = (bool_regs[src_column[row]])[row];
-        uint8_t delta = chain_column[row];
+        sl_exec_row_t delta = chain_column[row];
         if (!delta) goto done;
         row += delta;
       } while (row & 3);
@@ -468,41 +543,40 @@ void sl_exec_b_indir_load(uint8_t row, uint8_t *restrict chain_column, uint8_t *
 done:;
 }
 
-void sl_exec_p_indir_load(uint8_t row, uint8_t *restrict chain_column, void **restrict result_column, const int64_t *restrict src_column, void * restrict * const restrict *restrict voidp_regs) {
+void sl_exec_p_indir_load(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, void **restrict result_column, const sl_exec_int_t *restrict src_column, void * restrict * const restrict *restrict voidp_regs) {
   for (;;) {
-    uint64_t chain;
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         void **restrict result = result_column + row;
-        const int64_t *restrict src = src_column + row;
+        const sl_exec_int_t *restrict src = src_column + row;
         int n;
         for (n = 0; n < 8; n++) {
           result[n] = ((voidp_regs[src[n]]) + row)[n];
         }
 
-        uint8_t delta = (chain & 0xFF00000000000000) >> 56;
+        sl_exec_row_t delta = chain_column[row + 7];
         if (!delta) goto done;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         void **restrict result = result_column + row;
-        const int64_t *restrict src = src_column + row;
+        const sl_exec_int_t *restrict src = src_column + row;
         int n;
         for (n = 0; n < 4; n++) {
           result[n] = ((voidp_regs[src[n]]) + row)[n];
         }
-        uint8_t delta = (chain & 0xFF000000) >> 24;
+        sl_exec_row_t delta = chain_column[row + 3];
         if (!delta) goto done;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
         /* Not trying to evoke auto-vectorization, just get it done. */
         result_column[row] = (voidp_regs[src_column[row]])[row];
-        uint8_t delta = chain_column[row];
+        sl_exec_row_t delta = chain_column[row];
         if (!delta) goto done;
         row += delta;
       } while (row & 3);
@@ -511,10 +585,9 @@ void sl_exec_p_indir_load(uint8_t row, uint8_t *restrict chain_column, void **re
 done:;
 }
 
-void sl_exec_f_init(uint8_t row, uint8_t *restrict chain_column, float *restrict result_column, float src) {
+void sl_exec_f_init(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, float src) {
   for (;;) {
-    uint64_t chain;
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict result = result_column + row;
         int n;
@@ -522,28 +595,28 @@ void sl_exec_f_init(uint8_t row, uint8_t *restrict chain_column, float *restrict
           result[n] = src;
         }
 
-        uint8_t delta = (chain & 0xFF00000000000000) >> 56;
+        sl_exec_row_t delta = chain_column[row + 7];
         if (!delta) goto done;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict result = result_column + row;
         int n;
         for (n = 0; n < 4; n++) {
           result[n] = src;
         }
-        uint8_t delta = (chain & 0xFF000000) >> 24;
+        sl_exec_row_t delta = chain_column[row + 3];
         if (!delta) goto done;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
         /* Not trying to evoke auto-vectorization, just get it done. */
         result_column[row] = src;
-        uint8_t delta = chain_column[row];
+        sl_exec_row_t delta = chain_column[row];
         if (!delta) goto done;
         row += delta;
       } while (row & 3);
@@ -552,39 +625,38 @@ void sl_exec_f_init(uint8_t row, uint8_t *restrict chain_column, float *restrict
 done:;
 }
 
-void sl_exec_i_init(uint8_t row, uint8_t *restrict chain_column, int64_t *restrict result_column, int64_t src) {
+void sl_exec_i_init(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, sl_exec_int_t *restrict result_column, sl_exec_int_t src) {
   for (;;) {
-    uint64_t chain;
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
-        int64_t *restrict result = result_column + row;
+        sl_exec_int_t *restrict result = result_column + row;
         int n;
         for (n = 0; n < 8; n++) {
           result[n] = src;
         }
 
-        uint8_t delta = (chain & 0xFF00000000000000) >> 56;
+        sl_exec_row_t delta = chain_column[row + 7];
         if (!delta) goto done;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
-        int64_t *restrict result = result_column + row;
+        sl_exec_int_t *restrict result = result_column + row;
         int n;
         for (n = 0; n < 4; n++) {
           result[n] = src;
         }
-        uint8_t delta = (chain & 0xFF000000) >> 24;
+        sl_exec_row_t delta = chain_column[row + 3];
         if (!delta) goto done;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
         /* Not trying to evoke auto-vectorization, just get it done. */
         result_column[row] = src;
-        uint8_t delta = chain_column[row];
+        sl_exec_row_t delta = chain_column[row];
         if (!delta) goto done;
         row += delta;
       } while (row & 3);
@@ -593,10 +665,9 @@ void sl_exec_i_init(uint8_t row, uint8_t *restrict chain_column, int64_t *restri
 done:;
 }
 
-void sl_exec_b_init(uint8_t row, uint8_t *restrict chain_column, uint8_t *restrict result_column, uint8_t src) {
+void sl_exec_b_init(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, uint8_t *restrict result_column, uint8_t src) {
   for (;;) {
-    uint64_t chain;
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         uint8_t *restrict result = result_column + row;
         int n;
@@ -604,28 +675,28 @@ void sl_exec_b_init(uint8_t row, uint8_t *restrict chain_column, uint8_t *restri
           result[n] = src;
         }
 
-        uint8_t delta = (chain & 0xFF00000000000000) >> 56;
+        sl_exec_row_t delta = chain_column[row + 7];
         if (!delta) goto done;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         uint8_t *restrict result = result_column + row;
         int n;
         for (n = 0; n < 4; n++) {
           result[n] = src;
         }
-        uint8_t delta = (chain & 0xFF000000) >> 24;
+        sl_exec_row_t delta = chain_column[row + 3];
         if (!delta) goto done;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
         /* Not trying to evoke auto-vectorization, just get it done. */
         result_column[row] = src;
-        uint8_t delta = chain_column[row];
+        sl_exec_row_t delta = chain_column[row];
         if (!delta) goto done;
         row += delta;
       } while (row & 3);
@@ -635,10 +706,13 @@ done:;
 }
 
 
-void sl_exec_f_dot_product2(uint8_t row, uint8_t *restrict chain_column, float *restrict result_column, const float *restrict left_0_column, const float *restrict left_1_column, const float *restrict right_0_column, const float *restrict right_1_column) {
+void sl_exec_f_dot_product2(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, const float *restrict left_0_column, const float *restrict left_1_column, const float *restrict right_0_column, const float *restrict right_1_column) {
+  if (g_sl_simd_.f_dot_product2_) {
+    g_sl_simd_.f_dot_product2_(row, chain_column, result_column, left_0_column, left_1_column, right_0_column, right_1_column);
+    return;
+  }
   for (;;) {
-    uint64_t chain;
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict result = result_column + row;
         const float *restrict left0 = left_0_column + row;
@@ -651,12 +725,12 @@ void sl_exec_f_dot_product2(uint8_t row, uint8_t *restrict chain_column, float *
           result[n] = left0[n] * right0[n] + left1[n] * right1[n];
         }
 
-        uint8_t delta = (chain & 0xFF00000000000000) >> 56;
+        sl_exec_row_t delta = chain_column[row + 7];
         if (!delta) goto done;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict result = result_column + row;
         const float *restrict left0 = left_0_column + row;
@@ -668,16 +742,16 @@ void sl_exec_f_dot_product2(uint8_t row, uint8_t *restrict chain_column, float *
         for (n = 0; n < 4; n++) {
           result[n] = left0[n] * right0[n] + left1[n] * right1[n];
         }
-        uint8_t delta = (chain & 0xFF000000) >> 24;
+        sl_exec_row_t delta = chain_column[row + 3];
         if (!delta) goto done;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
         /* Not trying to evoke auto-vectorization, just get it done. */
         result_column[row] = left_0_column[row] * right_0_column[row] + left_1_column[row] * right_1_column[row];
-        uint8_t delta = chain_column[row];
+        sl_exec_row_t delta = chain_column[row];
         if (!delta) goto done;
         row += delta;
       } while (row & 3);
@@ -686,16 +760,19 @@ void sl_exec_f_dot_product2(uint8_t row, uint8_t *restrict chain_column, float *
 done:;
 }
 
-void sl_exec_f_dot_product3(uint8_t row, uint8_t *restrict chain_column, float *restrict result_column, 
+void sl_exec_f_dot_product3(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, 
                             const float *restrict left_0_column, 
                             const float *restrict left_1_column, 
                             const float *restrict left_2_column, 
                             const float *restrict right_0_column,
                             const float *restrict right_1_column,
                             const float *restrict right_2_column) {
+  if (g_sl_simd_.f_dot_product3_) {
+    g_sl_simd_.f_dot_product3_(row, chain_column, result_column, left_0_column, left_1_column, left_2_column, right_0_column, right_1_column, right_2_column);
+    return;
+  }
   for (;;) {
-    uint64_t chain;
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict result = result_column + row;
         const float *restrict left0 = left_0_column + row;
@@ -710,12 +787,12 @@ void sl_exec_f_dot_product3(uint8_t row, uint8_t *restrict chain_column, float *
           result[n] = left0[n] * right0[n] + left1[n] * right1[n] + left2[n] * right2[n];
         }
 
-        uint8_t delta = (chain & 0xFF00000000000000) >> 56;
+        sl_exec_row_t delta = chain_column[row + 7];
         if (!delta) goto done;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict result = result_column + row;
         const float *restrict left0 = left_0_column + row;
@@ -729,10 +806,10 @@ void sl_exec_f_dot_product3(uint8_t row, uint8_t *restrict chain_column, float *
         for (n = 0; n < 4; n++) {
           result[n] = left0[n] * right0[n] + left1[n] * right1[n] + left2[n] * right2[n];
         }
-        uint8_t delta = (chain & 0xFF000000) >> 24;
+        sl_exec_row_t delta = chain_column[row + 3];
         if (!delta) goto done;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -740,7 +817,7 @@ void sl_exec_f_dot_product3(uint8_t row, uint8_t *restrict chain_column, float *
         result_column[row] = left_0_column[row] * right_0_column[row] 
                            + left_1_column[row] * right_1_column[row]
                            + left_2_column[row] * right_2_column[row];
-        uint8_t delta = chain_column[row];
+        sl_exec_row_t delta = chain_column[row];
         if (!delta) goto done;
         row += delta;
       } while (row & 3);
@@ -749,7 +826,7 @@ void sl_exec_f_dot_product3(uint8_t row, uint8_t *restrict chain_column, float *
 done:;
 }
 
-void sl_exec_f_dot_product4(uint8_t row, uint8_t *restrict chain_column, float *restrict result_column, 
+void sl_exec_f_dot_product4(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, 
                             const float *restrict left_0_column, 
                             const float *restrict left_1_column, 
                             const float *restrict left_2_column, 
@@ -758,9 +835,12 @@ void sl_exec_f_dot_product4(uint8_t row, uint8_t *restrict chain_column, float *
                             const float *restrict right_1_column,
                             const float *restrict right_2_column,
                             const float *restrict right_3_column) {
+  if (g_sl_simd_.f_dot_product4_) {
+    g_sl_simd_.f_dot_product4_(row, chain_column, result_column, left_0_column, left_1_column, left_2_column, left_3_column, right_0_column, right_1_column, right_2_column, right_3_column);
+    return;
+  }
   for (;;) {
-    uint64_t chain;
-    if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
       do {
         float *restrict result = result_column + row;
         const float *restrict left0 = left_0_column + row;
@@ -777,12 +857,12 @@ void sl_exec_f_dot_product4(uint8_t row, uint8_t *restrict chain_column, float *
           result[n] = left0[n] * right0[n] + left1[n] * right1[n] + left2[n] * right2[n] + left3[n] * right3[n];
         }
 
-        uint8_t delta = (chain & 0xFF00000000000000) >> 56;
+        sl_exec_row_t delta = chain_column[row + 7];
         if (!delta) goto done;
         row += 7 + delta;
-      } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
     }
-    else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
       do {
         float *restrict result = result_column + row;
         const float *restrict left0 = left_0_column + row;
@@ -798,10 +878,10 @@ void sl_exec_f_dot_product4(uint8_t row, uint8_t *restrict chain_column, float *
         for (n = 0; n < 4; n++) {
           result[n] = left0[n] * right0[n] + left1[n] * right1[n] + left2[n] * right2[n] + left3[n] * right3[n];
         }
-        uint8_t delta = (chain & 0xFF000000) >> 24;
+        sl_exec_row_t delta = chain_column[row + 3];
         if (!delta) goto done;
         row += 3 + delta;
-      } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
     }
     else {
       do {
@@ -810,7 +890,7 @@ void sl_exec_f_dot_product4(uint8_t row, uint8_t *restrict chain_column, float *
                            + left_1_column[row] * right_1_column[row]
                            + left_2_column[row] * right_2_column[row]
                            + left_3_column[row] * right_3_column[row];
-        uint8_t delta = chain_column[row];
+        sl_exec_row_t delta = chain_column[row];
         if (!delta) goto done;
         row += delta;
       } while (row & 3);
@@ -819,16 +899,561 @@ void sl_exec_f_dot_product4(uint8_t row, uint8_t *restrict chain_column, float *
 done:;
 }
 
-static void sl_exec_split_chains_by_bool(struct sl_execution *exec, struct sl_expr *cond, uint32_t input_chain, uint32_t *ptrue_chain, uint32_t *pfalse_chain) {
-  uint8_t row;
-  if (input_chain == SL_EXEC_NO_CHAIN) return;
-  row = (uint8_t)input_chain;
-  const uint8_t * restrict cond_col = BOOL_REG_PTR(cond, 0);
-  uint8_t * restrict chain_col = exec->exec_chain_reg_;
+/* Operands of sl_exec_f_matrix_product(), and the operand values for the rows being computed. Scalar operands
+ * are broadcast to the values once, up front, rather than for every group of rows. */
+struct sl_exec_matrix_product {
+  int num_rows_;
+  int inner_;
+  int num_cols_;
+  float * const *result_columns_;
+  const float * const *left_columns_;
+  const float * const *right_columns_;
+  float left_[16][8];
+  float right_[16][8];
+};
+
+static void sl_exec_f_matrix_product_init(struct sl_exec_matrix_product *mp, int num_rows, int inner, int num_cols,
+                                          float * const *result_columns, const float * const *left_columns, const float *left_scalars,
+                                          const float * const *right_columns, const float *right_scalars) {
+  int k, n;
+  mp->num_rows_ = num_rows;
+  mp->inner_ = inner;
+  mp->num_cols_ = num_cols;
+  mp->result_columns_ = result_columns;
+  mp->left_columns_ = left_scalars ? NULL : left_columns;
+  mp->right_columns_ = right_scalars ? NULL : right_columns;
+  if (left_scalars) {
+    for (k = 0; k < num_rows * inner; ++k) {
+      for (n = 0; n < 8; ++n) {
+        mp->left_[k][n] = left_scalars[k];
+      }
+    }
+  }
+  if (right_scalars) {
+    for (k = 0; k < inner * num_cols; ++k) {
+      for (n = 0; n < 8; ++n) {
+        mp->right_[k][n] = right_scalars[k];
+      }
+    }
+  }
+}
+
+/* Computes width (8, 4 or 1) rows from row onwards, storing those set in store_bits. All operand columns are
+ * loaded before any result is stored, so results may be written over the operands. */
+static void sl_exec_f_matrix_product_rows(struct sl_exec_matrix_product *mp, int row, int width, unsigned int store_bits) {
+  float result[16][8];
+  int num_rows = mp->num_rows_, inner = mp->inner_, num_cols = mp->num_cols_;
+  int r, c, k, n;
+  if (mp->left_columns_) {
+    for (k = 0; k < num_rows * inner; ++k) {
+      const float *restrict column = mp->left_columns_[k] + row;
+      for (n = 0; n < width; ++n) {
+        mp->left_[k][n] = column[n];
+      }
+    }
+  }
+  if (mp->right_columns_) {
+    for (k = 0; k < inner * num_cols; ++k) {
+      const float *restrict column = mp->right_columns_[k] + row;
+      for (n = 0; n < width; ++n) {
+        mp->right_[k][n] = column[n];
+      }
+    }
+  }
+  for (c = 0; c < num_cols; ++c) {
+    for (r = 0; r < num_rows; ++r) {
+      float *restrict sum = result[c * num_rows + r];
+      /* Summed left to right, as the dot product kernels do, so results are identical */
+      for (n = 0; n < width; ++n) {
+        sum[n] = mp->left_[r][n] * mp->right_[c * inner][n];
+      }
+      for (k = 1; k < inner; ++k) {
+        const float *restrict left = mp->left_[k * num_rows + r];
+        const float *restrict right = mp->right_[c * inner + k];
+        for (n = 0; n < width; ++n) {
+          sum[n] += left[n] * right[n];
+        }
+      }
+    }
+  }
+  for (k = 0; k < num_rows * num_cols; ++k) {
+    float *restrict column = mp->result_columns_[k] + row;
+    if (store_bits == ((1u << width) - 1)) {
+      for (n = 0; n < width; ++n) {
+        column[n] = result[k][n];
+      }
+    }
+    else {
+      for (n = 0; n < width; ++n) {
+        if (store_bits & (1u << n)) column[n] = result[k][n];
+      }
+    }
+  }
+}
+
+void sl_exec_f_matrix_product(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, int num_rows, int inner, int num_cols,
+                              float * const *result_columns, const float * const *left_columns, const float *left_scalars,
+                              const float * const *right_columns, const float *right_scalars) {
+  struct sl_exec_matrix_product mp;
+  if (g_sl_simd_.f_matrix_product_) {
+    g_sl_simd_.f_matrix_product_(row, chain_column, num_rows, inner, num_cols, result_columns, left_columns, left_scalars, right_columns, right_scalars);
+    return;
+  }
+  sl_exec_f_matrix_product_init(&mp, num_rows, inner, num_cols, result_columns, left_columns, left_scalars, right_columns, right_scalars);
+  for (;;) {
+    sl_exec_row_t delta;
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
+      sl_exec_f_matrix_product_rows(&mp, row, 8, 0xFF);
+      delta = chain_column[row + 7];
+      if (!delta) break;
+      row += 7 + delta;
+    }
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
+      sl_exec_f_matrix_product_rows(&mp, row, 4, 0xF);
+      delta = chain_column[row + 3];
+      if (!delta) break;
+      row += 3 + delta;
+    }
+    else {
+      sl_exec_f_matrix_product_rows(&mp, row, 1, 0x1);
+      delta = chain_column[row];
+      if (!delta) break;
+      row += delta;
+    }
+  }
+}
+
+void sl_exec_f_matrix_product_masked(const uint64_t *restrict mask, int num_rows, int inner, int num_cols,
+                                     float * const *result_columns, const float * const *left_columns, const float *left_scalars,
+                                     const float * const *right_columns, const float *right_scalars) {
+  struct sl_exec_matrix_product mp;
+  int block;
+  if (g_sl_simd_.f_matrix_product_masked_) {
+    g_sl_simd_.f_matrix_product_masked_(mask, num_rows, inner, num_cols, result_columns, left_columns, left_scalars, right_columns, right_scalars);
+    return;
+  }
+  sl_exec_f_matrix_product_init(&mp, num_rows, inner, num_cols, result_columns, left_columns, left_scalars, right_columns, right_scalars);
+  for (block = 0; block < (SL_EXEC_CHAIN_MAX_NUM_ROWS / 8); ++block) {
+    uint8_t bits = (uint8_t)(mask[block >> 3] >> ((block & 7) * 8));
+    if (bits) sl_exec_f_matrix_product_rows(&mp, block * 8, 8, bits);
+  }
+}
+
+/* The float builtins max(), clamp() and mix() as run by the bytecode (see SLIR_MAX_F, SLIR_CLAMP_F and SLIR_MIX_F),
+ * computing the same values as builtins.c does. */
+void sl_exec_f_max(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, const float *restrict left_column, const float *restrict right_column) {
+#define BINOP_SNIPPET_OPERATOR(left, right) fmaxf(left, right)
+#define BINOP_SNIPPET_TYPE float
+#include "sl_binop_snippet_inc.h"
+#undef BINOP_SNIPPET_OPERATOR
+#undef BINOP_SNIPPET_TYPE
+}
+
+void sl_exec_f_clamp(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column,
+                     const float *restrict first_column, const float *restrict second_column, const float *restrict third_column) {
+#define TERNOP_SNIPPET_OPERATOR(x, minval, maxval) fminf(fmaxf(x, minval), maxval)
+#define TERNOP_SNIPPET_TYPE float
+#define TERNOP_SNIPPET_SIMD_KERNEL g_sl_simd_.f_clamp_
+#include "sl_ternop_snippet_inc.h"
+#undef TERNOP_SNIPPET_OPERATOR
+#undef TERNOP_SNIPPET_TYPE
+#undef TERNOP_SNIPPET_SIMD_KERNEL
+}
+
+void sl_exec_f_mix(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column,
+                   const float *restrict first_column, const float *restrict second_column, const float *restrict third_column) {
+#define TERNOP_SNIPPET_OPERATOR(x, y, a) x * (1.f - a) + y * a
+#define TERNOP_SNIPPET_TYPE float
+#define TERNOP_SNIPPET_SIMD_KERNEL g_sl_simd_.f_mix_
+#include "sl_ternop_snippet_inc.h"
+#undef TERNOP_SNIPPET_OPERATOR
+#undef TERNOP_SNIPPET_TYPE
+#undef TERNOP_SNIPPET_SIMD_KERNEL
+}
+
+/* Superinstructions (see SLIR_MAD_F and onwards); each rounds the intermediate value just as the separate
+ * instructions would, so results are identical, but the intermediate is never stored and the chain is walked once. */
+void sl_exec_f_mad(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column,
+                   const float *restrict first_column, const float *restrict second_column, const float *restrict third_column) {
+#define TERNOP_SNIPPET_OPERATOR(a, b, c) a * b + c
+#define TERNOP_SNIPPET_TYPE float
+#include "sl_ternop_snippet_inc.h"
+#undef TERNOP_SNIPPET_OPERATOR
+#undef TERNOP_SNIPPET_TYPE
+}
+
+void sl_exec_f_lerp(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column,
+                    const float *restrict first_column, const float *restrict second_column, const float *restrict third_column) {
+#define TERNOP_SNIPPET_OPERATOR(a, b, t) (b - a) * t + a
+#define TERNOP_SNIPPET_TYPE float
+#include "sl_ternop_snippet_inc.h"
+#undef TERNOP_SNIPPET_OPERATOR
+#undef TERNOP_SNIPPET_TYPE
+}
+
+void sl_exec_f_dot_product2_clamp(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column,
+                                  const float *restrict left_0_column, const float *restrict left_1_column,
+                                  const float *restrict right_0_column, const float *restrict right_1_column,
+                                  const float *restrict lower_column, const float *restrict upper_column) {
+  if (upper_column) {
+#define ROW_SNIPPET_OPERATOR(row) fminf(fmaxf(left_0_column[row] * right_0_column[row] + left_1_column[row] * right_1_column[row], lower_column[row]), upper_column[row])
+#include "sl_row_snippet_inc.h"
+#undef ROW_SNIPPET_OPERATOR
+  }
+  else {
+#define ROW_SNIPPET_OPERATOR(row) fmaxf(left_0_column[row] * right_0_column[row] + left_1_column[row] * right_1_column[row], lower_column[row])
+#include "sl_row_snippet_inc.h"
+#undef ROW_SNIPPET_OPERATOR
+  }
+}
+
+void sl_exec_f_dot_product3_clamp(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column,
+                                  const float *restrict left_0_column, const float *restrict left_1_column, const float *restrict left_2_column,
+                                  const float *restrict right_0_column, const float *restrict right_1_column, const float *restrict right_2_column,
+                                  const float *restrict lower_column, const float *restrict upper_column) {
+  if (upper_column) {
+#define ROW_SNIPPET_OPERATOR(row) fminf(fmaxf(left_0_column[row] * right_0_column[row] + left_1_column[row] * right_1_column[row] + left_2_column[row] * right_2_column[row], lower_column[row]), upper_column[row])
+#include "sl_row_snippet_inc.h"
+#undef ROW_SNIPPET_OPERATOR
+  }
+  else {
+#define ROW_SNIPPET_OPERATOR(row) fmaxf(left_0_column[row] * right_0_column[row] + left_1_column[row] * right_1_column[row] + left_2_column[row] * right_2_column[row], lower_column[row])
+#include "sl_row_snippet_inc.h"
+#undef ROW_SNIPPET_OPERATOR
+  }
+}
+
+void sl_exec_f_dot_product4_clamp(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column,
+                                  const float *restrict left_0_column, const float *restrict left_1_column, const float *restrict left_2_column, const float *restrict left_3_column,
+                                  const float *restrict right_0_column, const float *restrict right_1_column, const float *restrict right_2_column, const float *restrict right_3_column,
+                                  const float *restrict lower_column, const float *restrict upper_column) {
+  if (upper_column) {
+#define ROW_SNIPPET_OPERATOR(row) fminf(fmaxf(left_0_column[row] * right_0_column[row] + left_1_column[row] * right_1_column[row] + left_2_column[row] * right_2_column[row] + left_3_column[row] * right_3_column[row], lower_column[row]), upper_column[row])
+#include "sl_row_snippet_inc.h"
+#undef ROW_SNIPPET_OPERATOR
+  }
+  else {
+#define ROW_SNIPPET_OPERATOR(row) fmaxf(left_0_column[row] * right_0_column[row] + left_1_column[row] * right_1_column[row] + left_2_column[row] * right_2_column[row] + left_3_column[row] * right_3_column[row], lower_column[row])
+#include "sl_row_snippet_inc.h"
+#undef ROW_SNIPPET_OPERATOR
+  }
+}
+
+/* Kernels with scalar operands, used for uniforms, which hold the same value for all rows; see
+ * sl_execution::float_uniforms_ */
+void sl_exec_f_add_scalar(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, const float *restrict left_column, float right) {
+#define ROW_SNIPPET_OPERATOR(row) left_column[row] + right
+#include "sl_row_snippet_inc.h"
+#undef ROW_SNIPPET_OPERATOR
+}
+
+void sl_exec_f_sub_scalar(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, const float *restrict left_column, float right) {
+#define ROW_SNIPPET_OPERATOR(row) left_column[row] - right
+#include "sl_row_snippet_inc.h"
+#undef ROW_SNIPPET_OPERATOR
+}
+
+void sl_exec_f_scalar_sub(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, float left, const float *restrict right_column) {
+#define ROW_SNIPPET_OPERATOR(row) left - right_column[row]
+#include "sl_row_snippet_inc.h"
+#undef ROW_SNIPPET_OPERATOR
+}
+
+void sl_exec_f_mul_scalar(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, const float *restrict left_column, float right) {
+#define ROW_SNIPPET_OPERATOR(row) left_column[row] * right
+#include "sl_row_snippet_inc.h"
+#undef ROW_SNIPPET_OPERATOR
+}
+
+void sl_exec_f_div_scalar(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, const float *restrict left_column, float right) {
+#define ROW_SNIPPET_OPERATOR(row) left_column[row] / right
+#include "sl_row_snippet_inc.h"
+#undef ROW_SNIPPET_OPERATOR
+}
+
+void sl_exec_f_scalar_div(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, float left, const float *restrict right_column) {
+#define ROW_SNIPPET_OPERATOR(row) left / right_column[row]
+#include "sl_row_snippet_inc.h"
+#undef ROW_SNIPPET_OPERATOR
+}
+
+void sl_exec_f_scalar_dot_product2(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column,
+                                   float left_0, float left_1,
+                                   const float *restrict right_0_column, const float *restrict right_1_column) {
+#define ROW_SNIPPET_OPERATOR(row) left_0 * right_0_column[row] + left_1 * right_1_column[row]
+#include "sl_row_snippet_inc.h"
+#undef ROW_SNIPPET_OPERATOR
+}
+
+void sl_exec_f_scalar_dot_product3(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column,
+                                   float left_0, float left_1, float left_2,
+                                   const float *restrict right_0_column, const float *restrict right_1_column, const float *restrict right_2_column) {
+#define ROW_SNIPPET_OPERATOR(row) left_0 * right_0_column[row] + left_1 * right_1_column[row] + left_2 * right_2_column[row]
+#include "sl_row_snippet_inc.h"
+#undef ROW_SNIPPET_OPERATOR
+}
+
+void sl_exec_f_scalar_dot_product4(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column,
+                                   float left_0, float left_1, float left_2, float left_3,
+                                   const float *restrict right_0_column, const float *restrict right_1_column, const float *restrict right_2_column, const float *restrict right_3_column) {
+#define ROW_SNIPPET_OPERATOR(row) left_0 * right_0_column[row] + left_1 * right_1_column[row] + left_2 * right_2_column[row] + left_3 * right_3_column[row]
+#include "sl_row_snippet_inc.h"
+#undef ROW_SNIPPET_OPERATOR
+}
+
+void sl_exec_f_gather_scalars(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column,
+                              const float *restrict scalars, int base, const sl_exec_int_t *restrict index_column, int index_stepsize) {
+#define ROW_SNIPPET_OPERATOR(row) scalars[base + index_stepsize * index_column[row]]
+#include "sl_row_snippet_inc.h"
+#undef ROW_SNIPPET_OPERATOR
+}
+
+void sl_exec_f_add_masked(const uint64_t *restrict mask, float *restrict result_column, const float *restrict left_column, const float *restrict right_column) {
+#define MASKED_SNIPPET_OPERATOR(row) left_column[row] + right_column[row]
+#define MASKED_SNIPPET_SIMD_KERNEL g_sl_simd_.f_add_masked_
+#define MASKED_SNIPPET_SIMD_ARGS left_column, right_column
+#include "sl_masked_snippet_inc.h"
+#undef MASKED_SNIPPET_OPERATOR
+#undef MASKED_SNIPPET_SIMD_KERNEL
+#undef MASKED_SNIPPET_SIMD_ARGS
+}
+
+void sl_exec_f_sub_masked(const uint64_t *restrict mask, float *restrict result_column, const float *restrict left_column, const float *restrict right_column) {
+#define MASKED_SNIPPET_OPERATOR(row) left_column[row] - right_column[row]
+#define MASKED_SNIPPET_SIMD_KERNEL g_sl_simd_.f_sub_masked_
+#define MASKED_SNIPPET_SIMD_ARGS left_column, right_column
+#include "sl_masked_snippet_inc.h"
+#undef MASKED_SNIPPET_OPERATOR
+#undef MASKED_SNIPPET_SIMD_KERNEL
+#undef MASKED_SNIPPET_SIMD_ARGS
+}
+
+void sl_exec_f_mul_masked(const uint64_t *restrict mask, float *restrict result_column, const float *restrict left_column, const float *restrict right_column) {
+#define MASKED_SNIPPET_OPERATOR(row) left_column[row] * right_column[row]
+#define MASKED_SNIPPET_SIMD_KERNEL g_sl_simd_.f_mul_masked_
+#define MASKED_SNIPPET_SIMD_ARGS left_column, right_column
+#include "sl_masked_snippet_inc.h"
+#undef MASKED_SNIPPET_OPERATOR
+#undef MASKED_SNIPPET_SIMD_KERNEL
+#undef MASKED_SNIPPET_SIMD_ARGS
+}
+
+void sl_exec_f_div_masked(const uint64_t *restrict mask, float *restrict result_column, const float *restrict left_column, const float *restrict right_column) {
+#define MASKED_SNIPPET_OPERATOR(row) left_column[row] / right_column[row]
+#define MASKED_SNIPPET_SIMD_KERNEL g_sl_simd_.f_div_masked_
+#define MASKED_SNIPPET_SIMD_ARGS left_column, right_column
+#include "sl_masked_snippet_inc.h"
+#undef MASKED_SNIPPET_OPERATOR
+#undef MASKED_SNIPPET_SIMD_KERNEL
+#undef MASKED_SNIPPET_SIMD_ARGS
+}
+
+void sl_exec_f_negate_masked(const uint64_t *restrict mask, float *restrict result_column, const float *restrict opd_column) {
+#define MASKED_SNIPPET_OPERATOR(row) -opd_column[row]
+#define MASKED_SNIPPET_SIMD_KERNEL g_sl_simd_.f_negate_masked_
+#define MASKED_SNIPPET_SIMD_ARGS opd_column
+#include "sl_masked_snippet_inc.h"
+#undef MASKED_SNIPPET_OPERATOR
+#undef MASKED_SNIPPET_SIMD_KERNEL
+#undef MASKED_SNIPPET_SIMD_ARGS
+}
+
+void sl_exec_f_increment_masked(const uint64_t *restrict mask, float *restrict result_column, const float *restrict opd_column) {
+#define MASKED_SNIPPET_OPERATOR(row) (opd_column[row] + 1.f)
+#define MASKED_SNIPPET_SIMD_KERNEL g_sl_simd_.f_increment_masked_
+#define MASKED_SNIPPET_SIMD_ARGS opd_column
+#include "sl_masked_snippet_inc.h"
+#undef MASKED_SNIPPET_OPERATOR
+#undef MASKED_SNIPPET_SIMD_KERNEL
+#undef MASKED_SNIPPET_SIMD_ARGS
+}
+
+void sl_exec_f_decrement_masked(const uint64_t *restrict mask, float *restrict result_column, const float *restrict opd_column) {
+#define MASKED_SNIPPET_OPERATOR(row) (opd_column[row] - 1.f)
+#define MASKED_SNIPPET_SIMD_KERNEL g_sl_simd_.f_decrement_masked_
+#define MASKED_SNIPPET_SIMD_ARGS opd_column
+#include "sl_masked_snippet_inc.h"
+#undef MASKED_SNIPPET_OPERATOR
+#undef MASKED_SNIPPET_SIMD_KERNEL
+#undef MASKED_SNIPPET_SIMD_ARGS
+}
+
+void sl_exec_f_dot_product2_masked(const uint64_t *restrict mask, float *restrict result_column,
+                                   const float *restrict left_0_column, const float *restrict left_1_column,
+                                   const float *restrict right_0_column, const float *restrict right_1_column) {
+#define MASKED_SNIPPET_OPERATOR(row) left_0_column[row] * right_0_column[row] + left_1_column[row] * right_1_column[row]
+#define MASKED_SNIPPET_SIMD_KERNEL g_sl_simd_.f_dot_product2_masked_
+#define MASKED_SNIPPET_SIMD_ARGS left_0_column, left_1_column, right_0_column, right_1_column
+#include "sl_masked_snippet_inc.h"
+#undef MASKED_SNIPPET_OPERATOR
+#undef MASKED_SNIPPET_SIMD_KERNEL
+#undef MASKED_SNIPPET_SIMD_ARGS
+}
+
+void sl_exec_f_dot_product3_masked(const uint64_t *restrict mask, float *restrict result_column,
+                                   const float *restrict left_0_column, const float *restrict left_1_column, const float *restrict left_2_column,
+                                   const float *restrict right_0_column, const float *restrict right_1_column, const float *restrict right_2_column) {
+#define MASKED_SNIPPET_OPERATOR(row) left_0_column[row] * right_0_column[row] + left_1_column[row] * right_1_column[row] + left_2_column[row] * right_2_column[row]
+#define MASKED_SNIPPET_SIMD_KERNEL g_sl_simd_.f_dot_product3_masked_
+#define MASKED_SNIPPET_SIMD_ARGS left_0_column, left_1_column, left_2_column, right_0_column, right_1_column, right_2_column
+#include "sl_masked_snippet_inc.h"
+#undef MASKED_SNIPPET_OPERATOR
+#undef MASKED_SNIPPET_SIMD_KERNEL
+#undef MASKED_SNIPPET_SIMD_ARGS
+}
+
+void sl_exec_f_dot_product4_masked(const uint64_t *restrict mask, float *restrict result_column,
+                                   const float *restrict left_0_column, const float *restrict left_1_column, const float *restrict left_2_column, const float *restrict left_3_column,
+                                   const float *restrict right_0_column, const float *restrict right_1_column, const float *restrict right_2_column, const float *restrict right_3_column) {
+#define MASKED_SNIPPET_OPERATOR(row) left_0_column[row] * right_0_column[row] + left_1_column[row] * right_1_column[row] + left_2_column[row] * right_2_column[row] + left_3_column[row] * right_3_column[row]
+#define MASKED_SNIPPET_SIMD_KERNEL g_sl_simd_.f_dot_product4_masked_
+#define MASKED_SNIPPET_SIMD_ARGS left_0_column, left_1_column, left_2_column, left_3_column, right_0_column, right_1_column, right_2_column, right_3_column
+#include "sl_masked_snippet_inc.h"
+#undef MASKED_SNIPPET_OPERATOR
+#undef MASKED_SNIPPET_SIMD_KERNEL
+#undef MASKED_SNIPPET_SIMD_ARGS
+}
+
+void sl_exec_f_max_masked(const uint64_t *restrict mask, float *restrict result_column, const float *restrict left_column, const float *restrict right_column) {
+#define MASKED_SNIPPET_OPERATOR(row) fmaxf(left_column[row], right_column[row])
+#include "sl_masked_snippet_inc.h"
+#undef MASKED_SNIPPET_OPERATOR
+}
+
+void sl_exec_f_mad_masked(const uint64_t *restrict mask, float *restrict result_column,
+                          const float *restrict first_column, const float *restrict second_column, const float *restrict third_column) {
+#define MASKED_SNIPPET_OPERATOR(row) first_column[row] * second_column[row] + third_column[row]
+#include "sl_masked_snippet_inc.h"
+#undef MASKED_SNIPPET_OPERATOR
+}
+
+void sl_exec_f_lerp_masked(const uint64_t *restrict mask, float *restrict result_column,
+                           const float *restrict first_column, const float *restrict second_column, const float *restrict third_column) {
+#define MASKED_SNIPPET_OPERATOR(row) (second_column[row] - first_column[row]) * third_column[row] + first_column[row]
+#include "sl_masked_snippet_inc.h"
+#undef MASKED_SNIPPET_OPERATOR
+}
+
+void sl_exec_f_dot_product2_clamp_masked(const uint64_t *restrict mask, float *restrict result_column,
+                                         const float *restrict left_0_column, const float *restrict left_1_column,
+                                         const float *restrict right_0_column, const float *restrict right_1_column,
+                                         const float *restrict lower_column, const float *restrict upper_column) {
+  if (upper_column) {
+#define MASKED_SNIPPET_OPERATOR(row) fminf(fmaxf(left_0_column[row] * right_0_column[row] + left_1_column[row] * right_1_column[row], lower_column[row]), upper_column[row])
+#include "sl_masked_snippet_inc.h"
+#undef MASKED_SNIPPET_OPERATOR
+  }
+  else {
+#define MASKED_SNIPPET_OPERATOR(row) fmaxf(left_0_column[row] * right_0_column[row] + left_1_column[row] * right_1_column[row], lower_column[row])
+#include "sl_masked_snippet_inc.h"
+#undef MASKED_SNIPPET_OPERATOR
+  }
+}
+
+void sl_exec_f_dot_product3_clamp_masked(const uint64_t *restrict mask, float *restrict result_column,
+                                         const float *restrict left_0_column, const float *restrict left_1_column, const float *restrict left_2_column,
+                                         const float *restrict right_0_column, const float *restrict right_1_column, const float *restrict right_2_column,
+                                         const float *restrict lower_column, const float *restrict upper_column) {
+  if (upper_column) {
+#define MASKED_SNIPPET_OPERATOR(row) fminf(fmaxf(left_0_column[row] * right_0_column[row] + left_1_column[row] * right_1_column[row] + left_2_column[row] * right_2_column[row], lower_column[row]), upper_column[row])
+#include "sl_masked_snippet_inc.h"
+#undef MASKED_SNIPPET_OPERATOR
+  }
+  else {
+#define MASKED_SNIPPET_OPERATOR(row) fmaxf(left_0_column[row] * right_0_column[row] + left_1_column[row] * right_1_column[row] + left_2_column[row] * right_2_column[row], lower_column[row])
+#include "sl_masked_snippet_inc.h"
+#undef MASKED_SNIPPET_OPERATOR
+  }
+}
+
+void sl_exec_f_dot_product4_clamp_masked(const uint64_t *restrict mask, float *restrict result_column,
+                                         const float *restrict left_0_column, const float *restrict left_1_column, const float *restrict left_2_column, const float *restrict left_3_column,
+                                         const float *restrict right_0_column, const float *restrict right_1_column, const float *restrict right_2_column, const float *restrict right_3_column,
+                                         const float *restrict lower_column, const float *restrict upper_column) {
+  if (upper_column) {
+#define MASKED_SNIPPET_OPERATOR(row) fminf(fmaxf(left_0_column[row] * right_0_column[row] + left_1_column[row] * right_1_column[row] + left_2_column[row] * right_2_column[row] + left_3_column[row] * right_3_column[row], lower_column[row]), upper_column[row])
+#include "sl_masked_snippet_inc.h"
+#undef MASKED_SNIPPET_OPERATOR
+  }
+  else {
+#define MASKED_SNIPPET_OPERATOR(row) fmaxf(left_0_column[row] * right_0_column[row] + left_1_column[row] * right_1_column[row] + left_2_column[row] * right_2_column[row] + left_3_column[row] * right_3_column[row], lower_column[row])
+#include "sl_masked_snippet_inc.h"
+#undef MASKED_SNIPPET_OPERATOR
+  }
+}
+
+void sl_exec_f_add_scalar_masked(const uint64_t *restrict mask, float *restrict result_column, const float *restrict left_column, float right) {
+#define MASKED_SNIPPET_OPERATOR(row) left_column[row] + right
+#include "sl_masked_snippet_inc.h"
+#undef MASKED_SNIPPET_OPERATOR
+}
+
+void sl_exec_f_sub_scalar_masked(const uint64_t *restrict mask, float *restrict result_column, const float *restrict left_column, float right) {
+#define MASKED_SNIPPET_OPERATOR(row) left_column[row] - right
+#include "sl_masked_snippet_inc.h"
+#undef MASKED_SNIPPET_OPERATOR
+}
+
+void sl_exec_f_scalar_sub_masked(const uint64_t *restrict mask, float *restrict result_column, float left, const float *restrict right_column) {
+#define MASKED_SNIPPET_OPERATOR(row) left - right_column[row]
+#include "sl_masked_snippet_inc.h"
+#undef MASKED_SNIPPET_OPERATOR
+}
+
+void sl_exec_f_mul_scalar_masked(const uint64_t *restrict mask, float *restrict result_column, const float *restrict left_column, float right) {
+#define MASKED_SNIPPET_OPERATOR(row) left_column[row] * right
+#include "sl_masked_snippet_inc.h"
+#undef MASKED_SNIPPET_OPERATOR
+}
+
+void sl_exec_f_div_scalar_masked(const uint64_t *restrict mask, float *restrict result_column, const float *restrict left_column, float right) {
+#define MASKED_SNIPPET_OPERATOR(row) left_column[row] / right
+#include "sl_masked_snippet_inc.h"
+#undef MASKED_SNIPPET_OPERATOR
+}
+
+void sl_exec_f_scalar_div_masked(const uint64_t *restrict mask, float *restrict result_column, float left, const float *restrict right_column) {
+#define MASKED_SNIPPET_OPERATOR(row) left / right_column[row]
+#include "sl_masked_snippet_inc.h"
+#undef MASKED_SNIPPET_OPERATOR
+}
+
+void sl_exec_f_scalar_dot_product2_masked(const uint64_t *restrict mask, float *restrict result_column,
+                                          float left_0, float left_1,
+                                          const float *restrict right_0_column, const float *restrict right_1_column) {
+#define MASKED_SNIPPET_OPERATOR(row) left_0 * right_0_column[row] + left_1 * right_1_column[row]
+#include "sl_masked_snippet_inc.h"
+#undef MASKED_SNIPPET_OPERATOR
+}
+
+void sl_exec_f_scalar_dot_product3_masked(const uint64_t *restrict mask, float *restrict result_column,
+                                          float left_0, float left_1, float left_2,
+                                          const float *restrict right_0_column, const float *restrict right_1_column, const float *restrict right_2_column) {
+#define MASKED_SNIPPET_OPERATOR(row) left_0 * right_0_column[row] + left_1 * right_1_column[row] + left_2 * right_2_column[row]
+#include "sl_masked_snippet_inc.h"
+#undef MASKED_SNIPPET_OPERATOR
+}
+
+void sl_exec_f_scalar_dot_product4_masked(const uint64_t *restrict mask, float *restrict result_column,
+                                          float left_0, float left_1, float left_2, float left_3,
+                                          const float *restrict right_0_column, const float *restrict right_1_column, const float *restrict right_2_column, const float *restrict right_3_column) {
+#define MASKED_SNIPPET_OPERATOR(row) left_0 * right_0_column[row] + left_1 * right_1_column[row] + left_2 * right_2_column[row] + left_3 * right_3_column[row]
+#include "sl_masked_snippet_inc.h"
+#undef MASKED_SNIPPET_OPERATOR
+}
+
+void sl_exec_split_chains(struct sl_execution *exec, const uint8_t *cond_col, uint32_t input_chain, uint32_t *ptrue_chain, uint32_t *pfalse_chain) {
+  sl_exec_row_t row;
+  if (input_chain == SL_EXEC_NO_CHAIN) {
+    *ptrue_chain = *pfalse_chain = SL_EXEC_NO_CHAIN;
+    return;
+  }
+  row = (sl_exec_row_t)input_chain;
+  sl_exec_row_t * restrict chain_col = exec->exec_chain_reg_;
   uint32_t true_chain = SL_EXEC_NO_CHAIN, false_chain = SL_EXEC_NO_CHAIN;
-  uint8_t true_tail;
-  uint8_t false_tail;
-  uint8_t delta;
+  sl_exec_row_t true_tail;
+  sl_exec_row_t false_tail;
+  sl_exec_row_t delta;
   do {
     delta = chain_col[row];
 
@@ -867,12 +1492,38 @@ static void sl_exec_split_chains_by_bool(struct sl_execution *exec, struct sl_ex
   *pfalse_chain = false_chain;
 }
 
-static void sl_exec_move_param(struct sl_execution *exec, uint8_t row, struct sl_execution_frame *dst_ef, struct sl_reg_alloc *dst, struct sl_execution_frame *src_ef, struct sl_reg_alloc *src) {
+void sl_exec_split_chains_uniform(struct sl_execution *exec, const uint8_t *cond_col, uint32_t input_chain, uint32_t *ptrue_chain, uint32_t *pfalse_chain) {
+  if (input_chain == SL_EXEC_NO_CHAIN) {
+    *ptrue_chain = *pfalse_chain = SL_EXEC_NO_CHAIN;
+  }
+  else if (cond_col[input_chain]) {
+    *ptrue_chain = input_chain;
+    *pfalse_chain = SL_EXEC_NO_CHAIN;
+  }
+  else {
+    *ptrue_chain = SL_EXEC_NO_CHAIN;
+    *pfalse_chain = input_chain;
+  }
+}
+
+static void sl_exec_split_chains_by_bool(struct sl_execution *exec, struct sl_expr *cond, uint32_t input_chain, uint32_t *ptrue_chain, uint32_t *pfalse_chain) {
+  if (input_chain == SL_EXEC_NO_CHAIN) return;
+  /* Which way the rows go depends on the data, so no schedule can be replayed for this shader */
+  if (exec->trace_state_ == SLETS_RECORDING) exec->trace_state_ = SLETS_INVALID;
+  if (sl_expr_is_uniform(cond)) {
+    sl_exec_split_chains_uniform(exec, BOOL_REG_PTR(cond, 0), input_chain, ptrue_chain, pfalse_chain);
+  }
+  else {
+    sl_exec_split_chains(exec, BOOL_REG_PTR(cond, 0), input_chain, ptrue_chain, pfalse_chain);
+  }
+}
+
+static void sl_exec_move_param(struct sl_execution *exec, sl_exec_row_t row, struct sl_execution_frame *dst_ef, struct sl_reg_alloc *dst, struct sl_execution_frame *src_ef, struct sl_reg_alloc *src) {
   sl_reg_move_crossframe(exec, row, (int)(src_ef - exec->execution_frames_), src, NULL, (int)(dst_ef - exec->execution_frames_), dst, NULL, 1, 1, 1);
 }
 
 
-static void sl_exec_init_literal(struct sl_execution *exec, uint8_t row, struct sl_reg_alloc *dst, struct sl_expr_temp *src, int offset) {
+static void sl_exec_init_literal(struct sl_execution *exec, sl_exec_row_t row, struct sl_reg_alloc *dst, struct sl_expr_temp *src, int offset) {
   int num_components = 0;
   int n;
 
@@ -934,7 +1585,7 @@ static void sl_exec_init_literal(struct sl_execution *exec, uint8_t row, struct
       break;
     }
     case slrak_int:
-      sl_exec_i_init(row, exec->exec_chain_reg_, exec->int_regs_[INT_REG_INDEX_NRV(dst, 0) + offset], src->v_.i_);
+      sl_exec_i_init(row, exec->exec_chain_reg_, exec->int_regs_[INT_REG_INDEX_NRV(dst, 0) + offset], (sl_exec_int_t)src->v_.i_);
       break;
     case slrak_ivec2:
     case slrak_ivec3:
@@ -945,7 +1596,7 @@ static void sl_exec_init_literal(struct sl_execution *exec, uint8_t row, struct
         case slrak_ivec4: num_components = 4; break;
       }
       for (n = 0; n < num_components; ++n) {
-        sl_exec_i_init(row, exec->exec_chain_reg_, exec->int_regs_[INT_REG_INDEX_NRV(dst, n) + offset], src->v_.iv_[n]);
+        sl_exec_i_init(row, exec->exec_chain_reg_, exec->int_regs_[INT_REG_INDEX_NRV(dst, n) + offset], (sl_exec_int_t)src->v_.iv_[n]);
       }
       break;
     }
@@ -968,84 +1619,84 @@ static void sl_exec_init_literal(struct sl_execution *exec, uint8_t row, struct
   }
 }
 
-static void sl_exec_f_offset_load(uint8_t * restrict chain_column,
-                                  uint8_t row,
+static void sl_exec_f_offset_load(sl_exec_row_t * restrict chain_column,
+                                  sl_exec_row_t row,
                                   float * restrict dst,
                                   const float * restrict * restrict float_regs,
                                   int base_reg,
-                                  const int64_t * restrict indices) {
+                                  const sl_exec_int_t * restrict indices) {
   for (;;) {
     float * restrict dst_row = dst + row;
     const float * restrict src_row = float_regs[base_reg + indices[row]];
     
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
-static void sl_exec_i_offset_load(uint8_t * restrict chain_column,
-                                  uint8_t row,
-                                  int64_t * restrict dst,
-                                  const int64_t * restrict * restrict int_regs,
+static void sl_exec_i_offset_load(sl_exec_row_t * restrict chain_column,
+                                  sl_exec_row_t row,
+                                  sl_exec_int_t * restrict dst,
+                                  const sl_exec_int_t * restrict * restrict int_regs,
                                   int base_reg,
-                                  const int64_t * restrict indices) {
+                                  const sl_exec_int_t * restrict indices) {
   for (;;) {
-    int64_t * restrict dst_row = dst + row;
-    const int64_t * restrict src_row = int_regs[base_reg + indices[row]];
+    sl_exec_int_t * restrict dst_row = dst + row;
+    const sl_exec_int_t * restrict src_row = int_regs[base_reg + indices[row]];
     
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
-static void sl_exec_b_offset_load(uint8_t * restrict chain_column,
-                                  uint8_t row,
+static void sl_exec_b_offset_load(sl_exec_row_t * restrict chain_column,
+                                  sl_exec_row_t row,
                                   uint8_t * restrict dst,
                                   const uint8_t * restrict * restrict bool_regs,
                                   int base_reg,
-                                  const int64_t * restrict indices) {
+                                  const sl_exec_int_t * restrict indices) {
   for (;;) {
     uint8_t * restrict dst_row = dst + row;
     const uint8_t * restrict src_row = bool_regs[base_reg + indices[row]];
     
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
-static void sl_exec_p_offset_load(uint8_t * restrict chain_column,
-                                  uint8_t row,
+static void sl_exec_p_offset_load(sl_exec_row_t * restrict chain_column,
+                                  sl_exec_row_t row,
                                   void * restrict * restrict dst,
                                   void * const restrict * restrict * restrict voidp_regs,
                                   int base_reg,
-                                  const int64_t * restrict indices) {
+                                  const sl_exec_int_t * restrict indices) {
   for (;;) {
     void * restrict * restrict dst_row = dst + row;
     void * const restrict * restrict src_row = voidp_regs[base_reg + indices[row]];
     
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
-static void sl_exec_f_offset_load_strided(uint8_t * restrict chain_column,
-                                          uint8_t row,
+static void sl_exec_f_offset_load_strided(sl_exec_row_t * restrict chain_column,
+                                          sl_exec_row_t row,
                                           float * restrict dst,
                                           const float * restrict * restrict float_regs,
                                           int base_reg,
-                                          const int64_t * restrict indices,
+                                          const sl_exec_int_t * restrict indices,
                                           int index_stride,
                                           int array_offset) {
   for (;;) {
@@ -1054,38 +1705,38 @@ static void sl_exec_f_offset_load_strided(uint8_t * restrict chain_column,
     
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
-static void sl_exec_i_offset_load_strided(uint8_t * restrict chain_column,
-                                          uint8_t row,
-                                          int64_t * restrict dst,
-                                          const int64_t * restrict * restrict int_regs,
+static void sl_exec_i_offset_load_strided(sl_exec_row_t * restrict chain_column,
+                                          sl_exec_row_t row,
+                                          sl_exec_int_t * restrict dst,
+                                          const sl_exec_int_t * restrict * restrict int_regs,
                                           int base_reg,
-                                          const int64_t * restrict indices,
+                                          const sl_exec_int_t * restrict indices,
                                           int index_stride,
                                           int array_offset) {
   for (;;) {
-    int64_t * restrict dst_row = dst + row;
-    const int64_t * restrict src_row = int_regs[base_reg + index_stride * indices[row] + array_offset];
+    sl_exec_int_t * restrict dst_row = dst + row;
+    const sl_exec_int_t * restrict src_row = int_regs[base_reg + index_stride * indices[row] + array_offset];
     
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
-static void sl_exec_b_offset_load_strided(uint8_t * restrict chain_column,
-                                          uint8_t row,
+static void sl_exec_b_offset_load_strided(sl_exec_row_t * restrict chain_column,
+                                          sl_exec_row_t row,
                                           uint8_t * restrict dst,
                                           const uint8_t * restrict * restrict bool_regs,
                                           int base_reg,
-                                          const int64_t * restrict indices,
+                                          const sl_exec_int_t * restrict indices,
                                           int index_stride,
                                           int array_offset) {
   for (;;) {
@@ -1094,18 +1745,18 @@ static void sl_exec_b_offset_load_strided(uint8_t * restrict chain_column,
     
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
-static void sl_exec_p_offset_load_strided(uint8_t * restrict chain_column,
-                                          uint8_t row,
+static void sl_exec_p_offset_load_strided(sl_exec_row_t * restrict chain_column,
+                                          sl_exec_row_t row,
                                           void * restrict * restrict dst,
                                           void * const restrict * restrict * restrict voidp_regs,
                                           int base_reg,
-                                          const int64_t * restrict indices,
+                                          const sl_exec_int_t * restrict indices,
                                           int index_stride,
                                           int array_offset) {
   for (;;) {
@@ -1114,14 +1765,14 @@ static void sl_exec_p_offset_load_strided(uint8_t * restrict chain_column,
     
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 
-static void sl_exec_offset_load_strided(struct sl_execution *exec, uint8_t row, 
+static void sl_exec_offset_load_strided(struct sl_execution *exec, sl_exec_row_t row, 
                                         struct sl_reg_alloc *dst,
                                         const struct sl_reg_alloc *arr,
                                         const struct sl_reg_alloc *index,
@@ -1244,7 +1895,7 @@ static void sl_exec_offset_load_strided(struct sl_execution *exec, uint8_t row,
   }
 }
 
-static void sl_exec_offset_load(struct sl_execution *exec, uint8_t row, 
+static void sl_exec_offset_load(struct sl_execution *exec, sl_exec_row_t row, 
                                 struct sl_reg_alloc *dst,
                                 const struct sl_reg_alloc *arr,
                                 const struct sl_reg_alloc *index) {
@@ -1351,7 +2002,7 @@ static void sl_exec_offset_load(struct sl_execution *exec, uint8_t row,
   }
 }
 
-static void sl_exec_indirect_load(struct sl_execution *exec, uint8_t row, 
+static void sl_exec_indirect_load(struct sl_execution *exec, sl_exec_row_t row, 
                                   struct sl_reg_alloc *dst,
                                   const struct sl_reg_alloc *indir,
                                   int array_quantity) {
@@ -1453,18 +2104,18 @@ static void sl_exec_indirect_load(struct sl_execution *exec, uint8_t row,
   }
 }
 
-static void sl_exec_indirect_offset_load(struct sl_execution *exec, uint8_t row, 
+static void sl_exec_indirect_offset_load(struct sl_execution *exec, sl_exec_row_t row, 
                                          struct sl_reg_alloc *dst,
                                          const struct sl_reg_alloc *indir,
                                          const struct sl_reg_alloc *index) {
   // XXX: Implement
 }
 
-static void sl_exec_f_offset_store(uint8_t * restrict chain_column,
-                                   uint8_t row,
+static void sl_exec_f_offset_store(sl_exec_row_t * restrict chain_column,
+                                   sl_exec_row_t row,
                                    float * restrict * restrict float_regs,
                                    int base_reg,
-                                   const int64_t * restrict indices,
+                                   const sl_exec_int_t * restrict indices,
                                    const float * restrict src) {
   for (;;) {
     float * restrict dst_row = float_regs[base_reg + indices[row]];
@@ -1472,35 +2123,35 @@ static void sl_exec_f_offset_store(uint8_t * restrict chain_column,
     
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
-static void sl_exec_i_offset_store(uint8_t * restrict chain_column,
-                                   uint8_t row,
-                                   int64_t * restrict * restrict int_regs,
+static void sl_exec_i_offset_store(sl_exec_row_t * restrict chain_column,
+                                   sl_exec_row_t row,
+                                   sl_exec_int_t * restrict * restrict int_regs,
                                    int base_reg,
-                                   const int64_t * restrict indices,
-                                   const int64_t * restrict src) {
+                                   const sl_exec_int_t * restrict indices,
+                                   const sl_exec_int_t * restrict src) {
   for (;;) {
-    int64_t * restrict dst_row = int_regs[base_reg + indices[row]];
-    const int64_t * restrict src_row = src + row;
+    sl_exec_int_t * restrict dst_row = int_regs[base_reg + indices[row]];
+    const sl_exec_int_t * restrict src_row = src + row;
     
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
-static void sl_exec_b_offset_store(uint8_t * restrict chain_column,
-                                   uint8_t row,
+static void sl_exec_b_offset_store(sl_exec_row_t * restrict chain_column,
+                                   sl_exec_row_t row,
                                    uint8_t * restrict * restrict bool_regs,
                                    int base_reg,
-                                   const int64_t * restrict indices,
+                                   const sl_exec_int_t * restrict indices,
                                    const uint8_t * restrict src) {
   for (;;) {
     uint8_t * restrict dst_row = bool_regs[base_reg + indices[row]];
@@ -1508,17 +2159,17 @@ static void sl_exec_b_offset_store(uint8_t * restrict chain_column,
     
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
-static void sl_exec_p_offset_store(uint8_t * restrict chain_column,
-                                   uint8_t row,
+static void sl_exec_p_offset_store(sl_exec_row_t * restrict chain_column,
+                                   sl_exec_row_t row,
                                    void * restrict * restrict * restrict voidp_regs,
                                    int base_reg,
-                                   const int64_t * restrict indices,
+                                   const sl_exec_int_t * restrict indices,
                                    const void * const restrict * restrict src) {
   for (;;) {
     void * restrict * restrict dst_row = voidp_regs[base_reg + indices[row] ]; 
@@ -1526,18 +2177,18 @@ static void sl_exec_p_offset_store(uint8_t * restrict chain_column,
     
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 
-static void sl_exec_f_offset_store_strided(uint8_t * restrict chain_column,
-                                           uint8_t row,
+static void sl_exec_f_offset_store_strided(sl_exec_row_t * restrict chain_column,
+                                           sl_exec_row_t row,
                                            float * restrict * restrict float_regs,
                                            int base_reg,
-                                           const int64_t * restrict indices,
+                                           const sl_exec_int_t * restrict indices,
                                            int index_stride,
                                            int array_offset,
                                            const float * restrict src) {
@@ -1547,37 +2198,37 @@ static void sl_exec_f_offset_store_strided(uint8_t * restrict chain_column,
     
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
-static void sl_exec_i_offset_store_strided(uint8_t * restrict chain_column,
-                                           uint8_t row,
-                                           int64_t * restrict * restrict int_regs,
+static void sl_exec_i_offset_store_strided(sl_exec_row_t * restrict chain_column,
+                                           sl_exec_row_t row,
+                                           sl_exec_int_t * restrict * restrict int_regs,
                                            int base_reg,
-                                           const int64_t * restrict indices,
+                                           const sl_exec_int_t * restrict indices,
                                            int index_stride,
                                            int array_offset,
-                                           const int64_t * restrict src) {
+                                           const sl_exec_int_t * restrict src) {
   for (;;) {
-    int64_t * restrict dst_row = int_regs[base_reg + index_stride * indices[row] + array_offset];
-    const int64_t * restrict src_row = src + row;
+    sl_exec_int_t * restrict dst_row = int_regs[base_reg + index_stride * indices[row] + array_offset];
+    const sl_exec_int_t * restrict src_row = src + row;
     
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
-static void sl_exec_b_offset_store_strided(uint8_t * restrict chain_column,
-                                           uint8_t row,
+static void sl_exec_b_offset_store_strided(sl_exec_row_t * restrict chain_column,
+                                           sl_exec_row_t row,
                                            uint8_t * restrict * restrict bool_regs,
                                            int base_reg,
-                                           const int64_t * restrict indices,
+                                           const sl_exec_int_t * restrict indices,
                                            int index_stride,
                                            int array_offset,
                                            const uint8_t * restrict src) {
@@ -1587,17 +2238,17 @@ static void sl_exec_b_offset_store_strided(uint8_t * restrict chain_column,
     
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
-static void sl_exec_p_offset_store_strided(uint8_t * restrict chain_column,
-                                           uint8_t row,
+static void sl_exec_p_offset_store_strided(sl_exec_row_t * restrict chain_column,
+                                           sl_exec_row_t row,
                                            void * restrict * restrict * restrict voidp_regs,
                                            int base_reg,
-                                           const int64_t * restrict indices,
+                                           const sl_exec_int_t * restrict indices,
                                            int index_stride,
                                            int array_offset,
                                            const void * const restrict * restrict src) {
@@ -1607,13 +2258,13 @@ static void sl_exec_p_offset_store_strided(uint8_t * restrict chain_column,
     
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
-static void sl_exec_offset_store_strided(struct sl_execution *exec, uint8_t row, 
+static void sl_exec_offset_store_strided(struct sl_execution *exec, sl_exec_row_t row, 
                                          struct sl_reg_alloc *dst_arr,
                                          struct sl_reg_alloc *dst_index,
                                          int index_stride,
@@ -1733,7 +2384,7 @@ static void sl_exec_offset_store_strided(struct sl_execution *exec, uint8_t row,
 }
 
 
-static void sl_exec_offset_store(struct sl_execution *exec, uint8_t row, 
+static void sl_exec_offset_store(struct sl_execution *exec, sl_exec_row_t row, 
                                  struct sl_reg_alloc *dst_arr,
                                  struct sl_reg_alloc *dst_index,
                                  const struct sl_reg_alloc *src) {
@@ -1848,7 +2499,7 @@ static size_t sl_exec_str_dump(const char *s, char *output_str, size_t at) {
 
 size_t sl_exec_offset_dump_strided(struct sl_execution *exec, 
                                    char *output_str,
-                                   uint8_t single_row, 
+                                   sl_exec_row_t single_row, 
                                    const struct sl_reg_alloc *arr,
                                    const struct sl_reg_alloc *index,
                                    int index_stride,
@@ -1915,7 +2566,7 @@ size_t sl_exec_offset_dump_strided(struct sl_execution *exec,
       if (arr->kind_ != slrak_float) str_size = sl_exec_str_dump("(", output_str, str_size);
       for (n = 0; n < num_components; ++n) {
         int base_reg = FLOAT_REG_INDEX_NRV(arr, n);
-        int64_t *index_rows = have_index ? INT_REG_PTR_NRV(index, 0) : NULL;
+        sl_exec_int_t *index_rows = have_index ? INT_REG_PTR_NRV(index, 0) : NULL;
         int reg = base_reg + (index_rows ? ((int)index_rows[single_row]) * index_stride : 0) + array_offset;
         float component = exec->float_regs_[reg][single_row];
         if (n) {
@@ -1945,14 +2596,14 @@ size_t sl_exec_offset_dump_strided(struct sl_execution *exec,
       if (arr->kind_ != slrak_int) str_size = sl_exec_str_dump("(", output_str, str_size);
       for (n = 0; n < num_components; ++n) {
         int base_reg = INT_REG_INDEX_NRV(arr, n);
-        int64_t *index_rows = have_index ? INT_REG_PTR_NRV(index, 0) : NULL;
+        sl_exec_int_t *index_rows = have_index ? INT_REG_PTR_NRV(index, 0) : NULL;
         int reg = base_reg + (index_rows ? ((int)index_rows[single_row]) * index_stride : 0) + array_offset;
-        int64_t component = exec->int_regs_[reg][single_row];
+        sl_exec_int_t component = exec->int_regs_[reg][single_row];
         if (n) {
-          snprintf(digits, sizeof(digits), ", %" PRId64, component);
+          snprintf(digits, sizeof(digits), ", %" PRId64, (int64_t)component);
         }
         else {
-          snprintf(digits, sizeof(digits), "%" PRId64, component);
+          snprintf(digits, sizeof(digits), "%" PRId64, (int64_t)component);
         }
         str_size = sl_exec_str_dump(digits, output_str, str_size);
       }
@@ -1974,7 +2625,7 @@ size_t sl_exec_offset_dump_strided(struct sl_execution *exec,
       if (arr->kind_ != slrak_bool) str_size = sl_exec_str_dump("(", output_str, str_size);
       for (n = 0; n < num_components; ++n) {
         int base_reg = BOOL_REG_INDEX_NRV(arr, n);
-        int64_t *index_rows = have_index ? INT_REG_PTR_NRV(index, 0) : NULL;
+        sl_exec_int_t *index_rows = have_index ? INT_REG_PTR_NRV(index, 0) : NULL;
         int reg = base_reg + (index_rows ? ((int)index_rows[single_row]) * index_stride : 0) + array_offset;
         uint8_t component = exec->bool_regs_[reg][single_row];
         const char *value = NULL;
@@ -1994,13 +2645,13 @@ size_t sl_exec_offset_dump_strided(struct sl_execution *exec,
 }
 
 size_t sl_exec_dump(struct sl_execution *exec, char *output_str, 
-                    uint8_t single_row, const struct sl_reg_alloc *ra) {
+                    sl_exec_row_t single_row, const struct sl_reg_alloc *ra) {
   return sl_exec_offset_dump_strided(exec, output_str, single_row, ra, NULL, 1, 0);
 }
 
 void sl_exec_offset_dumpf_strided(struct sl_execution *exec, 
                                   FILE *fp,
-                                  uint8_t single_row, 
+                                  sl_exec_row_t single_row, 
                                   const struct sl_reg_alloc *arr,
                                   const struct sl_reg_alloc *index,
                                   int index_stride,
@@ -2014,11 +2665,11 @@ void sl_exec_offset_dumpf_strided(struct sl_execution *exec,
 }
 
 void sl_exec_dumpf(struct sl_execution *exec, FILE *fp,
-                    uint8_t single_row, const struct sl_reg_alloc *ra) {
+                    sl_exec_row_t single_row, const struct sl_reg_alloc *ra) {
   sl_exec_offset_dumpf_strided(exec, fp, single_row, ra, NULL, 1, 0);
 }
 
-static void sl_exec_decrement(struct sl_execution *exec, uint8_t row, struct sl_reg_alloc *dst, struct sl_reg_alloc *opd) {
+static void sl_exec_decrement(struct sl_execution *exec, sl_exec_row_t row, struct sl_reg_alloc *dst, struct sl_reg_alloc *opd) {
   sl_reg_alloc_kind_t kind = opd->kind_;
   switch (kind) {
     case slrak_float:
@@ -2064,7 +2715,7 @@ static void sl_exec_decrement(struct sl_execution *exec, uint8_t row, struct sl_
   }
 }
 
-static void sl_exec_increment(struct sl_execution *exec, uint8_t row, struct sl_reg_alloc *dst, struct sl_reg_alloc *opd) {
+static void sl_exec_increment(struct sl_execution *exec, sl_exec_row_t row, struct sl_reg_alloc *dst, struct sl_reg_alloc *opd) {
   sl_reg_alloc_kind_t kind = opd->kind_;
   switch (kind) {
     case slrak_float:
@@ -2110,7 +2761,7 @@ static void sl_exec_increment(struct sl_execution *exec, uint8_t row, struct sl_
   }
 }
 
-static void sl_exec_negate(struct sl_execution *exec, uint8_t row, struct sl_expr *dst, struct sl_expr *opd) {
+static void sl_exec_negate(struct sl_execution *exec, sl_exec_row_t row, struct sl_expr *dst, struct sl_expr *opd) {
   sl_reg_alloc_kind_t kind = EXPR_RVALUE(opd)->kind_;
   switch (kind) {
     case slrak_float:
@@ -2156,7 +2807,7 @@ static void sl_exec_negate(struct sl_execution *exec, uint8_t row, struct sl_exp
   }
 }
 
-static void sl_exec_logical_not(struct sl_execution *exec, uint8_t row, struct sl_expr *dst, struct sl_expr *opd) {
+static void sl_exec_logical_not(struct sl_execution *exec, sl_exec_row_t row, struct sl_expr *dst, struct sl_expr *opd) {
   size_t num_components = 0;
   switch (EXPR_RVALUE(opd)->kind_) {
     case slrak_bool:  num_components = 1; break;
@@ -2170,8 +2821,27 @@ static void sl_exec_logical_not(struct sl_execution *exec, uint8_t row, struct s
   }
 }
 
-static void sl_exec_mul(struct sl_execution *exec, uint8_t row, struct sl_expr *dst, struct sl_expr *left, struct sl_expr *right) {
-  int r, c;
+/* Runs the fused matrix product of left and right into dst, see sl_exec_f_matrix_product() */
+static void sl_exec_matrix_product(struct sl_execution *exec, sl_exec_row_t row, struct sl_expr *dst, struct sl_expr *left, struct sl_expr *right,
+                                   int num_rows, int inner, int num_cols) {
+  float *result_columns[16];
+  const float *left_columns[16];
+  const float *right_columns[16];
+  int n;
+  for (n = 0; n < num_rows * num_cols; ++n) {
+    result_columns[n] = FLOAT_REG_PTR_NRV(&dst->base_regs_, n);
+  }
+  for (n = 0; n < num_rows * inner; ++n) {
+    left_columns[n] = FLOAT_REG_PTR(left, n);
+  }
+  for (n = 0; n < inner * num_cols; ++n) {
+    right_columns[n] = FLOAT_REG_PTR(right, n);
+  }
+  sl_exec_f_matrix_product(row, exec->exec_chain_reg_, num_rows, inner, num_cols, result_columns, left_columns, NULL, right_columns, NULL);
+}
+
+static void sl_exec_mul(struct sl_execution *exec, sl_exec_row_t row, struct sl_expr *dst, struct sl_expr *left, struct sl_expr *right) {
+  int r;
   sl_reg_alloc_kind_t left_kind = EXPR_RVALUE(left)->kind_;
   sl_reg_alloc_kind_t right_kind = EXPR_RVALUE(right)->kind_;
   if (left_kind == right_kind) {
@@ -2273,46 +2943,13 @@ static void sl_exec_mul(struct sl_execution *exec, uint8_t row, struct sl_expr *
                       INT_REG_PTR(right, 3));
         break;
       case slrak_mat2:
-        for (c = 0; c < 2; ++c) {
-          for (r = 0; r < 2; ++r) {
-            sl_exec_f_dot_product2(row, exec->exec_chain_reg_,
-                                   FLOAT_REG_PTR_NRV(&dst->base_regs_, c*2+r),
-                                   FLOAT_REG_PTR(left, r+0),
-                                   FLOAT_REG_PTR(left, r+2),
-                                   FLOAT_REG_PTR(right, c*2 + 0),                                
-                                   FLOAT_REG_PTR(right, c*2 + 1));
-          }
-        }
+        sl_exec_matrix_product(exec, row, dst, left, right, 2, 2, 2);
         break;
       case slrak_mat3:
-        for (c = 0; c < 3; ++c) {
-          for (r = 0; r < 3; ++r) {
-            sl_exec_f_dot_product3(row, exec->exec_chain_reg_,
-                                   FLOAT_REG_PTR_NRV(&dst->base_regs_, c*3+r),
-                                   FLOAT_REG_PTR(left, r+0),
-                                   FLOAT_REG_PTR(left, r+3),
-                                   FLOAT_REG_PTR(left, r+6),
-                                   FLOAT_REG_PTR(right, c*3 + 0),                                
-                                   FLOAT_REG_PTR(right, c*3 + 1),
-                                   FLOAT_REG_PTR(right, c*3 + 2));
-          }
-        }
+        sl_exec_matrix_product(exec, row, dst, left, right, 3, 3, 3);
         break;
       case slrak_mat4:
-        for (c = 0; c < 4; ++c) {
-          for (r = 0; r < 4; ++r) {
-            sl_exec_f_dot_product4(row, exec->exec_chain_reg_,
-                                   FLOAT_REG_PTR_NRV(&dst->base_regs_, c*4+r),
-                                   FLOAT_REG_PTR(left, r+0),
-                                   FLOAT_REG_PTR(left, r+4),
-                                   FLOAT_REG_PTR(left, r+8),
-                                   FLOAT_REG_PTR(left, r+12),
-                                   FLOAT_REG_PTR(right, c*4 + 0),                                
-                                   FLOAT_REG_PTR(right, c*4 + 1),
-                                   FLOAT_REG_PTR(right, c*4 + 2),
-                                   FLOAT_REG_PTR(right, c*4 + 3));
-          }
-        }
+        sl_exec_matrix_product(exec, row, dst, left, right, 4, 4, 4);
         break;
     }
   }
@@ -2379,80 +3016,26 @@ static void sl_exec_mul(struct sl_execution *exec, uint8_t row, struct sl_expr *
     }
   }
   else if ((left_kind == slrak_vec2) && (right_kind == slrak_mat2)) {
-    for (r = 0; r < 2; ++r) {
-      sl_exec_f_dot_product2(row, exec->exec_chain_reg_,
-                             FLOAT_REG_PTR_NRV(&dst->base_regs_, r),
-                             FLOAT_REG_PTR(left, 0),
-                             FLOAT_REG_PTR(left, 1),
-                             FLOAT_REG_PTR(right, 0 + r * 2),
-                             FLOAT_REG_PTR(right, 1 + r * 2));
-    }
+    sl_exec_matrix_product(exec, row, dst, left, right, 1, 2, 2);
   }
   else if ((left_kind == slrak_mat2) && (right_kind == slrak_vec2)) {
-    for (r = 0; r < 2; ++r) {
-      sl_exec_f_dot_product2(row, exec->exec_chain_reg_,
-                             FLOAT_REG_PTR_NRV(&dst->base_regs_, r),
-                             FLOAT_REG_PTR(left, 0 + r),
-                             FLOAT_REG_PTR(left, 2 + r),
-                             FLOAT_REG_PTR(right, 0),
-                             FLOAT_REG_PTR(right, 1));
-    }
+    sl_exec_matrix_product(exec, row, dst, left, right, 2, 2, 1);
   }
   else if ((left_kind == slrak_vec3) && (right_kind == slrak_mat3)) {
-    for (r = 0; r < 3; ++r) {
-      sl_exec_f_dot_product3(row, exec->exec_chain_reg_,
-                             FLOAT_REG_PTR_NRV(&dst->base_regs_, r),
-                             FLOAT_REG_PTR(left, 0),
-                             FLOAT_REG_PTR(left, 1),
-                             FLOAT_REG_PTR(left, 2),
-                             FLOAT_REG_PTR(right, 0 + r * 3),
-                             FLOAT_REG_PTR(right, 1 + r * 3),
-                             FLOAT_REG_PTR(right, 2 + r * 3));
-    }
+    sl_exec_matrix_product(exec, row, dst, left, right, 1, 3, 3);
   }
   else if ((left_kind == slrak_mat3) && (right_kind == slrak_vec3)) {
-    for (r = 0; r < 3; ++r) {
-      sl_exec_f_dot_product3(row, exec->exec_chain_reg_,
-                             FLOAT_REG_PTR_NRV(&dst->base_regs_, r),
-                             FLOAT_REG_PTR(left, 0 + r),
-                             FLOAT_REG_PTR(left, 3 + r),
-                             FLOAT_REG_PTR(left, 6 + r),
-                             FLOAT_REG_PTR(right, 0),
-                             FLOAT_REG_PTR(right, 1),
-                             FLOAT_REG_PTR(right, 2));
-    }
+    sl_exec_matrix_product(exec, row, dst, left, right, 3, 3, 1);
   }
   else if ((left_kind == slrak_vec4) && (right_kind == slrak_mat4)) {
-    for (r = 0; r < 4; ++r) {
-      sl_exec_f_dot_product4(row, exec->exec_chain_reg_,
-                             FLOAT_REG_PTR_NRV(&dst->base_regs_, r),
-                             FLOAT_REG_PTR(left, 0),
-                             FLOAT_REG_PTR(left, 1),
-                             FLOAT_REG_PTR(left, 2),
-                             FLOAT_REG_PTR(left, 3),
-                             FLOAT_REG_PTR(right, 0 + r * 4),
-                             FLOAT_REG_PTR(right, 1 + r * 4),
-                             FLOAT_REG_PTR(right, 2 + r * 4),
-                             FLOAT_REG_PTR(right, 3 + r * 4));
-    }
+    sl_exec_matrix_product(exec, row, dst, left, right, 1, 4, 4);
   }
   else if ((left_kind == slrak_mat4) && (right_kind == slrak_vec4)) {
-    for (r = 0; r < 4; ++r) {
-      sl_exec_f_dot_product4(row, exec->exec_chain_reg_,
-                             FLOAT_REG_PTR_NRV(&dst->base_regs_, r),
-                             FLOAT_REG_PTR(left, 0 + r),
-                             FLOAT_REG_PTR(left, 4 + r),
-                             FLOAT_REG_PTR(left, 8 + r),
-                             FLOAT_REG_PTR(left, 12 + r),
-                             FLOAT_REG_PTR(right, 0),
-                             FLOAT_REG_PTR(right, 1),
-                             FLOAT_REG_PTR(right, 2),
-                             FLOAT_REG_PTR(right, 3));
-    }
+    sl_exec_matrix_product(exec, row, dst, left, right, 4, 4, 1);
   }
 }
 
-static void sl_exec_div(struct sl_execution *exec, uint8_t row, struct sl_expr *dst, struct sl_expr *left, struct sl_expr *right) {
+static void sl_exec_div(struct sl_execution *exec, sl_exec_row_t row, struct sl_expr *dst, struct sl_expr *left, struct sl_expr *right) {
   int r;
 
   sl_reg_alloc_kind_t left_kind = EXPR_RVALUE(left)->kind_;
@@ -2473,9 +3056,9 @@ static void sl_exec_div(struct sl_execution *exec, uint8_t row, struct sl_expr *
           case slrak_vec2: num_components = 2; break;
           case slrak_vec3: num_components = 3; break;
           case slrak_vec4: num_components = 4; break;
-          case slrak_mat2: num_components = 2; break;
-          case slrak_mat3: num_components = 3; break;
-          case slrak_mat4: num_components = 4; break;
+          case slrak_mat2: num_components = 4; break;
+          case slrak_mat3: num_components = 9; break;
+          case slrak_mat4: num_components = 16; break;
         }
         for (r = 0; r < num_components; ++r) {
           sl_exec_f_div(row, exec->exec_chain_reg_, 
@@ -2512,9 +3095,9 @@ static void sl_exec_div(struct sl_execution *exec, uint8_t row, struct sl_expr *
       case slrak_vec2: num_components = 2; break;
       case slrak_vec3: num_components = 3; break;
       case slrak_vec4: num_components = 4; break;
-      case slrak_mat2: num_components = 2; break;
-      case slrak_mat3: num_components = 3; break;
-      case slrak_mat4: num_components = 4; break;
+      case slrak_mat2: num_components = 4; break;
+      case slrak_mat3: num_components = 9; break;
+      case slrak_mat4: num_components = 16; break;
     }
     for (r = 0; r < num_components; ++r) {
       sl_exec_f_div(row, exec->exec_chain_reg_, 
@@ -2529,9 +3112,9 @@ static void sl_exec_div(struct sl_execution *exec, uint8_t row, struct sl_expr *
       case slrak_vec2: num_components = 2; break;
       case slrak_vec3: num_components = 3; break;
       case slrak_vec4: num_components = 4; break;
-      case slrak_mat2: num_components = 2; break;
-      case slrak_mat3: num_components = 3; break;
-      case slrak_mat4: num_components = 4; break;
+      case slrak_mat2: num_components = 4; break;
+      case slrak_mat3: num_components = 9; break;
+      case slrak_mat4: num_components = 16; break;
     }
     for (r = 0; r < num_components; ++r) {
       sl_exec_f_div(row, exec->exec_chain_reg_, 
@@ -2570,7 +3153,7 @@ static void sl_exec_div(struct sl_execution *exec, uint8_t row, struct sl_expr *
   }
 }
 
-static void sl_exec_add(struct sl_execution *exec, uint8_t row, struct sl_expr *dst, struct sl_expr *left, struct sl_expr *right) {
+static void sl_exec_add(struct sl_execution *exec, sl_exec_row_t row, struct sl_expr *dst, struct sl_expr *left, struct sl_expr *right) {
   int r;
 
   sl_reg_alloc_kind_t left_kind = EXPR_RVALUE(left)->kind_;
@@ -2590,9 +3173,9 @@ static void sl_exec_add(struct sl_execution *exec, uint8_t row, struct sl_expr *
           case slrak_vec2: num_components = 2; break;
           case slrak_vec3: num_components = 3; break;
           case slrak_vec4: num_components = 4; break;
-          case slrak_mat2: num_components = 2; break;
-          case slrak_mat3: num_components = 3; break;
-          case slrak_mat4: num_components = 4; break;
+          case slrak_mat2: num_components = 4; break;
+          case slrak_mat3: num_components = 9; break;
+          case slrak_mat4: num_components = 16; break;
         }
         for (r = 0; r < num_components; ++r) {
           sl_exec_f_add(row, exec->exec_chain_reg_, 
@@ -2629,9 +3212,9 @@ static void sl_exec_add(struct sl_execution *exec, uint8_t row, struct sl_expr *
       case slrak_vec2: num_components = 2; break;
       case slrak_vec3: num_components = 3; break;
       case slrak_vec4: num_components = 4; break;
-      case slrak_mat2: num_components = 2; break;
-      case slrak_mat3: num_components = 3; break;
-      case slrak_mat4: num_components = 4; break;
+      case slrak_mat2: num_components = 4; break;
+      case slrak_mat3: num_components = 9; break;
+      case slrak_mat4: num_components = 16; break;
     }
     for (r = 0; r < num_components; ++r) {
       sl_exec_f_add(row, exec->exec_chain_reg_, 
@@ -2646,9 +3229,9 @@ static void sl_exec_add(struct sl_execution *exec, uint8_t row, struct sl_expr *
       case slrak_vec2: num_components = 2; break;
       case slrak_vec3: num_components = 3; break;
       case slrak_vec4: num_components = 4; break;
-      case slrak_mat2: num_components = 2; break;
-      case slrak_mat3: num_components = 3; break;
-      case slrak_mat4: num_components = 4; break;
+      case slrak_mat2: num_components = 4; break;
+      case slrak_mat3: num_components = 9; break;
+      case slrak_mat4: num_components = 16; break;
     }
     for (r = 0; r < num_components; ++r) {
       sl_exec_f_add(row, exec->exec_chain_reg_, 
@@ -2687,7 +3270,7 @@ static void sl_exec_add(struct sl_execution *exec, uint8_t row, struct sl_expr *
   }
 }
 
-static void sl_exec_sub(struct sl_execution *exec, uint8_t row, struct sl_expr *dst, struct sl_expr *left, struct sl_expr *right) {
+static void sl_exec_sub(struct sl_execution *exec, sl_exec_row_t row, struct sl_expr *dst, struct sl_expr *left, struct sl_expr *right) {
   int r;
 
   sl_reg_alloc_kind_t left_kind = EXPR_RVALUE(left)->kind_;
@@ -2707,9 +3290,9 @@ static void sl_exec_sub(struct sl_execution *exec, uint8_t row, struct sl_expr *
           case slrak_vec2: num_components = 2; break;
           case slrak_vec3: num_components = 3; break;
           case slrak_vec4: num_components = 4; break;
-          case slrak_mat2: num_components = 2; break;
-          case slrak_mat3: num_components = 3; break;
-          case slrak_mat4: num_components = 4; break;
+          case slrak_mat2: num_components = 4; break;
+          case slrak_mat3: num_components = 9; break;
+          case slrak_mat4: num_components = 16; break;
         }
         for (r = 0; r < num_components; ++r) {
           sl_exec_f_sub(row, exec->exec_chain_reg_, 
@@ -2746,9 +3329,9 @@ static void sl_exec_sub(struct sl_execution *exec, uint8_t row, struct sl_expr *
       case slrak_vec2: num_components = 2; break;
       case slrak_vec3: num_components = 3; break;
       case slrak_vec4: num_components = 4; break;
-      case slrak_mat2: num_components = 2; break;
-      case slrak_mat3: num_components = 3; break;
-      case slrak_mat4: num_components = 4; break;
+      case slrak_mat2: num_components = 4; break;
+      case slrak_mat3: num_components = 9; break;
+      case slrak_mat4: num_components = 16; break;
     }
     for (r = 0; r < num_components; ++r) {
       sl_exec_f_sub(row, exec->exec_chain_reg_, 
@@ -2763,9 +3346,9 @@ static void sl_exec_sub(struct sl_execution *exec, uint8_t row, struct sl_expr *
       case slrak_vec2: num_components = 2; break;
       case slrak_vec3: num_components = 3; break;
       case slrak_vec4: num_components = 4; break;
-      case slrak_mat2: num_components = 2; break;
-      case slrak_mat3: num_components = 3; break;
-      case slrak_mat4: num_components = 4; break;
+      case slrak_mat2: num_components = 4; break;
+      case slrak_mat3: num_components = 9; break;
+      case slrak_mat4: num_components = 16; break;
     }
     for (r = 0; r < num_components; ++r) {
       sl_exec_f_sub(row, exec->exec_chain_reg_, 
@@ -2815,8 +3398,8 @@ static void sl_exec_sub(struct sl_execution *exec, uint8_t row, struct sl_expr *
  *       dst_ra might be local ; if so, we need to offset before we access...
  */
 
-static void sl_exec_load_effective_reg_index(struct sl_execution *exec, uint8_t row, struct sl_reg_alloc *dst_ra, const struct sl_reg_alloc *src_ra, const struct sl_reg_alloc *src_index_ra) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+static void sl_exec_load_effective_reg_index(struct sl_execution *exec, sl_exec_row_t row, struct sl_reg_alloc *dst_ra, const struct sl_reg_alloc *src_ra, const struct sl_reg_alloc *src_index_ra) {
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
 
   int column_size = 0; /* column size of 0 means "no column" (but instead selecting a scalar from a vec) */
   switch (src_ra->kind_) {
@@ -2833,7 +3416,7 @@ static void sl_exec_load_effective_reg_index(struct sl_execution *exec, uint8_t
 
   if (!src_ra->is_indirect_) {
     if (src_ra->local_frame_) {
-      int64_t global_offset = 0;
+      sl_exec_int_t global_offset = 0;
       switch (dst_ra->kind_) {
         case slrak_float:
         case slrak_vec2:
@@ -2864,9 +3447,9 @@ static void sl_exec_load_effective_reg_index(struct sl_execution *exec, uint8_t
           break;
       }
       if (!column_size) {
-        int64_t *restrict result_column = INT_REG_PTR_NRV(dst_ra, 0);
-        const int64_t *restrict opd_column = INT_REG_PTR_NRV(src_index_ra, 0);
-#define UNOP_SNIPPET_TYPE int64_t
+        sl_exec_int_t *restrict result_column = INT_REG_PTR_NRV(dst_ra, 0);
+        const sl_exec_int_t *restrict opd_column = INT_REG_PTR_NRV(src_index_ra, 0);
+#define UNOP_SNIPPET_TYPE sl_exec_int_t
 #define UNOP_SNIPPET_OPERATOR(opd) global_offset + src_ra->v_.regs_[ (opd) ];
 #include "sl_unop_snippet_inc.h"
 #undef UNOP_SNIPPET_OPERATOR
@@ -2876,11 +3459,11 @@ static void sl_exec_load_effective_reg_index(struct sl_execution *exec, uint8_t
         /* Matrix */
         int k;
         for (k = 0; k < column_size; ++k) {
-          int64_t *restrict result_column = INT_REG_PTR_NRV(dst_ra, k);
-          const int64_t *restrict opd_column = INT_REG_PTR_NRV(src_index_ra, 0);
+          sl_exec_int_t *restrict result_column = INT_REG_PTR_NRV(dst_ra, k);
+          const sl_exec_int_t *restrict opd_column = INT_REG_PTR_NRV(src_index_ra, 0);
 
-#define UNOP_SNIPPET_TYPE int64_t
-#define UNOP_SNIPPET_OPERATOR(opd) global_offset + src_ra->v_.regs_[ (opd) * (int64_t)column_size + k ];
+#define UNOP_SNIPPET_TYPE sl_exec_int_t
+#define UNOP_SNIPPET_OPERATOR(opd) global_offset + src_ra->v_.regs_[ (opd) * (sl_exec_int_t)column_size + k ];
 #include "sl_unop_snippet_inc.h"
 #undef UNOP_SNIPPET_OPERATOR
 #undef UNOP_SNIPPET_TYPE
@@ -2889,9 +3472,9 @@ static void sl_exec_load_effective_reg_index(struct sl_execution *exec, uint8_t
     }
     else {
       if (!column_size) {
-        int64_t *restrict result_column = INT_REG_PTR_NRV(dst_ra, 0);
-        const int64_t *restrict opd_column = INT_REG_PTR_NRV(src_index_ra, 0);
-#define UNOP_SNIPPET_TYPE int64_t
+        sl_exec_int_t *restrict result_column = INT_REG_PTR_NRV(dst_ra, 0);
+        const sl_exec_int_t *restrict opd_column = INT_REG_PTR_NRV(src_index_ra, 0);
+#define UNOP_SNIPPET_TYPE sl_exec_int_t
 #define UNOP_SNIPPET_OPERATOR(opd) src_ra->v_.regs_[ (opd) ];
 #include "sl_unop_snippet_inc.h"
 #undef UNOP_SNIPPET_OPERATOR
@@ -2901,11 +3484,11 @@ static void sl_exec_load_effective_reg_index(struct sl_execution *exec, uint8_t
         /* Matrix */
         int k;
         for (k = 0; k < column_size; ++k) {
-          int64_t *restrict result_column = INT_REG_PTR_NRV(dst_ra, k);
-          const int64_t *restrict opd_column = INT_REG_PTR_NRV(src_index_ra, 0);
+          sl_exec_int_t *restrict result_column = INT_REG_PTR_NRV(dst_ra, k);
+          const sl_exec_int_t *restrict opd_column = INT_REG_PTR_NRV(src_index_ra, 0);
 
-#define UNOP_SNIPPET_TYPE int64_t
-#define UNOP_SNIPPET_OPERATOR(opd) src_ra->v_.regs_[ (opd) * (int64_t)column_size + k ];
+#define UNOP_SNIPPET_TYPE sl_exec_int_t
+#define UNOP_SNIPPET_OPERATOR(opd) src_ra->v_.regs_[ (opd) * (sl_exec_int_t)column_size + k ];
 #include "sl_unop_snippet_inc.h"
 #undef UNOP_SNIPPET_OPERATOR
 #undef UNOP_SNIPPET_TYPE
@@ -2916,9 +3499,9 @@ static void sl_exec_load_effective_reg_index(struct sl_execution *exec, uint8_t
   else {
     /* Vec or matrix we're indexing from is already indirect */
 
-    int64_t * restrict component_indirect_columns[16];
+    sl_exec_int_t * restrict component_indirect_columns[16];
     size_t n;
-    int64_t global_offset = 0;
+    sl_exec_int_t global_offset = 0;
     if (src_ra->local_frame_) {
       global_offset = exec->execution_frames_[exec->num_execution_frames_ - 1].local_int_offset_;
     }
@@ -2926,40 +3509,39 @@ static void sl_exec_load_effective_reg_index(struct sl_execution *exec, uint8_t
       component_indirect_columns[n] = exec->int_regs_[ global_offset + src_ra->v_.regs_[n] ];
     }
     if (!column_size) {
-      int64_t *restrict result_column = INT_REG_PTR_NRV(dst_ra, 0);
-      const int64_t *restrict opd_column = INT_REG_PTR_NRV(src_index_ra, 0);
+      sl_exec_int_t *restrict result_column = INT_REG_PTR_NRV(dst_ra, 0);
+      const sl_exec_int_t *restrict opd_column = INT_REG_PTR_NRV(src_index_ra, 0);
 
       for (;;) {
-        uint64_t chain;
-        uint8_t delta;
-        if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+        sl_exec_row_t delta;
+        if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
           do {
-            int64_t *restrict result = result_column + row;
-            const int64_t *restrict opd = opd_column + row;
+            sl_exec_int_t *restrict result = result_column + row;
+            const sl_exec_int_t *restrict opd = opd_column + row;
             int n;
             /* Try to elicit 8-wise SIMD instructions from auto-vectorization, e.g. AVX's VMULPS ymm0, ymm1, ymm2 */
             for (n = 0; n < 8; n++) {
               result[n] = (component_indirect_columns[(opd[n])])[n + row];
             }
 
-            delta = (chain & 0xFF00000000000000) >> 56;
+            delta = chain_column[row + 7];
             if (!delta) break;
             row += 7 + delta;
-          } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+          } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
         }
-        else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+        else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
           do {
-            int64_t *restrict result = result_column + row;
-            const int64_t *restrict opd = opd_column + row;
+            sl_exec_int_t *restrict result = result_column + row;
+            const sl_exec_int_t *restrict opd = opd_column + row;
             int n;
             /* Try to elicit forth 4-wise SIMD instructions from auto-vectorization, e.g. SSE's MULPS xmm0, xmm1 */
             for (n = 0; n < 4; n++) {
               result[n] = (component_indirect_columns[(opd[n])])[n + row];
             }
-            delta = (chain & 0xFF000000) >> 24;
+            delta = chain_column[row + 3];
             if (!delta) break;
             row += 3 + delta;
-          } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+          } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
         }
         else {
           do {
@@ -2977,40 +3559,39 @@ static void sl_exec_load_effective_reg_index(struct sl_execution *exec, uint8_t
       /* Matrix */
       int k;
       for (k = 0; k < column_size; ++k) {
-        int64_t *restrict result_column = INT_REG_PTR_NRV(dst_ra, k);
-        const int64_t *restrict opd_column = INT_REG_PTR_NRV(src_index_ra, 0);
+        sl_exec_int_t *restrict result_column = INT_REG_PTR_NRV(dst_ra, k);
+        const sl_exec_int_t *restrict opd_column = INT_REG_PTR_NRV(src_index_ra, 0);
 
         for (;;) {
-          uint64_t chain;
-          uint8_t delta;
-          if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+          sl_exec_row_t delta;
+          if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
             do {
-              int64_t *restrict result = result_column + row;
-              const int64_t *restrict opd = opd_column + row;
+              sl_exec_int_t *restrict result = result_column + row;
+              const sl_exec_int_t *restrict opd = opd_column + row;
               int n;
               /* Try to elicit 8-wise SIMD instructions from auto-vectorization, e.g. AVX's VMULPS ymm0, ymm1, ymm2 */
               for (n = 0; n < 8; n++) {
                 result[n] = (component_indirect_columns[column_size * (opd[n]) + k])[n + row];
               }
 
-              delta = (chain & 0xFF00000000000000) >> 56;
+              delta = chain_column[row + 7];
               if (!delta) break;
               row += 7 + delta;
-            } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+            } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
           }
-          else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+          else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
             do {
-              int64_t *restrict result = result_column + row;
-              const int64_t *restrict opd = opd_column + row;
+              sl_exec_int_t *restrict result = result_column + row;
+              const sl_exec_int_t *restrict opd = opd_column + row;
               int n;
               /* Try to elicit forth 4-wise SIMD instructions from auto-vectorization, e.g. SSE's MULPS xmm0, xmm1 */
               for (n = 0; n < 4; n++) {
                 result[n] = (component_indirect_columns[column_size * (opd[n]) + k])[n + row];
               }
-              delta = (chain & 0xFF000000) >> 24;
+              delta = chain_column[row + 3];
               if (!delta) break;
               row += 3 + delta;
-            } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+            } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
           }
           else {
             do {
@@ -3074,6 +3655,8 @@ void sl_exec_init(struct sl_execution *exec) {
   exec->max_num_rows_ = 0;
   exec->dump_text_ = NULL;
   exec->dump_text_len_ = 0;
+  exec->slab_ = NULL;
+  exec->slab_size_ = 0;
   exec->num_execution_points_ = exec->num_execution_points_allocated_ = 0;
   exec->execution_points_ = NULL;
   exec->num_execution_frames_ = exec->num_execution_frames_allocated_ = 0;
@@ -3089,57 +3672,340 @@ void sl_exec_init(struct sl_execution *exec) {
   exec->sampler_2D_regs_ = NULL;
   exec->num_sampler_cube_regs_ = 0;
   exec->sampler_cube_regs_ = NULL;
-}
-
-void sl_exec_cleanup(struct sl_execution *exec) {
-  if (exec->dump_text_) free(exec->dump_text_);
-  if (exec->execution_points_) free(exec->execution_points_);
-  if (exec->execution_frames_) free(exec->execution_frames_);
-  if (exec->exec_chain_reg_) free(exec->exec_chain_reg_);
-  if (exec->float_regs_) free(exec->float_regs_);
-  if (exec->int_regs_) free(exec->int_regs_);
-  if (exec->bool_regs_) free(exec->bool_regs_);
-  if (exec->sampler_2D_regs_) free(exec->sampler_2D_regs_);
-  if (exec->sampler_cube_regs_) free(exec->sampler_cube_regs_);
-}
+  exec->float_uniform_flags_ = NULL;
+  exec->float_uniforms_ = NULL;
+  exec->uniforms_owner_ = NULL;
+  exec->bytecode_ = NULL;
+  exec->jit_ = NULL;
+  exec->aot_ = NULL;
+  exec->num_specialized_ = 0;
+  exec->specialized_ = NULL;
+  exec->num_variants_ = 0;
+  exec->variants_ = NULL;
+  exec->variant_ = NULL;
+  exec->variant_clock_ = 0;
+  memset(&exec->variant_stats_, 0, sizeof(exec->variant_stats_));
+  exec->trace_state_ = SLETS_NONE;
+  exec->trace_f_ = NULL;
+  exec->trace_chain_ = SL_EXEC_NO_CHAIN;
+  exec->num_trace_steps_ = exec->num_trace_steps_allocated_ = 0;
+  exec->trace_steps_ = NULL;
+  exec->compact_scratch_ = NULL;
+  exec->compact_scratch_size_ = 0;
+  memset(&exec->compaction_stats_, 0, sizeof(exec->compaction_stats_));
+  exec->num_bc_chains_allocated_ = 0;
+  exec->bc_chains_ = NULL;
+  exec->bc_masks_ = NULL;
+  exec->bc_chain_flags_ = NULL;
+  exec->bc_profile_source_ = NULL;
+  exec->bc_profile_node_index_ = SIZE_MAX;
+  exec->bc_profile_start_ = 0;
+  exec->program_ = NULL;
+
+  /* AEX_SL_EXEC=ast or AEX_SL_EXEC=bytecode forces the AST or bytecode interpreter, e.g. to compare
+   * results against the JIT. */
+  const char *interpreter = getenv("AEX_SL_EXEC");
+  if (interpreter && !strcmp(interpreter, "ast")) {
+    exec->interpreter_ = SLEI_AST;
+  }
+  else if (interpreter && !strcmp(interpreter, "bytecode")) {
+    exec->interpreter_ = SLEI_BYTECODE;
+  }
+  else {
+    exec->interpreter_ = SLEI_JIT;
+  }
 
-int sl_exec_prep(struct sl_execution *exec, struct sl_compilation_unit *cu) {
-  void *new_float_regs = NULL;
-  void *new_int_regs = NULL;
-  void *new_bool_regs = NULL;
-  void *new_sampler2D_regs = NULL;
-  void *new_samplerCube_regs = NULL;
-  if (cu->register_counts_.num_float_regs_) {
-    new_float_regs = malloc(sizeof(float *) * cu->register_counts_.num_float_regs_);
-    if (!new_float_regs) goto fail;
-    memset(new_float_regs, 0, sizeof(float *) * cu->register_counts_.num_float_regs_);
+  const char *predication = getenv("AEX_SL_PREDICATION");
+  if (predication && !strcmp(predication, "chains")) {
+    exec->predication_ = SLEP_CHAINS;
   }
-  if (cu->register_counts_.num_int_regs_) {
-    new_int_regs = malloc(sizeof(int64_t *) * cu->register_counts_.num_int_regs_);
-    if (!new_int_regs) goto fail;
-    memset(new_int_regs, 0, sizeof(int64_t *) * cu->register_counts_.num_int_regs_);
+  else if (predication && !strcmp(predication, "masks")) {
+    exec->predication_ = SLEP_MASKS;
   }
-  if (cu->register_counts_.num_bool_regs_) {
-    new_bool_regs = malloc(sizeof(unsigned char *) * cu->register_counts_.num_bool_regs_);
-    if (!new_bool_regs) goto fail;
-    memset(new_bool_regs, 0, sizeof(int *) * cu->register_counts_.num_bool_regs_);
+  else {
+    exec->predication_ = SLEP_ADAPTIVE;
   }
-  if (cu->register_counts_.num_sampler2D_regs_) {
-    new_sampler2D_regs = malloc(sizeof(void *) * cu->register_counts_.num_sampler2D_regs_);
-    if (!new_sampler2D_regs) goto fail;
-    memset(new_sampler2D_regs, 0, sizeof(void *) * cu->register_counts_.num_sampler2D_regs_);
+
+  const char *accuracy = getenv("AEX_SL_ACCURACY");
+  if (accuracy && !strcmp(accuracy, "spec")) {
+    exec->accuracy_ = SLEA_SPEC;
   }
-  if (cu->register_counts_.num_samplerCube_regs_) {
-    new_samplerCube_regs = malloc(sizeof(void *) * cu->register_counts_.num_samplerCube_regs_);
-    if (!new_samplerCube_regs) goto fail;
-    memset(new_samplerCube_regs, 0, sizeof(void *) * cu->register_counts_.num_samplerCube_regs_);
+  else {
+    exec->accuracy_ = SLEA_STRICT;
   }
 
-  if (exec->float_regs_) free(exec->float_regs_);
-  if (exec->int_regs_) free(exec->int_regs_);
-  if (exec->bool_regs_) free(exec->bool_regs_);
+  const char *batch_cache_budget = getenv("AEX_SL_BATCH_CACHE_BUDGET");
+  if (batch_cache_budget && *batch_cache_budget) {
+    exec->batch_cache_budget_ = (size_t)strtoull(batch_cache_budget, NULL, 0);
+  }
+  else {
+    exec->batch_cache_budget_ = SL_EXEC_DEFAULT_BATCH_CACHE_BUDGET;
+  }
+
+  /* AEX_SL_OPT=none disables the SLIR optimizer, or selects passes, e.g. AEX_SL_OPT=constprop,dse */
+  exec->ir_opt_passes_ = sl_ir_opt_parse_passes(getenv("AEX_SL_OPT"));
+
+  const char *opt_dump = getenv("AEX_SL_OPT_DUMP");
+  exec->ir_opt_dump_ = opt_dump && *opt_dump;
+
+  const char *inline_threshold = getenv("AEX_SL_INLINE_THRESHOLD");
+  if (inline_threshold && *inline_threshold) {
+    exec->inline_threshold_ = (size_t)strtoull(inline_threshold, NULL, 0);
+  }
+  else {
+    exec->inline_threshold_ = SL_EXEC_DEFAULT_INLINE_THRESHOLD;
+  }
+
+  const char *unroll_max_size = getenv("AEX_SL_UNROLL_MAX_SIZE");
+  if (unroll_max_size && *unroll_max_size) {
+    exec->unroll_max_size_ = (size_t)strtoull(unroll_max_size, NULL, 0);
+  }
+  else {
+    exec->unroll_max_size_ = SL_EXEC_DEFAULT_UNROLL_MAX_SIZE;
+  }
+
+  const char *max_variants = getenv("AEX_SL_VARIANTS");
+  if (max_variants && *max_variants) {
+    exec->max_variants_ = (size_t)strtoull(max_variants, NULL, 0);
+  }
+  else {
+    exec->max_variants_ = SL_EXEC_DEFAULT_MAX_VARIANTS;
+  }
+
+  const char *compact_density = getenv("AEX_SL_COMPACT_DENSITY");
+  if (compact_density && *compact_density) {
+    exec->compact_density_ = (size_t)strtoull(compact_density, NULL, 0);
+  }
+  else {
+    exec->compact_density_ = SL_EXEC_DEFAULT_COMPACT_DENSITY;
+  }
+
+  /* AEX_SL_SPECIALIZE=none disables specialization, or names the uniforms, e.g. AEX_SL_SPECIALIZE=u_lighting,u_fog */
+  exec->specialize_ = getenv("AEX_SL_SPECIALIZE");
+
+  /* AEX_SL_TRACE=0 disables recording and replaying the schedule of the AST walk, e.g. to compare */
+  const char *trace = getenv("AEX_SL_TRACE");
+  exec->trace_enabled_ = !(trace && !strcmp(trace, "0"));
+  if (!exec->trace_enabled_) exec->trace_state_ = SLETS_INVALID;
+
+  /* AEX_SL_PROFILE=stderr or AEX_SL_PROFILE=<file> enables the hot-spot profile; not fatal if out of memory */
+  exec->profile_ = NULL;
+  exec->profile_path_ = getenv("AEX_SL_PROFILE");
+  if (exec->profile_path_ && *exec->profile_path_) {
+    exec->profile_ = (struct sl_profile *)malloc(sizeof(struct sl_profile));
+    if (exec->profile_) sl_profile_init(exec->profile_);
+  }
+}
+
+/* Writes the annotated listing of the profile, if anything ran */
+static void sl_exec_dump_profile(struct sl_execution *exec) {
+  FILE *fp;
+  if (!exec->profile_ || !exec->profile_->num_runs_) return;
+  if (!strcmp(exec->profile_path_, "stderr")) {
+    sl_profile_dump(exec->profile_, stderr);
+    return;
+  }
+  fp = fopen(exec->profile_path_, "a");
+  if (!fp) return;
+  sl_profile_dump(exec->profile_, fp);
+  fclose(fp);
+}
+
+int sl_exec_profile_source(struct sl_execution *exec, const char *name, const char *source, size_t source_length) {
+  if (!exec->profile_) return 0;
+  sl_exec_dump_profile(exec);
+  return sl_profile_set_source(exec->profile_, name, source, source_length);
+}
+
+static void sl_exec_variant_cleanup(struct sl_exec_variant *v) {
+  if (v->values_) free(v->values_);
+  if (v->jit_) {
+    sl_jit_cleanup(v->jit_);
+    free(v->jit_);
+  }
+  if (v->bytecode_) {
+    sl_bytecode_cleanup(v->bytecode_);
+    free(v->bytecode_);
+  }
+  v->values_ = NULL;
+  v->jit_ = NULL;
+  v->bytecode_ = NULL;
+}
+
+/* Discards all variants and the uniforms they are specialized on */
+static void sl_exec_clear_variants(struct sl_execution *exec) {
+  size_t n;
+  for (n = 0; n < exec->num_variants_; ++n) {
+    sl_exec_variant_cleanup(exec->variants_ + n);
+  }
+  if (exec->variants_) free(exec->variants_);
+  if (exec->specialized_) free(exec->specialized_);
+  exec->num_variants_ = 0;
+  exec->variants_ = NULL;
+  exec->variant_ = NULL;
+  exec->num_specialized_ = 0;
+  exec->specialized_ = NULL;
+  exec->variant_clock_ = 0;
+  exec->variant_stats_.num_variants_ = 0;
+}
+
+void sl_exec_cleanup(struct sl_execution *exec) {
+  if (exec->program_) {
+    /* An execution context, the compiled program belongs to the execution it runs, see sl_exec_init_context() */
+    exec->float_uniform_flags_ = NULL;
+    exec->jit_ = NULL;
+    exec->bytecode_ = NULL;
+    exec->variant_ = NULL;
+  }
+  if (exec->dump_text_) free(exec->dump_text_);
+  if (exec->slab_) free(exec->slab_);
+  if (exec->execution_points_) free(exec->execution_points_);
+  if (exec->execution_frames_) free(exec->execution_frames_);
+  if (exec->exec_chain_reg_) free(exec->exec_chain_reg_);
+  if (exec->float_regs_) free(exec->float_regs_);
+  if (exec->int_regs_) free(exec->int_regs_);
+  if (exec->bool_regs_) free(exec->bool_regs_);
   if (exec->sampler_2D_regs_) free(exec->sampler_2D_regs_);
   if (exec->sampler_cube_regs_) free(exec->sampler_cube_regs_);
+  if (exec->float_uniform_flags_) free(exec->float_uniform_flags_);
+  if (exec->float_uniforms_) free(exec->float_uniforms_);
+  sl_exec_clear_variants(exec);
+  if (exec->trace_steps_) free(exec->trace_steps_);
+  if (exec->compact_scratch_) free(exec->compact_scratch_);
+  if (exec->bc_chains_) free(exec->bc_chains_);
+  if (exec->bc_masks_) free(exec->bc_masks_);
+  if (exec->bc_chain_flags_) free(exec->bc_chain_flags_);
+  if (exec->profile_) {
+    sl_exec_dump_profile(exec);
+    sl_profile_cleanup(exec->profile_);
+    free(exec->profile_);
+  }
+  if (exec->jit_) {
+    sl_jit_cleanup(exec->jit_);
+    free(exec->jit_);
+  }
+  if (exec->bytecode_) {
+    sl_bytecode_cleanup(exec->bytecode_);
+    free(exec->bytecode_);
+  }
+}
+
+/* Returns non-zero if name is in the comma separated list */
+static int sl_exec_is_listed(const char *list, const char *name) {
+  size_t name_len = strlen(name);
+  while (*list) {
+    size_t len = strcspn(list, ",");
+    if ((len == name_len) && !memcmp(list, name, len)) return 1;
+    list += len;
+    if (*list == ',') list++;
+  }
+  return 0;
+}
+
+/* Picks the uniform registers to specialize on, see sl_execution::specialized_ */
+static void sl_exec_pick_specialized(struct sl_execution *exec) {
+  struct sl_ir_opt_constant regs[SL_EXEC_MAX_SPECIALIZED_REGS];
+  size_t num_regs = 0;
+  struct sl_variable *v;
+  if (!exec->max_variants_ || !exec->bytecode_ || (exec->interpreter_ == SLEI_AST) || !(exec->ir_opt_passes_ & SL_IR_OPT_CONST_PROP)) return;
+  if (exec->specialize_ && !strcmp(exec->specialize_, "none")) return;
+  v = exec->cu_->global_frame_.variables_;
+  if (!v) return;
+  do {
+    int bank, num_components, n;
+    size_t num_bank_regs;
+    v = v->chain_;
+    if (!(sl_type_qualifiers(v->type_) & SL_TYPE_QUALIFIER_UNIFORM) || v->reg_alloc_.local_frame_ || v->reg_alloc_.is_indirect_) continue;
+    switch (v->reg_alloc_.kind_) {
+      case slrak_bool:  bank = SL_IR_OPT_BOOL; num_components = 1; break;
+      case slrak_bvec2: bank = SL_IR_OPT_BOOL; num_components = 2; break;
+      case slrak_bvec3: bank = SL_IR_OPT_BOOL; num_components = 3; break;
+      case slrak_bvec4: bank = SL_IR_OPT_BOOL; num_components = 4; break;
+      case slrak_int:   bank = SL_IR_OPT_INT; num_components = 1; break;
+      case slrak_ivec2: bank = SL_IR_OPT_INT; num_components = 2; break;
+      case slrak_ivec3: bank = SL_IR_OPT_INT; num_components = 3; break;
+      case slrak_ivec4: bank = SL_IR_OPT_INT; num_components = 4; break;
+      case slrak_float: bank = SL_IR_OPT_FLOAT; num_components = 1; break;
+      case slrak_vec2:  bank = SL_IR_OPT_FLOAT; num_components = 2; break;
+      case slrak_vec3:  bank = SL_IR_OPT_FLOAT; num_components = 3; break;
+      case slrak_vec4:  bank = SL_IR_OPT_FLOAT; num_components = 4; break;
+      default: continue;
+    }
+    if (exec->specialize_ && *exec->specialize_) {
+      if (!v->name_ || !sl_exec_is_listed(exec->specialize_, v->name_)) continue;
+    }
+    else if (bank == SL_IR_OPT_FLOAT) {
+      /* Floats are seldom the same for long, by default they are not worth a variant */
+      continue;
+    }
+    num_bank_regs = (bank == SL_IR_OPT_FLOAT) ? exec->num_float_regs_ : ((bank == SL_IR_OPT_INT) ? exec->num_int_regs_ : exec->num_bool_regs_);
+    if ((num_regs + (size_t)num_components) > SL_EXEC_MAX_SPECIALIZED_REGS) break;
+    for (n = 0; n < num_components; ++n) {
+      /* Uniforms the bytecode does not read may lie beyond the registers it runs with */
+      if ((size_t)v->reg_alloc_.v_.regs_[n] >= num_bank_regs) continue;
+      regs[num_regs].bank_ = bank;
+      regs[num_regs].reg_ = v->reg_alloc_.v_.regs_[n];
+      regs[num_regs].f_ = 0.f;
+      regs[num_regs].i_ = 0;
+      num_regs++;
+    }
+  } while (v != exec->cu_->global_frame_.variables_);
+
+  if (!num_regs) return;
+  exec->specialized_ = (struct sl_ir_opt_constant *)malloc(sizeof(struct sl_ir_opt_constant) * num_regs);
+  if (!exec->specialized_) return;
+  memcpy(exec->specialized_, regs, sizeof(struct sl_ir_opt_constant) * num_regs);
+  memset(exec->specialized_misses_, 0, sizeof(exec->specialized_misses_));
+  exec->num_specialized_ = num_regs;
+}
+
+int sl_exec_prep(struct sl_execution *exec, struct sl_compilation_unit *cu) {
+  void *new_float_regs = NULL;
+  void *new_int_regs = NULL;
+  void *new_bool_regs = NULL;
+  void *new_sampler2D_regs = NULL;
+  void *new_samplerCube_regs = NULL;
+  uint8_t *new_float_uniform_flags = NULL;
+  float *new_float_uniforms = NULL;
+  if (cu->register_counts_.num_float_regs_) {
+    new_float_regs = malloc(sizeof(float *) * cu->register_counts_.num_float_regs_);
+    if (!new_float_regs) goto fail;
+    memset(new_float_regs, 0, sizeof(float *) * cu->register_counts_.num_float_regs_);
+    new_float_uniform_flags = (uint8_t *)malloc(sizeof(uint8_t) * cu->register_counts_.num_float_regs_);
+    if (!new_float_uniform_flags) goto fail;
+    memset(new_float_uniform_flags, 0, sizeof(uint8_t) * cu->register_counts_.num_float_regs_);
+    new_float_uniforms = (float *)malloc(sizeof(float) * cu->register_counts_.num_float_regs_);
+    if (!new_float_uniforms) goto fail;
+    memset(new_float_uniforms, 0, sizeof(float) * cu->register_counts_.num_float_regs_);
+  }
+  if (cu->register_counts_.num_int_regs_) {
+    new_int_regs = malloc(sizeof(sl_exec_int_t *) * cu->register_counts_.num_int_regs_);
+    if (!new_int_regs) goto fail;
+    memset(new_int_regs, 0, sizeof(sl_exec_int_t *) * cu->register_counts_.num_int_regs_);
+  }
+  if (cu->register_counts_.num_bool_regs_) {
+    new_bool_regs = malloc(sizeof(unsigned char *) * cu->register_counts_.num_bool_regs_);
+    if (!new_bool_regs) goto fail;
+    memset(new_bool_regs, 0, sizeof(int *) * cu->register_counts_.num_bool_regs_);
+  }
+  if (cu->register_counts_.num_sampler2D_regs_) {
+    new_sampler2D_regs = malloc(sizeof(void *) * cu->register_counts_.num_sampler2D_regs_);
+    if (!new_sampler2D_regs) goto fail;
+    memset(new_sampler2D_regs, 0, sizeof(void *) * cu->register_counts_.num_sampler2D_regs_);
+  }
+  if (cu->register_counts_.num_samplerCube_regs_) {
+    new_samplerCube_regs = malloc(sizeof(void *) * cu->register_counts_.num_samplerCube_regs_);
+    if (!new_samplerCube_regs) goto fail;
+    memset(new_samplerCube_regs, 0, sizeof(void *) * cu->register_counts_.num_samplerCube_regs_);
+  }
+
+  if (exec->float_regs_) free(exec->float_regs_);
+  if (exec->int_regs_) free(exec->int_regs_);
+  if (exec->bool_regs_) free(exec->bool_regs_);
+  if (exec->sampler_2D_regs_) free(exec->sampler_2D_regs_);
+  if (exec->sampler_cube_regs_) free(exec->sampler_cube_regs_);
+  if (exec->float_uniform_flags_) free(exec->float_uniform_flags_);
+  if (exec->float_uniforms_) free(exec->float_uniforms_);
 
   exec->cu_ = cu;
 
@@ -3147,7 +4013,7 @@ int sl_exec_prep(struct sl_execution *exec, struct sl_compilation_unit *cu) {
   exec->float_regs_ = (float **)new_float_regs;
 
   exec->num_int_regs_ = (size_t)cu->register_counts_.num_int_regs_;
-  exec->int_regs_ = (int64_t **)new_int_regs;
+  exec->int_regs_ = (sl_exec_int_t **)new_int_regs;
 
   exec->num_bool_regs_ = (size_t)cu->register_counts_.num_bool_regs_;
   exec->bool_regs_ = (unsigned char **)new_bool_regs;
@@ -3158,6 +4024,9 @@ int sl_exec_prep(struct sl_execution *exec, struct sl_compilation_unit *cu) {
   exec->num_sampler_cube_regs_ = (size_t)cu->register_counts_.num_samplerCube_regs_;
   exec->sampler_cube_regs_ = (void ***)new_samplerCube_regs;
 
+  exec->float_uniform_flags_ = new_float_uniform_flags;
+  exec->float_uniforms_ = new_float_uniforms;
+
   /* Set exernally_initialized_ to 1 for all varyings, attributes or uniforms */
   struct sl_variable *v;
   v = exec->cu_->global_frame_.variables_;
@@ -3175,10 +4044,83 @@ int sl_exec_prep(struct sl_execution *exec, struct sl_compilation_unit *cu) {
          * would overwrite any externally set values of the variable. */
         v->is_externally_initialized_ = 1;
       }
+      if ((quali & SL_TYPE_QUALIFIER_UNIFORM) && exec->float_uniform_flags_) {
+        /* Candidate for reading as a scalar, see sl_bytecode_compile() */
+        sl_reg_alloc_mark_float_regs(&v->reg_alloc_, exec->float_uniform_flags_, exec->num_float_regs_, SL_EXEC_UNIFORM_SCALAR);
+      }
 
     } while (v != exec->cu_->global_frame_.variables_);
   }
 
+  /* Generate bytecode for main; if this fails (e.g. due to a construct the SLIR does not support) we
+   * fall back to walking the AST in sl_exec_run(). */
+  exec->aot_ = NULL;
+  sl_exec_clear_variants(exec);
+  memset(&exec->variant_stats_, 0, sizeof(exec->variant_stats_));
+  /* The schedule refers to the AST of the previous compilation unit */
+  exec->trace_state_ = exec->trace_enabled_ ? SLETS_NONE : SLETS_INVALID;
+  exec->num_trace_steps_ = 0;
+  if (exec->jit_) {
+    sl_jit_cleanup(exec->jit_);
+    free(exec->jit_);
+    exec->jit_ = NULL;
+  }
+  if (exec->bytecode_) {
+    sl_bytecode_cleanup(exec->bytecode_);
+    free(exec->bytecode_);
+    exec->bytecode_ = NULL;
+  }
+  struct sl_function *main_fn = sl_compilation_unit_find_function(cu, "main");
+  if (main_fn) {
+    struct sl_bytecode *bc = (struct sl_bytecode *)malloc(sizeof(struct sl_bytecode));
+    if (bc) {
+      sl_bytecode_init(bc);
+      if (!sl_bytecode_compile(bc, cu, main_fn, exec->float_uniform_flags_, exec->num_float_regs_,
+                               exec->inline_threshold_, exec->unroll_max_size_, exec->ir_opt_passes_, NULL, 0, exec->ir_opt_dump_ ? stderr : NULL)) {
+        exec->bytecode_ = bc;
+      }
+      else {
+        sl_bytecode_cleanup(bc);
+        free(bc);
+      }
+    }
+  }
+
+  /* The bytecode's registers were allocated by liveness, the slab need only hold those it uses; walking the
+   * AST needs all of them. */
+  if (exec->bytecode_ && (exec->interpreter_ != SLEI_AST)) {
+    const struct sl_exec_call_graph_results *counts = &exec->bytecode_->register_counts_;
+    if (counts->num_float_regs_ < exec->num_float_regs_) exec->num_float_regs_ = counts->num_float_regs_;
+    if (counts->num_int_regs_ < exec->num_int_regs_) exec->num_int_regs_ = counts->num_int_regs_;
+    if (counts->num_bool_regs_ < exec->num_bool_regs_) exec->num_bool_regs_ = counts->num_bool_regs_;
+    if (counts->num_sampler2D_regs_ < exec->num_sampler_2D_regs_) exec->num_sampler_2D_regs_ = counts->num_sampler2D_regs_;
+    if (counts->num_samplerCube_regs_ < exec->num_sampler_cube_regs_) exec->num_sampler_cube_regs_ = counts->num_samplerCube_regs_;
+  }
+
+  /* Walking the AST reads all uniforms as columns */
+  if ((!exec->bytecode_ || (exec->interpreter_ == SLEI_AST)) && exec->float_uniform_flags_) {
+    size_t n;
+    for (n = 0; n < exec->num_float_regs_; ++n) {
+      if (exec->float_uniform_flags_[n] & SL_EXEC_UNIFORM_SCALAR) exec->float_uniform_flags_[n] |= SL_EXEC_UNIFORM_COLUMN;
+    }
+  }
+
+  /* Generate native code from the bytecode; if the host lacks the instruction set, we interpret the bytecode instead. */
+  if (exec->bytecode_ && (exec->interpreter_ == SLEI_JIT) && sl_jit_host_supported()) {
+    struct sl_jit *jit = (struct sl_jit *)malloc(sizeof(struct sl_jit));
+    if (jit) {
+      sl_jit_init(jit);
+      if (!sl_jit_compile(jit, exec->bytecode_, !!exec->profile_)) {
+        exec->jit_ = jit;
+      }
+      else {
+        sl_jit_cleanup(jit);
+        free(jit);
+      }
+    }
+  }
+
+  sl_exec_pick_specialized(exec);
 
   return 0;
 fail:
@@ -3187,30 +4129,39 @@ fail:
   if (new_bool_regs) free(new_bool_regs);
   if (new_sampler2D_regs) free(new_sampler2D_regs);
   if (new_samplerCube_regs) free(new_samplerCube_regs);
+  if (new_float_uniform_flags) free(new_float_uniform_flags);
+  if (new_float_uniforms) free(new_float_uniforms);
 
   return -1;
 }
 
 int sl_exec_allocate_registers_by_slab(struct sl_execution *exec, size_t max_num_rows) {
   float *float_bank = NULL;
-  int64_t *int_bank = NULL;
+  sl_exec_int_t *int_bank = NULL;
   uint8_t *bool_bank = NULL;
   void **sampler2D_bank = NULL;
   void **samplerCube_bank = NULL;
-  uint8_t *chain_bank = NULL;
+  sl_exec_row_t *chain_bank = NULL;
 
   size_t num_rows = max_num_rows;
+  size_t num_float_columns = 0;
+  size_t n;
+
+  /* Uniforms only read as scalars (see struct sl_execution::float_uniform_flags_) need no column */
+  for (n = 0; n < exec->num_float_regs_; n++) {
+    if (!exec->float_uniform_flags_ || (exec->float_uniform_flags_[n] != SL_EXEC_UNIFORM_SCALAR)) num_float_columns++;
+  }
 
   size_t slab_size = 0;
-  slab_size += sizeof(float) * num_rows * exec->num_float_regs_;
-  slab_size += sizeof(int64_t) * num_rows * exec->num_int_regs_;
+  slab_size += sizeof(float) * num_rows * num_float_columns;
+  slab_size += sizeof(sl_exec_int_t) * num_rows * exec->num_int_regs_;
   slab_size += sizeof(uint8_t) * num_rows * exec->num_bool_regs_;
   slab_size += sizeof(void *) * num_rows * exec->num_sampler_2D_regs_;
   slab_size += sizeof(void *) * num_rows * exec->num_sampler_cube_regs_;
 
   char *slab = (char *)malloc(slab_size);
   if (!slab) return -1;
-  uint8_t *exec_regs = (uint8_t *)malloc(sizeof(uint8_t) * num_rows);
+  sl_exec_row_t *exec_regs = (sl_exec_row_t *)malloc(sizeof(sl_exec_row_t) * num_rows);
   if (!exec_regs) {
     free(slab);
     return -1;
@@ -3218,25 +4169,30 @@ int sl_exec_allocate_registers_by_slab(struct sl_execution *exec, size_t max_num
 
   char *pslab = slab;
 
-  if (exec->num_float_regs_) { float_bank = (float *)pslab; pslab += sizeof(float) * num_rows * exec->num_float_regs_; }
-  if (exec->num_int_regs_) { int_bank = (int64_t *)pslab; pslab += sizeof(int64_t) * num_rows * exec->num_int_regs_; }
+  if (num_float_columns) { float_bank = (float *)pslab; pslab += sizeof(float) * num_rows * num_float_columns; }
+  if (exec->num_int_regs_) { int_bank = (sl_exec_int_t *)pslab; pslab += sizeof(sl_exec_int_t) * num_rows * exec->num_int_regs_; }
   if (exec->num_bool_regs_) { bool_bank = (uint8_t *)pslab; pslab += sizeof(uint8_t) * num_rows * exec->num_bool_regs_; }
   if (exec->num_sampler_2D_regs_) { sampler2D_bank = (void **)pslab; pslab += sizeof(void *) * num_rows * exec->num_sampler_2D_regs_; }
   if (exec->num_sampler_cube_regs_) { samplerCube_bank = (void **)pslab; pslab += sizeof(void *) * num_rows * exec->num_sampler_cube_regs_; }
-  chain_bank = (uint8_t *)pslab;
+  chain_bank = (sl_exec_row_t *)pslab;
 
-  if (exec->float_regs_) exec->float_regs_[0] = float_bank;
   if (exec->int_regs_) exec->int_regs_[0] = int_bank;
   if (exec->bool_regs_) exec->bool_regs_[0] = bool_bank;
   if (exec->sampler_2D_regs_) exec->sampler_2D_regs_[0] = sampler2D_bank;
   if (exec->sampler_cube_regs_) exec->sampler_cube_regs_[0] = samplerCube_bank;
+  if (exec->exec_chain_reg_) free(exec->exec_chain_reg_);
   exec->exec_chain_reg_ = exec_regs;
-  size_t n;
 
-  memset(exec->exec_chain_reg_, 0, num_rows * sizeof(uint8_t));
+  memset(exec->exec_chain_reg_, 0, num_rows * sizeof(sl_exec_row_t));
 
-  for (n = 1; n < exec->num_float_regs_; n++) {
-    exec->float_regs_[n] = exec->float_regs_[n - 1] + num_rows;
+  for (n = 0; n < exec->num_float_regs_; n++) {
+    if (exec->float_uniform_flags_ && (exec->float_uniform_flags_[n] == SL_EXEC_UNIFORM_SCALAR)) {
+      exec->float_regs_[n] = NULL;
+    }
+    else {
+      exec->float_regs_[n] = float_bank;
+      float_bank += num_rows;
+    }
   }
   for (n = 1; n < exec->num_int_regs_; n++) {
     exec->int_regs_[n] = exec->int_regs_[n - 1] + num_rows;
@@ -3252,7 +4208,102 @@ int sl_exec_allocate_registers_by_slab(struct sl_execution *exec, size_t max_num
   }
 
   exec->max_num_rows_ = num_rows;
+  if (exec->slab_) free(exec->slab_);
   exec->slab_ = slab;
+  exec->slab_size_ = slab_size;
+  exec->uniforms_owner_ = NULL;
+  exec->variant_ = NULL;
+  return 0;
+}
+
+/* Initializes ctx as an empty execution context, see sl_exec_init_context() */
+static void sl_exec_init_context_empty(struct sl_execution *ctx) {
+  sl_exec_init(ctx);
+  if (ctx->profile_) {
+    /* The listing is of the program, not of each context running it */
+    sl_profile_cleanup(ctx->profile_);
+    free(ctx->profile_);
+    ctx->profile_ = NULL;
+  }
+}
+
+int sl_exec_init_context(struct sl_execution *ctx, const struct sl_execution *exec) {
+  size_t num_cu_float_regs;
+  size_t num_frames;
+  sl_exec_init_context_empty(ctx);
+  if (!exec->cu_ || !exec->slab_) return -1;
+
+  ctx->program_ = exec;
+  ctx->cu_ = exec->cu_;
+  ctx->interpreter_ = exec->interpreter_;
+  ctx->predication_ = exec->predication_;
+  ctx->accuracy_ = exec->accuracy_;
+  ctx->batch_cache_budget_ = exec->batch_cache_budget_;
+  ctx->compact_density_ = exec->compact_density_;
+  ctx->trace_enabled_ = exec->trace_enabled_;
+  ctx->trace_state_ = exec->trace_enabled_ ? SLETS_NONE : SLETS_INVALID;
+  ctx->float_uniform_flags_ = exec->float_uniform_flags_;
+  ctx->bytecode_ = exec->bytecode_;
+  ctx->jit_ = exec->jit_;
+  ctx->aot_ = exec->aot_;
+
+  ctx->num_float_regs_ = exec->num_float_regs_;
+  ctx->num_int_regs_ = exec->num_int_regs_;
+  ctx->num_bool_regs_ = exec->num_bool_regs_;
+  ctx->num_sampler_2D_regs_ = exec->num_sampler_2D_regs_;
+  ctx->num_sampler_cube_regs_ = exec->num_sampler_cube_regs_;
+  if (ctx->num_float_regs_) {
+    ctx->float_regs_ = (float **)calloc(ctx->num_float_regs_, sizeof(float *));
+    if (!ctx->float_regs_) goto fail;
+  }
+  if (ctx->num_int_regs_) {
+    ctx->int_regs_ = (sl_exec_int_t **)calloc(ctx->num_int_regs_, sizeof(sl_exec_int_t *));
+    if (!ctx->int_regs_) goto fail;
+  }
+  if (ctx->num_bool_regs_) {
+    ctx->bool_regs_ = (unsigned char **)calloc(ctx->num_bool_regs_, sizeof(unsigned char *));
+    if (!ctx->bool_regs_) goto fail;
+  }
+  if (ctx->num_sampler_2D_regs_) {
+    ctx->sampler_2D_regs_ = (void ***)calloc(ctx->num_sampler_2D_regs_, sizeof(void **));
+    if (!ctx->sampler_2D_regs_) goto fail;
+  }
+  if (ctx->num_sampler_cube_regs_) {
+    ctx->sampler_cube_regs_ = (void ***)calloc(ctx->num_sampler_cube_regs_, sizeof(void **));
+    if (!ctx->sampler_cube_regs_) goto fail;
+  }
+  num_cu_float_regs = (size_t)exec->cu_->register_counts_.num_float_regs_;
+  if (exec->float_uniforms_ && num_cu_float_regs) {
+    ctx->float_uniforms_ = (float *)calloc(num_cu_float_regs, sizeof(float));
+    if (!ctx->float_uniforms_) goto fail;
+  }
+
+  /* The frames are as deep as the call graph, reserve them so the stack does not grow while running */
+  num_frames = (size_t)exec->cu_->register_counts_.num_execution_frames_ + 1;
+  if (num_frames >= (SIZE_MAX / sizeof(struct sl_execution_frame))) goto fail;
+  ctx->execution_frames_ = (struct sl_execution_frame *)malloc(sizeof(struct sl_execution_frame) * num_frames);
+  if (!ctx->execution_frames_) goto fail;
+  ctx->num_execution_frames_allocated_ = num_frames;
+
+  if (sl_exec_allocate_registers_by_slab(ctx, exec->max_num_rows_)) goto fail;
+  if (ctx->slab_size_ != exec->slab_size_) goto fail;
+  return 0;
+fail:
+  sl_exec_cleanup(ctx);
+  sl_exec_init_context_empty(ctx);
+  return -1;
+}
+
+int sl_exec_sync_context(struct sl_execution *ctx) {
+  const struct sl_execution *exec = ctx->program_;
+  if (!exec || (exec->slab_size_ != ctx->slab_size_) || (exec->max_num_rows_ != ctx->max_num_rows_)) return -1;
+  /* Uniform columns are broadcast to all rows, the slab holds them in the same place for the same layout */
+  if (ctx->slab_size_) memcpy(ctx->slab_, exec->slab_, ctx->slab_size_);
+  if (ctx->float_uniforms_) {
+    memcpy(ctx->float_uniforms_, exec->float_uniforms_, sizeof(float) * (size_t)exec->cu_->register_counts_.num_float_regs_);
+  }
+  ctx->uniforms_owner_ = exec->uniforms_owner_;
+  ctx->variant_ = exec->variant_;
   return 0;
 }
 
@@ -3328,7 +4379,7 @@ uint32_t sl_exec_join_chains(struct sl_execution *exec, uint32_t a, uint32_t b)
    * to indicate an empty list as row 0 is a valid row. Consequently, to indicate
    * "no list", a or b should be set to SL_EXEC_NO_CHAIN. This is also why their
    * type is uint32_t. */
-  uint8_t *ec = exec->exec_chain_reg_;
+  sl_exec_row_t *ec = exec->exec_chain_reg_;
 
   uint32_t r;
   if (a == SL_EXEC_NO_CHAIN) return b;
@@ -3336,7 +4387,7 @@ uint32_t sl_exec_join_chains(struct sl_execution *exec, uint32_t a, uint32_t b)
 
   if (a < b) {
     r = a;
-    uint8_t step = ec[a];
+    sl_exec_row_t step = ec[a];
     if (step) {
       a += step;
     }
@@ -3346,7 +4397,7 @@ uint32_t sl_exec_join_chains(struct sl_execution *exec, uint32_t a, uint32_t b)
   }
   else if (a > b) {
     r = b;
-    uint8_t step = ec[b];
+    sl_exec_row_t step = ec[b];
     if (step) {
       b += step;
     }
@@ -3363,16 +4414,16 @@ uint32_t sl_exec_join_chains(struct sl_execution *exec, uint32_t a, uint32_t b)
   q = r;
   for (;;) {
     if (a < b) {
-      ec[q] = (uint8_t)(a - q);
+      ec[q] = (sl_exec_row_t)(a - q);
       q = a;
-      uint8_t step = ec[a];
+      sl_exec_row_t step = ec[a];
       if (step) a += step;
       else a = SL_EXEC_NO_CHAIN;
     }
     else if (a > b) {
-      ec[q] = (uint8_t)(b - q);
+      ec[q] = (sl_exec_row_t)(b - q);
       q = b;
-      uint8_t step = ec[b];
+      sl_exec_row_t step = ec[b];
       if (step) b += step;
       else b = SL_EXEC_NO_CHAIN;
     }
@@ -3475,6 +4526,288 @@ void sl_exec_cgr_swap(struct sl_exec_call_graph_results *a, struct sl_exec_call_
   *b = t;
 }
 
+size_t sl_exec_row_size(const struct sl_exec_call_graph_results *cgr) {
+  return sizeof(float) * cgr->num_float_regs_
+       + sizeof(sl_exec_int_t) * cgr->num_int_regs_
+       + sizeof(uint8_t) * cgr->num_bool_regs_
+       + sizeof(void *) * (cgr->num_sampler2D_regs_ + cgr->num_samplerCube_regs_)
+       + sizeof(sl_exec_row_t);
+}
+
+void sl_exec_get_register_counts(const struct sl_execution *exec, struct sl_exec_call_graph_results *cgr) {
+  cgr->num_execution_frames_ = 0;
+  cgr->num_float_regs_ = exec->num_float_regs_;
+  cgr->num_int_regs_ = exec->num_int_regs_;
+  cgr->num_bool_regs_ = exec->num_bool_regs_;
+  cgr->num_sampler2D_regs_ = exec->num_sampler_2D_regs_;
+  cgr->num_samplerCube_regs_ = exec->num_sampler_cube_regs_;
+}
+
+size_t sl_exec_num_fused(const struct sl_execution *exec, int fusion) {
+  if (!exec->bytecode_ || (fusion < 0) || (fusion >= SL_IR_OPT_NUM_FUSIONS)) return 0;
+  return exec->bytecode_->num_fused_[fusion];
+}
+
+/* Generates the bytecode (and native code) of variant v for its values_; leaves v->bytecode_ NULL if it cannot. */
+static void sl_exec_generate_variant(struct sl_execution *exec, struct sl_exec_variant *v) {
+  size_t num_float_regs = (size_t)exec->cu_->register_counts_.num_float_regs_;
+  uint8_t *float_uniform_flags = NULL;
+  struct sl_bytecode *bc = NULL;
+  const struct sl_exec_call_graph_results *counts;
+  size_t n;
+  if (num_float_regs) {
+    float_uniform_flags = (uint8_t *)malloc(num_float_regs);
+    if (!float_uniform_flags) return;
+    memcpy(float_uniform_flags, exec->float_uniform_flags_, num_float_regs);
+  }
+  bc = (struct sl_bytecode *)malloc(sizeof(struct sl_bytecode));
+  if (!bc) goto fail;
+  sl_bytecode_init(bc);
+  if (sl_bytecode_compile(bc, exec->cu_, exec->bytecode_->f_, float_uniform_flags, num_float_regs, exec->inline_threshold_,
+                          exec->unroll_max_size_, exec->ir_opt_passes_, v->values_, exec->num_specialized_, NULL)) {
+    goto fail;
+  }
+
+  /* The variant runs on the registers laid out for the generic code, so it may not need more of them, nor read
+   * uniforms as columns that are not broadcast. */
+  counts = &bc->register_counts_;
+  if ((counts->num_float_regs_ > exec->num_float_regs_) || (counts->num_int_regs_ > exec->num_int_regs_) ||
+      (counts->num_bool_regs_ > exec->num_bool_regs_) || (counts->num_sampler2D_regs_ > exec->num_sampler_2D_regs_) ||
+      (counts->num_samplerCube_regs_ > exec->num_sampler_cube_regs_)) {
+    goto fail;
+  }
+  for (n = 0; n < num_float_regs; ++n) {
+    if ((float_uniform_flags[n] & SL_EXEC_UNIFORM_COLUMN) && !(exec->float_uniform_flags_[n] & SL_EXEC_UNIFORM_COLUMN)) goto fail;
+  }
+  if (float_uniform_flags) free(float_uniform_flags);
+  v->bytecode_ = bc;
+
+  if ((exec->interpreter_ == SLEI_JIT) && sl_jit_host_supported()) {
+    struct sl_jit *jit = (struct sl_jit *)malloc(sizeof(struct sl_jit));
+    if (jit) {
+      sl_jit_init(jit);
+      if (!sl_jit_compile(jit, bc, !!exec->profile_)) {
+        v->jit_ = jit;
+      }
+      else {
+        sl_jit_cleanup(jit);
+        free(jit);
+      }
+    }
+  }
+  return;
+fail:
+  if (bc) {
+    sl_bytecode_cleanup(bc);
+    free(bc);
+  }
+  if (float_uniform_flags) free(float_uniform_flags);
+}
+
+/* Returns non-zero if values holds the same values as exec->specialized_ */
+static int sl_exec_same_values(const struct sl_execution *exec, const struct sl_ir_opt_constant *values) {
+  size_t n;
+  for (n = 0; n < exec->num_specialized_; ++n) {
+    const struct sl_ir_opt_constant *c = exec->specialized_ + n;
+    if (c->bank_ == SL_IR_OPT_FLOAT) {
+      if (memcmp(&c->f_, &values[n].f_, sizeof(float))) return 0;
+    }
+    else if (c->i_ != values[n].i_) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/* Stops specializing on the uniform registers whose values changed on SL_EXEC_MAX_SPECIALIZED_MISSES consecutive
+ * misses, flushing the variant cache (its variants were generated for the old set of registers.) Returns non-zero
+ * if any register was dropped. */
+static int sl_exec_drop_changing_specialized(struct sl_execution *exec) {
+  size_t n, num_kept = 0;
+  for (n = 0; n < exec->num_specialized_; ++n) {
+    if (exec->specialized_misses_[n] >= SL_EXEC_MAX_SPECIALIZED_MISSES) continue;
+    exec->specialized_[num_kept] = exec->specialized_[n];
+    exec->specialized_misses_[num_kept] = exec->specialized_misses_[n];
+    num_kept++;
+  }
+  if (num_kept == exec->num_specialized_) return 0;
+  exec->variant_stats_.unspecialized_ += exec->num_specialized_ - num_kept;
+  exec->num_specialized_ = num_kept;
+  for (n = 0; n < exec->num_variants_; ++n) {
+    sl_exec_variant_cleanup(exec->variants_ + n);
+  }
+  exec->num_variants_ = 0;
+  exec->variant_stats_.num_variants_ = 0;
+  return 1;
+}
+
+void sl_exec_select_variant(struct sl_execution *exec) {
+  struct sl_exec_variant *v;
+  uint64_t hash = 14695981039346656037ULL;
+  uint8_t changed[SL_EXEC_MAX_SPECIALIZED_REGS];
+  size_t n;
+  exec->variant_ = NULL;
+  if (!exec->num_specialized_ || !exec->max_num_rows_) return;
+
+  /* Uniforms hold the same value on all rows, the first row will do */
+  for (n = 0; n < exec->num_specialized_; ++n) {
+    struct sl_ir_opt_constant *c = exec->specialized_ + n;
+    struct sl_ir_opt_constant prev = *c;
+    uint64_t bits;
+    switch (c->bank_) {
+      case SL_IR_OPT_FLOAT:
+        c->f_ = exec->float_uniforms_[c->reg_];
+        bits = 0;
+        memcpy(&bits, &c->f_, sizeof(float));
+        changed[n] = !!memcmp(&prev.f_, &c->f_, sizeof(float));
+        break;
+      case SL_IR_OPT_INT:
+        c->i_ = exec->int_regs_[c->reg_][0];
+        bits = (uint64_t)c->i_;
+        changed[n] = prev.i_ != c->i_;
+        break;
+      default:
+        c->i_ = exec->bool_regs_[c->reg_][0];
+        bits = (uint64_t)c->i_;
+        changed[n] = prev.i_ != c->i_;
+        break;
+    }
+    hash = (hash ^ bits) * 1099511628211ULL;
+  }
+
+  /* The first selection has no previous values to compare with */
+  if (!exec->variant_clock_) memset(changed, 0, sizeof(changed));
+
+  exec->variant_clock_++;
+  for (n = 0; n < exec->num_variants_; ++n) {
+    v = exec->variants_ + n;
+    if ((v->hash_ == hash) && sl_exec_same_values(exec, v->values_)) {
+      v->last_used_ = exec->variant_clock_;
+      if (v->bytecode_) {
+        exec->variant_ = v;
+        exec->variant_stats_.hits_++;
+      }
+      else {
+        exec->variant_stats_.failed_hits_++;
+      }
+      memset(exec->specialized_misses_, 0, sizeof(exec->specialized_misses_));
+      return;
+    }
+  }
+
+  exec->variant_stats_.misses_++;
+  for (n = 0; n < exec->num_specialized_; ++n) {
+    if (!changed[n]) exec->specialized_misses_[n] = 0;
+    else if (exec->specialized_misses_[n] < SL_EXEC_MAX_SPECIALIZED_MISSES) exec->specialized_misses_[n]++;
+  }
+  if (sl_exec_drop_changing_specialized(exec)) {
+    /* Rather than compile a variant for the remaining registers right away, run the generic code for this draw;
+     * the next draw selects among the remaining registers. */
+    return;
+  }
+  if (!exec->variants_) {
+    exec->variants_ = (struct sl_exec_variant *)malloc(sizeof(struct sl_exec_variant) * exec->max_variants_);
+    if (!exec->variants_) {
+      exec->variant_stats_.failures_++;
+      return;
+    }
+  }
+  if (exec->num_variants_ < exec->max_variants_) {
+    v = exec->variants_ + exec->num_variants_++;
+  }
+  else {
+    v = exec->variants_;
+    for (n = 1; n < exec->num_variants_; ++n) {
+      if (exec->variants_[n].last_used_ < v->last_used_) v = exec->variants_ + n;
+    }
+    sl_exec_variant_cleanup(v);
+    exec->variant_stats_.evictions_++;
+  }
+  exec->variant_stats_.num_variants_ = exec->num_variants_;
+
+  v->hash_ = hash;
+  v->last_used_ = exec->variant_clock_;
+  v->bytecode_ = NULL;
+  v->jit_ = NULL;
+  v->values_ = (struct sl_ir_opt_constant *)malloc(sizeof(struct sl_ir_opt_constant) * exec->num_specialized_);
+  if (v->values_) {
+    memcpy(v->values_, exec->specialized_, sizeof(struct sl_ir_opt_constant) * exec->num_specialized_);
+    sl_exec_generate_variant(exec, v);
+  }
+  else {
+    /* Cannot be found again, free the slot */
+    exec->num_variants_--;
+    exec->variant_stats_.num_variants_ = exec->num_variants_;
+    if (v != exec->variants_ + exec->num_variants_) *v = exec->variants_[exec->num_variants_];
+    exec->variant_stats_.failures_++;
+    return;
+  }
+  if (v->bytecode_) exec->variant_ = v;
+  else exec->variant_stats_.failures_++;
+}
+
+void sl_exec_get_variant_stats(const struct sl_execution *exec, struct sl_exec_variant_stats *stats) {
+  *stats = exec->variant_stats_;
+}
+
+void sl_exec_take_compaction_stats(struct sl_execution *exec, struct sl_exec_compaction_stats *stats) {
+  *stats = exec->compaction_stats_;
+  memset(&exec->compaction_stats_, 0, sizeof(exec->compaction_stats_));
+}
+
+void sl_exec_pool_init(struct sl_exec_pool *pool) {
+  pool->exec_ = NULL;
+  pool->num_contexts_ = 0;
+  pool->contexts_ = NULL;
+}
+
+void sl_exec_pool_cleanup(struct sl_exec_pool *pool) {
+  size_t n;
+  for (n = 0; n < pool->num_contexts_; ++n) {
+    sl_exec_cleanup(pool->contexts_ + n);
+  }
+  if (pool->contexts_) free(pool->contexts_);
+}
+
+int sl_exec_pool_reset(struct sl_exec_pool *pool, const struct sl_execution *exec, size_t num_contexts) {
+  size_t n;
+  sl_exec_pool_cleanup(pool);
+  sl_exec_pool_init(pool);
+  if (!num_contexts) return 0;
+  if (num_contexts >= (SIZE_MAX / sizeof(struct sl_execution))) return -1;
+  pool->contexts_ = (struct sl_execution *)malloc(sizeof(struct sl_execution) * num_contexts);
+  if (!pool->contexts_) return -1;
+  for (n = 0; n < num_contexts; ++n) {
+    if (sl_exec_init_context(pool->contexts_ + n, exec)) {
+      pool->num_contexts_ = n;
+      sl_exec_pool_cleanup(pool);
+      sl_exec_pool_init(pool);
+      return -1;
+    }
+  }
+  pool->exec_ = exec;
+  pool->num_contexts_ = num_contexts;
+  return 0;
+}
+
+int sl_exec_pool_sync(struct sl_exec_pool *pool) {
+  size_t n;
+  for (n = 0; n < pool->num_contexts_; ++n) {
+    if (sl_exec_sync_context(pool->contexts_ + n)) return -1;
+  }
+  return 0;
+}
+
+size_t sl_exec_batch_num_rows(const struct sl_exec_call_graph_results *cgr, size_t cache_budget) {
+  size_t row_size = sl_exec_row_size(cgr);
+  size_t num_rows;
+  if (!cache_budget) return SL_EXEC_CHAIN_MAX_NUM_ROWS;
+  num_rows = (cache_budget / row_size) & ~(size_t)63;
+  if (num_rows < 64) num_rows = 64;
+  if (num_rows > SL_EXEC_CHAIN_MAX_NUM_ROWS) num_rows = SL_EXEC_CHAIN_MAX_NUM_ROWS;
+  return num_rows;
+}
+
 static int sl_exec_cga_function_impl(struct sl_exec_call_graph_results *cgr, struct sl_function *f) {
   int r;
   if (f->visited_) return -1; /* invalid recursion */
@@ -3570,53 +4903,717 @@ static int sl_exec_push_execution_frame(struct sl_execution *exec) {
   return 0;
 }
 
-void sl_exec_pop_execution_frame(struct sl_execution *exec) {
-  if (exec->num_execution_frames_) exec->num_execution_frames_--;
+void sl_exec_pop_execution_frame(struct sl_execution *exec) {
+  if (exec->num_execution_frames_) exec->num_execution_frames_--;
+}
+
+static void sl_exec_need_rvalue(struct sl_execution *exec, uint32_t chain, struct sl_expr *x) {
+  sl_reg_move(exec, chain, &x->base_regs_, &x->offset_reg_, &x->rvalue_, NULL);
+}
+
+/* Appends a step to the schedule being recorded, for work on chain (or SL_EXEC_NO_CHAIN if the work does not depend
+ * on the rows being run), and returns it for the caller to complete; returns NULL if no schedule is being recorded. */
+static struct sl_exec_trace_step *sl_exec_trace_append(struct sl_execution *exec, sl_execution_trace_step_kind_t kind, uint32_t chain) {
+  if (exec->trace_state_ != SLETS_RECORDING) return NULL;
+  if ((chain != SL_EXEC_NO_CHAIN) && (chain != exec->trace_chain_)) {
+    /* Only some of the rows get here, the shader diverges */
+    exec->trace_state_ = SLETS_INVALID;
+    return NULL;
+  }
+  if (exec->num_trace_steps_ == exec->num_trace_steps_allocated_) {
+    size_t new_num_allocated = exec->num_trace_steps_allocated_ * 2 + 64;
+    if ((new_num_allocated <= exec->num_trace_steps_allocated_) ||
+        (new_num_allocated >= (SIZE_MAX / sizeof(struct sl_exec_trace_step)))) {
+      /* overflow */
+      exec->trace_state_ = SLETS_INVALID;
+      return NULL;
+    }
+    struct sl_exec_trace_step *new_steps = (struct sl_exec_trace_step *)realloc(exec->trace_steps_, new_num_allocated * sizeof(struct sl_exec_trace_step));
+    if (!new_steps) {
+      /* no memory; not fatal, the AST is walked instead */
+      exec->trace_state_ = SLETS_INVALID;
+      return NULL;
+    }
+    exec->trace_steps_ = new_steps;
+    exec->num_trace_steps_allocated_ = new_num_allocated;
+  }
+  struct sl_exec_trace_step *ts = exec->trace_steps_ + exec->num_trace_steps_++;
+  memset(ts, 0, sizeof(*ts));
+  ts->kind_ = kind;
+  return ts;
+}
+
+static void sl_exec_initialize_globals(struct sl_execution *exec) {
+  struct sl_variable *v;
+  v = exec->cu_->global_frame_.variables_;
+  if (v) {
+    do {
+      v = v->chain_;
+
+      if (v->is_externally_initialized_) {
+        /* Don't initialize attributes as the caller will have initialized them */
+      }
+      else {
+        struct sl_exec_trace_step *ts = sl_exec_trace_append(exec, SLETK_GLOBAL, SL_EXEC_NO_CHAIN);
+        if (ts) {
+          ts->dst_ = &v->reg_alloc_;
+          ts->literal_ = &v->value_;
+        }
+        sl_exec_init_literal(exec, 0, &v->reg_alloc_, &v->value_, 0);
+      }
+
+    } while (v != exec->cu_->global_frame_.variables_);
+  }
+}
+
+/* Establishes the frame for f, the function run, right above the globals */
+static int sl_exec_push_main_frame(struct sl_execution *exec, struct sl_function *f) {
+  int r = 0;
+  exec->num_execution_frames_ = 0;
+  r = sl_exec_push_execution_frame(exec);
+  if (r) return r;
+
+  struct sl_execution_frame *ef = exec->execution_frames_;
+  ef->f_ = f;
+  ef->local_float_offset_ = (int)exec->cu_->global_frame_.ract_.rra_floats_.watermark_;
+  ef->local_int_offset_ = (int)exec->cu_->global_frame_.ract_.rra_ints_.watermark_;
+  ef->local_bool_offset_ = (int)exec->cu_->global_frame_.ract_.rra_bools_.watermark_;
+  ef->local_sampler2D_offset_ = (int)exec->cu_->global_frame_.ract_.rra_sampler2D_.watermark_;
+  ef->local_samplerCube_offset_ = (int)exec->cu_->global_frame_.ract_.rra_samplerCube_.watermark_;
+  return 0;
+}
+
+static int sl_exec_prepare_run(struct sl_execution *exec, struct sl_function *f, int exec_chain) {
+  int r = 0;
+  r = sl_exec_push_main_frame(exec, f);
+  if (r) return r;
+
+  r = sl_exec_push_bootstrap(exec, f, exec_chain, 0);
+  if (r) return r;
+
+  return 0;
+}
+
+/* Performs the operator of expression x for the rows in chain, after its children have been evaluated; this covers
+ * all operators except those that alter the flow of execution (the logical and/or, the conditional, and calls to
+ * functions that are not builtins), see sl_exec_run(). */
+static int sl_exec_expr_kernel(struct sl_execution *exec, uint32_t chain, struct sl_expr *x) {
+  switch (x->op_) {
+    case exop_array_subscript: {
+      if (x->children_[0]->base_regs_.kind_ == slrak_array) {
+        /* Take the fixed array size that this subscript indexes, if the array child has an offset_, multiply
+         * the offset value to form the new offset, then be done. We don't need to do anything on the lvalue
+         * itself as the register allocator has ensured it is the correct field subset. */
+        if (x->children_[0]->offset_reg_.kind_  != slrak_void) {
+          if (&x->children_[1]->offset_reg_.kind_ != slrak_void) {
+            sl_exec_offset_load(exec, chain,
+                                &x->children_[1]->rvalue_,
+                                &x->children_[1]->base_regs_,
+                                &x->children_[1]->offset_reg_);
+          }
+
+          /* New offset = old-offset * array-size + array-subscript-index */
+          sl_exec_i_mul_constant_and_add(chain, exec->exec_chain_reg_,
+                                         INT_REG_PTR_NRV(&x->offset_reg_, 0),
+                                         INT_REG_PTR_NRV(&x->children_[0]->offset_reg_, 0),
+                                         INT_REG_PTR(x->children_[1], 0),
+                                         (sl_exec_int_t)x->children_[0]->base_regs_.v_.array_.num_elements_);
+
+        }
+        else {
+          sl_reg_move(exec, chain,
+                      &x->children_[1]->base_regs_, &x->children_[1]->offset_reg_,
+                      &x->offset_reg_, NULL);
+        }
+      }
+      else {
+        /* Not an array, base must be indirect and this array subscript is to access components */
+        sl_exec_need_rvalue(exec, chain, x->children_[1]);
+
+        sl_exec_load_effective_reg_index(exec, chain, &x->base_regs_, &x->children_[0]->base_regs_, EXPR_RVALUE(x->children_[1]));
+      }
+      break;
+    }
+
+    case exop_post_inc:
+    case exop_post_dec: {
+      if (x->children_[0]->offset_reg_.kind_ != slrak_void) {
+        /* Child is offsetted; load at an offset into the result */
+        sl_exec_offset_load(exec, chain,
+                            &x->base_regs_,
+                            &x->children_[0]->base_regs_,
+                            &x->children_[0]->offset_reg_);
+        /* Inc/Decrement the value from the result into the R value of the child */
+        if (x->op_ == exop_post_inc) {
+          sl_exec_increment(exec, chain, &x->children_[0]->rvalue_, EXPR_RVALUE(x));
+        }
+        else /* (eps[epi].v_->expr_->op_ == exop_pre_dec) */ {
+          sl_exec_decrement(exec, chain, &x->children_[0]->rvalue_, EXPR_RVALUE(x));
+        }
+        /* The result will now hold the original value, the R-value of the child now holds the
+         * incremented value. Store the R-Value of the child into the child's L-Value (at the offset). */
+        sl_exec_offset_store(exec, chain,
+                             &x->children_[0]->base_regs_,
+                             &x->children_[0]->offset_reg_,
+                             EXPR_RVALUE(x->children_[0]));
+      }
+      else {
+        /* Move the pre-existing value into the result */
+        sl_reg_move(exec, chain,
+                    &x->children_[0]->base_regs_, NULL,
+                    &x->base_regs_, NULL);
+
+        /* And then Inc/Decrement the value from the result (the pre-existing one) into the child's l-value */
+        if (x->op_ == exop_post_inc) {
+          sl_exec_increment(exec, chain, &x->children_[0]->base_regs_, &x->base_regs_);
+        }
+        else /* (eps[epi].v_->expr_->op_ == exop_post_dec) */ {
+          sl_exec_decrement(exec, chain, &x->children_[0]->base_regs_, &x->base_regs_);
+        }
+      }
+      break;
+    }
+    case exop_pre_inc:
+    case exop_pre_dec: {
+      if (x->children_[0]->offset_reg_.kind_ != slrak_void) {
+        /* Child is offsetted; load via rvalue */
+        sl_reg_move(exec, chain,
+                    &x->children_[0]->base_regs_,
+                    &x->children_[0]->offset_reg_,
+                    &x->children_[0]->rvalue_,
+                    NULL);
+        /* Inc/Decrement the rvalue into the result value */
+        if (x->op_ == exop_pre_inc) {
+          sl_exec_increment(exec, chain, &x->base_regs_, EXPR_RVALUE(x->children_[0]));
+        }
+        else /* (eps[epi].v_->expr_->op_ == exop_pre_dec) */ {
+          sl_exec_decrement(exec, chain, &x->base_regs_, EXPR_RVALUE(x->children_[0]));
+        }
+
+        /* Store the result value into the original child's l-value */
+        sl_reg_move(exec, chain,
+                    EXPR_RVALUE(x), NULL,
+                    &x->children_[0]->base_regs_,
+                    &x->children_[0]->offset_reg_);
+      }
+      else {
+        /* Child can be used directly. */
+        /* Inc/Decrement the child's value into the result value */
+        if (x->op_ == exop_pre_inc) {
+          sl_exec_increment(exec, chain, &x->base_regs_, EXPR_RVALUE(x->children_[0]));
+        }
+        else /* (eps[epi].v_->expr_->op_ == exop_pre_dec) */ {
+          sl_exec_decrement(exec, chain, &x->base_regs_, EXPR_RVALUE(x->children_[0]));
+        }
+        /* Store the result value back into the original child's register */
+        sl_reg_move(exec, chain,
+                    &x->base_regs_, NULL,
+                    &x->children_[0]->base_regs_, NULL);
+      }
+      break;
+    }
+    case exop_negate: {
+      sl_exec_need_rvalue(exec, chain, x->children_[0]);
+
+      sl_exec_negate(exec, chain, x, x->children_[0]);
+      break;
+    }
+    case exop_logical_not: {
+      sl_exec_need_rvalue(exec, chain, x->children_[0]);
+
+      sl_exec_logical_not(exec, chain, x, x->children_[0]);
+      break;
+    }
+
+    case exop_mul_assign:
+    case exop_multiply: {
+      sl_exec_need_rvalue(exec, chain, x->children_[0]);
+      sl_exec_need_rvalue(exec, chain, x->children_[1]);
+
+      sl_exec_mul(exec, chain, x,
+                  x->children_[0],
+                  x->children_[1]);
+
+      if (x->op_ == exop_mul_assign) {
+        /* Store the result value into the original child's l-value */
+        sl_reg_move(exec, chain, EXPR_RVALUE(x), NULL, &x->children_[0]->base_regs_, &x->children_[0]->offset_reg_);
+      }
+      break;
+    }
+    case exop_div_assign:
+    case exop_divide: {
+      sl_exec_need_rvalue(exec, chain, x->children_[0]);
+      sl_exec_need_rvalue(exec, chain, x->children_[1]);
+
+      sl_exec_div(exec, chain, x,
+                  x->children_[0],
+                  x->children_[1]);
+      if (x->op_ == exop_div_assign) {
+        /* Store the result value into the original child's l-value */
+        sl_reg_move(exec, chain, EXPR_RVALUE(x), NULL, &x->children_[0]->base_regs_, &x->children_[0]->offset_reg_);
+      }
+      break;
+    }
+
+    case exop_add_assign:
+    case exop_add: {
+      sl_exec_need_rvalue(exec, chain, x->children_[0]);
+      sl_exec_need_rvalue(exec, chain, x->children_[1]);
+
+      sl_exec_add(exec, chain, x,
+                  x->children_[0],
+                  x->children_[1]);
+
+      if (x->op_ == exop_add_assign) {
+        /* Store the result value into the original child's l-value */
+        sl_reg_move(exec, chain, EXPR_RVALUE(x), NULL, &x->children_[0]->base_regs_, &x->children_[0]->offset_reg_);
+      }
+
+      break;
+    }
+
+    case exop_sub_assign:
+    case exop_subtract: {
+      sl_exec_need_rvalue(exec, chain, x->children_[0]);
+      sl_exec_need_rvalue(exec, chain, x->children_[1]);
+
+      sl_exec_sub(exec, chain, x,
+                  x->children_[0],
+                  x->children_[1]);
+
+      if (x->op_ == exop_sub_assign) {
+        /* Store the result value into the original child's l-value */
+        sl_reg_move(exec, chain, EXPR_RVALUE(x), NULL, &x->children_[0]->base_regs_, &x->children_[0]->offset_reg_);
+      }
+      break;
+    }
+
+    case exop_lt: {
+      sl_exec_need_rvalue(exec, chain, x->children_[0]);
+      sl_exec_need_rvalue(exec, chain, x->children_[1]);
+
+      if (x->children_[0]->base_regs_.kind_ == slrak_float) {
+        sl_exec_f_lt((sl_exec_row_t)chain, exec->exec_chain_reg_,
+                     BOOL_REG_PTR(x, 0),
+                     FLOAT_REG_PTR(x->children_[0], 0),
+                     FLOAT_REG_PTR(x->children_[1], 0));
+      }
+      else if (x->children_[0]->base_regs_.kind_ == slrak_int) {
+        sl_exec_i_lt((sl_exec_row_t)chain, exec->exec_chain_reg_,
+                     BOOL_REG_PTR(x, 0),
+                     INT_REG_PTR(x->children_[0], 0),
+                     INT_REG_PTR(x->children_[1], 0));
+      }
+      break;
+    }
+    case exop_le: {
+      sl_exec_need_rvalue(exec, chain, x->children_[0]);
+      sl_exec_need_rvalue(exec, chain, x->children_[1]);
+
+      if (x->children_[0]->base_regs_.kind_ == slrak_float) {
+        sl_exec_f_le((sl_exec_row_t)chain, exec->exec_chain_reg_,
+                     BOOL_REG_PTR(x, 0),
+                     FLOAT_REG_PTR(x->children_[0], 0),
+                     FLOAT_REG_PTR(x->children_[1], 0));
+      }
+      else if (x->children_[0]->base_regs_.kind_ == slrak_int) {
+        sl_exec_i_le((sl_exec_row_t)chain, exec->exec_chain_reg_,
+                     BOOL_REG_PTR(x, 0),
+                     INT_REG_PTR(x->children_[0], 0),
+                     INT_REG_PTR(x->children_[1], 0));
+      }
+      break;
+    }
+    case exop_ge: {
+      sl_exec_need_rvalue(exec, chain, x->children_[0]);
+      sl_exec_need_rvalue(exec, chain, x->children_[1]);
+
+      if (x->children_[0]->base_regs_.kind_ == slrak_float) {
+        sl_exec_f_ge((sl_exec_row_t)chain, exec->exec_chain_reg_,
+                     BOOL_REG_PTR(x, 0),
+                     FLOAT_REG_PTR(x->children_[0], 0),
+                     FLOAT_REG_PTR(x->children_[1], 0));
+      }
+      else if (x->children_[0]->base_regs_.kind_ == slrak_int) {
+        sl_exec_i_ge((sl_exec_row_t)chain, exec->exec_chain_reg_,
+                     BOOL_REG_PTR(x, 0),
+                     INT_REG_PTR(x->children_[0], 0),
+                     INT_REG_PTR(x->children_[1], 0));
+      }
+      break;
+    }
+    case exop_gt: {
+      sl_exec_need_rvalue(exec, chain, x->children_[0]);
+      sl_exec_need_rvalue(exec, chain, x->children_[1]);
+
+      if (x->children_[0]->base_regs_.kind_ == slrak_float) {
+        sl_exec_f_gt((sl_exec_row_t)chain, exec->exec_chain_reg_,
+                     BOOL_REG_PTR(x, 0),
+                     FLOAT_REG_PTR(x->children_[0], 0),
+                     FLOAT_REG_PTR(x->children_[1], 0));
+      }
+      else if (x->children_[0]->base_regs_.kind_ == slrak_int) {
+        sl_exec_i_gt((sl_exec_row_t)chain, exec->exec_chain_reg_,
+                     BOOL_REG_PTR(x, 0),
+                     INT_REG_PTR(x->children_[0], 0),
+                     INT_REG_PTR(x->children_[1], 0));
+      }
+      break;
+    }
+
+    case exop_eq: {
+      sl_exec_need_rvalue(exec, chain, x->children_[0]);
+      sl_exec_need_rvalue(exec, chain, x->children_[1]);
+
+      if (x->children_[0]->base_regs_.kind_ == slrak_float) {
+        sl_exec_f_eq((sl_exec_row_t)chain, exec->exec_chain_reg_,
+                     BOOL_REG_PTR(x, 0),
+                     FLOAT_REG_PTR(x->children_[0], 0),
+                     FLOAT_REG_PTR(x->children_[1], 0));
+      }
+      else if (x->children_[0]->base_regs_.kind_ == slrak_int) {
+        sl_exec_i_eq((sl_exec_row_t)chain, exec->exec_chain_reg_,
+                     BOOL_REG_PTR(x, 0),
+                     INT_REG_PTR(x->children_[0], 0),
+                     INT_REG_PTR(x->children_[1], 0));
+      }
+      break;
+    }
+    case exop_ne: {
+      sl_exec_need_rvalue(exec, chain, x->children_[0]);
+      sl_exec_need_rvalue(exec, chain, x->children_[1]);
+
+      if (x->children_[0]->base_regs_.kind_ == slrak_float) {
+        sl_exec_f_ne((sl_exec_row_t)chain, exec->exec_chain_reg_,
+                     BOOL_REG_PTR(x, 0),
+                     FLOAT_REG_PTR(x->children_[0], 0),
+                     FLOAT_REG_PTR(x->children_[1], 0));
+      }
+      else if (x->children_[0]->base_regs_.kind_ == slrak_int) {
+        sl_exec_i_ne((sl_exec_row_t)chain, exec->exec_chain_reg_,
+                     BOOL_REG_PTR(x, 0),
+                     INT_REG_PTR(x->children_[0], 0),
+                     INT_REG_PTR(x->children_[1], 0));
+      }
+      break;
+    }
+
+    case exop_logical_xor: {
+      sl_exec_need_rvalue(exec, chain, x->children_[0]);
+      sl_exec_need_rvalue(exec, chain, x->children_[1]);
+
+      sl_exec_logical_or((sl_exec_row_t)chain, exec->exec_chain_reg_,
+                     BOOL_REG_PTR(x, 0),
+                     BOOL_REG_PTR(x->children_[0], 0),
+                     BOOL_REG_PTR(x->children_[1], 0));
+      break;
+    }
+
+    case exop_assign: {
+      sl_exec_need_rvalue(exec, chain, x->children_[1]);
+
+      sl_reg_move(exec, chain, EXPR_RVALUE(x->children_[1]), NULL, &x->children_[0]->base_regs_, &x->children_[0]->offset_reg_);
+      break;
+    }
+
+    case exop_sequence: {
+      if (!sl_reg_alloc_are_equal(&x->base_regs_, &x->children_[1]->base_regs_)) {
+        sl_exec_need_rvalue(exec, chain, x->children_[1]);
+        sl_reg_move(exec, chain, EXPR_RVALUE(x->children_[1]), NULL, &x->base_regs_, NULL);
+      }
+      else {
+        /* x shares registers with second child, we're already done even if both are lvalues */
+      }
+      break;
+    }
+
+    case exop_field_selection: {
+      /* Field selection should be a no-op, however, if a parent of the field selection has determined
+       * a destination register, then it still needs a move. That's an edge case, in the common case
+       * this move will degrade into a no-op. */
+      size_t field_index = 0;
+      struct sl_expr *sx = x->children_[0];
+      struct sl_reg_alloc *child_field = &sx->base_regs_.v_.comp_.fields_[x->field_index_];
+      if (x->offset_reg_.kind_ != slrak_void) {
+        /* Check that the offset and base registers are the same for the child as they are for the
+         * exop_field_selection expression. This *should* be the case, as there is no way a parent
+         * could impose an offsetted base register on a child, and exop_field_selection won't put
+         * in an offset unless it is from its own child. */
+        if (x->offset_limit_ != sx->offset_limit_) {
+          assert(0);
+          return -1;
+        }
+        if (!sl_reg_alloc_are_equal(&x->offset_reg_, &sx->offset_reg_)) {
+          assert(0);
+          return -1;
+        }
+        if (!sl_reg_alloc_are_equal(&x->base_regs_, &sx->base_regs_)) {
+          assert(0);
+          return -1;
+        }
+        /* ok done, no copy needed. */
+      }
+      else {
+        /* Child not at an offset, just perform a move; this will likely be a no-op unless the
+         * parent of the exop_field_selection interfered during register allocation. */
+        sl_reg_move(exec, chain, child_field, NULL, &x->base_regs_, NULL);
+      }
+      break;
+    }
+
+    case exop_component_selection:
+      /* exop_component_selection is already pre-assigned into the right registers at compile-time */
+      break;
+    case exop_constructor: {
+      size_t ci;
+      for (ci = 0; ci < x->num_components_; ++ci) {
+        struct sl_component_selection *cs = x->swizzle_ + ci;
+        if (cs->parameter_index_ != -1) {
+          struct sl_expr *param = x->children_[cs->parameter_index_];
+
+          sl_reg_move_c2c(exec, chain,
+                          &param->base_regs_, &param->offset_reg_, cs->component_index_,
+                          &x->base_regs_, &x->offset_reg_, (int)ci);
+        }
+        else {
+          /* Initialize with a constant */
+          switch (cs->component_index_) {
+            case 0:
+              switch (cs->conversion_) {
+                case slcc_float_to_float:
+                case slcc_int_to_float:
+                case slcc_bool_to_float:
+                  sl_exec_f_init(chain, exec->exec_chain_reg_,
+                                 FLOAT_REG_PTR_NRV(&x->base_regs_, ci),
+                                 0.0f);
+                  break;
+                case slcc_float_to_int:
+                case slcc_int_to_int:
+                case slcc_bool_to_int:
+                  sl_exec_i_init(chain, exec->exec_chain_reg_,
+                                 INT_REG_PTR_NRV(&x->base_regs_, ci),
+                                 0);
+                  break;
+                case slcc_float_to_bool:
+                case slcc_int_to_bool:
+                case slcc_bool_to_bool:
+                  sl_exec_b_init(chain, exec->exec_chain_reg_,
+                                 BOOL_REG_PTR_NRV(&x->base_regs_, ci),
+                                 0);
+                  break;
+              }
+              break;
+            case 1:
+              switch (cs->conversion_) {
+                case slcc_float_to_float:
+                case slcc_int_to_float:
+                case slcc_bool_to_float:
+                  sl_exec_f_init(chain, exec->exec_chain_reg_,
+                                 FLOAT_REG_PTR_NRV(&x->base_regs_, ci),
+                                 1.0f);
+                  break;
+                case slcc_float_to_int:
+                case slcc_int_to_int:
+                case slcc_bool_to_int:
+                  sl_exec_i_init(chain, exec->exec_chain_reg_,
+                                 INT_REG_PTR_NRV(&x->base_regs_, ci),
+                                 1);
+                  break;
+                case slcc_float_to_bool:
+                case slcc_int_to_bool:
+                case slcc_bool_to_bool:
+                  sl_exec_b_init(chain, exec->exec_chain_reg_,
+                                 BOOL_REG_PTR_NRV(&x->base_regs_, ci),
+                                 1);
+                  break;
+              }
+              break;
+          }
+        }
+      }
+      break;
+    }
+
+    case exop_function_call:
+      x->function_->builtin_runtime_fn_(exec, chain, x);
+      break;
+
+    default:
+      break;
+  }
+  return 0;
+}
+
+/* Moves the arguments of function call x into the parameters, in the frame of the function (on top of the caller's.) */
+static void sl_exec_call_params(struct sl_execution *exec, uint32_t chain, struct sl_expr *x) {
+  struct sl_execution_frame *parent = exec->execution_frames_ + exec->num_execution_frames_ - 2;
+  struct sl_execution_frame *ef = exec->execution_frames_ + exec->num_execution_frames_ - 1;
+  size_t n;
+  /* Have to have equal number of children as we do parameters.. */
+  assert(ef->f_->num_parameters_ == x->num_children_);
+
+  for (n = 0; n < ef->f_->num_parameters_; ++n) {
+    struct sl_reg_alloc *param_ra = &ef->f_->parameters_[n].variable_->reg_alloc_;
+    sl_exec_need_rvalue(exec, chain, x->children_[n]);
+    struct sl_reg_alloc *call_arg_ra = EXPR_RVALUE(x->children_[n]);
+
+    sl_exec_move_param(exec, chain, ef, param_ra, parent, call_arg_ra);
+  }
 }
 
-static void sl_exec_need_rvalue(struct sl_execution *exec, uint32_t chain, struct sl_expr *x) {
-  sl_reg_move(exec, chain, &x->base_regs_, &x->offset_reg_, &x->rvalue_, NULL);
+/* Moves the value of return statement stmt into the result of function call x, the function's frame is on top. */
+static void sl_exec_return_value(struct sl_execution *exec, uint32_t chain, struct sl_stmt *stmt, struct sl_expr *x) {
+  sl_exec_need_rvalue(exec, chain, stmt->expr_);
+  sl_exec_move_param(exec, chain,
+                     exec->execution_frames_ + exec->num_execution_frames_ - 2, &x->base_regs_,
+                     exec->execution_frames_ + exec->num_execution_frames_ - 1, EXPR_RVALUE(stmt->expr_));
 }
 
-static void sl_exec_initialize_globals(struct sl_execution *exec) {
-  struct sl_variable *v;
-  v = exec->cu_->global_frame_.variables_;
-  if (v) {
-    do {
-      v = v->chain_;
+/* Copies back the "out" parameters of function call x and pops the function's frame */
+static void sl_exec_call_exit(struct sl_execution *exec, uint32_t chain, struct sl_expr *x) {
+  struct sl_execution_frame *func_frame = exec->execution_frames_ + exec->num_execution_frames_ - 1;
+  struct sl_execution_frame *parent_frame = exec->execution_frames_ + exec->num_execution_frames_ - 2;
 
-      if (v->is_externally_initialized_) {
-        /* Don't initialize attributes as the caller will have initialized them */
+  size_t n;
+  for (n = 0; n < func_frame->f_->num_parameters_; ++n) {
+    struct sl_parameter *param = func_frame->f_->parameters_ + n;
+    struct sl_reg_alloc *param_ra = &param->variable_->reg_alloc_;
+    struct sl_reg_alloc *call_arg_ra = EXPR_RVALUE(x->children_[n]);
+
+    struct sl_type *param_type = param->type_;
+    int qualifiers = sl_type_qualifiers(param_type);
+    if ((qualifiers & SL_PARAMETER_QUALIFIER_OUT) || (qualifiers & SL_PARAMETER_QUALIFIER_INOUT)) {
+      struct sl_expr *arg = x->children_[n];
+      sl_exec_move_param(exec, chain, parent_frame, call_arg_ra, func_frame, param_ra);
+      if (arg->offset_reg_.kind_ != slrak_void) {
+        /* Store rvalue into actual lvalue passed in to the arg; note that at this point the
+         * callee frame is still on top, so the move is across frames. */
+        sl_reg_move_crossframe(exec, chain,
+                               (int)(parent_frame - exec->execution_frames_), EXPR_RVALUE(arg), NULL,
+                               (int)(parent_frame - exec->execution_frames_), &arg->base_regs_, &arg->offset_reg_,
+                               1, 1, 1);
+      }
+    }
+  }
+  exec->num_execution_frames_--;
+}
+
+/* Runs f for the rows in exec_chain by replaying the schedule recorded by sl_exec_run(), leaving the results
+ * in the bootstrap execution point as walking the AST would. */
+static int sl_exec_replay(struct sl_execution *exec, struct sl_function *f, uint32_t exec_chain) {
+  int r;
+  size_t n;
+  r = sl_exec_push_main_frame(exec, f);
+  if (r) return r;
+  for (n = 0; n < exec->num_trace_steps_; ++n) {
+    struct sl_exec_trace_step *ts = exec->trace_steps_ + n;
+    struct sl_profile_node *pn = NULL;
+    uint64_t profile_start = 0;
+    if (exec->profile_ && (ts->kind_ != SLETK_GLOBAL)) {
+      if (ts->kind_ == SLETK_RETURN) {
+        pn = sl_profile_node(exec->profile_, ts->stmt_, &ts->stmt_->keyword_loc_);
       }
       else {
-        sl_exec_init_literal(exec, 0, &v->reg_alloc_, &v->value_, 0);
+        pn = sl_profile_node(exec->profile_, ts->expr_, &ts->expr_->op_loc_);
       }
-
-    } while (v != exec->cu_->global_frame_.variables_);
+      /* The exit of a call is part of the same invocation as its entry */
+      if (pn && (ts->kind_ != SLETK_CALL_EXIT)) sl_profile_count_rows(pn, exec->exec_chain_reg_, exec_chain);
+      profile_start = sl_profile_cycles();
+    }
+    switch (ts->kind_) {
+      case SLETK_GLOBAL:
+        sl_exec_init_literal(exec, 0, ts->dst_, ts->literal_, 0);
+        break;
+      case SLETK_MOVE:
+        sl_reg_move(exec, exec_chain, ts->src_, NULL, ts->dst_, NULL);
+        break;
+      case SLETK_LITERAL:
+        sl_exec_init_literal(exec, exec_chain, ts->dst_, ts->literal_, 0);
+        break;
+      case SLETK_EXPR:
+        r = sl_exec_expr_kernel(exec, exec_chain, ts->expr_);
+        if (r) return r;
+        break;
+      case SLETK_CALL: {
+        r = sl_exec_push_execution_frame(exec);
+        if (r) return r;
+        struct sl_execution_frame *ef = exec->execution_frames_ + exec->num_execution_frames_ - 1;
+        ef->f_ = ts->expr_->function_;
+        ef->local_float_offset_ = ts->local_float_offset_;
+        ef->local_int_offset_ = ts->local_int_offset_;
+        ef->local_bool_offset_ = ts->local_bool_offset_;
+        ef->local_sampler2D_offset_ = ts->local_sampler2D_offset_;
+        ef->local_samplerCube_offset_ = ts->local_samplerCube_offset_;
+        sl_exec_call_params(exec, exec_chain, ts->expr_);
+        break;
+      }
+      case SLETK_RETURN:
+        sl_exec_return_value(exec, exec_chain, ts->stmt_, ts->expr_);
+        break;
+      case SLETK_CALL_EXIT:
+        sl_exec_call_exit(exec, exec_chain, ts->expr_);
+        break;
+    }
+    if (pn) pn->cycles_ += sl_profile_cycles() - profile_start;
   }
+  /* All rows complete main, as they did when recording */
+  exec->execution_points_[0].enter_chain_ = SL_EXEC_NO_CHAIN;
+  exec->execution_points_[0].post_chain_ = exec_chain;
+  exec->execution_points_[0].alt_chain_ = SL_EXEC_NO_CHAIN;
+  exec->num_execution_points_ = 0;
+  return 0;
 }
 
-static int sl_exec_prepare_run(struct sl_execution *exec, struct sl_function *f, int exec_chain) {
-  int r = 0;
-  exec->num_execution_frames_ = 0;
-  r = sl_exec_push_execution_frame(exec);
+static int sl_exec_run_bytecode(struct sl_execution *exec, struct sl_function *f, int exec_chain) {
+  int r;
+  uint32_t survivors = SL_EXEC_NO_CHAIN, discarded = SL_EXEC_NO_CHAIN;
+  /* Establishes the frame for main and the bootstrap execution point that callers read the results from. */
+  r = sl_exec_prepare_run(exec, f, exec_chain);
   if (r) return r;
-
-  struct sl_execution_frame *ef = exec->execution_frames_;
-  ef->f_ = f;
-  ef->local_float_offset_ = (int)exec->cu_->global_frame_.ract_.rra_floats_.watermark_;
-  ef->local_int_offset_ = (int)exec->cu_->global_frame_.ract_.rra_ints_.watermark_;
-  ef->local_bool_offset_ = (int)exec->cu_->global_frame_.ract_.rra_bools_.watermark_;
-  ef->local_sampler2D_offset_ = (int)exec->cu_->global_frame_.ract_.rra_sampler2D_.watermark_;
-  ef->local_samplerCube_offset_ = (int)exec->cu_->global_frame_.ract_.rra_samplerCube_.watermark_;
-
-  r = sl_exec_push_bootstrap(exec, f, exec_chain, 0);
+  /* A variant specialized on the uniforms loaded is preferred, unless only generic native code is available;
+   * the AOT code cannot be profiled. */
+  if (exec->variant_ && exec->variant_->jit_) {
+    r = sl_jit_run(exec->variant_->jit_, exec, (uint32_t)exec_chain, &survivors, &discarded);
+  }
+  else if (exec->aot_ && (exec->interpreter_ == SLEI_JIT) && !exec->profile_) {
+    r = sl_aot_run(exec->aot_, exec, (uint32_t)exec_chain, &survivors, &discarded);
+  }
+  else if (exec->jit_) {
+    r = sl_jit_run(exec->jit_, exec, (uint32_t)exec_chain, &survivors, &discarded);
+  }
+  else {
+    r = sl_bytecode_run(exec->variant_ ? exec->variant_->bytecode_ : exec->bytecode_, exec, (uint32_t)exec_chain, &survivors, &discarded);
+  }
   if (r) return r;
-
+  exec->execution_points_[0].enter_chain_ = SL_EXEC_NO_CHAIN;
+  exec->execution_points_[0].post_chain_ = survivors;
+  exec->execution_points_[0].alt_chain_ = discarded;
+  exec->num_execution_points_ = 0;
   return 0;
 }
 
-int sl_exec_run(struct sl_execution *exec, struct sl_function *f, int exec_chain) {
+/* Returns the profile of the node of execution point ep, counting an invocation if ep is being entered; NULL for the
+ * bootstrap. */
+static struct sl_profile_node *sl_exec_profile_ep(struct sl_execution *exec, struct sl_execution_point *ep) {
+  struct sl_profile_node *pn;
+  if (ep->kind_ == SLEPK_STMT) {
+    pn = sl_profile_node(exec->profile_, ep->v_.stmt_, &ep->v_.stmt_->keyword_loc_);
+  }
+  else if (ep->kind_ == SLEPK_EXPR) {
+    pn = sl_profile_node(exec->profile_, ep->v_.expr_, &ep->v_.expr_->op_loc_);
+  }
+  else {
+    return NULL;
+  }
+  if (pn && (ep->enter_chain_ != SL_EXEC_NO_CHAIN)) {
+    /* Rows are counted before the node runs, it may split the chain */
+    sl_profile_count_rows(pn, exec->exec_chain_reg_, ep->enter_chain_);
+  }
+  return pn;
+}
+
+/* Runs f by walking its AST, using the stack of execution points; see sl_exec_run() */
+static int sl_exec_walk(struct sl_execution *exec, struct sl_function *f, int exec_chain) {
   int r;
   sl_exec_initialize_globals(exec);
   r = sl_exec_prepare_run(exec, f, exec_chain);
@@ -3626,6 +5623,12 @@ int sl_exec_run(struct sl_execution *exec, struct sl_function *f, int exec_chain
     size_t epi = exec->num_execution_points_ - 1;
     struct sl_execution_point *eps = exec->execution_points_;
 #define CHAIN_REF(x) (((uintptr_t)&(x)) - (uintptr_t)exec->execution_points_)
+    struct sl_profile_node *pn = NULL;
+    uint64_t profile_start = 0;
+    if (exec->profile_) {
+      pn = sl_exec_profile_ep(exec, eps + epi);
+      profile_start = sl_profile_cycles();
+    }
     if (eps[epi].kind_ == SLEPK_STMT) {
       if (eps[epi].enter_chain_ != SL_EXEC_NO_CHAIN) {
         switch (eps[epi].v_.stmt_->kind_) {
@@ -3765,6 +5768,8 @@ int sl_exec_run(struct sl_execution *exec, struct sl_function *f, int exec_chain
           case slsk_discard: {
             /* Drop whatever we're doing and re-join on the alt-chain of the bootstrap */
             assert(eps[0].kind_ == SLEPK_BOOTSTRAP);
+            /* The rows discarded skip the remainder of the schedule, so it cannot be replayed */
+            if (exec->trace_state_ == SLETS_RECORDING) exec->trace_state_ = SLETS_INVALID;
             eps[0].alt_chain_ = sl_exec_join_chains(exec, eps[0].alt_chain_, eps[epi].enter_chain_);
             eps[epi].enter_chain_ = SL_EXEC_NO_CHAIN;
             break;
@@ -3874,10 +5879,12 @@ int sl_exec_run(struct sl_execution *exec, struct sl_function *f, int exec_chain
             while (pepi) {
               if (eps[pepi].kind_ == SLEPK_EXPR) {
                 if (eps[pepi].v_.expr_->op_ == exop_function_call) {
-                  sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.stmt_->expr_);
-                  sl_exec_move_param(exec, eps[epi].revisit_chain_, 
-                                     exec->execution_frames_ + exec->num_execution_frames_ - 2, &eps[pepi].v_.expr_->base_regs_,
-                                     exec->execution_frames_ + exec->num_execution_frames_ - 1, EXPR_RVALUE(eps[epi].v_.stmt_->expr_));
+                  struct sl_exec_trace_step *ts = sl_exec_trace_append(exec, SLETK_RETURN, eps[epi].revisit_chain_);
+                  if (ts) {
+                    ts->expr_ = eps[pepi].v_.expr_;
+                    ts->stmt_ = eps[epi].v_.stmt_;
+                  }
+                  sl_exec_return_value(exec, eps[epi].revisit_chain_, eps[epi].v_.stmt_, eps[pepi].v_.expr_);
                   eps[pepi].alt_chain_ = sl_exec_join_chains(exec, eps[pepi].alt_chain_, eps[epi].revisit_chain_);
                   break;
                 }
@@ -3972,6 +5979,12 @@ int sl_exec_run(struct sl_execution *exec, struct sl_function *f, int exec_chain
             /* The value is already in the appropriate registers; do the move anyway, as, though
              * it will turn into a no-op, it reduces coupling. */
             assert((eps[epi].v_.expr_->offset_reg_.kind_ == slrak_void) && "variable sub-expression's lvalue should not be offset based");
+            struct sl_exec_trace_step *ts = sl_exec_trace_append(exec, SLETK_MOVE, eps[epi].enter_chain_);
+            if (ts) {
+              ts->expr_ = eps[epi].v_.expr_;
+              ts->src_ = &eps[epi].v_.expr_->variable_->reg_alloc_;
+              ts->dst_ = &eps[epi].v_.expr_->base_regs_;
+            }
             sl_reg_move(exec, eps[epi].enter_chain_, &eps[epi].v_.expr_->variable_->reg_alloc_, NULL, &eps[epi].v_.expr_->base_regs_, NULL);
 
             uint32_t *continuation_ep = (uint32_t *)(((char *)exec->execution_points_) + eps[epi].continue_chain_ptr_);
@@ -3983,6 +5996,12 @@ int sl_exec_run(struct sl_execution *exec, struct sl_function *f, int exec_chain
           case exop_literal: {
             /* Load constant value into the register */
             assert((eps[epi].v_.expr_->offset_reg_.kind_ == slrak_void) && "literal sub-expression's lvalue should not be offset based");
+            struct sl_exec_trace_step *ts = sl_exec_trace_append(exec, SLETK_LITERAL, eps[epi].enter_chain_);
+            if (ts) {
+              ts->expr_ = eps[epi].v_.expr_;
+              ts->dst_ = &eps[epi].v_.expr_->base_regs_;
+              ts->literal_ = &eps[epi].v_.expr_->literal_value_;
+            }
             sl_exec_init_literal(exec, eps[epi].enter_chain_, &eps[epi].v_.expr_->base_regs_, &eps[epi].v_.expr_->literal_value_, 0);
 
             uint32_t *continuation_ep = (uint32_t *)(((char *)exec->execution_points_) + eps[epi].continue_chain_ptr_);
@@ -4104,320 +6123,11 @@ int sl_exec_run(struct sl_execution *exec, struct sl_function *f, int exec_chain
       }
       else if (eps[epi].revisit_chain_ != SL_EXEC_NO_CHAIN) {
         switch (eps[epi].v_.expr_->op_) {
-          case exop_array_subscript: {
-            if (eps[epi].v_.expr_->children_[0]->base_regs_.kind_ == slrak_array) {
-              /* Take the fixed array size that this subscript indexes, if the array child has an offset_, multiply
-               * the offset value to form the new offset, then be done. We don't need to do anything on the lvalue
-               * itself as the register allocator has ensured it is the correct field subset. */
-              if (eps[epi].v_.expr_->children_[0]->offset_reg_.kind_  != slrak_void) {
-                if (&eps[epi].v_.expr_->children_[1]->offset_reg_.kind_ != slrak_void) {
-                  sl_exec_offset_load(exec, eps[epi].revisit_chain_, 
-                                      &eps[epi].v_.expr_->children_[1]->rvalue_,
-                                      &eps[epi].v_.expr_->children_[1]->base_regs_,
-                                      &eps[epi].v_.expr_->children_[1]->offset_reg_);
-                }
-              
-                /* New offset = old-offset * array-size + array-subscript-index */
-                sl_exec_i_mul_constant_and_add(eps[epi].revisit_chain_, exec->exec_chain_reg_,
-                                               INT_REG_PTR_NRV(&eps[epi].v_.expr_->offset_reg_, 0),
-                                               INT_REG_PTR_NRV(&eps[epi].v_.expr_->children_[0]->offset_reg_, 0),
-                                               INT_REG_PTR(eps[epi].v_.expr_->children_[1], 0),
-                                               (int64_t)eps[epi].v_.expr_->children_[0]->base_regs_.v_.array_.num_elements_);
-
-              }
-              else {
-                sl_reg_move(exec, eps[epi].revisit_chain_, 
-                            &eps[epi].v_.expr_->children_[1]->base_regs_, &eps[epi].v_.expr_->children_[1]->offset_reg_,
-                            &eps[epi].v_.expr_->offset_reg_, NULL);
-              }
-            }
-            else {
-              /* Not an array, base must be indirect and this array subscript is to access components */
-              sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_->children_[1]);
-
-              sl_exec_load_effective_reg_index(exec, eps[epi].revisit_chain_, &eps[epi].v_.expr_->base_regs_, &eps[epi].v_.expr_->children_[0]->base_regs_, EXPR_RVALUE(eps[epi].v_.expr_->children_[1]));
-            }
-            break;
-          }
-
-          case exop_post_inc:
-          case exop_post_dec: {
-            if (eps[epi].v_.expr_->children_[0]->offset_reg_.kind_ != slrak_void) {
-              /* Child is offsetted; load at an offset into the result */
-              sl_exec_offset_load(exec, eps[epi].revisit_chain_,
-                                  &eps[epi].v_.expr_->base_regs_,
-                                  &eps[epi].v_.expr_->children_[0]->base_regs_,
-                                  &eps[epi].v_.expr_->children_[0]->offset_reg_);
-              /* Inc/Decrement the value from the result into the R value of the child */
-              if (eps[epi].v_.expr_->op_ == exop_post_inc) {
-                sl_exec_increment(exec, eps[epi].revisit_chain_, &eps[epi].v_.expr_->children_[0]->rvalue_, EXPR_RVALUE(eps[epi].v_.expr_));
-              }
-              else /* (eps[epi].v_->expr_->op_ == exop_pre_dec) */ {
-                sl_exec_decrement(exec, eps[epi].revisit_chain_, &eps[epi].v_.expr_->children_[0]->rvalue_, EXPR_RVALUE(eps[epi].v_.expr_));
-              }
-              /* The result will now hold the original value, the R-value of the child now holds the
-               * incremented value. Store the R-Value of the child into the child's L-Value (at the offset). */
-              sl_exec_offset_store(exec, eps[epi].revisit_chain_,
-                                   &eps[epi].v_.expr_->children_[0]->base_regs_,
-                                   &eps[epi].v_.expr_->children_[0]->offset_reg_,
-                                   EXPR_RVALUE(eps[epi].v_.expr_->children_[0]));
-            }
-            else {
-              /* Move the pre-existing value into the result */
-              sl_reg_move(exec, eps[epi].revisit_chain_,
-                          &eps[epi].v_.expr_->children_[0]->base_regs_, NULL,
-                          &eps[epi].v_.expr_->base_regs_, NULL);
-
-              /* And then Inc/Decrement the value from the result (the pre-existing one) into the child's l-value */
-              if (eps[epi].v_.expr_->op_ == exop_post_inc) {
-                sl_exec_increment(exec, eps[epi].revisit_chain_, &eps[epi].v_.expr_->children_[0]->base_regs_, &eps[epi].v_.expr_->base_regs_);
-              }
-              else /* (eps[epi].v_->expr_->op_ == exop_post_dec) */ {
-                sl_exec_decrement(exec, eps[epi].revisit_chain_, &eps[epi].v_.expr_->children_[0]->base_regs_, &eps[epi].v_.expr_->base_regs_);
-              }
-            }
-            break;
-          }
-          case exop_pre_inc:
-          case exop_pre_dec: {
-            if (eps[epi].v_.expr_->children_[0]->offset_reg_.kind_ != slrak_void) {
-              /* Child is offsetted; load via rvalue */
-              sl_reg_move(exec, eps[epi].revisit_chain_,
-                          &eps[epi].v_.expr_->children_[0]->base_regs_,
-                          &eps[epi].v_.expr_->children_[0]->offset_reg_,
-                          &eps[epi].v_.expr_->children_[0]->rvalue_,
-                          NULL);
-              /* Inc/Decrement the rvalue into the result value */
-              if (eps[epi].v_.expr_->op_ == exop_pre_inc) {
-                sl_exec_increment(exec, eps[epi].revisit_chain_, &eps[epi].v_.expr_->base_regs_, EXPR_RVALUE(eps[epi].v_.expr_->children_[0]));
-              }
-              else /* (eps[epi].v_->expr_->op_ == exop_pre_dec) */ {
-                sl_exec_decrement(exec, eps[epi].revisit_chain_, &eps[epi].v_.expr_->base_regs_, EXPR_RVALUE(eps[epi].v_.expr_->children_[0]));
-              }
-              
-              /* Store the result value into the original child's l-value */
-              sl_reg_move(exec, eps[epi].revisit_chain_,
-                          EXPR_RVALUE(eps[epi].v_.expr_), NULL,
-                          &eps[epi].v_.expr_->children_[0]->base_regs_,
-                          &eps[epi].v_.expr_->children_[0]->offset_reg_);
-            }
-            else {
-              /* Child can be used directly. */
-              /* Inc/Decrement the child's value into the result value */
-              if (eps[epi].v_.expr_->op_ == exop_pre_inc) {
-                sl_exec_increment(exec, eps[epi].revisit_chain_, &eps[epi].v_.expr_->base_regs_, EXPR_RVALUE(eps[epi].v_.expr_->children_[0]));
-              }
-              else /* (eps[epi].v_->expr_->op_ == exop_pre_dec) */ {
-                sl_exec_decrement(exec, eps[epi].revisit_chain_, &eps[epi].v_.expr_->base_regs_, EXPR_RVALUE(eps[epi].v_.expr_->children_[0]));
-              }
-              /* Store the result value back into the original child's register */
-              sl_reg_move(exec, eps[epi].revisit_chain_,
-                          &eps[epi].v_.expr_->base_regs_, NULL,
-                          &eps[epi].v_.expr_->children_[0]->base_regs_, NULL);
-            }
-            break;
-          }
-          case exop_negate: {
-            sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_->children_[0]);
-
-            sl_exec_negate(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_, eps[epi].v_.expr_->children_[0]);
-            break;
-          }
-          case exop_logical_not: {
-            sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_->children_[0]);
-
-            sl_exec_logical_not(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_, eps[epi].v_.expr_->children_[0]);
-            break;
-          }
-
-          case exop_mul_assign:
-          case exop_multiply: {
-            sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_->children_[0]);
-            sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_->children_[1]);
-
-            sl_exec_mul(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_,
-                        eps[epi].v_.expr_->children_[0],
-                        eps[epi].v_.expr_->children_[1]);
-
-            if (eps[epi].v_.expr_->op_ == exop_mul_assign) {
-              /* Store the result value into the original child's l-value */
-              sl_reg_move(exec, eps[epi].revisit_chain_, EXPR_RVALUE(eps[epi].v_.expr_), NULL, &eps[epi].v_.expr_->children_[0]->base_regs_, &eps[epi].v_.expr_->children_[0]->offset_reg_);
-            }
-            break;
-          }
-          case exop_div_assign:
-          case exop_divide: {
-            sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_->children_[0]);
-            sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_->children_[1]);
-
-            sl_exec_div(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_,
-                        eps[epi].v_.expr_->children_[0],
-                        eps[epi].v_.expr_->children_[1]);
-            if (eps[epi].v_.expr_->op_ == exop_div_assign) {
-              /* Store the result value into the original child's l-value */
-              sl_reg_move(exec, eps[epi].revisit_chain_, EXPR_RVALUE(eps[epi].v_.expr_), NULL, &eps[epi].v_.expr_->children_[0]->base_regs_, &eps[epi].v_.expr_->children_[0]->offset_reg_);
-            }
-            break;
-          }
-
-          case exop_add_assign:
-          case exop_add: {
-            sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_->children_[0]);
-            sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_->children_[1]);
-
-            sl_exec_add(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_,
-                        eps[epi].v_.expr_->children_[0],
-                        eps[epi].v_.expr_->children_[1]);
-
-            if (eps[epi].v_.expr_->op_ == exop_add_assign) {
-              /* Store the result value into the original child's l-value */
-              sl_reg_move(exec, eps[epi].revisit_chain_, EXPR_RVALUE(eps[epi].v_.expr_), NULL, &eps[epi].v_.expr_->children_[0]->base_regs_, &eps[epi].v_.expr_->children_[0]->offset_reg_);
-            }
-
-            break;
-          }
-
-          case exop_sub_assign:
-          case exop_subtract: {
-            sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_->children_[0]);
-            sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_->children_[1]);
-
-            sl_exec_sub(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_,
-                        eps[epi].v_.expr_->children_[0],
-                        eps[epi].v_.expr_->children_[1]);
-
-            if (eps[epi].v_.expr_->op_ == exop_sub_assign) {
-              /* Store the result value into the original child's l-value */
-              sl_reg_move(exec, eps[epi].revisit_chain_, EXPR_RVALUE(eps[epi].v_.expr_), NULL, &eps[epi].v_.expr_->children_[0]->base_regs_, &eps[epi].v_.expr_->children_[0]->offset_reg_);
-            }
-            break;
-          }
-
-          case exop_lt: {
-            sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_->children_[0]);
-            sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_->children_[1]);
-
-            if (eps[epi].v_.expr_->children_[0]->base_regs_.kind_ == slrak_float) {
-              sl_exec_f_lt((uint8_t)eps[epi].revisit_chain_, exec->exec_chain_reg_, 
-                           BOOL_REG_PTR(eps[epi].v_.expr_, 0),
-                           FLOAT_REG_PTR(eps[epi].v_.expr_->children_[0], 0),
-                           FLOAT_REG_PTR(eps[epi].v_.expr_->children_[1], 0));
-            }
-            else if (eps[epi].v_.expr_->children_[0]->base_regs_.kind_ == slrak_int) {
-              sl_exec_i_lt((uint8_t)eps[epi].revisit_chain_, exec->exec_chain_reg_, 
-                           BOOL_REG_PTR(eps[epi].v_.expr_, 0),
-                           INT_REG_PTR(eps[epi].v_.expr_->children_[0], 0),
-                           INT_REG_PTR(eps[epi].v_.expr_->children_[1], 0));
-            }
-            break;
-          }
-          case exop_le: {
-            sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_->children_[0]);
-            sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_->children_[1]);
-
-            if (eps[epi].v_.expr_->children_[0]->base_regs_.kind_ == slrak_float) {
-              sl_exec_f_le((uint8_t)eps[epi].revisit_chain_, exec->exec_chain_reg_, 
-                           BOOL_REG_PTR(eps[epi].v_.expr_, 0),
-                           FLOAT_REG_PTR(eps[epi].v_.expr_->children_[0], 0),
-                           FLOAT_REG_PTR(eps[epi].v_.expr_->children_[1], 0));
-            }
-            else if (eps[epi].v_.expr_->children_[0]->base_regs_.kind_ == slrak_int) {
-              sl_exec_i_le((uint8_t)eps[epi].revisit_chain_, exec->exec_chain_reg_, 
-                           BOOL_REG_PTR(eps[epi].v_.expr_, 0),
-                           INT_REG_PTR(eps[epi].v_.expr_->children_[0], 0),
-                           INT_REG_PTR(eps[epi].v_.expr_->children_[1], 0));
-            }
-            break;
-          }
-          case exop_ge: {
-            sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_->children_[0]);
-            sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_->children_[1]);
-
-            if (eps[epi].v_.expr_->children_[0]->base_regs_.kind_ == slrak_float) {
-              sl_exec_f_ge((uint8_t)eps[epi].revisit_chain_, exec->exec_chain_reg_, 
-                           BOOL_REG_PTR(eps[epi].v_.expr_, 0),
-                           FLOAT_REG_PTR(eps[epi].v_.expr_->children_[0], 0),
-                           FLOAT_REG_PTR(eps[epi].v_.expr_->children_[1], 0));
-            }
-            else if (eps[epi].v_.expr_->children_[0]->base_regs_.kind_ == slrak_int) {
-              sl_exec_i_ge((uint8_t)eps[epi].revisit_chain_, exec->exec_chain_reg_, 
-                           BOOL_REG_PTR(eps[epi].v_.expr_, 0),
-                           INT_REG_PTR(eps[epi].v_.expr_->children_[0], 0),
-                           INT_REG_PTR(eps[epi].v_.expr_->children_[1], 0));
-            }
-            break;
-          }
-          case exop_gt: {
-            sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_->children_[0]);
-            sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_->children_[1]);
-
-            if (eps[epi].v_.expr_->children_[0]->base_regs_.kind_ == slrak_float) {
-              sl_exec_f_gt((uint8_t)eps[epi].revisit_chain_, exec->exec_chain_reg_, 
-                           BOOL_REG_PTR(eps[epi].v_.expr_, 0),
-                           FLOAT_REG_PTR(eps[epi].v_.expr_->children_[0], 0),
-                           FLOAT_REG_PTR(eps[epi].v_.expr_->children_[1], 0));
-            }
-            else if (eps[epi].v_.expr_->children_[0]->base_regs_.kind_ == slrak_int) {
-              sl_exec_i_gt((uint8_t)eps[epi].revisit_chain_, exec->exec_chain_reg_, 
-                           BOOL_REG_PTR(eps[epi].v_.expr_, 0),
-                           INT_REG_PTR(eps[epi].v_.expr_->children_[0], 0),
-                           INT_REG_PTR(eps[epi].v_.expr_->children_[1], 0));
-            }
-            break;
-          }
-
-          case exop_eq: {
-            sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_->children_[0]);
-            sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_->children_[1]);
-
-            if (eps[epi].v_.expr_->children_[0]->base_regs_.kind_ == slrak_float) {
-              sl_exec_f_eq((uint8_t)eps[epi].revisit_chain_, exec->exec_chain_reg_, 
-                           BOOL_REG_PTR(eps[epi].v_.expr_, 0),
-                           FLOAT_REG_PTR(eps[epi].v_.expr_->children_[0], 0),
-                           FLOAT_REG_PTR(eps[epi].v_.expr_->children_[1], 0));
-            }
-            else if (eps[epi].v_.expr_->children_[0]->base_regs_.kind_ == slrak_int) {
-              sl_exec_i_eq((uint8_t)eps[epi].revisit_chain_, exec->exec_chain_reg_, 
-                           BOOL_REG_PTR(eps[epi].v_.expr_, 0),
-                           INT_REG_PTR(eps[epi].v_.expr_->children_[0], 0),
-                           INT_REG_PTR(eps[epi].v_.expr_->children_[1], 0));
-            }
-            break;
-          }
-          case exop_ne: {
-            sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_->children_[0]);
-            sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_->children_[1]);
-
-            if (eps[epi].v_.expr_->children_[0]->base_regs_.kind_ == slrak_float) {
-              sl_exec_f_ne((uint8_t)eps[epi].revisit_chain_, exec->exec_chain_reg_, 
-                           BOOL_REG_PTR(eps[epi].v_.expr_, 0),
-                           FLOAT_REG_PTR(eps[epi].v_.expr_->children_[0], 0),
-                           FLOAT_REG_PTR(eps[epi].v_.expr_->children_[1], 0));
-            }
-            else if (eps[epi].v_.expr_->children_[0]->base_regs_.kind_ == slrak_int) {
-              sl_exec_i_ne((uint8_t)eps[epi].revisit_chain_, exec->exec_chain_reg_, 
-                           BOOL_REG_PTR(eps[epi].v_.expr_, 0),
-                           INT_REG_PTR(eps[epi].v_.expr_->children_[0], 0),
-                           INT_REG_PTR(eps[epi].v_.expr_->children_[1], 0));
-            }
-            break;
-          }
-
-          case exop_logical_xor: {
-            sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_->children_[0]);
-            sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_->children_[1]);
-
-            sl_exec_logical_or((uint8_t)eps[epi].revisit_chain_, exec->exec_chain_reg_,
-                           BOOL_REG_PTR(eps[epi].v_.expr_, 0),
-                           BOOL_REG_PTR(eps[epi].v_.expr_->children_[0], 0),
-                           BOOL_REG_PTR(eps[epi].v_.expr_->children_[1], 0));
-            break;
-          }
-
-          case exop_assign: {
-            sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_->children_[1]);
-
-            sl_reg_move(exec, eps[epi].revisit_chain_, EXPR_RVALUE(eps[epi].v_.expr_->children_[1]), NULL, &eps[epi].v_.expr_->children_[0]->base_regs_, &eps[epi].v_.expr_->children_[0]->offset_reg_);
+          default: {
+            struct sl_exec_trace_step *ts = sl_exec_trace_append(exec, SLETK_EXPR, eps[epi].revisit_chain_);
+            if (ts) ts->expr_ = eps[epi].v_.expr_;
+            r = sl_exec_expr_kernel(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_);
+            if (r) return r;
             break;
           }
 
@@ -4470,16 +6180,6 @@ int sl_exec_run(struct sl_execution *exec, struct sl_function *f, int exec_chain
             break;
           }
 
-          case exop_sequence: {
-            if (!sl_reg_alloc_are_equal(&eps[epi].v_.expr_->base_regs_, &eps[epi].v_.expr_->children_[1]->base_regs_)) {
-              sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_->children_[1]);
-              sl_reg_move(exec, eps[epi].revisit_chain_, EXPR_RVALUE(eps[epi].v_.expr_->children_[1]), NULL, &eps[epi].v_.expr_->base_regs_, NULL);
-            }
-            else {
-              /* eps[epi].v_.expr_ shares registers with second child, we're already done even if both are lvalues */
-            }
-          }
-
           case exop_conditional: {
             sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_->children_[0]);
 
@@ -4497,117 +6197,13 @@ int sl_exec_run(struct sl_execution *exec, struct sl_function *f, int exec_chain
             break;
           }
 
-          case exop_field_selection: {
-            /* Field selection should be a no-op, however, if a parent of the field selection has determined
-             * a destination register, then it still needs a move. That's an edge case, in the common case
-             * this move will degrade into a no-op. */
-            size_t field_index = 0;
-            struct sl_expr *x = eps[epi].v_.expr_;
-            struct sl_expr *sx = eps[epi].v_.expr_->children_[0];
-            struct sl_reg_alloc *child_field = &sx->base_regs_.v_.comp_.fields_[x->field_index_];
-            if (x->offset_reg_.kind_ != slrak_void) {
-              /* Check that the offset and base registers are the same for the child as they are for the
-               * exop_field_selection expression. This *should* be the case, as there is no way a parent
-               * could impose an offsetted base register on a child, and exop_field_selection won't put
-               * in an offset unless it is from its own child. */
-              if (x->offset_limit_ != sx->offset_limit_) {
-                assert(0);
-                return -1;
-              }
-              if (!sl_reg_alloc_are_equal(&x->offset_reg_, &sx->offset_reg_)) {
-                assert(0);
-                return -1;
-              }
-              if (!sl_reg_alloc_are_equal(&x->base_regs_, &sx->base_regs_)) {
-                assert(0);
-                return -1;
-              }
-              /* ok done, no copy needed. */
-            }
-            else {
-              /* Child not at an offset, just perform a move; this will likely be a no-op unless the
-               * parent of the exop_field_selection interfered during register allocation. */
-              sl_reg_move(exec, eps[epi].revisit_chain_, child_field, NULL, &x->base_regs_, NULL);
-            }
-            break;
-          }
-
-          case exop_component_selection:
-            /* exop_component_selection is already pre-assigned into the right registers at compile-time */
-            break;
-          case exop_constructor: {
-            size_t ci; 
-            for (ci = 0; ci < eps[epi].v_.expr_->num_components_; ++ci) {
-              struct sl_component_selection *cs = eps[epi].v_.expr_->swizzle_ + ci;
-              if (cs->parameter_index_ != -1) {
-                struct sl_expr *param = eps[epi].v_.expr_->children_[cs->parameter_index_];
-
-                sl_reg_move_c2c(exec, eps[epi].revisit_chain_, 
-                                &param->base_regs_, &param->offset_reg_, cs->component_index_,
-                                &eps[epi].v_.expr_->base_regs_, &eps[epi].v_.expr_->offset_reg_, (int)ci);
-              }
-              else {
-                /* Initialize with a constant */
-                switch (cs->component_index_) {
-                  case 0:
-                    switch (cs->conversion_) {
-                      case slcc_float_to_float:
-                      case slcc_int_to_float:
-                      case slcc_bool_to_float:
-                        sl_exec_f_init(eps[epi].revisit_chain_, exec->exec_chain_reg_, 
-                                       FLOAT_REG_PTR_NRV(&eps[epi].v_.expr_->base_regs_, ci),
-                                       0.0f);
-                        break;
-                      case slcc_float_to_int:
-                      case slcc_int_to_int:
-                      case slcc_bool_to_int:
-                        sl_exec_i_init(eps[epi].revisit_chain_, exec->exec_chain_reg_, 
-                                       INT_REG_PTR_NRV(&eps[epi].v_.expr_->base_regs_, ci),
-                                       0);
-                        break;
-                      case slcc_float_to_bool:
-                      case slcc_int_to_bool:
-                      case slcc_bool_to_bool:
-                        sl_exec_b_init(eps[epi].revisit_chain_, exec->exec_chain_reg_, 
-                                       BOOL_REG_PTR_NRV(&eps[epi].v_.expr_->base_regs_, ci),
-                                       0);
-                        break;
-                    }
-                    break;
-                  case 1:
-                    switch (cs->conversion_) {
-                      case slcc_float_to_float:
-                      case slcc_int_to_float:
-                      case slcc_bool_to_float:
-                        sl_exec_f_init(eps[epi].revisit_chain_, exec->exec_chain_reg_, 
-                                       FLOAT_REG_PTR_NRV(&eps[epi].v_.expr_->base_regs_, ci),
-                                       1.0f);
-                        break;
-                      case slcc_float_to_int:
-                      case slcc_int_to_int:
-                      case slcc_bool_to_int:
-                        sl_exec_i_init(eps[epi].revisit_chain_, exec->exec_chain_reg_, 
-                                       INT_REG_PTR_NRV(&eps[epi].v_.expr_->base_regs_, ci),
-                                       1);
-                        break;
-                      case slcc_float_to_bool:
-                      case slcc_int_to_bool:
-                      case slcc_bool_to_bool:
-                        sl_exec_b_init(eps[epi].revisit_chain_, exec->exec_chain_reg_, 
-                                       BOOL_REG_PTR_NRV(&eps[epi].v_.expr_->base_regs_, ci),
-                                       1);
-                        break;
-                    }
-                    break;
-                }
-              }
-            }
-            break;
-          }
 
           case exop_function_call: {
             if (eps[epi].v_.expr_->function_->builtin_runtime_fn_) {
-              eps[epi].v_.expr_->function_->builtin_runtime_fn_(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_);
+              struct sl_exec_trace_step *ts = sl_exec_trace_append(exec, SLETK_EXPR, eps[epi].revisit_chain_);
+              if (ts) ts->expr_ = eps[epi].v_.expr_;
+              r = sl_exec_expr_kernel(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_);
+              if (r) return r;
             }
             else {
               r = sl_exec_push_execution_frame(exec);
@@ -4615,10 +6211,6 @@ int sl_exec_run(struct sl_execution *exec, struct sl_function *f, int exec_chain
               struct sl_execution_frame *parent = exec->execution_frames_ + exec->num_execution_frames_ - 2;
               struct sl_execution_frame *ef = exec->execution_frames_ + exec->num_execution_frames_ - 1;
               ef->f_ = eps[epi].v_.expr_->function_;
-            
-              size_t n;
-              /* Have to have equal number of children as we do parameters.. */
-              assert(ef->f_->num_parameters_ == eps[epi].v_.expr_->num_children_);
 
               /* Establish new frame */
               ef->local_float_offset_ += (int)parent->f_->frame_.ract_.rra_floats_.watermark_;
@@ -4627,13 +6219,16 @@ int sl_exec_run(struct sl_execution *exec, struct sl_function *f, int exec_chain
               ef->local_sampler2D_offset_ += (int)parent->f_->frame_.ract_.rra_sampler2D_.watermark_;
               ef->local_samplerCube_offset_ += (int)parent->f_->frame_.ract_.rra_samplerCube_.watermark_;
 
-              for (n = 0; n < ef->f_->num_parameters_; ++n) {
-                struct sl_reg_alloc *param_ra = &ef->f_->parameters_[n].variable_->reg_alloc_;
-                sl_exec_need_rvalue(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_->children_[n]);
-                struct sl_reg_alloc *call_arg_ra = EXPR_RVALUE(eps[epi].v_.expr_->children_[n]);
-              
-                sl_exec_move_param(exec, eps[epi].revisit_chain_, ef, param_ra, parent, call_arg_ra);
+              struct sl_exec_trace_step *ts = sl_exec_trace_append(exec, SLETK_CALL, eps[epi].revisit_chain_);
+              if (ts) {
+                ts->expr_ = eps[epi].v_.expr_;
+                ts->local_float_offset_ = ef->local_float_offset_;
+                ts->local_int_offset_ = ef->local_int_offset_;
+                ts->local_bool_offset_ = ef->local_bool_offset_;
+                ts->local_sampler2D_offset_ = ef->local_sampler2D_offset_;
+                ts->local_samplerCube_offset_ = ef->local_samplerCube_offset_;
               }
+              sl_exec_call_params(exec, eps[epi].revisit_chain_, eps[epi].v_.expr_);
 
               r = sl_exec_push_stmt(exec, ef->f_->body_, eps[epi].revisit_chain_, CHAIN_REF(eps[epi].alt_chain_));
               if (r) return r;
@@ -4684,29 +6279,9 @@ int sl_exec_run(struct sl_execution *exec, struct sl_function *f, int exec_chain
           }
           case exop_function_call: {
             /* Copy back the "out" parameters and pop the function's frame */
-            struct sl_execution_frame *func_frame = exec->execution_frames_ + exec->num_execution_frames_ - 1;
-            struct sl_execution_frame *parent_frame = exec->execution_frames_ + exec->num_execution_frames_ - 2;
-
-            size_t n;
-            for (n = 0; n < func_frame->f_->num_parameters_; ++n) {
-              struct sl_parameter *param = func_frame->f_->parameters_ + n;
-              struct sl_reg_alloc *param_ra = &param->variable_->reg_alloc_;
-              struct sl_reg_alloc *call_arg_ra = EXPR_RVALUE(eps[epi].v_.expr_->children_[n]);
-
-              struct sl_type *param_type = param->type_;
-              int qualifiers = sl_type_qualifiers(param_type);
-              if ((qualifiers & SL_PARAMETER_QUALIFIER_OUT) && (qualifiers & SL_PARAMETER_QUALIFIER_INOUT)) {
-                sl_exec_move_param(exec, eps[epi].revisit_chain_, parent_frame, call_arg_ra, func_frame, param_ra);
-                if (eps[epi].v_.expr_->offset_reg_.kind_ != slrak_void) {
-                  /* Store rvalue into actual lvalue passed in to the arg */
-                  sl_exec_offset_store(exec, eps[epi].alt_chain_, 
-                                       &eps[epi].v_.expr_->base_regs_, &eps[epi].v_.expr_->offset_reg_, 
-                                       EXPR_RVALUE(eps[epi].v_.expr_));
-                }
-              }
-            }
-            exec->num_execution_frames_--;
-
+            struct sl_exec_trace_step *ts = sl_exec_trace_append(exec, SLETK_CALL_EXIT, eps[epi].alt_chain_);
+            if (ts) ts->expr_ = eps[epi].v_.expr_;
+            sl_exec_call_exit(exec, eps[epi].alt_chain_, eps[epi].v_.expr_);
             break;
           }
         }
@@ -4733,11 +6308,40 @@ int sl_exec_run(struct sl_execution *exec, struct sl_function *f, int exec_chain
       /* Invalid execution point kind */
       assert(0);
     }
+    if (pn) pn->cycles_ += sl_profile_cycles() - profile_start;
   }
 
   return 0;
 }
 
+int sl_exec_run(struct sl_execution *exec, struct sl_function *f, int exec_chain) {
+  int r;
+  if (exec->profile_) exec->profile_->num_runs_++;
+  if ((exec->interpreter_ != SLEI_AST) && exec->bytecode_ && (exec->bytecode_->f_ == f)) {
+    return sl_exec_run_bytecode(exec, f, exec_chain);
+  }
+  if ((exec->trace_state_ == SLETS_READY) && (exec->trace_f_ == f)) {
+    return sl_exec_replay(exec, f, (uint32_t)exec_chain);
+  }
+  if (exec->trace_state_ == SLETS_NONE) {
+    exec->trace_state_ = SLETS_RECORDING;
+    exec->trace_f_ = f;
+    exec->trace_chain_ = (uint32_t)exec_chain;
+    exec->num_trace_steps_ = 0;
+  }
+  r = sl_exec_walk(exec, f, exec_chain);
+  if (exec->trace_state_ == SLETS_RECORDING) {
+    /* The schedule is complete if all rows made it through to the end of main */
+    if (!r && (exec->execution_points_[0].post_chain_ == exec->trace_chain_) && (exec->execution_points_[0].alt_chain_ == SL_EXEC_NO_CHAIN)) {
+      exec->trace_state_ = SLETS_READY;
+    }
+    else {
+      exec->trace_state_ = SLETS_INVALID;
+    }
+  }
+  return r;
+}
+
 void sl_exec_debug_dump_builtin(struct sl_execution *exec, int exec_chain, struct sl_expr *x) {
   sl_exec_need_rvalue(exec, exec_chain, x->children_[0]);
 
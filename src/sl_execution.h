@@ -20,10 +20,94 @@
 extern "C" {
 #endif
 
+/* Number of rows (e.g. fragments) executed in a single batch; the per-batch overhead of interpreting the
+ * shader is amortized over these. Can be overridden at build time with a multiple of 64 up to 65536, e.g.
+ * /DSL_EXEC_CHAIN_MAX_NUM_ROWS=1024; above 256 rows, row indices and execution chain deltas widen from 8
+ * to 16 bits. */
+#ifndef SL_EXEC_CHAIN_MAX_NUM_ROWS
 #define SL_EXEC_CHAIN_MAX_NUM_ROWS 256
+#endif
+
+#if (SL_EXEC_CHAIN_MAX_NUM_ROWS % 64) || (SL_EXEC_CHAIN_MAX_NUM_ROWS > 65536)
+#error SL_EXEC_CHAIN_MAX_NUM_ROWS must be a multiple of 64, and at most 65536
+#endif
+
+/* Row index within a batch, and the type of the execution chain column's deltas. The SL_EXEC_CHAIN_RUN_OF_4/8/16
+ * macros test whether the chain at row continues through the next 3, 7 or 15 rows, that is, whether it has 4, 8
+ * or 16 consecutive rows starting at row; row should be aligned to the run length. */
+#if SL_EXEC_CHAIN_MAX_NUM_ROWS <= 256
+typedef uint8_t sl_exec_row_t;
+#define SL_EXEC_CHAIN_RUN_OF_4(chain_column, row) ((*(uint32_t *)((chain_column) + (row)) & 0xFFFFFF) == 0x010101)
+#define SL_EXEC_CHAIN_RUN_OF_8(chain_column, row) ((*(uint64_t *)((chain_column) + (row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101ULL)
+#define SL_EXEC_CHAIN_RUN_OF_16(chain_column, row) ((*(uint64_t *)((chain_column) + (row)) == 0x0101010101010101ULL) && \
+                                                    ((*(uint64_t *)((chain_column) + (row) + 8) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101ULL))
+#else
+typedef uint16_t sl_exec_row_t;
+#define SL_EXEC_CHAIN_RUN_OF_4(chain_column, row) ((*(uint64_t *)((chain_column) + (row)) & 0xFFFFFFFFFFFFULL) == 0x000100010001ULL)
+#define SL_EXEC_CHAIN_RUN_OF_8(chain_column, row) ((*(uint64_t *)((chain_column) + (row)) == 0x0001000100010001ULL) && \
+                                                   ((*(uint64_t *)((chain_column) + (row) + 4) & 0xFFFFFFFFFFFFULL) == 0x000100010001ULL))
+#define SL_EXEC_CHAIN_RUN_OF_16(chain_column, row) ((*(uint64_t *)((chain_column) + (row)) == 0x0001000100010001ULL) && \
+                                                    (*(uint64_t *)((chain_column) + (row) + 4) == 0x0001000100010001ULL) && \
+                                                    (*(uint64_t *)((chain_column) + (row) + 8) == 0x0001000100010001ULL) && \
+                                                    ((*(uint64_t *)((chain_column) + (row) + 12) & 0xFFFFFFFFFFFFULL) == 0x000100010001ULL))
+#endif
+
+/* Width of the integer registers (sl_execution::int_regs_) in bits, 32 or 64; can be overridden at build time,
+ * e.g. /DSL_EXEC_INT_REG_BITS=64. GLSL ES 1.00 requires only the range (-2^16, 2^16) of highp int, so 32 bit
+ * lanes suffice, and fit twice as many rows per SIMD instruction and cache line as 64 bit ones. Like GLSL ES
+ * 1.00, we leave the result of integer arithmetic that overflows the register, and of converting a float
+ * outside its range to int, undefined; shaders staying within the range of highp int behave the same for
+ * either width. */
+#ifndef SL_EXEC_INT_REG_BITS
+#define SL_EXEC_INT_REG_BITS 32
+#endif
+
+#if SL_EXEC_INT_REG_BITS == 32
+typedef int32_t sl_exec_int_t;
+#elif SL_EXEC_INT_REG_BITS == 64
+typedef int64_t sl_exec_int_t;
+#else
+#error SL_EXEC_INT_REG_BITS must be 32 or 64
+#endif
 
 #define SL_EXEC_NO_CHAIN UINT32_MAX
 
+/* Default for sl_execution::batch_cache_budget_, in bytes */
+#define SL_EXEC_DEFAULT_BATCH_CACHE_BUDGET (256 * 1024)
+
+/* Default for sl_execution::inline_threshold_, in statements and expression nodes */
+#ifndef SL_EXEC_DEFAULT_INLINE_THRESHOLD
+#define SL_EXEC_DEFAULT_INLINE_THRESHOLD 64
+#endif
+
+/* Default for sl_execution::unroll_max_size_, in statements and expression nodes */
+#ifndef SL_EXEC_DEFAULT_UNROLL_MAX_SIZE
+#define SL_EXEC_DEFAULT_UNROLL_MAX_SIZE 512
+#endif
+
+/* Default for sl_execution::max_variants_ */
+#ifndef SL_EXEC_DEFAULT_MAX_VARIANTS
+#define SL_EXEC_DEFAULT_MAX_VARIANTS 4
+#endif
+
+/* Default for sl_execution::compact_density_, in percent */
+#ifndef SL_EXEC_DEFAULT_COMPACT_DENSITY
+#define SL_EXEC_DEFAULT_COMPACT_DENSITY 50
+#endif
+
+/* Most uniform registers a shader is specialized on, see sl_execution::specialized_ */
+#define SL_EXEC_MAX_SPECIALIZED_REGS 16
+
+/* Consecutive variant cache misses, each with a new value for a specialized uniform register, after which
+ * the shader stops specializing on that register, see sl_exec_select_variant() */
+#ifndef SL_EXEC_MAX_SPECIALIZED_MISSES
+#define SL_EXEC_MAX_SPECIALIZED_MISSES 4
+#endif
+
+/* Flags in sl_execution::float_uniform_flags_ */
+#define SL_EXEC_UNIFORM_SCALAR 1 /* the register belongs to a uniform, its value is in sl_execution::float_uniforms_ */
+#define SL_EXEC_UNIFORM_COLUMN 2 /* the uniform is also read as a column, so is broadcast to all rows of the register */
+
 /* pass in an expr and return the reg_alloc representing its r-value; whether the r-value is separate from the base_reg_
  * depends on whether it has an offset, or whether whether the base_reg_ is indirect, or whether context requires working
  * on a separate copy (e.g. assignment requires the rvalue to be distinct from the lvalue, in particular for multi-component
@@ -61,7 +145,49 @@ extern "C" {
 struct sl_stmt;
 struct sl_expr;
 struct sl_reg_allocator;
+struct sl_reg_alloc;
 struct ir_temp;
+struct sl_bytecode;
+struct sl_bytecode_source;
+struct sl_jit;
+struct sl_aot_shader;
+struct sl_ir_opt_constant;
+struct sl_expr_temp;
+struct sl_profile;
+
+typedef enum sl_execution_interpreter {
+  SLEI_JIT,      /* Run native code generated from the bytecode, if available (default) */
+  SLEI_BYTECODE, /* Run the SLIR bytecode of the function, if available */
+  SLEI_AST       /* Always walk the abstract syntax tree */
+} sl_execution_interpreter_t;
+
+typedef enum sl_execution_predication {
+  SLEP_ADAPTIVE, /* Per chain, row masks when the rows are dense enough, execution chains otherwise (default) */
+  SLEP_CHAINS,   /* Always walk the execution chains */
+  SLEP_MASKS     /* Row masks wherever the instruction has a masked kernel */
+} sl_execution_predication_t;
+
+typedef enum sl_execution_accuracy {
+  SLEA_STRICT, /* Transcendental builtins call libm (default) */
+  SLEA_SPEC    /* Transcendental builtins may use SIMD approximations to the minimum precision GLSL specifies */
+} sl_execution_accuracy_t;
+
+typedef enum sl_execution_trace_state {
+  SLETS_NONE,      /* No schedule yet, the next sl_exec_run() that walks the AST records it */
+  SLETS_RECORDING, /* sl_exec_run() is recording the schedule */
+  SLETS_READY,     /* The schedule is recorded, sl_exec_run() replays it instead of walking the AST */
+  SLETS_INVALID    /* The shader diverges (or tracing is disabled), sl_exec_run() always walks the AST */
+} sl_execution_trace_state_t;
+
+typedef enum sl_execution_trace_step_kind {
+  SLETK_GLOBAL,   /* Initialize a global variable from its literal */
+  SLETK_MOVE,     /* Move a variable into the registers of an exop_variable */
+  SLETK_LITERAL,  /* Load the value of an exop_literal */
+  SLETK_EXPR,     /* Perform the operator of an expression, see sl_exec_expr_kernel() */
+  SLETK_CALL,     /* Push the frame of a function call, and move the arguments into its parameters */
+  SLETK_RETURN,   /* Move the value of a return statement into the result of the function call */
+  SLETK_CALL_EXIT /* Copy out the out and inout parameters of a function call, and pop its frame */
+} sl_execution_trace_step_kind_t;
 
 typedef enum sl_execution_point_kind {
   SLEPK_NONE,
@@ -86,6 +212,21 @@ struct sl_execution_frame {
   struct ir_temp *continue_chain_;
   struct ir_temp *break_chain_;
   struct ir_temp *discard_chain_;
+
+  /* When converting to SL IR, function calls are inlined; these point to the frame of the caller
+   * and the exop_function_call expression in it (so return statements know where to copy the
+   * return value to), or NULL if the frame is not the frame of an inlined call. */
+  struct sl_execution_frame *caller_frame_;
+  struct sl_expr *call_expr_;
+
+  /* When converting to SL IR, calls to functions of at most this many statements and expression nodes,
+   * that only return at their end, are inlined directly into the caller's execution chain, without a
+   * return chain to join, see sl_ir_lower_function(). */
+  size_t inline_threshold_;
+
+  /* When converting to SL IR, for loops with a trip count known at compile time are unrolled if the
+   * iterations together are at most this many statements and expression nodes. */
+  size_t unroll_max_size_;
 };
 
 struct sl_execution_point {
@@ -145,10 +286,71 @@ struct sl_execution_point {
   } v_;
 };
 
+/* Step of the schedule recorded by sl_exec_run(), see sl_execution::trace_steps_ */
+struct sl_exec_trace_step {
+  sl_execution_trace_step_kind_t kind_;
+
+  /* The expression, for all but SLETK_GLOBAL; for SLETK_RETURN, the exop_function_call returned to, and stmt_
+   * the return statement. */
+  struct sl_expr *expr_;
+  struct sl_stmt *stmt_;
+
+  /* Registers moved from and to for SLETK_MOVE, registers and value loaded for SLETK_GLOBAL and SLETK_LITERAL */
+  struct sl_reg_alloc *src_;
+  struct sl_reg_alloc *dst_;
+  struct sl_expr_temp *literal_;
+
+  /* Offsets of the frame pushed by SLETK_CALL */
+  int local_float_offset_;
+  int local_int_offset_;
+  int local_bool_offset_;
+  int local_sampler2D_offset_;
+  int local_samplerCube_offset_;
+};
+
+/* Code for main, specialized on particular values of the uniforms in sl_execution::specialized_ */
+struct sl_exec_variant {
+  /* Hash of values_, and the values themselves, in the order of sl_execution::specialized_ */
+  uint64_t hash_;
+  struct sl_ir_opt_constant *values_;
+
+  /* Bytecode, and native code for it (or NULL, as for sl_execution::jit_.) bytecode_ is NULL if the variant
+   * could not be generated, draws with these values then run the generic code. */
+  struct sl_bytecode *bytecode_;
+  struct sl_jit *jit_;
+
+  /* sl_execution::variant_clock_ as of the last time the variant was selected, for LRU eviction */
+  uint64_t last_used_;
+};
+
+/* Statistics of the variant cache, see sl_exec_select_variant() */
+struct sl_exec_variant_stats {
+  size_t hits_;          /* selections that found their variant cached */
+  size_t failed_hits_;   /* selections that found their variant cached as failed (and run the generic code) */
+  size_t misses_;        /* selections that generated a new variant */
+  size_t evictions_;     /* variants discarded, least recently used first, to make room */
+  size_t failures_;      /* variants that could not be generated (and run the generic code) */
+  size_t unspecialized_; /* uniform registers no longer specialized on as their values kept changing */
+  size_t num_variants_;  /* variants currently cached */
+};
+
+/* Statistics of active row compaction, see sl_exec_take_compaction_stats() */
+struct sl_exec_compaction_stats {
+  size_t compactions_;    /* runs of kernels executed on compacted rows */
+  size_t rows_;           /* rows gathered, summed over the compactions */
+  size_t kernels_;        /* kernel instructions executed on compacted rows */
+  size_t columns_;        /* register columns gathered or scattered */
+};
+
 struct sl_execution {
   /* Compilation unit being executed */
   struct sl_compilation_unit *cu_;
 
+  /* If this is an execution context (see sl_exec_init_context()), the execution whose compiled program it runs:
+   * cu_, float_uniform_flags_, bytecode_, jit_, aot_ and variant_ are then shared with it and not freed by
+   * sl_exec_cleanup(). NULL if the execution owns its program. */
+  const struct sl_execution *program_;
+
   /* Maximum number of rows the execution has been allocated for */
   size_t max_num_rows_;
 
@@ -156,8 +358,9 @@ struct sl_execution {
   size_t dump_text_len_;
   char *dump_text_;
 
-  /* Slab allocation for registers */
+  /* Slab allocation for registers, slab_size_ bytes */
   void *slab_;
+  size_t slab_size_;
 
   /* Stack of all active execution points, the current execution point to be
    * executed is at the top of the stack. */
@@ -176,7 +379,7 @@ struct sl_execution {
    * as the sentinel value if this is the last row. Typically 1 if the chain
    * includes the next row down. Note that values may never be negative, 
    * consequently, chains are always in sorted order of their row. */
-  uint8_t *exec_chain_reg_;
+  sl_exec_row_t *exec_chain_reg_;
 
   /* Pointers to each of the registers (columns) of data, by scalar type (more
    * complex types are split out over these, e.g. a vec2 is two float registers) */
@@ -184,7 +387,7 @@ struct sl_execution {
   float **float_regs_;
 
   size_t num_int_regs_;
-  int64_t **int_regs_;
+  sl_exec_int_t **int_regs_;
 
   size_t num_bool_regs_;
   unsigned char **bool_regs_;
@@ -195,6 +398,146 @@ struct sl_execution {
   size_t num_sampler_cube_regs_;
   void ***sampler_cube_regs_;
 
+  /* SL_EXEC_UNIFORM_XXX flags for each of the float registers, and, for those that are SL_EXEC_UNIFORM_SCALAR,
+   * the value of the uniform. Uniforms are the same for all rows, so the bytecode reads them as scalars; only
+   * those registers also read as a column (SL_EXEC_UNIFORM_COLUMN) are allocated and broadcast to all rows,
+   * the float_regs_ of the others are NULL. Set up by sl_exec_prep(). */
+  uint8_t *float_uniform_flags_;
+  float *float_uniforms_;
+
+  /* The program whose uniforms the registers currently hold, see sl_program_load_uniforms_for_execution(); a
+   * shader may be shared by several programs. NULL when the registers are (re)allocated. */
+  void *uniforms_owner_;
+
+  /* Interpreter to use for sl_exec_run(); set from the AEX_SL_EXEC environment variable
+   * ("ast", "bytecode" or "jit") upon initialization. */
+  sl_execution_interpreter_t interpreter_;
+
+  /* How the bytecode interpreter tracks the rows to execute, see sl_bytecode_run(); set from the
+   * AEX_SL_PREDICATION environment variable ("chains", "masks" or "adaptive") upon initialization. */
+  sl_execution_predication_t predication_;
+
+  /* Accuracy of the sin, cos, exp, exp2, log, log2 and pow builtins, see struct sl_simd_kernels; set from the
+   * AEX_SL_ACCURACY environment variable ("strict" or "spec") upon initialization. */
+  sl_execution_accuracy_t accuracy_;
+
+  /* Number of bytes the registers of a single batch of rows should fit in, so a shader's working set stays
+   * in cache; shaders with many registers then run in narrower batches, see sl_exec_batch_num_rows(). 0 for
+   * no limit. Set from the AEX_SL_BATCH_CACHE_BUDGET environment variable upon initialization, defaulting to
+   * SL_EXEC_DEFAULT_BATCH_CACHE_BUDGET. */
+  size_t batch_cache_budget_;
+
+  /* SL_IR_OPT_XXX passes run over the SLIR before the bytecode is generated; set from the AEX_SL_OPT
+   * environment variable upon initialization, see sl_ir_opt_parse_passes(), defaulting to all passes. */
+  int ir_opt_passes_;
+
+  /* Non-zero if the SLIR is printed to stderr before and after optimization; set if the AEX_SL_OPT_DUMP
+   * environment variable is set (and not empty) upon initialization. */
+  int ir_opt_dump_;
+
+  /* Size threshold for inlining function calls directly into the caller's execution chain, see
+   * sl_execution_frame::inline_threshold_; set from the AEX_SL_INLINE_THRESHOLD environment variable upon
+   * initialization, defaulting to SL_EXEC_DEFAULT_INLINE_THRESHOLD. 0 disables direct inlining. */
+  size_t inline_threshold_;
+
+  /* Maximum size of an unrolled loop, see sl_execution_frame::unroll_max_size_; set from the
+   * AEX_SL_UNROLL_MAX_SIZE environment variable upon initialization, defaulting to
+   * SL_EXEC_DEFAULT_UNROLL_MAX_SIZE. 0 disables loop unrolling. */
+  size_t unroll_max_size_;
+
+  /* Bytecode for the "main" function of cu_, or NULL if it could not be generated, in which
+   * case sl_exec_run() falls back to walking the AST. */
+  struct sl_bytecode *bytecode_;
+
+  /* Native code for bytecode_, or NULL if not generated (interpreter_ is not SLEI_JIT, or the host
+   * is not supported), in which case sl_exec_run() falls back to interpreting the bytecode. */
+  struct sl_jit *jit_;
+
+  /* Ahead-of-time compiled code for bytecode_ from a module loaded by sl_aot_link(), or NULL. When
+   * available it takes precedence over jit_ (unless the interpreter_ is forced to SLEI_BYTECODE or SLEI_AST.) */
+  const struct sl_aot_shader *aot_;
+
+  /* Uniform registers the shader is specialized on, picked by sl_exec_prep(): those of the uniforms named by
+   * specialize_ or, by default, those of the bool and int uniforms that are not arrays, as these typically
+   * select features (and take few distinct values.) At most SL_EXEC_MAX_SPECIALIZED_REGS, none if there is no
+   * bytecode. Their values are those loaded as of the last sl_exec_select_variant(). specialized_misses_ counts,
+   * for each, the consecutive cache misses in which its value changed; a register reaching
+   * SL_EXEC_MAX_SPECIALIZED_MISSES is dropped from specialized_ so it no longer recompiles every draw. */
+  size_t num_specialized_;
+  struct sl_ir_opt_constant *specialized_;
+  unsigned int specialized_misses_[SL_EXEC_MAX_SPECIALIZED_REGS];
+
+  /* Cache of the variants generated for the values of specialized_, at most max_variants_ of them, and the
+   * variant selected for the values currently loaded, or NULL to run the generic bytecode_. */
+  size_t num_variants_;
+  struct sl_exec_variant *variants_;
+  struct sl_exec_variant *variant_;
+  uint64_t variant_clock_;
+  struct sl_exec_variant_stats variant_stats_;
+
+  /* Maximum number of variants cached, 0 disables specialization; set from the AEX_SL_VARIANTS environment
+   * variable upon initialization, defaulting to SL_EXEC_DEFAULT_MAX_VARIANTS. */
+  size_t max_variants_;
+
+  /* The AEX_SL_SPECIALIZE environment variable upon initialization, or NULL: "none" disables specialization,
+   * a comma separated list of uniform names (which may include float uniforms) replaces the default choice. */
+  const char *specialize_;
+
+  /* Schedule of sl_exec_run() walking the AST for trace_f_: the work it does, in order, with the registers and
+   * frame offsets resolved, recorded the first time it runs after sl_exec_prep(). Shaders without divergent flow
+   * of execution (nothing splits the execution chain, nothing is discarded) follow the same schedule for every
+   * batch, so later runs replay it without the execution point stack. The recording is dropped (and trace_state_
+   * becomes SLETS_INVALID) as soon as the execution chain splits. trace_chain_ is the chain recorded with. */
+  sl_execution_trace_state_t trace_state_;
+  struct sl_function *trace_f_;
+  uint32_t trace_chain_;
+  size_t num_trace_steps_;
+  size_t num_trace_steps_allocated_;
+  struct sl_exec_trace_step *trace_steps_;
+
+  /* Non-zero if schedules are recorded and replayed; set unless the AEX_SL_TRACE environment variable is "0"
+   * upon initialization. */
+  int trace_enabled_;
+
+  /* Hot-spot profile of the shader (see sl_profile.h), or NULL; allocated upon initialization if the AEX_SL_PROFILE
+   * environment variable is set, profile_path_ is its value: "stderr" writes the annotated listing to stderr, anything
+   * else names a file it is appended to. The listing is written when the shader is recompiled (see
+   * sl_exec_profile_source()) and by sl_exec_cleanup(). The AST walker charges each node as it visits it; the
+   * bytecode and the JIT charge each instruction to the node it was generated from (see sl_bytecode_source), and
+   * the AOT code, which has no hooks, is bypassed for the JIT while profiling. */
+  struct sl_profile *profile_;
+  const char *profile_path_;
+
+  /* State of sl_bytecode_profile_enter() and sl_bytecode_profile_leave(): the source of the instruction last
+   * entered (NULL at the start of a run), the index of its sl_profile_node (or SIZE_MAX if none) and the cycle
+   * count when it was entered. */
+  const struct sl_bytecode_source *bc_profile_source_;
+  size_t bc_profile_node_index_;
+  uint64_t bc_profile_start_;
+
+  /* Density, in percent, below which the bytecode interpreter compacts the rows of a sparse execution chain before
+   * running a series of kernels on it: the live rows of the registers the kernels touch are gathered into dense
+   * scratch columns, the kernels run over those in full groups of 8 rows, and the results are scattered back (see
+   * SLBC_COMPACT.) The density is the number of rows in the chain over the rows it spans. 0 disables compaction.
+   * Set from the AEX_SL_COMPACT_DENSITY environment variable upon initialization, defaulting to
+   * SL_EXEC_DEFAULT_COMPACT_DENSITY. */
+  size_t compact_density_;
+
+  /* Scratch memory for compaction: the rows gathered, the scratch columns and the register columns they stand
+   * in for. Grown as needed, compact_scratch_size_ bytes. */
+  void *compact_scratch_;
+  size_t compact_scratch_size_;
+  struct sl_exec_compaction_stats compaction_stats_;
+
+  /* Chain registers of the bytecode being run, and, when running with predication masks (see predication_), their
+   * rows as a bitmask of SL_BYTECODE_MASK_WORDS words and their SL_BYTECODE_CHAIN_XXX flags. Kept here rather than
+   * in the sl_bytecode so that several executions can run the same bytecode at once; grown as needed by
+   * sl_bytecode_reserve_chains(), room for num_bc_chains_allocated_ chains. */
+  size_t num_bc_chains_allocated_;
+  uint32_t *bc_chains_;
+  uint64_t *bc_masks_;
+  uint8_t *bc_chain_flags_;
+
   /* Temporary runtime register values used by texture mappers */
   float sampler_2d_projected_s_[SL_EXEC_CHAIN_MAX_NUM_ROWS];
   float sampler_2d_projected_t_[SL_EXEC_CHAIN_MAX_NUM_ROWS];
@@ -209,30 +552,267 @@ struct sl_exec_call_graph_results {
   size_t num_samplerCube_regs_;
 };
 
+/* Execution contexts for a number of workers running the same shader concurrently, one each; see
+ * sl_exec_pool_reset(). */
+struct sl_exec_pool {
+  /* The execution whose program the contexts run, NULL if there are none */
+  const struct sl_execution *exec_;
+
+  size_t num_contexts_;
+  struct sl_execution *contexts_;
+};
+
 
 void sl_exec_init(struct sl_execution *exec);
 void sl_exec_cleanup(struct sl_execution *exec);
 
+/* If profiling, writes the listing of the profile so far, and restarts it for source_length bytes of source,
+ * the shader about to be compiled, named name in the listing. Returns 0 upon success. */
+int sl_exec_profile_source(struct sl_execution *exec, const char *name, const char *source, size_t source_length);
+
 int sl_exec_prep(struct sl_execution *exec, struct sl_compilation_unit *cu);
 
 int sl_exec_allocate_registers_by_slab(struct sl_execution *exec, size_t max_num_rows);
 
+/* Initializes ctx as an execution context for exec, which must have been prepared (see sl_exec_prep()) and had
+ * its registers allocated. The context runs the compiled program of exec, sharing its compilation unit, bytecode
+ * and native code, but has registers, execution stacks and chains of its own, sized for the registers exec runs
+ * with (see sl_exec_get_register_counts()) and its max_num_rows_; so it may run on another thread at the same time
+ * as exec and its other contexts. Contexts do not profile. The context must be cleaned up (see sl_exec_cleanup())
+ * before exec is prepared again or cleaned up. Returns 0 upon success. */
+int sl_exec_init_context(struct sl_execution *ctx, const struct sl_execution *exec);
+
+/* Copies the registers of the execution ctx is a context for (holding its uniforms, see
+ * sl_program_load_uniforms_for_execution()) and its selected variant (see sl_exec_select_variant()) to ctx; call
+ * once those are loaded for a draw, before ctx runs for it. Returns 0 upon success. */
+int sl_exec_sync_context(struct sl_execution *ctx);
+
 int sl_exec_run(struct sl_execution *exec, struct sl_function *f, int exec_chain);
 
 uint32_t sl_exec_join_chains(struct sl_execution *exec, uint32_t a, uint32_t b);
 
+/* Splits chain "in" into the rows for which cond_column is non-zero (*ptrue_chain) and zero (*pfalse_chain). */
+void sl_exec_split_chains(struct sl_execution *exec, const unsigned char *cond_column, uint32_t in, uint32_t *ptrue_chain, uint32_t *pfalse_chain);
+
+/* Like sl_exec_split_chains(), but for a condition that is the same for all rows of the chain (see
+ * sl_expr_is_uniform()); only the first row is read and the chain is forwarded as a whole. */
+void sl_exec_split_chains_uniform(struct sl_execution *exec, const unsigned char *cond_column, uint32_t in, uint32_t *ptrue_chain, uint32_t *pfalse_chain);
+
+/* Kernels operating on a single column for all rows in the chain starting at row; shared between
+ * the AST walker and the bytecode interpreter. */
+void sl_exec_f_add(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, float * restrict result_column, const float * restrict left_column, const float * restrict right_column);
+void sl_exec_i_add(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, sl_exec_int_t * restrict result_column, const sl_exec_int_t * restrict left_column, const sl_exec_int_t * restrict right_column);
+void sl_exec_f_sub(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, float * restrict result_column, const float * restrict left_column, const float * restrict right_column);
+void sl_exec_i_sub(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, sl_exec_int_t * restrict result_column, const sl_exec_int_t * restrict left_column, const sl_exec_int_t * restrict right_column);
+void sl_exec_f_mul(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, float * restrict result_column, const float * restrict left_column, const float * restrict right_column);
+void sl_exec_i_mul(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, sl_exec_int_t * restrict result_column, const sl_exec_int_t * restrict left_column, const sl_exec_int_t * restrict right_column);
+void sl_exec_f_div(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, float * restrict result_column, const float * restrict left_column, const float * restrict right_column);
+void sl_exec_i_div(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, sl_exec_int_t * restrict result_column, const sl_exec_int_t * restrict left_column, const sl_exec_int_t * restrict right_column);
+void sl_exec_f_negate(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, float * restrict result_column, const float * restrict opd_column);
+void sl_exec_i_negate(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, sl_exec_int_t * restrict result_column, const sl_exec_int_t * restrict opd_column);
+void sl_exec_f_increment(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, float * restrict result_column, const float * restrict opd_column);
+void sl_exec_i_increment(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, sl_exec_int_t * restrict result_column, const sl_exec_int_t * restrict opd_column);
+void sl_exec_f_decrement(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, float * restrict result_column, const float * restrict opd_column);
+void sl_exec_i_decrement(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, sl_exec_int_t * restrict result_column, const sl_exec_int_t * restrict opd_column);
+void sl_exec_b_logical_not(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, unsigned char * restrict result_column, const unsigned char * restrict opd_column);
+void sl_exec_logical_or(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, unsigned char * restrict result_column, const unsigned char * restrict left_column, const unsigned char * restrict right_column);
+void sl_exec_f_lt(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, unsigned char * restrict result_column, const float * restrict left_column, const float * restrict right_column);
+void sl_exec_i_lt(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, unsigned char * restrict result_column, const sl_exec_int_t * restrict left_column, const sl_exec_int_t * restrict right_column);
+void sl_exec_f_le(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, unsigned char * restrict result_column, const float * restrict left_column, const float * restrict right_column);
+void sl_exec_i_le(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, unsigned char * restrict result_column, const sl_exec_int_t * restrict left_column, const sl_exec_int_t * restrict right_column);
+void sl_exec_f_gt(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, unsigned char * restrict result_column, const float * restrict left_column, const float * restrict right_column);
+void sl_exec_i_gt(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, unsigned char * restrict result_column, const sl_exec_int_t * restrict left_column, const sl_exec_int_t * restrict right_column);
+void sl_exec_f_ge(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, unsigned char * restrict result_column, const float * restrict left_column, const float * restrict right_column);
+void sl_exec_i_ge(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, unsigned char * restrict result_column, const sl_exec_int_t * restrict left_column, const sl_exec_int_t * restrict right_column);
+void sl_exec_f_eq(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, unsigned char * restrict result_column, const float * restrict left_column, const float * restrict right_column);
+void sl_exec_i_eq(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, unsigned char * restrict result_column, const sl_exec_int_t * restrict left_column, const sl_exec_int_t * restrict right_column);
+void sl_exec_b_eq(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, unsigned char * restrict result_column, const unsigned char * restrict left_column, const unsigned char * restrict right_column);
+void sl_exec_f_ne(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, unsigned char * restrict result_column, const float * restrict left_column, const float * restrict right_column);
+void sl_exec_i_ne(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, unsigned char * restrict result_column, const sl_exec_int_t * restrict left_column, const sl_exec_int_t * restrict right_column);
+void sl_exec_b_ne(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, unsigned char * restrict result_column, const unsigned char * restrict left_column, const unsigned char * restrict right_column);
+void sl_exec_f_init(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, float * restrict result_column, float value);
+void sl_exec_i_init(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, sl_exec_int_t * restrict result_column, sl_exec_int_t value);
+void sl_exec_b_init(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, unsigned char * restrict result_column, unsigned char value);
+void sl_exec_f_dot_product2(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, float * restrict result_column,
+                            const float * restrict left_0_column, const float * restrict left_1_column,
+                            const float * restrict right_0_column, const float * restrict right_1_column);
+void sl_exec_f_dot_product3(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, float * restrict result_column,
+                            const float * restrict left_0_column, const float * restrict left_1_column, const float * restrict left_2_column,
+                            const float * restrict right_0_column, const float * restrict right_1_column, const float * restrict right_2_column);
+void sl_exec_f_dot_product4(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, float * restrict result_column,
+                            const float * restrict left_0_column, const float * restrict left_1_column, const float * restrict left_2_column, const float * restrict left_3_column,
+                            const float * restrict right_0_column, const float * restrict right_1_column, const float * restrict right_2_column, const float * restrict right_3_column);
+/* Matrix product of column-major operands, for matN * vecN, vecN * matN and matN * matN: result column
+ * c * num_rows + r is the sum over k of left column k * num_rows + r times right column c * inner + k (a vector
+ * being a single column on the right, or a single row on the left.) Each group of rows loads every operand
+ * column once and stores every result column; results may be stored over the operands. Either operand may
+ * instead be given as left_scalars or right_scalars (its columns are then ignored), one value for all rows,
+ * as used by the bytecode for uniforms. */
+void sl_exec_f_matrix_product(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, int num_rows, int inner, int num_cols,
+                              float * const *result_columns, const float * const *left_columns, const float *left_scalars,
+                              const float * const *right_columns, const float *right_scalars);
+/* The float builtins max(), clamp() and mix() for the bytecode, see SLIR_MAX_F, SLIR_CLAMP_F and SLIR_MIX_F */
+void sl_exec_f_max(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, float * restrict result_column, const float * restrict left_column, const float * restrict right_column);
+void sl_exec_f_clamp(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, float * restrict result_column,
+                     const float * restrict first_column, const float * restrict second_column, const float * restrict third_column);
+void sl_exec_f_mix(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, float * restrict result_column,
+                   const float * restrict first_column, const float * restrict second_column, const float * restrict third_column);
+/* Superinstructions, see SLIR_MAD_F, SLIR_LERP_F, SLIR_DOTn_MAX_F and SLIR_DOTn_CLAMP_F: first * second + third,
+ * (second - first) * third + first, and the dot product bounded by lower_column and, unless it is NULL,
+ * upper_column. */
+void sl_exec_f_mad(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, float * restrict result_column,
+                   const float * restrict first_column, const float * restrict second_column, const float * restrict third_column);
+void sl_exec_f_lerp(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, float * restrict result_column,
+                    const float * restrict first_column, const float * restrict second_column, const float * restrict third_column);
+void sl_exec_f_dot_product2_clamp(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, float * restrict result_column,
+                                  const float * restrict left_0_column, const float * restrict left_1_column,
+                                  const float * restrict right_0_column, const float * restrict right_1_column,
+                                  const float * restrict lower_column, const float * restrict upper_column);
+void sl_exec_f_dot_product3_clamp(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, float * restrict result_column,
+                                  const float * restrict left_0_column, const float * restrict left_1_column, const float * restrict left_2_column,
+                                  const float * restrict right_0_column, const float * restrict right_1_column, const float * restrict right_2_column,
+                                  const float * restrict lower_column, const float * restrict upper_column);
+void sl_exec_f_dot_product4_clamp(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, float * restrict result_column,
+                                  const float * restrict left_0_column, const float * restrict left_1_column, const float * restrict left_2_column, const float * restrict left_3_column,
+                                  const float * restrict right_0_column, const float * restrict right_1_column, const float * restrict right_2_column, const float * restrict right_3_column,
+                                  const float * restrict lower_column, const float * restrict upper_column);
+void sl_exec_i_mul_constant_and_add(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, sl_exec_int_t * restrict result_column, const sl_exec_int_t * restrict left_column, const sl_exec_int_t * restrict right_column, sl_exec_int_t constant);
+
+/* Kernels with a scalar operand in place of a column, used by the bytecode for uniforms (see sl_execution::float_uniforms_);
+ * "_scalar" takes the scalar on the right, "scalar_" on the left. */
+void sl_exec_f_add_scalar(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, float * restrict result_column, const float * restrict left_column, float right);
+void sl_exec_f_sub_scalar(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, float * restrict result_column, const float * restrict left_column, float right);
+void sl_exec_f_scalar_sub(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, float * restrict result_column, float left, const float * restrict right_column);
+void sl_exec_f_mul_scalar(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, float * restrict result_column, const float * restrict left_column, float right);
+void sl_exec_f_div_scalar(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, float * restrict result_column, const float * restrict left_column, float right);
+void sl_exec_f_scalar_div(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, float * restrict result_column, float left, const float * restrict right_column);
+void sl_exec_f_scalar_dot_product2(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, float * restrict result_column,
+                                   float left_0, float left_1,
+                                   const float * restrict right_0_column, const float * restrict right_1_column);
+void sl_exec_f_scalar_dot_product3(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, float * restrict result_column,
+                                   float left_0, float left_1, float left_2,
+                                   const float * restrict right_0_column, const float * restrict right_1_column, const float * restrict right_2_column);
+void sl_exec_f_scalar_dot_product4(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, float * restrict result_column,
+                                   float left_0, float left_1, float left_2, float left_3,
+                                   const float * restrict right_0_column, const float * restrict right_1_column, const float * restrict right_2_column, const float * restrict right_3_column);
+/* Stores scalars[base + index_stepsize * index_column[row]] in result_column, for all rows in the chain. */
+void sl_exec_f_gather_scalars(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, float * restrict result_column,
+                              const float * restrict scalars, int base, const sl_exec_int_t * restrict index_column, int index_stepsize);
+
+/* Masked kernels, computing the rows set in mask (SL_EXEC_CHAIN_MAX_NUM_ROWS bits) rather than walking a chain; see
+ * sl_masked_snippet_inc.h. Only operations that are safe to evaluate for any value of the rows outside the mask
+ * have a masked variant. */
+void sl_exec_f_add_masked(const uint64_t * restrict mask, float * restrict result_column, const float * restrict left_column, const float * restrict right_column);
+void sl_exec_f_sub_masked(const uint64_t * restrict mask, float * restrict result_column, const float * restrict left_column, const float * restrict right_column);
+void sl_exec_f_mul_masked(const uint64_t * restrict mask, float * restrict result_column, const float * restrict left_column, const float * restrict right_column);
+void sl_exec_f_div_masked(const uint64_t * restrict mask, float * restrict result_column, const float * restrict left_column, const float * restrict right_column);
+void sl_exec_f_negate_masked(const uint64_t * restrict mask, float * restrict result_column, const float * restrict opd_column);
+void sl_exec_f_increment_masked(const uint64_t * restrict mask, float * restrict result_column, const float * restrict opd_column);
+void sl_exec_f_decrement_masked(const uint64_t * restrict mask, float * restrict result_column, const float * restrict opd_column);
+void sl_exec_f_dot_product2_masked(const uint64_t * restrict mask, float * restrict result_column,
+                                   const float * restrict left_0_column, const float * restrict left_1_column,
+                                   const float * restrict right_0_column, const float * restrict right_1_column);
+void sl_exec_f_dot_product3_masked(const uint64_t * restrict mask, float * restrict result_column,
+                                   const float * restrict left_0_column, const float * restrict left_1_column, const float * restrict left_2_column,
+                                   const float * restrict right_0_column, const float * restrict right_1_column, const float * restrict right_2_column);
+void sl_exec_f_dot_product4_masked(const uint64_t * restrict mask, float * restrict result_column,
+                                   const float * restrict left_0_column, const float * restrict left_1_column, const float * restrict left_2_column, const float * restrict left_3_column,
+                                   const float * restrict right_0_column, const float * restrict right_1_column, const float * restrict right_2_column, const float * restrict right_3_column);
+void sl_exec_f_matrix_product_masked(const uint64_t * restrict mask, int num_rows, int inner, int num_cols,
+                                     float * const *result_columns, const float * const *left_columns, const float *left_scalars,
+                                     const float * const *right_columns, const float *right_scalars);
+void sl_exec_f_max_masked(const uint64_t * restrict mask, float * restrict result_column, const float * restrict left_column, const float * restrict right_column);
+void sl_exec_f_mad_masked(const uint64_t * restrict mask, float * restrict result_column,
+                          const float * restrict first_column, const float * restrict second_column, const float * restrict third_column);
+void sl_exec_f_lerp_masked(const uint64_t * restrict mask, float * restrict result_column,
+                           const float * restrict first_column, const float * restrict second_column, const float * restrict third_column);
+void sl_exec_f_dot_product2_clamp_masked(const uint64_t * restrict mask, float * restrict result_column,
+                                         const float * restrict left_0_column, const float * restrict left_1_column,
+                                         const float * restrict right_0_column, const float * restrict right_1_column,
+                                         const float * restrict lower_column, const float * restrict upper_column);
+void sl_exec_f_dot_product3_clamp_masked(const uint64_t * restrict mask, float * restrict result_column,
+                                         const float * restrict left_0_column, const float * restrict left_1_column, const float * restrict left_2_column,
+                                         const float * restrict right_0_column, const float * restrict right_1_column, const float * restrict right_2_column,
+                                         const float * restrict lower_column, const float * restrict upper_column);
+void sl_exec_f_dot_product4_clamp_masked(const uint64_t * restrict mask, float * restrict result_column,
+                                         const float * restrict left_0_column, const float * restrict left_1_column, const float * restrict left_2_column, const float * restrict left_3_column,
+                                         const float * restrict right_0_column, const float * restrict right_1_column, const float * restrict right_2_column, const float * restrict right_3_column,
+                                         const float * restrict lower_column, const float * restrict upper_column);
+void sl_exec_f_add_scalar_masked(const uint64_t * restrict mask, float * restrict result_column, const float * restrict left_column, float right);
+void sl_exec_f_sub_scalar_masked(const uint64_t * restrict mask, float * restrict result_column, const float * restrict left_column, float right);
+void sl_exec_f_scalar_sub_masked(const uint64_t * restrict mask, float * restrict result_column, float left, const float * restrict right_column);
+void sl_exec_f_mul_scalar_masked(const uint64_t * restrict mask, float * restrict result_column, const float * restrict left_column, float right);
+void sl_exec_f_div_scalar_masked(const uint64_t * restrict mask, float * restrict result_column, const float * restrict left_column, float right);
+void sl_exec_f_scalar_div_masked(const uint64_t * restrict mask, float * restrict result_column, float left, const float * restrict right_column);
+void sl_exec_f_scalar_dot_product2_masked(const uint64_t * restrict mask, float * restrict result_column,
+                                          float left_0, float left_1,
+                                          const float * restrict right_0_column, const float * restrict right_1_column);
+void sl_exec_f_scalar_dot_product3_masked(const uint64_t * restrict mask, float * restrict result_column,
+                                          float left_0, float left_1, float left_2,
+                                          const float * restrict right_0_column, const float * restrict right_1_column, const float * restrict right_2_column);
+void sl_exec_f_scalar_dot_product4_masked(const uint64_t * restrict mask, float * restrict result_column,
+                                          float left_0, float left_1, float left_2, float left_3,
+                                          const float * restrict right_0_column, const float * restrict right_1_column, const float * restrict right_2_column, const float * restrict right_3_column);
+
+/* Stores choices[opd_column[row]] in result_column, for all rows in the chain. */
+void sl_exec_i_pick(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, sl_exec_int_t * restrict result_column, const sl_exec_int_t * restrict opd_column, const sl_exec_int_t *choices);
+/* Stores choice_columns[opd_column[row]][row] in result_column, for all rows in the chain. */
+void sl_exec_i_pick_indirect(sl_exec_row_t row, sl_exec_row_t * restrict chain_column, sl_exec_int_t * restrict result_column, const sl_exec_int_t * restrict opd_column, sl_exec_int_t * const *choice_columns);
+
 void sl_exec_call_graph_results_init(struct sl_exec_call_graph_results *cgr);
 void sl_exec_call_graph_results_cleanup(struct sl_exec_call_graph_results *cgr);
 int sl_exec_call_graph_analysis(struct sl_exec_call_graph_results *cgr, struct sl_function *f);
 void sl_exec_cgr_max(struct sl_exec_call_graph_results *cgr, const struct sl_exec_call_graph_results *lcgr);
 void sl_exec_cgr_swap(struct sl_exec_call_graph_results *a, struct sl_exec_call_graph_results *b);
 
+/* Returns the number of rows to allocate the registers counted in cgr for, such that they fit in cache_budget
+ * bytes; always a multiple of 64, at least 64 and at most SL_EXEC_CHAIN_MAX_NUM_ROWS. */
+size_t sl_exec_batch_num_rows(const struct sl_exec_call_graph_results *cgr, size_t cache_budget);
+
+/* Returns the bytes per row of the register slab for the registers counted in cgr, as laid out by
+ * sl_exec_allocate_registers_by_slab() (before any uniforms read as scalars are left out.) */
+size_t sl_exec_row_size(const struct sl_exec_call_graph_results *cgr);
+
+/* Stores the number of registers in each bank that exec runs with in cgr; after sl_exec_prep() these may be
+ * fewer than the compilation unit's register_counts_ as the bytecode's registers are allocated by liveness. */
+void sl_exec_get_register_counts(const struct sl_execution *exec, struct sl_exec_call_graph_results *cgr);
+
+/* Returns the number of superinstructions of kind fusion (SL_IR_OPT_FUSED_XXX) in the bytecode exec runs, 0 if
+ * it has no bytecode. */
+size_t sl_exec_num_fused(const struct sl_execution *exec, int fusion);
+
+/* Selects the variant of the bytecode specialized on the values of the uniforms now loaded (see
+ * sl_execution::specialized_), to be run by sl_exec_run() until the next call; call after the uniforms are
+ * loaded for a draw. On a miss, the variant is generated with those uniforms folded as constants, evicting
+ * the least recently used variant if max_variants_ are cached. If it cannot be generated (e.g. upon allocation
+ * failure, or if it would need more registers than the generic code) the generic code runs instead. Uniform
+ * registers that change value on SL_EXEC_MAX_SPECIALIZED_MISSES consecutive misses are no longer specialized
+ * on; the cache is then flushed and the generic code runs for that draw. */
+void sl_exec_select_variant(struct sl_execution *exec);
+
+/* Stores the statistics of the variant cache of exec in stats */
+void sl_exec_get_variant_stats(const struct sl_execution *exec, struct sl_exec_variant_stats *stats);
+
+/* Stores the statistics of row compaction of exec since the last call in stats, and resets them; call once per
+ * frame for per frame statistics. */
+void sl_exec_take_compaction_stats(struct sl_execution *exec, struct sl_exec_compaction_stats *stats);
+
+void sl_exec_pool_init(struct sl_exec_pool *pool);
+void sl_exec_pool_cleanup(struct sl_exec_pool *pool);
+
+/* Replaces the contexts in pool with num_contexts new execution contexts for exec (see sl_exec_init_context()), e.g.
+ * after exec is prepared for another shader. Returns 0 upon success; upon failure the pool is left empty. */
+int sl_exec_pool_reset(struct sl_exec_pool *pool, const struct sl_execution *exec, size_t num_contexts);
+
+/* Synchronizes all contexts of the pool with their execution, see sl_exec_sync_context(). Returns 0 upon success. */
+int sl_exec_pool_sync(struct sl_exec_pool *pool);
+
 /* Dump the value in the registers determined by "ra" to the output string "output_str" and return the
  * length of that string, excluding NULL terminators. If output_str is NULL, the length is still computed
  * and returned but no output is written. single_row specifies the single row whose output for ra is dumped.
  * Internally uses sl_exec_offset_dump_strided. */
 size_t sl_exec_dump(struct sl_execution *exec, char *output_str, 
-                    uint8_t single_row, const struct sl_reg_alloc *ra);
+                    sl_exec_row_t single_row, const struct sl_reg_alloc *ra);
 
 /* Dumps the value in the registered determined by the arr, index, index_stride and array_offset combinations.
  * Serializes this value in human readable form to output_str and returns the size of the string in bytes, 
@@ -254,7 +834,7 @@ size_t sl_exec_dump(struct sl_execution *exec, char *output_str,
  * deep array introspection. */
 static size_t sl_exec_offset_dump_strided(struct sl_execution *exec, 
                                           char *output_str,
-                                          uint8_t single_row, 
+                                          sl_exec_row_t single_row, 
                                           const struct sl_reg_alloc *arr,
                                           const struct sl_reg_alloc *index,
                                           int index_stride,
@@ -264,7 +844,7 @@ static size_t sl_exec_offset_dump_strided(struct sl_execution *exec,
  * of memory. */
 void sl_exec_offset_dumpf_strided(struct sl_execution *exec, 
                                   FILE *fp,
-                                  uint8_t single_row, 
+                                  sl_exec_row_t single_row, 
                                   const struct sl_reg_alloc *arr,
                                   const struct sl_reg_alloc *index,
                                   int index_stride,
@@ -272,7 +852,7 @@ void sl_exec_offset_dumpf_strided(struct sl_execution *exec,
 
 /* Convenience wrapper analogous to sl_exec_dump which sends its output to fp */
 void sl_exec_dumpf(struct sl_execution *exec, FILE *fp,
-                    uint8_t single_row, const struct sl_reg_alloc *ra);
+                    sl_exec_row_t single_row, const struct sl_reg_alloc *ra);
 
 void sl_exec_debug_dump_builtin(struct sl_execution *exec, int exec_chain, struct sl_expr *x);
   
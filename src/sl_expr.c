@@ -1183,6 +1183,52 @@ int sl_expr_validate(struct diags *dx, struct sl_type_base *tb, const struct sl_
   }
 }
 
+int sl_expr_is_uniform(const struct sl_expr *x) {
+  size_t n;
+  if (!x) return 0;
+  switch (x->op_) {
+    case exop_variable:
+      /* Note that "const in" parameters are const, but not uniform */
+      if (!x->variable_ || !x->variable_->type_ || x->variable_->is_parameter_) return 0;
+      return !!(sl_type_qualifiers(x->variable_->type_) & (SL_TYPE_QUALIFIER_UNIFORM | SL_TYPE_QUALIFIER_CONST));
+    case exop_literal:
+      return 1;
+    case exop_function_call:
+      /* Builtins that can be evaluated at compile time are pure functions of their arguments, anything else
+       * (user functions, texture lookups) might not be. */
+      if (!x->function_ || !x->function_->builtin_eval_fn_ || x->function_->is_dump_fn_) return 0;
+      break;
+    case exop_array_subscript:
+    case exop_component_selection:
+    case exop_field_selection:
+    case exop_negate:
+    case exop_logical_not:
+    case exop_multiply:
+    case exop_divide:
+    case exop_add:
+    case exop_subtract:
+    case exop_lt:
+    case exop_le:
+    case exop_ge:
+    case exop_gt:
+    case exop_eq:
+    case exop_ne:
+    case exop_constructor:
+    case exop_logical_and:
+    case exop_logical_or:
+    case exop_logical_xor:
+    case exop_conditional:
+      break;
+    default:
+      /* Assignments, increments and decrements, and sequences (which might have side effects) */
+      return 0;
+  }
+  for (n = 0; n < x->num_children_; ++n) {
+    if (!sl_expr_is_uniform(x->children_[n])) return 0;
+  }
+  return 1;
+}
+
 int sl_expr_eval(struct sl_type_base *tb, const struct sl_expr *x, struct sl_expr_temp *r) {
   size_t n;
   switch (x->op_) {
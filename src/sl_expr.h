@@ -276,6 +276,12 @@ int sl_expr_is_lvalue(struct sl_type_base *tb, const struct sl_expr *x);
  * found with the expression that were, ostensibly, not diagnosed before.. */
 int sl_expr_validate(struct diags *dx, struct sl_type_base *tb, const struct sl_expr *x);
 
+/* Returns non-zero if the value of x is the same for all rows that evaluate it during a draw; that is, if
+ * it only depends on uniforms, constants and literals through operators and builtins that can be evaluated
+ * at compile time, and has no side effects. Conditions that are uniform send all rows down the same path, so
+ * the execution chain can be forwarded as a whole rather than split row by row. */
+int sl_expr_is_uniform(const struct sl_expr *x);
+
 /* Evaluate an expression and store the result in the given temporary. */
 int sl_expr_eval(struct sl_type_base *tb, const struct sl_expr *x, struct sl_expr_temp *r);
 
@@ -17,6 +17,11 @@
 #include <stdint.h>
 #endif
 
+#ifndef STRING_H_INCLUDED
+#define STRING_H_INCLUDED
+#include <string.h>
+#endif
+
 #ifndef SL_EXECUTION_H_INCLUDED
 #define SL_EXECUTION_H_INCLUDED
 #include "sl_execution.h"
@@ -47,6 +52,11 @@
 #include "sl_reg_move.h"
 #endif
 
+#ifndef SL_COMPILATION_UNIT_H_INCLUDED
+#define SL_COMPILATION_UNIT_H_INCLUDED
+#include "sl_compilation_unit.h"
+#endif
+
 static struct ireg_operand load_operands[] = {
   { IREG_DEF },
   { IREG_USE }
@@ -143,6 +153,16 @@ static struct ireg_operand slir_7_opd[] = {
   { IREG_USE }
 };
 
+static struct ireg_operand slir_call_builtin_opd[] = {
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE }
+};
+
 static struct ireg_operand slir_8_opd[] = {
   { IREG_USE },
   { IREG_DEF },
@@ -154,6 +174,18 @@ static struct ireg_operand slir_8_opd[] = {
   { IREG_USE }
 };
 
+static struct ireg_operand slir_9_opd[] = {
+  { IREG_USE },
+  { IREG_DEF },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE }
+};
+
 static struct ireg_operand slir_10_opd[] = {
   { IREG_USE },
   { IREG_DEF },
@@ -167,6 +199,194 @@ static struct ireg_operand slir_10_opd[] = {
   { IREG_USE }
 };
 
+static struct ireg_operand slir_11_opd[] = {
+  { IREG_USE },
+  { IREG_DEF },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE }
+};
+
+static struct ireg_operand slir_12_opd[] = {
+  { IREG_USE },
+  { IREG_DEF },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE }
+};
+
+/* Fused matrix products: the chain, the result components, and the left and right operand components */
+static struct ireg_operand slir_mp_9_opd[] = {
+  { IREG_USE },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE }
+};
+
+static struct ireg_operand slir_mp_16_opd[] = {
+  { IREG_USE },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE }
+};
+
+static struct ireg_operand slir_mp_25_opd[] = {
+  { IREG_USE },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE }
+};
+
+static struct ireg_operand slir_mp_13_opd[] = {
+  { IREG_USE },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE }
+};
+
+static struct ireg_operand slir_mp_28_opd[] = {
+  { IREG_USE },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE }
+};
+
+static struct ireg_operand slir_mp_49_opd[] = {
+  { IREG_USE },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_DEF },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE },
+  { IREG_USE }
+};
+
 static struct ireg_operand slir_reg_move_f_reg_to_reg_args[] = {
   { IREG_USE },
   { IREG_DEF },
@@ -1911,6 +2131,7 @@ static struct ireg_instr gir_instructions_[] = {
 
 static struct ireg_instr slir_instructions_[] = {
   { IRARC_SLIR, SLIR_SPLIT_EXEC_CHAIN_BY_CONDITION, 4, quad_def_def_operands, "SLIR_SPLIT", "%0, %1, %2, %3" },
+  { IRARC_SLIR, SLIR_SPLIT_EXEC_CHAIN_BY_UNIFORM_CONDITION, 4, quad_def_def_operands, "SLIR_SPLIT_UNIFORM", "%0, %1, %2, %3" },
   { IRARC_SLIR, SLIR_JOIN_EXEC_CHAINS, 3, tri_operands, "SLIR_JOIN", "%0, %1, %2" },
 
   { IRARC_SLIR, SLIR_NEG_F, 3, slir_tri, "SLIR_NEG", "%0, %1, %2" },
@@ -1925,6 +2146,31 @@ static struct ireg_instr slir_instructions_[] = {
   { IRARC_SLIR, SLIR_DOT3, 8, slir_8_opd, "SLIR_DOT", "%0, %1, %2, %3, %4, %5, %6, %7" },
   { IRARC_SLIR, SLIR_DOT4, 10, slir_10_opd, "SLIR_DOT", "%0, %1, %2, %3, %4, %5, %6, %7, %8, %9" },
 
+  { IRARC_SLIR, SLIR_MAT2_MUL_VEC2, 9, slir_mp_9_opd, "SLIR_MAT_MUL_VEC", "%0, { %1, %2 }, { %3, %4, %5, %6 }, { %7, %8 }" },
+  { IRARC_SLIR, SLIR_MAT3_MUL_VEC3, 16, slir_mp_16_opd, "SLIR_MAT_MUL_VEC", "%0, { %1, %2, %3 }, { %4, %5, %6, %7, %8, %9, %10, %11, %12 }, { %13, %14, %15 }" },
+  { IRARC_SLIR, SLIR_MAT4_MUL_VEC4, 25, slir_mp_25_opd, "SLIR_MAT_MUL_VEC", "%0, { %1, %2, %3, %4 }, { %5, %6, %7, %8, %9, %10, %11, %12, %13, %14, %15, %16, %17, %18, %19, %20 }, { %21, %22, %23, %24 }" },
+
+  { IRARC_SLIR, SLIR_VEC2_MUL_MAT2, 9, slir_mp_9_opd, "SLIR_VEC_MUL_MAT", "%0, { %1, %2 }, { %3, %4 }, { %5, %6, %7, %8 }" },
+  { IRARC_SLIR, SLIR_VEC3_MUL_MAT3, 16, slir_mp_16_opd, "SLIR_VEC_MUL_MAT", "%0, { %1, %2, %3 }, { %4, %5, %6 }, { %7, %8, %9, %10, %11, %12, %13, %14, %15 }" },
+  { IRARC_SLIR, SLIR_VEC4_MUL_MAT4, 25, slir_mp_25_opd, "SLIR_VEC_MUL_MAT", "%0, { %1, %2, %3, %4 }, { %5, %6, %7, %8 }, { %9, %10, %11, %12, %13, %14, %15, %16, %17, %18, %19, %20, %21, %22, %23, %24 }" },
+
+  { IRARC_SLIR, SLIR_MAT2_MUL_MAT2, 13, slir_mp_13_opd, "SLIR_MAT_MUL_MAT", "%0, { %1, %2, %3, %4 }, { %5, %6, %7, %8 }, { %9, %10, %11, %12 }" },
+  { IRARC_SLIR, SLIR_MAT3_MUL_MAT3, 28, slir_mp_28_opd, "SLIR_MAT_MUL_MAT", "%0, { %1, %2, %3, %4, %5, %6, %7, %8, %9 }, { %10, %11, %12, %13, %14, %15, %16, %17, %18 }, { %19, %20, %21, %22, %23, %24, %25, %26, %27 }" },
+  { IRARC_SLIR, SLIR_MAT4_MUL_MAT4, 49, slir_mp_49_opd, "SLIR_MAT_MUL_MAT", "%0, { %1, %2, %3, %4, %5, %6, %7, %8, %9, %10, %11, %12, %13, %14, %15, %16 }, { %17, %18, %19, %20, %21, %22, %23, %24, %25, %26, %27, %28, %29, %30, %31, %32 }, { %33, %34, %35, %36, %37, %38, %39, %40, %41, %42, %43, %44, %45, %46, %47, %48 }" },
+
+  { IRARC_SLIR, SLIR_MAX_F, 4, slir_quad, "SLIR_MAX", "%0, %1, %2, %3" },
+  { IRARC_SLIR, SLIR_CLAMP_F, 5, slir_5_opd, "SLIR_CLAMP", "%0, %1, %2, %3, %4" },
+  { IRARC_SLIR, SLIR_MIX_F, 5, slir_5_opd, "SLIR_MIX", "%0, %1, %2, %3, %4" },
+
+  { IRARC_SLIR, SLIR_MAD_F, 5, slir_5_opd, "SLIR_MAD", "%0, %1, %2, %3, %4" },
+  { IRARC_SLIR, SLIR_LERP_F, 5, slir_5_opd, "SLIR_LERP", "%0, %1, %2, %3, %4" },
+  { IRARC_SLIR, SLIR_DOT2_MAX_F, 7, slir_7_opd, "SLIR_DOT_MAX", "%0, %1, %2, %3, %4, %5, %6" },
+  { IRARC_SLIR, SLIR_DOT3_MAX_F, 9, slir_9_opd, "SLIR_DOT_MAX", "%0, %1, %2, %3, %4, %5, %6, %7, %8" },
+  { IRARC_SLIR, SLIR_DOT4_MAX_F, 11, slir_11_opd, "SLIR_DOT_MAX", "%0, %1, %2, %3, %4, %5, %6, %7, %8, %9, %10" },
+  { IRARC_SLIR, SLIR_DOT2_CLAMP_F, 8, slir_8_opd, "SLIR_DOT_CLAMP", "%0, %1, %2, %3, %4, %5, %6, %7" },
+  { IRARC_SLIR, SLIR_DOT3_CLAMP_F, 10, slir_10_opd, "SLIR_DOT_CLAMP", "%0, %1, %2, %3, %4, %5, %6, %7, %8, %9" },
+  { IRARC_SLIR, SLIR_DOT4_CLAMP_F, 12, slir_12_opd, "SLIR_DOT_CLAMP", "%0, %1, %2, %3, %4, %5, %6, %7, %8, %9, %10, %11" },
+
   { IRARC_SLIR, SLIR_DIV_F, 4, slir_quad, "SLIR_DIV", "%0, %1, %2, %3" },
   { IRARC_SLIR, SLIR_DIV_I, 4, slir_quad, "SLIR_DIV", "%0, %1, %2, %3" },
 
@@ -2149,7 +2395,8 @@ static struct ireg_instr slir_instructions_[] = {
   { IRARC_SLIR, SLIR_REG_MOVE_SC_INDIR_OFFSET_TO_REG, 5, slir_reg_move_sc_indir_offset_to_reg_args, "MOV_sc", "%0, %1, [%2 + %3 * %4 + %5]" },
   { IRARC_SLIR, SLIR_REG_MOVE_SC_INDIR_OFFSET_TO_INDIR, 6, slir_reg_move_sc_indir_offset_to_indir_args, "MOV_sc", "%0, [%1 + %2], [%3 + %4 * %5 + %6]" },
   { IRARC_SLIR, SLIR_REG_MOVE_SC_INDIR_OFFSET_TO_OFFSET_REG, 8, slir_reg_move_sc_indir_offset_to_offset_reg_args, "MOV_sc", "%0, %1 + %2 * %3 + %4, [%5 + %6 * %7 + %8]" },
-  { IRARC_SLIR, SLIR_REG_MOVE_SC_INDIR_OFFSET_TO_INDIR_OFFSET, 8, slir_reg_move_sc_indir_offset_to_indir_offset_args, "MOV_sc", "%0, [%1 + %2 * %3 + %4], [%5 + %6 * %7 + %8]" } 
+  { IRARC_SLIR, SLIR_REG_MOVE_SC_INDIR_OFFSET_TO_INDIR_OFFSET, 8, slir_reg_move_sc_indir_offset_to_indir_offset_args, "MOV_sc", "%0, [%1 + %2 * %3 + %4], [%5 + %6 * %7 + %8]" },
+  { IRARC_SLIR, SLIR_CALL_BUILTIN, 7, slir_call_builtin_opd, "SLIR_CALL_BUILTIN", "%0, %1, { %2, %3, %4, %5, %6 }" }
 };
 
 
@@ -2255,185 +2502,154 @@ static void sl_ir_i_mul(struct ir_block *blk, struct ir_temp *chain_reg, int dst
   ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, right_reg));
 }
 
-static void sl_ir_dot_product2(struct ir_block *blk, struct ir_temp *chain_reg, int dst_reg, int left0_reg, int left1_reg, int right0_reg, int right1_reg) {
-  struct ir_instr *instr = ir_block_append_instr(blk, SLIR_DOT2);
-  ir_instr_append_use(instr, chain_reg);
-  ir_instr_append_def(instr, ir_body_alloc_temp_banked_int(blk->body_, dst_reg));
-  ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, left0_reg));
-  ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, left1_reg));
-  ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, right0_reg));
-  ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, right1_reg));
-}
-
-static void sl_ir_dot_product3(struct ir_block *blk, struct ir_temp *chain_reg, int dst_reg, int left0_reg, int left1_reg, int left2_reg, int right0_reg, int right1_reg, int right2_reg) {
-  struct ir_instr *instr = ir_block_append_instr(blk, SLIR_DOT3);
-  ir_instr_append_use(instr, chain_reg);
-  ir_instr_append_def(instr, ir_body_alloc_temp_banked_int(blk->body_, dst_reg));
-  ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, left0_reg));
-  ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, left1_reg));
-  ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, left2_reg));
-  ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, right0_reg));
-  ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, right1_reg));
-  ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, right2_reg));
+int sl_ir_matrix_product_shape(int instruction_code, int *num_rows, int *inner, int *num_cols) {
+  int dim;
+  if ((instruction_code < SLIR_MAT2_MUL_VEC2) || (instruction_code > SLIR_MAT4_MUL_MAT4)) return 0;
+  dim = 2 + (instruction_code - SLIR_MAT2_MUL_VEC2) % 3;
+  switch ((instruction_code - SLIR_MAT2_MUL_VEC2) / 3) {
+    case 0: /* matN * vecN */
+      *num_rows = dim; *inner = dim; *num_cols = 1;
+      break;
+    case 1: /* vecN * matN */
+      *num_rows = 1; *inner = dim; *num_cols = dim;
+      break;
+    default: /* matN * matN */
+      *num_rows = dim; *inner = dim; *num_cols = dim;
+      break;
+  }
+  return 1;
 }
 
-static void sl_ir_dot_product4(struct ir_block *blk, struct ir_temp *chain_reg, int dst_reg, int left0_reg, int left1_reg, int left2_reg, int left3_reg, int right0_reg, int right1_reg, int right2_reg, int right3_reg) {
-  struct ir_instr *instr = ir_block_append_instr(blk, SLIR_DOT4);
+/* Emits the fused matrix product instruction_code (see sl_ir_matrix_product_shape()), computing all components of
+ * dst from those of left and right in a single instruction. */
+static void sl_ir_matrix_product(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_execution_frame *frame, int instruction_code,
+                                 struct sl_expr *dst, struct sl_expr *left, struct sl_expr *right) {
+  struct ir_instr *instr;
+  int num_rows, inner, num_cols, n;
+  if (!sl_ir_matrix_product_shape(instruction_code, &num_rows, &inner, &num_cols)) return;
+  instr = ir_block_append_instr(blk, instruction_code);
   ir_instr_append_use(instr, chain_reg);
-  ir_instr_append_def(instr, ir_body_alloc_temp_banked_int(blk->body_, dst_reg));
-  ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, left0_reg));
-  ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, left1_reg));
-  ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, left2_reg));
-  ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, left3_reg));
-  ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, right0_reg));
-  ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, right1_reg));
-  ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, right2_reg));
-  ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, right3_reg));
+  for (n = 0; n < num_rows * num_cols; ++n) {
+    ir_instr_append_def(instr, ir_body_alloc_temp_banked_float(blk->body_, EXPR_RVALUE(dst)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(dst)->v_.regs_[n] : EXPR_RVALUE(dst)->v_.regs_[n]));
+  }
+  for (n = 0; n < num_rows * inner; ++n) {
+    ir_instr_append_use(instr, ir_body_alloc_temp_banked_float(blk->body_, EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[n] : EXPR_RVALUE(left)->v_.regs_[n]));
+  }
+  for (n = 0; n < inner * num_cols; ++n) {
+    ir_instr_append_use(instr, ir_body_alloc_temp_banked_float(blk->body_, EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[n] : EXPR_RVALUE(right)->v_.regs_[n]));
+  }
 }
 
 static void sl_ir_mul(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_execution_frame *frame, struct sl_expr *dst, struct sl_expr *left, struct sl_expr *right) {
-  int r, c;
+  int r;
   sl_reg_alloc_kind_t left_kind = EXPR_RVALUE(left)->kind_;
   sl_reg_alloc_kind_t right_kind = EXPR_RVALUE(right)->kind_;
   if (left_kind == right_kind) {
     switch (left_kind) {
       case slrak_float:
         sl_ir_f_mul(blk, chain_reg,  
-                    dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[0] : dst->base_regs_.v_.regs_[0],
+                    EXPR_RVALUE(dst)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(dst)->v_.regs_[0] : EXPR_RVALUE(dst)->v_.regs_[0],
                     EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0],
                     EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0]);
         break;
       case slrak_int:
         sl_ir_i_mul(blk, chain_reg,  
-                    dst->base_regs_.local_frame_ ? frame->local_int_offset_ + dst->base_regs_.v_.regs_[0] : dst->base_regs_.v_.regs_[0],
+                    EXPR_RVALUE(dst)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(dst)->v_.regs_[0] : EXPR_RVALUE(dst)->v_.regs_[0],
                     EXPR_RVALUE(left)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0],
                     EXPR_RVALUE(right)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0]);
         break;
       case slrak_vec2:
         sl_ir_f_mul(blk, chain_reg,  
-                    dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[0] : dst->base_regs_.v_.regs_[0],
+                    EXPR_RVALUE(dst)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(dst)->v_.regs_[0] : EXPR_RVALUE(dst)->v_.regs_[0],
                     EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0],
                     EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0]);
         sl_ir_f_mul(blk, chain_reg,  
-                    dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[1] : dst->base_regs_.v_.regs_[1],
+                    EXPR_RVALUE(dst)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(dst)->v_.regs_[1] : EXPR_RVALUE(dst)->v_.regs_[1],
                     EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[1] : EXPR_RVALUE(left)->v_.regs_[1],
                     EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[1] : EXPR_RVALUE(right)->v_.regs_[1]);
         break;
       case slrak_vec3:
         sl_ir_f_mul(blk, chain_reg,  
-                    dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[0] : dst->base_regs_.v_.regs_[0],
+                    EXPR_RVALUE(dst)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(dst)->v_.regs_[0] : EXPR_RVALUE(dst)->v_.regs_[0],
                     EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0],
                     EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0]);
         sl_ir_f_mul(blk, chain_reg,  
-                    dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[1] : dst->base_regs_.v_.regs_[1],
+                    EXPR_RVALUE(dst)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(dst)->v_.regs_[1] : EXPR_RVALUE(dst)->v_.regs_[1],
                     EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[1] : EXPR_RVALUE(left)->v_.regs_[1],
                     EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[1] : EXPR_RVALUE(right)->v_.regs_[1]);
         sl_ir_f_mul(blk, chain_reg,  
-                    dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[2] : dst->base_regs_.v_.regs_[2],
+                    EXPR_RVALUE(dst)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(dst)->v_.regs_[2] : EXPR_RVALUE(dst)->v_.regs_[2],
                     EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[2] : EXPR_RVALUE(left)->v_.regs_[2],
                     EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[2] : EXPR_RVALUE(right)->v_.regs_[2]);
         break;
       case slrak_vec4:
         sl_ir_f_mul(blk, chain_reg,  
-                    dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[0] : dst->base_regs_.v_.regs_[0],
+                    EXPR_RVALUE(dst)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(dst)->v_.regs_[0] : EXPR_RVALUE(dst)->v_.regs_[0],
                     EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0],
                     EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0]);
         sl_ir_f_mul(blk, chain_reg,  
-                    dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[1] : dst->base_regs_.v_.regs_[1],
+                    EXPR_RVALUE(dst)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(dst)->v_.regs_[1] : EXPR_RVALUE(dst)->v_.regs_[1],
                     EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[1] : EXPR_RVALUE(left)->v_.regs_[1],
                     EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[1] : EXPR_RVALUE(right)->v_.regs_[1]);
         sl_ir_f_mul(blk, chain_reg,  
-                    dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[2] : dst->base_regs_.v_.regs_[2],
+                    EXPR_RVALUE(dst)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(dst)->v_.regs_[2] : EXPR_RVALUE(dst)->v_.regs_[2],
                     EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[2] : EXPR_RVALUE(left)->v_.regs_[2],
                     EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[2] : EXPR_RVALUE(right)->v_.regs_[2]);
         sl_ir_f_mul(blk, chain_reg,  
-                    dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[3] : dst->base_regs_.v_.regs_[3],
+                    EXPR_RVALUE(dst)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(dst)->v_.regs_[3] : EXPR_RVALUE(dst)->v_.regs_[3],
                     EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[3] : EXPR_RVALUE(left)->v_.regs_[3],
                     EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[3] : EXPR_RVALUE(right)->v_.regs_[3]);
         break;
       case slrak_ivec2:
         sl_ir_i_mul(blk, chain_reg,  
-                    dst->base_regs_.local_frame_ ? frame->local_int_offset_ + dst->base_regs_.v_.regs_[0] : dst->base_regs_.v_.regs_[0],
+                    EXPR_RVALUE(dst)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(dst)->v_.regs_[0] : EXPR_RVALUE(dst)->v_.regs_[0],
                     EXPR_RVALUE(left)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0],
                     EXPR_RVALUE(right)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0]);
         sl_ir_i_mul(blk, chain_reg,  
-                    dst->base_regs_.local_frame_ ? frame->local_int_offset_ + dst->base_regs_.v_.regs_[1] : dst->base_regs_.v_.regs_[1],
+                    EXPR_RVALUE(dst)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(dst)->v_.regs_[1] : EXPR_RVALUE(dst)->v_.regs_[1],
                     EXPR_RVALUE(left)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(left)->v_.regs_[1] : EXPR_RVALUE(left)->v_.regs_[1],
                     EXPR_RVALUE(right)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(right)->v_.regs_[1] : EXPR_RVALUE(right)->v_.regs_[1]);
         break;
       case slrak_ivec3:
         sl_ir_i_mul(blk, chain_reg,  
-                    dst->base_regs_.local_frame_ ? frame->local_int_offset_ + dst->base_regs_.v_.regs_[0] : dst->base_regs_.v_.regs_[0],
+                    EXPR_RVALUE(dst)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(dst)->v_.regs_[0] : EXPR_RVALUE(dst)->v_.regs_[0],
                     EXPR_RVALUE(left)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0],
                     EXPR_RVALUE(right)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0]);
         sl_ir_i_mul(blk, chain_reg,  
-                    dst->base_regs_.local_frame_ ? frame->local_int_offset_ + dst->base_regs_.v_.regs_[1] : dst->base_regs_.v_.regs_[1],
+                    EXPR_RVALUE(dst)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(dst)->v_.regs_[1] : EXPR_RVALUE(dst)->v_.regs_[1],
                     EXPR_RVALUE(left)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(left)->v_.regs_[1] : EXPR_RVALUE(left)->v_.regs_[1],
                     EXPR_RVALUE(right)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(right)->v_.regs_[1] : EXPR_RVALUE(right)->v_.regs_[1]);
         sl_ir_i_mul(blk, chain_reg,  
-                    dst->base_regs_.local_frame_ ? frame->local_int_offset_ + dst->base_regs_.v_.regs_[2] : dst->base_regs_.v_.regs_[2],
+                    EXPR_RVALUE(dst)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(dst)->v_.regs_[2] : EXPR_RVALUE(dst)->v_.regs_[2],
                     EXPR_RVALUE(left)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(left)->v_.regs_[2] : EXPR_RVALUE(left)->v_.regs_[2],
                     EXPR_RVALUE(right)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(right)->v_.regs_[2] : EXPR_RVALUE(right)->v_.regs_[2]);
         break;
       case slrak_ivec4:
         sl_ir_i_mul(blk, chain_reg,  
-                    dst->base_regs_.local_frame_ ? frame->local_int_offset_ + dst->base_regs_.v_.regs_[0] : dst->base_regs_.v_.regs_[0],
+                    EXPR_RVALUE(dst)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(dst)->v_.regs_[0] : EXPR_RVALUE(dst)->v_.regs_[0],
                     EXPR_RVALUE(left)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0],
                     EXPR_RVALUE(right)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0]);
         sl_ir_i_mul(blk, chain_reg,  
-                    dst->base_regs_.local_frame_ ? frame->local_int_offset_ + dst->base_regs_.v_.regs_[1] : dst->base_regs_.v_.regs_[1],
+                    EXPR_RVALUE(dst)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(dst)->v_.regs_[1] : EXPR_RVALUE(dst)->v_.regs_[1],
                     EXPR_RVALUE(left)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(left)->v_.regs_[1] : EXPR_RVALUE(left)->v_.regs_[1],
                     EXPR_RVALUE(right)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(right)->v_.regs_[1] : EXPR_RVALUE(right)->v_.regs_[1]);
         sl_ir_i_mul(blk, chain_reg,  
-                    dst->base_regs_.local_frame_ ? frame->local_int_offset_ + dst->base_regs_.v_.regs_[2] : dst->base_regs_.v_.regs_[2],
+                    EXPR_RVALUE(dst)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(dst)->v_.regs_[2] : EXPR_RVALUE(dst)->v_.regs_[2],
                     EXPR_RVALUE(left)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(left)->v_.regs_[2] : EXPR_RVALUE(left)->v_.regs_[2],
                     EXPR_RVALUE(right)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(right)->v_.regs_[2] : EXPR_RVALUE(right)->v_.regs_[2]);
         sl_ir_i_mul(blk, chain_reg,  
-                    dst->base_regs_.local_frame_ ? frame->local_int_offset_ + dst->base_regs_.v_.regs_[3] : dst->base_regs_.v_.regs_[3],
+                    EXPR_RVALUE(dst)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(dst)->v_.regs_[3] : EXPR_RVALUE(dst)->v_.regs_[3],
                     EXPR_RVALUE(left)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(left)->v_.regs_[3] : EXPR_RVALUE(left)->v_.regs_[3],
                     EXPR_RVALUE(right)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(right)->v_.regs_[3] : EXPR_RVALUE(right)->v_.regs_[3]);
         break;
       case slrak_mat2:
-        for (c = 0; c < 2; ++c) {
-          for (r = 0; r < 2; ++r) {
-            sl_ir_dot_product2(blk, chain_reg,
-                               dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[c*2+r] : dst->base_regs_.v_.regs_[c*2+r],
-                               EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[r+0] : EXPR_RVALUE(left)->v_.regs_[r+0],
-                               EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[r+2] : EXPR_RVALUE(left)->v_.regs_[r+2],
-                               EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[c*2 + 0] : EXPR_RVALUE(right)->v_.regs_[c*2 + 0],
-                               EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[c*2 + 1] : EXPR_RVALUE(right)->v_.regs_[c*2 + 1]);
-          }
-        }
+        sl_ir_matrix_product(blk, chain_reg, frame, SLIR_MAT2_MUL_MAT2, dst, left, right);
         break;
       case slrak_mat3:
-        for (c = 0; c < 3; ++c) {
-          for (r = 0; r < 3; ++r) {
-            sl_ir_dot_product3(blk, chain_reg,
-                               dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[c*3+r] : dst->base_regs_.v_.regs_[c*3+r],
-                               EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[r+0] : EXPR_RVALUE(left)->v_.regs_[r+0],
-                               EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[r+3] : EXPR_RVALUE(left)->v_.regs_[r+3],
-                               EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[r+6] : EXPR_RVALUE(left)->v_.regs_[r+6],
-                               EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[c*3 + 0] : EXPR_RVALUE(right)->v_.regs_[c*3 + 0],
-                               EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[c*3 + 1] : EXPR_RVALUE(right)->v_.regs_[c*3 + 1],
-                               EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[c*3 + 2] : EXPR_RVALUE(right)->v_.regs_[c*3 + 2]);
-          }
-        }
+        sl_ir_matrix_product(blk, chain_reg, frame, SLIR_MAT3_MUL_MAT3, dst, left, right);
         break;
       case slrak_mat4:
-        for (c = 0; c < 4; ++c) {
-          for (r = 0; r < 4; ++r) {
-            sl_ir_dot_product4(blk, chain_reg,
-                               dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[c*4+r] : dst->base_regs_.v_.regs_[c*4+r],
-                               EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[r+0] : EXPR_RVALUE(left)->v_.regs_[r+0],
-                               EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[r+4] : EXPR_RVALUE(left)->v_.regs_[r+4],
-                               EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[r+8] : EXPR_RVALUE(left)->v_.regs_[r+8],
-                               EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[r+12] : EXPR_RVALUE(left)->v_.regs_[r+12],
-                               EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[c*4 + 0] : EXPR_RVALUE(right)->v_.regs_[c*4 + 0],
-                               EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[c*4 + 1] : EXPR_RVALUE(right)->v_.regs_[c*4 + 1],
-                               EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[c*4 + 2] : EXPR_RVALUE(right)->v_.regs_[c*4 + 2],
-                               EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[c*4 + 3] : EXPR_RVALUE(right)->v_.regs_[c*4 + 3]);
-          }
-        }
+        sl_ir_matrix_product(blk, chain_reg, frame, SLIR_MAT4_MUL_MAT4, dst, left, right);
         break;
     }
   }
@@ -2449,7 +2665,7 @@ static void sl_ir_mul(struct ir_block *blk, struct ir_temp *chain_reg, struct sl
     }
     for (r = 0; r < num_coords; ++r) {
       sl_ir_f_mul(blk, chain_reg,  
-                  dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[r] : dst->base_regs_.v_.regs_[r],
+                  EXPR_RVALUE(dst)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(dst)->v_.regs_[r] : EXPR_RVALUE(dst)->v_.regs_[r],
                   EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0],
                   EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[r] : EXPR_RVALUE(right)->v_.regs_[r]);
     }
@@ -2466,7 +2682,7 @@ static void sl_ir_mul(struct ir_block *blk, struct ir_temp *chain_reg, struct sl
     }
     for (r = 0; r < num_coords; ++r) {
       sl_ir_f_mul(blk, chain_reg,  
-                  dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[r] : dst->base_regs_.v_.regs_[r],
+                  EXPR_RVALUE(dst)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(dst)->v_.regs_[r] : EXPR_RVALUE(dst)->v_.regs_[r],
                   EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[r] : EXPR_RVALUE(left)->v_.regs_[r],
                   EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0]);
     }
@@ -2480,7 +2696,7 @@ static void sl_ir_mul(struct ir_block *blk, struct ir_temp *chain_reg, struct sl
     }
     for (r = 0; r < num_coords; ++r) {
         sl_ir_i_mul(blk, chain_reg,  
-                    dst->base_regs_.local_frame_ ? frame->local_int_offset_ + dst->base_regs_.v_.regs_[r] : dst->base_regs_.v_.regs_[r],
+                    EXPR_RVALUE(dst)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(dst)->v_.regs_[r] : EXPR_RVALUE(dst)->v_.regs_[r],
                     EXPR_RVALUE(left)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0],
                     EXPR_RVALUE(right)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(right)->v_.regs_[r] : EXPR_RVALUE(right)->v_.regs_[r]);
     }
@@ -2494,82 +2710,28 @@ static void sl_ir_mul(struct ir_block *blk, struct ir_temp *chain_reg, struct sl
     }
     for (r = 0; r < num_coords; ++r) {
         sl_ir_i_mul(blk, chain_reg,  
-                    dst->base_regs_.local_frame_ ? frame->local_int_offset_ + dst->base_regs_.v_.regs_[r] : dst->base_regs_.v_.regs_[r],
+                    EXPR_RVALUE(dst)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(dst)->v_.regs_[r] : EXPR_RVALUE(dst)->v_.regs_[r],
                     EXPR_RVALUE(left)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(left)->v_.regs_[r] : EXPR_RVALUE(left)->v_.regs_[r],
                     EXPR_RVALUE(right)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0]);
     }
   }
   else if ((left_kind == slrak_vec2) && (right_kind == slrak_mat2)) {
-    for (r = 0; r < 2; ++r) {
-      sl_ir_dot_product2(blk, chain_reg,
-                         dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[r] : dst->base_regs_.v_.regs_[r],
-                         EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0],
-                         EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[1] : EXPR_RVALUE(left)->v_.regs_[1],
-                         EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[r*2 + 0] : EXPR_RVALUE(right)->v_.regs_[r*2 + 0],
-                         EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[r*2 + 1] : EXPR_RVALUE(right)->v_.regs_[r*2 + 1]);
-    }
+    sl_ir_matrix_product(blk, chain_reg, frame, SLIR_VEC2_MUL_MAT2, dst, left, right);
   }
   else if ((left_kind == slrak_mat2) && (right_kind == slrak_vec2)) {
-    for (r = 0; r < 2; ++r) {
-      sl_ir_dot_product2(blk, chain_reg,
-                         dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[r] : dst->base_regs_.v_.regs_[r],
-                         EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[0 + r] : EXPR_RVALUE(left)->v_.regs_[0 + r],
-                         EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[2 + r] : EXPR_RVALUE(left)->v_.regs_[2 + r],
-                         EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0],
-                         EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[1] : EXPR_RVALUE(right)->v_.regs_[1]);
-    }
+    sl_ir_matrix_product(blk, chain_reg, frame, SLIR_MAT2_MUL_VEC2, dst, left, right);
   }
   else if ((left_kind == slrak_vec3) && (right_kind == slrak_mat3)) {
-    for (r = 0; r < 3; ++r) {
-      sl_ir_dot_product3(blk, chain_reg,
-                         dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[r] : dst->base_regs_.v_.regs_[r],
-                         EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0],
-                         EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[1] : EXPR_RVALUE(left)->v_.regs_[1],
-                         EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[2] : EXPR_RVALUE(left)->v_.regs_[2],
-                         EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[r*3 + 0] : EXPR_RVALUE(right)->v_.regs_[r*3 + 0],
-                         EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[r*3 + 1] : EXPR_RVALUE(right)->v_.regs_[r*3 + 1],
-                         EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[r*3 + 2] : EXPR_RVALUE(right)->v_.regs_[r*3 + 2]);
-    }
+    sl_ir_matrix_product(blk, chain_reg, frame, SLIR_VEC3_MUL_MAT3, dst, left, right);
   }
   else if ((left_kind == slrak_mat3) && (right_kind == slrak_vec3)) {
-    for (r = 0; r < 3; ++r) {
-      sl_ir_dot_product3(blk, chain_reg,
-                         dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[r] : dst->base_regs_.v_.regs_[r],
-                         EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[0 + r] : EXPR_RVALUE(left)->v_.regs_[0 + r],
-                         EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[3 + r] : EXPR_RVALUE(left)->v_.regs_[3 + r],
-                         EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[6 + r] : EXPR_RVALUE(left)->v_.regs_[6 + r],
-                         EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0],
-                         EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[1] : EXPR_RVALUE(right)->v_.regs_[1],
-                         EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[2] : EXPR_RVALUE(right)->v_.regs_[2]);
-    }
+    sl_ir_matrix_product(blk, chain_reg, frame, SLIR_MAT3_MUL_VEC3, dst, left, right);
   }
   else if ((left_kind == slrak_vec4) && (right_kind == slrak_mat4)) {
-    for (r = 0; r < 4; ++r) {
-      sl_ir_dot_product4(blk, chain_reg,
-                         dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[r] : dst->base_regs_.v_.regs_[r],
-                         EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0],
-                         EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[1] : EXPR_RVALUE(left)->v_.regs_[1],
-                         EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[2] : EXPR_RVALUE(left)->v_.regs_[2],
-                         EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[3] : EXPR_RVALUE(left)->v_.regs_[3],
-                         EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[r*4 + 0] : EXPR_RVALUE(right)->v_.regs_[r*4 + 0],
-                         EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[r*4 + 1] : EXPR_RVALUE(right)->v_.regs_[r*4 + 1],
-                         EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[r*4 + 2] : EXPR_RVALUE(right)->v_.regs_[r*4 + 2],
-                         EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[r*4 + 3] : EXPR_RVALUE(right)->v_.regs_[r*4 + 3]);
-    }
+    sl_ir_matrix_product(blk, chain_reg, frame, SLIR_VEC4_MUL_MAT4, dst, left, right);
   }
   else if ((left_kind == slrak_mat4) && (right_kind == slrak_vec4)) {
-    for (r = 0; r < 4; ++r) {
-      sl_ir_dot_product4(blk, chain_reg,
-                         dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[r] : dst->base_regs_.v_.regs_[r],
-                         EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[0 + r] : EXPR_RVALUE(left)->v_.regs_[0 + r],
-                         EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[4 + r] : EXPR_RVALUE(left)->v_.regs_[3 + r],
-                         EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[8 + r] : EXPR_RVALUE(left)->v_.regs_[6 + r],
-                         EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[12+ r] : EXPR_RVALUE(left)->v_.regs_[12+ r],
-                         EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0],
-                         EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[1] : EXPR_RVALUE(right)->v_.regs_[1],
-                         EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[2] : EXPR_RVALUE(right)->v_.regs_[2],
-                         EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[3] : EXPR_RVALUE(right)->v_.regs_[3]);
-    }
+    sl_ir_matrix_product(blk, chain_reg, frame, SLIR_MAT4_MUL_VEC4, dst, left, right);
   }
 }
 
@@ -2610,13 +2772,13 @@ static void sl_ir_div(struct ir_block *blk, struct ir_temp *chain_reg, struct sl
           case slrak_vec2: num_components = 2; break;
           case slrak_vec3: num_components = 3; break;
           case slrak_vec4: num_components = 4; break;
-          case slrak_mat2: num_components = 2; break;
-          case slrak_mat3: num_components = 3; break;
-          case slrak_mat4: num_components = 4; break;
+          case slrak_mat2: num_components = 4; break;
+          case slrak_mat3: num_components = 9; break;
+          case slrak_mat4: num_components = 16; break;
         }
         for (r = 0; r < num_components; ++r) {
           sl_ir_f_div(blk, chain_reg, 
-                      dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[r] : dst->base_regs_.v_.regs_[r],
+                      EXPR_RVALUE(dst)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(dst)->v_.regs_[r] : EXPR_RVALUE(dst)->v_.regs_[r],
                       EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[r] : EXPR_RVALUE(left)->v_.regs_[r],
                       EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[r] : EXPR_RVALUE(right)->v_.regs_[r]);
         }
@@ -2635,7 +2797,7 @@ static void sl_ir_div(struct ir_block *blk, struct ir_temp *chain_reg, struct sl
         }
         for (r = 0; r < num_components; ++r) {
           sl_ir_i_div(blk, chain_reg, 
-                      dst->base_regs_.local_frame_ ? frame->local_int_offset_ + dst->base_regs_.v_.regs_[r] : dst->base_regs_.v_.regs_[r],
+                      EXPR_RVALUE(dst)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(dst)->v_.regs_[r] : EXPR_RVALUE(dst)->v_.regs_[r],
                       EXPR_RVALUE(left)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(left)->v_.regs_[r] : EXPR_RVALUE(left)->v_.regs_[r],
                       EXPR_RVALUE(right)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(right)->v_.regs_[r] : EXPR_RVALUE(right)->v_.regs_[r]);
         }
@@ -2649,13 +2811,13 @@ static void sl_ir_div(struct ir_block *blk, struct ir_temp *chain_reg, struct sl
       case slrak_vec2: num_components = 2; break;
       case slrak_vec3: num_components = 3; break;
       case slrak_vec4: num_components = 4; break;
-      case slrak_mat2: num_components = 2; break;
-      case slrak_mat3: num_components = 3; break;
-      case slrak_mat4: num_components = 4; break;
+      case slrak_mat2: num_components = 4; break;
+      case slrak_mat3: num_components = 9; break;
+      case slrak_mat4: num_components = 16; break;
     }
     for (r = 0; r < num_components; ++r) {
       sl_ir_f_div(blk, chain_reg, 
-                  dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[r] : dst->base_regs_.v_.regs_[r],
+                  EXPR_RVALUE(dst)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(dst)->v_.regs_[r] : EXPR_RVALUE(dst)->v_.regs_[r],
                   EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0],
                   EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[r] : EXPR_RVALUE(right)->v_.regs_[r]);
     }
@@ -2666,13 +2828,13 @@ static void sl_ir_div(struct ir_block *blk, struct ir_temp *chain_reg, struct sl
       case slrak_vec2: num_components = 2; break;
       case slrak_vec3: num_components = 3; break;
       case slrak_vec4: num_components = 4; break;
-      case slrak_mat2: num_components = 2; break;
-      case slrak_mat3: num_components = 3; break;
-      case slrak_mat4: num_components = 4; break;
+      case slrak_mat2: num_components = 4; break;
+      case slrak_mat3: num_components = 9; break;
+      case slrak_mat4: num_components = 16; break;
     }
     for (r = 0; r < num_components; ++r) {
       sl_ir_f_div(blk, chain_reg, 
-                  dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[r] : dst->base_regs_.v_.regs_[r],
+                  EXPR_RVALUE(dst)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(dst)->v_.regs_[r] : EXPR_RVALUE(dst)->v_.regs_[r],
                   EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[r] : EXPR_RVALUE(left)->v_.regs_[r],
                   EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0]);
     }
@@ -2686,7 +2848,7 @@ static void sl_ir_div(struct ir_block *blk, struct ir_temp *chain_reg, struct sl
     }
     for (r = 0; r < num_components; ++r) {
       sl_ir_i_div(blk, chain_reg, 
-                  dst->base_regs_.local_frame_ ? frame->local_int_offset_ + dst->base_regs_.v_.regs_[r] : dst->base_regs_.v_.regs_[r],
+                  EXPR_RVALUE(dst)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(dst)->v_.regs_[r] : EXPR_RVALUE(dst)->v_.regs_[r],
                   EXPR_RVALUE(left)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0],
                   EXPR_RVALUE(right)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(right)->v_.regs_[r] : EXPR_RVALUE(right)->v_.regs_[r]);
     }
@@ -2700,7 +2862,7 @@ static void sl_ir_div(struct ir_block *blk, struct ir_temp *chain_reg, struct sl
     }
     for (r = 0; r < num_components; ++r) {
       sl_ir_i_div(blk, chain_reg, 
-                  dst->base_regs_.local_frame_ ? frame->local_int_offset_ + dst->base_regs_.v_.regs_[r] : dst->base_regs_.v_.regs_[r],
+                  EXPR_RVALUE(dst)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(dst)->v_.regs_[r] : EXPR_RVALUE(dst)->v_.regs_[r],
                   EXPR_RVALUE(left)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(left)->v_.regs_[r] : EXPR_RVALUE(left)->v_.regs_[r],
                   EXPR_RVALUE(right)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0]);
     }
@@ -2743,13 +2905,13 @@ static void sl_ir_add(struct ir_block *blk, struct ir_temp *chain_reg, struct sl
           case slrak_vec2: num_components = 2; break;
           case slrak_vec3: num_components = 3; break;
           case slrak_vec4: num_components = 4; break;
-          case slrak_mat2: num_components = 2; break;
-          case slrak_mat3: num_components = 3; break;
-          case slrak_mat4: num_components = 4; break;
+          case slrak_mat2: num_components = 4; break;
+          case slrak_mat3: num_components = 9; break;
+          case slrak_mat4: num_components = 16; break;
         }
         for (r = 0; r < num_components; ++r) {
           sl_ir_f_add(blk, chain_reg, 
-                      dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[r] : dst->base_regs_.v_.regs_[r],
+                      EXPR_RVALUE(dst)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(dst)->v_.regs_[r] : EXPR_RVALUE(dst)->v_.regs_[r],
                       EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[r] : EXPR_RVALUE(left)->v_.regs_[r],
                       EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[r] : EXPR_RVALUE(right)->v_.regs_[r]);
         }
@@ -2768,7 +2930,7 @@ static void sl_ir_add(struct ir_block *blk, struct ir_temp *chain_reg, struct sl
         }
         for (r = 0; r < num_components; ++r) {
           sl_ir_i_add(blk, chain_reg, 
-                      dst->base_regs_.local_frame_ ? frame->local_int_offset_ + dst->base_regs_.v_.regs_[r] : dst->base_regs_.v_.regs_[r],
+                      EXPR_RVALUE(dst)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(dst)->v_.regs_[r] : EXPR_RVALUE(dst)->v_.regs_[r],
                       EXPR_RVALUE(left)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(left)->v_.regs_[r] : EXPR_RVALUE(left)->v_.regs_[r],
                       EXPR_RVALUE(right)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(right)->v_.regs_[r] : EXPR_RVALUE(right)->v_.regs_[r]);
         }
@@ -2782,13 +2944,13 @@ static void sl_ir_add(struct ir_block *blk, struct ir_temp *chain_reg, struct sl
       case slrak_vec2: num_components = 2; break;
       case slrak_vec3: num_components = 3; break;
       case slrak_vec4: num_components = 4; break;
-      case slrak_mat2: num_components = 2; break;
-      case slrak_mat3: num_components = 3; break;
-      case slrak_mat4: num_components = 4; break;
+      case slrak_mat2: num_components = 4; break;
+      case slrak_mat3: num_components = 9; break;
+      case slrak_mat4: num_components = 16; break;
     }
     for (r = 0; r < num_components; ++r) {
       sl_ir_f_add(blk, chain_reg, 
-                  dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[r] : dst->base_regs_.v_.regs_[r],
+                  EXPR_RVALUE(dst)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(dst)->v_.regs_[r] : EXPR_RVALUE(dst)->v_.regs_[r],
                   EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0],
                   EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[r] : EXPR_RVALUE(right)->v_.regs_[r]);
     }
@@ -2799,13 +2961,13 @@ static void sl_ir_add(struct ir_block *blk, struct ir_temp *chain_reg, struct sl
       case slrak_vec2: num_components = 2; break;
       case slrak_vec3: num_components = 3; break;
       case slrak_vec4: num_components = 4; break;
-      case slrak_mat2: num_components = 2; break;
-      case slrak_mat3: num_components = 3; break;
-      case slrak_mat4: num_components = 4; break;
+      case slrak_mat2: num_components = 4; break;
+      case slrak_mat3: num_components = 9; break;
+      case slrak_mat4: num_components = 16; break;
     }
     for (r = 0; r < num_components; ++r) {
       sl_ir_f_add(blk, chain_reg, 
-                  dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[r] : dst->base_regs_.v_.regs_[r],
+                  EXPR_RVALUE(dst)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(dst)->v_.regs_[r] : EXPR_RVALUE(dst)->v_.regs_[r],
                   EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[r] : EXPR_RVALUE(left)->v_.regs_[r],
                   EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0]);
     }
@@ -2819,7 +2981,7 @@ static void sl_ir_add(struct ir_block *blk, struct ir_temp *chain_reg, struct sl
     }
     for (r = 0; r < num_components; ++r) {
       sl_ir_i_add(blk, chain_reg, 
-                  dst->base_regs_.local_frame_ ? frame->local_int_offset_ + dst->base_regs_.v_.regs_[r] : dst->base_regs_.v_.regs_[r],
+                  EXPR_RVALUE(dst)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(dst)->v_.regs_[r] : EXPR_RVALUE(dst)->v_.regs_[r],
                   EXPR_RVALUE(left)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0],
                   EXPR_RVALUE(right)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(right)->v_.regs_[r] : EXPR_RVALUE(right)->v_.regs_[r]);
     }
@@ -2833,7 +2995,7 @@ static void sl_ir_add(struct ir_block *blk, struct ir_temp *chain_reg, struct sl
     }
     for (r = 0; r < num_components; ++r) {
       sl_ir_i_add(blk, chain_reg, 
-                  dst->base_regs_.local_frame_ ? frame->local_int_offset_ + dst->base_regs_.v_.regs_[r] : dst->base_regs_.v_.regs_[r],
+                  EXPR_RVALUE(dst)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(dst)->v_.regs_[r] : EXPR_RVALUE(dst)->v_.regs_[r],
                   EXPR_RVALUE(left)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(left)->v_.regs_[r] : EXPR_RVALUE(left)->v_.regs_[r],
                   EXPR_RVALUE(right)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0]);
     }
@@ -2876,13 +3038,13 @@ static void sl_ir_sub(struct ir_block *blk, struct ir_temp *chain_reg, struct sl
           case slrak_vec2: num_components = 2; break;
           case slrak_vec3: num_components = 3; break;
           case slrak_vec4: num_components = 4; break;
-          case slrak_mat2: num_components = 2; break;
-          case slrak_mat3: num_components = 3; break;
-          case slrak_mat4: num_components = 4; break;
+          case slrak_mat2: num_components = 4; break;
+          case slrak_mat3: num_components = 9; break;
+          case slrak_mat4: num_components = 16; break;
         }
         for (r = 0; r < num_components; ++r) {
           sl_ir_f_sub(blk, chain_reg, 
-                      dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[r] : dst->base_regs_.v_.regs_[r],
+                      EXPR_RVALUE(dst)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(dst)->v_.regs_[r] : EXPR_RVALUE(dst)->v_.regs_[r],
                       EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[r] : EXPR_RVALUE(left)->v_.regs_[r],
                       EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[r] : EXPR_RVALUE(right)->v_.regs_[r]);
         }
@@ -2901,7 +3063,7 @@ static void sl_ir_sub(struct ir_block *blk, struct ir_temp *chain_reg, struct sl
         }
         for (r = 0; r < num_components; ++r) {
           sl_ir_i_sub(blk, chain_reg, 
-                      dst->base_regs_.local_frame_ ? frame->local_int_offset_ + dst->base_regs_.v_.regs_[r] : dst->base_regs_.v_.regs_[r],
+                      EXPR_RVALUE(dst)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(dst)->v_.regs_[r] : EXPR_RVALUE(dst)->v_.regs_[r],
                       EXPR_RVALUE(left)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(left)->v_.regs_[r] : EXPR_RVALUE(left)->v_.regs_[r],
                       EXPR_RVALUE(right)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(right)->v_.regs_[r] : EXPR_RVALUE(right)->v_.regs_[r]);
         }
@@ -2915,13 +3077,13 @@ static void sl_ir_sub(struct ir_block *blk, struct ir_temp *chain_reg, struct sl
       case slrak_vec2: num_components = 2; break;
       case slrak_vec3: num_components = 3; break;
       case slrak_vec4: num_components = 4; break;
-      case slrak_mat2: num_components = 2; break;
-      case slrak_mat3: num_components = 3; break;
-      case slrak_mat4: num_components = 4; break;
+      case slrak_mat2: num_components = 4; break;
+      case slrak_mat3: num_components = 9; break;
+      case slrak_mat4: num_components = 16; break;
     }
     for (r = 0; r < num_components; ++r) {
       sl_ir_f_sub(blk, chain_reg, 
-                  dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[r] : dst->base_regs_.v_.regs_[r],
+                  EXPR_RVALUE(dst)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(dst)->v_.regs_[r] : EXPR_RVALUE(dst)->v_.regs_[r],
                   EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0],
                   EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[r] : EXPR_RVALUE(right)->v_.regs_[r]);
     }
@@ -2932,13 +3094,13 @@ static void sl_ir_sub(struct ir_block *blk, struct ir_temp *chain_reg, struct sl
       case slrak_vec2: num_components = 2; break;
       case slrak_vec3: num_components = 3; break;
       case slrak_vec4: num_components = 4; break;
-      case slrak_mat2: num_components = 2; break;
-      case slrak_mat3: num_components = 3; break;
-      case slrak_mat4: num_components = 4; break;
+      case slrak_mat2: num_components = 4; break;
+      case slrak_mat3: num_components = 9; break;
+      case slrak_mat4: num_components = 16; break;
     }
     for (r = 0; r < num_components; ++r) {
       sl_ir_f_sub(blk, chain_reg, 
-                  dst->base_regs_.local_frame_ ? frame->local_float_offset_ + dst->base_regs_.v_.regs_[r] : dst->base_regs_.v_.regs_[r],
+                  EXPR_RVALUE(dst)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(dst)->v_.regs_[r] : EXPR_RVALUE(dst)->v_.regs_[r],
                   EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[r] : EXPR_RVALUE(left)->v_.regs_[r],
                   EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0]);
     }
@@ -2952,7 +3114,7 @@ static void sl_ir_sub(struct ir_block *blk, struct ir_temp *chain_reg, struct sl
     }
     for (r = 0; r < num_components; ++r) {
       sl_ir_i_sub(blk, chain_reg, 
-                  dst->base_regs_.local_frame_ ? frame->local_int_offset_ + dst->base_regs_.v_.regs_[r] : dst->base_regs_.v_.regs_[r],
+                  EXPR_RVALUE(dst)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(dst)->v_.regs_[r] : EXPR_RVALUE(dst)->v_.regs_[r],
                   EXPR_RVALUE(left)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0],
                   EXPR_RVALUE(right)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(right)->v_.regs_[r] : EXPR_RVALUE(right)->v_.regs_[r]);
     }
@@ -2966,7 +3128,7 @@ static void sl_ir_sub(struct ir_block *blk, struct ir_temp *chain_reg, struct sl
     }
     for (r = 0; r < num_components; ++r) {
       sl_ir_i_sub(blk, chain_reg, 
-                  dst->base_regs_.local_frame_ ? frame->local_int_offset_ + dst->base_regs_.v_.regs_[r] : dst->base_regs_.v_.regs_[r],
+                  EXPR_RVALUE(dst)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(dst)->v_.regs_[r] : EXPR_RVALUE(dst)->v_.regs_[r],
                   EXPR_RVALUE(left)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(left)->v_.regs_[r] : EXPR_RVALUE(left)->v_.regs_[r],
                   EXPR_RVALUE(right)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0]);
     }
@@ -2979,14 +3141,14 @@ static void sl_ir_lt(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_
   if (left->base_regs_.kind_ == slrak_float) {
     instr = ir_block_append_instr(blk, SLIR_LT_F);
     ir_instr_append_use(instr, chain_reg);
-    ir_instr_append_def(instr, ir_body_alloc_temp_banked_bool(blk->body_, dst->base_regs_.local_frame_ ? frame->local_bool_offset_ + dst->base_regs_.v_.regs_[0] : dst->base_regs_.v_.regs_[0]));
+    ir_instr_append_def(instr, ir_body_alloc_temp_banked_bool(blk->body_, EXPR_RVALUE(dst)->local_frame_ ? frame->local_bool_offset_ + EXPR_RVALUE(dst)->v_.regs_[0] : EXPR_RVALUE(dst)->v_.regs_[0]));
     ir_instr_append_use(instr, ir_body_alloc_temp_banked_float(blk->body_, EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0]));
     ir_instr_append_use(instr, ir_body_alloc_temp_banked_float(blk->body_, EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0]));
   }
   else if (left->base_regs_.kind_ == slrak_int) {
     instr = ir_block_append_instr(blk, SLIR_LT_I);
     ir_instr_append_use(instr, chain_reg);
-    ir_instr_append_def(instr, ir_body_alloc_temp_banked_bool(blk->body_, dst->base_regs_.local_frame_ ? frame->local_bool_offset_ + dst->base_regs_.v_.regs_[0] : dst->base_regs_.v_.regs_[0]));
+    ir_instr_append_def(instr, ir_body_alloc_temp_banked_bool(blk->body_, EXPR_RVALUE(dst)->local_frame_ ? frame->local_bool_offset_ + EXPR_RVALUE(dst)->v_.regs_[0] : EXPR_RVALUE(dst)->v_.regs_[0]));
     ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, EXPR_RVALUE(left)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0]));
     ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, EXPR_RVALUE(right)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0]));
   }
@@ -3001,14 +3163,14 @@ static void sl_ir_le(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_
   if (left->base_regs_.kind_ == slrak_float) {
     instr = ir_block_append_instr(blk, SLIR_LE_F);
     ir_instr_append_use(instr, chain_reg);
-    ir_instr_append_def(instr, ir_body_alloc_temp_banked_bool(blk->body_, dst->base_regs_.local_frame_ ? frame->local_bool_offset_ + dst->base_regs_.v_.regs_[0] : dst->base_regs_.v_.regs_[0]));
+    ir_instr_append_def(instr, ir_body_alloc_temp_banked_bool(blk->body_, EXPR_RVALUE(dst)->local_frame_ ? frame->local_bool_offset_ + EXPR_RVALUE(dst)->v_.regs_[0] : EXPR_RVALUE(dst)->v_.regs_[0]));
     ir_instr_append_use(instr, ir_body_alloc_temp_banked_float(blk->body_, EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0]));
     ir_instr_append_use(instr, ir_body_alloc_temp_banked_float(blk->body_, EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0]));
   }
   else if (left->base_regs_.kind_ == slrak_int) {
     instr = ir_block_append_instr(blk, SLIR_LE_I);
     ir_instr_append_use(instr, chain_reg);
-    ir_instr_append_def(instr, ir_body_alloc_temp_banked_bool(blk->body_, dst->base_regs_.local_frame_ ? frame->local_bool_offset_ + dst->base_regs_.v_.regs_[0] : dst->base_regs_.v_.regs_[0]));
+    ir_instr_append_def(instr, ir_body_alloc_temp_banked_bool(blk->body_, EXPR_RVALUE(dst)->local_frame_ ? frame->local_bool_offset_ + EXPR_RVALUE(dst)->v_.regs_[0] : EXPR_RVALUE(dst)->v_.regs_[0]));
     ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, EXPR_RVALUE(left)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0]));
     ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, EXPR_RVALUE(right)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0]));
   }
@@ -3023,14 +3185,14 @@ static void sl_ir_ge(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_
   if (left->base_regs_.kind_ == slrak_float) {
     instr = ir_block_append_instr(blk, SLIR_GE_F);
     ir_instr_append_use(instr, chain_reg);
-    ir_instr_append_def(instr, ir_body_alloc_temp_banked_bool(blk->body_, dst->base_regs_.local_frame_ ? frame->local_bool_offset_ + dst->base_regs_.v_.regs_[0] : dst->base_regs_.v_.regs_[0]));
+    ir_instr_append_def(instr, ir_body_alloc_temp_banked_bool(blk->body_, EXPR_RVALUE(dst)->local_frame_ ? frame->local_bool_offset_ + EXPR_RVALUE(dst)->v_.regs_[0] : EXPR_RVALUE(dst)->v_.regs_[0]));
     ir_instr_append_use(instr, ir_body_alloc_temp_banked_float(blk->body_, EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0]));
     ir_instr_append_use(instr, ir_body_alloc_temp_banked_float(blk->body_, EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0]));
   }
   else if (left->base_regs_.kind_ == slrak_int) {
     instr = ir_block_append_instr(blk, SLIR_GE_I);
     ir_instr_append_use(instr, chain_reg);
-    ir_instr_append_def(instr, ir_body_alloc_temp_banked_bool(blk->body_, dst->base_regs_.local_frame_ ? frame->local_bool_offset_ + dst->base_regs_.v_.regs_[0] : dst->base_regs_.v_.regs_[0]));
+    ir_instr_append_def(instr, ir_body_alloc_temp_banked_bool(blk->body_, EXPR_RVALUE(dst)->local_frame_ ? frame->local_bool_offset_ + EXPR_RVALUE(dst)->v_.regs_[0] : EXPR_RVALUE(dst)->v_.regs_[0]));
     ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, EXPR_RVALUE(left)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0]));
     ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, EXPR_RVALUE(right)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0]));
   }
@@ -3045,14 +3207,14 @@ static void sl_ir_gt(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_
   if (left->base_regs_.kind_ == slrak_float) {
     instr = ir_block_append_instr(blk, SLIR_GT_F);
     ir_instr_append_use(instr, chain_reg);
-    ir_instr_append_def(instr, ir_body_alloc_temp_banked_bool(blk->body_, dst->base_regs_.local_frame_ ? frame->local_bool_offset_ + dst->base_regs_.v_.regs_[0] : dst->base_regs_.v_.regs_[0]));
+    ir_instr_append_def(instr, ir_body_alloc_temp_banked_bool(blk->body_, EXPR_RVALUE(dst)->local_frame_ ? frame->local_bool_offset_ + EXPR_RVALUE(dst)->v_.regs_[0] : EXPR_RVALUE(dst)->v_.regs_[0]));
     ir_instr_append_use(instr, ir_body_alloc_temp_banked_float(blk->body_, EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0]));
     ir_instr_append_use(instr, ir_body_alloc_temp_banked_float(blk->body_, EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0]));
   }
   else if (left->base_regs_.kind_ == slrak_int) {
     instr = ir_block_append_instr(blk, SLIR_GT_I);
     ir_instr_append_use(instr, chain_reg);
-    ir_instr_append_def(instr, ir_body_alloc_temp_banked_bool(blk->body_, dst->base_regs_.local_frame_ ? frame->local_bool_offset_ + dst->base_regs_.v_.regs_[0] : dst->base_regs_.v_.regs_[0]));
+    ir_instr_append_def(instr, ir_body_alloc_temp_banked_bool(blk->body_, EXPR_RVALUE(dst)->local_frame_ ? frame->local_bool_offset_ + EXPR_RVALUE(dst)->v_.regs_[0] : EXPR_RVALUE(dst)->v_.regs_[0]));
     ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, EXPR_RVALUE(left)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0]));
     ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, EXPR_RVALUE(right)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0]));
   }
@@ -3067,14 +3229,14 @@ static void sl_ir_eq(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_
   if (left->base_regs_.kind_ == slrak_float) {
     instr = ir_block_append_instr(blk, SLIR_EQ_F);
     ir_instr_append_use(instr, chain_reg);
-    ir_instr_append_def(instr, ir_body_alloc_temp_banked_bool(blk->body_, dst->base_regs_.local_frame_ ? frame->local_bool_offset_ + dst->base_regs_.v_.regs_[0] : dst->base_regs_.v_.regs_[0]));
+    ir_instr_append_def(instr, ir_body_alloc_temp_banked_bool(blk->body_, EXPR_RVALUE(dst)->local_frame_ ? frame->local_bool_offset_ + EXPR_RVALUE(dst)->v_.regs_[0] : EXPR_RVALUE(dst)->v_.regs_[0]));
     ir_instr_append_use(instr, ir_body_alloc_temp_banked_float(blk->body_, EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0]));
     ir_instr_append_use(instr, ir_body_alloc_temp_banked_float(blk->body_, EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0]));
   }
   else if (left->base_regs_.kind_ == slrak_int) {
     instr = ir_block_append_instr(blk, SLIR_EQ_I);
     ir_instr_append_use(instr, chain_reg);
-    ir_instr_append_def(instr, ir_body_alloc_temp_banked_bool(blk->body_, dst->base_regs_.local_frame_ ? frame->local_bool_offset_ + dst->base_regs_.v_.regs_[0] : dst->base_regs_.v_.regs_[0]));
+    ir_instr_append_def(instr, ir_body_alloc_temp_banked_bool(blk->body_, EXPR_RVALUE(dst)->local_frame_ ? frame->local_bool_offset_ + EXPR_RVALUE(dst)->v_.regs_[0] : EXPR_RVALUE(dst)->v_.regs_[0]));
     ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, EXPR_RVALUE(left)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0]));
     ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, EXPR_RVALUE(right)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0]));
   }
@@ -3089,14 +3251,14 @@ static void sl_ir_ne(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_
   if (left->base_regs_.kind_ == slrak_float) {
     instr = ir_block_append_instr(blk, SLIR_NE_F);
     ir_instr_append_use(instr, chain_reg);
-    ir_instr_append_def(instr, ir_body_alloc_temp_banked_bool(blk->body_, dst->base_regs_.local_frame_ ? frame->local_bool_offset_ + dst->base_regs_.v_.regs_[0] : dst->base_regs_.v_.regs_[0]));
+    ir_instr_append_def(instr, ir_body_alloc_temp_banked_bool(blk->body_, EXPR_RVALUE(dst)->local_frame_ ? frame->local_bool_offset_ + EXPR_RVALUE(dst)->v_.regs_[0] : EXPR_RVALUE(dst)->v_.regs_[0]));
     ir_instr_append_use(instr, ir_body_alloc_temp_banked_float(blk->body_, EXPR_RVALUE(left)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0]));
     ir_instr_append_use(instr, ir_body_alloc_temp_banked_float(blk->body_, EXPR_RVALUE(right)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0]));
   }
   else if (left->base_regs_.kind_ == slrak_int) {
     instr = ir_block_append_instr(blk, SLIR_NE_I);
     ir_instr_append_use(instr, chain_reg);
-    ir_instr_append_def(instr, ir_body_alloc_temp_banked_bool(blk->body_, dst->base_regs_.local_frame_ ? frame->local_bool_offset_ + dst->base_regs_.v_.regs_[0] : dst->base_regs_.v_.regs_[0]));
+    ir_instr_append_def(instr, ir_body_alloc_temp_banked_bool(blk->body_, EXPR_RVALUE(dst)->local_frame_ ? frame->local_bool_offset_ + EXPR_RVALUE(dst)->v_.regs_[0] : EXPR_RVALUE(dst)->v_.regs_[0]));
     ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, EXPR_RVALUE(left)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0]));
     ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, EXPR_RVALUE(right)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0]));
   }
@@ -3108,7 +3270,7 @@ static void sl_ir_ne(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_
 static void sl_ir_log_xor(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_execution_frame *frame, struct sl_expr *dst, struct sl_expr *left, struct sl_expr *right) {
   struct ir_instr *instr = ir_block_append_instr(blk, SLIR_LOG_XOR);
   ir_instr_append_use(instr, chain_reg);
-  ir_instr_append_def(instr, ir_body_alloc_temp_banked_bool(blk->body_, dst->base_regs_.local_frame_ ? frame->local_bool_offset_ + dst->base_regs_.v_.regs_[0] : dst->base_regs_.v_.regs_[0]));
+  ir_instr_append_def(instr, ir_body_alloc_temp_banked_bool(blk->body_, EXPR_RVALUE(dst)->local_frame_ ? frame->local_bool_offset_ + EXPR_RVALUE(dst)->v_.regs_[0] : EXPR_RVALUE(dst)->v_.regs_[0]));
   ir_instr_append_use(instr, ir_body_alloc_temp_banked_bool(blk->body_, EXPR_RVALUE(left)->local_frame_ ? frame->local_bool_offset_ + EXPR_RVALUE(left)->v_.regs_[0] : EXPR_RVALUE(left)->v_.regs_[0]));
   ir_instr_append_use(instr, ir_body_alloc_temp_banked_bool(blk->body_, EXPR_RVALUE(right)->local_frame_ ? frame->local_bool_offset_ + EXPR_RVALUE(right)->v_.regs_[0] : EXPR_RVALUE(right)->v_.regs_[0]));
 }
@@ -3127,8 +3289,8 @@ static void sl_ir_i_inc(struct ir_block *blk, struct ir_temp *chain_reg, int dst
   ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, opd_reg));
 }
 
-static void sl_ir_inc(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_execution_frame *frame, struct sl_reg_alloc *dst_ra, struct sl_expr *opd) {
-  sl_reg_alloc_kind_t kind = EXPR_RVALUE(opd)->kind_;
+static void sl_ir_inc(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_execution_frame *frame, struct sl_reg_alloc *dst_ra, struct sl_reg_alloc *opd_ra) {
+  sl_reg_alloc_kind_t kind = opd_ra->kind_;
   switch (kind) {
     case slrak_float:
     case slrak_vec2:
@@ -3151,7 +3313,7 @@ static void sl_ir_inc(struct ir_block *blk, struct ir_temp *chain_reg, struct sl
       for (n = 0; n < num_components; ++n) {
         sl_ir_f_inc(blk, chain_reg,  
                     dst_ra->local_frame_ ? frame->local_float_offset_ + dst_ra->v_.regs_[n] : dst_ra->v_.regs_[n],
-                    EXPR_RVALUE(opd)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(opd)->v_.regs_[n] : EXPR_RVALUE(opd)->v_.regs_[n]);
+                    opd_ra->local_frame_ ? frame->local_float_offset_ + opd_ra->v_.regs_[n] : opd_ra->v_.regs_[n]);
       }
       break;
     }
@@ -3168,9 +3330,9 @@ static void sl_ir_inc(struct ir_block *blk, struct ir_temp *chain_reg, struct sl
       }
       size_t n;
       for (n = 0; n < num_components; ++n) {
-        sl_ir_f_inc(blk, chain_reg, 
+        sl_ir_i_inc(blk, chain_reg, 
                     dst_ra->local_frame_ ? frame->local_int_offset_ + dst_ra->v_.regs_[n] : dst_ra->v_.regs_[n],
-                    EXPR_RVALUE(opd)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(opd)->v_.regs_[n] : EXPR_RVALUE(opd)->v_.regs_[n]);
+                    opd_ra->local_frame_ ? frame->local_int_offset_ + opd_ra->v_.regs_[n] : opd_ra->v_.regs_[n]);
       }
       break;
     }
@@ -3191,8 +3353,8 @@ static void sl_ir_i_dec(struct ir_block *blk, struct ir_temp *chain_reg, int dst
   ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, opd_reg));
 }
 
-static void sl_ir_dec(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_execution_frame *frame, struct sl_reg_alloc *dst_ra, struct sl_expr *opd) {
-  sl_reg_alloc_kind_t kind = EXPR_RVALUE(opd)->kind_;
+static void sl_ir_dec(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_execution_frame *frame, struct sl_reg_alloc *dst_ra, struct sl_reg_alloc *opd_ra) {
+  sl_reg_alloc_kind_t kind = opd_ra->kind_;
   switch (kind) {
     case slrak_float:
     case slrak_vec2:
@@ -3215,7 +3377,7 @@ static void sl_ir_dec(struct ir_block *blk, struct ir_temp *chain_reg, struct sl
       for (n = 0; n < num_components; ++n) {
         sl_ir_f_dec(blk, chain_reg, 
                     dst_ra->local_frame_ ? frame->local_float_offset_ + dst_ra->v_.regs_[n] : dst_ra->v_.regs_[n],
-                    EXPR_RVALUE(opd)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(opd)->v_.regs_[n] : EXPR_RVALUE(opd)->v_.regs_[n]);
+                    opd_ra->local_frame_ ? frame->local_float_offset_ + opd_ra->v_.regs_[n] : opd_ra->v_.regs_[n]);
       }
       break;
     }
@@ -3232,9 +3394,9 @@ static void sl_ir_dec(struct ir_block *blk, struct ir_temp *chain_reg, struct sl
       }
       size_t n;
       for (n = 0; n < num_components; ++n) {
-        sl_ir_f_dec(blk, chain_reg, 
+        sl_ir_i_dec(blk, chain_reg, 
                     dst_ra->local_frame_ ? frame->local_int_offset_ + dst_ra->v_.regs_[n] : dst_ra->v_.regs_[n],
-                    EXPR_RVALUE(opd)->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(opd)->v_.regs_[n] : EXPR_RVALUE(opd)->v_.regs_[n]);
+                    opd_ra->local_frame_ ? frame->local_int_offset_ + opd_ra->v_.regs_[n] : opd_ra->v_.regs_[n]);
       }
       break;
     }
@@ -3244,7 +3406,7 @@ static void sl_ir_dec(struct ir_block *blk, struct ir_temp *chain_reg, struct sl
 static void sl_ir_f_init_lit(struct ir_block *blk, struct ir_temp *chain_reg, int dst_reg, float lit) {
   struct ir_instr *instr = ir_block_append_instr(blk, SLIR_INIT_LIT_F);
   ir_instr_append_use(instr, chain_reg);
-  ir_instr_append_def(instr, ir_body_alloc_temp_banked_int(blk->body_, dst_reg));
+  ir_instr_append_def(instr, ir_body_alloc_temp_banked_float(blk->body_, dst_reg));
   ir_instr_append_use(instr, ir_body_alloc_temp_litf(blk->body_, lit));
 }
 
@@ -3258,7 +3420,7 @@ static void sl_ir_i_init_lit(struct ir_block *blk, struct ir_temp *chain_reg, in
 static void sl_ir_b_init_lit(struct ir_block *blk, struct ir_temp *chain_reg, int dst_reg, int lit) {
   struct ir_instr *instr = ir_block_append_instr(blk, SLIR_INIT_LIT_B);
   ir_instr_append_use(instr, chain_reg);
-  ir_instr_append_def(instr, ir_body_alloc_temp_banked_int(blk->body_, dst_reg));
+  ir_instr_append_def(instr, ir_body_alloc_temp_banked_bool(blk->body_, dst_reg));
   ir_instr_append_use(instr, ir_body_alloc_temp_litb(blk->body_, lit));
 }
 
@@ -3368,432 +3530,603 @@ static void sl_ir_i_mul_constant_and_add(struct ir_block *blk, struct ir_temp *c
   ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, offset));
 }
 
-static void sl_ir_component_subscript(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_execution_frame *frame, struct sl_expr *dst, struct sl_expr *arr, struct sl_expr *subscript) {
-  struct sl_reg_alloc *dst_ra = &dst->base_regs_;
-  struct sl_reg_alloc *array_ra = EXPR_RVALUE(arr);
-  struct sl_reg_alloc *subscript_ra = EXPR_RVALUE(subscript);
-  switch (array_ra->kind_) {
+/* Returns the local frame offset for registers of the category implied by kind */
+static int sl_ir_frame_offset(struct sl_execution_frame *frame, sl_reg_alloc_kind_t kind) {
+  switch (kind) {
+    case slrak_float:
     case slrak_vec2:
-    case slrak_ivec2:
-    case slrak_bvec2: {
-      struct ir_instr *instr;
-      instr = ir_block_append_instr(blk, array_ra->is_indirect_ ? SLIR_PICK_FROM_2_INDIRECT : SLIR_PICK_FROM_2);
-      ir_instr_append_use(instr, chain_reg);
-      ir_instr_append_def(instr, ir_body_alloc_temp_banked_int(blk->body_, dst_ra->v_.regs_[0]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, subscript_ra->v_.regs_[0]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[0]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[1]));
-      break;
-    }
     case slrak_vec3:
-    case slrak_ivec3:
-    case slrak_bvec3: {
-      struct ir_instr *instr;
-      instr = ir_block_append_instr(blk, array_ra->is_indirect_ ? SLIR_PICK_FROM_3_INDIRECT : SLIR_PICK_FROM_3);
-      ir_instr_append_use(instr, chain_reg);
-      ir_instr_append_def(instr, ir_body_alloc_temp_banked_int(blk->body_, dst_ra->v_.regs_[0]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, subscript_ra->v_.regs_[0]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[0]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[1]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[2]));
-      break;
-    }
     case slrak_vec4:
+    case slrak_mat2:
+    case slrak_mat3:
+    case slrak_mat4:
+      return frame->local_float_offset_;
+    case slrak_int:
+    case slrak_ivec2:
+    case slrak_ivec3:
     case slrak_ivec4:
-    case slrak_bvec4: {
-      struct ir_instr *instr;
-      instr = ir_block_append_instr(blk, array_ra->is_indirect_ ? SLIR_PICK_FROM_4_INDIRECT : SLIR_PICK_FROM_4);
-      ir_instr_append_use(instr, chain_reg);
-      ir_instr_append_def(instr, ir_body_alloc_temp_banked_int(blk->body_, dst_ra->v_.regs_[0]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, subscript_ra->v_.regs_[0]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[0]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[1]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[2]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[3]));
-      break;
-    }
-    case slrak_mat2: {
-      struct ir_instr *instr;
-      instr = ir_block_append_instr(blk, array_ra->is_indirect_ ? SLIR_PICK_FROM_2_INDIRECT : SLIR_PICK_FROM_2);
-      ir_instr_append_use(instr, chain_reg);
-      ir_instr_append_def(instr, ir_body_alloc_temp_banked_int(blk->body_, dst_ra->v_.regs_[0]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, subscript_ra->v_.regs_[0]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[0]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[2]));
-
-      instr = ir_block_append_instr(blk, array_ra->is_indirect_ ? SLIR_PICK_FROM_2_INDIRECT : SLIR_PICK_FROM_2);
-      ir_instr_append_use(instr, chain_reg);
-      ir_instr_append_def(instr, ir_body_alloc_temp_banked_int(blk->body_, dst_ra->v_.regs_[1]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, subscript_ra->v_.regs_[0]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[1]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[3]));
+      return frame->local_int_offset_;
+    case slrak_bool:
+    case slrak_bvec2:
+    case slrak_bvec3:
+    case slrak_bvec4:
+      return frame->local_bool_offset_;
+    case slrak_sampler2D:
+      return frame->local_sampler2D_offset_;
+    case slrak_samplerCube:
+      return frame->local_samplerCube_offset_;
+  }
+  return 0;
+}
+
+/* Returns the absolute register index of component n of ra; for indirect reg_allocs this is the
+ * integer register holding the actual register index. */
+static int sl_ir_reg_index(struct sl_execution_frame *frame, const struct sl_reg_alloc *ra, int n) {
+  if (!ra->local_frame_) return ra->v_.regs_[n];
+  if (ra->is_indirect_) return frame->local_int_offset_ + ra->v_.regs_[n];
+  return sl_ir_frame_offset(frame, ra->kind_) + ra->v_.regs_[n];
+}
+
+/* Component subscript of a vector or matrix (e.g. "v[i]" for a vec4 v), stores the index of the register
+ * holding the selected component (or column) in the int registers of dst_ra, dst_ra itself is indirect.
+ * This is the SLIR equivalent of sl_exec_load_effective_reg_index(). */
+static void sl_ir_component_subscript(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_execution_frame *frame,
+                                      struct sl_reg_alloc *dst_ra, struct sl_reg_alloc *src_ra, struct sl_reg_alloc *index_ra) {
+  int column_size = 0; /* 0 for vectors, where a scalar component is selected, otherwise the rows per column */
+  int num_choices;
+  int k, n;
+  switch (src_ra->kind_) {
+    case slrak_vec2: case slrak_ivec2: case slrak_bvec2: num_choices = 2; break;
+    case slrak_vec3: case slrak_ivec3: case slrak_bvec3: num_choices = 3; break;
+    case slrak_vec4: case slrak_ivec4: case slrak_bvec4: num_choices = 4; break;
+    case slrak_mat2: num_choices = column_size = 2; break;
+    case slrak_mat3: num_choices = column_size = 3; break;
+    case slrak_mat4: num_choices = column_size = 4; break;
+    default:
+      return;
+  }
+
+  for (k = 0; k < (column_size ? column_size : 1); ++k) {
+    struct ir_instr *instr;
+    if (src_ra->is_indirect_) {
+      instr = ir_block_append_instr(blk, SLIR_PICK_FROM_2_INDIRECT + num_choices - 2);
     }
-    case slrak_mat3: {
-      struct ir_instr *instr;
-      instr = ir_block_append_instr(blk, array_ra->is_indirect_ ? SLIR_PICK_FROM_3_INDIRECT : SLIR_PICK_FROM_3);
-      ir_instr_append_use(instr, chain_reg);
-      ir_instr_append_def(instr, ir_body_alloc_temp_banked_int(blk->body_, dst_ra->v_.regs_[0]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, subscript_ra->v_.regs_[0]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[0]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[3]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[9]));
-
-      instr = ir_block_append_instr(blk, array_ra->is_indirect_ ? SLIR_PICK_FROM_3_INDIRECT : SLIR_PICK_FROM_3);
-      ir_instr_append_use(instr, chain_reg);
-      ir_instr_append_def(instr, ir_body_alloc_temp_banked_int(blk->body_, dst_ra->v_.regs_[1]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, subscript_ra->v_.regs_[0]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[1]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[4]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[10]));
-
-      instr = ir_block_append_instr(blk, array_ra->is_indirect_ ? SLIR_PICK_FROM_3_INDIRECT : SLIR_PICK_FROM_3);
-      ir_instr_append_use(instr, chain_reg);
-      ir_instr_append_def(instr, ir_body_alloc_temp_banked_int(blk->body_, dst_ra->v_.regs_[2]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, subscript_ra->v_.regs_[0]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[2]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[5]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[11]));
+    else {
+      instr = ir_block_append_instr(blk, SLIR_PICK_FROM_2 + num_choices - 2);
     }
-    case slrak_mat4: {
-      struct ir_instr *instr;
-      instr = ir_block_append_instr(blk, array_ra->is_indirect_ ? SLIR_PICK_FROM_4_INDIRECT : SLIR_PICK_FROM_4);
-      ir_instr_append_use(instr, chain_reg);
-      ir_instr_append_def(instr, ir_body_alloc_temp_banked_int(blk->body_, dst_ra->v_.regs_[0]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, subscript_ra->v_.regs_[0]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[0]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[4]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[8]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[12]));
-
-      instr = ir_block_append_instr(blk, array_ra->is_indirect_ ? SLIR_PICK_FROM_4_INDIRECT : SLIR_PICK_FROM_4);
-      ir_instr_append_use(instr, chain_reg);
-      ir_instr_append_def(instr, ir_body_alloc_temp_banked_int(blk->body_, dst_ra->v_.regs_[1]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, subscript_ra->v_.regs_[0]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[1]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[5]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[9]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[13]));
-
-      instr = ir_block_append_instr(blk, array_ra->is_indirect_ ? SLIR_PICK_FROM_4_INDIRECT : SLIR_PICK_FROM_4);
-      ir_instr_append_use(instr, chain_reg);
-      ir_instr_append_def(instr, ir_body_alloc_temp_banked_int(blk->body_, dst_ra->v_.regs_[2]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, subscript_ra->v_.regs_[0]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[2]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[6]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[10]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[14]));
-
-      instr = ir_block_append_instr(blk, array_ra->is_indirect_ ? SLIR_PICK_FROM_4_INDIRECT : SLIR_PICK_FROM_4);
-      ir_instr_append_use(instr, chain_reg);
-      ir_instr_append_def(instr, ir_body_alloc_temp_banked_int(blk->body_, dst_ra->v_.regs_[3]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, subscript_ra->v_.regs_[0]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[3]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[7]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[9]));
-      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, array_ra->v_.regs_[15]));
+    ir_instr_append_use(instr, chain_reg);
+    ir_instr_append_def(instr, ir_body_alloc_temp_banked_int(blk->body_, (dst_ra->local_frame_ ? frame->local_int_offset_ : 0) + dst_ra->v_.regs_[k]));
+    ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, (index_ra->local_frame_ ? frame->local_int_offset_ : 0) + index_ra->v_.regs_[0]));
+    for (n = 0; n < num_choices; ++n) {
+      int reg = src_ra->v_.regs_[column_size ? n * column_size + k : n];
+      if (src_ra->is_indirect_) {
+        /* Choices are int registers holding the register index */
+        ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(blk->body_, (src_ra->local_frame_ ? frame->local_int_offset_ : 0) + reg));
+      }
+      else {
+        /* Choices are the (global) register indices themselves */
+        ir_instr_append_use(instr, ir_body_alloc_temp_liti(blk->body_, (src_ra->local_frame_ ? sl_ir_frame_offset(frame, dst_ra->kind_) : 0) + reg));
+      }
     }
   }
 }
 
+static void sl_ir_clear_chain(struct ir_block *blk, struct ir_temp *chain_reg) {
+  struct ir_instr *instr = ir_block_append_instr(blk, GIR_MOVE);
+  ir_instr_append_def(instr, chain_reg);
+  ir_instr_append_use(instr, ir_body_alloc_temp_liti(blk->body_, SL_EXEC_NO_CHAIN));
+}
+
+static void sl_ir_move_chain(struct ir_block *blk, struct ir_temp *dst_chain, struct ir_temp *src_chain) {
+  struct ir_instr *instr = ir_block_append_instr(blk, GIR_MOVE);
+  ir_instr_append_def(instr, dst_chain);
+  ir_instr_append_use(instr, src_chain);
+}
+
+static void sl_ir_join_chains(struct ir_block *blk, struct ir_temp *dst_chain, struct ir_temp *a, struct ir_temp *b) {
+  struct ir_instr *instr = ir_block_append_instr(blk, SLIR_JOIN_EXEC_CHAINS);
+  ir_instr_append_def(instr, dst_chain);
+  ir_instr_append_use(instr, a);
+  ir_instr_append_use(instr, b);
+}
+
+/* Splits chain_reg into true_chain and false_chain by the (scalar bool) rvalue of condition; chain_reg is
+ * consumed by the split and should be re-joined from true_chain and false_chain afterwards. If the condition
+ * is uniform, all rows go the same way and the chain is forwarded as a whole. */
+static void sl_ir_split_chain(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_execution_frame *frame, struct sl_expr *condition,
+                              struct ir_temp *true_chain, struct ir_temp *false_chain) {
+  struct ir_instr *instr = ir_block_append_instr(blk, sl_expr_is_uniform(condition) ? SLIR_SPLIT_EXEC_CHAIN_BY_UNIFORM_CONDITION
+                                                                                    : SLIR_SPLIT_EXEC_CHAIN_BY_CONDITION);
+  ir_instr_append_def(instr, true_chain);
+  ir_instr_append_def(instr, false_chain);
+  ir_instr_append_use(instr, ir_body_alloc_temp_banked_bool(blk->body_, sl_ir_reg_index(frame, EXPR_RVALUE(condition), 0)));
+  ir_instr_append_use(instr, chain_reg);
+}
+
+static void sl_ir_jump(struct ir_block *blk, struct ir_block *target) {
+  if (!blk || !target) return;
+  struct ir_instr *instr = ir_block_append_instr(blk, GIR_JUMP);
+  ir_instr_append_use(instr, ir_body_alloc_temp_block(blk->body_, target));
+  ir_block_add_successor(blk, target);
+}
+
+/* Terminates blk with a branch to nonempty_blk if chain_reg holds any rows, and to empty_blk otherwise. */
+static void sl_ir_branch_on_chain(struct ir_block *blk, struct ir_temp *chain_reg, struct ir_block *nonempty_blk, struct ir_block *empty_blk) {
+  if (!blk || !nonempty_blk || !empty_blk) return;
+  struct ir_instr *cmp = ir_block_append_instr(blk, GIR_COMPARE);
+  ir_instr_append_use(cmp, chain_reg);
+  ir_instr_append_use(cmp, ir_body_alloc_temp_liti(blk->body_, SL_EXEC_NO_CHAIN));
+  struct ir_instr *bne = ir_block_append_instr(blk, GIR_BRANCH_NOT_EQUAL);
+  ir_instr_append_use(bne, ir_body_alloc_temp_block(blk->body_, nonempty_blk));
+  ir_instr_append_use(bne, ir_body_alloc_temp_block(blk->body_, empty_blk));
+  ir_block_add_successor(blk, nonempty_blk);
+  ir_block_add_successor(blk, empty_blk);
+}
+
 void sl_ir_need_rvalue(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_execution_frame *frame, struct sl_expr *x) {
   sl_reg_emit_move(blk, chain_reg, frame, &x->base_regs_, &x->offset_reg_, &x->rvalue_, NULL);
 }
 
+/* Emits a split of chain_reg by the condition, and the evaluation of the true_fn on the true rows and false_fn on the false
+ * rows, each in their own block that is skipped when no rows take it. Returns the block after both branches have re-joined
+ * into chain_reg. Used for both if-statements and the ternary operator. */
+static struct ir_block *sl_ir_if_else(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_execution_frame *frame, struct sl_expr *condition,
+                                      struct sl_stmt *true_stmt, struct sl_stmt *false_stmt,
+                                      struct sl_expr *true_expr, struct sl_expr *false_expr, struct sl_expr *result) {
+  struct ir_temp *true_chain, *false_chain;
+  struct ir_block *true_blk, *true_end, *false_test, *false_blk, *false_end, *after;
+  blk = sl_ir_expr(blk, chain_reg, frame, condition);
+  if (!blk) return NULL;
+  sl_ir_need_rvalue(blk, chain_reg, frame, condition);
+  true_chain = ir_body_alloc_temp_unused_virtual(blk->body_);
+  false_chain = ir_body_alloc_temp_unused_virtual(blk->body_);
+  sl_ir_split_chain(blk, chain_reg, frame, condition, true_chain, false_chain);
+
+  true_blk = ir_body_alloc_block(blk->body_);
+  if (true_expr) {
+    true_end = sl_ir_expr(true_blk, true_chain, frame, true_expr);
+    sl_ir_need_rvalue(true_end, true_chain, frame, true_expr);
+    sl_reg_emit_move(true_end, true_chain, frame, EXPR_RVALUE(true_expr), NULL, &result->base_regs_, NULL);
+  }
+  else {
+    true_end = sl_ir_stmt(true_blk, true_chain, frame, true_stmt);
+  }
+
+  if (false_stmt || false_expr) {
+    false_test = ir_body_alloc_block(blk->body_);
+    false_blk = ir_body_alloc_block(blk->body_);
+    if (false_expr) {
+      false_end = sl_ir_expr(false_blk, false_chain, frame, false_expr);
+      sl_ir_need_rvalue(false_end, false_chain, frame, false_expr);
+      sl_reg_emit_move(false_end, false_chain, frame, EXPR_RVALUE(false_expr), NULL, &result->base_regs_, NULL);
+    }
+    else {
+      false_end = sl_ir_stmt(false_blk, false_chain, frame, false_stmt);
+    }
+    after = ir_body_alloc_block(blk->body_);
+    sl_ir_branch_on_chain(blk, true_chain, true_blk, false_test);
+    sl_ir_jump(true_end, false_test);
+    sl_ir_branch_on_chain(false_test, false_chain, false_blk, after);
+    sl_ir_jump(false_end, after);
+  }
+  else {
+    after = ir_body_alloc_block(blk->body_);
+    sl_ir_branch_on_chain(blk, true_chain, true_blk, after);
+    sl_ir_jump(true_end, after);
+  }
+  if (!true_end || ((false_stmt || false_expr) && !false_end)) return NULL;
+
+  sl_ir_join_chains(after, chain_reg, true_chain, false_chain);
+  return after;
+}
+
+/* Returns the number of expression nodes in x */
+static size_t sl_ir_expr_size(struct sl_expr *x) {
+  size_t n, size;
+  if (!x) return 0;
+  size = 1;
+  for (n = 0; n < x->num_children_; ++n) {
+    size += sl_ir_expr_size(x->children_[n]);
+  }
+  return size;
+}
+
+/* Returns the number of statements and expression nodes in the list. If only_final_return is non-zero,
+ * returns SIZE_MAX if the list has a return statement that is not the last statement of the function (if
+ * at_end, the end of the list is the end of the function.) */
+static size_t sl_ir_stmt_size(struct sl_stmt *stmt, int only_final_return, int at_end) {
+  size_t size = 0;
+  while (stmt) {
+    struct sl_stmt *next = sl_stmt_next_execution_sibling(stmt);
+    size_t sub_sizes[4];
+    size_t n;
+    if (only_final_return && (stmt->kind_ == slsk_return) && (!at_end || next)) return SIZE_MAX;
+    /* Only the statements of a compound statement continue to the end of the function */
+    sub_sizes[0] = sl_ir_stmt_size(stmt->prep_, only_final_return, 0);
+    sub_sizes[1] = sl_ir_stmt_size(stmt->prep_cond_, only_final_return, 0);
+    sub_sizes[2] = sl_ir_stmt_size(stmt->true_branch_, only_final_return, at_end && !next && (stmt->kind_ == slsk_compound));
+    sub_sizes[3] = sl_ir_stmt_size(stmt->false_branch_, only_final_return, 0);
+    size += 1 + sl_ir_expr_size(stmt->expr_) + sl_ir_expr_size(stmt->condition_) + sl_ir_expr_size(stmt->post_);
+    for (n = 0; n < sizeof(sub_sizes) / sizeof(*sub_sizes); ++n) {
+      if (sub_sizes[n] == SIZE_MAX) return SIZE_MAX;
+      size += sub_sizes[n];
+    }
+    stmt = next;
+  }
+  return size;
+}
+
+/* A for loop in the form of GLSL ES 1.00 Appendix A whose trip count is known at compile time, see
+ * sl_ir_loop_unrollable(). */
+struct sl_ir_unrolled_loop {
+  struct sl_variable *index_;
+  size_t trip_count_;
+
+  /* Value of the loop index in the first iteration, and what is added to it for each subsequent
+   * iteration (sletk_int or sletk_float, both of the same kind.) */
+  struct sl_expr_temp init_;
+  struct sl_expr_temp step_;
+
+  /* Non-zero if the loop body has break or continue statements */
+  int has_break_:1;
+  int has_continue_:1;
+};
+
+/* Returns non-zero if x is a scalar int or float constant (a literal or a const variable, possibly negated),
+ * storing its value in *value. */
+static int sl_ir_scalar_constant(struct sl_expr *x, struct sl_expr_temp *value) {
+  const struct sl_expr_temp *src;
+  if (!x) return 0;
+  if ((x->op_ == exop_negate) && sl_ir_scalar_constant(x->children_[0], value)) {
+    if (value->kind_ == sletk_int) value->v_.i_ = -value->v_.i_;
+    else value->v_.f_ = -value->v_.f_;
+    return 1;
+  }
+  if (x->op_ == exop_literal) {
+    src = &x->literal_value_;
+  }
+  else if ((x->op_ == exop_variable) && x->variable_ && x->variable_->type_ && !x->variable_->is_parameter_ &&
+           (sl_type_qualifiers(x->variable_->type_) & SL_TYPE_QUALIFIER_CONST)) {
+    src = &x->variable_->value_;
+  }
+  else {
+    return 0;
+  }
+  if ((src->kind_ != sletk_int) && (src->kind_ != sletk_float)) return 0;
+  *value = *src;
+  return 1;
+}
+
+/* Returns the variable at the root of lvalue x, or NULL if there is none. */
+static struct sl_variable *sl_ir_lvalue_variable(struct sl_expr *x) {
+  while (x && ((x->op_ == exop_array_subscript) || (x->op_ == exop_component_selection) || (x->op_ == exop_field_selection))) {
+    x = x->children_[0];
+  }
+  return (x && (x->op_ == exop_variable)) ? x->variable_ : NULL;
+}
+
+/* Returns non-zero if x (or any of its sub-expressions) assigns to variable v. */
+static int sl_ir_expr_writes_variable(struct sl_expr *x, struct sl_variable *v) {
+  size_t n;
+  if (!x) return 0;
+  switch (x->op_) {
+    case exop_post_inc:
+    case exop_post_dec:
+    case exop_pre_inc:
+    case exop_pre_dec:
+    case exop_assign:
+    case exop_mul_assign:
+    case exop_div_assign:
+    case exop_add_assign:
+    case exop_sub_assign:
+      if (sl_ir_lvalue_variable(x->children_[0]) == v) return 1;
+      break;
+    case exop_function_call:
+      for (n = 0; (n < x->num_children_) && x->function_ && (n < x->function_->num_parameters_); ++n) {
+        int qualifiers = sl_type_qualifiers(x->function_->parameters_[n].type_);
+        if ((qualifiers & (SL_PARAMETER_QUALIFIER_OUT | SL_PARAMETER_QUALIFIER_INOUT)) &&
+            (sl_ir_lvalue_variable(x->children_[n]) == v)) {
+          return 1;
+        }
+      }
+      break;
+    default:
+      break;
+  }
+  for (n = 0; n < x->num_children_; ++n) {
+    if (sl_ir_expr_writes_variable(x->children_[n], v)) return 1;
+  }
+  return 0;
+}
+
+/* Returns non-zero if the statement list assigns to variable v; sets ul->has_break_ and ul->has_continue_ for
+ * break and continue statements (including those of nested loops, which is merely conservative.) */
+static int sl_ir_loop_body_writes_index(struct sl_stmt *stmt, struct sl_variable *v, struct sl_ir_unrolled_loop *ul) {
+  while (stmt) {
+    if (stmt->kind_ == slsk_break) ul->has_break_ = 1;
+    if (stmt->kind_ == slsk_continue) ul->has_continue_ = 1;
+    if (sl_ir_expr_writes_variable(stmt->expr_, v) ||
+        sl_ir_expr_writes_variable(stmt->condition_, v) ||
+        sl_ir_expr_writes_variable(stmt->post_, v) ||
+        sl_ir_loop_body_writes_index(stmt->prep_, v, ul) ||
+        sl_ir_loop_body_writes_index(stmt->prep_cond_, v, ul) ||
+        sl_ir_loop_body_writes_index(stmt->true_branch_, v, ul) ||
+        sl_ir_loop_body_writes_index(stmt->false_branch_, v, ul)) {
+      return 1;
+    }
+    stmt = sl_stmt_next_execution_sibling(stmt);
+  }
+  return 0;
+}
+
+/* Returns non-zero if the loop index value satisfies the condition "index op bound" */
+static int sl_ir_loop_test(expr_op_t op, const struct sl_expr_temp *value, const struct sl_expr_temp *bound) {
+  if (value->kind_ == sletk_int) {
+    int64_t a = value->v_.i_, b = bound->v_.i_;
+    switch (op) {
+      case exop_lt: return a < b;
+      case exop_le: return a <= b;
+      case exop_gt: return a > b;
+      case exop_ge: return a >= b;
+      case exop_eq: return a == b;
+      case exop_ne: return a != b;
+      default: return 0;
+    }
+  }
+  else {
+    float a = value->v_.f_, b = bound->v_.f_;
+    switch (op) {
+      case exop_lt: return a < b;
+      case exop_le: return a <= b;
+      case exop_gt: return a > b;
+      case exop_ge: return a >= b;
+      case exop_eq: return a == b;
+      case exop_ne: return a != b;
+      default: return 0;
+    }
+  }
+}
+
+/* Determines if the for loop stmt can be unrolled into at most max_size statements and expression nodes:
+ * it must be of the form "for (index = init; index op bound; index += step)" (or ++, --, -=, or with index
+ * and bound swapped in the condition) where init, bound and step are constants, and the body must not assign
+ * to the index. Returns non-zero and fills in *ul if so. */
+static int sl_ir_loop_unrollable(struct sl_stmt *stmt, size_t max_size, struct sl_ir_unrolled_loop *ul) {
+  struct sl_expr *init, *cond, *post;
+  struct sl_expr_temp bound, value;
+  struct sl_variable *v;
+  expr_op_t op;
+  size_t body_size;
+
+  memset(ul, 0, sizeof(*ul));
+  if (!max_size || (stmt->kind_ != slsk_for) || stmt->prep_cond_) return 0;
+
+  /* Loop index initialization; the index must be a scalar int or float variable */
+  if (!stmt->prep_ || (stmt->prep_->kind_ != slsk_expression) || sl_stmt_next_execution_sibling(stmt->prep_)) return 0;
+  init = stmt->prep_->expr_;
+  if (!init || (init->op_ != exop_assign) || (init->children_[0]->op_ != exop_variable)) return 0;
+  v = init->children_[0]->variable_;
+  if (!v || ((v->reg_alloc_.kind_ != slrak_int) && (v->reg_alloc_.kind_ != slrak_float))) return 0;
+  if (!sl_ir_scalar_constant(init->children_[1], &ul->init_)) return 0;
+  if ((ul->init_.kind_ == sletk_int) != (v->reg_alloc_.kind_ == slrak_int)) return 0;
+
+  /* Condition */
+  cond = stmt->condition_;
+  if (!cond || (cond->num_children_ != 2)) return 0;
+  op = cond->op_;
+  if ((cond->children_[0]->op_ == exop_variable) && (cond->children_[0]->variable_ == v) &&
+      sl_ir_scalar_constant(cond->children_[1], &bound)) {
+    /* index op bound */
+  }
+  else if ((cond->children_[1]->op_ == exop_variable) && (cond->children_[1]->variable_ == v) &&
+           sl_ir_scalar_constant(cond->children_[0], &bound)) {
+    /* bound op index, mirror it */
+    switch (op) {
+      case exop_lt: op = exop_gt; break;
+      case exop_le: op = exop_ge; break;
+      case exop_gt: op = exop_lt; break;
+      case exop_ge: op = exop_le; break;
+      default: break;
+    }
+  }
+  else {
+    return 0;
+  }
+  if ((op != exop_lt) && (op != exop_le) && (op != exop_gt) && (op != exop_ge) && (op != exop_eq) && (op != exop_ne)) return 0;
+  if (bound.kind_ != ul->init_.kind_) return 0;
+
+  /* Increment */
+  post = stmt->post_;
+  if (!post || !post->num_children_ || (post->children_[0]->op_ != exop_variable) || (post->children_[0]->variable_ != v)) return 0;
+  ul->step_.kind_ = ul->init_.kind_;
+  switch (post->op_) {
+    case exop_post_inc:
+    case exop_pre_inc:
+    case exop_post_dec:
+    case exop_pre_dec: {
+      int delta = ((post->op_ == exop_post_inc) || (post->op_ == exop_pre_inc)) ? 1 : -1;
+      if (ul->step_.kind_ == sletk_int) ul->step_.v_.i_ = delta;
+      else ul->step_.v_.f_ = (float)delta;
+      break;
+    }
+    case exop_add_assign:
+    case exop_sub_assign:
+      if (!sl_ir_scalar_constant(post->children_[1], &ul->step_) || (ul->step_.kind_ != ul->init_.kind_)) return 0;
+      if (post->op_ == exop_sub_assign) {
+        if (ul->step_.kind_ == sletk_int) ul->step_.v_.i_ = -ul->step_.v_.i_;
+        else ul->step_.v_.f_ = -ul->step_.v_.f_;
+      }
+      break;
+    default:
+      return 0;
+  }
+
+  if (sl_ir_loop_body_writes_index(stmt->true_branch_, v, ul)) return 0;
+  body_size = sl_ir_stmt_size(stmt->true_branch_, 0, 0) + 1;
+
+  /* Run the loop index through its values, stopping when it no longer fits the limit (which also stops
+   * loops that would never end.) */
+  value = ul->init_;
+  while (sl_ir_loop_test(op, &value, &bound)) {
+    ul->trip_count_++;
+    if ((max_size / body_size) < ul->trip_count_) return 0;
+    if (value.kind_ == sletk_int) {
+      value.v_.i_ += ul->step_.v_.i_;
+      /* Integer registers may be 32 bits wide, don't second guess their overflow */
+      if ((value.v_.i_ < INT32_MIN) || (value.v_.i_ > INT32_MAX)) return 0;
+    }
+    else {
+      value.v_.f_ += ul->step_.v_.f_;
+    }
+  }
+  ul->index_ = v;
+  return 1;
+}
+
+/* Emits the iterations of the loop analyzed by sl_ir_loop_unrollable() one after the other. */
+static struct ir_block *sl_ir_unrolled_loop(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_execution_frame *frame, struct sl_stmt *stmt,
+                                            struct sl_ir_unrolled_loop *ul) {
+  struct sl_execution_frame loop_frame = *frame;
+  struct ir_temp *loop_chain = chain_reg;
+  struct sl_expr_temp value = ul->init_;
+  size_t n;
+
+  /* Without break statements, all rows that enter the loop stay in it until the end, so the loop body can
+   * run on chain_reg directly. */
+  loop_frame.break_chain_ = NULL;
+  loop_frame.continue_chain_ = NULL;
+  if (ul->has_break_) {
+    loop_chain = ir_body_alloc_temp_unused_virtual(blk->body_);
+    loop_frame.break_chain_ = chain_reg;
+    sl_ir_move_chain(blk, loop_chain, chain_reg);
+    sl_ir_clear_chain(blk, chain_reg);
+  }
+  if (ul->has_continue_) {
+    loop_frame.continue_chain_ = ir_body_alloc_temp_unused_virtual(blk->body_);
+  }
+
+  for (n = 0; n < ul->trip_count_; ++n) {
+    sl_ir_init_lit(blk, loop_chain, frame, &ul->index_->reg_alloc_, &value, 0);
+    if (loop_frame.continue_chain_) sl_ir_clear_chain(blk, loop_frame.continue_chain_);
+    blk = sl_ir_stmt(blk, loop_chain, &loop_frame, stmt->true_branch_);
+    if (!blk) return NULL;
+    if (loop_frame.continue_chain_) sl_ir_join_chains(blk, loop_chain, loop_chain, loop_frame.continue_chain_);
+    if (value.kind_ == sletk_int) value.v_.i_ += ul->step_.v_.i_;
+    else value.v_.f_ += ul->step_.v_.f_;
+  }
+
+  /* Rows completing the loop leave it with the index at the first value that failed the condition */
+  sl_ir_init_lit(blk, loop_chain, frame, &ul->index_->reg_alloc_, &value, 0);
+  if (ul->has_break_) {
+    sl_ir_join_chains(blk, chain_reg, chain_reg, loop_chain);
+  }
+  return blk;
+}
+
+/* Emits a while loop (prep_ == NULL, post_ == NULL) or a for loop. The rows still looping are kept in a separate
+ * loop chain, rows exit the loop into chain_reg (either by the condition or by a break statement.) */
+static struct ir_block *sl_ir_loop(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_execution_frame *frame, struct sl_stmt *stmt) {
+  struct sl_execution_frame loop_frame = *frame;
+  struct ir_temp *loop_chain, *exit_chain;
+  struct ir_block *head, *head_end, *body, *body_end, *after;
+  struct sl_ir_unrolled_loop ul;
+
+  if (sl_ir_loop_unrollable(stmt, frame->unroll_max_size_, &ul)) {
+    return sl_ir_unrolled_loop(blk, chain_reg, frame, stmt, &ul);
+  }
+  if (stmt->kind_ == slsk_for) {
+    blk = sl_ir_stmt(blk, chain_reg, frame, stmt->prep_);
+    if (!blk) return NULL;
+  }
+  loop_chain = ir_body_alloc_temp_unused_virtual(blk->body_);
+  exit_chain = ir_body_alloc_temp_unused_virtual(blk->body_);
+  loop_frame.continue_chain_ = ir_body_alloc_temp_unused_virtual(blk->body_);
+  loop_frame.break_chain_ = chain_reg;
+
+  sl_ir_move_chain(blk, loop_chain, chain_reg);
+  sl_ir_clear_chain(blk, chain_reg);
+  head = ir_body_alloc_block(blk->body_);
+  sl_ir_jump(blk, head);
+
+  /* Loop head: evaluate condition, rows for which it is false leave the loop */
+  head_end = sl_ir_stmt(head, loop_chain, frame, stmt->prep_cond_);
+  if (stmt->condition_) {
+    head_end = sl_ir_expr(head_end, loop_chain, frame, stmt->condition_);
+    if (!head_end) return NULL;
+    sl_ir_need_rvalue(head_end, loop_chain, frame, stmt->condition_);
+    sl_ir_split_chain(head_end, loop_chain, frame, stmt->condition_, loop_chain, exit_chain);
+    sl_ir_join_chains(head_end, chain_reg, chain_reg, exit_chain);
+  }
+
+  body = ir_body_alloc_block(blk->body_);
+  if (!body) return NULL;
+  sl_ir_clear_chain(body, loop_frame.continue_chain_);
+  body_end = sl_ir_stmt(body, loop_chain, &loop_frame, stmt->true_branch_);
+  sl_ir_join_chains(body_end, loop_chain, loop_chain, loop_frame.continue_chain_);
+  body_end = sl_ir_expr(body_end, loop_chain, frame, stmt->post_);
+  sl_ir_jump(body_end, head);
+
+  after = ir_body_alloc_block(blk->body_);
+  sl_ir_branch_on_chain(head_end, loop_chain, body, after);
+  if (!body_end || !head_end) return NULL;
+  return after;
+}
+
+static struct ir_block *sl_ir_do_loop(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_execution_frame *frame, struct sl_stmt *stmt) {
+  struct sl_execution_frame loop_frame = *frame;
+  struct ir_temp *loop_chain, *exit_chain;
+  struct ir_block *body, *body_end, *after;
+
+  loop_chain = ir_body_alloc_temp_unused_virtual(blk->body_);
+  exit_chain = ir_body_alloc_temp_unused_virtual(blk->body_);
+  loop_frame.continue_chain_ = ir_body_alloc_temp_unused_virtual(blk->body_);
+  loop_frame.break_chain_ = chain_reg;
+
+  sl_ir_move_chain(blk, loop_chain, chain_reg);
+  sl_ir_clear_chain(blk, chain_reg);
+  body = ir_body_alloc_block(blk->body_);
+  sl_ir_jump(blk, body);
+  if (!body) return NULL;
+
+  sl_ir_clear_chain(body, loop_frame.continue_chain_);
+  body_end = sl_ir_stmt(body, loop_chain, &loop_frame, stmt->true_branch_);
+  sl_ir_join_chains(body_end, loop_chain, loop_chain, loop_frame.continue_chain_);
+  body_end = sl_ir_expr(body_end, loop_chain, frame, stmt->condition_);
+  if (!body_end) return NULL;
+  sl_ir_need_rvalue(body_end, loop_chain, frame, stmt->condition_);
+  sl_ir_split_chain(body_end, loop_chain, frame, stmt->condition_, loop_chain, exit_chain);
+  sl_ir_join_chains(body_end, chain_reg, chain_reg, exit_chain);
+
+  after = ir_body_alloc_block(blk->body_);
+  sl_ir_branch_on_chain(body_end, loop_chain, body, after);
+  return after;
+}
+
 /* Writes code starting at the end of blk, emits all statements in the list, and returns the blk at the end of which
- * all statements have executed. */
+ * all statements have executed. Returns NULL on failure. */
 struct ir_block *sl_ir_stmt(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_execution_frame *frame, struct sl_stmt *stmt) {
-  if (!blk) return NULL;
+  struct ir_body *body = blk ? blk->body_ : NULL;
+  const void *outer_source_node = body ? body->source_node_ : NULL;
+  const struct situs *outer_source_loc = body ? body->source_loc_ : NULL;
   while (stmt) {
+    if (!blk) return NULL;
+    /* Instructions not attributed to an expression of the statement are the statement's own */
+    body->source_node_ = stmt;
+    body->source_loc_ = &stmt->keyword_loc_;
     switch (stmt->kind_) {
       case slsk_expression:
         blk = sl_ir_expr(blk, chain_reg, frame, stmt->expr_);
         break;
-      case slsk_if: {
-        /* 1. evaluate condition
-         * 2. split chain_reg into a true_chain (where condition is true) and a false_chain (where it is false)
-         * 3. if the true_chain is not empty, evaluate the true branch, otherwise jump to after the true branch (#5)
-         * 4. execute the true branch using the true_chain
-         * 5. if the false_chain is not empty, evaluate the false branch, otherwise jump to after the false branch (#7)
-         * 6. execute the false branch using the false_chain
-         * 7. join the true and false chain back into the chain_reg (so the same chain we had before is once more
-         *    restored; the act of splitting the chain rendered the original chain invalid, and some rows might not
-         *    have made it back here (e.g. discard, return, etc.)
-         */
-        blk = sl_ir_expr(blk, chain_reg, frame, stmt->condition_);
-        sl_ir_need_rvalue(blk, chain_reg, frame, stmt->condition_);
-        struct ir_temp *true_chain, *false_chain;
-        true_chain = ir_body_alloc_temp_unused_virtual(blk->body_);
-        false_chain = ir_body_alloc_temp_unused_virtual(blk->body_);
-        struct ir_instr *split = ir_block_append_instr(blk, SLIR_SPLIT_EXEC_CHAIN_BY_CONDITION);
-        ir_instr_append_def(split, true_chain);
-        ir_instr_append_def(split, false_chain);
-        ir_instr_append_use(split, ir_body_alloc_temp_banked_bool(blk->body_, EXPR_RVALUE(stmt->condition_)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(stmt->condition_)->v_.regs_[0] : EXPR_RVALUE(stmt->condition_)->v_.regs_[0]));
-        ir_instr_append_use(split, chain_reg);
-
-        struct ir_instr *cmp_instr = ir_block_append_instr(blk, GIR_COMPARE);
-        struct ir_temp *no_chain_lit = ir_body_alloc_temp_liti(blk->body_, SL_EXEC_NO_CHAIN);
-        ir_instr_append_use(cmp_instr, true_chain);
-        ir_instr_append_use(cmp_instr, no_chain_lit);
-
-        struct ir_block *true_branch = ir_body_alloc_block(blk->body_);
-        struct ir_block *after_true_branch = ir_body_alloc_block(blk->body_);
-
-        struct ir_instr *bne = ir_block_append_instr(blk, GIR_BRANCH_NOT_EQUAL);
-        ir_instr_append_use(bne, ir_body_alloc_temp_block(blk->body_, true_branch));
-        ir_instr_append_use(bne, ir_body_alloc_temp_block(blk->body_, after_true_branch));
-
-        true_branch = sl_ir_stmt(true_branch, true_chain, frame, stmt->true_branch_);
-
-        struct ir_instr *bra = ir_block_append_instr(true_branch, GIR_JUMP);
-        ir_instr_append_use(bra, ir_body_alloc_temp_block(blk->body_, after_true_branch));
-
-        cmp_instr = ir_block_append_instr(after_true_branch, GIR_COMPARE);
-        ir_instr_append_use(cmp_instr, false_chain);
-        ir_instr_append_use(cmp_instr, no_chain_lit);
-
-        struct ir_block *false_branch = ir_body_alloc_block(blk->body_);
-        struct ir_block *after_false_branch = ir_body_alloc_block(blk->body_);
-
-        bne = ir_block_append_instr(blk, GIR_BRANCH_NOT_EQUAL);
-        ir_instr_append_use(bne, ir_body_alloc_temp_block(blk->body_, false_branch));
-        ir_instr_append_use(bne, ir_body_alloc_temp_block(blk->body_, after_false_branch));
-
-        false_branch = sl_ir_stmt(false_branch, false_chain, frame, stmt->false_branch_);
-
-        bra = ir_block_append_instr(false_branch, GIR_JUMP);
-        ir_instr_append_use(bra, ir_body_alloc_temp_block(blk->body_, after_false_branch));
-
-        blk = after_false_branch;
-        struct ir_instr *rejoin = ir_block_append_instr(blk, SLIR_JOIN_EXEC_CHAINS);
-        ir_instr_append_def(rejoin, chain_reg);
-        ir_instr_append_use(rejoin, true_chain);
-        ir_instr_append_use(rejoin, false_chain);
+      case slsk_if:
+        blk = sl_ir_if_else(blk, chain_reg, frame, stmt->condition_, stmt->true_branch_, stmt->false_branch_, NULL, NULL, NULL);
         break;
-      }
-      case slsk_while: {
-        struct sl_execution_frame loop_frame = *frame;
-        loop_frame.continue_chain_ = ir_body_alloc_temp_unused_virtual(blk->body_);
-        loop_frame.break_chain_ = chain_reg;
-
-        /* 1. evaluate condition
-         * 2. split chain_reg into a true_chain (where the condition is true) and a false chain back in chain_reg (where it is false)
-         * 3. if the true_chain is empty, go to #9
-         * 4. execute the true branch using the true_chain
-         * 5. evaluate condition using the true_chain
-         * 6. split true_chain into a true_chain (where the condition continues to be true), and a loop_exit_chain (where it is false)
-         * 7. join chain_reg chain and the loop_exit_chain into a new chain_reg chain.
-         * 8. if the true_chain is not empty, go to #4
-         * 9. done with while loop (nop).
-         * 
-         */
-        blk = sl_ir_stmt(blk, chain_reg, frame, stmt->prep_cond_);
-        blk = sl_ir_expr(blk, chain_reg, frame, stmt->condition_);
-        sl_ir_need_rvalue(blk, chain_reg, frame, stmt->condition_);
-        struct ir_temp *true_chain, *loop_exit_chain;
-        true_chain = ir_body_alloc_temp_unused_virtual(blk->body_);
-        loop_exit_chain = ir_body_alloc_temp_unused_virtual(blk->body_);
-        struct ir_temp *condition = ir_body_alloc_temp_banked_bool(blk->body_, EXPR_RVALUE(stmt->condition_)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(stmt->condition_)->v_.regs_[0] : EXPR_RVALUE(stmt->condition_)->v_.regs_[0]);
-        struct ir_instr *split = ir_block_append_instr(blk, SLIR_SPLIT_EXEC_CHAIN_BY_CONDITION);
-        ir_instr_append_def(split, true_chain);
-        ir_instr_append_def(split, chain_reg);
-        ir_instr_append_use(split, condition);
-        ir_instr_append_use(split, chain_reg);
-
-        struct ir_instr *cmp_instr = ir_block_append_instr(blk, GIR_COMPARE);
-        struct ir_temp *no_chain_lit = ir_body_alloc_temp_liti(blk->body_, SL_EXEC_NO_CHAIN);
-        ir_instr_append_use(cmp_instr, true_chain);
-        ir_instr_append_use(cmp_instr, no_chain_lit);
-
-        struct ir_block *loop_entry = ir_body_alloc_block(blk->body_);
-        struct ir_block *true_branch = loop_entry;
-        struct ir_block *after_true_branch = ir_body_alloc_block(blk->body_);
-
-        struct ir_instr *bne = ir_block_append_instr(blk, GIR_BRANCH_NOT_EQUAL);
-        ir_instr_append_use(bne, ir_body_alloc_temp_block(blk->body_, true_branch));
-        ir_instr_append_use(bne, ir_body_alloc_temp_block(blk->body_, after_true_branch));
-
-        struct ir_instr *clear_chain = ir_block_append_instr(true_branch, GIR_MOVE);
-        ir_instr_append_def(clear_chain, frame->continue_chain_);
-        ir_instr_append_use(clear_chain, no_chain_lit);
-
-        true_branch = sl_ir_stmt(true_branch, true_chain, &loop_frame, stmt->true_branch_);
-
-        struct ir_instr *rejoin = ir_block_append_instr(blk, SLIR_JOIN_EXEC_CHAINS);
-        ir_instr_append_def(rejoin, true_chain);
-        ir_instr_append_use(rejoin, true_chain);
-        ir_instr_append_use(rejoin, frame->continue_chain_);
-
-        true_branch = sl_ir_stmt(true_branch, true_chain, frame, stmt->prep_cond_);
-        true_branch = sl_ir_expr(true_branch, true_chain, frame, stmt->condition_);
-        sl_ir_need_rvalue(true_branch, true_chain, frame, stmt->condition_);
-
-        split = ir_block_append_instr(true_branch, SLIR_SPLIT_EXEC_CHAIN_BY_CONDITION);
-        ir_instr_append_def(split, true_chain);
-        ir_instr_append_def(split, loop_exit_chain);
-        ir_instr_append_use(split, condition);
-        ir_instr_append_use(split, true_chain);
-
-        struct ir_instr *join = ir_block_append_instr(true_branch, SLIR_JOIN_EXEC_CHAINS);
-        ir_instr_append_def(join, chain_reg);
-        ir_instr_append_use(join, chain_reg);
-        ir_instr_append_use(join, loop_exit_chain);
-
-        cmp_instr = ir_block_append_instr(true_branch, GIR_COMPARE);
-        ir_instr_append_use(cmp_instr, true_chain);
-        ir_instr_append_use(cmp_instr, no_chain_lit);
-
-        bne = ir_block_append_instr(true_branch, GIR_BRANCH_NOT_EQUAL);
-        ir_instr_append_use(bne, ir_body_alloc_temp_block(blk->body_, loop_entry));
-        ir_instr_append_use(bne, ir_body_alloc_temp_block(blk->body_, after_true_branch));
-
-        blk = after_true_branch;
+      case slsk_while:
+      case slsk_for:
+        blk = sl_ir_loop(blk, chain_reg, frame, stmt);
         break;
-      }
-      case slsk_do: {
-        struct sl_execution_frame loop_frame = *frame;
-        loop_frame.continue_chain_ = ir_body_alloc_temp_unused_virtual(blk->body_);
-        loop_frame.break_chain_ = chain_reg;
-
-        /* 1. move chain_reg to true_chain
-         * 2. set chain_reg to SL_EXEC_NO_CHAIN (clearing it empty)
-         * 3. execute the true branch using the true_chain
-         * 4. evaluate condition using the true_chain
-         * 5. split true_chain into a true_chain (where the condition continues to be true), and a loop_exit_chain (where it is false)
-         * 6. join chain_reg chain, and the loop_exit_chain into a new chain_reg chain.
-         * 7. if the true_chain is not empty, go to #3
-         * 8. done with do-while loop (nop)
-         * so this is a lot like a while loop, save for the first few steps.
-         */
-        struct ir_temp *true_chain, *loop_exit_chain;
-        true_chain = ir_body_alloc_temp_unused_virtual(blk->body_);
-        loop_exit_chain = ir_body_alloc_temp_unused_virtual(blk->body_);
-        struct ir_temp *condition = ir_body_alloc_temp_banked_bool(blk->body_, EXPR_RVALUE(stmt->condition_)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(stmt->condition_)->v_.regs_[0] : EXPR_RVALUE(stmt->condition_)->v_.regs_[0]);
-
-        struct ir_temp *no_chain_lit = ir_body_alloc_temp_liti(blk->body_, SL_EXEC_NO_CHAIN);
-
-        struct ir_instr *move = ir_block_append_instr(blk, GIR_MOVE);
-        ir_instr_append_def(move, true_chain);
-        ir_instr_append_use(move, chain_reg);
-
-        move = ir_block_append_instr(blk, GIR_MOVE);
-        ir_instr_append_def(move, chain_reg);
-        ir_instr_append_use(move, no_chain_lit);
-
-        struct ir_block *loop_entry = ir_body_alloc_block(blk->body_);
-        struct ir_block *true_branch = loop_entry;
-        struct ir_block *after_true_branch = ir_body_alloc_block(blk->body_);
-
-        struct ir_instr *clear_chain = ir_block_append_instr(true_branch, GIR_MOVE);
-        ir_instr_append_def(clear_chain, frame->continue_chain_);
-        ir_instr_append_use(clear_chain, no_chain_lit);
-
-        true_branch = sl_ir_stmt(true_branch, true_chain, &loop_frame, stmt->true_branch_);
-
-        struct ir_instr *rejoin = ir_block_append_instr(blk, SLIR_JOIN_EXEC_CHAINS);
-        ir_instr_append_def(rejoin, true_chain);
-        ir_instr_append_use(rejoin, true_chain);
-        ir_instr_append_use(rejoin, frame->continue_chain_);
-
-        true_branch = sl_ir_expr(true_branch, true_chain, frame, stmt->condition_);
-        sl_ir_need_rvalue(true_branch, true_chain, frame, stmt->condition_);
-
-        struct ir_instr *split = ir_block_append_instr(true_branch, SLIR_SPLIT_EXEC_CHAIN_BY_CONDITION);
-        ir_instr_append_def(split, true_chain);
-        ir_instr_append_def(split, loop_exit_chain);
-        ir_instr_append_use(split, condition);
-        ir_instr_append_use(split, true_chain);
-
-        struct ir_instr *join = ir_block_append_instr(true_branch, SLIR_JOIN_EXEC_CHAINS);
-        ir_instr_append_def(join, chain_reg);
-        ir_instr_append_use(join, chain_reg);
-        ir_instr_append_use(join, loop_exit_chain);
-
-        struct ir_instr *cmp_instr = ir_block_append_instr(true_branch, GIR_COMPARE);
-        ir_instr_append_use(cmp_instr, true_chain);
-        ir_instr_append_use(cmp_instr, no_chain_lit);
-
-        struct ir_instr *bne = ir_block_append_instr(true_branch, GIR_BRANCH_NOT_EQUAL);
-        ir_instr_append_use(bne, ir_body_alloc_temp_block(blk->body_, loop_entry));
-        ir_instr_append_use(bne, ir_body_alloc_temp_block(blk->body_, after_true_branch));
-
-        blk = after_true_branch;
+      case slsk_do:
+        blk = sl_ir_do_loop(blk, chain_reg, frame, stmt);
         break;
-      }
-      case slsk_for: {
-        struct sl_execution_frame loop_frame = *frame;
-        loop_frame.continue_chain_ = ir_body_alloc_temp_unused_virtual(blk->body_);
-        /* we loop on true_chain, and accrue into chain_reg all those rows that no longer meet the loop condition,
-         * therefore chain_reg is the appropriate chain to join when we "break" from the loop body */
-        loop_frame.break_chain_ = chain_reg;
-
-        sl_ir_stmt(blk, chain_reg, frame, stmt->prep_);
-        sl_ir_stmt(blk, chain_reg, frame, stmt->prep_cond_);
-
-        blk = sl_ir_expr(blk, chain_reg, frame, stmt->condition_);
-        sl_ir_need_rvalue(blk, chain_reg, frame, stmt->condition_);
-        struct ir_temp *true_chain, *loop_exit_chain;
-        true_chain = ir_body_alloc_temp_unused_virtual(blk->body_);
-        loop_exit_chain = ir_body_alloc_temp_unused_virtual(blk->body_);
-        struct ir_temp *condition = ir_body_alloc_temp_banked_bool(blk->body_, EXPR_RVALUE(stmt->condition_)->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(stmt->condition_)->v_.regs_[0] : EXPR_RVALUE(stmt->condition_)->v_.regs_[0]);
-        struct ir_instr *split = ir_block_append_instr(blk, SLIR_SPLIT_EXEC_CHAIN_BY_CONDITION);
-        ir_instr_append_def(split, true_chain);
-        ir_instr_append_def(split, chain_reg);
-        ir_instr_append_use(split, condition);
-        ir_instr_append_use(split, chain_reg);
-
-        struct ir_instr *cmp_instr = ir_block_append_instr(blk, GIR_COMPARE);
-        struct ir_temp *no_chain_lit = ir_body_alloc_temp_liti(blk->body_, SL_EXEC_NO_CHAIN);
-        ir_instr_append_use(cmp_instr, true_chain);
-        ir_instr_append_use(cmp_instr, no_chain_lit);
-
-        struct ir_block *loop_entry = ir_body_alloc_block(blk->body_);
-        struct ir_block *true_branch = loop_entry;
-        struct ir_block *after_true_branch = ir_body_alloc_block(blk->body_);
-
-        struct ir_instr *bne = ir_block_append_instr(blk, GIR_BRANCH_NOT_EQUAL);
-        ir_instr_append_use(bne, ir_body_alloc_temp_block(blk->body_, true_branch));
-        ir_instr_append_use(bne, ir_body_alloc_temp_block(blk->body_, after_true_branch));
-
-        struct ir_instr *clear_chain = ir_block_append_instr(true_branch, GIR_MOVE);
-        ir_instr_append_def(clear_chain, frame->continue_chain_);
-        ir_instr_append_use(clear_chain, no_chain_lit);
-
-        true_branch = sl_ir_stmt(true_branch, true_chain, &loop_frame, stmt->true_branch_);
-
-        struct ir_instr *rejoin = ir_block_append_instr(blk, SLIR_JOIN_EXEC_CHAINS);
-        ir_instr_append_def(rejoin, true_chain);
-        ir_instr_append_use(rejoin, true_chain);
-        ir_instr_append_use(rejoin, frame->continue_chain_);
-
-        true_branch = sl_ir_expr(true_branch, true_chain, frame, stmt->post_);
-
-        true_branch = sl_ir_stmt(true_branch, true_chain, frame, stmt->prep_cond_);
-
-        true_branch = sl_ir_expr(true_branch, true_chain, frame, stmt->condition_);
-        sl_ir_need_rvalue(true_branch, true_chain, frame, stmt->condition_);
-
-        split = ir_block_append_instr(true_branch, SLIR_SPLIT_EXEC_CHAIN_BY_CONDITION);
-        ir_instr_append_def(split, true_chain);
-        ir_instr_append_def(split, loop_exit_chain);
-        ir_instr_append_use(split, condition);
-        ir_instr_append_use(split, true_chain);
-
-        struct ir_instr *join = ir_block_append_instr(true_branch, SLIR_JOIN_EXEC_CHAINS);
-        ir_instr_append_def(join, chain_reg);
-        ir_instr_append_use(join, chain_reg);
-        ir_instr_append_use(join, loop_exit_chain);
-
-        cmp_instr = ir_block_append_instr(true_branch, GIR_COMPARE);
-        ir_instr_append_use(cmp_instr, true_chain);
-        ir_instr_append_use(cmp_instr, no_chain_lit);
-
-        bne = ir_block_append_instr(true_branch, GIR_BRANCH_NOT_EQUAL);
-        ir_instr_append_use(bne, ir_body_alloc_temp_block(blk->body_, loop_entry));
-        ir_instr_append_use(bne, ir_body_alloc_temp_block(blk->body_, after_true_branch));
-
-        blk = after_true_branch;
-        break;
-      }
       case slsk_continue:
       case slsk_break:
       case slsk_return:
@@ -3805,15 +4138,26 @@ struct ir_block *sl_ir_stmt(struct ir_block *blk, struct ir_temp *chain_reg, str
           case slsk_return:   join_chain = frame->return_chain_; break;
           case slsk_discard:  join_chain = frame->discard_chain_; break;
         }
-        struct ir_instr *rejoin = ir_block_append_instr(blk, SLIR_JOIN_EXEC_CHAINS);
-        ir_instr_append_def(rejoin, join_chain);
-        ir_instr_append_use(rejoin, chain_reg);
-        ir_instr_append_use(rejoin, join_chain);
-        struct ir_temp *no_chain_lit = ir_body_alloc_temp_liti(blk->body_, SL_EXEC_NO_CHAIN);
-        struct ir_instr *clear_return_chain = ir_block_append_instr(blk, GIR_MOVE);
-        ir_instr_append_def(clear_return_chain, chain_reg);
-        ir_instr_append_use(clear_return_chain, no_chain_lit);
-        break;
+        if (!join_chain && (stmt->kind_ != slsk_return || !frame->call_expr_)) return NULL;
+        if ((stmt->kind_ == slsk_return) && stmt->expr_) {
+          blk = sl_ir_expr(blk, chain_reg, frame, stmt->expr_);
+          sl_ir_need_rvalue(blk, chain_reg, frame, stmt->expr_);
+          if (frame->call_expr_) {
+            /* Copy the return value into the caller's exop_function_call result. */
+            sl_reg_emit_move_crossframe(blk, chain_reg, frame, EXPR_RVALUE(stmt->expr_), NULL,
+                                        frame->caller_frame_, &frame->call_expr_->base_regs_, NULL, 1, 1, 1);
+          }
+        }
+        if (!join_chain) {
+          /* Directly inlined function, this is its last statement and the rows continue in the caller. */
+          return blk;
+        }
+        sl_ir_join_chains(blk, join_chain, join_chain, chain_reg);
+        sl_ir_clear_chain(blk, chain_reg);
+        /* Any remaining statements in this list are unreachable */
+        body->source_node_ = outer_source_node;
+        body->source_loc_ = outer_source_loc;
+        return blk;
       }
       case slsk_compound:
         blk = sl_ir_stmt(blk, chain_reg, frame, stmt->true_branch_);
@@ -3823,34 +4167,236 @@ struct ir_block *sl_ir_stmt(struct ir_block *blk, struct ir_temp *chain_reg, str
     stmt = sl_stmt_next_execution_sibling(stmt);
   }
 
+  if (body) {
+    body->source_node_ = outer_source_node;
+    body->source_loc_ = outer_source_loc;
+  }
   return blk;
 }
 
+static void sl_ir_constructor(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_execution_frame *frame, struct sl_expr *x) {
+  size_t ci;
+  for (ci = 0; ci < x->num_components_; ++ci) {
+    struct sl_component_selection *cs = x->swizzle_ + ci;
+    if (cs->parameter_index_ != -1) {
+      struct sl_expr *param = x->children_[cs->parameter_index_];
+      sl_reg_emit_move_c2c(blk, chain_reg, frame,
+                           &param->base_regs_, &param->offset_reg_, cs->component_index_,
+                           &x->base_regs_, &x->offset_reg_, (int)ci);
+    }
+    else {
+      /* Initialize with a constant 0 or 1 */
+      switch (cs->conversion_) {
+        case slcc_float_to_float:
+        case slcc_int_to_float:
+        case slcc_bool_to_float:
+          sl_ir_f_init_lit(blk, chain_reg, (x->base_regs_.local_frame_ ? frame->local_float_offset_ : 0) + x->base_regs_.v_.regs_[ci], cs->component_index_ ? 1.f : 0.f);
+          break;
+        case slcc_float_to_int:
+        case slcc_int_to_int:
+        case slcc_bool_to_int:
+          sl_ir_i_init_lit(blk, chain_reg, (x->base_regs_.local_frame_ ? frame->local_int_offset_ : 0) + x->base_regs_.v_.regs_[ci], cs->component_index_ ? 1 : 0);
+          break;
+        case slcc_float_to_bool:
+        case slcc_int_to_bool:
+        case slcc_bool_to_bool:
+          sl_ir_b_init_lit(blk, chain_reg, (x->base_regs_.local_frame_ ? frame->local_bool_offset_ : 0) + x->base_regs_.v_.regs_[ci], cs->component_index_ ? 1 : 0);
+          break;
+        case slcc_invalid:
+          break;
+      }
+    }
+  }
+}
+
+static int sl_ir_num_float_components(sl_reg_alloc_kind_t kind) {
+  switch (kind) {
+    case slrak_float: return 1;
+    case slrak_vec2: return 2;
+    case slrak_vec3: return 3;
+    case slrak_vec4: return 4;
+    default: return 0;
+  }
+}
+
+/* Emits the float builtin call x as one instruction_code per component of its result, reading the same
+ * component of each argument, or the argument itself if it is a float (e.g. the bounds of clamp(v, 0.0, 1.0).) */
+static struct ir_block *sl_ir_float_builtin(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_execution_frame *frame, struct sl_expr *x, int instruction_code) {
+  int num_components = sl_ir_num_float_components(x->base_regs_.kind_);
+  int n;
+  size_t k;
+  for (k = 0; k < x->num_children_; ++k) {
+    sl_ir_need_rvalue(blk, chain_reg, frame, x->children_[k]);
+  }
+  for (n = 0; n < num_components; ++n) {
+    struct ir_instr *instr = ir_block_append_instr(blk, instruction_code);
+    ir_instr_append_use(instr, chain_reg);
+    ir_instr_append_def(instr, ir_body_alloc_temp_banked_float(blk->body_, (x->base_regs_.local_frame_ ? frame->local_float_offset_ : 0) + x->base_regs_.v_.regs_[n]));
+    for (k = 0; k < x->num_children_; ++k) {
+      struct sl_reg_alloc *arg = EXPR_RVALUE(x->children_[k]);
+      int component = (sl_ir_num_float_components(arg->kind_) == 1) ? 0 : n;
+      ir_instr_append_use(instr, ir_body_alloc_temp_banked_float(blk->body_, (arg->local_frame_ ? frame->local_float_offset_ : 0) + arg->v_.regs_[component]));
+    }
+  }
+  return blk;
+}
+
+static struct ir_block *sl_ir_builtin_max(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_execution_frame *frame, struct sl_expr *x) {
+  return sl_ir_float_builtin(blk, chain_reg, frame, x, SLIR_MAX_F);
+}
+
+static struct ir_block *sl_ir_builtin_clamp(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_execution_frame *frame, struct sl_expr *x) {
+  return sl_ir_float_builtin(blk, chain_reg, frame, x, SLIR_CLAMP_F);
+}
+
+static struct ir_block *sl_ir_builtin_mix(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_execution_frame *frame, struct sl_expr *x) {
+  return sl_ir_float_builtin(blk, chain_reg, frame, x, SLIR_MIX_F);
+}
+
+void sl_ir_bind_builtin_emit_fn(struct sl_function *f) {
+  if (!f->builtin_runtime_fn_ || !f->name_) return;
+  if (!strcmp(f->name_, "max")) f->builtin_emit_fn_ = sl_ir_builtin_max;
+  else if (!strcmp(f->name_, "clamp")) f->builtin_emit_fn_ = sl_ir_builtin_clamp;
+  else if (!strcmp(f->name_, "mix")) f->builtin_emit_fn_ = sl_ir_builtin_mix;
+}
+
+/* Emits the invocation of a function, inlining user defined functions into the caller. */
+static struct ir_block *sl_ir_function_call(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_execution_frame *frame, struct sl_expr *x) {
+  struct sl_function *f = x->function_;
+  size_t n;
+
+  if (f->builtin_emit_fn_) {
+    return f->builtin_emit_fn_(blk, chain_reg, frame, x);
+  }
+  if (f->builtin_runtime_fn_) {
+    /* Call out to the runtime builtin; it needs to know the frame to resolve local registers of x. */
+    struct ir_instr *instr = ir_block_append_instr(blk, SLIR_CALL_BUILTIN);
+    ir_instr_append_use(instr, chain_reg);
+    ir_instr_append_use(instr, ir_body_alloc_temp_litu(blk->body_, (uint64_t)(uintptr_t)x));
+    ir_instr_append_use(instr, ir_body_alloc_temp_liti(blk->body_, frame->local_float_offset_));
+    ir_instr_append_use(instr, ir_body_alloc_temp_liti(blk->body_, frame->local_int_offset_));
+    ir_instr_append_use(instr, ir_body_alloc_temp_liti(blk->body_, frame->local_bool_offset_));
+    ir_instr_append_use(instr, ir_body_alloc_temp_liti(blk->body_, frame->local_sampler2D_offset_));
+    ir_instr_append_use(instr, ir_body_alloc_temp_liti(blk->body_, frame->local_samplerCube_offset_));
+    return blk;
+  }
+  if (!f->body_ || (f->num_parameters_ != x->num_children_)) {
+    /* Declared but never defined */
+    return NULL;
+  }
+  struct sl_execution_frame *ancestor;
+  for (ancestor = frame; ancestor; ancestor = ancestor->caller_frame_) {
+    if (ancestor->f_ == f) {
+      /* Recursion cannot be inlined (and is not permitted by GLSL ES) */
+      return NULL;
+    }
+  }
+
+  struct sl_execution_frame child_frame = *frame;
+  child_frame.f_ = f;
+  child_frame.local_float_offset_ += (int)frame->f_->frame_.ract_.rra_floats_.watermark_;
+  child_frame.local_int_offset_ += (int)frame->f_->frame_.ract_.rra_ints_.watermark_;
+  child_frame.local_bool_offset_ += (int)frame->f_->frame_.ract_.rra_bools_.watermark_;
+  child_frame.local_sampler2D_offset_ += (int)frame->f_->frame_.ract_.rra_sampler2D_.watermark_;
+  child_frame.local_samplerCube_offset_ += (int)frame->f_->frame_.ract_.rra_samplerCube_.watermark_;
+  child_frame.caller_frame_ = frame;
+  child_frame.call_expr_ = x;
+  child_frame.continue_chain_ = NULL;
+  child_frame.break_chain_ = NULL;
+  /* Small functions that can only return at their end run directly on the caller's chain; all others
+   * gather the rows that return in the return chain, and continue on the chain after the call. */
+  if (frame->inline_threshold_ && (sl_ir_stmt_size(f->body_, 1, 1) <= frame->inline_threshold_)) {
+    child_frame.return_chain_ = NULL;
+  }
+  else {
+    child_frame.return_chain_ = ir_body_alloc_temp_unused_virtual(blk->body_);
+  }
+
+  for (n = 0; n < f->num_parameters_; ++n) {
+    struct sl_reg_alloc *param_ra = &f->parameters_[n].variable_->reg_alloc_;
+    sl_ir_need_rvalue(blk, chain_reg, frame, x->children_[n]);
+    sl_reg_emit_move_crossframe(blk, chain_reg, frame, EXPR_RVALUE(x->children_[n]), NULL, &child_frame, param_ra, NULL, 1, 1, 1);
+  }
+
+  if (child_frame.return_chain_) sl_ir_clear_chain(blk, child_frame.return_chain_);
+  blk = sl_ir_stmt(blk, chain_reg, &child_frame, f->body_);
+  if (!blk) return NULL;
+  if (child_frame.return_chain_) sl_ir_join_chains(blk, chain_reg, chain_reg, child_frame.return_chain_);
+
+  /* Copy back the "out" and "inout" parameters */
+  for (n = 0; n < f->num_parameters_; ++n) {
+    struct sl_parameter *param = f->parameters_ + n;
+    int qualifiers = sl_type_qualifiers(param->type_);
+    if ((qualifiers & SL_PARAMETER_QUALIFIER_OUT) || (qualifiers & SL_PARAMETER_QUALIFIER_INOUT)) {
+      struct sl_expr *arg = x->children_[n];
+      sl_reg_emit_move_crossframe(blk, chain_reg, &child_frame, &param->variable_->reg_alloc_, NULL, frame, EXPR_RVALUE(arg), NULL, 1, 1, 1);
+      if (arg->offset_reg_.kind_ != slrak_void) {
+        /* Store rvalue into the actual lvalue passed in as the argument */
+        sl_reg_emit_move(blk, chain_reg, frame, EXPR_RVALUE(arg), NULL, &arg->base_regs_, &arg->offset_reg_);
+      }
+    }
+  }
+
+  return blk;
+}
+
+static struct ir_block *sl_ir_expr_node(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_execution_frame *frame, struct sl_expr *x);
+
 /* Writes code starting at the end of blk, that evaluates expression x and stores the
- * results in the reg_alloc of x. */
+ * results in the reg_alloc of x. Returns the block at the end of which x has been evaluated,
+ * or NULL on failure. The instructions appended have x as their source, see ir_instr::source_node_. */
 struct ir_block *sl_ir_expr(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_execution_frame *frame, struct sl_expr *x) {
+  struct ir_body *body;
+  const void *outer_source_node;
+  const struct situs *outer_source_loc;
   if (!x) return blk;
   if (!blk) return NULL;
+  body = blk->body_;
+  outer_source_node = body->source_node_;
+  outer_source_loc = body->source_loc_;
+  body->source_node_ = x;
+  body->source_loc_ = &x->op_loc_;
+  blk = sl_ir_expr_node(blk, chain_reg, frame, x);
+  body->source_node_ = outer_source_node;
+  body->source_loc_ = outer_source_loc;
+  return blk;
+}
+
+/* Lowers x to blk with x as the source of the instructions appended, see sl_ir_expr() */
+static struct ir_block *sl_ir_expr_node(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_execution_frame *frame, struct sl_expr *x) {
+  size_t n;
+  switch (x->op_) {
+    case exop_logical_and:
+    case exop_logical_or:
+    case exop_conditional:
+      /* Short circuit, children are evaluated on a subset of the chain */
+      break;
+    default:
+      for (n = 0; n < x->num_children_; ++n) {
+        blk = sl_ir_expr(blk, chain_reg, frame, x->children_[n]);
+      }
+      if (!blk) return NULL;
+      break;
+  }
+
   switch (x->op_) {
     case exop_variable:
       /* Should be a no-op in almost all cases, save for situations where the parent imposes an allocation, e.g. exop_conditional */
-      sl_reg_emit_move(blk, chain_reg, frame, &x->variable_->reg_alloc_, NULL, &x->base_regs_, &x->offset_reg_);
+      sl_reg_emit_move(blk, chain_reg, frame, &x->variable_->reg_alloc_, NULL, &x->base_regs_, NULL);
       break;
     case exop_literal:
       sl_ir_init_lit(blk, chain_reg, frame, &x->base_regs_, &x->literal_value_, 0);
       break;
     case exop_array_subscript:
-      blk = sl_ir_expr(blk, chain_reg, frame, x->children_[0]);
-      blk = sl_ir_expr(blk, chain_reg, frame, x->children_[1]);
       if (x->children_[0]->base_regs_.kind_ == slrak_array) {
         if (x->children_[0]->offset_reg_.kind_ != slrak_void) {
           /* the array being subscripted has already been subscripted */
           sl_ir_need_rvalue(blk, chain_reg, frame, x->children_[1]);
-          sl_ir_i_mul_constant_and_add(blk, chain_reg, 
-                                       x->offset_reg_.local_frame_ ? frame->local_int_offset_ + x->offset_reg_.v_.regs_[0] : x->offset_reg_.v_.regs_[0],
-                                       x->children_[0]->offset_reg_.local_frame_ ? frame->local_int_offset_ + x->children_[0]->offset_reg_.v_.regs_[0] : x->children_[0]->offset_reg_.v_.regs_[0],
+          sl_ir_i_mul_constant_and_add(blk, chain_reg,
+                                       (x->offset_reg_.local_frame_ ? frame->local_int_offset_ : 0) + x->offset_reg_.v_.regs_[0],
+                                       (x->children_[0]->offset_reg_.local_frame_ ? frame->local_int_offset_ : 0) + x->children_[0]->offset_reg_.v_.regs_[0],
                                        (uint64_t)x->children_[0]->base_regs_.v_.array_.num_elements_,
-                                       EXPR_RVALUE(x->children_[1])->local_frame_ ? frame->local_int_offset_ + EXPR_RVALUE(x->children_[1])->v_.regs_[0] : EXPR_RVALUE(x->children_[1])->v_.regs_[0]);
+                                       sl_ir_reg_index(frame, EXPR_RVALUE(x->children_[1]), 0));
         }
         else {
           /* First subscript of the array */
@@ -3860,73 +4406,65 @@ struct ir_block *sl_ir_expr(struct ir_block *blk, struct ir_temp *chain_reg, str
       else {
         /* Not an array, base must be indirect and this array subscript is an access to components,
          * e.g. "vec4 v; v[3] // access w" */
-        sl_ir_component_subscript(blk, chain_reg, frame, x, x->children_[0], x->children_[1]);
+        sl_ir_need_rvalue(blk, chain_reg, frame, x->children_[1]);
+        sl_ir_component_subscript(blk, chain_reg, frame, &x->base_regs_, &x->children_[0]->base_regs_, EXPR_RVALUE(x->children_[1]));
       }
       break;
-    case exop_component_selection: /* e.g. myvec3.xxz */
-    case exop_constructor: {
-      size_t ci;
-      for (ci = 0; ci < x->num_components_; ++ci) {
-        struct sl_component_selection *cs = x->swizzle_ + ci;
-        sl_reg_emit_move_c2c(blk, chain_reg, frame,
-                              &x->children_[cs->parameter_index_]->base_regs_, &x->children_[cs->parameter_index_]->offset_reg_,
-                              cs->component_index_,
-                              &x->base_regs_, &x->offset_reg_,
-                              (int)ci);
-      }
+    case exop_component_selection:
+      /* exop_component_selection is already pre-assigned into the right registers at compile-time */
       break;
-    }
-    case exop_field_selection:     /* e.g. mystruct.myfield */
-      blk = sl_ir_expr(blk, chain_reg, frame, x->children_[0]);
-      sl_reg_emit_move(blk, chain_reg, frame, 
-                       &x->children_[0]->base_regs_.v_.comp_.fields_[x->field_index_], &x->children_[0]->offset_reg_,
-                       &x->base_regs_, &x->offset_reg_);
+    case exop_constructor:
+      sl_ir_constructor(blk, chain_reg, frame, x);
+      break;
+    case exop_field_selection:
+      if (x->offset_reg_.kind_ == slrak_void) {
+        /* Likely a no-op unless the parent of the exop_field_selection interfered during register allocation. */
+        sl_reg_emit_move(blk, chain_reg, frame, &x->children_[0]->base_regs_.v_.comp_.fields_[x->field_index_], NULL, &x->base_regs_, NULL);
+      }
       break;
 
     case exop_post_inc:
-    case exop_post_dec:
-      /* Retrieve value from child base/offset into x and then dec/increment from x into the child and store,
-       * thus, the value that remains in x is pre dec/increment and the lvalue in the child is
-       * post dec/increment */
-      blk = sl_ir_expr(blk, chain_reg, frame, x->children_[0]);
-      sl_reg_emit_move(blk, chain_reg, frame,
-                       &x->children_[0]->base_regs_, &x->children_[0]->offset_reg_, 
-                       &x->base_regs_, NULL);
-
-      if (x->op_ == exop_post_inc) {
-        sl_ir_inc(blk, chain_reg, frame, EXPR_RVALUE(x->children_[0]), x);
+    case exop_post_dec: {
+      /* Retrieve value from child into x and then dec/increment from x into the child, thus, the value that
+       * remains in x is pre dec/increment and the lvalue in the child is post dec/increment */
+      struct sl_expr *c0 = x->children_[0];
+      if (c0->offset_reg_.kind_ != slrak_void) {
+        sl_reg_emit_move(blk, chain_reg, frame, &c0->base_regs_, &c0->offset_reg_, &x->base_regs_, NULL);
+        if (x->op_ == exop_post_inc) sl_ir_inc(blk, chain_reg, frame, &c0->rvalue_, EXPR_RVALUE(x));
+        else sl_ir_dec(blk, chain_reg, frame, &c0->rvalue_, EXPR_RVALUE(x));
+        sl_reg_emit_move(blk, chain_reg, frame, EXPR_RVALUE(c0), NULL, &c0->base_regs_, &c0->offset_reg_);
       }
-      else /* (x->op_ == exop_post_dec) */ {
-        sl_ir_dec(blk, chain_reg, frame, EXPR_RVALUE(x->children_[0]), x);
+      else {
+        sl_reg_emit_move(blk, chain_reg, frame, &c0->base_regs_, NULL, &x->base_regs_, NULL);
+        if (x->op_ == exop_post_inc) sl_ir_inc(blk, chain_reg, frame, &c0->base_regs_, &x->base_regs_);
+        else sl_ir_dec(blk, chain_reg, frame, &c0->base_regs_, &x->base_regs_);
       }
-      sl_reg_emit_move(blk, chain_reg, frame, 
-                       EXPR_RVALUE(x->children_[0]), NULL, 
-                       &x->children_[0]->base_regs_, &x->children_[0]->offset_reg_);
       break;
+    }
 
     case exop_pre_inc:
-    case exop_pre_dec:
-      blk = sl_ir_expr(blk, chain_reg, frame, x->children_[0]);
-      sl_ir_need_rvalue(blk, chain_reg, frame, x->children_[0]);
-      if (x->op_ == exop_pre_inc) {
-        sl_ir_inc(blk, chain_reg, frame, &x->base_regs_, x->children_[0]);
+    case exop_pre_dec: {
+      struct sl_expr *c0 = x->children_[0];
+      if (c0->offset_reg_.kind_ != slrak_void) {
+        sl_reg_emit_move(blk, chain_reg, frame, &c0->base_regs_, &c0->offset_reg_, &c0->rvalue_, NULL);
+        if (x->op_ == exop_pre_inc) sl_ir_inc(blk, chain_reg, frame, &x->base_regs_, EXPR_RVALUE(c0));
+        else sl_ir_dec(blk, chain_reg, frame, &x->base_regs_, EXPR_RVALUE(c0));
+        sl_reg_emit_move(blk, chain_reg, frame, EXPR_RVALUE(x), NULL, &c0->base_regs_, &c0->offset_reg_);
       }
-      else /* (x->op_ == exop_pre_dec) */ {
-        sl_ir_dec(blk, chain_reg, frame, &x->base_regs_, x->children_[0]);
+      else {
+        if (x->op_ == exop_pre_inc) sl_ir_inc(blk, chain_reg, frame, &x->base_regs_, EXPR_RVALUE(c0));
+        else sl_ir_dec(blk, chain_reg, frame, &x->base_regs_, EXPR_RVALUE(c0));
+        sl_reg_emit_move(blk, chain_reg, frame, &x->base_regs_, NULL, &c0->base_regs_, NULL);
       }
-      sl_reg_emit_move(blk, chain_reg, frame, 
-                       &x->base_regs_, &x->offset_reg_,
-                       &x->children_[0]->base_regs_, &x->children_[0]->offset_reg_);
       break;
+    }
 
     case exop_negate:
-      blk = sl_ir_expr(blk, chain_reg, frame, x->children_[0]);
       sl_ir_need_rvalue(blk, chain_reg, frame, x->children_[0]);
       sl_ir_negate(blk, chain_reg, frame, x, x->children_[0]);
       break;
 
     case exop_logical_not:
-      blk = sl_ir_expr(blk, chain_reg, frame, x->children_[0]);
       sl_ir_need_rvalue(blk, chain_reg, frame, x->children_[0]);
       sl_ir_not(blk, chain_reg, frame, x, x->children_[0]);
       break;
@@ -3941,267 +4479,135 @@ struct ir_block *sl_ir_expr(struct ir_block *blk, struct ir_temp *chain_reg, str
     case exop_gt:
     case exop_eq:
     case exop_ne:
-      blk = sl_ir_expr(blk, chain_reg, frame, x->children_[0]);
-      blk = sl_ir_expr(blk, chain_reg, frame, x->children_[1]);
+    case exop_logical_xor:
+    case exop_mul_assign:
+    case exop_div_assign:
+    case exop_add_assign:
+    case exop_sub_assign:
       sl_ir_need_rvalue(blk, chain_reg, frame, x->children_[0]);
       sl_ir_need_rvalue(blk, chain_reg, frame, x->children_[1]);
       switch (x->op_) {
-        case exop_multiply: sl_ir_mul(blk, chain_reg, frame, x, x->children_[0], x->children_[1]); break;
-        case exop_divide: sl_ir_div(blk, chain_reg, frame, x, x->children_[0], x->children_[1]); break;
-        case exop_add: sl_ir_add(blk, chain_reg, frame, x, x->children_[0], x->children_[1]); break;
-        case exop_subtract: sl_ir_sub(blk, chain_reg, frame, x, x->children_[0], x->children_[1]); break;
+        case exop_multiply:
+        case exop_mul_assign: sl_ir_mul(blk, chain_reg, frame, x, x->children_[0], x->children_[1]); break;
+        case exop_divide:
+        case exop_div_assign: sl_ir_div(blk, chain_reg, frame, x, x->children_[0], x->children_[1]); break;
+        case exop_add:
+        case exop_add_assign: sl_ir_add(blk, chain_reg, frame, x, x->children_[0], x->children_[1]); break;
+        case exop_subtract:
+        case exop_sub_assign: sl_ir_sub(blk, chain_reg, frame, x, x->children_[0], x->children_[1]); break;
         case exop_lt: sl_ir_lt(blk, chain_reg, frame, x, x->children_[0], x->children_[1]); break;
         case exop_le: sl_ir_le(blk, chain_reg, frame, x, x->children_[0], x->children_[1]); break;
         case exop_ge: sl_ir_ge(blk, chain_reg, frame, x, x->children_[0], x->children_[1]); break;
         case exop_gt: sl_ir_gt(blk, chain_reg, frame, x, x->children_[0], x->children_[1]); break;
         case exop_eq: sl_ir_eq(blk, chain_reg, frame, x, x->children_[0], x->children_[1]); break;
         case exop_ne: sl_ir_ne(blk, chain_reg, frame, x, x->children_[0], x->children_[1]); break;
+        case exop_logical_xor: sl_ir_log_xor(blk, chain_reg, frame, x, x->children_[0], x->children_[1]); break;
       }
-      break;
-
-    case exop_function_call:
-      if (x->function_->builtin_emit_fn_) {
-        blk = x->function_->builtin_emit_fn_(blk, chain_reg, frame, x);
-      }
-      else {
-        struct sl_execution_frame child_frame = *frame;
-        child_frame.f_ = x->function_;
-        /* Establish new frame */
-        child_frame.local_float_offset_ += (int)x->function_->frame_.ract_.rra_floats_.watermark_;
-        child_frame.local_int_offset_ += (int)x->function_->frame_.ract_.rra_ints_.watermark_;
-        child_frame.local_bool_offset_ += (int)x->function_->frame_.ract_.rra_bools_.watermark_;
-        child_frame.local_sampler2D_offset_ += (int)x->function_->frame_.ract_.rra_sampler2D_.watermark_;
-        child_frame.local_samplerCube_offset_ += (int)x->function_->frame_.ract_.rra_samplerCube_.watermark_;
-        size_t n;
-        for (n = 0; n < x->function_->num_parameters_; ++n) {
-          struct sl_variable *param = x->function_->parameters_[n].variable_;
-          int param_qualifiers = sl_type_qualifiers(param->type_);
-          struct sl_reg_alloc *param_ra = &param->reg_alloc_;
-          sl_ir_need_rvalue(blk, chain_reg, frame, x->children_[n]);
-          struct sl_reg_alloc *call_arg_ra = EXPR_RVALUE(x->children_[n]);
-
-          if ((param_qualifiers & SL_PARAMETER_QUALIFIER_IN) ||
-              (param_qualifiers & SL_PARAMETER_QUALIFIER_INOUT) ||
-              !(param_qualifiers & SL_PARAMETER_QUALIFIER_MASK)) {
-            /* Either in, inout, or no parameter qualifier specified: copy the argument in */
-            sl_reg_emit_move_crossframe(blk, chain_reg, frame, &x->children_[n]->base_regs_, &x->children_[n]->offset_reg_, &child_frame, param_ra, NULL, 1, 1, 1);
-          }
-        }
-
-        /* Invoke function body and emit the function inline here */
-
-        struct ir_temp *return_chain = ir_body_alloc_temp_unused_virtual(blk->body_);
-        struct ir_temp *no_chain_lit = ir_body_alloc_temp_liti(blk->body_, SL_EXEC_NO_CHAIN);
-        struct ir_instr *clear_return_chain = ir_block_append_instr(blk, GIR_MOVE);
-        ir_instr_append_def(clear_return_chain, return_chain);
-        ir_instr_append_use(clear_return_chain, no_chain_lit);
-        child_frame.return_chain_ = return_chain;
-
-        blk = sl_ir_stmt(blk, chain_reg, &child_frame, x->function_->body_);
-
-        struct ir_instr *rejoin = ir_block_append_instr(blk, SLIR_JOIN_EXEC_CHAINS);
-        ir_instr_append_def(rejoin, chain_reg);
-        ir_instr_append_use(rejoin, chain_reg);
-        ir_instr_append_use(rejoin, return_chain);
-
-        for (n = 0; n < x->function_->num_parameters_; ++n) {
-          struct sl_variable *param = x->function_->parameters_[n].variable_;
-          int param_qualifiers = sl_type_qualifiers(param->type_);
-          struct sl_reg_alloc *param_ra = &param->reg_alloc_;
-          sl_ir_need_rvalue(blk, chain_reg, frame, x->children_[n]);
-          struct sl_reg_alloc *call_arg_ra = EXPR_RVALUE(x->children_[n]);
-
-          if ((param_qualifiers & SL_PARAMETER_QUALIFIER_OUT) ||
-              (param_qualifiers & SL_PARAMETER_QUALIFIER_INOUT)) {
-            /* Either out, or inout parameter qualifier specified: copy the argument back out into the parameter passed in.. */
-            sl_reg_emit_move_crossframe(blk, chain_reg, &child_frame, param_ra, NULL, frame, &x->children_[n]->base_regs_, &x->children_[n]->offset_reg_, 1, 1, 1);
-          }
-        }
+      if ((x->op_ == exop_mul_assign) || (x->op_ == exop_div_assign) || (x->op_ == exop_add_assign) || (x->op_ == exop_sub_assign)) {
+        sl_reg_emit_move(blk, chain_reg, frame, EXPR_RVALUE(x), NULL, &x->children_[0]->base_regs_, &x->children_[0]->offset_reg_);
       }
-
       break;
 
-    case exop_logical_and: {
-      blk = sl_ir_expr(blk, chain_reg, frame, x->children_[0]);
-      sl_ir_need_rvalue(blk, chain_reg, frame, x->children_[0]);
-      /* Exec chain where condition_var is true (regular int), and where it is false.. */
-      struct ir_temp *true_chain = ir_body_alloc_temp_unused_virtual(blk->body_);
-      struct ir_temp *false_chain = ir_body_alloc_temp_unused_virtual(blk->body_);
-      struct ir_instr *split_left = ir_block_append_instr(blk, SLIR_SPLIT_EXEC_CHAIN_BY_CONDITION);
-      ir_instr_append_def(split_left, true_chain);
-      ir_instr_append_def(split_left, false_chain);
-      ir_instr_append_use(split_left, ir_body_alloc_temp_banked_bool(blk->body_, EXPR_RVALUE(x->children_[0])->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(x->children_[0])->v_.regs_[0] : EXPR_RVALUE(x->children_[0])->v_.regs_[0]));
-      ir_instr_append_use(split_left, chain_reg);
-
-      /* Where the first child expr (left) is false, we can already assign the outcome. */
-      sl_reg_emit_move(blk, false_chain, frame, &x->children_[0]->base_regs_, &x->children_[0]->offset_reg_,
-                       &x->base_regs_, &x->offset_reg_);
-
-      struct ir_instr *cmp_instr = ir_block_append_instr(blk, GIR_COMPARE);
-      ir_instr_append_use(cmp_instr, true_chain);
-      ir_instr_append_use(cmp_instr, ir_body_alloc_temp_liti(blk->body_, SL_EXEC_NO_CHAIN));
-      
-      struct ir_block *true_branch = ir_body_alloc_block(blk->body_);
-      struct ir_block *after = ir_body_alloc_block(blk->body_);
-
-      struct ir_instr *bne = ir_block_append_instr(blk, GIR_BRANCH_NOT_EQUAL);
-      ir_instr_append_use(bne, ir_body_alloc_temp_block(blk->body_, true_branch));
-      ir_instr_append_use(bne, ir_body_alloc_temp_block(blk->body_, after));
-
-      struct ir_block *after_true_branch = sl_ir_expr(true_branch, true_chain, frame, x->children_[1]);
-      /* Move results of true branch (those results where left expr is true, and right expr therefore determines
-       * the result.) */
-      sl_reg_emit_move(after_true_branch, true_chain, frame,
-                       &x->children_[1]->base_regs_, &x->children_[1]->offset_reg_,
-                       &x->base_regs_, &x->offset_reg_);
-
-      struct ir_instr *bra = ir_block_append_instr(after_true_branch, GIR_JUMP);
-      ir_instr_append_use(bra, ir_body_alloc_temp_block(blk->body_, after));
-
-      /* All done */
-      return after;
-
-      break;
-    }
-
-    case exop_logical_or: {
-      blk = sl_ir_expr(blk, chain_reg, frame, x->children_[0]);
-      sl_ir_need_rvalue(blk, chain_reg, frame, x->children_[0]);
-
-      /* Exec chain where condition_var is true (regular int), and where it is false.. */
-      struct ir_temp *true_chain = ir_body_alloc_temp_unused_virtual(blk->body_);
-      struct ir_temp *false_chain = ir_body_alloc_temp_unused_virtual(blk->body_);
-      struct ir_instr *split_left = ir_block_append_instr(blk, SLIR_SPLIT_EXEC_CHAIN_BY_CONDITION);
-      ir_instr_append_def(split_left, true_chain);
-      ir_instr_append_def(split_left, false_chain);
-      ir_instr_append_use(split_left, ir_body_alloc_temp_banked_bool(blk->body_, EXPR_RVALUE(x->children_[0])->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(x->children_[0])->v_.regs_[0] : EXPR_RVALUE(x->children_[0])->v_.regs_[0]));
-      ir_instr_append_use(split_left, chain_reg);
-
-      /* Where the first child expr (left) is true, we can already assign the outcome */
-      sl_reg_emit_move(blk, true_chain, frame, &x->children_[0]->base_regs_, &x->children_[0]->offset_reg_,
-                       &x->base_regs_, &x->offset_reg_);
-
-      struct ir_instr *cmp_instr = ir_block_append_instr(blk, GIR_COMPARE);
-      ir_instr_append_use(cmp_instr, false_chain);
-      ir_instr_append_use(cmp_instr, ir_body_alloc_temp_liti(blk->body_, SL_EXEC_NO_CHAIN));
-
-      struct ir_block *false_branch = ir_body_alloc_block(blk->body_);
-      struct ir_block *after = ir_body_alloc_block(blk->body_);
-
-      struct ir_instr *bne = ir_block_append_instr(blk, GIR_BRANCH_NOT_EQUAL);
-      ir_instr_append_use(bne, ir_body_alloc_temp_block(blk->body_, false_branch));
-      ir_instr_append_use(bne, ir_body_alloc_temp_block(blk->body_, after));
-
-      false_branch = sl_ir_expr(false_branch, false_chain, frame, x->children_[1]);
-      /* Move results of true branch (those results where left expr is true, and right expr therefore determines
-       * the result.) */
-      sl_reg_emit_move(false_branch, false_chain, frame,
-                       &x->children_[1]->base_regs_, &x->children_[1]->offset_reg_,
-                       &x->base_regs_, &x->offset_reg_);
-
-      struct ir_instr *bra = ir_block_append_instr(false_branch, GIR_JUMP);
-      ir_instr_append_use(bra, ir_body_alloc_temp_block(blk->body_, after));
-
-      /* All done */
-      return after;
-
-    }
-
-    case exop_logical_xor:
-      blk = sl_ir_expr(blk, chain_reg, frame, x->children_[0]);
-      blk = sl_ir_expr(blk, chain_reg, frame, x->children_[1]);
-      sl_ir_need_rvalue(blk, chain_reg, frame, x->children_[0]);
+    case exop_assign:
       sl_ir_need_rvalue(blk, chain_reg, frame, x->children_[1]);
-      sl_ir_log_xor(blk, chain_reg, frame, x, x->children_[0], x->children_[1]);
+      sl_reg_emit_move(blk, chain_reg, frame, EXPR_RVALUE(x->children_[1]), NULL, &x->children_[0]->base_regs_, &x->children_[0]->offset_reg_);
       break;
 
-    case exop_assign:
-      sl_reg_emit_move(blk, chain_reg, frame, 
-                       &x->children_[1]->base_regs_, &x->children_[1]->offset_reg_,
-                       &x->children_[0]->base_regs_, &x->children_[0]->offset_reg_);
+    case exop_function_call:
+      blk = sl_ir_function_call(blk, chain_reg, frame, x);
       break;
 
-    case exop_mul_assign:
-    case exop_div_assign:
-    case exop_add_assign:
-    case exop_sub_assign:
+    case exop_logical_and:
+    case exop_logical_or: {
+      struct ir_temp *true_chain, *false_chain, *rhs_chain;
+      struct ir_block *rhs_blk, *rhs_end, *after;
       blk = sl_ir_expr(blk, chain_reg, frame, x->children_[0]);
-      blk = sl_ir_expr(blk, chain_reg, frame, x->children_[1]);
+      if (!blk) return NULL;
       sl_ir_need_rvalue(blk, chain_reg, frame, x->children_[0]);
-      sl_ir_need_rvalue(blk, chain_reg, frame, x->children_[1]);
-      switch (x->op_) {
-        case exop_mul_assign: sl_ir_mul(blk, chain_reg, frame, x, x->children_[0], x->children_[1]); break;
-        case exop_div_assign: sl_ir_div(blk, chain_reg, frame, x, x->children_[0], x->children_[1]); break;
-        case exop_add_assign: sl_ir_add(blk, chain_reg, frame, x, x->children_[0], x->children_[1]); break;
-        case exop_sub_assign: sl_ir_sub(blk, chain_reg, frame, x, x->children_[0], x->children_[1]); break;
-      }
-      sl_reg_emit_move(blk, chain_reg, frame, 
-                       &x->base_regs_, &x->offset_reg_,
-                       &x->children_[0]->base_regs_, &x->children_[0]->offset_reg_);
+      true_chain = ir_body_alloc_temp_unused_virtual(blk->body_);
+      false_chain = ir_body_alloc_temp_unused_virtual(blk->body_);
+      sl_ir_split_chain(blk, chain_reg, frame, x->children_[0], true_chain, false_chain);
+
+      /* Where the left operand already determines the outcome, we can assign it. */
+      sl_reg_emit_move(blk, (x->op_ == exop_logical_and) ? false_chain : true_chain, frame, EXPR_RVALUE(x->children_[0]), NULL, &x->base_regs_, NULL);
+
+      /* Elsewhere, the right operand determines the outcome */
+      rhs_chain = (x->op_ == exop_logical_and) ? true_chain : false_chain;
+      rhs_blk = ir_body_alloc_block(blk->body_);
+      rhs_end = sl_ir_expr(rhs_blk, rhs_chain, frame, x->children_[1]);
+      sl_ir_need_rvalue(rhs_end, rhs_chain, frame, x->children_[1]);
+      sl_reg_emit_move(rhs_end, rhs_chain, frame, EXPR_RVALUE(x->children_[1]), NULL, &x->base_regs_, NULL);
+
+      after = ir_body_alloc_block(blk->body_);
+      sl_ir_branch_on_chain(blk, rhs_chain, rhs_blk, after);
+      sl_ir_jump(rhs_end, after);
+      if (!rhs_end || !after) return NULL;
+      sl_ir_join_chains(after, chain_reg, true_chain, false_chain);
+      blk = after;
       break;
+    }
 
     case exop_sequence:    // comma operator
-      blk = sl_ir_expr(blk, chain_reg, frame, x->children_[0]);
-      blk = sl_ir_expr(blk, chain_reg, frame, x->children_[1]);
+      if (!sl_reg_alloc_are_equal(&x->base_regs_, &x->children_[1]->base_regs_)) {
+        sl_ir_need_rvalue(blk, chain_reg, frame, x->children_[1]);
+        sl_reg_emit_move(blk, chain_reg, frame, EXPR_RVALUE(x->children_[1]), NULL, &x->base_regs_, NULL);
+      }
       break;
 
-    case exop_conditional: { // ternary ?: operator
-      blk = sl_ir_expr(blk, chain_reg, frame, x->children_[0]);
-      sl_ir_need_rvalue(blk, chain_reg, frame, x->children_[0]);
-
-      struct ir_temp *true_chain = ir_body_alloc_temp_unused_virtual(blk->body_);
-      struct ir_temp *false_chain = ir_body_alloc_temp_unused_virtual(blk->body_);
-      struct ir_instr *split_left = ir_block_append_instr(blk, SLIR_SPLIT_EXEC_CHAIN_BY_CONDITION);
-      ir_instr_append_def(split_left, true_chain);
-      ir_instr_append_def(split_left, false_chain);
-      ir_instr_append_use(split_left, ir_body_alloc_temp_banked_bool(blk->body_, EXPR_RVALUE(x->children_[0])->local_frame_ ? frame->local_float_offset_ + EXPR_RVALUE(x->children_[0])->v_.regs_[0] : EXPR_RVALUE(x->children_[0])->v_.regs_[0]));
-      ir_instr_append_use(split_left, chain_reg);
-
-      struct ir_instr *cmp_instr = ir_block_append_instr(blk, GIR_COMPARE);
-      struct ir_temp *no_chain_lit = ir_body_alloc_temp_liti(blk->body_, SL_EXEC_NO_CHAIN);
-      ir_instr_append_use(cmp_instr, true_chain);
-      ir_instr_append_use(cmp_instr, no_chain_lit);
-
-      struct ir_block *true_branch = ir_body_alloc_block(blk->body_);
-      struct ir_block *after_true_branch = ir_body_alloc_block(blk->body_);
-
-      struct ir_instr *bne = ir_block_append_instr(blk, GIR_BRANCH_NOT_EQUAL);
-      ir_instr_append_use(bne, ir_body_alloc_temp_block(blk->body_, true_branch));
-      ir_instr_append_use(bne, ir_body_alloc_temp_block(blk->body_, after_true_branch));
-
-      // .. true_branch
-      true_branch = sl_ir_expr(true_branch, true_chain, frame, x->children_[1]);
-
-      sl_reg_emit_move(true_branch, true_chain, frame, &x->children_[1]->base_regs_, &x->children_[1]->offset_reg_,
-                       &x->base_regs_, &x->offset_reg_);
-
-      struct ir_instr *bra = ir_block_append_instr(true_branch, GIR_JUMP);
-      ir_instr_append_use(bra, ir_body_alloc_temp_block(blk->body_, after_true_branch));
-
-      cmp_instr = ir_block_append_instr(after_true_branch, GIR_COMPARE);
-      ir_instr_append_use(cmp_instr, false_chain);
-      ir_instr_append_use(cmp_instr, no_chain_lit);
-
-      struct ir_block *false_branch = ir_body_alloc_block(blk->body_);
-      struct ir_block *after_false_branch = ir_body_alloc_block(blk->body_);
-
-      bne = ir_block_append_instr(blk, GIR_BRANCH_NOT_EQUAL);
-      ir_instr_append_use(bne, ir_body_alloc_temp_block(blk->body_, false_branch));
-      ir_instr_append_use(bne, ir_body_alloc_temp_block(blk->body_, after_false_branch));
+    case exop_conditional: // ternary ?: operator
+      blk = sl_ir_if_else(blk, chain_reg, frame, x->children_[0], NULL, NULL, x->children_[1], x->children_[2], x);
+      break;
+  }
 
-      // .. false_branch
-      false_branch = sl_ir_expr(false_branch, false_chain, frame, x->children_[2]);
+  return blk;
+}
 
-      sl_reg_emit_move(false_branch, false_chain, frame, &x->children_[2]->base_regs_, &x->children_[2]->offset_reg_,
-                       &x->base_regs_, &x->offset_reg_);
+int sl_ir_lower_function(struct ir_body *body, struct sl_compilation_unit *cu, struct sl_function *f,
+                         size_t inline_threshold, size_t unroll_max_size, struct ir_temp **pexec_chain, struct ir_temp **pdiscard_chain) {
+  struct sl_execution_frame frame = { 0 };
+  struct ir_temp *exec_chain, *discard_chain;
+  struct ir_block *blk;
+  struct sl_variable *v;
+
+  if (!f->body_) return -1;
+
+  blk = ir_body_alloc_block(body);
+  if (!blk) return -1;
+  exec_chain = ir_body_alloc_temp_unused_virtual(body);
+  discard_chain = ir_body_alloc_temp_unused_virtual(body);
+
+  frame.f_ = f;
+  frame.local_float_offset_ = (int)cu->global_frame_.ract_.rra_floats_.watermark_;
+  frame.local_int_offset_ = (int)cu->global_frame_.ract_.rra_ints_.watermark_;
+  frame.local_bool_offset_ = (int)cu->global_frame_.ract_.rra_bools_.watermark_;
+  frame.local_sampler2D_offset_ = (int)cu->global_frame_.ract_.rra_sampler2D_.watermark_;
+  frame.local_samplerCube_offset_ = (int)cu->global_frame_.ract_.rra_samplerCube_.watermark_;
+  frame.return_chain_ = ir_body_alloc_temp_unused_virtual(body);
+  frame.discard_chain_ = discard_chain;
+  frame.inline_threshold_ = inline_threshold;
+  frame.unroll_max_size_ = unroll_max_size;
+
+  sl_ir_clear_chain(blk, frame.return_chain_);
+  sl_ir_clear_chain(blk, discard_chain);
+
+  v = cu->global_frame_.variables_;
+  if (v) {
+    do {
+      v = v->chain_;
+      if (!v->is_externally_initialized_) {
+        sl_ir_init_lit(blk, exec_chain, &frame, &v->reg_alloc_, &v->value_, 0);
+      }
+    } while (v != cu->global_frame_.variables_);
+  }
 
-      bra = ir_block_append_instr(false_branch, GIR_JUMP);
-      ir_instr_append_use(bra, ir_body_alloc_temp_block(blk->body_, after_false_branch));
+  blk = sl_ir_stmt(blk, exec_chain, &frame, f->body_);
+  if (!blk) return -1;
+  sl_ir_join_chains(blk, exec_chain, exec_chain, frame.return_chain_);
+  ir_block_append_instr(blk, GIR_RETURN);
 
-      return after_false_branch;
-    }
-  }
+  if (body->alloc_error_) return -1;
 
-  return blk;
+  *pexec_chain = exec_chain;
+  *pdiscard_chain = discard_chain;
+  return 0;
 }
-
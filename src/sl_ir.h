@@ -94,6 +94,7 @@ enum generic_ir_instr_code {
 
 enum sl_ir_instr_code {
   SLIR_SPLIT_EXEC_CHAIN_BY_CONDITION = GIR_END_OF_GIR_ENUMS,
+  SLIR_SPLIT_EXEC_CHAIN_BY_UNIFORM_CONDITION,
   SLIR_JOIN_EXEC_CHAINS,
 
   SLIR_NEG_F,
@@ -107,6 +108,40 @@ enum sl_ir_instr_code {
   SLIR_DOT3,
   SLIR_DOT4,
 
+  /* Fused matrix products, see sl_exec_f_matrix_product(); operands are the chain, the result components,
+   * the left components and the right components, all in column-major order. */
+  SLIR_MAT2_MUL_VEC2,
+  SLIR_MAT3_MUL_VEC3,
+  SLIR_MAT4_MUL_VEC4,
+  SLIR_VEC2_MUL_MAT2,
+  SLIR_VEC3_MUL_MAT3,
+  SLIR_VEC4_MUL_MAT4,
+  SLIR_MAT2_MUL_MAT2,
+  SLIR_MAT3_MUL_MAT3,
+  SLIR_MAT4_MUL_MAT4,
+
+  /* The float builtins max(), clamp() and mix(), one component per instruction, see sl_ir_bind_builtin_emit_fn();
+   * operands are the chain, the result and the arguments in order. */
+  SLIR_MAX_F,
+  SLIR_CLAMP_F,
+  SLIR_MIX_F,
+
+  /* Superinstructions, formed by sl_ir_optimize() (SL_IR_OPT_FUSE) from an instruction and the one preceding it
+   * that computes one of its operands, computing the same result without storing the intermediate value.
+   * SLIR_MAD_F: chain, result, a, b, c: a * b + c (SLIR_MUL_F followed by SLIR_ADD_F)
+   * SLIR_LERP_F: chain, result, a, b, t: (b - a) * t + a (SLIR_SUB_F followed by SLIR_MAD_F)
+   * SLIR_DOTn_MAX_F: chain, result, left components, right components, lower bound: max(dot(left, right), lower)
+   * SLIR_DOTn_CLAMP_F: chain, result, left components, right components, lower and upper bound:
+   * clamp(dot(left, right), lower, upper) */
+  SLIR_MAD_F,
+  SLIR_LERP_F,
+  SLIR_DOT2_MAX_F,
+  SLIR_DOT3_MAX_F,
+  SLIR_DOT4_MAX_F,
+  SLIR_DOT2_CLAMP_F,
+  SLIR_DOT3_CLAMP_F,
+  SLIR_DOT4_CLAMP_F,
+
   SLIR_DIV_F,
   SLIR_DIV_I,
 
@@ -324,15 +359,48 @@ enum sl_ir_instr_code {
   SLIR_REG_MOVE_SC_INDIR_OFFSET_TO_REG,
   SLIR_REG_MOVE_SC_INDIR_OFFSET_TO_INDIR,
   SLIR_REG_MOVE_SC_INDIR_OFFSET_TO_OFFSET_REG,
-  SLIR_REG_MOVE_SC_INDIR_OFFSET_TO_INDIR_OFFSET
+  SLIR_REG_MOVE_SC_INDIR_OFFSET_TO_INDIR_OFFSET,
+
+  /* Invokes the builtin_runtime_fn_ of the exop_function_call expression, operands are the chain, the expression
+   * and the five local frame offsets (float, int, bool, sampler2D, samplerCube) the expression is evaluated in. */
+  SLIR_CALL_BUILTIN
 };
 
+struct sl_compilation_unit;
+struct sl_function;
+
 void sl_ir_register_instructions(struct ireg_registry *reg);
 
+/* If instruction_code is one of the fused matrix products (SLIR_MAT2_MUL_VEC2 .. SLIR_MAT4_MUL_MAT4), stores the
+ * number of rows of the left operand, the inner dimension and the number of columns of the right operand, and
+ * returns non-zero. Returns 0 for any other instruction. */
+int sl_ir_matrix_product_shape(int instruction_code, int *num_rows, int *inner, int *num_cols);
+
+/* Sets the builtin_emit_fn_ of builtin function f if its calls are lowered to SLIR kernels rather than to a
+ * SLIR_CALL_BUILTIN of its builtin_runtime_fn_; this is the case for max(), clamp() and mix(), whose forms
+ * all take and return floats. */
+void sl_ir_bind_builtin_emit_fn(struct sl_function *f);
+
 void sl_ir_need_rvalue(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_execution_frame *frame, struct sl_expr *x);
 struct ir_block *sl_ir_stmt(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_execution_frame *frame, struct sl_stmt *stmt);
 struct ir_block *sl_ir_expr(struct ir_block *blk, struct ir_temp *chain_reg, struct sl_execution_frame *frame, struct sl_expr *x);
 
+/* Lowers function f (typically "main") of compilation unit cu into body, function calls are inlined and globals
+ * that are not externally initialized are initialized first. Returns the virtuals holding the execution chain
+ * (on entry: the rows to run, on return: the rows that survived) and the discard chain (on return: the rows
+ * that were discarded.) Returns 0 upon success, or non-zero if f cannot be lowered.
+ * Functions of at most inline_threshold statements and expression nodes whose only return (if any) is their
+ * last statement are inlined directly: their statements run on the caller's execution chain, so the call does
+ * not split and join the chain around a return chain (which would also keep the optimizer from following values
+ * across the call.) Other functions are still inlined, but collect the rows that return in a return chain that
+ * is joined back after the call.
+ * For loops in the form of GLSL ES 1.00 Appendix A, whose loop index has a constant initial value, bound and
+ * increment, are unrolled if the number of iterations times the size of the loop body (plus one, for setting
+ * the loop index) is at most unroll_max_size; each iteration then sets the loop index to its constant value
+ * and runs the body, without evaluating the condition or splitting the chain. */
+int sl_ir_lower_function(struct ir_body *body, struct sl_compilation_unit *cu, struct sl_function *f,
+                         size_t inline_threshold, size_t unroll_max_size, struct ir_temp **pexec_chain, struct ir_temp **pdiscard_chain);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
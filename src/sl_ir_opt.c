@@ -0,0 +1,2139 @@
+/* Copyright 2024 Kinglet B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef STDINT_H_INCLUDED
+#define STDINT_H_INCLUDED
+#include <stdint.h>
+#endif
+
+#ifndef STDLIB_H_INCLUDED
+#define STDLIB_H_INCLUDED
+#include <stdlib.h>
+#endif
+
+#ifndef STRING_H_INCLUDED
+#define STRING_H_INCLUDED
+#include <string.h>
+#endif
+
+#ifndef LIMITS_H_INCLUDED
+#define LIMITS_H_INCLUDED
+#include <limits.h>
+#endif
+
+#ifndef SL_EXECUTION_H_INCLUDED
+#define SL_EXECUTION_H_INCLUDED
+#include "sl_execution.h"
+#endif
+
+#ifndef IR_REGISTRY_H_INCLUDED
+#define IR_REGISTRY_H_INCLUDED
+#include "ir_registry.h"
+#endif
+
+#ifndef SOURCE_GEN_H_INCLUDED
+#define SOURCE_GEN_H_INCLUDED
+#include "source_gen.h"
+#endif
+
+#ifndef IR_H_INCLUDED
+#define IR_H_INCLUDED
+#include "ir.h"
+#endif
+
+#ifndef SL_IR_H_INCLUDED
+#define SL_IR_H_INCLUDED
+#include "sl_ir.h"
+#endif
+
+#ifndef SL_EXPR_H_INCLUDED
+#define SL_EXPR_H_INCLUDED
+#include "sl_expr.h"
+#endif
+
+#ifndef SL_COMPILATION_UNIT_H_INCLUDED
+#define SL_COMPILATION_UNIT_H_INCLUDED
+#include "sl_compilation_unit.h"
+#endif
+
+#ifndef SL_IR_OPT_H_INCLUDED
+#define SL_IR_OPT_H_INCLUDED
+#include "sl_ir_opt.h"
+#endif
+
+/* Register banks, in the order of IR_FLOAT_BANK .. IR_SAMPLERCUBE_BANK */
+#define SL_IR_OPT_NUM_BANKS 5
+
+/* Most registers a single instruction accesses precisely, instructions accessing more are treated as
+ * having unknown effects. Builtins taking matrices are the largest. */
+#define SL_IR_OPT_MAX_ACCESSES 64
+
+/* Most operands (after chain and destination) of an instruction that is subject to CSE (SLIR_DOT4) */
+#define SL_IR_OPT_MAX_OPERANDS 8
+
+/* The passes enable one another (e.g. a propagated copy can make a move dead); they are repeated until
+ * nothing changes, or this many times. */
+#define SL_IR_OPT_MAX_ROUNDS 8
+
+/* Most instructions between a superinstruction's consumer and the producer it is fused with */
+#define SL_IR_OPT_FUSE_WINDOW 32
+
+/* Dead store elimination register states, when not DEAD or LIVE, the state is the chain that all reads
+ * of the register (up to the next write on all of its rows) are on. */
+#define SL_IR_OPT_DEAD -2
+#define SL_IR_OPT_LIVE -1
+
+/* sl_ir_opt_fact::const_chain_ of a constant register, which holds its value on the rows of any chain */
+#define SL_IR_OPT_ALL_CHAINS -2
+
+/* Register read or written by an instruction */
+struct sl_ir_opt_access {
+  int bank_;
+  int reg_;
+
+  /* The operand of the instruction, or NULL if the register is not an operand (e.g. read by a builtin) */
+  struct ir_arg *arg_;
+};
+
+/* What an instruction does to the registers and chains */
+struct sl_ir_opt_effects {
+  /* The chain (external_id_) the instruction runs on, -1 if it is not a kernel */
+  int chain_;
+
+  /* Non-zero if the only effect of the instruction is to write the registers in writes_, as a function of
+   * the registers in reads_ and its literal operands. */
+  int is_pure_;
+
+  /* Non-zero if, for each row, the instruction only reads that same row; builtins such as dFdx()
+   * may read neighbouring rows. */
+  int rows_local_;
+
+  /* Non-zero if the effects of the instruction are not known; anything may have changed */
+  int barrier_;
+
+  /* Non-zero if the instruction splits or joins chains, which may change the rows of any chain */
+  int restructures_chains_;
+
+  /* Chain redefined by the instruction (GIR_MOVE), or -1 */
+  int chain_def_;
+
+  size_t num_reads_;
+  struct sl_ir_opt_access reads_[SL_IR_OPT_MAX_ACCESSES];
+
+  size_t num_writes_;
+  struct sl_ir_opt_access writes_[SL_IR_OPT_MAX_ACCESSES];
+
+  /* Registers accessed through an index only known at runtime; any register of the bank from the one
+   * given and up may be accessed. INT_MAX if none. */
+  int unknown_read_from_[SL_IR_OPT_NUM_BANKS];
+  int unknown_write_from_[SL_IR_OPT_NUM_BANKS];
+};
+
+/* Known value of a float, int or bool register */
+struct sl_ir_opt_value {
+  float f_;
+  int64_t i_; /* int or bool (0..255) value */
+};
+
+/* What is known about a register at a point in a block */
+struct sl_ir_opt_fact {
+  /* Chain on whose rows the register holds value_, SL_IR_OPT_ALL_CHAINS for a constant register (see
+   * struct sl_ir_opt_constant), or -1 */
+  int const_chain_;
+  struct sl_ir_opt_value value_;
+
+  /* Chain on whose rows the register holds the same value as register copy_of_ of the same bank, or -1 */
+  int copy_chain_;
+  int copy_of_;
+};
+
+struct sl_ir_opt_operand {
+  int kind_; /* enum ir_temp_type */
+  int64_t value_; /* the register, or the bits of the literal */
+};
+
+/* Value held in register dst_reg_ of bank dst_bank_ on the rows of chain_ */
+struct sl_ir_opt_expr {
+  int instruction_code_;
+  int chain_;
+  size_t num_operands_;
+  struct sl_ir_opt_operand operands_[SL_IR_OPT_MAX_OPERANDS];
+  int dst_bank_;
+  int dst_reg_;
+};
+
+struct sl_ir_opt {
+  struct ir_body *body_;
+  int passes_;
+  struct sl_ir_opt_stats stats_;
+
+  /* Registers known to hold their values throughout, see sl_ir_optimize() */
+  const struct sl_ir_opt_constant *constants_;
+  size_t num_constants_;
+
+  /* Non-zero if the current round changed anything */
+  int changed_;
+
+  /* Number of registers referenced in each bank, and the first register of the local frame; registers
+   * below it are globals (e.g. varyings) that are read after the shader completes. */
+  int bank_size_[SL_IR_OPT_NUM_BANKS];
+  int watermark_[SL_IR_OPT_NUM_BANKS];
+
+  /* Forward passes: the facts for each register, the number of registers with a copy fact in each bank
+   * (so we can skip searching for copies of a register written), and the expressions available. */
+  struct sl_ir_opt_fact *facts_[SL_IR_OPT_NUM_BANKS];
+  int num_copies_[SL_IR_OPT_NUM_BANKS];
+  size_t num_exprs_;
+  size_t num_exprs_allocated_;
+  struct sl_ir_opt_expr *exprs_;
+
+  /* Instructions of the block being processed, the passes add and remove instructions as they go. */
+  size_t num_instrs_;
+  size_t num_instrs_allocated_;
+  struct ir_instr **instrs_;
+
+  /* Liveness: the state of each register while scanning a block backwards, and, for each block (by
+   * serial_num_ - 1), the registers live on its exit and entry. Registers of all banks are numbered
+   * consecutively from bank_base_ for the latter. */
+  int *states_[SL_IR_OPT_NUM_BANKS];
+  int bank_base_[SL_IR_OPT_NUM_BANKS];
+  size_t num_liveness_regs_;
+  size_t num_blocks_;
+  uint8_t *live_out_;
+  uint8_t *live_in_;
+};
+
+static int sl_ir_opt_bank(const struct ir_temp *temp) {
+  if (!temp) return -1;
+  switch (temp->kind_) {
+    case IR_FLOAT_BANK: return 0;
+    case IR_INT_BANK: return 1;
+    case IR_BOOL_BANK: return 2;
+    case IR_SAMPLER2D_BANK: return 3;
+    case IR_SAMPLERCUBE_BANK: return 4;
+    default: break;
+  }
+  return -1;
+}
+
+static int sl_ir_opt_is_literal(const struct ir_temp *temp) {
+  if (!temp) return 0;
+  switch (temp->kind_) {
+    case IR_LITERAL_UINT:
+    case IR_LITERAL_INT:
+    case IR_LITERAL_FLOAT:
+    case IR_LITERAL_DOUBLE:
+    case IR_LITERAL_BOOL:
+      return 1;
+    default:
+      break;
+  }
+  return 0;
+}
+
+static int sl_ir_opt_chain(const struct ir_temp *temp) {
+  if (!temp || (temp->kind_ != IR_VIRTUAL) || (temp->external_id_ < 0)) return -1;
+  return temp->external_id_;
+}
+
+static struct ir_temp *sl_ir_opt_bank_temp(struct ir_body *body, int bank, int reg) {
+  switch (bank) {
+    case 0: return ir_body_alloc_temp_banked_float(body, reg);
+    case 1: return ir_body_alloc_temp_banked_int(body, reg);
+    case 2: return ir_body_alloc_temp_banked_bool(body, reg);
+    case 3: return ir_body_alloc_temp_banked_sampler2D(body, reg);
+    case 4: return ir_body_alloc_temp_banked_samplerCube(body, reg);
+  }
+  return NULL;
+}
+
+/* Values are held in registers of sl_exec_int_t, which may be narrower than the literal */
+static int64_t sl_ir_opt_int(uint64_t v) {
+  return (int64_t)(sl_exec_int_t)v;
+}
+
+/* Decodes a SLIR_REG_MOVE_XXX instruction code, see sl_reg_emit_move_instr() for the encoding.
+ * Returns non-zero if code is a move. */
+static int sl_ir_opt_decode_move(int code, int *from_bank, int *to_bank, int *from_mode, int *to_mode) {
+  int offset, conversion;
+  if ((code < SLIR_REG_MOVE_F_REG_TO_REG) || (code > SLIR_REG_MOVE_SC_INDIR_OFFSET_TO_INDIR_OFFSET)) return 0;
+  offset = code - SLIR_REG_MOVE_F_REG_TO_REG;
+  conversion = offset / 16;
+  if (conversion == 9) {
+    *from_bank = *to_bank = 3;
+  }
+  else if (conversion == 10) {
+    *from_bank = *to_bank = 4;
+  }
+  else {
+    *from_bank = conversion / 3;
+    *to_bank = conversion % 3;
+  }
+  *from_mode = (offset / 4) % 4;
+  *to_mode = offset % 4;
+  return 1;
+}
+
+/* Returns the instruction code for a move without conversion between registers of bank */
+static int sl_ir_opt_move_code(int bank) {
+  switch (bank) {
+    case 0: return SLIR_REG_MOVE_F_REG_TO_REG;
+    case 1: return SLIR_REG_MOVE_I_REG_TO_REG;
+    case 2: return SLIR_REG_MOVE_B_REG_TO_REG;
+    case 3: return SLIR_REG_MOVE_S2D_REG_TO_REG;
+    case 4: return SLIR_REG_MOVE_SC_REG_TO_REG;
+  }
+  return -1;
+}
+
+/* Returns the register bank for values of kind, and the number of registers in *num_components, or -1
+ * if values of kind are not held in a fixed set of registers of a single bank. */
+static int sl_ir_opt_reg_alloc_bank(sl_reg_alloc_kind_t kind, int *num_components) {
+  switch (kind) {
+    case slrak_float: *num_components = 1; return 0;
+    case slrak_vec2: *num_components = 2; return 0;
+    case slrak_vec3: *num_components = 3; return 0;
+    case slrak_vec4: *num_components = 4; return 0;
+    case slrak_mat2: *num_components = 4; return 0;
+    case slrak_mat3: *num_components = 9; return 0;
+    case slrak_mat4: *num_components = 16; return 0;
+    case slrak_int: *num_components = 1; return 1;
+    case slrak_ivec2: *num_components = 2; return 1;
+    case slrak_ivec3: *num_components = 3; return 1;
+    case slrak_ivec4: *num_components = 4; return 1;
+    case slrak_bool: *num_components = 1; return 2;
+    case slrak_bvec2: *num_components = 2; return 2;
+    case slrak_bvec3: *num_components = 3; return 2;
+    case slrak_bvec4: *num_components = 4; return 2;
+    case slrak_sampler2D: *num_components = 1; return 3;
+    case slrak_samplerCube: *num_components = 1; return 4;
+    default: break;
+  }
+  return -1;
+}
+
+static void sl_ir_opt_add_access(struct sl_ir_opt_effects *fx, int is_write, int bank, int reg, struct ir_arg *arg) {
+  struct sl_ir_opt_access *acc;
+  if (is_write) {
+    if (fx->num_writes_ == SL_IR_OPT_MAX_ACCESSES) {
+      fx->barrier_ = 1;
+      return;
+    }
+    acc = fx->writes_ + fx->num_writes_++;
+  }
+  else {
+    if (fx->num_reads_ == SL_IR_OPT_MAX_ACCESSES) {
+      fx->barrier_ = 1;
+      return;
+    }
+    acc = fx->reads_ + fx->num_reads_++;
+  }
+  acc->bank_ = bank;
+  acc->reg_ = reg;
+  acc->arg_ = arg;
+}
+
+/* Adds the register operand arg, which must be of bank */
+static void sl_ir_opt_add_arg(struct sl_ir_opt_effects *fx, int is_write, int bank, struct ir_arg *arg) {
+  if (sl_ir_opt_bank(arg->temp_) != bank) {
+    fx->barrier_ = 1;
+    return;
+  }
+  sl_ir_opt_add_access(fx, is_write, bank, arg->temp_->temp_value_, arg);
+}
+
+static void sl_ir_opt_add_unknown(struct sl_ir_opt_effects *fx, int is_write, int bank, int from_reg) {
+  int *from = is_write ? fx->unknown_write_from_ : fx->unknown_read_from_;
+  if (from_reg < 0) from_reg = 0;
+  if (from_reg < from[bank]) from[bank] = from_reg;
+}
+
+/* Operands of one side of a register move, *pindex is the index of the first, and is advanced past the last. */
+static void sl_ir_opt_move_side_effects(struct sl_ir_opt_effects *fx, struct ir_instr *instr, size_t *pindex, int bank, int mode, int is_dst) {
+  size_t n = *pindex;
+  size_t num_args = (mode == 0) ? 1 : ((mode == 1) ? 2 : 4);
+  if ((n + num_args) > instr->num_args_) {
+    fx->barrier_ = 1;
+    return;
+  }
+  switch (mode) {
+    case 0: /* REG */
+      sl_ir_opt_add_arg(fx, is_dst, bank, instr->args_[n]);
+      break;
+    case 1: /* INDIR: int register holding the register */
+      sl_ir_opt_add_arg(fx, 0, SL_IR_OPT_INT, instr->args_[n]);
+      sl_ir_opt_add_unknown(fx, is_dst, bank, 0);
+      break;
+    case 2: /* OFFSET_REG: base register, offset in an int register */
+      if (sl_ir_opt_bank(instr->args_[n]->temp_) != bank) {
+        fx->barrier_ = 1;
+        break;
+      }
+      if (instr->args_[n + 2]->temp_ && (instr->args_[n + 2]->temp_->kind_ == IR_LITERAL_INT) && (instr->args_[n + 2]->temp_->lit_.i64_ < 0)) {
+        /* Negative fixed offset, the register accessed may precede the base */
+        sl_ir_opt_add_unknown(fx, is_dst, bank, 0);
+      }
+      else {
+        sl_ir_opt_add_unknown(fx, is_dst, bank, instr->args_[n]->temp_->temp_value_);
+      }
+      sl_ir_opt_add_arg(fx, 0, SL_IR_OPT_INT, instr->args_[n + 1]);
+      break;
+    case 3: /* INDIR_OFFSET: int register holding the register, offset in an int register */
+      sl_ir_opt_add_arg(fx, 0, SL_IR_OPT_INT, instr->args_[n]);
+      sl_ir_opt_add_arg(fx, 0, SL_IR_OPT_INT, instr->args_[n + 1]);
+      sl_ir_opt_add_unknown(fx, is_dst, bank, 0);
+      break;
+  }
+  *pindex = n + num_args;
+}
+
+/* Registers of ra read by a builtin, frame_offsets are the local frame offsets of the SLIR_CALL_BUILTIN. */
+static void sl_ir_opt_builtin_reads(struct sl_ir_opt_effects *fx, const struct sl_reg_alloc *ra, int has_offset, const int *frame_offsets) {
+  int bank, num_components, n;
+  if (ra->kind_ == slrak_void) return;
+  bank = sl_ir_opt_reg_alloc_bank(ra->kind_, &num_components);
+  if (bank < 0) {
+    for (n = 0; n < SL_IR_OPT_NUM_BANKS; ++n) {
+      sl_ir_opt_add_unknown(fx, 0, n, 0);
+    }
+    return;
+  }
+  if (ra->is_indirect_ || has_offset) {
+    sl_ir_opt_add_unknown(fx, 0, bank, 0);
+    sl_ir_opt_add_unknown(fx, 0, SL_IR_OPT_INT, 0);
+    return;
+  }
+  for (n = 0; n < num_components; ++n) {
+    sl_ir_opt_add_access(fx, 0, bank, (ra->local_frame_ ? frame_offsets[bank] : 0) + ra->v_.regs_[n], NULL);
+  }
+}
+
+/* SLIR_CALL_BUILTIN reads the registers of the children of the expression, and writes the base registers
+ * of the expression, see sl_bytecode_exec_kernel(). */
+static void sl_ir_opt_builtin_effects(struct sl_ir_opt_effects *fx, struct ir_instr *instr) {
+  int frame_offsets[SL_IR_OPT_NUM_BANKS];
+  struct sl_expr *x;
+  int bank, num_components, n;
+  size_t k;
+  if ((instr->num_args_ != (2 + SL_IR_OPT_NUM_BANKS)) || !instr->args_[1]->temp_ || (instr->args_[1]->temp_->kind_ != IR_LITERAL_UINT)) {
+    fx->barrier_ = 1;
+    return;
+  }
+  for (n = 0; n < SL_IR_OPT_NUM_BANKS; ++n) {
+    struct ir_temp *offset = instr->args_[2 + n]->temp_;
+    if (!offset || (offset->kind_ != IR_LITERAL_INT)) {
+      fx->barrier_ = 1;
+      return;
+    }
+    frame_offsets[n] = (int)offset->lit_.i64_;
+  }
+  x = (struct sl_expr *)(uintptr_t)instr->args_[1]->temp_->lit_.u64_;
+
+  bank = sl_ir_opt_reg_alloc_bank(x->base_regs_.kind_, &num_components);
+  if ((bank < 0) || x->base_regs_.is_indirect_) {
+    fx->barrier_ = 1;
+    return;
+  }
+  for (n = 0; n < num_components; ++n) {
+    sl_ir_opt_add_access(fx, 1, bank, (x->base_regs_.local_frame_ ? frame_offsets[bank] : 0) + x->base_regs_.v_.regs_[n], NULL);
+  }
+
+  for (k = 0; k < x->num_children_; ++k) {
+    struct sl_expr *child = x->children_[k];
+    int has_offset = child->offset_reg_.kind_ != slrak_void;
+    sl_ir_opt_builtin_reads(fx, &child->base_regs_, has_offset, frame_offsets);
+    sl_ir_opt_builtin_reads(fx, &child->rvalue_, 0, frame_offsets);
+  }
+}
+
+static void sl_ir_opt_get_effects(struct sl_ir_opt_effects *fx, struct ir_instr *instr) {
+  int code = instr->instruction_code_;
+  int n;
+  fx->chain_ = -1;
+  fx->is_pure_ = 0;
+  fx->rows_local_ = 0;
+  fx->barrier_ = 0;
+  fx->restructures_chains_ = 0;
+  fx->chain_def_ = -1;
+  fx->num_reads_ = 0;
+  fx->num_writes_ = 0;
+  for (n = 0; n < SL_IR_OPT_NUM_BANKS; ++n) {
+    fx->unknown_read_from_[n] = INT_MAX;
+    fx->unknown_write_from_[n] = INT_MAX;
+  }
+
+  if ((code >= SLIR_NEG_F) && (code <= SLIR_CALL_BUILTIN)) {
+    /* Kernel, the first operand is the chain */
+    int from_bank, to_bank, from_mode, to_mode;
+    if (!instr->num_args_) {
+      fx->barrier_ = 1;
+      return;
+    }
+    fx->chain_ = sl_ir_opt_chain(instr->args_[0]->temp_);
+    if (fx->chain_ < 0) {
+      fx->barrier_ = 1;
+      return;
+    }
+    if (code == SLIR_CALL_BUILTIN) {
+      sl_ir_opt_builtin_effects(fx, instr);
+    }
+    else if (sl_ir_opt_decode_move(code, &from_bank, &to_bank, &from_mode, &to_mode)) {
+      /* Destination operands precede the source operands */
+      size_t index = 1;
+      sl_ir_opt_move_side_effects(fx, instr, &index, to_bank, to_mode, 1);
+      if (!fx->barrier_) sl_ir_opt_move_side_effects(fx, instr, &index, from_bank, from_mode, 0);
+      if (index != instr->num_args_) fx->barrier_ = 1;
+      fx->is_pure_ = 1;
+      fx->rows_local_ = 1;
+    }
+    else {
+      size_t k;
+      for (k = 1; k < instr->num_args_; ++k) {
+        struct ir_arg *arg = instr->args_[k];
+        int bank = sl_ir_opt_bank(arg->temp_);
+        if (bank >= 0) {
+          if (arg->usage_ != IR_USE) sl_ir_opt_add_arg(fx, 1, bank, arg);
+          if (arg->usage_ != IR_DEF) sl_ir_opt_add_arg(fx, 0, bank, arg);
+        }
+        else if (!sl_ir_opt_is_literal(arg->temp_)) {
+          fx->barrier_ = 1;
+        }
+      }
+      fx->is_pure_ = 1;
+      fx->rows_local_ = 1;
+    }
+    return;
+  }
+
+  switch (code) {
+    case GIR_MOVE:
+      fx->chain_def_ = (instr->num_args_ == 2) ? sl_ir_opt_chain(instr->args_[0]->temp_) : -1;
+      if (fx->chain_def_ < 0) fx->barrier_ = 1;
+      break;
+    case SLIR_SPLIT_EXEC_CHAIN_BY_CONDITION:
+    case SLIR_SPLIT_EXEC_CHAIN_BY_UNIFORM_CONDITION:
+      fx->restructures_chains_ = 1;
+      if (instr->num_args_ == 4) {
+        sl_ir_opt_add_arg(fx, 0, SL_IR_OPT_BOOL, instr->args_[2]);
+      }
+      else {
+        fx->barrier_ = 1;
+      }
+      break;
+    case SLIR_JOIN_EXEC_CHAINS:
+      fx->restructures_chains_ = 1;
+      break;
+    case GIR_COMPARE:
+    case GIR_BRANCH_NOT_EQUAL:
+    case GIR_JUMP:
+    case GIR_RETURN:
+      /* Control flow on chains only */
+      break;
+    default:
+      fx->barrier_ = 1;
+      break;
+  }
+}
+
+static void sl_ir_opt_count_instrs(struct ir_body *body, size_t *pnum_instrs) {
+  struct ir_block *blk = body->blocks_;
+  size_t num_instrs = 0;
+  if (blk) {
+    do {
+      struct ir_instr *instr = blk->instructions_;
+      if (instr) {
+        do {
+          num_instrs++;
+          instr = instr->next_in_block_;
+        } while (instr != blk->instructions_);
+      }
+      blk = blk->next_in_body_;
+    } while (blk != body->blocks_);
+  }
+  *pnum_instrs = num_instrs;
+}
+
+/* Copies the instructions of blk to opt->instrs_, so the passes can modify the block as they go. */
+static int sl_ir_opt_collect_instrs(struct sl_ir_opt *opt, struct ir_block *blk) {
+  struct ir_instr *instr = blk->instructions_;
+  opt->num_instrs_ = 0;
+  if (!instr) return 0;
+  do {
+    if (opt->num_instrs_ == opt->num_instrs_allocated_) {
+      size_t new_num_allocated = opt->num_instrs_allocated_ * 2 + 64;
+      struct ir_instr **new_instrs = (struct ir_instr **)realloc(opt->instrs_, sizeof(struct ir_instr *) * new_num_allocated);
+      if (!new_instrs) return -1;
+      opt->instrs_ = new_instrs;
+      opt->num_instrs_allocated_ = new_num_allocated;
+    }
+    opt->instrs_[opt->num_instrs_++] = instr;
+    instr = instr->next_in_block_;
+  } while (instr != blk->instructions_);
+  return 0;
+}
+
+/* Finds the number of registers referenced in each bank */
+static void sl_ir_opt_size_banks(struct sl_ir_opt *opt) {
+  struct ir_block *blk = opt->body_->blocks_;
+  struct sl_ir_opt_effects fx;
+  size_t n;
+  int bank;
+  for (bank = 0; bank < SL_IR_OPT_NUM_BANKS; ++bank) {
+    opt->bank_size_[bank] = 0;
+  }
+  if (!blk) return;
+  do {
+    struct ir_instr *instr = blk->instructions_;
+    if (instr) {
+      do {
+        sl_ir_opt_get_effects(&fx, instr);
+        for (n = 0; n < fx.num_reads_; ++n) {
+          if (fx.reads_[n].reg_ >= opt->bank_size_[fx.reads_[n].bank_]) opt->bank_size_[fx.reads_[n].bank_] = fx.reads_[n].reg_ + 1;
+        }
+        for (n = 0; n < fx.num_writes_; ++n) {
+          if (fx.writes_[n].reg_ >= opt->bank_size_[fx.writes_[n].bank_]) opt->bank_size_[fx.writes_[n].bank_] = fx.writes_[n].reg_ + 1;
+        }
+        instr = instr->next_in_block_;
+      } while (instr != blk->instructions_);
+    }
+    blk = blk->next_in_body_;
+  } while (blk != opt->body_->blocks_);
+}
+
+/* Returns the fact for a register, or NULL if it is outside the registers we track */
+static struct sl_ir_opt_fact *sl_ir_opt_fact(struct sl_ir_opt *opt, int bank, int reg) {
+  if ((bank < 0) || (reg < 0) || (reg >= opt->bank_size_[bank])) return NULL;
+  return opt->facts_[bank] + reg;
+}
+
+/* Forgets everything, except for the values of the constant registers, which nothing overwrites */
+static void sl_ir_opt_forget_all(struct sl_ir_opt *opt) {
+  int bank, reg;
+  size_t n;
+  for (bank = 0; bank < SL_IR_OPT_NUM_BANKS; ++bank) {
+    for (reg = 0; reg < opt->bank_size_[bank]; ++reg) {
+      opt->facts_[bank][reg].const_chain_ = -1;
+      opt->facts_[bank][reg].copy_chain_ = -1;
+    }
+    opt->num_copies_[bank] = 0;
+  }
+  opt->num_exprs_ = 0;
+  if (!(opt->passes_ & SL_IR_OPT_CONST_PROP)) return;
+  for (n = 0; n < opt->num_constants_; ++n) {
+    const struct sl_ir_opt_constant *c = opt->constants_ + n;
+    struct sl_ir_opt_fact *fact = sl_ir_opt_fact(opt, c->bank_, c->reg_);
+    if (!fact || (c->bank_ > SL_IR_OPT_BOOL)) continue;
+    fact->const_chain_ = SL_IR_OPT_ALL_CHAINS;
+    fact->value_.f_ = (c->bank_ == SL_IR_OPT_FLOAT) ? c->f_ : 0.f;
+    fact->value_.i_ = (c->bank_ == SL_IR_OPT_INT) ? sl_ir_opt_int((uint64_t)c->i_) : ((c->bank_ == SL_IR_OPT_BOOL) ? (uint8_t)c->i_ : 0);
+  }
+}
+
+static void sl_ir_opt_remove_expr(struct sl_ir_opt *opt, size_t index) {
+  opt->exprs_[index] = opt->exprs_[--opt->num_exprs_];
+}
+
+/* Forgets what is known about the rows of chain, as the chain is redefined */
+static void sl_ir_opt_forget_chain(struct sl_ir_opt *opt, int chain) {
+  int bank, reg;
+  size_t n;
+  for (bank = 0; bank < SL_IR_OPT_NUM_BANKS; ++bank) {
+    for (reg = 0; reg < opt->bank_size_[bank]; ++reg) {
+      struct sl_ir_opt_fact *fact = opt->facts_[bank] + reg;
+      if (fact->const_chain_ == chain) fact->const_chain_ = -1;
+      if (fact->copy_chain_ == chain) {
+        fact->copy_chain_ = -1;
+        opt->num_copies_[bank]--;
+      }
+    }
+  }
+  for (n = 0; n < opt->num_exprs_; ) {
+    if (opt->exprs_[n].chain_ == chain) sl_ir_opt_remove_expr(opt, n);
+    else n++;
+  }
+}
+
+/* Forgets what is known about registers from_reg .. to_reg (inclusive) of bank, as they are written */
+static void sl_ir_opt_forget_regs(struct sl_ir_opt *opt, int bank, int from_reg, int to_reg) {
+  int reg;
+  size_t n, k;
+  if (to_reg >= opt->bank_size_[bank]) to_reg = opt->bank_size_[bank] - 1;
+  for (reg = from_reg; reg <= to_reg; ++reg) {
+    struct sl_ir_opt_fact *fact = opt->facts_[bank] + reg;
+    fact->const_chain_ = -1;
+    if (fact->copy_chain_ >= 0) {
+      fact->copy_chain_ = -1;
+      opt->num_copies_[bank]--;
+    }
+  }
+  if (opt->num_copies_[bank]) {
+    /* Copies of the registers written no longer hold the same value */
+    for (reg = 0; reg < opt->bank_size_[bank]; ++reg) {
+      struct sl_ir_opt_fact *fact = opt->facts_[bank] + reg;
+      if ((fact->copy_chain_ >= 0) && (fact->copy_of_ >= from_reg) && (fact->copy_of_ <= to_reg)) {
+        fact->copy_chain_ = -1;
+        opt->num_copies_[bank]--;
+      }
+    }
+  }
+  for (n = 0; n < opt->num_exprs_; ) {
+    struct sl_ir_opt_expr *x = opt->exprs_ + n;
+    int hit = (x->dst_bank_ == bank) && (x->dst_reg_ >= from_reg) && (x->dst_reg_ <= to_reg);
+    for (k = 0; !hit && (k < x->num_operands_); ++k) {
+      hit = ((x->operands_[k].kind_ - IR_FLOAT_BANK) == bank) && (x->operands_[k].value_ >= from_reg) && (x->operands_[k].value_ <= to_reg);
+    }
+    if (hit) sl_ir_opt_remove_expr(opt, n);
+    else n++;
+  }
+}
+
+/* Forgets whatever the instruction invalidates */
+static void sl_ir_opt_forget(struct sl_ir_opt *opt, const struct sl_ir_opt_effects *fx) {
+  size_t n;
+  int bank;
+  if (fx->barrier_ || fx->restructures_chains_) {
+    sl_ir_opt_forget_all(opt);
+    return;
+  }
+  if (fx->chain_def_ >= 0) sl_ir_opt_forget_chain(opt, fx->chain_def_);
+  for (n = 0; n < fx->num_writes_; ++n) {
+    sl_ir_opt_forget_regs(opt, fx->writes_[n].bank_, fx->writes_[n].reg_, fx->writes_[n].reg_);
+  }
+  for (bank = 0; bank < SL_IR_OPT_NUM_BANKS; ++bank) {
+    if (fx->unknown_write_from_[bank] != INT_MAX) {
+      sl_ir_opt_forget_regs(opt, bank, fx->unknown_write_from_[bank], INT_MAX - 1);
+    }
+  }
+}
+
+/* Returns non-zero if the literal value of an SLIR_INIT_LIT_XXX is known, and stores it in *v */
+static int sl_ir_opt_init_lit_value(struct ir_instr *instr, struct sl_ir_opt_value *v) {
+  struct ir_temp *lit;
+  if (instr->num_args_ != 3) return 0;
+  lit = instr->args_[2]->temp_;
+  if (!lit) return 0;
+  switch (instr->instruction_code_) {
+    case SLIR_INIT_LIT_F:
+      if (lit->kind_ != IR_LITERAL_FLOAT) return 0;
+      v->f_ = lit->lit_.f_;
+      v->i_ = 0;
+      return 1;
+    case SLIR_INIT_LIT_I:
+      if (lit->kind_ != IR_LITERAL_INT) return 0;
+      v->f_ = 0.f;
+      v->i_ = sl_ir_opt_int((uint64_t)lit->lit_.i64_);
+      return 1;
+    case SLIR_INIT_LIT_B:
+      if (lit->kind_ != IR_LITERAL_BOOL) return 0;
+      v->f_ = 0.f;
+      v->i_ = (uint8_t)lit->lit_.b_;
+      return 1;
+  }
+  return 0;
+}
+
+static int sl_ir_opt_values_equal(int bank, const struct sl_ir_opt_value *a, const struct sl_ir_opt_value *b) {
+  if (bank == SL_IR_OPT_FLOAT) return !memcmp(&a->f_, &b->f_, sizeof(float));
+  return a->i_ == b->i_;
+}
+
+/* Returns non-zero if fact has the register hold value_ on the rows of chain */
+static int sl_ir_opt_holds_const(const struct sl_ir_opt_fact *fact, int chain) {
+  return (fact->const_chain_ == chain) || (fact->const_chain_ == SL_IR_OPT_ALL_CHAINS);
+}
+
+/* Returns non-zero if the register operand arg holds a known value on the rows of chain, and stores it in *v */
+static int sl_ir_opt_const_operand(struct sl_ir_opt *opt, int chain, struct ir_arg *arg, struct sl_ir_opt_value *v) {
+  struct ir_temp *temp = arg->temp_;
+  struct sl_ir_opt_fact *fact = sl_ir_opt_fact(opt, sl_ir_opt_bank(temp), temp ? temp->temp_value_ : -1);
+  if (!fact || !sl_ir_opt_holds_const(fact, chain)) return 0;
+  *v = fact->value_;
+  return 1;
+}
+
+/* Returns non-zero if args first .. first + num - 1 of instr all hold known values, which are stored in v */
+static int sl_ir_opt_const_operands(struct sl_ir_opt *opt, int chain, struct ir_instr *instr, size_t first, size_t num, struct sl_ir_opt_value *v) {
+  size_t n;
+  if ((first + num) > instr->num_args_) return 0;
+  for (n = 0; n < num; ++n) {
+    if (!sl_ir_opt_const_operand(opt, chain, instr->args_[first + n], v + n)) return 0;
+  }
+  return 1;
+}
+
+/* Replaces instr with an SLIR_INIT_LIT_XXX of v into register dst of bank, returns the new instruction. */
+static struct ir_instr *sl_ir_opt_replace_with_init_lit(struct sl_ir_opt *opt, struct ir_instr *instr, int bank, int dst, const struct sl_ir_opt_value *v) {
+  struct ir_body *body = opt->body_;
+  struct ir_instr *lit_instr;
+  struct ir_temp *lit;
+  switch (bank) {
+    case SL_IR_OPT_FLOAT:
+      lit_instr = ir_block_insert_instr_before(instr, SLIR_INIT_LIT_F);
+      lit = ir_body_alloc_temp_litf(body, v->f_);
+      break;
+    case SL_IR_OPT_INT:
+      lit_instr = ir_block_insert_instr_before(instr, SLIR_INIT_LIT_I);
+      lit = ir_body_alloc_temp_liti(body, v->i_);
+      break;
+    case SL_IR_OPT_BOOL:
+      lit_instr = ir_block_insert_instr_before(instr, SLIR_INIT_LIT_B);
+      lit = ir_body_alloc_temp_litb(body, (int)v->i_);
+      break;
+    default:
+      return NULL;
+  }
+  if (!lit_instr || !lit) return NULL;
+  ir_instr_append_use(lit_instr, instr->args_[0]->temp_);
+  ir_instr_append_def(lit_instr, sl_ir_opt_bank_temp(body, bank, dst));
+  ir_instr_append_use(lit_instr, lit);
+  ir_block_remove_instr(instr);
+  return lit_instr;
+}
+
+/* Replaces instr with a move from register src to register dst of bank, returns the new instruction. */
+static struct ir_instr *sl_ir_opt_replace_with_move(struct sl_ir_opt *opt, struct ir_instr *instr, int bank, int dst, int src) {
+  struct ir_body *body = opt->body_;
+  struct ir_instr *move = ir_block_insert_instr_before(instr, sl_ir_opt_move_code(bank));
+  if (!move) return NULL;
+  ir_instr_append_use(move, instr->args_[0]->temp_);
+  ir_instr_append_def(move, sl_ir_opt_bank_temp(body, bank, dst));
+  ir_instr_append_use(move, sl_ir_opt_bank_temp(body, bank, src));
+  ir_block_remove_instr(instr);
+  return move;
+}
+
+/* Constant folding; if all operands of instr hold known values, instr is replaced with an initialization of
+ * its result and the new instruction is returned, otherwise returns NULL. Mirrors the kernels in
+ * sl_bytecode_exec_kernel(), comparisons are left alone as their kernels produce 0 or 0xFF for a bool
+ * while the conversions produce 0 or 1. */
+static struct ir_instr *sl_ir_opt_fold(struct sl_ir_opt *opt, struct ir_instr *instr, const struct sl_ir_opt_effects *fx) {
+  struct sl_ir_opt_value v[2], r;
+  int code = instr->instruction_code_;
+  int chain = fx->chain_;
+  int bank = SL_IR_OPT_FLOAT;
+  int from_bank, to_bank, from_mode, to_mode;
+  if ((fx->num_writes_ != 1) || (fx->writes_[0].arg_ != instr->args_[1])) return NULL;
+  r.f_ = 0.f;
+  r.i_ = 0;
+  switch (code) {
+    case SLIR_NEG_F:
+      if (!sl_ir_opt_const_operands(opt, chain, instr, 2, 1, v)) return NULL;
+      r.f_ = -v[0].f_;
+      break;
+    case SLIR_NEG_I:
+      if (!sl_ir_opt_const_operands(opt, chain, instr, 2, 1, v)) return NULL;
+      r.i_ = sl_ir_opt_int(0 - (uint64_t)v[0].i_);
+      bank = SL_IR_OPT_INT;
+      break;
+    case SLIR_NOT:
+      if (!sl_ir_opt_const_operands(opt, chain, instr, 2, 1, v)) return NULL;
+      r.i_ = !v[0].i_;
+      bank = SL_IR_OPT_BOOL;
+      break;
+    case SLIR_MUL_F:
+      if (!sl_ir_opt_const_operands(opt, chain, instr, 2, 2, v)) return NULL;
+      r.f_ = v[0].f_ * v[1].f_;
+      break;
+    case SLIR_MUL_I:
+      if (!sl_ir_opt_const_operands(opt, chain, instr, 2, 2, v)) return NULL;
+      r.i_ = sl_ir_opt_int((uint64_t)v[0].i_ * (uint64_t)v[1].i_);
+      bank = SL_IR_OPT_INT;
+      break;
+    case SLIR_DIV_F:
+      if (!sl_ir_opt_const_operands(opt, chain, instr, 2, 2, v)) return NULL;
+      r.f_ = v[0].f_ / v[1].f_;
+      break;
+    case SLIR_DIV_I:
+      /* Leave division by zero, and the overflowing division by -1, for the runtime to do as it does */
+      if (!sl_ir_opt_const_operands(opt, chain, instr, 2, 2, v)) return NULL;
+      if ((v[1].i_ == 0) || (v[1].i_ == -1)) return NULL;
+      r.i_ = v[0].i_ / v[1].i_;
+      bank = SL_IR_OPT_INT;
+      break;
+    case SLIR_ADD_F:
+      if (!sl_ir_opt_const_operands(opt, chain, instr, 2, 2, v)) return NULL;
+      r.f_ = v[0].f_ + v[1].f_;
+      break;
+    case SLIR_ADD_I:
+      if (!sl_ir_opt_const_operands(opt, chain, instr, 2, 2, v)) return NULL;
+      r.i_ = sl_ir_opt_int((uint64_t)v[0].i_ + (uint64_t)v[1].i_);
+      bank = SL_IR_OPT_INT;
+      break;
+    case SLIR_SUB_F:
+      if (!sl_ir_opt_const_operands(opt, chain, instr, 2, 2, v)) return NULL;
+      r.f_ = v[0].f_ - v[1].f_;
+      break;
+    case SLIR_SUB_I:
+      if (!sl_ir_opt_const_operands(opt, chain, instr, 2, 2, v)) return NULL;
+      r.i_ = sl_ir_opt_int((uint64_t)v[0].i_ - (uint64_t)v[1].i_);
+      bank = SL_IR_OPT_INT;
+      break;
+    case SLIR_DEC_F:
+      if (!sl_ir_opt_const_operands(opt, chain, instr, 2, 1, v)) return NULL;
+      r.f_ = v[0].f_ - 1.f;
+      break;
+    case SLIR_DEC_I:
+      if (!sl_ir_opt_const_operands(opt, chain, instr, 2, 1, v)) return NULL;
+      r.i_ = sl_ir_opt_int((uint64_t)v[0].i_ - 1);
+      bank = SL_IR_OPT_INT;
+      break;
+    case SLIR_INC_F:
+      if (!sl_ir_opt_const_operands(opt, chain, instr, 2, 1, v)) return NULL;
+      r.f_ = v[0].f_ + 1.f;
+      break;
+    case SLIR_INC_I:
+      if (!sl_ir_opt_const_operands(opt, chain, instr, 2, 1, v)) return NULL;
+      r.i_ = sl_ir_opt_int((uint64_t)v[0].i_ + 1);
+      bank = SL_IR_OPT_INT;
+      break;
+    case SLIR_MUL_C_AND_ADD: {
+      /* [chain, dst, src_base, multiplier, offset] */
+      struct ir_temp *multiplier;
+      if (instr->num_args_ != 5) return NULL;
+      multiplier = instr->args_[3]->temp_;
+      if (!multiplier || (multiplier->kind_ != IR_LITERAL_INT)) return NULL;
+      if (!sl_ir_opt_const_operand(opt, chain, instr->args_[2], v + 0)) return NULL;
+      if (!sl_ir_opt_const_operand(opt, chain, instr->args_[4], v + 1)) return NULL;
+      r.i_ = sl_ir_opt_int((uint64_t)v[0].i_ * (uint64_t)sl_ir_opt_int((uint64_t)multiplier->lit_.i64_) + (uint64_t)v[1].i_);
+      bank = SL_IR_OPT_INT;
+      break;
+    }
+    case SLIR_PICK_FROM_2:
+    case SLIR_PICK_FROM_3:
+    case SLIR_PICK_FROM_4: {
+      /* [chain, dst, index, literal choices..] */
+      size_t num_choices = (size_t)(2 + code - SLIR_PICK_FROM_2);
+      struct ir_temp *choice;
+      if (instr->num_args_ != (3 + num_choices)) return NULL;
+      if (!sl_ir_opt_const_operand(opt, chain, instr->args_[2], v)) return NULL;
+      if ((v[0].i_ < 0) || (v[0].i_ >= (int64_t)num_choices)) return NULL;
+      choice = instr->args_[3 + v[0].i_]->temp_;
+      if (!choice || (choice->kind_ != IR_LITERAL_INT)) return NULL;
+      r.i_ = sl_ir_opt_int((uint64_t)choice->lit_.i64_);
+      bank = SL_IR_OPT_INT;
+      break;
+    }
+    case SLIR_PICK_FROM_2_INDIRECT:
+    case SLIR_PICK_FROM_3_INDIRECT:
+    case SLIR_PICK_FROM_4_INDIRECT: {
+      /* [chain, dst, index, choice registers..]; with a known index, this is a move from the choice */
+      size_t num_choices = (size_t)(2 + code - SLIR_PICK_FROM_2_INDIRECT);
+      struct ir_arg *choice;
+      if (instr->num_args_ != (3 + num_choices)) return NULL;
+      if (!sl_ir_opt_const_operand(opt, chain, instr->args_[2], v)) return NULL;
+      if ((v[0].i_ < 0) || (v[0].i_ >= (int64_t)num_choices)) return NULL;
+      choice = instr->args_[3 + v[0].i_];
+      bank = SL_IR_OPT_INT;
+      if (sl_ir_opt_bank(choice->temp_) != bank) return NULL;
+      if (!sl_ir_opt_const_operand(opt, chain, choice, &r)) {
+        return sl_ir_opt_replace_with_move(opt, instr, bank, fx->writes_[0].reg_, choice->temp_->temp_value_);
+      }
+      break;
+    }
+    default:
+      if (!sl_ir_opt_decode_move(code, &from_bank, &to_bank, &from_mode, &to_mode)) return NULL;
+      if (from_mode || to_mode || (from_bank > SL_IR_OPT_BOOL)) return NULL;
+      if (!sl_ir_opt_const_operands(opt, chain, instr, 2, 1, v)) return NULL;
+      bank = to_bank;
+      switch (from_bank * 3 + to_bank) {
+        case 0: /* F */
+          r.f_ = v[0].f_;
+          break;
+        case 1: { /* F2I, the conversion is undefined outside the range of the int */
+          double limit = (double)((uint64_t)1 << (SL_EXEC_INT_REG_BITS - 1));
+          if (!(((double)v[0].f_ > -limit) && ((double)v[0].f_ < limit))) return NULL;
+          r.i_ = (int64_t)(sl_exec_int_t)v[0].f_;
+          break;
+        }
+        case 2: /* F2B */
+          r.i_ = (uint8_t)(v[0].f_ != 0.f);
+          break;
+        case 3: /* I2F */
+          r.f_ = (float)(sl_exec_int_t)v[0].i_;
+          break;
+        case 4: /* I */
+          r.i_ = v[0].i_;
+          break;
+        case 5: /* I2B */
+          r.i_ = (uint8_t)(!!v[0].i_);
+          break;
+        case 6: /* B2F */
+          r.f_ = (float)(!!v[0].i_);
+          break;
+        case 7: /* B2I */
+          r.i_ = !!v[0].i_;
+          break;
+        case 8: /* B, a literal bool is 0 or 1, leave the 0xFF of a comparison (see sl_ir_opt_compare()) */
+          if ((uint64_t)v[0].i_ > 1) return NULL;
+          r.i_ = v[0].i_;
+          break;
+      }
+      break;
+  }
+  return sl_ir_opt_replace_with_init_lit(opt, instr, bank, fx->writes_[0].reg_, &r);
+}
+
+/* Returns non-zero if instr is a comparison whose operands hold known values on the rows of chain, and stores
+ * its result in *v as the kernel produces it (0 or 0xFF.) Comparisons are not folded (see sl_ir_opt_fold()),
+ * but their result may still fold the instructions reading it, e.g. a uniform condition. */
+static int sl_ir_opt_compare(struct sl_ir_opt *opt, struct ir_instr *instr, int chain, struct sl_ir_opt_value *v) {
+  struct sl_ir_opt_value a[2];
+  int is_true;
+  int code = instr->instruction_code_;
+  if ((code < SLIR_LT_F) || (code > SLIR_NE_I)) return 0;
+  if (!sl_ir_opt_const_operands(opt, chain, instr, 2, 2, a)) return 0;
+  switch (code) {
+    case SLIR_LT_F: is_true = a[0].f_ < a[1].f_; break;
+    case SLIR_LT_I: is_true = a[0].i_ < a[1].i_; break;
+    case SLIR_LE_F: is_true = a[0].f_ <= a[1].f_; break;
+    case SLIR_LE_I: is_true = a[0].i_ <= a[1].i_; break;
+    case SLIR_GE_F: is_true = a[0].f_ >= a[1].f_; break;
+    case SLIR_GE_I: is_true = a[0].i_ >= a[1].i_; break;
+    case SLIR_GT_F: is_true = a[0].f_ > a[1].f_; break;
+    case SLIR_GT_I: is_true = a[0].i_ > a[1].i_; break;
+    case SLIR_EQ_F: is_true = a[0].f_ == a[1].f_; break;
+    case SLIR_EQ_I: is_true = a[0].i_ == a[1].i_; break;
+    case SLIR_NE_F: is_true = a[0].f_ != a[1].f_; break;
+    case SLIR_NE_I: is_true = a[0].i_ != a[1].i_; break;
+    default: return 0;
+  }
+  v->f_ = 0.f;
+  v->i_ = is_true ? 0xFF : 0;
+  return 1;
+}
+
+/* If the condition of a chain split (SLIR_SPLIT_EXEC_CHAIN_BY_XXX) is known on the rows of its input chain, as
+ * it is for a condition on a specialized uniform, replaces the split with a move of the input chain to the chain
+ * of the branch taken, and clears the other, so the branch not taken is skipped without reading the condition.
+ * Returns non-zero if replaced, or -1 upon allocation failure. */
+static int sl_ir_opt_fold_split(struct sl_ir_opt *opt, struct ir_instr *instr) {
+  struct sl_ir_opt_value v;
+  struct ir_instr *move, *clear;
+  struct ir_temp *taken, *not_taken;
+  int in_chain;
+  if ((instr->instruction_code_ != SLIR_SPLIT_EXEC_CHAIN_BY_CONDITION) &&
+      (instr->instruction_code_ != SLIR_SPLIT_EXEC_CHAIN_BY_UNIFORM_CONDITION)) return 0;
+  if (instr->num_args_ != 4) return 0;
+  in_chain = sl_ir_opt_chain(instr->args_[3]->temp_);
+  if ((in_chain < 0) || !sl_ir_opt_const_operand(opt, in_chain, instr->args_[2], &v)) return 0;
+  taken = instr->args_[v.i_ ? 0 : 1]->temp_;
+  not_taken = instr->args_[v.i_ ? 1 : 0]->temp_;
+  /* Move before clearing, the input chain may be the one cleared */
+  move = ir_block_insert_instr_before(instr, GIR_MOVE);
+  if (!move) return -1;
+  ir_instr_append_def(move, taken);
+  ir_instr_append_use(move, instr->args_[3]->temp_);
+  clear = ir_block_insert_instr_before(instr, GIR_MOVE);
+  if (!clear) return -1;
+  ir_instr_append_def(clear, not_taken);
+  ir_instr_append_use(clear, ir_body_alloc_temp_liti(opt->body_, SL_EXEC_NO_CHAIN));
+  ir_block_remove_instr(instr);
+  return opt->body_->alloc_error_ ? -1 : 1;
+}
+
+/* Returns non-zero if instr stores what its destination register already holds on the rows of its chain */
+static int sl_ir_opt_is_redundant(struct sl_ir_opt *opt, struct ir_instr *instr, const struct sl_ir_opt_effects *fx) {
+  int code = instr->instruction_code_;
+  int from_bank, to_bank, from_mode, to_mode;
+  struct sl_ir_opt_fact *dst_fact;
+  struct sl_ir_opt_value v;
+  if ((fx->chain_ < 0) || fx->barrier_ || (fx->num_writes_ != 1) || (fx->num_reads_ > 1)) return 0;
+  dst_fact = sl_ir_opt_fact(opt, fx->writes_[0].bank_, fx->writes_[0].reg_);
+  if (!dst_fact) return 0;
+
+  if ((opt->passes_ & SL_IR_OPT_CONST_PROP) && sl_ir_opt_init_lit_value(instr, &v)) {
+    return (dst_fact->const_chain_ == fx->chain_) && sl_ir_opt_values_equal(fx->writes_[0].bank_, &dst_fact->value_, &v);
+  }
+
+  if (sl_ir_opt_decode_move(code, &from_bank, &to_bank, &from_mode, &to_mode) && !from_mode && !to_mode && (from_bank == to_bank) &&
+      (fx->num_reads_ == 1)) {
+    struct sl_ir_opt_fact *src_fact;
+    int src = fx->reads_[0].reg_;
+    if (src == fx->writes_[0].reg_) return 1;
+    if ((opt->passes_ & SL_IR_OPT_COPY_PROP) && (dst_fact->copy_chain_ == fx->chain_) && (dst_fact->copy_of_ == src)) return 1;
+    src_fact = sl_ir_opt_fact(opt, from_bank, src);
+    if ((opt->passes_ & SL_IR_OPT_CONST_PROP) && src_fact && sl_ir_opt_holds_const(src_fact, fx->chain_) && (dst_fact->const_chain_ == fx->chain_) &&
+        sl_ir_opt_values_equal(to_bank, &dst_fact->value_, &src_fact->value_)) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/* Returns non-zero if the result of instr is fully determined by its instruction code and operands, so it
+ * may be subject to CSE; these all write a single register, their first operand after the chain. */
+static int sl_ir_opt_is_cse_candidate(int code) {
+  int from_bank, to_bank, from_mode, to_mode;
+  if ((code >= SLIR_NEG_F) && (code <= SLIR_INC_I)) return 1;
+  if (code == SLIR_MUL_C_AND_ADD) return 1;
+  if ((code >= SLIR_PICK_FROM_2) && (code <= SLIR_PICK_FROM_4_INDIRECT)) return 1;
+  if (sl_ir_opt_decode_move(code, &from_bank, &to_bank, &from_mode, &to_mode)) {
+    /* Conversions, plain moves are left to copy propagation */
+    return !from_mode && !to_mode && (from_bank <= SL_IR_OPT_BOOL) && (from_bank != to_bank);
+  }
+  return 0;
+}
+
+/* Describes the computation of instr as an expression, returns non-zero upon success. */
+static int sl_ir_opt_make_expr(struct ir_instr *instr, const struct sl_ir_opt_effects *fx, struct sl_ir_opt_expr *x) {
+  size_t n;
+  if (!sl_ir_opt_is_cse_candidate(instr->instruction_code_)) return 0;
+  if ((instr->num_args_ < 2) || ((instr->num_args_ - 2) > SL_IR_OPT_MAX_OPERANDS)) return 0;
+  if ((fx->num_writes_ != 1) || (fx->writes_[0].arg_ != instr->args_[1])) return 0;
+  x->instruction_code_ = instr->instruction_code_;
+  x->chain_ = fx->chain_;
+  x->dst_bank_ = fx->writes_[0].bank_;
+  x->dst_reg_ = fx->writes_[0].reg_;
+  x->num_operands_ = instr->num_args_ - 2;
+  for (n = 0; n < x->num_operands_; ++n) {
+    struct ir_temp *temp = instr->args_[2 + n]->temp_;
+    struct sl_ir_opt_operand *opd = x->operands_ + n;
+    opd->kind_ = temp->kind_;
+    switch (temp->kind_) {
+      case IR_LITERAL_FLOAT: {
+        uint32_t bits;
+        memcpy(&bits, &temp->lit_.f_, sizeof(bits));
+        opd->value_ = bits;
+        break;
+      }
+      case IR_LITERAL_BOOL:
+        opd->value_ = temp->lit_.b_;
+        break;
+      case IR_LITERAL_INT:
+      case IR_LITERAL_UINT:
+      case IR_LITERAL_DOUBLE:
+        opd->value_ = temp->lit_.i64_;
+        break;
+      default:
+        opd->value_ = temp->temp_value_;
+        break;
+    }
+  }
+  switch (x->instruction_code_) {
+    case SLIR_ADD_F:
+    case SLIR_ADD_I:
+    case SLIR_MUL_F:
+    case SLIR_MUL_I:
+      /* Commutative, normalize the order of the operands */
+      if ((x->operands_[0].kind_ > x->operands_[1].kind_) ||
+          ((x->operands_[0].kind_ == x->operands_[1].kind_) && (x->operands_[0].value_ > x->operands_[1].value_))) {
+        struct sl_ir_opt_operand tmp = x->operands_[0];
+        x->operands_[0] = x->operands_[1];
+        x->operands_[1] = tmp;
+      }
+      break;
+  }
+  return 1;
+}
+
+static int sl_ir_opt_exprs_equal(const struct sl_ir_opt_expr *a, const struct sl_ir_opt_expr *b) {
+  size_t n;
+  if ((a->instruction_code_ != b->instruction_code_) || (a->chain_ != b->chain_) || (a->num_operands_ != b->num_operands_)) return 0;
+  for (n = 0; n < a->num_operands_; ++n) {
+    if ((a->operands_[n].kind_ != b->operands_[n].kind_) || (a->operands_[n].value_ != b->operands_[n].value_)) return 0;
+  }
+  return 1;
+}
+
+/* Records what is known after instr */
+static int sl_ir_opt_learn(struct sl_ir_opt *opt, struct ir_instr *instr, const struct sl_ir_opt_effects *fx) {
+  int from_bank, to_bank, from_mode, to_mode;
+  struct sl_ir_opt_fact *dst_fact;
+  struct sl_ir_opt_expr x;
+  struct sl_ir_opt_value v;
+  size_t n;
+  if ((fx->chain_ < 0) || !fx->is_pure_ || fx->barrier_ || (fx->num_writes_ != 1)) return 0;
+  dst_fact = sl_ir_opt_fact(opt, fx->writes_[0].bank_, fx->writes_[0].reg_);
+  if (!dst_fact) return 0;
+
+  if (sl_ir_opt_init_lit_value(instr, &v)) {
+    if (opt->passes_ & SL_IR_OPT_CONST_PROP) {
+      dst_fact->const_chain_ = fx->chain_;
+      dst_fact->value_ = v;
+    }
+    return 0;
+  }
+
+  if (sl_ir_opt_decode_move(instr->instruction_code_, &from_bank, &to_bank, &from_mode, &to_mode) && !from_mode && !to_mode && (from_bank == to_bank) &&
+      (fx->num_reads_ == 1) && (fx->reads_[0].reg_ != fx->writes_[0].reg_)) {
+    struct sl_ir_opt_fact *src_fact = sl_ir_opt_fact(opt, from_bank, fx->reads_[0].reg_);
+    if (!src_fact) return 0;
+    if (opt->passes_ & SL_IR_OPT_COPY_PROP) {
+      dst_fact->copy_chain_ = fx->chain_;
+      dst_fact->copy_of_ = fx->reads_[0].reg_;
+      opt->num_copies_[to_bank]++;
+    }
+    if ((opt->passes_ & SL_IR_OPT_CONST_PROP) && sl_ir_opt_holds_const(src_fact, fx->chain_)) {
+      dst_fact->const_chain_ = fx->chain_;
+      dst_fact->value_ = src_fact->value_;
+    }
+    return 0;
+  }
+
+  if ((opt->passes_ & SL_IR_OPT_CONST_PROP) && sl_ir_opt_compare(opt, instr, fx->chain_, &v)) {
+    dst_fact->const_chain_ = fx->chain_;
+    dst_fact->value_ = v;
+  }
+
+  if ((opt->passes_ & SL_IR_OPT_CSE) && sl_ir_opt_make_expr(instr, fx, &x)) {
+    /* The expression no longer holds if the destination overwrote one of its operands */
+    for (n = 0; n < x.num_operands_; ++n) {
+      if (((x.operands_[n].kind_ - IR_FLOAT_BANK) == x.dst_bank_) && (x.operands_[n].value_ == x.dst_reg_)) return 0;
+    }
+    if (opt->num_exprs_ == opt->num_exprs_allocated_) {
+      size_t new_num_allocated = opt->num_exprs_allocated_ * 2 + 32;
+      struct sl_ir_opt_expr *new_exprs = (struct sl_ir_opt_expr *)realloc(opt->exprs_, sizeof(struct sl_ir_opt_expr) * new_num_allocated);
+      if (!new_exprs) return -1;
+      opt->exprs_ = new_exprs;
+      opt->num_exprs_allocated_ = new_num_allocated;
+    }
+    opt->exprs_[opt->num_exprs_++] = x;
+  }
+  return 0;
+}
+
+/* Rewrites the operands of the instruction that are copies of other registers on the rows of its chain to read the
+ * original instead, so the copy may become dead. */
+static void sl_ir_opt_propagate_copies(struct sl_ir_opt *opt, const struct sl_ir_opt_effects *fx) {
+  size_t n;
+  if (!fx->rows_local_ || fx->barrier_) return;
+  for (n = 0; n < fx->num_reads_; ++n) {
+    const struct sl_ir_opt_access *acc = fx->reads_ + n;
+    struct sl_ir_opt_fact *fact = sl_ir_opt_fact(opt, acc->bank_, acc->reg_);
+    struct ir_temp *src;
+    if (!acc->arg_ || (acc->arg_->usage_ != IR_USE) || !fact || (fact->copy_chain_ != fx->chain_)) continue;
+    src = sl_ir_opt_bank_temp(opt->body_, acc->bank_, fact->copy_of_);
+    if (!src) return;
+    ir_arg_set_temp(acc->arg_, src);
+    opt->stats_.num_copies_propagated_++;
+    opt->changed_ = 1;
+  }
+}
+
+/* Returns the register holding the same value as instr computes on the rows of its chain, or -1 */
+static int sl_ir_opt_find_expr(struct sl_ir_opt *opt, struct ir_instr *instr, const struct sl_ir_opt_effects *fx) {
+  struct sl_ir_opt_expr x;
+  size_t n;
+  if (!sl_ir_opt_make_expr(instr, fx, &x)) return -1;
+  for (n = 0; n < opt->num_exprs_; ++n) {
+    if (sl_ir_opt_exprs_equal(opt->exprs_ + n, &x)) return opt->exprs_[n].dst_reg_;
+  }
+  return -1;
+}
+
+/* Constant propagation, copy propagation and CSE over a single block; what is known is forgotten at the
+ * start of each block. */
+static int sl_ir_opt_forward_block(struct sl_ir_opt *opt, struct ir_block *blk) {
+  struct sl_ir_opt_effects fx;
+  size_t n;
+  if (sl_ir_opt_collect_instrs(opt, blk)) return -1;
+  sl_ir_opt_forget_all(opt);
+  for (n = 0; n < opt->num_instrs_; ++n) {
+    struct ir_instr *instr = opt->instrs_[n];
+
+    if (opt->passes_ & SL_IR_OPT_CONST_PROP) {
+      int folded = sl_ir_opt_fold_split(opt, instr);
+      if (folded < 0) return -1;
+      if (folded) {
+        /* The chains are redefined as by the split */
+        sl_ir_opt_forget_all(opt);
+        opt->stats_.num_folded_++;
+        opt->changed_ = 1;
+        continue;
+      }
+    }
+
+    sl_ir_opt_get_effects(&fx, instr);
+
+    if (opt->passes_ & SL_IR_OPT_COPY_PROP) {
+      sl_ir_opt_propagate_copies(opt, &fx);
+      sl_ir_opt_get_effects(&fx, instr);
+    }
+
+    if (sl_ir_opt_is_redundant(opt, instr, &fx)) {
+      ir_block_remove_instr(instr);
+      opt->stats_.num_cse_++;
+      opt->changed_ = 1;
+      continue;
+    }
+
+    if ((opt->passes_ & SL_IR_OPT_CONST_PROP) && (fx.chain_ >= 0) && !fx.barrier_) {
+      struct ir_instr *folded = sl_ir_opt_fold(opt, instr, &fx);
+      if (folded) {
+        instr = folded;
+        sl_ir_opt_get_effects(&fx, instr);
+        opt->stats_.num_folded_++;
+        opt->changed_ = 1;
+        if (sl_ir_opt_is_redundant(opt, instr, &fx)) {
+          ir_block_remove_instr(instr);
+          continue;
+        }
+      }
+      else if (opt->body_->alloc_error_) {
+        return -1;
+      }
+    }
+
+    if ((opt->passes_ & SL_IR_OPT_CSE) && (fx.chain_ >= 0) && !fx.barrier_) {
+      int held_in = sl_ir_opt_find_expr(opt, instr, &fx);
+      if ((held_in >= 0) && (held_in == fx.writes_[0].reg_)) {
+        ir_block_remove_instr(instr);
+        opt->stats_.num_cse_++;
+        opt->changed_ = 1;
+        continue;
+      }
+      if (held_in >= 0) {
+        instr = sl_ir_opt_replace_with_move(opt, instr, fx.writes_[0].bank_, fx.writes_[0].reg_, held_in);
+        if (!instr) return -1;
+        sl_ir_opt_get_effects(&fx, instr);
+        opt->stats_.num_cse_++;
+        opt->changed_ = 1;
+      }
+    }
+
+    sl_ir_opt_forget(opt, &fx);
+    if (sl_ir_opt_learn(opt, instr, &fx)) return -1;
+  }
+  return opt->body_->alloc_error_ ? -1 : 0;
+}
+
+static int sl_ir_opt_is_removable_write(struct sl_ir_opt *opt, const struct sl_ir_opt_access *acc) {
+  return (acc->reg_ >= opt->watermark_[acc->bank_]) && (acc->reg_ < opt->bank_size_[acc->bank_]) &&
+         (opt->states_[acc->bank_][acc->reg_] == SL_IR_OPT_DEAD);
+}
+
+static void sl_ir_opt_set_states(struct sl_ir_opt *opt, int bank, int from_reg, int state) {
+  int reg;
+  for (reg = from_reg; reg < opt->bank_size_[bank]; ++reg) {
+    opt->states_[bank][reg] = state;
+  }
+}
+
+/* Updates the register states (scanning backwards) for the instruction that precedes them */
+static void sl_ir_opt_liveness_step(struct sl_ir_opt *opt, const struct sl_ir_opt_effects *fx) {
+  size_t n;
+  int bank, reg;
+  if (fx->barrier_) {
+    for (bank = 0; bank < SL_IR_OPT_NUM_BANKS; ++bank) {
+      sl_ir_opt_set_states(opt, bank, 0, SL_IR_OPT_LIVE);
+    }
+    return;
+  }
+
+  /* A write on the rows of a chain kills the register if it is only read on the rows of that same chain */
+  for (n = 0; n < fx->num_writes_; ++n) {
+    int *state = opt->states_[fx->writes_[n].bank_] + fx->writes_[n].reg_;
+    if ((fx->chain_ >= 0) && (*state == fx->chain_)) *state = SL_IR_OPT_DEAD;
+  }
+
+  if (fx->restructures_chains_ || (fx->chain_def_ >= 0)) {
+    /* Rows of the chain(s) before this instruction are not the rows they are after. */
+    for (bank = 0; bank < SL_IR_OPT_NUM_BANKS; ++bank) {
+      for (reg = 0; reg < opt->bank_size_[bank]; ++reg) {
+        int *state = opt->states_[bank] + reg;
+        if ((*state >= 0) && (fx->restructures_chains_ || (*state == fx->chain_def_))) *state = SL_IR_OPT_LIVE;
+      }
+    }
+  }
+
+  for (n = 0; n < fx->num_reads_; ++n) {
+    int *state = opt->states_[fx->reads_[n].bank_] + fx->reads_[n].reg_;
+    if (!fx->rows_local_ || (fx->chain_ < 0)) *state = SL_IR_OPT_LIVE;
+    else if (*state == SL_IR_OPT_DEAD) *state = fx->chain_;
+    else if (*state != fx->chain_) *state = SL_IR_OPT_LIVE;
+  }
+  for (bank = 0; bank < SL_IR_OPT_NUM_BANKS; ++bank) {
+    if (fx->unknown_read_from_[bank] != INT_MAX) sl_ir_opt_set_states(opt, bank, fx->unknown_read_from_[bank], SL_IR_OPT_LIVE);
+  }
+}
+
+static void sl_ir_opt_load_states(struct sl_ir_opt *opt, const uint8_t *live) {
+  int bank, reg;
+  for (bank = 0; bank < SL_IR_OPT_NUM_BANKS; ++bank) {
+    for (reg = 0; reg < opt->bank_size_[bank]; ++reg) {
+      opt->states_[bank][reg] = (live && live[opt->bank_base_[bank] + reg]) ? SL_IR_OPT_LIVE : SL_IR_OPT_DEAD;
+    }
+  }
+}
+
+/* Finds the registers live on entry to and exit of each block (in live_in_ and live_out_.) Returns 0 upon
+ * success, 1 if the blocks are not numbered as expected (in which case nothing is known), or -1 upon
+ * allocation failure. */
+static int sl_ir_opt_liveness(struct sl_ir_opt *opt) {
+  struct ir_body *body = opt->body_;
+  struct ir_block *blk = body->blocks_;
+  struct sl_ir_opt_effects fx;
+  size_t n, k;
+  int bank, changed;
+  if (!blk) return 1;
+
+  opt->num_blocks_ = (size_t)blk->prev_in_body_->serial_num_;
+  do {
+    if ((blk->serial_num_ < 1) || ((size_t)blk->serial_num_ > opt->num_blocks_)) return 1;
+    blk = blk->next_in_body_;
+  } while (blk != body->blocks_);
+
+  opt->num_liveness_regs_ = 0;
+  for (bank = 0; bank < SL_IR_OPT_NUM_BANKS; ++bank) {
+    opt->bank_base_[bank] = (int)opt->num_liveness_regs_;
+    opt->num_liveness_regs_ += (size_t)opt->bank_size_[bank];
+  }
+  if (!opt->num_liveness_regs_) return 1;
+
+  if (opt->live_out_) free(opt->live_out_);
+  if (opt->live_in_) free(opt->live_in_);
+  opt->live_out_ = (uint8_t *)calloc(opt->num_blocks_, opt->num_liveness_regs_);
+  opt->live_in_ = (uint8_t *)calloc(opt->num_blocks_, opt->num_liveness_regs_);
+  if (!opt->live_out_ || !opt->live_in_) return -1;
+
+  /* Iterate until the registers live on entry of each block no longer change; each pass goes over the blocks
+   * in reverse to follow the direction in which liveness flows. */
+  do {
+    changed = 0;
+    blk = body->blocks_;
+    do {
+      uint8_t *live_out, *live_in;
+      struct ir_control_flow_edge *edge;
+      blk = blk->prev_in_body_;
+      live_out = opt->live_out_ + (blk->serial_num_ - 1) * opt->num_liveness_regs_;
+      live_in = opt->live_in_ + (blk->serial_num_ - 1) * opt->num_liveness_regs_;
+      edge = blk->successors_;
+      if (edge) {
+        do {
+          const uint8_t *succ_live_in = opt->live_in_ + (edge->to_->serial_num_ - 1) * opt->num_liveness_regs_;
+          for (k = 0; k < opt->num_liveness_regs_; ++k) {
+            live_out[k] |= succ_live_in[k];
+          }
+          edge = edge->next_in_from_;
+        } while (edge != blk->successors_);
+      }
+      sl_ir_opt_load_states(opt, live_out);
+      if (sl_ir_opt_collect_instrs(opt, blk)) return -1;
+      for (n = opt->num_instrs_; n > 0; --n) {
+        sl_ir_opt_get_effects(&fx, opt->instrs_[n - 1]);
+        sl_ir_opt_liveness_step(opt, &fx);
+      }
+      for (bank = 0; bank < SL_IR_OPT_NUM_BANKS; ++bank) {
+        int reg;
+        for (reg = 0; reg < opt->bank_size_[bank]; ++reg) {
+          uint8_t live = opt->states_[bank][reg] != SL_IR_OPT_DEAD;
+          if (live && !live_in[opt->bank_base_[bank] + reg]) {
+            live_in[opt->bank_base_[bank] + reg] = 1;
+            changed = 1;
+          }
+        }
+      }
+    } while (blk != body->blocks_);
+  } while (changed);
+
+  return 0;
+}
+
+/* Dead store elimination; removes, scanning each block backwards from the registers live on its exit, the
+ * pure kernels whose writes are not read by anything that follows. */
+static int sl_ir_opt_dse(struct sl_ir_opt *opt) {
+  struct ir_body *body = opt->body_;
+  struct ir_block *blk;
+  struct sl_ir_opt_effects fx;
+  size_t n, k;
+  int bank;
+  int r = sl_ir_opt_liveness(opt);
+  if (r) return (r < 0) ? r : 0;
+
+  blk = body->blocks_;
+  do {
+    sl_ir_opt_load_states(opt, opt->live_out_ + (blk->serial_num_ - 1) * opt->num_liveness_regs_);
+    if (sl_ir_opt_collect_instrs(opt, blk)) return -1;
+    for (n = opt->num_instrs_; n > 0; --n) {
+      struct ir_instr *instr = opt->instrs_[n - 1];
+      sl_ir_opt_get_effects(&fx, instr);
+      if (fx.is_pure_ && !fx.barrier_ && (fx.chain_ >= 0) && fx.num_writes_) {
+        int removable = 1;
+        for (bank = 0; removable && (bank < SL_IR_OPT_NUM_BANKS); ++bank) {
+          removable = fx.unknown_write_from_[bank] == INT_MAX;
+        }
+        for (k = 0; removable && (k < fx.num_writes_); ++k) {
+          removable = sl_ir_opt_is_removable_write(opt, fx.writes_ + k);
+        }
+        if (removable) {
+          ir_block_remove_instr(instr);
+          opt->stats_.num_dead_removed_++;
+          opt->changed_ = 1;
+          continue;
+        }
+      }
+      sl_ir_opt_liveness_step(opt, &fx);
+    }
+    blk = blk->next_in_body_;
+  } while (blk != body->blocks_);
+
+  return 0;
+}
+
+/* Returns non-zero if instr may take part in a superinstruction: a pure kernel that only accesses the float
+ * registers that are its operands, and writes only its first operand after the chain. */
+static int sl_ir_opt_is_fusable(const struct ir_instr *instr, const struct sl_ir_opt_effects *fx) {
+  size_t k;
+  if (!fx->is_pure_ || !fx->rows_local_ || fx->barrier_ || (fx->chain_ < 0) || (fx->num_writes_ != 1)) return 0;
+  if ((fx->unknown_read_from_[SL_IR_OPT_FLOAT] != INT_MAX) || (fx->unknown_write_from_[SL_IR_OPT_FLOAT] != INT_MAX)) return 0;
+  if ((instr->num_args_ < 3) || (instr->args_[1]->usage_ != IR_DEF)) return 0;
+  for (k = 1; k < instr->num_args_; ++k) {
+    if (sl_ir_opt_bank(instr->args_[k]->temp_) != SL_IR_OPT_FLOAT) return 0;
+    if ((k > 1) && (instr->args_[k]->usage_ != IR_USE)) return 0;
+  }
+  return 1;
+}
+
+static int sl_ir_opt_float_reg(const struct ir_instr *instr, size_t k) {
+  return (int)instr->args_[k]->temp_->temp_value_;
+}
+
+/* Finds, scanning back from the instruction at index consumer of opt->instrs_, the instruction that writes
+ * register reg of the float bank on chain. Returns its index, or consumer if there is none, or if reg is read
+ * in between, or if anything in between could change what the instruction computes, so it cannot be moved
+ * to the consumer. */
+static size_t sl_ir_opt_find_producer(struct sl_ir_opt *opt, size_t consumer, int chain, int reg) {
+  struct sl_ir_opt_effects fx;
+  size_t n, k, j;
+  for (n = consumer; (n > 0) && ((consumer - n) < SL_IR_OPT_FUSE_WINDOW); --n) {
+    struct ir_instr *instr = opt->instrs_[n - 1];
+    sl_ir_opt_get_effects(&fx, instr);
+    if (fx.barrier_ || fx.restructures_chains_ || (fx.chain_def_ == chain)) return consumer;
+    if (fx.unknown_write_from_[SL_IR_OPT_FLOAT] != INT_MAX) return consumer;
+    if (fx.unknown_read_from_[SL_IR_OPT_FLOAT] <= reg) return consumer;
+    for (k = 0; k < fx.num_writes_; ++k) {
+      if ((fx.writes_[k].bank_ == SL_IR_OPT_FLOAT) && (fx.writes_[k].reg_ == reg)) break;
+    }
+    if (k < fx.num_writes_) break;
+    for (k = 0; k < fx.num_reads_; ++k) {
+      if ((fx.reads_[k].bank_ == SL_IR_OPT_FLOAT) && (fx.reads_[k].reg_ == reg)) return consumer;
+    }
+  }
+  if (!n || ((consumer - n) >= SL_IR_OPT_FUSE_WINDOW)) return consumer;
+
+  /* The operands of the producer must still hold the same values at the consumer */
+  n--;
+  sl_ir_opt_get_effects(&fx, opt->instrs_[n]);
+  if (!sl_ir_opt_is_fusable(opt->instrs_[n], &fx) || (fx.chain_ != chain)) return consumer;
+  for (k = 0; k < fx.num_reads_; ++k) {
+    if (fx.reads_[k].reg_ == reg) return consumer;
+  }
+  for (j = n + 1; j < consumer; ++j) {
+    struct sl_ir_opt_effects between;
+    sl_ir_opt_get_effects(&between, opt->instrs_[j]);
+    for (k = 0; k < between.num_writes_; ++k) {
+      size_t m;
+      if (between.writes_[k].bank_ != SL_IR_OPT_FLOAT) continue;
+      for (m = 0; m < fx.num_reads_; ++m) {
+        if (fx.reads_[m].reg_ == between.writes_[k].reg_) return consumer;
+      }
+    }
+  }
+  return n;
+}
+
+/* Tries to fuse the instruction at index consumer of opt->instrs_ with the instruction that computes one of
+ * its operands, using the register states following the consumer. Upon success, the superinstruction takes
+ * the place of the consumer in the block and in opt->instrs_, the producer is removed from both, and 1 is
+ * returned. Returns 0 if there is nothing to fuse, or -1 upon allocation failure. */
+static int sl_ir_opt_fuse(struct sl_ir_opt *opt, size_t *pconsumer) {
+  struct sl_ir_opt_effects fx;
+  struct ir_instr *consumer = opt->instrs_[*pconsumer];
+  struct ir_instr *producer = NULL;
+  struct ir_instr *fused;
+  struct ir_temp *operands[12];
+  size_t num_operands = 0;
+  size_t pos, index = *pconsumer, k;
+  int code = -1, fusion = -1;
+  int ccode = consumer->instruction_code_;
+
+  sl_ir_opt_get_effects(&fx, consumer);
+  if (!sl_ir_opt_is_fusable(consumer, &fx)) return 0;
+  if ((ccode != SLIR_ADD_F) && (ccode != SLIR_MAX_F) && (ccode != SLIR_CLAMP_F) && (ccode != SLIR_MAD_F)) return 0;
+
+  /* The operand computed by the producer; the first operand for max() and clamp(), either term of
+   * an addition, either multiplicand of a multiply-add. */
+  for (pos = 2; pos < ((ccode == SLIR_MAX_F) || (ccode == SLIR_CLAMP_F) ? 3 : 4); ++pos) {
+    struct sl_ir_opt_access acc;
+    int reg = sl_ir_opt_float_reg(consumer, pos);
+    int pcode;
+    size_t num_reads = 0;
+    for (k = 2; k < consumer->num_args_; ++k) {
+      if (sl_ir_opt_float_reg(consumer, k) == reg) num_reads++;
+    }
+    if (num_reads != 1) continue;
+
+    /* Nothing may read the operand after the consumer, unless the consumer overwrites it */
+    acc.bank_ = SL_IR_OPT_FLOAT;
+    acc.reg_ = reg;
+    acc.arg_ = NULL;
+    if ((sl_ir_opt_float_reg(consumer, 1) != reg) && !sl_ir_opt_is_removable_write(opt, &acc)) continue;
+
+    index = sl_ir_opt_find_producer(opt, *pconsumer, fx.chain_, reg);
+    if (index == *pconsumer) continue;
+    producer = opt->instrs_[index];
+    pcode = producer->instruction_code_;
+
+    if ((ccode == SLIR_ADD_F) && (pcode == SLIR_MUL_F) && (producer->num_args_ == 4)) {
+      /* a * b + c */
+      code = SLIR_MAD_F;
+      fusion = SL_IR_OPT_FUSED_MAD;
+      operands[num_operands++] = producer->args_[2]->temp_;
+      operands[num_operands++] = producer->args_[3]->temp_;
+      operands[num_operands++] = consumer->args_[5 - pos]->temp_;
+    }
+    else if ((ccode == SLIR_MAD_F) && (pcode == SLIR_SUB_F) && (producer->num_args_ == 4) &&
+             (sl_ir_opt_float_reg(consumer, 4) == sl_ir_opt_float_reg(producer, 3))) {
+      /* (b - a) * t + a */
+      code = SLIR_LERP_F;
+      fusion = SL_IR_OPT_FUSED_LERP;
+      operands[num_operands++] = producer->args_[3]->temp_;
+      operands[num_operands++] = producer->args_[2]->temp_;
+      operands[num_operands++] = consumer->args_[5 - pos]->temp_;
+    }
+    else if (((ccode == SLIR_MAX_F) || (ccode == SLIR_CLAMP_F)) && (pcode >= SLIR_DOT2) && (pcode <= SLIR_DOT4) &&
+             (producer->num_args_ == (size_t)(2 + 2 * (2 + pcode - SLIR_DOT2)))) {
+      /* max(dot(a, b), lower) or clamp(dot(a, b), lower, upper) */
+      int dim_offset = pcode - SLIR_DOT2;
+      code = (ccode == SLIR_MAX_F) ? SLIR_DOT2_MAX_F + dim_offset : SLIR_DOT2_CLAMP_F + dim_offset;
+      fusion = (ccode == SLIR_MAX_F) ? SL_IR_OPT_FUSED_DOT_MAX : SL_IR_OPT_FUSED_DOT_CLAMP;
+      for (k = 2; k < producer->num_args_; ++k) {
+        operands[num_operands++] = producer->args_[k]->temp_;
+      }
+      for (k = 3; k < consumer->num_args_; ++k) {
+        operands[num_operands++] = consumer->args_[k]->temp_;
+      }
+    }
+    if (code >= 0) break;
+    producer = NULL;
+  }
+  if (!producer) return 0;
+
+  fused = ir_block_insert_instr_before(consumer, code);
+  if (!fused) return -1;
+  ir_instr_append_use(fused, consumer->args_[0]->temp_);
+  ir_instr_append_def(fused, consumer->args_[1]->temp_);
+  for (k = 0; k < num_operands; ++k) {
+    ir_instr_append_use(fused, operands[k]);
+  }
+  if (opt->body_->alloc_error_) return -1;
+  ir_block_remove_instr(producer);
+  ir_block_remove_instr(consumer);
+
+  /* The instructions from the consumer on have been scanned already and are left as they are */
+  memmove(opt->instrs_ + index, opt->instrs_ + index + 1, sizeof(struct ir_instr *) * (*pconsumer - index - 1));
+  *pconsumer = *pconsumer - 1;
+  opt->instrs_[*pconsumer] = fused;
+  opt->stats_.num_fused_[fusion]++;
+  opt->changed_ = 1;
+  return 1;
+}
+
+/* Superinstruction fusion; scans each block backwards, so the register states tell whether anything reads
+ * an operand after the instruction that reads it, and tries to fuse each instruction until it no longer
+ * fuses (a multiply-add may go on to become a linear interpolation.) */
+static int sl_ir_opt_fuse_superinstructions(struct sl_ir_opt *opt) {
+  struct ir_body *body = opt->body_;
+  struct ir_block *blk;
+  struct sl_ir_opt_effects fx;
+  size_t n;
+  int r = sl_ir_opt_liveness(opt);
+  if (r) return (r < 0) ? r : 0;
+
+  blk = body->blocks_;
+  do {
+    sl_ir_opt_load_states(opt, opt->live_out_ + (blk->serial_num_ - 1) * opt->num_liveness_regs_);
+    if (sl_ir_opt_collect_instrs(opt, blk)) return -1;
+    for (n = opt->num_instrs_; n > 0; --n) {
+      size_t consumer = n - 1;
+      do {
+        r = sl_ir_opt_fuse(opt, &consumer);
+        if (r < 0) return r;
+      } while (r);
+      n = consumer + 1;
+      sl_ir_opt_get_effects(&fx, opt->instrs_[consumer]);
+      sl_ir_opt_liveness_step(opt, &fx);
+    }
+    blk = blk->next_in_body_;
+  } while (blk != body->blocks_);
+
+  return 0;
+}
+
+/* Marks the registers of each bank that must keep their number: the globals, which are accessed from
+ * outside the shader, those accessed by builtins, and those that may be accessed through a register index
+ * computed at runtime. Returns non-zero if the effects of an instruction are not known, in which case
+ * all registers must keep their number. */
+static int sl_ir_opt_find_pinned(struct sl_ir_opt *opt, uint8_t **pinned) {
+  struct ir_block *blk = opt->body_->blocks_;
+  struct sl_ir_opt_effects fx;
+  size_t n;
+  int bank, reg;
+  for (bank = 0; bank < SL_IR_OPT_NUM_BANKS; ++bank) {
+    for (reg = 0; reg < opt->bank_size_[bank]; ++reg) {
+      pinned[bank][reg] = reg < opt->watermark_[bank];
+    }
+  }
+  do {
+    struct ir_instr *instr = blk->instructions_;
+    if (instr) {
+      do {
+        sl_ir_opt_get_effects(&fx, instr);
+        if (fx.barrier_) return -1;
+        for (n = 0; n < fx.num_reads_; ++n) {
+          if (!fx.reads_[n].arg_) pinned[fx.reads_[n].bank_][fx.reads_[n].reg_] = 1;
+        }
+        for (n = 0; n < fx.num_writes_; ++n) {
+          if (!fx.writes_[n].arg_) pinned[fx.writes_[n].bank_][fx.writes_[n].reg_] = 1;
+        }
+        for (bank = 0; bank < SL_IR_OPT_NUM_BANKS; ++bank) {
+          int from = fx.unknown_read_from_[bank] < fx.unknown_write_from_[bank] ? fx.unknown_read_from_[bank] : fx.unknown_write_from_[bank];
+          for (reg = from; reg < opt->bank_size_[bank]; ++reg) {
+            pinned[bank][reg] = 1;
+          }
+        }
+        instr = instr->next_in_block_;
+      } while (instr != blk->instructions_);
+    }
+    blk = blk->next_in_body_;
+  } while (blk != opt->body_->blocks_);
+  return 0;
+}
+
+/* Per bank state of the register allocator */
+struct sl_ir_opt_ra_bank {
+  /* Registers (of the bank) that may be renumbered, in order of first appearance; node_of_reg_ maps a
+   * register to its index in regs_, or -1 if it keeps its number. */
+  int num_nodes_;
+  int *regs_;
+  int *node_of_reg_;
+
+  /* num_nodes_ x num_nodes_ bit matrix, bit (a, b) is set if nodes a and b cannot share a register */
+  size_t row_words_;
+  uint32_t *interference_;
+
+  /* New register number for each node */
+  int *colors_;
+
+  /* For each node, a node it is copied from or to by a plain move, and that it should preferably share a
+   * register with so the move can go, or -1 */
+  int *move_hints_;
+};
+
+static void sl_ir_opt_ra_interfere(struct sl_ir_opt_ra_bank *rab, int a, int b) {
+  if (a == b) return;
+  rab->interference_[a * rab->row_words_ + (b >> 5)] |= 1u << (b & 31);
+  rab->interference_[b * rab->row_words_ + (a >> 5)] |= 1u << (a & 31);
+}
+
+/* Returns the bank of the plain register move (no conversion, no indirection) instr, or -1 if it is not one. */
+static int sl_ir_opt_plain_move_bank(const struct ir_instr *instr, const struct sl_ir_opt_effects *fx) {
+  int bank;
+  if (fx->barrier_ || (fx->num_writes_ != 1) || (fx->num_reads_ != 1) || (instr->num_args_ != 3)) return -1;
+  bank = fx->writes_[0].bank_;
+  if ((fx->reads_[0].bank_ != bank) || (instr->instruction_code_ != sl_ir_opt_move_code(bank))) return -1;
+  return bank;
+}
+
+/* Records the interference of the registers written by an instruction, with the registers live after
+ * the instruction (the current states_) and the other registers the instruction reads. The destination of
+ * a plain move does not interfere with its source, as both hold the same value afterwards, so they may
+ * share a register and the move becomes a no-op; unless rows outside the move's chain still read the old
+ * value of the destination. */
+static void sl_ir_opt_ra_instr(struct sl_ir_opt *opt, struct sl_ir_opt_ra_bank *rabs, const struct ir_instr *instr, const struct sl_ir_opt_effects *fx) {
+  size_t n, k;
+  int reg;
+  int move_bank = sl_ir_opt_plain_move_bank(instr, fx);
+  int move_src = -1;
+  if (move_bank >= 0) {
+    int dst_state = opt->states_[move_bank][fx->writes_[0].reg_];
+    if ((dst_state == SL_IR_OPT_DEAD) || (dst_state == fx->chain_)) {
+      struct sl_ir_opt_ra_bank *rab = rabs + move_bank;
+      int dst_node = rab->node_of_reg_[fx->writes_[0].reg_];
+      int src_node = rab->node_of_reg_[fx->reads_[0].reg_];
+      move_src = fx->reads_[0].reg_;
+      if ((dst_node >= 0) && (src_node >= 0)) {
+        if (rab->move_hints_[dst_node] < 0) rab->move_hints_[dst_node] = src_node;
+        if (rab->move_hints_[src_node] < 0) rab->move_hints_[src_node] = dst_node;
+      }
+    }
+  }
+  for (n = 0; n < fx->num_writes_; ++n) {
+    int bank = fx->writes_[n].bank_;
+    struct sl_ir_opt_ra_bank *rab = rabs + bank;
+    int node = rab->node_of_reg_[fx->writes_[n].reg_];
+    if (node < 0) continue;
+    for (reg = 0; reg < opt->bank_size_[bank]; ++reg) {
+      int other = rab->node_of_reg_[reg];
+      if ((bank == move_bank) && (reg == move_src)) continue;
+      if ((other >= 0) && (opt->states_[bank][reg] != SL_IR_OPT_DEAD)) sl_ir_opt_ra_interfere(rab, node, other);
+    }
+    for (k = 0; k < fx->num_reads_; ++k) {
+      if ((fx->reads_[k].bank_ != bank) || ((bank == move_bank) && (fx->reads_[k].reg_ == move_src))) continue;
+      reg = rab->node_of_reg_[fx->reads_[k].reg_];
+      if (reg >= 0) sl_ir_opt_ra_interfere(rab, node, reg);
+    }
+  }
+}
+
+/* Assigns each node of the bank the register of the node it is moved from or to (see move_hints_), or else
+ * the lowest register number, that is not pinned and not assigned to a node it interferes with. Returns the
+ * number of registers the bank then needs, or num_regs if renumbering would not reduce it (in which case the
+ * nodes keep their registers.) */
+static int sl_ir_opt_ra_color(struct sl_ir_opt *opt, int bank, struct sl_ir_opt_ra_bank *rab, const uint8_t *pinned, int num_regs) {
+  int node, other, color, num_colors;
+  int new_num_regs = opt->watermark_[bank];
+  uint8_t *taken;
+  for (color = 0; color < opt->bank_size_[bank]; ++color) {
+    if (pinned[color] && (color >= new_num_regs)) new_num_regs = color + 1;
+  }
+  if (!rab->num_nodes_) return (new_num_regs < num_regs) ? new_num_regs : num_regs;
+  /* Each node has fewer than num_nodes_ neighbours, so a color is always found within num_nodes_ past both
+   * the pinned registers and the watermark. */
+  num_colors = ((opt->bank_size_[bank] > opt->watermark_[bank]) ? opt->bank_size_[bank] : opt->watermark_[bank]) + rab->num_nodes_;
+  taken = (uint8_t *)malloc((size_t)num_colors);
+  if (!taken) return num_regs;
+  for (node = 0; node < rab->num_nodes_; ++node) {
+    const uint32_t *row = rab->interference_ + node * rab->row_words_;
+    memset(taken, 0, (size_t)num_colors);
+    memcpy(taken, pinned, (size_t)opt->bank_size_[bank]);
+    for (other = 0; other < node; ++other) {
+      if (row[other >> 5] & (1u << (other & 31))) taken[rab->colors_[other]] = 1;
+    }
+    other = rab->move_hints_[node];
+    if ((other >= 0) && (other < node) && !taken[rab->colors_[other]]) {
+      color = rab->colors_[other];
+    }
+    else {
+      color = opt->watermark_[bank];
+      while (taken[color]) color++;
+    }
+    rab->colors_[node] = color;
+    if (color >= new_num_regs) new_num_regs = color + 1;
+  }
+  free(taken);
+  if (new_num_regs >= num_regs) {
+    for (node = 0; node < rab->num_nodes_; ++node) {
+      rab->colors_[node] = rab->regs_[node];
+    }
+    return num_regs;
+  }
+  return new_num_regs;
+}
+
+static int sl_ir_opt_allocate_registers(struct sl_ir_opt *opt, const struct sl_exec_call_graph_results *counts_before, struct sl_exec_call_graph_results *counts_after) {
+  struct ir_body *body = opt->body_;
+  struct sl_ir_opt_ra_bank rabs[SL_IR_OPT_NUM_BANKS];
+  uint8_t *pinned[SL_IR_OPT_NUM_BANKS] = { 0 };
+  int num_regs[SL_IR_OPT_NUM_BANKS];
+  struct sl_ir_opt_effects fx;
+  struct ir_block *blk;
+  size_t n;
+  int bank, reg, r;
+
+  num_regs[0] = (int)counts_before->num_float_regs_;
+  num_regs[1] = (int)counts_before->num_int_regs_;
+  num_regs[2] = (int)counts_before->num_bool_regs_;
+  num_regs[3] = (int)counts_before->num_sampler2D_regs_;
+  num_regs[4] = (int)counts_before->num_samplerCube_regs_;
+  *counts_after = *counts_before;
+  memset(rabs, 0, sizeof(rabs));
+
+  r = sl_ir_opt_liveness(opt);
+  if (r) return (r < 0) ? r : 0;
+
+  for (bank = 0; bank < SL_IR_OPT_NUM_BANKS; ++bank) {
+    if (opt->bank_size_[bank] > num_regs[bank]) {
+      /* Registers beyond those the compilation unit allocated, leave well alone. */
+      return 0;
+    }
+    pinned[bank] = (uint8_t *)malloc((size_t)opt->bank_size_[bank] + 1);
+    rabs[bank].node_of_reg_ = (int *)malloc(sizeof(int) * ((size_t)opt->bank_size_[bank] + 1));
+    rabs[bank].regs_ = (int *)malloc(sizeof(int) * ((size_t)opt->bank_size_[bank] + 1));
+    if (!pinned[bank] || !rabs[bank].node_of_reg_ || !rabs[bank].regs_) {
+      r = -1;
+      goto done;
+    }
+    for (reg = 0; reg < opt->bank_size_[bank]; ++reg) {
+      rabs[bank].node_of_reg_[reg] = -1;
+    }
+  }
+  if (sl_ir_opt_find_pinned(opt, pinned)) goto done;
+
+  /* Nodes, in order of first appearance, so registers used early get the low numbers */
+  blk = body->blocks_;
+  do {
+    struct ir_instr *instr = blk->instructions_;
+    if (instr) {
+      do {
+        sl_ir_opt_get_effects(&fx, instr);
+        for (n = 0; n < (fx.num_writes_ + fx.num_reads_); ++n) {
+          const struct sl_ir_opt_access *acc = (n < fx.num_writes_) ? (fx.writes_ + n) : (fx.reads_ + n - fx.num_writes_);
+          struct sl_ir_opt_ra_bank *rab = rabs + acc->bank_;
+          if (!pinned[acc->bank_][acc->reg_] && (rab->node_of_reg_[acc->reg_] < 0)) {
+            rab->node_of_reg_[acc->reg_] = rab->num_nodes_;
+            rab->regs_[rab->num_nodes_++] = acc->reg_;
+          }
+        }
+        instr = instr->next_in_block_;
+      } while (instr != blk->instructions_);
+    }
+    blk = blk->next_in_body_;
+  } while (blk != body->blocks_);
+
+  for (bank = 0; bank < SL_IR_OPT_NUM_BANKS; ++bank) {
+    struct sl_ir_opt_ra_bank *rab = rabs + bank;
+    rab->row_words_ = ((size_t)rab->num_nodes_ + 31) / 32;
+    rab->interference_ = (uint32_t *)calloc((size_t)rab->num_nodes_ * rab->row_words_ + 1, sizeof(uint32_t));
+    rab->colors_ = (int *)malloc(sizeof(int) * ((size_t)rab->num_nodes_ + 1));
+    rab->move_hints_ = (int *)malloc(sizeof(int) * ((size_t)rab->num_nodes_ + 1));
+    if (!rab->interference_ || !rab->colors_ || !rab->move_hints_) {
+      r = -1;
+      goto done;
+    }
+    for (n = 0; n < (size_t)rab->num_nodes_; ++n) {
+      rab->move_hints_[n] = -1;
+    }
+  }
+
+  blk = body->blocks_;
+  do {
+    sl_ir_opt_load_states(opt, opt->live_out_ + (blk->serial_num_ - 1) * opt->num_liveness_regs_);
+    if (sl_ir_opt_collect_instrs(opt, blk)) {
+      r = -1;
+      goto done;
+    }
+    for (n = opt->num_instrs_; n > 0; --n) {
+      sl_ir_opt_get_effects(&fx, opt->instrs_[n - 1]);
+      sl_ir_opt_ra_instr(opt, rabs, opt->instrs_[n - 1], &fx);
+      sl_ir_opt_liveness_step(opt, &fx);
+    }
+    blk = blk->next_in_body_;
+  } while (blk != body->blocks_);
+
+  for (bank = 0; bank < SL_IR_OPT_NUM_BANKS; ++bank) {
+    num_regs[bank] = sl_ir_opt_ra_color(opt, bank, rabs + bank, pinned[bank], num_regs[bank]);
+  }
+
+  /* Renumber the operands */
+  blk = body->blocks_;
+  do {
+    struct ir_instr *instr = blk->instructions_;
+    if (instr) {
+      do {
+        sl_ir_opt_get_effects(&fx, instr);
+        for (n = 0; n < (fx.num_writes_ + fx.num_reads_); ++n) {
+          const struct sl_ir_opt_access *acc = (n < fx.num_writes_) ? (fx.writes_ + n) : (fx.reads_ + n - fx.num_writes_);
+          int node = rabs[acc->bank_].node_of_reg_[acc->reg_];
+          if ((node >= 0) && (rabs[acc->bank_].colors_[node] != acc->reg_)) {
+            struct ir_temp *temp = sl_ir_opt_bank_temp(body, acc->bank_, rabs[acc->bank_].colors_[node]);
+            if (!temp) {
+              r = -1;
+              goto done;
+            }
+            ir_arg_set_temp(acc->arg_, temp);
+          }
+        }
+        instr = instr->next_in_block_;
+      } while (instr != blk->instructions_);
+    }
+    blk = blk->next_in_body_;
+  } while (blk != body->blocks_);
+
+  /* Moves whose source and destination now share a register do nothing */
+  blk = body->blocks_;
+  do {
+    if (sl_ir_opt_collect_instrs(opt, blk)) {
+      r = -1;
+      goto done;
+    }
+    for (n = 0; n < opt->num_instrs_; ++n) {
+      struct ir_instr *instr = opt->instrs_[n];
+      sl_ir_opt_get_effects(&fx, instr);
+      if ((sl_ir_opt_plain_move_bank(instr, &fx) >= 0) && (fx.writes_[0].reg_ == fx.reads_[0].reg_)) {
+        ir_block_remove_instr(instr);
+        opt->stats_.num_moves_coalesced_++;
+      }
+    }
+    blk = blk->next_in_body_;
+  } while (blk != body->blocks_);
+
+  counts_after->num_float_regs_ = (size_t)num_regs[0];
+  counts_after->num_int_regs_ = (size_t)num_regs[1];
+  counts_after->num_bool_regs_ = (size_t)num_regs[2];
+  counts_after->num_sampler2D_regs_ = (size_t)num_regs[3];
+  counts_after->num_samplerCube_regs_ = (size_t)num_regs[4];
+
+done:
+  for (bank = 0; bank < SL_IR_OPT_NUM_BANKS; ++bank) {
+    if (pinned[bank]) free(pinned[bank]);
+    if (rabs[bank].node_of_reg_) free(rabs[bank].node_of_reg_);
+    if (rabs[bank].regs_) free(rabs[bank].regs_);
+    if (rabs[bank].interference_) free(rabs[bank].interference_);
+    if (rabs[bank].colors_) free(rabs[bank].colors_);
+    if (rabs[bank].move_hints_) free(rabs[bank].move_hints_);
+  }
+  return r;
+}
+
+static void sl_ir_opt_dump(FILE *fp, struct ir_body *body, const char *title) {
+  struct ireg_registry ireg;
+  struct source_gen sg;
+  fprintf(fp, "-- SLIR %s optimization --\n", title);
+  ireg_init(&ireg);
+  sl_ir_register_instructions(&ireg);
+  sg_init(&sg);
+  sg.fp_ = fp;
+  ir_print_body(&sg, &ireg, body);
+  sg_finish(&sg);
+  sg_cleanup(&sg);
+  ireg_cleanup(&ireg);
+}
+
+static void sl_ir_opt_cleanup(struct sl_ir_opt *opt) {
+  int bank;
+  for (bank = 0; bank < SL_IR_OPT_NUM_BANKS; ++bank) {
+    if (opt->facts_[bank]) free(opt->facts_[bank]);
+    if (opt->states_[bank]) free(opt->states_[bank]);
+  }
+  if (opt->exprs_) free(opt->exprs_);
+  if (opt->instrs_) free(opt->instrs_);
+  if (opt->live_out_) free(opt->live_out_);
+  if (opt->live_in_) free(opt->live_in_);
+}
+
+int sl_ir_opt_parse_passes(const char *spec) {
+  int passes = 0;
+  if (!spec || !*spec || !strcmp(spec, "all")) return SL_IR_OPT_ALL;
+  if (!strcmp(spec, "none")) return 0;
+  while (*spec) {
+    size_t len = strcspn(spec, ",");
+    if ((len == 9) && !memcmp(spec, "constprop", len)) passes |= SL_IR_OPT_CONST_PROP;
+    else if ((len == 3) && !memcmp(spec, "cse", len)) passes |= SL_IR_OPT_CSE;
+    else if ((len == 8) && !memcmp(spec, "copyprop", len)) passes |= SL_IR_OPT_COPY_PROP;
+    else if ((len == 3) && !memcmp(spec, "dse", len)) passes |= SL_IR_OPT_DSE;
+    else if ((len == 8) && !memcmp(spec, "regalloc", len)) passes |= SL_IR_OPT_REG_ALLOC;
+    else if ((len == 4) && !memcmp(spec, "fuse", len)) passes |= SL_IR_OPT_FUSE;
+    spec += len;
+    if (*spec == ',') spec++;
+  }
+  return passes;
+}
+
+const char *sl_ir_opt_fusion_name(int fusion) {
+  switch (fusion) {
+    case SL_IR_OPT_FUSED_MAD: return "mad";
+    case SL_IR_OPT_FUSED_LERP: return "lerp";
+    case SL_IR_OPT_FUSED_DOT_MAX: return "dot+max";
+    case SL_IR_OPT_FUSED_DOT_CLAMP: return "dot+clamp";
+  }
+  return "?";
+}
+
+int sl_ir_optimize(struct ir_body *body, struct sl_compilation_unit *cu, int passes,
+                   const struct sl_ir_opt_constant *constants, size_t num_constants,
+                   FILE *dump_fp, struct sl_ir_opt_stats *stats) {
+  struct sl_ir_opt opt;
+  struct ir_block *blk;
+  int bank, round;
+  int r = 0;
+  memset(&opt, 0, sizeof(opt));
+  opt.body_ = body;
+  opt.passes_ = passes;
+  opt.constants_ = constants;
+  opt.num_constants_ = constants ? num_constants : 0;
+  sl_ir_opt_count_instrs(body, &opt.stats_.num_instrs_before_);
+  if (dump_fp) sl_ir_opt_dump(dump_fp, body, "before");
+
+  sl_ir_opt_size_banks(&opt);
+  for (bank = 0; bank < SL_IR_OPT_NUM_BANKS; ++bank) {
+    opt.facts_[bank] = (struct sl_ir_opt_fact *)malloc(sizeof(struct sl_ir_opt_fact) * (size_t)(opt.bank_size_[bank] + 1));
+    opt.states_[bank] = (int *)malloc(sizeof(int) * (size_t)(opt.bank_size_[bank] + 1));
+    if (!opt.facts_[bank] || !opt.states_[bank]) {
+      r = -1;
+      goto done;
+    }
+  }
+
+  /* Without the compilation unit, we cannot tell the globals (which are read after the shader completes)
+   * from the locals, so all registers are considered globals. */
+  if (cu) {
+    opt.watermark_[0] = (int)cu->global_frame_.ract_.rra_floats_.watermark_;
+    opt.watermark_[1] = (int)cu->global_frame_.ract_.rra_ints_.watermark_;
+    opt.watermark_[2] = (int)cu->global_frame_.ract_.rra_bools_.watermark_;
+    opt.watermark_[3] = (int)cu->global_frame_.ract_.rra_sampler2D_.watermark_;
+    opt.watermark_[4] = (int)cu->global_frame_.ract_.rra_samplerCube_.watermark_;
+  }
+  else {
+    for (bank = 0; bank < SL_IR_OPT_NUM_BANKS; ++bank) {
+      opt.watermark_[bank] = INT_MAX;
+    }
+  }
+
+  for (round = 0; passes && (round < SL_IR_OPT_MAX_ROUNDS) && body->blocks_; ++round) {
+    opt.changed_ = 0;
+    if (passes & (SL_IR_OPT_CONST_PROP | SL_IR_OPT_CSE | SL_IR_OPT_COPY_PROP)) {
+      blk = body->blocks_;
+      do {
+        r = sl_ir_opt_forward_block(&opt, blk);
+        if (r) goto done;
+        blk = blk->next_in_body_;
+      } while (blk != body->blocks_);
+    }
+    if (passes & SL_IR_OPT_DSE) {
+      r = sl_ir_opt_dse(&opt);
+      if (r) goto done;
+    }
+    if (!opt.changed_) break;
+  }
+
+  if ((passes & SL_IR_OPT_FUSE) && body->blocks_) {
+    r = sl_ir_opt_fuse_superinstructions(&opt);
+    if (r) goto done;
+  }
+
+  if (cu) {
+    opt.stats_.reg_counts_before_ = cu->register_counts_;
+    opt.stats_.reg_counts_after_ = cu->register_counts_;
+    if ((passes & SL_IR_OPT_REG_ALLOC) && body->blocks_) {
+      /* The passes may have removed the last use of some registers */
+      sl_ir_opt_size_banks(&opt);
+      r = sl_ir_opt_allocate_registers(&opt, &opt.stats_.reg_counts_before_, &opt.stats_.reg_counts_after_);
+      if (r) goto done;
+    }
+  }
+
+  sl_ir_opt_count_instrs(body, &opt.stats_.num_instrs_after_);
+  if (dump_fp) {
+    sl_ir_opt_dump(dump_fp, body, "after");
+    fprintf(dump_fp, "-- %zu instructions before, %zu after; %zu folded, %zu CSE, %zu copies propagated, %zu dead --\n",
+            opt.stats_.num_instrs_before_, opt.stats_.num_instrs_after_, opt.stats_.num_folded_, opt.stats_.num_cse_,
+            opt.stats_.num_copies_propagated_, opt.stats_.num_dead_removed_);
+    fprintf(dump_fp, "-- superinstructions: %zu %s, %zu %s, %zu %s, %zu %s --\n",
+            opt.stats_.num_fused_[SL_IR_OPT_FUSED_MAD], sl_ir_opt_fusion_name(SL_IR_OPT_FUSED_MAD),
+            opt.stats_.num_fused_[SL_IR_OPT_FUSED_LERP], sl_ir_opt_fusion_name(SL_IR_OPT_FUSED_LERP),
+            opt.stats_.num_fused_[SL_IR_OPT_FUSED_DOT_MAX], sl_ir_opt_fusion_name(SL_IR_OPT_FUSED_DOT_MAX),
+            opt.stats_.num_fused_[SL_IR_OPT_FUSED_DOT_CLAMP], sl_ir_opt_fusion_name(SL_IR_OPT_FUSED_DOT_CLAMP));
+    fprintf(dump_fp, "-- registers (float/int/bool) %zu/%zu/%zu before allocation, %zu/%zu/%zu after; %zu moves coalesced --\n",
+            opt.stats_.reg_counts_before_.num_float_regs_, opt.stats_.reg_counts_before_.num_int_regs_, opt.stats_.reg_counts_before_.num_bool_regs_,
+            opt.stats_.reg_counts_after_.num_float_regs_, opt.stats_.reg_counts_after_.num_int_regs_, opt.stats_.reg_counts_after_.num_bool_regs_,
+            opt.stats_.num_moves_coalesced_);
+  }
+  if (stats) *stats = opt.stats_;
+
+done:
+  sl_ir_opt_cleanup(&opt);
+  if (body->alloc_error_) r = -1;
+  return r;
+}
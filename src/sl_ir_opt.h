@@ -0,0 +1,146 @@
+/* Copyright 2024 Kinglet B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SL_IR_OPT_H
+#define SL_IR_OPT_H
+
+#ifndef STDDEF_H_INCLUDED
+#define STDDEF_H_INCLUDED
+#include <stddef.h>
+#endif
+
+#ifndef STDIO_H_INCLUDED
+#define STDIO_H_INCLUDED
+#include <stdio.h>
+#endif
+
+#ifndef SL_EXECUTION_H_INCLUDED
+#define SL_EXECUTION_H_INCLUDED
+#include "sl_execution.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Optimization passes over the SLIR produced by sl_ir_lower_function(), run before it is flattened to
+ * bytecode. The passes reason about the register banks per execution chain: a value known to be in a
+ * register is only known for the rows of the chain that put it there, so facts are qualified by the chain
+ * and forgotten when that chain is redefined (or when chains are split or joined.) */
+
+/* Constant propagation; kernels whose operands are all known constants become SLIR_INIT_LIT_XXX. */
+#define SL_IR_OPT_CONST_PROP 1
+
+/* Common subexpression elimination; a kernel that recomputes a value still held by another register
+ * becomes a register move. */
+#define SL_IR_OPT_CSE 2
+
+/* Copy propagation; operands are read from the source of a register move rather than its destination. */
+#define SL_IR_OPT_COPY_PROP 4
+
+/* Dead store elimination; kernels writing local registers that are never read afterwards are removed. */
+#define SL_IR_OPT_DSE 8
+
+/* Register allocation; local registers are renumbered so those whose values are never live at the same time
+ * share a register, which shrinks the register slab. Registers accessed by builtins or through runtime
+ * indices keep their numbers. The source and destination of a register move (as emitted for swizzles,
+ * whole vector copies and parameter passing) share a register unless one is written while the other is
+ * still live, in which case the move is an actual copy; otherwise the move is removed. */
+#define SL_IR_OPT_REG_ALLOC 16
+
+/* Superinstruction fusion; a kernel reading the only result of the kernel right before it on the same chain,
+ * where nothing else reads that result, is replaced with a single superinstruction (SLIR_MAD_F and onwards)
+ * that computes both without storing the intermediate column. Runs after the other passes, as they do not
+ * look inside superinstructions. */
+#define SL_IR_OPT_FUSE 32
+
+#define SL_IR_OPT_ALL (SL_IR_OPT_CONST_PROP | SL_IR_OPT_CSE | SL_IR_OPT_COPY_PROP | SL_IR_OPT_DSE | SL_IR_OPT_REG_ALLOC | SL_IR_OPT_FUSE)
+
+/* Superinstructions formed by SL_IR_OPT_FUSE, indexing sl_ir_opt_stats::num_fused_ */
+#define SL_IR_OPT_FUSED_MAD 0       /* a * b + c, SLIR_MAD_F */
+#define SL_IR_OPT_FUSED_LERP 1      /* (b - a) * t + a, SLIR_LERP_F */
+#define SL_IR_OPT_FUSED_DOT_MAX 2   /* max(dot(a, b), c), SLIR_DOTn_MAX_F */
+#define SL_IR_OPT_FUSED_DOT_CLAMP 3 /* clamp(dot(a, b), c, d), SLIR_DOTn_CLAMP_F */
+#define SL_IR_OPT_NUM_FUSIONS 4
+
+/* Register banks, as in sl_ir_opt_constant::bank_ */
+#define SL_IR_OPT_FLOAT 0
+#define SL_IR_OPT_INT 1
+#define SL_IR_OPT_BOOL 2
+
+struct ir_body;
+struct sl_compilation_unit;
+
+/* A register holding the same value on all rows for the entire run, which the shader never writes; e.g. a
+ * uniform the shader is specialized on (see sl_execution::specialized_.) Constant propagation treats it as
+ * known on every chain. */
+struct sl_ir_opt_constant {
+  int bank_; /* SL_IR_OPT_FLOAT, SL_IR_OPT_INT or SL_IR_OPT_BOOL */
+  int reg_;
+  float f_;
+  int64_t i_; /* int or bool value */
+};
+
+struct sl_ir_opt_stats {
+  size_t num_instrs_before_;
+  size_t num_instrs_after_;
+
+  /* Instructions replaced by a literal initialization (or a move), including chain splits on a known
+   * condition, which become a move of the chain to the branch taken */
+  size_t num_folded_;
+
+  /* Instructions replaced by a move from (or removed in favor of) a register already holding their result */
+  size_t num_cse_;
+
+  /* Operands now read from the source of a move instead of its destination */
+  size_t num_copies_propagated_;
+
+  /* Instructions removed as nothing reads the registers they write */
+  size_t num_dead_removed_;
+
+  /* Superinstructions formed, for each SL_IR_OPT_FUSED_XXX */
+  size_t num_fused_[SL_IR_OPT_NUM_FUSIONS];
+
+  /* Register moves removed as register allocation gave their source and destination the same register */
+  size_t num_moves_coalesced_;
+
+  /* Number of registers in each bank the body needs, before and after register allocation (the same if
+   * SL_IR_OPT_REG_ALLOC was not requested); num_execution_frames_ is not used. */
+  struct sl_exec_call_graph_results reg_counts_before_;
+  struct sl_exec_call_graph_results reg_counts_after_;
+};
+
+/* Returns the SL_IR_OPT_XXX flags for spec, as given to the AEX_SL_OPT environment variable: NULL, an empty
+ * string or "all" for all passes, "none" for none, or a comma separated list of "constprop", "cse",
+ * "copyprop", "dse", "regalloc" and "fuse". Unrecognized names are ignored. */
+int sl_ir_opt_parse_passes(const char *spec);
+
+/* Returns a short name for a SL_IR_OPT_FUSED_XXX superinstruction, e.g. "dot+max", for reporting. */
+const char *sl_ir_opt_fusion_name(int fusion);
+
+/* Runs the passes (SL_IR_OPT_XXX flags) over body, which is the lowered main function of cu, until
+ * they no longer find anything to improve, with the num_constants registers in constants (which may be NULL)
+ * known to hold their values, then fuses superinstructions (if SL_IR_OPT_FUSE is given) and
+ * allocates its registers (if SL_IR_OPT_REG_ALLOC is given and cu is not NULL.) If dump_fp is not NULL,
+ * the SLIR is printed to it before and after. stats may be NULL. Returns 0 upon success, or non-zero upon
+ * allocation failure, in which case body should not be used. */
+int sl_ir_optimize(struct ir_body *body, struct sl_compilation_unit *cu, int passes,
+                   const struct sl_ir_opt_constant *constants, size_t num_constants,
+                   FILE *dump_fp, struct sl_ir_opt_stats *stats);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* SL_IR_OPT_H */
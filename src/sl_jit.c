@@ -0,0 +1,728 @@
+/* Copyright 2024 Kinglet B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* MAP_ANONYMOUS is not part of strict ISO C builds (e.g. -std=c11) unless asked for */
+#if !defined(_WIN32) && !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE 1
+#endif
+#if defined(__APPLE__) && !defined(_DARWIN_C_SOURCE)
+#define _DARWIN_C_SOURCE 1
+#endif
+
+#ifndef STDINT_H_INCLUDED
+#define STDINT_H_INCLUDED
+#include <stdint.h>
+#endif
+
+#ifndef STDLIB_H_INCLUDED
+#define STDLIB_H_INCLUDED
+#include <stdlib.h>
+#endif
+
+#ifndef STRING_H_INCLUDED
+#define STRING_H_INCLUDED
+#include <string.h>
+#endif
+
+#ifndef IR_H_INCLUDED
+#define IR_H_INCLUDED
+#include "ir.h"
+#endif
+
+#ifndef SL_IR_H_INCLUDED
+#define SL_IR_H_INCLUDED
+#include "sl_ir.h"
+#endif
+
+#ifndef SL_EXECUTION_H_INCLUDED
+#define SL_EXECUTION_H_INCLUDED
+#include "sl_execution.h"
+#endif
+
+#ifndef SL_BYTECODE_H_INCLUDED
+#define SL_BYTECODE_H_INCLUDED
+#include "sl_bytecode.h"
+#endif
+
+#ifndef SL_JIT_H_INCLUDED
+#define SL_JIT_H_INCLUDED
+#include "sl_jit.h"
+#endif
+
+#ifndef SL_SIMD_H_INCLUDED
+#define SL_SIMD_H_INCLUDED
+#include "sl_simd.h"
+#endif
+
+#if SL_JIT_AVAILABLE
+#ifdef _WIN32
+#ifndef WINDOWS_H_INCLUDED
+#define WINDOWS_H_INCLUDED
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#endif
+#ifndef INTRIN_H_INCLUDED
+#define INTRIN_H_INCLUDED
+#include <intrin.h>
+#endif
+#else
+#ifndef SYS_MMAN_H_INCLUDED
+#define SYS_MMAN_H_INCLUDED
+#include <sys/mman.h>
+#endif
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+#ifndef CPUID_H_INCLUDED
+#define CPUID_H_INCLUDED
+#include <cpuid.h>
+#endif
+#endif
+#endif
+
+/* Signature of the generated code; chains is exec->bc_chains_ */
+typedef void (*sl_jit_fn_t)(struct sl_bytecode *bc, struct sl_execution *exec, uint32_t *chains);
+
+void sl_jit_init(struct sl_jit *jit) {
+  jit->bc_ = NULL;
+  jit->code_ = NULL;
+  jit->code_size_ = 0;
+}
+
+void sl_jit_cleanup(struct sl_jit *jit) {
+#if SL_JIT_AVAILABLE
+  if (jit->code_) {
+#ifdef _WIN32
+    VirtualFree(jit->code_, 0, MEM_RELEASE);
+#else
+    munmap(jit->code_, jit->code_size_);
+#endif
+  }
+#endif
+  jit->code_ = NULL;
+  jit->code_size_ = 0;
+  jit->bc_ = NULL;
+}
+
+int sl_jit_host_supported(void) {
+#if SL_JIT_AVAILABLE
+  /* SSE2 is architecturally part of x86-64, but check anyway so a misreporting (emulated) host does not
+   * fault; CPUID leaf 1, EDX bit 26 */
+#ifdef _WIN32
+  int regs[4];
+  __cpuid(regs, 1);
+  return !!(regs[3] & (1 << 26));
+#else
+  unsigned int eax, ebx, ecx, edx;
+  if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return 0;
+  return !!(edx & (1 << 26));
+#endif
+#else
+  return 0;
+#endif
+}
+
+#if SL_JIT_AVAILABLE
+
+/* Called from the generated code for all kernels neither translated inline nor called directly. */
+static void sl_jit_kernel_thunk(struct sl_bytecode *bc, struct sl_execution *exec, const int *pc, uint32_t row) {
+  /* pc[2] is the chain operand, already resolved to row */
+  sl_bytecode_exec_kernel(bc, exec, pc[0], (sl_exec_row_t)row, pc + 3);
+}
+
+static void sl_jit_chain_thunk(struct sl_bytecode *bc, struct sl_execution *exec, const int *pc, uint32_t row) {
+  sl_bytecode_exec_chain_instr(bc, exec, pc);
+}
+
+/* Called around each kernel and chain instruction when the code was generated for profiling, see
+ * sl_bytecode_profile_enter(); row is the chain of a kernel, SL_EXEC_NO_CHAIN for a chain instruction. */
+static void sl_jit_profile_enter_thunk(struct sl_bytecode *bc, struct sl_execution *exec, const int *pc, uint32_t row) {
+  sl_bytecode_profile_enter(bc, exec, pc, row, NULL);
+}
+
+static void sl_jit_profile_leave_thunk(struct sl_bytecode *bc, struct sl_execution *exec, const int *pc, uint32_t row) {
+  sl_bytecode_profile_leave(exec);
+}
+
+/* Stack the generated code reserves below its pushes; 8 modulo 16 to keep calls aligned, and room for the 32 bytes
+ * of Windows shadow space followed by the stack arguments of the kernel called directly that takes the most,
+ * SLIR_DOT4_CLAMP_F with 13 (9 on the stack on Windows, 7 elsewhere.) */
+#define SL_JIT_FRAME_SIZE 104
+
+
+/* rel32 to be patched with the native offset of the bytecode at target_ once all code is generated */
+struct sl_jit_fixup {
+  size_t pos_;
+  size_t target_;
+};
+
+struct sl_jit_builder {
+  int failed_;
+
+  size_t num_code_;
+  size_t num_code_allocated_;
+  uint8_t *code_;
+
+  size_t num_fixups_;
+  size_t num_fixups_allocated_;
+  struct sl_jit_fixup *fixups_;
+
+  /* Native offset of each bytecode offset that starts an instruction */
+  size_t *native_offsets_;
+
+  /* Non-zero to emit the inline arithmetic as 256 bit AVX (float) and AVX2 (integer) loops rather than SSE2 */
+  int avx2_;
+
+  /* Non-zero to wrap each kernel and chain instruction in calls to the profile thunks */
+  int profile_;
+};
+
+static void sl_jit_emit(struct sl_jit_builder *jb, const uint8_t *bytes, size_t num_bytes) {
+  if (jb->failed_) return;
+  if ((jb->num_code_ + num_bytes) > jb->num_code_allocated_) {
+    size_t new_num_allocated = jb->num_code_allocated_ * 2 + 256 + num_bytes;
+    uint8_t *new_code = (uint8_t *)realloc(jb->code_, new_num_allocated);
+    if (!new_code) {
+      jb->failed_ = 1;
+      return;
+    }
+    jb->code_ = new_code;
+    jb->num_code_allocated_ = new_num_allocated;
+  }
+  memcpy(jb->code_ + jb->num_code_, bytes, num_bytes);
+  jb->num_code_ += num_bytes;
+}
+
+#define EMIT(...) do { static const uint8_t emit_bytes_[] = { __VA_ARGS__ }; sl_jit_emit(jb, emit_bytes_, sizeof(emit_bytes_)); } while (0)
+
+static void sl_jit_emit8(struct sl_jit_builder *jb, uint8_t v) {
+  sl_jit_emit(jb, &v, 1);
+}
+
+static void sl_jit_emit32(struct sl_jit_builder *jb, uint32_t v) {
+  uint8_t b[4] = { (uint8_t)v, (uint8_t)(v >> 8), (uint8_t)(v >> 16), (uint8_t)(v >> 24) };
+  sl_jit_emit(jb, b, sizeof(b));
+}
+
+static void sl_jit_emit64(struct sl_jit_builder *jb, uint64_t v) {
+  sl_jit_emit32(jb, (uint32_t)v);
+  sl_jit_emit32(jb, (uint32_t)(v >> 32));
+}
+
+static void sl_jit_patch32(struct sl_jit_builder *jb, size_t pos, uint32_t v) {
+  if (jb->failed_) return;
+  jb->code_[pos] = (uint8_t)v;
+  jb->code_[pos + 1] = (uint8_t)(v >> 8);
+  jb->code_[pos + 2] = (uint8_t)(v >> 16);
+  jb->code_[pos + 3] = (uint8_t)(v >> 24);
+}
+
+/* Emits a rel32 placeholder and returns its position, to be patched with sl_jit_bind() */
+static size_t sl_jit_emit_rel32(struct sl_jit_builder *jb) {
+  size_t pos = jb->num_code_;
+  sl_jit_emit32(jb, 0);
+  return pos;
+}
+
+/* Points the rel32 at pos to the current position */
+static void sl_jit_bind(struct sl_jit_builder *jb, size_t pos) {
+  sl_jit_patch32(jb, pos, (uint32_t)(jb->num_code_ - (pos + 4)));
+}
+
+/* Emits a rel32 to the bytecode instruction at offset target */
+static void sl_jit_emit_rel32_to_bytecode(struct sl_jit_builder *jb, size_t target) {
+  if (jb->failed_) return;
+  if (jb->num_fixups_ == jb->num_fixups_allocated_) {
+    size_t new_num_allocated = jb->num_fixups_allocated_ * 2 + 16;
+    struct sl_jit_fixup *new_fixups = (struct sl_jit_fixup *)realloc(jb->fixups_, sizeof(struct sl_jit_fixup) * new_num_allocated);
+    if (!new_fixups) {
+      jb->failed_ = 1;
+      return;
+    }
+    jb->fixups_ = new_fixups;
+    jb->num_fixups_allocated_ = new_num_allocated;
+  }
+  jb->fixups_[jb->num_fixups_].pos_ = jb->num_code_;
+  jb->fixups_[jb->num_fixups_].target_ = target;
+  jb->num_fixups_++;
+  sl_jit_emit32(jb, 0);
+}
+
+/* Register usage in the generated code:
+ * rbx: chains (uint32_t *)
+ * r12: exec->exec_chain_reg_
+ * r13: exec->float_regs_
+ * rbp: exec->int_regs_
+ * r14: bc
+ * r15: exec
+ * eax: current row, r8, r9, r10: result, left and right columns, r11, rcx, rdx: scratch */
+
+/* mov eax, [rbx + chain * 4] */
+static void sl_jit_emit_load_chain(struct sl_jit_builder *jb, int chain) {
+  EMIT(0x8B, 0x83);
+  sl_jit_emit32(jb, (uint32_t)(chain * 4));
+}
+
+/* mov [rbx + chain * 4], eax */
+static void sl_jit_emit_store_chain(struct sl_jit_builder *jb, int chain) {
+  EMIT(0x89, 0x83);
+  sl_jit_emit32(jb, (uint32_t)(chain * 4));
+}
+
+/* mov reg, [base + index * 8]; reg is r8, r9 or r10, base is r13 (float) or rbp (int) */
+static void sl_jit_emit_load_column(struct sl_jit_builder *jb, int reg, int base, int index) {
+  sl_jit_emit8(jb, (uint8_t)(0x4C | ((base >= 8) ? 1 : 0)));
+  sl_jit_emit8(jb, 0x8B);
+  sl_jit_emit8(jb, (uint8_t)(0x80 | ((reg & 7) << 3) | (base & 7)));
+  sl_jit_emit32(jb, (uint32_t)(index * 8));
+}
+
+/* mov reg, [base + disp]; 64 bit */
+static void sl_jit_emit_load_qword(struct sl_jit_builder *jb, int reg, int base, int32_t disp) {
+  sl_jit_emit8(jb, (uint8_t)(0x48 | ((reg >= 8) ? 4 : 0) | ((base >= 8) ? 1 : 0)));
+  sl_jit_emit8(jb, 0x8B);
+  sl_jit_emit8(jb, (uint8_t)(0x80 | ((reg & 7) << 3) | (base & 7)));
+  if ((base & 7) == 4) sl_jit_emit8(jb, 0x24); /* rsp and r12 need a SIB byte */
+  sl_jit_emit32(jb, (uint32_t)disp);
+}
+
+/* mov [rsp + disp], reg; 64 bit */
+static void sl_jit_emit_store_stack(struct sl_jit_builder *jb, int32_t disp, int reg) {
+  sl_jit_emit8(jb, (uint8_t)(0x48 | ((reg >= 8) ? 4 : 0)));
+  sl_jit_emit8(jb, 0x89);
+  sl_jit_emit8(jb, (uint8_t)(0x84 | ((reg & 7) << 3)));
+  sl_jit_emit8(jb, 0x24);
+  sl_jit_emit32(jb, (uint32_t)disp);
+}
+
+/* Calls fn(eax, r12, columns..) for the kernel instruction at pc, see sl_bytecode_direct_kernel() for banks. The
+ * columns are loaded from the register arrays of the execution as the code runs, rather than resolved while
+ * generating it, as all executions sharing the bytecode (see sl_exec_init_context()) share the code. */
+static void sl_jit_emit_call_kernel(struct sl_jit_builder *jb, sl_bytecode_kernel_fn_t fn, const char *banks, const int *pc) {
+#ifdef _WIN32
+  static const int arg_regs[] = { 1 /* rcx */, 2 /* rdx */, 8, 9 };
+  const int32_t stack_args_disp = 32; /* past the shadow space */
+#else
+  static const int arg_regs[] = { 7 /* rdi */, 6 /* rsi */, 2 /* rdx */, 1 /* rcx */, 8, 9 };
+  const int32_t stack_args_disp = 0;
+#endif
+  const int num_arg_regs = (int)(sizeof(arg_regs) / sizeof(*arg_regs));
+  const int *args = pc + 3;
+  int n;
+  for (n = 0; banks[n]; ++n) {
+    int arg = 2 + n; /* after row and chain column */
+    int reg = (arg < num_arg_regs) ? arg_regs[arg] : 11 /* r11 */;
+    switch (banks[n]) {
+      case 'f': sl_jit_emit_load_qword(jb, reg, 13, args[n] * 8); break;
+      case 'i': sl_jit_emit_load_qword(jb, reg, 5, args[n] * 8); break;
+      case 'b':
+        sl_jit_emit_load_qword(jb, reg, 15, (int32_t)offsetof(struct sl_execution, bool_regs_));
+        sl_jit_emit_load_qword(jb, reg, reg, args[n] * 8);
+        break;
+      default:
+        /* xor reg, reg */
+        if (reg >= 8) sl_jit_emit8(jb, 0x4D);
+        else sl_jit_emit8(jb, 0x48);
+        sl_jit_emit8(jb, 0x31);
+        sl_jit_emit8(jb, (uint8_t)(0xC0 | ((reg & 7) << 3) | (reg & 7)));
+        break;
+    }
+    if (arg >= num_arg_regs) {
+      sl_jit_emit_store_stack(jb, stack_args_disp + (arg - num_arg_regs) * 8, 11);
+    }
+  }
+#ifdef _WIN32
+  EMIT(0x89, 0xC1);             /* mov ecx, eax */
+  EMIT(0x4C, 0x89, 0xE2);       /* mov rdx, r12 */
+#else
+  EMIT(0x89, 0xC7);             /* mov edi, eax */
+  EMIT(0x4C, 0x89, 0xE6);       /* mov rsi, r12 */
+#endif
+  EMIT(0x48, 0xB8);             /* mov rax, imm64 */
+  sl_jit_emit64(jb, (uint64_t)(uintptr_t)fn);
+  EMIT(0xFF, 0xD0);             /* call rax */
+}
+
+/* Calls thunk(bc, exec, pc, eax) */
+static void sl_jit_emit_call_thunk(struct sl_jit_builder *jb, void (*thunk)(struct sl_bytecode *, struct sl_execution *, const int *, uint32_t), const int *pc) {
+#ifdef _WIN32
+  EMIT(0x41, 0x89, 0xC1);       /* mov r9d, eax */
+  EMIT(0x4C, 0x89, 0xF1);       /* mov rcx, r14 */
+  EMIT(0x4C, 0x89, 0xFA);       /* mov rdx, r15 */
+  EMIT(0x49, 0xB8);             /* mov r8, imm64 */
+#else
+  EMIT(0x89, 0xC1);             /* mov ecx, eax */
+  EMIT(0x4C, 0x89, 0xF7);       /* mov rdi, r14 */
+  EMIT(0x4C, 0x89, 0xFE);       /* mov rsi, r15 */
+  EMIT(0x48, 0xBA);             /* mov rdx, imm64 */
+#endif
+  sl_jit_emit64(jb, (uint64_t)(uintptr_t)pc);
+  EMIT(0x48, 0xB8);             /* mov rax, imm64 */
+  sl_jit_emit64(jb, (uint64_t)(uintptr_t)thunk);
+  EMIT(0xFF, 0xD0);             /* call rax */
+}
+
+/* Emits the loop over the (byte) chain in eax for a binary operator on 8 rows at a time, where
+ * element_size is 4 (float or 32-bit sl_exec_int_t) or 8 (64-bit sl_exec_int_t), vector_op is the SSE2 opcode for xmm0 = xmm0 op xmm1
+ * (with 0x66 prefix if vector_prefix is non-zero) and the scalar operation is emitted by
+ * the caller-provided bytes. If jb->avx2_ is set, the 8 rows go as VEX encoded ymm0 = ymm0 op ymm1 instead, which
+ * has the same opcode (with pp = 01 for the 0x66 prefix.) Mirrors sl_binop_snippet_inc.h */
+static void sl_jit_emit_binop_loop(struct sl_jit_builder *jb, int element_size, int vector_prefix, uint8_t vector_op, const uint8_t *scalar_op, size_t scalar_op_size) {
+  uint8_t scale_bits = (element_size == 4) ? 0x80 : 0xC0;
+  int vector_size = jb->avx2_ ? 32 : 16;
+  int num_vectors = (8 * element_size) / vector_size;
+  int n;
+  size_t loop, to_scalar_unaligned, to_scalar_partial, to_done_vector, to_done_scalar, to_loop;
+
+  loop = jb->num_code_;
+  EMIT(0xA8, 0x07);                                     /* test al, 7 */
+  EMIT(0x0F, 0x85); to_scalar_unaligned = sl_jit_emit_rel32(jb); /* jnz scalar */
+  EMIT(0x4D, 0x8B, 0x1C, 0x04);                         /* mov r11, [r12 + rax] */
+  EMIT(0x48, 0xB9); sl_jit_emit64(jb, 0x00FFFFFFFFFFFFFFULL); /* mov rcx, imm64 */
+  EMIT(0x4C, 0x21, 0xD9);                               /* and rcx, r11 */
+  EMIT(0x48, 0xBA); sl_jit_emit64(jb, 0x0001010101010101ULL); /* mov rdx, imm64 */
+  EMIT(0x48, 0x39, 0xD1);                               /* cmp rcx, rdx */
+  EMIT(0x0F, 0x85); to_scalar_partial = sl_jit_emit_rel32(jb); /* jne scalar */
+  for (n = 0; (n < num_vectors) && jb->avx2_; ++n) {
+    uint8_t disp = (uint8_t)(n * 32);
+    EMIT(0xC4, 0xC1, 0x7C, 0x10, 0x44); sl_jit_emit8(jb, (uint8_t)(scale_bits | 0x01)); sl_jit_emit8(jb, disp); /* vmovups ymm0, [r9 + rax * s + disp] */
+    EMIT(0xC4, 0xC1, 0x7C, 0x10, 0x4C); sl_jit_emit8(jb, (uint8_t)(scale_bits | 0x02)); sl_jit_emit8(jb, disp); /* vmovups ymm1, [r10 + rax * s + disp] */
+    EMIT(0xC5); sl_jit_emit8(jb, vector_prefix ? 0xFD : 0xFC); sl_jit_emit8(jb, vector_op); EMIT(0xC1);      /* vop ymm0, ymm0, ymm1 */
+    EMIT(0xC4, 0xC1, 0x7C, 0x11, 0x44); sl_jit_emit8(jb, (uint8_t)(scale_bits | 0x00)); sl_jit_emit8(jb, disp); /* vmovups [r8 + rax * s + disp], ymm0 */
+  }
+  for (n = 0; (n < num_vectors) && !jb->avx2_; ++n) {
+    uint8_t disp = (uint8_t)(n * 16);
+    EMIT(0x41, 0x0F, 0x10, 0x44); sl_jit_emit8(jb, (uint8_t)(scale_bits | 0x01)); sl_jit_emit8(jb, disp); /* movups xmm0, [r9 + rax * s + disp] */
+    EMIT(0x41, 0x0F, 0x10, 0x4C); sl_jit_emit8(jb, (uint8_t)(scale_bits | 0x02)); sl_jit_emit8(jb, disp); /* movups xmm1, [r10 + rax * s + disp] */
+    if (vector_prefix) EMIT(0x66);
+    EMIT(0x0F); sl_jit_emit8(jb, vector_op); EMIT(0xC1);                                               /* op xmm0, xmm1 */
+    EMIT(0x41, 0x0F, 0x11, 0x44); sl_jit_emit8(jb, (uint8_t)(scale_bits | 0x00)); sl_jit_emit8(jb, disp); /* movups [r8 + rax * s + disp], xmm0 */
+  }
+  EMIT(0x49, 0xC1, 0xEB, 0x38);                         /* shr r11, 56 */
+  EMIT(0x0F, 0x84); to_done_vector = sl_jit_emit_rel32(jb); /* jz done */
+  EMIT(0x42, 0x8D, 0x44, 0x18, 0x07);                   /* lea eax, [rax + r11 + 7] */
+  EMIT(0xE9); to_loop = sl_jit_emit_rel32(jb);          /* jmp loop */
+  sl_jit_patch32(jb, to_loop, (uint32_t)(loop - (to_loop + 4)));
+
+  /* scalar: */
+  sl_jit_bind(jb, to_scalar_unaligned);
+  sl_jit_bind(jb, to_scalar_partial);
+  sl_jit_emit(jb, scalar_op, scalar_op_size);
+  EMIT(0x41, 0x0F, 0xB6, 0x0C, 0x04);                   /* movzx ecx, byte [r12 + rax] */
+  EMIT(0x85, 0xC9);                                     /* test ecx, ecx */
+  EMIT(0x0F, 0x84); to_done_scalar = sl_jit_emit_rel32(jb); /* jz done */
+  EMIT(0x01, 0xC8);                                     /* add eax, ecx */
+  EMIT(0xE9); to_loop = sl_jit_emit_rel32(jb);          /* jmp loop */
+  sl_jit_patch32(jb, to_loop, (uint32_t)(loop - (to_loop + 4)));
+
+  /* done: */
+  sl_jit_bind(jb, to_done_vector);
+  sl_jit_bind(jb, to_done_scalar);
+  if (jb->avx2_) {
+    /* Avoid the AVX-SSE transition penalty in the (SSE) code that follows */
+    EMIT(0xC5, 0xF8, 0x77);     /* vzeroupper */
+  }
+}
+
+/* Emits the inline form of the arithmetic instructions the JIT translates natively (float add, subtract, multiply
+ * and divide, integer add and subtract), returns 0 if the instruction is not one of them. Expects the chain in eax,
+ * known not to be empty. */
+static int sl_jit_emit_inline_kernel(struct sl_jit_builder *jb, const int *pc) {
+  /* scalar operations on row rax, r8: result column, r9: left, r10: right */
+  static const uint8_t movss_load[] = { 0xF3, 0x41, 0x0F, 0x10, 0x04, 0x81 };  /* movss xmm0, [r9 + rax * 4] */
+  static const uint8_t movss_store[] = { 0xF3, 0x41, 0x0F, 0x11, 0x04, 0x80 }; /* movss [r8 + rax * 4], xmm0 */
+  uint8_t scalar_op[18];
+  const int *args = pc + 3; /* result, left, right */
+  int base;
+  int element_size, vector_prefix;
+  uint8_t vector_op, rex, sib_scale;
+  size_t scalar_op_size = 0;
+
+#if SL_EXEC_CHAIN_MAX_NUM_ROWS > 256
+  /* The loop reads the chain as bytes; wider chains use the kernels instead */
+  return 0;
+#endif
+
+  switch (pc[0]) {
+    case SLIR_ADD_F: vector_op = 0x58; break;
+    case SLIR_SUB_F: vector_op = 0x5C; break;
+    case SLIR_MUL_F: vector_op = 0x59; break;
+    case SLIR_DIV_F: vector_op = 0x5E; break;
+#if SL_EXEC_INT_REG_BITS == 64
+    case SLIR_ADD_I: vector_op = 0xD4; break; /* paddq */
+    case SLIR_SUB_I: vector_op = 0xFB; break; /* psubq */
+#else
+    case SLIR_ADD_I: vector_op = 0xFE; break; /* paddd */
+    case SLIR_SUB_I: vector_op = 0xFA; break; /* psubd */
+#endif
+    default:
+      return 0;
+  }
+
+  switch (pc[0]) {
+    case SLIR_ADD_F:
+    case SLIR_SUB_F:
+    case SLIR_MUL_F:
+    case SLIR_DIV_F:
+      base = 13; /* r13, float_regs_ */
+      element_size = 4;
+      vector_prefix = 0;
+      memcpy(scalar_op, movss_load, sizeof(movss_load));
+      scalar_op_size = sizeof(movss_load);
+      /* opss xmm0, [r10 + rax * 4] */
+      scalar_op[scalar_op_size++] = 0xF3;
+      scalar_op[scalar_op_size++] = 0x41;
+      scalar_op[scalar_op_size++] = 0x0F;
+      scalar_op[scalar_op_size++] = vector_op;
+      scalar_op[scalar_op_size++] = 0x04;
+      scalar_op[scalar_op_size++] = 0x82;
+      memcpy(scalar_op + scalar_op_size, movss_store, sizeof(movss_store));
+      scalar_op_size += sizeof(movss_store);
+      break;
+    default:
+      base = 5; /* rbp, int_regs_ */
+      element_size = (int)sizeof(sl_exec_int_t);
+      vector_prefix = 1;
+      /* REX.W selects rcx over ecx and SIB scale 8 over 4 for 64-bit registers */
+      rex = (element_size == 8) ? 0x49 : 0x41;
+      sib_scale = (element_size == 8) ? 0xC0 : 0x80;
+      /* mov rcx, [r9 + rax * 8] (or mov ecx, [r9 + rax * 4]) */
+      scalar_op[scalar_op_size++] = rex;
+      scalar_op[scalar_op_size++] = 0x8B;
+      scalar_op[scalar_op_size++] = 0x0C;
+      scalar_op[scalar_op_size++] = (uint8_t)(sib_scale | 0x01);
+      /* add/sub rcx, [r10 + rax * 8] */
+      scalar_op[scalar_op_size++] = rex;
+      scalar_op[scalar_op_size++] = (pc[0] == SLIR_ADD_I) ? 0x03 : 0x2B;
+      scalar_op[scalar_op_size++] = 0x0C;
+      scalar_op[scalar_op_size++] = (uint8_t)(sib_scale | 0x02);
+      /* mov [r8 + rax * 8], rcx */
+      scalar_op[scalar_op_size++] = rex;
+      scalar_op[scalar_op_size++] = 0x89;
+      scalar_op[scalar_op_size++] = 0x0C;
+      scalar_op[scalar_op_size++] = (uint8_t)(sib_scale | 0x00);
+      break;
+  }
+
+  sl_jit_emit_load_column(jb, 8, base, args[0]);
+  sl_jit_emit_load_column(jb, 9, base, args[1]);
+  sl_jit_emit_load_column(jb, 10, base, args[2]);
+  sl_jit_emit_binop_loop(jb, element_size, vector_prefix, vector_op, scalar_op, scalar_op_size);
+  return 1;
+}
+
+static void sl_jit_emit_instr(struct sl_jit_builder *jb, const int *pc, size_t epilogue_fixup_target) {
+  const int *args = pc + 2;
+  switch (pc[0]) {
+    case GIR_MOVE:
+      if (args[1] >= 0) {
+        sl_jit_emit_load_chain(jb, args[1]);
+      }
+      else {
+        EMIT(0xB8); sl_jit_emit32(jb, (uint32_t)args[2]); /* mov eax, imm32 */
+      }
+      sl_jit_emit_store_chain(jb, args[0]);
+      break;
+    case GIR_JUMP:
+      EMIT(0xE9); sl_jit_emit_rel32_to_bytecode(jb, (size_t)args[0]);
+      break;
+    case GIR_BRANCH_NOT_EQUAL:
+      EMIT(0x81, 0xBB); sl_jit_emit32(jb, (uint32_t)(args[0] * 4)); sl_jit_emit32(jb, (uint32_t)args[1]); /* cmp dword [rbx + chain * 4], imm32 */
+      EMIT(0x0F, 0x85); sl_jit_emit_rel32_to_bytecode(jb, (size_t)args[2]); /* jne */
+      EMIT(0xE9); sl_jit_emit_rel32_to_bytecode(jb, (size_t)args[3]);       /* jmp */
+      break;
+    case GIR_RETURN:
+      EMIT(0xE9); sl_jit_emit_rel32_to_bytecode(jb, epilogue_fixup_target);
+      break;
+    case SLIR_SPLIT_EXEC_CHAIN_BY_CONDITION:
+    case SLIR_SPLIT_EXEC_CHAIN_BY_UNIFORM_CONDITION:
+    case SLIR_JOIN_EXEC_CHAINS:
+      if (jb->profile_) {
+        EMIT(0xB8); sl_jit_emit32(jb, (uint32_t)SL_EXEC_NO_CHAIN); /* mov eax, imm32 */
+        sl_jit_emit_call_thunk(jb, sl_jit_profile_enter_thunk, pc);
+      }
+      sl_jit_emit_call_thunk(jb, sl_jit_chain_thunk, pc);
+      if (jb->profile_) sl_jit_emit_call_thunk(jb, sl_jit_profile_leave_thunk, pc);
+      break;
+    case SLBC_COMPACT:
+      /* The kernels that follow run as they are */
+      break;
+    default: {
+      size_t to_skip;
+      /* Kernel; skip if the chain is empty */
+      sl_jit_emit_load_chain(jb, args[0]);
+      EMIT(0x83, 0xF8, 0xFF);                                /* cmp eax, -1 */
+      EMIT(0x0F, 0x84); to_skip = sl_jit_emit_rel32(jb);    /* je skip */
+      if (jb->profile_) {
+        /* The thunk takes the chain in eax, and does not preserve it */
+        sl_jit_emit_call_thunk(jb, sl_jit_profile_enter_thunk, pc);
+        sl_jit_emit_load_chain(jb, args[0]);
+      }
+      if (!sl_jit_emit_inline_kernel(jb, pc)) {
+        const char *banks;
+        sl_bytecode_kernel_fn_t fn = sl_bytecode_direct_kernel(pc[0], &banks);
+        if (fn) sl_jit_emit_call_kernel(jb, fn, banks, pc);
+        else sl_jit_emit_call_thunk(jb, sl_jit_kernel_thunk, pc);
+      }
+      if (jb->profile_) sl_jit_emit_call_thunk(jb, sl_jit_profile_leave_thunk, pc);
+      sl_jit_bind(jb, to_skip);
+      break;
+    }
+  }
+}
+
+int sl_jit_compile(struct sl_jit *jit, struct sl_bytecode *bc, int profile) {
+  struct sl_jit_builder builder;
+  struct sl_jit_builder *jb = &builder;
+  size_t pc, n;
+  void *mem = NULL;
+  int r = 0;
+
+  sl_jit_cleanup(jit);
+  if (!sl_jit_host_supported()) return -1;
+  if (!bc->f_ || !bc->num_code_) return -1;
+
+  memset(jb, 0, sizeof(*jb));
+  /* The selected SIMD level only reaches AVX2 if the host and OS support it, and lowering it with AEX_SL_SIMD
+   * keeps the JIT on SSE2 as well. */
+  jb->avx2_ = sl_simd_level() >= SLSIMD_AVX2;
+  jb->profile_ = profile;
+  /* One extra entry for the epilogue, GIR_RETURN jumps to it as if it were a bytecode offset */
+  jb->native_offsets_ = (size_t *)malloc(sizeof(size_t) * (bc->num_code_ + 1));
+  if (!jb->native_offsets_) return -1;
+  for (pc = 0; pc <= bc->num_code_; ++pc) {
+    jb->native_offsets_[pc] = SIZE_MAX;
+  }
+
+  /* Prologue; 6 pushes + SL_JIT_FRAME_SIZE keeps rsp 16 byte aligned at calls, and leaves room for the 32 bytes
+   * of shadow space the Windows x64 ABI requires and the stack arguments of the kernels. */
+  EMIT(0x53);                   /* push rbx */
+  EMIT(0x55);                   /* push rbp */
+  EMIT(0x41, 0x54);             /* push r12 */
+  EMIT(0x41, 0x55);             /* push r13 */
+  EMIT(0x41, 0x56);             /* push r14 */
+  EMIT(0x41, 0x57);             /* push r15 */
+  EMIT(0x48, 0x83, 0xEC, SL_JIT_FRAME_SIZE); /* sub rsp, SL_JIT_FRAME_SIZE */
+#ifdef _WIN32
+  EMIT(0x49, 0x89, 0xCE);       /* mov r14, rcx */
+  EMIT(0x49, 0x89, 0xD7);       /* mov r15, rdx */
+  EMIT(0x4C, 0x89, 0xC3);       /* mov rbx, r8 */
+#else
+  EMIT(0x49, 0x89, 0xFE);       /* mov r14, rdi */
+  EMIT(0x49, 0x89, 0xF7);       /* mov r15, rsi */
+  EMIT(0x48, 0x89, 0xD3);       /* mov rbx, rdx */
+#endif
+  EMIT(0x4D, 0x8B, 0xA7); sl_jit_emit32(jb, (uint32_t)offsetof(struct sl_execution, exec_chain_reg_)); /* mov r12, [r15 + ..] */
+  EMIT(0x4D, 0x8B, 0xAF); sl_jit_emit32(jb, (uint32_t)offsetof(struct sl_execution, float_regs_));    /* mov r13, [r15 + ..] */
+  EMIT(0x49, 0x8B, 0xAF); sl_jit_emit32(jb, (uint32_t)offsetof(struct sl_execution, int_regs_));      /* mov rbp, [r15 + ..] */
+
+  for (pc = 0; pc < bc->num_code_; pc += 2 + (size_t)bc->code_[pc + 1]) {
+    jb->native_offsets_[pc] = jb->num_code_;
+    sl_jit_emit_instr(jb, bc->code_ + pc, bc->num_code_);
+  }
+
+  /* Epilogue */
+  jb->native_offsets_[bc->num_code_] = jb->num_code_;
+  EMIT(0x48, 0x83, 0xC4, SL_JIT_FRAME_SIZE); /* add rsp, SL_JIT_FRAME_SIZE */
+  EMIT(0x41, 0x5F);             /* pop r15 */
+  EMIT(0x41, 0x5E);             /* pop r14 */
+  EMIT(0x41, 0x5D);             /* pop r13 */
+  EMIT(0x41, 0x5C);             /* pop r12 */
+  EMIT(0x5D);                   /* pop rbp */
+  EMIT(0x5B);                   /* pop rbx */
+  EMIT(0xC3);                   /* ret */
+
+  r = jb->failed_ ? -1 : 0;
+  for (n = 0; !r && (n < jb->num_fixups_); ++n) {
+    size_t pos = jb->fixups_[n].pos_;
+    if ((jb->fixups_[n].target_ > bc->num_code_) || (jb->native_offsets_[jb->fixups_[n].target_] == SIZE_MAX)) {
+      /* Branch into the middle of an instruction, the bytecode is malformed */
+      r = -1;
+      break;
+    }
+    sl_jit_patch32(jb, pos, (uint32_t)(jb->native_offsets_[jb->fixups_[n].target_] - (pos + 4)));
+  }
+
+  if (!r) {
+#ifdef _WIN32
+    DWORD old_protect;
+    mem = VirtualAlloc(NULL, jb->num_code_, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+    if (!mem) r = -1;
+    if (!r) {
+      memcpy(mem, jb->code_, jb->num_code_);
+      if (!VirtualProtect(mem, jb->num_code_, PAGE_EXECUTE_READ, &old_protect)) {
+        VirtualFree(mem, 0, MEM_RELEASE);
+        r = -1;
+      }
+      else {
+        FlushInstructionCache(GetCurrentProcess(), mem, jb->num_code_);
+      }
+    }
+#else
+    mem = mmap(NULL, jb->num_code_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED) r = -1;
+    if (!r) {
+      memcpy(mem, jb->code_, jb->num_code_);
+      if (mprotect(mem, jb->num_code_, PROT_READ | PROT_EXEC)) {
+        munmap(mem, jb->num_code_);
+        r = -1;
+      }
+    }
+#endif
+  }
+  if (!r) {
+    jit->bc_ = bc;
+    jit->code_ = mem;
+    jit->code_size_ = jb->num_code_;
+  }
+
+  if (jb->code_) free(jb->code_);
+  if (jb->fixups_) free(jb->fixups_);
+  if (jb->native_offsets_) free(jb->native_offsets_);
+  return r;
+}
+
+#undef EMIT
+
+int sl_jit_run(struct sl_jit *jit, struct sl_execution *exec, uint32_t exec_chain, uint32_t *psurvivors, uint32_t *pdiscarded) {
+  struct sl_bytecode *bc = jit->bc_;
+  size_t n;
+  if (!jit->code_ || !exec->num_execution_frames_) return -1;
+  if (sl_bytecode_reserve_chains(bc, exec)) return -1;
+
+  for (n = 0; n < bc->num_chains_; ++n) {
+    exec->bc_chains_[n] = SL_EXEC_NO_CHAIN;
+  }
+  exec->bc_chains_[bc->exec_chain_] = exec_chain;
+  exec->bc_profile_source_ = NULL;
+
+  ((sl_jit_fn_t)jit->code_)(bc, exec, exec->bc_chains_);
+
+  *psurvivors = exec->bc_chains_[bc->exec_chain_];
+  *pdiscarded = exec->bc_chains_[bc->discard_chain_];
+  return 0;
+}
+
+#else /* !SL_JIT_AVAILABLE */
+
+int sl_jit_compile(struct sl_jit *jit, struct sl_bytecode *bc, int profile) {
+  return -1;
+}
+
+int sl_jit_run(struct sl_jit *jit, struct sl_execution *exec, uint32_t exec_chain, uint32_t *psurvivors, uint32_t *pdiscarded) {
+  return -1;
+}
+
+#endif
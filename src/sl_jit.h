@@ -0,0 +1,77 @@
+/* Copyright 2024 Kinglet B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SL_JIT_H
+#define SL_JIT_H
+
+#ifndef STDINT_H_INCLUDED
+#define STDINT_H_INCLUDED
+#include <stdint.h>
+#endif
+
+#ifndef STDDEF_H_INCLUDED
+#define STDDEF_H_INCLUDED
+#include <stddef.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The JIT is only available when building for x86-64 */
+#if defined(_M_X64) || defined(__x86_64__)
+#define SL_JIT_AVAILABLE 1
+#else
+#define SL_JIT_AVAILABLE 0
+#endif
+
+struct sl_execution;
+struct sl_bytecode;
+
+/* Native x86-64 code generated from a struct sl_bytecode. Control flow and chain moves are translated
+ * inline; float add, subtract, multiply and divide and integer add and subtract are emitted as loops over
+ * the rows of the chain (AVX and AVX2 if the selected SIMD level, see sl_simd_level(), is at least
+ * SLSIMD_AVX2, SSE2 otherwise), and the other kernels whose operands are all register columns become direct
+ * calls into them (which in turn pick their SIMD variant.) Splitting and joining chains, builtin calls,
+ * register moves, matrix products, the uniform scalar SLBC_XXX instructions and the remaining kernels
+ * still go through sl_bytecode_exec_kernel() and sl_bytecode_exec_chain_instr(). */
+struct sl_jit {
+  /* Bytecode the code was generated from; it is referenced by the native code and must outlive it. */
+  struct sl_bytecode *bc_;
+
+  /* Executable pages holding the code */
+  void *code_;
+  size_t code_size_;
+};
+
+void sl_jit_init(struct sl_jit *jit);
+void sl_jit_cleanup(struct sl_jit *jit);
+
+/* Returns non-zero if the host supports the instructions emitted by the JIT. */
+int sl_jit_host_supported(void);
+
+/* Generates native code for bc; if profile is non-zero, the code calls sl_bytecode_profile_enter() and
+ * sl_bytecode_profile_leave() around each kernel and chain instruction so the runs are charged to the source
+ * (see sl_execution::profile_.) Returns 0 upon success, non-zero if the JIT is not available
+ * for this host, or upon failure; the caller is expected to fall back to sl_bytecode_run(). */
+int sl_jit_compile(struct sl_jit *jit, struct sl_bytecode *bc, int profile);
+
+/* Runs the native code, same semantics as sl_bytecode_run(). */
+int sl_jit_run(struct sl_jit *jit, struct sl_execution *exec, uint32_t exec_chain, uint32_t *psurvivors, uint32_t *pdiscarded);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* SL_JIT_H */
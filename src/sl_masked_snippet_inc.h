@@ -0,0 +1,65 @@
+/* Copyright 2024 Kinglet B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* file is intended to be included at sites where a masked float operation snippet
+ * is desired, not compiled on its own
+ * Prior to including the snippet, you should define:
+ * #define MASKED_SNIPPET_OPERATOR(row) <<your operator here, evaluated for row>>
+ * 
+ * For instance:
+ * #define MASKED_SNIPPET_OPERATOR(row) left_column[row] + right_column[row]
+ *
+ * It assumes the following variables/parameters are in scope:
+ * mask: of type "const uint64_t * restrict"; SL_EXEC_CHAIN_MAX_NUM_ROWS bits, one for each row to execute
+ * result_column: of type "float * restrict"; points to the destination
+ *
+ * Every block of 8 rows with any row in the mask is computed in full and stored under the mask, so the
+ * operator must be safe to evaluate for the arbitrary values of the rows outside of it.
+ *
+ * Optionally, define:
+ * #define MASKED_SNIPPET_SIMD_KERNEL <<kernel function pointer, see struct sl_simd_kernels>>
+ * #define MASKED_SNIPPET_SIMD_ARGS <<operand columns passed to the kernel after mask and result_column>>
+ * in which case the kernel is called instead of the generic code below if it is not NULL.
+ */
+
+#ifdef MASKED_SNIPPET_SIMD_KERNEL
+if (MASKED_SNIPPET_SIMD_KERNEL) {
+  MASKED_SNIPPET_SIMD_KERNEL(mask, result_column, MASKED_SNIPPET_SIMD_ARGS);
+}
+else
+#endif
+{
+  int block;
+  for (block = 0; block < (SL_EXEC_CHAIN_MAX_NUM_ROWS / 8); ++block) {
+    uint8_t bits = (uint8_t)(mask[block >> 3] >> ((block & 7) * 8));
+    int row = block * 8;
+    int n;
+    if (bits == 0xFF) {
+      /* Try to elicit 8-wise SIMD instructions from auto-vectorization, e.g. AVX's VMULPS ymm0, ymm1, ymm2 */
+      for (n = 0; n < 8; n++) {
+        result_column[row + n] = MASKED_SNIPPET_OPERATOR(row + n);
+      }
+    }
+    else if (bits) {
+      float values[8];
+      for (n = 0; n < 8; n++) {
+        values[n] = MASKED_SNIPPET_OPERATOR(row + n);
+      }
+      for (n = 0; n < 8; n++) {
+        if (bits & (1 << n)) result_column[row + n] = values[n];
+      }
+    }
+  }
+}
@@ -24,7 +24,7 @@
  * #define OCTONOP_SNIPPET_TYPE float
  *
  * It assumes the following variables/parameters are in scope:
- * chain_column: of type "const uint8_t * restrict"; points to the chain column
+ * chain_column: of type "const sl_exec_row_t * restrict"; points to the chain column
  * result_column: of type "OCTONOP_SNIPPET_TYPE * restrict"; points to the destination
  * first_column: of type "const OCTONOP_SNIPPET_TYPE * restrict"; points to the first operand
  * second_column: of type "const OCTONOP_SNIPPET_TYPE * restrict"; points to the second operand
@@ -42,10 +42,9 @@
 #endif
 
 for (;;) {
-  uint64_t chain;
-  uint8_t delta;
+  sl_exec_row_t delta;
 
-  if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+  if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
     do {
       OCTONOP_SNIPPET_RESULT_TYPE *restrict result = result_column + row;
       const OCTONOP_SNIPPET_TYPE *restrict first = first_column + row;
@@ -62,12 +61,12 @@ for (;;) {
         result[n] = OCTONOP_SNIPPET_OPERATOR((first[n]), (second[n]), (third[n]), (fourth[n]), (fifth[n]), (sixth[n]), (seventh[n]), (eighth[n]));
       }
 
-      delta = (chain & 0xFF00000000000000) >> 56;
+      delta = chain_column[row + 7];
       if (!delta) break;
       row += 7 + delta;
-    } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+    } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
   }
-  else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+  else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
     do {
       OCTONOP_SNIPPET_RESULT_TYPE *restrict result = result_column + row;
       const OCTONOP_SNIPPET_TYPE *restrict first = first_column + row;
@@ -83,10 +82,10 @@ for (;;) {
       for (n = 0; n < 4; n++) {
         result[n] = OCTONOP_SNIPPET_OPERATOR((first[n]), (second[n]), (third[n]), (fourth[n]), (fifth[n]), (sixth[n]), (seventh[n]), (eighth[n]));
       }
-      delta = (chain & 0xFF000000) >> 24;
+      delta = chain_column[row + 3];
       if (!delta) break;
       row += 3 + delta;
-    } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+    } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
   }
   else {
     do {
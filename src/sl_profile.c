@@ -0,0 +1,322 @@
+/* Copyright 2024 Kinglet B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef STDLIB_H_INCLUDED
+#define STDLIB_H_INCLUDED
+#include <stdlib.h>
+#endif
+
+#ifndef STRING_H_INCLUDED
+#define STRING_H_INCLUDED
+#include <string.h>
+#endif
+
+#ifndef INTTYPES_H_INCLUDED
+#define INTTYPES_H_INCLUDED
+#include <inttypes.h>
+#endif
+
+#ifndef TIME_H_INCLUDED
+#define TIME_H_INCLUDED
+#include <time.h>
+#endif
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(_M_IX86) || defined(__i386__)
+#define SL_PROFILE_RDTSC 1
+#ifdef _MSC_VER
+#ifndef INTRIN_H_INCLUDED
+#define INTRIN_H_INCLUDED
+#include <intrin.h>
+#endif
+#else
+#ifndef X86INTRIN_H_INCLUDED
+#define X86INTRIN_H_INCLUDED
+#include <x86intrin.h>
+#endif
+#endif
+#else
+#define SL_PROFILE_RDTSC 0
+#endif
+
+#ifndef SL_PROFILE_H_INCLUDED
+#define SL_PROFILE_H_INCLUDED
+#include "sl_profile.h"
+#endif
+
+#ifndef SITUS_H_INCLUDED
+#define SITUS_H_INCLUDED
+#include "pp/situs.h"
+#endif
+
+void sl_profile_init(struct sl_profile *prof) {
+  prof->num_runs_ = 0;
+  prof->num_nodes_ = prof->num_nodes_allocated_ = 0;
+  prof->nodes_ = NULL;
+  prof->hash_size_ = 0;
+  prof->hash_ = NULL;
+  prof->name_ = NULL;
+  prof->source_length_ = 0;
+  prof->source_ = NULL;
+}
+
+void sl_profile_cleanup(struct sl_profile *prof) {
+  if (prof->nodes_) free(prof->nodes_);
+  if (prof->hash_) free(prof->hash_);
+  if (prof->name_) free(prof->name_);
+  if (prof->source_) free(prof->source_);
+}
+
+int sl_profile_set_source(struct sl_profile *prof, const char *name, const char *source, size_t source_length) {
+  size_t name_len = strlen(name);
+  char *new_name = (char *)malloc(name_len + 1);
+  char *new_source = (char *)malloc(source_length + 1);
+  if (!new_name || !new_source) {
+    if (new_name) free(new_name);
+    if (new_source) free(new_source);
+    return -1;
+  }
+  memcpy(new_name, name, name_len + 1);
+  if (source_length) memcpy(new_source, source, source_length);
+  new_source[source_length] = '\0';
+
+  sl_profile_cleanup(prof);
+  sl_profile_init(prof);
+  prof->name_ = new_name;
+  prof->source_ = new_source;
+  prof->source_length_ = source_length;
+  return 0;
+}
+
+uint64_t sl_profile_cycles(void) {
+#if SL_PROFILE_RDTSC
+  return (uint64_t)__rdtsc();
+#else
+  return (uint64_t)clock();
+#endif
+}
+
+static size_t sl_profile_hash(const void *node, size_t hash_size) {
+  uint64_t h = (uint64_t)(uintptr_t)node;
+  h ^= h >> 33;
+  h *= 0xFF51AFD7ED558CCDULL;
+  h ^= h >> 33;
+  return (size_t)h & (hash_size - 1);
+}
+
+static int sl_profile_grow(struct sl_profile *prof) {
+  size_t new_num_allocated = prof->num_nodes_allocated_ * 2 + 64;
+  size_t new_hash_size = new_num_allocated * 2;
+  size_t n;
+  if ((new_num_allocated <= prof->num_nodes_allocated_) || (new_hash_size >= (SIZE_MAX / sizeof(struct sl_profile_node)))) {
+    /* overflow */
+    return -1;
+  }
+  /* hash_size_ a power of 2, at least twice the nodes */
+  n = 1;
+  while (n < new_hash_size) n <<= 1;
+  new_hash_size = n;
+
+  size_t *new_hash = (size_t *)calloc(new_hash_size, sizeof(size_t));
+  if (!new_hash) return -1;
+  struct sl_profile_node *new_nodes = (struct sl_profile_node *)realloc(prof->nodes_, new_num_allocated * sizeof(struct sl_profile_node));
+  if (!new_nodes) {
+    free(new_hash);
+    return -1;
+  }
+  prof->nodes_ = new_nodes;
+  prof->num_nodes_allocated_ = new_num_allocated;
+
+  if (prof->hash_) free(prof->hash_);
+  prof->hash_ = new_hash;
+  prof->hash_size_ = new_hash_size;
+  for (n = 0; n < prof->num_nodes_; ++n) {
+    size_t h = sl_profile_hash(prof->nodes_[n].node_, new_hash_size);
+    while (new_hash[h]) h = (h + 1) & (new_hash_size - 1);
+    new_hash[h] = n + 1;
+  }
+  return 0;
+}
+
+struct sl_profile_node *sl_profile_node(struct sl_profile *prof, const void *node, const struct situs *loc) {
+  return sl_profile_node_at_line(prof, node, loc ? situs_line(loc) : 0);
+}
+
+struct sl_profile_node *sl_profile_node_at_line(struct sl_profile *prof, const void *node, int line) {
+  size_t h;
+  if (prof->hash_size_) {
+    h = sl_profile_hash(node, prof->hash_size_);
+    while (prof->hash_[h]) {
+      struct sl_profile_node *pn = prof->nodes_ + prof->hash_[h] - 1;
+      if (pn->node_ == node) return pn;
+      h = (h + 1) & (prof->hash_size_ - 1);
+    }
+  }
+  if ((prof->num_nodes_ == prof->num_nodes_allocated_) || !prof->hash_size_) {
+    if (sl_profile_grow(prof)) return NULL;
+  }
+  h = sl_profile_hash(node, prof->hash_size_);
+  while (prof->hash_[h]) h = (h + 1) & (prof->hash_size_ - 1);
+  prof->hash_[h] = prof->num_nodes_ + 1;
+
+  struct sl_profile_node *pn = prof->nodes_ + prof->num_nodes_++;
+  memset(pn, 0, sizeof(*pn));
+  pn->node_ = node;
+  pn->line_ = line;
+  return pn;
+}
+
+void sl_profile_count_rows(struct sl_profile_node *pn, const sl_exec_row_t *chain_column, uint32_t chain) {
+  /* Same grouping as the loops in sl_binop_snippet_inc.h and friends */
+  sl_exec_row_t row = (sl_exec_row_t)chain;
+  sl_exec_row_t delta;
+  pn->invocations_++;
+  if (chain == SL_EXEC_NO_CHAIN) return;
+  for (;;) {
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
+      do {
+        pn->groups_of_8_++;
+        delta = chain_column[row + 7];
+        if (!delta) break;
+        row += 7 + delta;
+      } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
+    }
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
+      do {
+        pn->groups_of_4_++;
+        delta = chain_column[row + 3];
+        if (!delta) break;
+        row += 3 + delta;
+      } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
+    }
+    else {
+      do {
+        pn->scalars_++;
+        delta = chain_column[row];
+        if (!delta) break;
+        row += delta;
+      } while (row & 3);
+    }
+    if (!delta) break;
+  }
+  pn->rows_ = pn->groups_of_8_ * 8 + pn->groups_of_4_ * 4 + pn->scalars_;
+}
+
+/* First row in mask after row (or the first row if row is SIZE_MAX), SIZE_MAX if none */
+static size_t sl_profile_mask_next(const uint64_t *mask, size_t num_words, size_t row) {
+  size_t w;
+  uint64_t bits;
+  row = (row == SIZE_MAX) ? 0 : row + 1;
+  w = row / 64;
+  if (w >= num_words) return SIZE_MAX;
+  bits = mask[w] & (~(uint64_t)0 << (row & 63));
+  while (!bits) {
+    if (++w == num_words) return SIZE_MAX;
+    bits = mask[w];
+  }
+  row = w * 64;
+  while (!(bits & 1)) {
+    bits >>= 1;
+    row++;
+  }
+  return row;
+}
+
+/* Non-zero if the n rows (4 or 8) from row, which is aligned to n, are all in mask */
+static int sl_profile_mask_run(const uint64_t *mask, size_t row, int n) {
+  uint64_t run = (((uint64_t)1) << n) - 1;
+  return ((mask[row / 64] >> (row & 63)) & run) == run;
+}
+
+void sl_profile_count_mask(struct sl_profile_node *pn, const uint64_t *mask, size_t num_words) {
+  /* Mirrors sl_profile_count_rows() walking the equivalent chain */
+  size_t row = sl_profile_mask_next(mask, num_words, SIZE_MAX);
+  pn->invocations_++;
+  while (row != SIZE_MAX) {
+    if (!(row & 7) && sl_profile_mask_run(mask, row, 8)) {
+      do {
+        pn->groups_of_8_++;
+        row = sl_profile_mask_next(mask, num_words, row + 7);
+      } while ((row != SIZE_MAX) && !(row & 7) && sl_profile_mask_run(mask, row, 8));
+    }
+    else if (!(row & 3) && sl_profile_mask_run(mask, row, 4)) {
+      do {
+        pn->groups_of_4_++;
+        row = sl_profile_mask_next(mask, num_words, row + 3);
+      } while ((row != SIZE_MAX) && !(row & 3) && sl_profile_mask_run(mask, row, 4));
+    }
+    else {
+      do {
+        pn->scalars_++;
+        row = sl_profile_mask_next(mask, num_words, row);
+      } while ((row != SIZE_MAX) && (row & 3));
+    }
+  }
+  pn->rows_ = pn->groups_of_8_ * 8 + pn->groups_of_4_ * 4 + pn->scalars_;
+}
+
+static void sl_profile_dump_costs(FILE *fp, const struct sl_profile_node *costs, uint64_t total_cycles) {
+  if (!costs->invocations_ && !costs->cycles_) {
+    fprintf(fp, "%12s %6s %10s %12s %10s %10s %10s ", "", "", "", "", "", "", "");
+    return;
+  }
+  fprintf(fp, "%12" PRIu64 " %5.1f%% %10" PRIu64 " %12" PRIu64 " %10" PRIu64 " %10" PRIu64 " %10" PRIu64 " ",
+          costs->cycles_, total_cycles ? (100. * (double)costs->cycles_ / (double)total_cycles) : 0.,
+          costs->invocations_, costs->rows_, costs->groups_of_8_, costs->groups_of_4_, costs->scalars_);
+}
+
+void sl_profile_dump(const struct sl_profile *prof, FILE *fp) {
+  size_t num_lines = 1;
+  size_t n;
+  uint64_t total_cycles = 0;
+  const char *s;
+  for (n = 0; n < prof->source_length_; ++n) {
+    if (prof->source_[n] == '\n') num_lines++;
+  }
+  if (prof->source_length_ && (prof->source_[prof->source_length_ - 1] == '\n')) {
+    /* No line after the last newline */
+    num_lines--;
+  }
+  /* Costs per line, index 0 for nodes without a line in the source */
+  struct sl_profile_node *lines = (struct sl_profile_node *)calloc(num_lines + 1, sizeof(struct sl_profile_node));
+  if (!lines) return;
+  for (n = 0; n < prof->num_nodes_; ++n) {
+    const struct sl_profile_node *pn = prof->nodes_ + n;
+    struct sl_profile_node *ln = lines + (((pn->line_ > 0) && ((size_t)pn->line_ <= num_lines)) ? (size_t)pn->line_ : 0);
+    ln->invocations_ += pn->invocations_;
+    ln->rows_ += pn->rows_;
+    ln->groups_of_8_ += pn->groups_of_8_;
+    ln->groups_of_4_ += pn->groups_of_4_;
+    ln->scalars_ += pn->scalars_;
+    ln->cycles_ += pn->cycles_;
+    total_cycles += pn->cycles_;
+  }
+
+  fprintf(fp, "Profile of %s: %" PRIu64 " runs, %" PRIu64 " cycles\n", prof->name_ ? prof->name_ : "shader", prof->num_runs_, total_cycles);
+  fprintf(fp, "%5s %12s %6s %10s %12s %10s %10s %10s | %s\n", "line", "cycles", "%", "calls", "rows", "x8", "x4", "x1", "source");
+  s = prof->source_ ? prof->source_ : "";
+  for (n = 1; n <= num_lines; ++n) {
+    size_t len = strcspn(s, "\n");
+    fprintf(fp, "%5d ", (int)n);
+    sl_profile_dump_costs(fp, lines + n, total_cycles);
+    fprintf(fp, "| %.*s\n", (int)len, s);
+    s += len;
+    if (*s) s++;
+  }
+  if (lines[0].invocations_ || lines[0].cycles_) {
+    fprintf(fp, "%5s ", "-");
+    sl_profile_dump_costs(fp, lines, total_cycles);
+    fprintf(fp, "| (no source line)\n");
+  }
+  free(lines);
+}
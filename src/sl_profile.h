@@ -0,0 +1,115 @@
+/* Copyright 2024 Kinglet B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SL_PROFILE_H
+#define SL_PROFILE_H
+
+#ifndef STDIO_H_INCLUDED
+#define STDIO_H_INCLUDED
+#include <stdio.h>
+#endif
+
+#ifndef STDINT_H_INCLUDED
+#define STDINT_H_INCLUDED
+#include <stdint.h>
+#endif
+
+#ifndef STDDEF_H_INCLUDED
+#define STDDEF_H_INCLUDED
+#include <stddef.h>
+#endif
+
+#ifndef SL_EXECUTION_H_INCLUDED
+#define SL_EXECUTION_H_INCLUDED
+#include "sl_execution.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Hot-spot profile of a shader: what each sl_expr and sl_stmt node of the AST costs as the shader runs, and, for
+ * the listing, the line of source it came from. Enabled per shader by the AEX_SL_PROFILE environment variable,
+ * see sl_execution::profile_.
+ * Executors report each visit of a node through sl_profile_node(); the AST walker visits the nodes themselves,
+ * the bytecode and the JIT report the node each instruction was generated from (see sl_bytecode_source.) The
+ * rows a node ran for are counted in groups the way the snippet kernels take them (runs of 8 rows aligned to 8,
+ * runs of 4 aligned to 4, single rows.) */
+
+struct situs;
+
+struct sl_profile_node {
+  /* The sl_expr or sl_stmt; only used as a key, the profile may outlive the AST */
+  const void *node_;
+
+  /* Line of the node in the source, 0 if unknown */
+  int line_;
+
+  uint64_t invocations_;  /* times the node ran, for one or more rows */
+  uint64_t rows_;         /* rows it ran for, summed over the invocations */
+  uint64_t groups_of_8_;  /* ..of which in 8-wide groups */
+  uint64_t groups_of_4_;  /* ..of which in 4-wide groups */
+  uint64_t scalars_;      /* ..of which one row at a time */
+  uint64_t cycles_;       /* timestamp counter cycles spent on the node, see sl_profile_cycles() */
+};
+
+struct sl_profile {
+  /* Number of times the shader ran (one per batch of rows) */
+  uint64_t num_runs_;
+
+  /* Nodes seen, and an open addressing hash table of (index + 1) into nodes_, hash_size_ is a power of 2 */
+  size_t num_nodes_;
+  size_t num_nodes_allocated_;
+  struct sl_profile_node *nodes_;
+  size_t hash_size_;
+  size_t *hash_;
+
+  /* Name and copy of the source the nodes are from, for the listing */
+  char *name_;
+  size_t source_length_;
+  char *source_;
+};
+
+void sl_profile_init(struct sl_profile *prof);
+void sl_profile_cleanup(struct sl_profile *prof);
+
+/* Clears the counts, and replaces the source with a copy of source_length bytes at source; returns 0 upon
+ * success, non-zero if out of memory. */
+int sl_profile_set_source(struct sl_profile *prof, const char *name, const char *source, size_t source_length);
+
+/* Current value of the timestamp counter (RDTSC) where available, otherwise of clock() */
+uint64_t sl_profile_cycles(void);
+
+/* Returns the costs of node, adding them if the node was not seen before, taking its line from loc (which
+ * may be NULL.) Returns NULL if out of memory. */
+struct sl_profile_node *sl_profile_node(struct sl_profile *prof, const void *node, const struct situs *loc);
+
+/* As sl_profile_node(), taking the line of the node rather than its location */
+struct sl_profile_node *sl_profile_node_at_line(struct sl_profile *prof, const void *node, int line);
+
+/* Counts an invocation of pn for the rows in chain */
+void sl_profile_count_rows(struct sl_profile_node *pn, const sl_exec_row_t *chain_column, uint32_t chain);
+
+/* Counts an invocation of pn for the rows in mask, num_words words of 64 rows each, grouped as
+ * sl_profile_count_rows() groups the chain of the same rows. */
+void sl_profile_count_mask(struct sl_profile_node *pn, const uint64_t *mask, size_t num_words);
+
+/* Writes the source, each line annotated with the costs of the nodes on it. */
+void sl_profile_dump(const struct sl_profile *prof, FILE *fp);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* SL_PROFILE_H */
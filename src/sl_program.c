@@ -58,6 +58,16 @@
 #include "sl_uniforms.h"
 #endif
 
+#ifndef SL_AOT_H_INCLUDED
+#define SL_AOT_H_INCLUDED
+#include "sl_aot.h"
+#endif
+
+#ifndef SL_IR_OPT_H_INCLUDED
+#define SL_IR_OPT_H_INCLUDED
+#include "sl_ir_opt.h"
+#endif
+
 
 void sl_program_init(struct sl_program *prog) {
   sl_info_log_init(&prog->log_);
@@ -77,10 +87,16 @@ void sl_program_init(struct sl_program *prog) {
   abt_init(&prog->abt_);
   attrib_routing_init(&prog->ar_);
   sl_uniform_table_init(&prog->uniforms_);
+  prog->uniforms_loaded_version_ = 0;
+  prog->loading_tables_loaded_version_ = 0;
+  prog->uniforms_loaded_ = 0;
   prog->gl_last_link_status_ = 0;
 }
 
 void sl_program_cleanup(struct sl_program *prog) {
+  /* Shaders may outlive us, don't leave them referencing us as holding our uniforms */
+  if (prog->vertex_shader_ && (prog->vertex_shader_->exec_.uniforms_owner_ == prog)) prog->vertex_shader_->exec_.uniforms_owner_ = NULL;
+  if (prog->fragment_shader_ && (prog->fragment_shader_->exec_.uniforms_owner_ == prog)) prog->fragment_shader_->exec_.uniforms_owner_ = NULL;
   sl_info_log_cleanup(&prog->log_);
   primitive_assembly_cleanup(&prog->pa_);
   clipping_stage_cleanup(&prog->cs_);
@@ -207,10 +223,35 @@ void sl_program_detach_shader(struct sl_program *prog, struct sl_shader *sh) {
   }
 }
 
+/* Allocates the register slab of a shader after sl_exec_prep(), and reports its size, against what it would have
+ * been without register allocation, in the info log. */
+static int sl_program_allocate_registers(struct sl_program *prog, const char *stage, struct sl_shader *shader) {
+  struct sl_exec_call_graph_results counts;
+  size_t num_rows, num_rows_before;
+  sl_exec_get_register_counts(&shader->exec_, &counts);
+  num_rows = sl_exec_batch_num_rows(&counts, shader->exec_.batch_cache_budget_);
+  num_rows_before = sl_exec_batch_num_rows(&shader->cu_.register_counts_, shader->exec_.batch_cache_budget_);
+  dx_printf(&prog->log_.dx_, "%s shader register slab: %zu bytes (%zu rows) before register allocation, %zu bytes (%zu rows) after\n",
+            stage, sl_exec_row_size(&shader->cu_.register_counts_) * num_rows_before, num_rows_before,
+            sl_exec_row_size(&counts) * num_rows, num_rows);
+  return sl_exec_allocate_registers_by_slab(&shader->exec_, num_rows);
+}
+
+/* Reports the superinstructions formed for a shader (see SL_IR_OPT_FUSE) in the info log. */
+static void sl_program_report_fusions(struct sl_program *prog, const char *stage, struct sl_shader *shader) {
+  struct sl_execution *exec = &shader->exec_;
+  dx_printf(&prog->log_.dx_, "%s shader superinstructions: %zu %s, %zu %s, %zu %s, %zu %s\n", stage,
+            sl_exec_num_fused(exec, SL_IR_OPT_FUSED_MAD), sl_ir_opt_fusion_name(SL_IR_OPT_FUSED_MAD),
+            sl_exec_num_fused(exec, SL_IR_OPT_FUSED_LERP), sl_ir_opt_fusion_name(SL_IR_OPT_FUSED_LERP),
+            sl_exec_num_fused(exec, SL_IR_OPT_FUSED_DOT_MAX), sl_ir_opt_fusion_name(SL_IR_OPT_FUSED_DOT_MAX),
+            sl_exec_num_fused(exec, SL_IR_OPT_FUSED_DOT_CLAMP), sl_ir_opt_fusion_name(SL_IR_OPT_FUSED_DOT_CLAMP));
+}
+
 int sl_program_link(struct sl_program *prog) {
   int r;
 
   prog->gl_last_link_status_ = 0;
+  prog->uniforms_loaded_ = 0;
 
   if (!prog) return SL_ERR_INVALID_ARG;
   int fail_invalid_arg = 0;
@@ -455,14 +496,21 @@ int sl_program_link(struct sl_program *prog) {
   r = 0;
   if (prog->vertex_shader_) {
     r = r ? r : sl_exec_prep(&prog->vertex_shader_->exec_, &prog->vertex_shader_->cu_);
-    r = r ? r : sl_exec_allocate_registers_by_slab(&prog->vertex_shader_->exec_, SL_EXEC_CHAIN_MAX_NUM_ROWS);
+    if (!r) sl_aot_link(&prog->vertex_shader_->exec_, prog->vertex_shader_->hash_);
+    r = r ? r : sl_program_allocate_registers(prog, "Vertex", prog->vertex_shader_);
+    if (!r) sl_program_report_fusions(prog, "Vertex", prog->vertex_shader_);
+    if (!r) prog->pa_.max_num_rows_ = prog->vertex_shader_->exec_.max_num_rows_;
   }
   if (prog->fragment_shader_) {
     r = r ? r : sl_exec_prep(&prog->fragment_shader_->exec_, &prog->fragment_shader_->cu_);
-    r = r ? r : sl_exec_allocate_registers_by_slab(&prog->fragment_shader_->exec_, SL_EXEC_CHAIN_MAX_NUM_ROWS);
+    if (!r) sl_aot_link(&prog->fragment_shader_->exec_, prog->fragment_shader_->hash_);
+    r = r ? r : sl_program_allocate_registers(prog, "Fragment", prog->fragment_shader_);
+    if (!r) sl_program_report_fusions(prog, "Fragment", prog->fragment_shader_);
+    if (!r) prog->fragbuf_.max_num_rows_ = prog->fragment_shader_->exec_.max_num_rows_;
   }
   if (prog->debug_shader_) {
     r = r ? r : sl_exec_prep(&prog->debug_shader_->exec_, &prog->debug_shader_->cu_);
+    if (!r) sl_aot_link(&prog->debug_shader_->exec_, prog->debug_shader_->hash_);
     r = r ? r : sl_exec_allocate_registers_by_slab(&prog->debug_shader_->exec_, SL_EXEC_CHAIN_MAX_NUM_ROWS);
   }
   if (r) return r;
@@ -574,7 +622,8 @@ int sl_program_load_uniform_for_execution(struct sl_program *prog, struct sl_uni
            struct sl_shader *s_;
   } vs[] = {
     { u->vertex_variable_, prog->vertex_shader_ },
-    { u->fragment_variable_, prog->fragment_shader_ }
+    { u->fragment_variable_, prog->fragment_shader_ },
+    { u->debug_variable_, prog->debug_shader_ }
   };
   size_t n;
   int r;
@@ -591,23 +640,98 @@ int sl_program_load_uniform_for_execution(struct sl_program *prog, struct sl_uni
 int sl_program_load_uniforms_for_execution(struct sl_program *prog,
                                            size_t loading_table_size,
                                            void **sampler_2D_uniform_loading_table,
-                                           void **sampler_Cube_uniform_loading_table) {
+                                           void **sampler_Cube_uniform_loading_table,
+                                           uint64_t loading_table_version) {
   int r;
   struct sl_uniform *u;
+  struct { struct sl_shader *s_;
+           int reload_all_;
+  } vs[] = {
+    { prog->vertex_shader_, 0 },
+    { prog->fragment_shader_, 0 },
+    { prog->debug_shader_, 0 }
+  };
+  size_t n;
+  int reload_samplers = !prog->uniforms_loaded_ || (prog->loading_tables_loaded_version_ != loading_table_version);
+
+  /* Shaders may be shared with other programs, whose uniforms may have been loaded since */
+  for (n = 0; n < (sizeof(vs) / sizeof(*vs)); ++n) {
+    if (!vs[n].s_) continue;
+    vs[n].reload_all_ = !prog->uniforms_loaded_ || (vs[n].s_->exec_.uniforms_owner_ != prog);
+  }
+
   u = prog->uniforms_.uniforms_;
   if (u) {
     do {
       u = u->chain_;
 
-      r = sl_program_load_uniform_for_execution(prog, u, loading_table_size, sampler_2D_uniform_loading_table, sampler_Cube_uniform_loading_table);
-      if (r) return r;
+      int is_changed = (u->version_ > prog->uniforms_loaded_version_) || (reload_samplers && u->has_samplers_);
+      struct sl_variable *vars[] = { u->vertex_variable_, u->fragment_variable_, u->debug_variable_ };
+      for (n = 0; n < (sizeof(vs) / sizeof(*vs)); ++n) {
+        size_t num_bytes_consumed;
+        if (!vs[n].s_ || !vars[n]) continue;
+        if (!is_changed && !vs[n].reload_all_) continue;
+        r = sl_uniform_load_ra_for_execution(&vs[n].s_->exec_, u->slab_, 0, 0, &num_bytes_consumed, &vars[n]->reg_alloc_,
+                                             loading_table_size, sampler_2D_uniform_loading_table, sampler_Cube_uniform_loading_table);
+        if (r) {
+          /* Partially loaded, start over next time */
+          prog->uniforms_loaded_ = 0;
+          return r;
+        }
+      }
 
     } while (u != prog->uniforms_.uniforms_);
   }
 
+  for (n = 0; n < (sizeof(vs) / sizeof(*vs)); ++n) {
+    if (vs[n].s_) vs[n].s_->exec_.uniforms_owner_ = prog;
+  }
+  prog->uniforms_loaded_version_ = prog->uniforms_.version_;
+  prog->loading_tables_loaded_version_ = loading_table_version;
+  prog->uniforms_loaded_ = 1;
+
   return 0;
 }
 
+void sl_program_select_variants(struct sl_program *prog) {
+  if (prog->vertex_shader_) sl_exec_select_variant(&prog->vertex_shader_->exec_);
+  if (prog->fragment_shader_) sl_exec_select_variant(&prog->fragment_shader_->exec_);
+  if (prog->debug_shader_) sl_exec_select_variant(&prog->debug_shader_->exec_);
+}
+
+void sl_program_get_variant_stats(const struct sl_program *prog, struct sl_exec_variant_stats *stats) {
+  const struct sl_shader *shaders[] = { prog->vertex_shader_, prog->fragment_shader_, prog->debug_shader_ };
+  size_t n;
+  memset(stats, 0, sizeof(*stats));
+  for (n = 0; n < (sizeof(shaders) / sizeof(*shaders)); ++n) {
+    struct sl_exec_variant_stats shader_stats;
+    if (!shaders[n]) continue;
+    sl_exec_get_variant_stats(&shaders[n]->exec_, &shader_stats);
+    stats->hits_ += shader_stats.hits_;
+    stats->failed_hits_ += shader_stats.failed_hits_;
+    stats->misses_ += shader_stats.misses_;
+    stats->evictions_ += shader_stats.evictions_;
+    stats->failures_ += shader_stats.failures_;
+    stats->unspecialized_ += shader_stats.unspecialized_;
+    stats->num_variants_ += shader_stats.num_variants_;
+  }
+}
+
+void sl_program_take_compaction_stats(struct sl_program *prog, struct sl_exec_compaction_stats *stats) {
+  struct sl_shader *shaders[] = { prog->vertex_shader_, prog->fragment_shader_, prog->debug_shader_ };
+  size_t n;
+  memset(stats, 0, sizeof(*stats));
+  for (n = 0; n < (sizeof(shaders) / sizeof(*shaders)); ++n) {
+    struct sl_exec_compaction_stats shader_stats;
+    if (!shaders[n]) continue;
+    sl_exec_take_compaction_stats(&shaders[n]->exec_, &shader_stats);
+    stats->compactions_ += shader_stats.compactions_;
+    stats->rows_ += shader_stats.rows_;
+    stats->kernels_ += shader_stats.kernels_;
+    stats->columns_ += shader_stats.columns_;
+  }
+}
+
 int sl_program_set_attrib_binding_index(struct sl_program *prog, const char *name, int index) {
   attrib_binding_table_result_t abtr;
   struct attrib_binding *ab;
@@ -75,6 +75,12 @@ struct sl_program {
 
   struct sl_uniform_table uniforms_;
 
+  /* State as of the last sl_program_load_uniforms_for_execution(): the sl_uniform_table::version_ and the
+   * version of the sampler loading tables loaded; uniforms_loaded_ is zero if nothing was loaded since linking. */
+  uint64_t uniforms_loaded_version_;
+  uint64_t loading_tables_loaded_version_;
+  int uniforms_loaded_:1;
+
   int gl_last_link_status_:1;
 
   struct sl_info_log log_;
@@ -92,10 +98,26 @@ int sl_program_load_uniform_for_execution(struct sl_program *prog, struct sl_uni
                                           void **sampler_2D_uniform_loading_table,
                                           void **sampler_Cube_uniform_loading_table);
 
+/* Loads the uniforms into the registers of the vertex, fragment and debug shaders, skipping those already loaded
+ * by a previous call. loading_table_version identifies the contents of the sampler loading tables, the
+ * caller changes it whenever any entry changes, upon which all sampler uniforms are reloaded. */
 int sl_program_load_uniforms_for_execution(struct sl_program *prog,
                                            size_t loading_table_size,
                                            void **sampler_2D_uniform_loading_table,
-                                           void **sampler_Cube_uniform_loading_table);
+                                           void **sampler_Cube_uniform_loading_table,
+                                           uint64_t loading_table_version);
+
+/* Selects the variants of the vertex, fragment and debug shaders specialized on the uniforms just loaded by
+ * sl_program_load_uniforms_for_execution(), see sl_exec_select_variant(). */
+void sl_program_select_variants(struct sl_program *prog);
+
+/* Stores the statistics of the variant caches of the vertex, fragment and debug shaders, summed, in stats. Shaders
+ * may be shared with other programs, whose draws count as well. */
+void sl_program_get_variant_stats(const struct sl_program *prog, struct sl_exec_variant_stats *stats);
+
+/* Stores the statistics of row compaction of the vertex, fragment and debug shaders since the last call, summed, in
+ * stats, and resets them (see sl_exec_take_compaction_stats().) */
+void sl_program_take_compaction_stats(struct sl_program *prog, struct sl_exec_compaction_stats *stats);
 
 int sl_program_link(struct sl_program *prog);
 
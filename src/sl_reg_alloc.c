@@ -738,7 +738,7 @@ static int sl_reg_check_appears_before_point(const struct sl_reg_alloc *ra, int
   if (ra->kind_ == slrak_struct) {
     size_t field_idx;
     for (field_idx = 0; field_idx < ra->v_.comp_.num_fields_; ++field_idx) {
-      struct sl_reg_alloc *field = ra->v_.comp_.fields_;
+      struct sl_reg_alloc *field = ra->v_.comp_.fields_ + field_idx;
       int r;
       r = sl_reg_check_appears_before_point(field, before_point, array_quantity, reg_cat, reg, reg_is_local_frame, piter_current_point);
       if (r) return r;
@@ -779,7 +779,7 @@ static int sl_reg_check_overlapping_assignment_impl(const struct sl_reg_alloc *l
   if (ra->kind_ == slrak_struct) {
     size_t field_idx;
     for (field_idx = 0; field_idx < ra->v_.comp_.num_fields_; ++field_idx) {
-      struct sl_reg_alloc *field = ra->v_.comp_.fields_;
+      struct sl_reg_alloc *field = ra->v_.comp_.fields_ + field_idx;
       int r;
       r = sl_reg_check_overlapping_assignment_impl(lvalue, field, array_quantity, piter_current_point);
       if (r) return r;
@@ -856,3 +856,31 @@ void sl_reg_allocator_cleanup(struct sl_reg_allocator *ra) {
   ref_range_allocator_cleanup(&ra->rra_samplerCube_);
 }
 
+static void sl_reg_alloc_mark_float_regs_impl(const struct sl_reg_alloc *ra, size_t reg_offset, uint8_t *flags, size_t num_flags, uint8_t flag) {
+  size_t n;
+  if (ra->kind_ == slrak_array) {
+    /* Elements are laid out as consecutive registers for each component, see sl_reg_allocator_alloc_descend() */
+    for (n = 0; n < ra->v_.array_.num_elements_; ++n) {
+      sl_reg_alloc_mark_float_regs_impl(ra->v_.array_.head_, reg_offset * ra->v_.array_.num_elements_ + n, flags, num_flags, flag);
+    }
+  }
+  else if (ra->kind_ == slrak_struct) {
+    for (n = 0; n < ra->v_.comp_.num_fields_; ++n) {
+      sl_reg_alloc_mark_float_regs_impl(ra->v_.comp_.fields_ + n, reg_offset, flags, num_flags, flag);
+    }
+  }
+  else if (sl_reg_alloc_get_category(ra) == slrc_float) {
+    int cardinality = sl_reg_alloc_get_cardinality(ra->kind_);
+    int component;
+    for (component = 0; component < cardinality; ++component) {
+      size_t reg;
+      if (ra->v_.regs_[component] == SL_REG_NONE) continue;
+      reg = (size_t)ra->v_.regs_[component] + reg_offset;
+      if (reg < num_flags) flags[reg] |= flag;
+    }
+  }
+}
+
+void sl_reg_alloc_mark_float_regs(const struct sl_reg_alloc *ra, uint8_t *flags, size_t num_flags, uint8_t flag) {
+  sl_reg_alloc_mark_float_regs_impl(ra, 0, flags, num_flags, flag);
+}
@@ -16,6 +16,16 @@
 #ifndef SL_REG_ALLOC_H
 #define SL_REG_ALLOC_H
 
+#ifndef STDINT_H_INCLUDED
+#define STDINT_H_INCLUDED
+#include <stdint.h>
+#endif
+
+#ifndef STDDEF_H_INCLUDED
+#define STDDEF_H_INCLUDED
+#include <stddef.h>
+#endif
+
 #ifndef REF_RANGE_ALLOCATOR_H_INCLUDED
 #define REF_RANGE_ALLOCATOR_H_INCLUDED
 #include "ref_range_allocator.h"
@@ -145,6 +155,12 @@ int sl_reg_allocator_lock_or_alloc(struct sl_reg_allocator *ract, struct sl_reg_
  * returned. */
 int sl_reg_check_overlapping_assignment(const struct sl_reg_alloc *lvalue, const struct sl_reg_alloc *rvalue);
 
+/* Sets flag in flags[reg] for each float register reg of ra, including those of all elements of arrays and
+ * all fields of structs; flags has num_flags entries, registers beyond are ignored. Register indices are
+ * relative to the frame of ra, and ra must not be indirect. Used to track which registers hold uniforms,
+ * see sl_execution::float_uniform_flags_. */
+void sl_reg_alloc_mark_float_regs(const struct sl_reg_alloc *ra, uint8_t *flags, size_t num_flags, uint8_t flag);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -37,11 +37,11 @@
 #endif
 
 static void sl_reg_move_f_reg_to_reg(struct sl_execution *exec,
-                                     uint8_t row,
+                                     sl_exec_row_t row,
                                      int dst_reg,
                                      int src_reg) {
   if (dst_reg == src_reg) return;
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
   float * restrict dst = dst_reg_bank[dst_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
@@ -52,20 +52,20 @@ static void sl_reg_move_f_reg_to_reg(struct sl_execution *exec,
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f_reg_to_indir(struct sl_execution *exec,
-                                       uint8_t row,
+                                       sl_exec_row_t row,
                                        int dst_indir_reg,
                                        int dst_fixed_offset,
                                        int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
   const float * restrict src = src_reg_bank[src_reg];
   for (;;) {
@@ -74,22 +74,22 @@ static void sl_reg_move_f_reg_to_indir(struct sl_execution *exec,
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f_reg_to_offset_reg(struct sl_execution *exec,
-                                            uint8_t row,
+                                            sl_exec_row_t row,
                                             int dst_base_reg,
                                             int dst_offset_reg,
                                             int dst_fixed_offset,
                                             int dst_offset_stepsize,
                                             int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
   const float * restrict src = src_reg_bank[src_reg];
   for (;;) {
@@ -98,23 +98,23 @@ static void sl_reg_move_f_reg_to_offset_reg(struct sl_execution *exec,
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f_reg_to_indir_offset(struct sl_execution *exec,
-                                              uint8_t row,
+                                              sl_exec_row_t row,
                                               int dst_indir_reg,
                                               int dst_offset_reg,
                                               int dst_fixed_offset,
                                               int dst_offset_stepsize,
                                               int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
   const float * restrict src = src_reg_bank[src_reg];
   for (;;) {
@@ -123,160 +123,160 @@ static void sl_reg_move_f_reg_to_indir_offset(struct sl_execution *exec,
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f_indir_to_reg(struct sl_execution *exec,
-                                       uint8_t row,
+                                       sl_exec_row_t row,
                                        int dst_reg,
                                        int src_indir_reg,
                                        int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
   float * restrict dst = dst_reg_bank[dst_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     float * restrict dst_row = dst + row;
     const float * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f_indir_to_indir(struct sl_execution *exec,
-                                         uint8_t row,
+                                         sl_exec_row_t row,
                                          int dst_indir_reg,
                                          int dst_fixed_offset,
                                          int src_indir_reg,
                                          int src_fixed_offset) {
   if ((dst_indir_reg == src_indir_reg) && (dst_fixed_offset == src_fixed_offset)) return;
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f_indir_to_offset_reg(struct sl_execution *exec,
-                                              uint8_t row,
+                                              sl_exec_row_t row,
                                               int dst_base_reg,
                                               int dst_offset_reg,
                                               int dst_fixed_offset,
                                               int dst_offset_stepsize,
                                               int src_indir_reg,
                                               int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f_indir_to_indir_offset(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_indir_reg,
                                                 int dst_offset_reg,
                                                 int dst_fixed_offset,
                                                 int dst_offset_stepsize,
                                                 int src_indir_reg,
                                                 int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f_offset_reg_to_reg(struct sl_execution *exec,
-                                            uint8_t row,
+                                            sl_exec_row_t row,
                                             int dst_reg,
                                             int src_base_reg,
                                             int src_offset_reg,
                                             int src_fixed_offset,
                                             int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
   float * restrict dst = dst_reg_bank[dst_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     float * restrict dst_row = dst + row;
     const float * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f_offset_reg_to_indir(struct sl_execution *exec,
-                                              uint8_t row,
+                                              sl_exec_row_t row,
                                               int dst_indir_reg,
                                               int dst_fixed_offset,
                                               int src_base_reg,
                                               int src_offset_reg,
                                               int src_fixed_offset,
                                               int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f_offset_reg_to_offset_reg(struct sl_execution *exec,
-                                                   uint8_t row,
+                                                   sl_exec_row_t row,
                                                    int dst_base_reg,
                                                    int dst_offset_reg,
                                                    int dst_fixed_offset,
@@ -288,25 +288,25 @@ static void sl_reg_move_f_offset_reg_to_offset_reg(struct sl_execution *exec,
   if ((dst_base_reg == src_base_reg) && (dst_offset_reg == src_offset_reg) && 
       (dst_fixed_offset == src_fixed_offset) && (dst_offset_stepsize == src_offset_stepsize))
     return;
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f_offset_reg_to_indir_offset(struct sl_execution *exec,
-                                                     uint8_t row,
+                                                     sl_exec_row_t row,
                                                      int dst_indir_reg,
                                                      int dst_offset_reg,
                                                      int dst_fixed_offset,
@@ -315,77 +315,77 @@ static void sl_reg_move_f_offset_reg_to_indir_offset(struct sl_execution *exec,
                                                      int src_offset_reg,
                                                      int src_fixed_offset,
                                                      int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f_indir_offset_to_reg(struct sl_execution *exec,
-                                              uint8_t row,
+                                              sl_exec_row_t row,
                                               int dst_reg,
                                               int src_indir_reg,
                                               int src_offset_reg,
                                               int src_fixed_offset,
                                               int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
   float * restrict dst = dst_reg_bank[dst_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     float * restrict dst_row = dst + row;
     const float * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f_indir_offset_to_indir(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_indir_reg,
                                                 int dst_fixed_offset,
                                                 int src_indir_reg,
                                                 int src_offset_reg,
                                                 int src_fixed_offset,
                                                 int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f_indir_offset_to_offset_reg(struct sl_execution *exec,
-                                                     uint8_t row,
+                                                     sl_exec_row_t row,
                                                      int dst_base_reg,
                                                      int dst_offset_reg,
                                                      int dst_fixed_offset,
@@ -394,26 +394,26 @@ static void sl_reg_move_f_indir_offset_to_offset_reg(struct sl_execution *exec,
                                                      int src_offset_reg,
                                                      int src_fixed_offset,
                                                      int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f_indir_offset_to_indir_offset(struct sl_execution *exec,
-                                                       uint8_t row,
+                                                       sl_exec_row_t row,
                                                        int dst_indir_reg,
                                                        int dst_offset_reg,
                                                        int dst_fixed_offset,
@@ -425,264 +425,264 @@ static void sl_reg_move_f_indir_offset_to_indir_offset(struct sl_execution *exec
   if ((dst_indir_reg == src_indir_reg) && (dst_offset_reg == src_offset_reg) && 
       (dst_fixed_offset == src_fixed_offset) && (dst_offset_stepsize == src_offset_stepsize))
     return;
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2i_reg_to_reg(struct sl_execution *exec,
-                                       uint8_t row,
+                                       sl_exec_row_t row,
                                        int dst_reg,
                                        int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  int64_t * restrict dst = dst_reg_bank[dst_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  sl_exec_int_t * restrict dst = dst_reg_bank[dst_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
   const float * restrict src = src_reg_bank[src_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst + row;
+    sl_exec_int_t * restrict dst_row = dst + row;
     const float * restrict src_row = src + row;
 
-    *dst_row = (int64_t)*src_row;
+    *dst_row = (sl_exec_int_t)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2i_reg_to_indir(struct sl_execution *exec,
-                                         uint8_t row,
+                                         sl_exec_row_t row,
                                          int dst_indir_reg,
                                          int dst_fixed_offset,
                                          int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
   const float * restrict src = src_reg_bank[src_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src + row;
 
-    *dst_row = (int64_t)*src_row;
+    *dst_row = (sl_exec_int_t)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2i_reg_to_offset_reg(struct sl_execution *exec,
-                                              uint8_t row,
+                                              sl_exec_row_t row,
                                               int dst_base_reg,
                                               int dst_offset_reg,
                                               int dst_fixed_offset,
                                               int dst_offset_stepsize,
                                               int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
   const float * restrict src = src_reg_bank[src_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src + row;
 
-    *dst_row = (int64_t)*src_row;
+    *dst_row = (sl_exec_int_t)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2i_reg_to_indir_offset(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_indir_reg,
                                                 int dst_offset_reg,
                                                 int dst_fixed_offset,
                                                 int dst_offset_stepsize,
                                                 int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
   const float * restrict src = src_reg_bank[src_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src + row;
 
-    *dst_row = (int64_t)*src_row;
+    *dst_row = (sl_exec_int_t)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2i_indir_to_reg(struct sl_execution *exec,
-                                         uint8_t row,
+                                         sl_exec_row_t row,
                                          int dst_reg,
                                          int src_indir_reg,
                                          int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  int64_t * restrict dst = dst_reg_bank[dst_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  sl_exec_int_t * restrict dst = dst_reg_bank[dst_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst + row;
+    sl_exec_int_t * restrict dst_row = dst + row;
     const float * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
-    *dst_row = (int64_t)*src_row;
+    *dst_row = (sl_exec_int_t)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2i_indir_to_indir(struct sl_execution *exec,
-                                           uint8_t row,
+                                           sl_exec_row_t row,
                                            int dst_indir_reg,
                                            int dst_fixed_offset,
                                            int src_indir_reg,
                                            int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
-    *dst_row = (int64_t)*src_row;
+    *dst_row = (sl_exec_int_t)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2i_indir_to_offset_reg(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_base_reg,
                                                 int dst_offset_reg,
                                                 int dst_fixed_offset,
                                                 int dst_offset_stepsize,
                                                 int src_indir_reg,
                                                 int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
-    *dst_row = (int64_t)*src_row;
+    *dst_row = (sl_exec_int_t)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2i_indir_to_indir_offset(struct sl_execution *exec,
-                                                  uint8_t row,
+                                                  sl_exec_row_t row,
                                                   int dst_indir_reg,
                                                   int dst_offset_reg,
                                                   int dst_fixed_offset,
                                                   int dst_offset_stepsize,
                                                   int src_indir_reg,
                                                   int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
-    *dst_row = (int64_t)*src_row;
+    *dst_row = (sl_exec_int_t)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2i_offset_reg_to_reg(struct sl_execution *exec,
-                                              uint8_t row,
+                                              sl_exec_row_t row,
                                               int dst_reg,
                                               int src_base_reg,
                                               int src_offset_reg,
                                               int src_fixed_offset,
                                               int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  int64_t * restrict dst = dst_reg_bank[dst_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  sl_exec_int_t * restrict dst = dst_reg_bank[dst_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst + row;
+    sl_exec_int_t * restrict dst_row = dst + row;
     const float * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
-    *dst_row = (int64_t)*src_row;
+    *dst_row = (sl_exec_int_t)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2i_offset_reg_to_indir(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_indir_reg,
                                                 int dst_fixed_offset,
                                                 int src_base_reg,
                                                 int src_offset_reg,
                                                 int src_fixed_offset,
                                                 int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
-    *dst_row = (int64_t)*src_row;
+    *dst_row = (sl_exec_int_t)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2i_offset_reg_to_offset_reg(struct sl_execution *exec,
-                                                     uint8_t row,
+                                                     sl_exec_row_t row,
                                                      int dst_base_reg,
                                                      int dst_offset_reg,
                                                      int dst_fixed_offset,
@@ -691,25 +691,25 @@ static void sl_reg_move_f2i_offset_reg_to_offset_reg(struct sl_execution *exec,
                                                      int src_offset_reg,
                                                      int src_fixed_offset,
                                                      int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
-    *dst_row = (int64_t)*src_row;
+    *dst_row = (sl_exec_int_t)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2i_offset_reg_to_indir_offset(struct sl_execution *exec,
-                                                       uint8_t row,
+                                                       sl_exec_row_t row,
                                                        int dst_indir_reg,
                                                        int dst_offset_reg,
                                                        int dst_fixed_offset,
@@ -718,77 +718,77 @@ static void sl_reg_move_f2i_offset_reg_to_indir_offset(struct sl_execution *exec
                                                        int src_offset_reg,
                                                        int src_fixed_offset,
                                                        int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
-    *dst_row = (int64_t)*src_row;
+    *dst_row = (sl_exec_int_t)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2i_indir_offset_to_reg(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_reg,
                                                 int src_indir_reg,
                                                 int src_offset_reg,
                                                 int src_fixed_offset,
                                                 int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  int64_t * restrict dst = dst_reg_bank[dst_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  sl_exec_int_t * restrict dst = dst_reg_bank[dst_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst + row;
+    sl_exec_int_t * restrict dst_row = dst + row;
     const float * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
-    *dst_row = (int64_t)*src_row;
+    *dst_row = (sl_exec_int_t)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2i_indir_offset_to_indir(struct sl_execution *exec,
-                                                  uint8_t row,
+                                                  sl_exec_row_t row,
                                                   int dst_indir_reg,
                                                   int dst_fixed_offset,
                                                   int src_indir_reg,
                                                   int src_offset_reg,
                                                   int src_fixed_offset,
                                                   int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
-    *dst_row = (int64_t)*src_row;
+    *dst_row = (sl_exec_int_t)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2i_indir_offset_to_offset_reg(struct sl_execution *exec,
-                                                       uint8_t row,
+                                                       sl_exec_row_t row,
                                                        int dst_base_reg,
                                                        int dst_offset_reg,
                                                        int dst_fixed_offset,
@@ -797,26 +797,26 @@ static void sl_reg_move_f2i_indir_offset_to_offset_reg(struct sl_execution *exec
                                                        int src_offset_reg,
                                                        int src_fixed_offset,
                                                        int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
-    *dst_row = (int64_t)*src_row;
+    *dst_row = (sl_exec_int_t)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2i_indir_offset_to_indir_offset(struct sl_execution *exec,
-                                                         uint8_t row,
+                                                         sl_exec_row_t row,
                                                          int dst_indir_reg,
                                                          int dst_offset_reg,
                                                          int dst_fixed_offset,
@@ -825,30 +825,30 @@ static void sl_reg_move_f2i_indir_offset_to_indir_offset(struct sl_execution *ex
                                                          int src_offset_reg,
                                                          int src_fixed_offset,
                                                          int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
-    *dst_row = (int64_t)*src_row;
+    *dst_row = (sl_exec_int_t)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2b_reg_to_reg(struct sl_execution *exec,
-                                       uint8_t row,
+                                       sl_exec_row_t row,
                                        int dst_reg,
                                        int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
   uint8_t * restrict dst = dst_reg_bank[dst_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
@@ -859,20 +859,20 @@ static void sl_reg_move_f2b_reg_to_reg(struct sl_execution *exec,
 
     *dst_row = (uint8_t)(*src_row != 0.f);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2b_reg_to_indir(struct sl_execution *exec,
-                                         uint8_t row,
+                                         sl_exec_row_t row,
                                          int dst_indir_reg,
                                          int dst_fixed_offset,
                                          int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
   const float * restrict src = src_reg_bank[src_reg];
   for (;;) {
@@ -881,22 +881,22 @@ static void sl_reg_move_f2b_reg_to_indir(struct sl_execution *exec,
 
     *dst_row = (uint8_t)(*src_row != 0.f);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2b_reg_to_offset_reg(struct sl_execution *exec,
-                                              uint8_t row,
+                                              sl_exec_row_t row,
                                               int dst_base_reg,
                                               int dst_offset_reg,
                                               int dst_fixed_offset,
                                               int dst_offset_stepsize,
                                               int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
   const float * restrict src = src_reg_bank[src_reg];
   for (;;) {
@@ -905,23 +905,23 @@ static void sl_reg_move_f2b_reg_to_offset_reg(struct sl_execution *exec,
 
     *dst_row = (uint8_t)(*src_row != 0.f);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2b_reg_to_indir_offset(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_indir_reg,
                                                 int dst_offset_reg,
                                                 int dst_fixed_offset,
                                                 int dst_offset_stepsize,
                                                 int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
   const float * restrict src = src_reg_bank[src_reg];
   for (;;) {
@@ -930,159 +930,159 @@ static void sl_reg_move_f2b_reg_to_indir_offset(struct sl_execution *exec,
 
     *dst_row = (uint8_t)(*src_row != 0.f);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2b_indir_to_reg(struct sl_execution *exec,
-                                         uint8_t row,
+                                         sl_exec_row_t row,
                                          int dst_reg,
                                          int src_indir_reg,
                                          int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
   uint8_t * restrict dst = dst_reg_bank[dst_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst + row;
     const float * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = (uint8_t)(*src_row != 0.f);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2b_indir_to_indir(struct sl_execution *exec,
-                                           uint8_t row,
+                                           sl_exec_row_t row,
                                            int dst_indir_reg,
                                            int dst_fixed_offset,
                                            int src_indir_reg,
                                            int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = (uint8_t)(*src_row != 0.f);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2b_indir_to_offset_reg(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_base_reg,
                                                 int dst_offset_reg,
                                                 int dst_fixed_offset,
                                                 int dst_offset_stepsize,
                                                 int src_indir_reg,
                                                 int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = (uint8_t)(*src_row != 0.f);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2b_indir_to_indir_offset(struct sl_execution *exec,
-                                                  uint8_t row,
+                                                  sl_exec_row_t row,
                                                   int dst_indir_reg,
                                                   int dst_offset_reg,
                                                   int dst_fixed_offset,
                                                   int dst_offset_stepsize,
                                                   int src_indir_reg,
                                                   int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = (uint8_t)(*src_row != 0.f);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2b_offset_reg_to_reg(struct sl_execution *exec,
-                                              uint8_t row,
+                                              sl_exec_row_t row,
                                               int dst_reg,
                                               int src_base_reg,
                                               int src_offset_reg,
                                               int src_fixed_offset,
                                               int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
   uint8_t * restrict dst = dst_reg_bank[dst_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst + row;
     const float * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (uint8_t)(*src_row != 0.f);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2b_offset_reg_to_indir(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_indir_reg,
                                                 int dst_fixed_offset,
                                                 int src_base_reg,
                                                 int src_offset_reg,
                                                 int src_fixed_offset,
                                                 int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (uint8_t)(*src_row != 0.f);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2b_offset_reg_to_offset_reg(struct sl_execution *exec,
-                                                     uint8_t row,
+                                                     sl_exec_row_t row,
                                                      int dst_base_reg,
                                                      int dst_offset_reg,
                                                      int dst_fixed_offset,
@@ -1091,25 +1091,25 @@ static void sl_reg_move_f2b_offset_reg_to_offset_reg(struct sl_execution *exec,
                                                      int src_offset_reg,
                                                      int src_fixed_offset,
                                                      int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (uint8_t)(*src_row != 0.f);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2b_offset_reg_to_indir_offset(struct sl_execution *exec,
-                                                       uint8_t row,
+                                                       sl_exec_row_t row,
                                                        int dst_indir_reg,
                                                        int dst_offset_reg,
                                                        int dst_fixed_offset,
@@ -1118,77 +1118,77 @@ static void sl_reg_move_f2b_offset_reg_to_indir_offset(struct sl_execution *exec
                                                        int src_offset_reg,
                                                        int src_fixed_offset,
                                                        int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (uint8_t)(*src_row != 0.f);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2b_indir_offset_to_reg(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_reg,
                                                 int src_indir_reg,
                                                 int src_offset_reg,
                                                 int src_fixed_offset,
                                                 int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
   uint8_t * restrict dst = dst_reg_bank[dst_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst + row;
     const float * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (uint8_t)(*src_row != 0.f);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2b_indir_offset_to_indir(struct sl_execution *exec,
-                                                  uint8_t row,
+                                                  sl_exec_row_t row,
                                                   int dst_indir_reg,
                                                   int dst_fixed_offset,
                                                   int src_indir_reg,
                                                   int src_offset_reg,
                                                   int src_fixed_offset,
                                                   int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (uint8_t)(*src_row != 0.f);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2b_indir_offset_to_offset_reg(struct sl_execution *exec,
-                                                       uint8_t row,
+                                                       sl_exec_row_t row,
                                                        int dst_base_reg,
                                                        int dst_offset_reg,
                                                        int dst_fixed_offset,
@@ -1197,26 +1197,26 @@ static void sl_reg_move_f2b_indir_offset_to_offset_reg(struct sl_execution *exec
                                                        int src_offset_reg,
                                                        int src_fixed_offset,
                                                        int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (uint8_t)(*src_row != 0.f);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_f2b_indir_offset_to_indir_offset(struct sl_execution *exec,
-                                                         uint8_t row,
+                                                         sl_exec_row_t row,
                                                          int dst_indir_reg,
                                                          int dst_offset_reg,
                                                          int dst_fixed_offset,
@@ -1225,264 +1225,264 @@ static void sl_reg_move_f2b_indir_offset_to_indir_offset(struct sl_execution *ex
                                                          int src_offset_reg,
                                                          int src_fixed_offset,
                                                          int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   float * restrict * restrict src_reg_bank = exec->float_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const float * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (uint8_t)(*src_row != 0.f);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2f_reg_to_reg(struct sl_execution *exec,
-                                       uint8_t row,
+                                       sl_exec_row_t row,
                                        int dst_reg,
                                        int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
   float * restrict dst = dst_reg_bank[dst_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src = src_reg_bank[src_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src = src_reg_bank[src_reg];
   for (;;) {
     float * restrict dst_row = dst + row;
-    const int64_t * restrict src_row = src + row;
+    const sl_exec_int_t * restrict src_row = src + row;
 
     *dst_row = (float)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2f_reg_to_indir(struct sl_execution *exec,
-                                         uint8_t row,
+                                         sl_exec_row_t row,
                                          int dst_indir_reg,
                                          int dst_fixed_offset,
                                          int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src = src_reg_bank[src_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src = src_reg_bank[src_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src + row;
+    const sl_exec_int_t * restrict src_row = src + row;
 
     *dst_row = (float)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2f_reg_to_offset_reg(struct sl_execution *exec,
-                                              uint8_t row,
+                                              sl_exec_row_t row,
                                               int dst_base_reg,
                                               int dst_offset_reg,
                                               int dst_fixed_offset,
                                               int dst_offset_stepsize,
                                               int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src = src_reg_bank[src_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src = src_reg_bank[src_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src + row;
+    const sl_exec_int_t * restrict src_row = src + row;
 
     *dst_row = (float)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2f_reg_to_indir_offset(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_indir_reg,
                                                 int dst_offset_reg,
                                                 int dst_fixed_offset,
                                                 int dst_offset_stepsize,
                                                 int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src = src_reg_bank[src_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src = src_reg_bank[src_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src + row;
+    const sl_exec_int_t * restrict src_row = src + row;
 
     *dst_row = (float)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2f_indir_to_reg(struct sl_execution *exec,
-                                         uint8_t row,
+                                         sl_exec_row_t row,
                                          int dst_reg,
                                          int src_indir_reg,
                                          int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
   float * restrict dst = dst_reg_bank[dst_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     float * restrict dst_row = dst + row;
-    const int64_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = (float)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2f_indir_to_indir(struct sl_execution *exec,
-                                           uint8_t row,
+                                           sl_exec_row_t row,
                                            int dst_indir_reg,
                                            int dst_fixed_offset,
                                            int src_indir_reg,
                                            int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = (float)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2f_indir_to_offset_reg(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_base_reg,
                                                 int dst_offset_reg,
                                                 int dst_fixed_offset,
                                                 int dst_offset_stepsize,
                                                 int src_indir_reg,
                                                 int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = (float)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2f_indir_to_indir_offset(struct sl_execution *exec,
-                                                  uint8_t row,
+                                                  sl_exec_row_t row,
                                                   int dst_indir_reg,
                                                   int dst_offset_reg,
                                                   int dst_fixed_offset,
                                                   int dst_offset_stepsize,
                                                   int src_indir_reg,
                                                   int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = (float)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2f_offset_reg_to_reg(struct sl_execution *exec,
-                                              uint8_t row,
+                                              sl_exec_row_t row,
                                               int dst_reg,
                                               int src_base_reg,
                                               int src_offset_reg,
                                               int src_fixed_offset,
                                               int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
   float * restrict dst = dst_reg_bank[dst_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     float * restrict dst_row = dst + row;
-    const int64_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (float)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2f_offset_reg_to_indir(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_indir_reg,
                                                 int dst_fixed_offset,
                                                 int src_base_reg,
                                                 int src_offset_reg,
                                                 int src_fixed_offset,
                                                 int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (float)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2f_offset_reg_to_offset_reg(struct sl_execution *exec,
-                                                     uint8_t row,
+                                                     sl_exec_row_t row,
                                                      int dst_base_reg,
                                                      int dst_offset_reg,
                                                      int dst_fixed_offset,
@@ -1491,25 +1491,25 @@ static void sl_reg_move_i2f_offset_reg_to_offset_reg(struct sl_execution *exec,
                                                      int src_offset_reg,
                                                      int src_fixed_offset,
                                                      int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (float)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2f_offset_reg_to_indir_offset(struct sl_execution *exec,
-                                                       uint8_t row,
+                                                       sl_exec_row_t row,
                                                        int dst_indir_reg,
                                                        int dst_offset_reg,
                                                        int dst_fixed_offset,
@@ -1518,77 +1518,77 @@ static void sl_reg_move_i2f_offset_reg_to_indir_offset(struct sl_execution *exec
                                                        int src_offset_reg,
                                                        int src_fixed_offset,
                                                        int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (float)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2f_indir_offset_to_reg(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_reg,
                                                 int src_indir_reg,
                                                 int src_offset_reg,
                                                 int src_fixed_offset,
                                                 int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
   float * restrict dst = dst_reg_bank[dst_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     float * restrict dst_row = dst + row;
-    const int64_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (float)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2f_indir_offset_to_indir(struct sl_execution *exec,
-                                                  uint8_t row,
+                                                  sl_exec_row_t row,
                                                   int dst_indir_reg,
                                                   int dst_fixed_offset,
                                                   int src_indir_reg,
                                                   int src_offset_reg,
                                                   int src_fixed_offset,
                                                   int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (float)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2f_indir_offset_to_offset_reg(struct sl_execution *exec,
-                                                       uint8_t row,
+                                                       sl_exec_row_t row,
                                                        int dst_base_reg,
                                                        int dst_offset_reg,
                                                        int dst_fixed_offset,
@@ -1597,26 +1597,26 @@ static void sl_reg_move_i2f_indir_offset_to_offset_reg(struct sl_execution *exec
                                                        int src_offset_reg,
                                                        int src_fixed_offset,
                                                        int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (float)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2f_indir_offset_to_indir_offset(struct sl_execution *exec,
-                                                         uint8_t row,
+                                                         sl_exec_row_t row,
                                                          int dst_indir_reg,
                                                          int dst_offset_reg,
                                                          int dst_fixed_offset,
@@ -1625,266 +1625,266 @@ static void sl_reg_move_i2f_indir_offset_to_indir_offset(struct sl_execution *ex
                                                          int src_offset_reg,
                                                          int src_fixed_offset,
                                                          int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (float)*src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i_reg_to_reg(struct sl_execution *exec,
-                                     uint8_t row,
+                                     sl_exec_row_t row,
                                      int dst_reg,
                                      int src_reg) {
   if (dst_reg == src_reg) return;
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  int64_t * restrict dst = dst_reg_bank[dst_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src = src_reg_bank[src_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  sl_exec_int_t * restrict dst = dst_reg_bank[dst_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src = src_reg_bank[src_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst + row;
-    const int64_t * restrict src_row = src + row;
+    sl_exec_int_t * restrict dst_row = dst + row;
+    const sl_exec_int_t * restrict src_row = src + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i_reg_to_indir(struct sl_execution *exec,
-                                       uint8_t row,
+                                       sl_exec_row_t row,
                                        int dst_indir_reg,
                                        int dst_fixed_offset,
                                        int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src = src_reg_bank[src_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src = src_reg_bank[src_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i_reg_to_offset_reg(struct sl_execution *exec,
-                                            uint8_t row,
+                                            sl_exec_row_t row,
                                             int dst_base_reg,
                                             int dst_offset_reg,
                                             int dst_fixed_offset,
                                             int dst_offset_stepsize,
                                             int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src = src_reg_bank[src_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src = src_reg_bank[src_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i_reg_to_indir_offset(struct sl_execution *exec,
-                                              uint8_t row,
+                                              sl_exec_row_t row,
                                               int dst_indir_reg,
                                               int dst_offset_reg,
                                               int dst_fixed_offset,
                                               int dst_offset_stepsize,
                                               int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src = src_reg_bank[src_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src = src_reg_bank[src_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i_indir_to_reg(struct sl_execution *exec,
-                                       uint8_t row,
+                                       sl_exec_row_t row,
                                        int dst_reg,
                                        int src_indir_reg,
                                        int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  int64_t * restrict dst = dst_reg_bank[dst_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  sl_exec_int_t * restrict dst = dst_reg_bank[dst_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst + row;
-    const int64_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i_indir_to_indir(struct sl_execution *exec,
-                                         uint8_t row,
+                                         sl_exec_row_t row,
                                          int dst_indir_reg,
                                          int dst_fixed_offset,
                                          int src_indir_reg,
                                          int src_fixed_offset) {
   if ((dst_indir_reg == src_indir_reg) && (dst_fixed_offset == src_fixed_offset)) return;
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i_indir_to_offset_reg(struct sl_execution *exec,
-                                              uint8_t row,
+                                              sl_exec_row_t row,
                                               int dst_base_reg,
                                               int dst_offset_reg,
                                               int dst_fixed_offset,
                                               int dst_offset_stepsize,
                                               int src_indir_reg,
                                               int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i_indir_to_indir_offset(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_indir_reg,
                                                 int dst_offset_reg,
                                                 int dst_fixed_offset,
                                                 int dst_offset_stepsize,
                                                 int src_indir_reg,
                                                 int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i_offset_reg_to_reg(struct sl_execution *exec,
-                                            uint8_t row,
+                                            sl_exec_row_t row,
                                             int dst_reg,
                                             int src_base_reg,
                                             int src_offset_reg,
                                             int src_fixed_offset,
                                             int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  int64_t * restrict dst = dst_reg_bank[dst_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  sl_exec_int_t * restrict dst = dst_reg_bank[dst_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst + row;
-    const int64_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i_offset_reg_to_indir(struct sl_execution *exec,
-                                              uint8_t row,
+                                              sl_exec_row_t row,
                                               int dst_indir_reg,
                                               int dst_fixed_offset,
                                               int src_base_reg,
                                               int src_offset_reg,
                                               int src_fixed_offset,
                                               int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i_offset_reg_to_offset_reg(struct sl_execution *exec,
-                                                   uint8_t row,
+                                                   sl_exec_row_t row,
                                                    int dst_base_reg,
                                                    int dst_offset_reg,
                                                    int dst_fixed_offset,
@@ -1896,25 +1896,25 @@ static void sl_reg_move_i_offset_reg_to_offset_reg(struct sl_execution *exec,
   if ((dst_base_reg == src_base_reg) && (dst_offset_reg == src_offset_reg) && 
       (dst_fixed_offset == src_fixed_offset) && (dst_offset_stepsize == src_offset_stepsize))
     return;
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i_offset_reg_to_indir_offset(struct sl_execution *exec,
-                                                     uint8_t row,
+                                                     sl_exec_row_t row,
                                                      int dst_indir_reg,
                                                      int dst_offset_reg,
                                                      int dst_fixed_offset,
@@ -1923,77 +1923,77 @@ static void sl_reg_move_i_offset_reg_to_indir_offset(struct sl_execution *exec,
                                                      int src_offset_reg,
                                                      int src_fixed_offset,
                                                      int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i_indir_offset_to_reg(struct sl_execution *exec,
-                                              uint8_t row,
+                                              sl_exec_row_t row,
                                               int dst_reg,
                                               int src_indir_reg,
                                               int src_offset_reg,
                                               int src_fixed_offset,
                                               int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  int64_t * restrict dst = dst_reg_bank[dst_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  sl_exec_int_t * restrict dst = dst_reg_bank[dst_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst + row;
-    const int64_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i_indir_offset_to_indir(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_indir_reg,
                                                 int dst_fixed_offset,
                                                 int src_indir_reg,
                                                 int src_offset_reg,
                                                 int src_fixed_offset,
                                                 int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i_indir_offset_to_offset_reg(struct sl_execution *exec,
-                                                     uint8_t row,
+                                                     sl_exec_row_t row,
                                                      int dst_base_reg,
                                                      int dst_offset_reg,
                                                      int dst_fixed_offset,
@@ -2002,26 +2002,26 @@ static void sl_reg_move_i_indir_offset_to_offset_reg(struct sl_execution *exec,
                                                      int src_offset_reg,
                                                      int src_fixed_offset,
                                                      int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i_indir_offset_to_indir_offset(struct sl_execution *exec,
-                                                       uint8_t row,
+                                                       sl_exec_row_t row,
                                                        int dst_indir_reg,
                                                        int dst_offset_reg,
                                                        int dst_fixed_offset,
@@ -2033,264 +2033,264 @@ static void sl_reg_move_i_indir_offset_to_indir_offset(struct sl_execution *exec
   if ((dst_indir_reg == src_indir_reg) && (dst_offset_reg == src_offset_reg) && 
       (dst_fixed_offset == src_fixed_offset) && (dst_offset_stepsize == src_offset_stepsize))
     return;
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2b_reg_to_reg(struct sl_execution *exec,
-                                       uint8_t row,
+                                       sl_exec_row_t row,
                                        int dst_reg,
                                        int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
   uint8_t * restrict dst = dst_reg_bank[dst_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src = src_reg_bank[src_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src = src_reg_bank[src_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst + row;
-    const int64_t * restrict src_row = src + row;
+    const sl_exec_int_t * restrict src_row = src + row;
 
     *dst_row = (uint8_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2b_reg_to_indir(struct sl_execution *exec,
-                                         uint8_t row,
+                                         sl_exec_row_t row,
                                          int dst_indir_reg,
                                          int dst_fixed_offset,
                                          int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src = src_reg_bank[src_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src = src_reg_bank[src_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src + row;
+    const sl_exec_int_t * restrict src_row = src + row;
 
     *dst_row = (uint8_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2b_reg_to_offset_reg(struct sl_execution *exec,
-                                              uint8_t row,
+                                              sl_exec_row_t row,
                                               int dst_base_reg,
                                               int dst_offset_reg,
                                               int dst_fixed_offset,
                                               int dst_offset_stepsize,
                                               int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src = src_reg_bank[src_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src = src_reg_bank[src_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src + row;
+    const sl_exec_int_t * restrict src_row = src + row;
 
     *dst_row = (uint8_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2b_reg_to_indir_offset(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_indir_reg,
                                                 int dst_offset_reg,
                                                 int dst_fixed_offset,
                                                 int dst_offset_stepsize,
                                                 int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src = src_reg_bank[src_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src = src_reg_bank[src_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src + row;
+    const sl_exec_int_t * restrict src_row = src + row;
 
     *dst_row = (uint8_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2b_indir_to_reg(struct sl_execution *exec,
-                                         uint8_t row,
+                                         sl_exec_row_t row,
                                          int dst_reg,
                                          int src_indir_reg,
                                          int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
   uint8_t * restrict dst = dst_reg_bank[dst_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst + row;
-    const int64_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = (uint8_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2b_indir_to_indir(struct sl_execution *exec,
-                                           uint8_t row,
+                                           sl_exec_row_t row,
                                            int dst_indir_reg,
                                            int dst_fixed_offset,
                                            int src_indir_reg,
                                            int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = (uint8_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2b_indir_to_offset_reg(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_base_reg,
                                                 int dst_offset_reg,
                                                 int dst_fixed_offset,
                                                 int dst_offset_stepsize,
                                                 int src_indir_reg,
                                                 int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = (uint8_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2b_indir_to_indir_offset(struct sl_execution *exec,
-                                                  uint8_t row,
+                                                  sl_exec_row_t row,
                                                   int dst_indir_reg,
                                                   int dst_offset_reg,
                                                   int dst_fixed_offset,
                                                   int dst_offset_stepsize,
                                                   int src_indir_reg,
                                                   int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = (uint8_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2b_offset_reg_to_reg(struct sl_execution *exec,
-                                              uint8_t row,
+                                              sl_exec_row_t row,
                                               int dst_reg,
                                               int src_base_reg,
                                               int src_offset_reg,
                                               int src_fixed_offset,
                                               int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
   uint8_t * restrict dst = dst_reg_bank[dst_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst + row;
-    const int64_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (uint8_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2b_offset_reg_to_indir(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_indir_reg,
                                                 int dst_fixed_offset,
                                                 int src_base_reg,
                                                 int src_offset_reg,
                                                 int src_fixed_offset,
                                                 int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (uint8_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2b_offset_reg_to_offset_reg(struct sl_execution *exec,
-                                                     uint8_t row,
+                                                     sl_exec_row_t row,
                                                      int dst_base_reg,
                                                      int dst_offset_reg,
                                                      int dst_fixed_offset,
@@ -2299,25 +2299,25 @@ static void sl_reg_move_i2b_offset_reg_to_offset_reg(struct sl_execution *exec,
                                                      int src_offset_reg,
                                                      int src_fixed_offset,
                                                      int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (uint8_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2b_offset_reg_to_indir_offset(struct sl_execution *exec,
-                                                       uint8_t row,
+                                                       sl_exec_row_t row,
                                                        int dst_indir_reg,
                                                        int dst_offset_reg,
                                                        int dst_fixed_offset,
@@ -2326,77 +2326,77 @@ static void sl_reg_move_i2b_offset_reg_to_indir_offset(struct sl_execution *exec
                                                        int src_offset_reg,
                                                        int src_fixed_offset,
                                                        int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (uint8_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2b_indir_offset_to_reg(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_reg,
                                                 int src_indir_reg,
                                                 int src_offset_reg,
                                                 int src_fixed_offset,
                                                 int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
   uint8_t * restrict dst = dst_reg_bank[dst_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst + row;
-    const int64_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (uint8_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2b_indir_offset_to_indir(struct sl_execution *exec,
-                                                  uint8_t row,
+                                                  sl_exec_row_t row,
                                                   int dst_indir_reg,
                                                   int dst_fixed_offset,
                                                   int src_indir_reg,
                                                   int src_offset_reg,
                                                   int src_fixed_offset,
                                                   int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (uint8_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2b_indir_offset_to_offset_reg(struct sl_execution *exec,
-                                                       uint8_t row,
+                                                       sl_exec_row_t row,
                                                        int dst_base_reg,
                                                        int dst_offset_reg,
                                                        int dst_fixed_offset,
@@ -2405,26 +2405,26 @@ static void sl_reg_move_i2b_indir_offset_to_offset_reg(struct sl_execution *exec
                                                        int src_offset_reg,
                                                        int src_fixed_offset,
                                                        int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (uint8_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_i2b_indir_offset_to_indir_offset(struct sl_execution *exec,
-                                                         uint8_t row,
+                                                         sl_exec_row_t row,
                                                          int dst_indir_reg,
                                                          int dst_offset_reg,
                                                          int dst_fixed_offset,
@@ -2433,30 +2433,30 @@ static void sl_reg_move_i2b_indir_offset_to_indir_offset(struct sl_execution *ex
                                                          int src_offset_reg,
                                                          int src_fixed_offset,
                                                          int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  int64_t * restrict * restrict src_reg_bank = exec->int_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_int_t * restrict * restrict src_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
-    const int64_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
+    const sl_exec_int_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (uint8_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2f_reg_to_reg(struct sl_execution *exec,
-                                       uint8_t row,
+                                       sl_exec_row_t row,
                                        int dst_reg,
                                        int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
   float * restrict dst = dst_reg_bank[dst_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
@@ -2467,20 +2467,20 @@ static void sl_reg_move_b2f_reg_to_reg(struct sl_execution *exec,
 
     *dst_row = (float)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2f_reg_to_indir(struct sl_execution *exec,
-                                         uint8_t row,
+                                         sl_exec_row_t row,
                                          int dst_indir_reg,
                                          int dst_fixed_offset,
                                          int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
   const uint8_t * restrict src = src_reg_bank[src_reg];
   for (;;) {
@@ -2489,22 +2489,22 @@ static void sl_reg_move_b2f_reg_to_indir(struct sl_execution *exec,
 
     *dst_row = (float)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2f_reg_to_offset_reg(struct sl_execution *exec,
-                                              uint8_t row,
+                                              sl_exec_row_t row,
                                               int dst_base_reg,
                                               int dst_offset_reg,
                                               int dst_fixed_offset,
                                               int dst_offset_stepsize,
                                               int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
   const uint8_t * restrict src = src_reg_bank[src_reg];
   for (;;) {
@@ -2513,23 +2513,23 @@ static void sl_reg_move_b2f_reg_to_offset_reg(struct sl_execution *exec,
 
     *dst_row = (float)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2f_reg_to_indir_offset(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_indir_reg,
                                                 int dst_offset_reg,
                                                 int dst_fixed_offset,
                                                 int dst_offset_stepsize,
                                                 int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
   const uint8_t * restrict src = src_reg_bank[src_reg];
   for (;;) {
@@ -2538,159 +2538,159 @@ static void sl_reg_move_b2f_reg_to_indir_offset(struct sl_execution *exec,
 
     *dst_row = (float)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2f_indir_to_reg(struct sl_execution *exec,
-                                         uint8_t row,
+                                         sl_exec_row_t row,
                                          int dst_reg,
                                          int src_indir_reg,
                                          int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
   float * restrict dst = dst_reg_bank[dst_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     float * restrict dst_row = dst + row;
     const uint8_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = (float)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2f_indir_to_indir(struct sl_execution *exec,
-                                           uint8_t row,
+                                           sl_exec_row_t row,
                                            int dst_indir_reg,
                                            int dst_fixed_offset,
                                            int src_indir_reg,
                                            int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = (float)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2f_indir_to_offset_reg(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_base_reg,
                                                 int dst_offset_reg,
                                                 int dst_fixed_offset,
                                                 int dst_offset_stepsize,
                                                 int src_indir_reg,
                                                 int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = (float)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2f_indir_to_indir_offset(struct sl_execution *exec,
-                                                  uint8_t row,
+                                                  sl_exec_row_t row,
                                                   int dst_indir_reg,
                                                   int dst_offset_reg,
                                                   int dst_fixed_offset,
                                                   int dst_offset_stepsize,
                                                   int src_indir_reg,
                                                   int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = (float)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2f_offset_reg_to_reg(struct sl_execution *exec,
-                                              uint8_t row,
+                                              sl_exec_row_t row,
                                               int dst_reg,
                                               int src_base_reg,
                                               int src_offset_reg,
                                               int src_fixed_offset,
                                               int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
   float * restrict dst = dst_reg_bank[dst_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     float * restrict dst_row = dst + row;
     const uint8_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (float)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2f_offset_reg_to_indir(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_indir_reg,
                                                 int dst_fixed_offset,
                                                 int src_base_reg,
                                                 int src_offset_reg,
                                                 int src_fixed_offset,
                                                 int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (float)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2f_offset_reg_to_offset_reg(struct sl_execution *exec,
-                                                     uint8_t row,
+                                                     sl_exec_row_t row,
                                                      int dst_base_reg,
                                                      int dst_offset_reg,
                                                      int dst_fixed_offset,
@@ -2699,25 +2699,25 @@ static void sl_reg_move_b2f_offset_reg_to_offset_reg(struct sl_execution *exec,
                                                      int src_offset_reg,
                                                      int src_fixed_offset,
                                                      int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (float)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2f_offset_reg_to_indir_offset(struct sl_execution *exec,
-                                                       uint8_t row,
+                                                       sl_exec_row_t row,
                                                        int dst_indir_reg,
                                                        int dst_offset_reg,
                                                        int dst_fixed_offset,
@@ -2726,77 +2726,77 @@ static void sl_reg_move_b2f_offset_reg_to_indir_offset(struct sl_execution *exec
                                                        int src_offset_reg,
                                                        int src_fixed_offset,
                                                        int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (float)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2f_indir_offset_to_reg(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_reg,
                                                 int src_indir_reg,
                                                 int src_offset_reg,
                                                 int src_fixed_offset,
                                                 int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
   float * restrict dst = dst_reg_bank[dst_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     float * restrict dst_row = dst + row;
     const uint8_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (float)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2f_indir_offset_to_indir(struct sl_execution *exec,
-                                                  uint8_t row,
+                                                  sl_exec_row_t row,
                                                   int dst_indir_reg,
                                                   int dst_fixed_offset,
                                                   int src_indir_reg,
                                                   int src_offset_reg,
                                                   int src_fixed_offset,
                                                   int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (float)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2f_indir_offset_to_offset_reg(struct sl_execution *exec,
-                                                       uint8_t row,
+                                                       sl_exec_row_t row,
                                                        int dst_base_reg,
                                                        int dst_offset_reg,
                                                        int dst_fixed_offset,
@@ -2805,26 +2805,26 @@ static void sl_reg_move_b2f_indir_offset_to_offset_reg(struct sl_execution *exec
                                                        int src_offset_reg,
                                                        int src_fixed_offset,
                                                        int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (float)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2f_indir_offset_to_indir_offset(struct sl_execution *exec,
-                                                         uint8_t row,
+                                                         sl_exec_row_t row,
                                                          int dst_indir_reg,
                                                          int dst_offset_reg,
                                                          int dst_fixed_offset,
@@ -2833,264 +2833,264 @@ static void sl_reg_move_b2f_indir_offset_to_indir_offset(struct sl_execution *ex
                                                          int src_offset_reg,
                                                          int src_fixed_offset,
                                                          int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   float * restrict * restrict dst_reg_bank = exec->float_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     float * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = (float)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2i_reg_to_reg(struct sl_execution *exec,
-                                       uint8_t row,
+                                       sl_exec_row_t row,
                                        int dst_reg,
                                        int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  int64_t * restrict dst = dst_reg_bank[dst_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  sl_exec_int_t * restrict dst = dst_reg_bank[dst_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
   const uint8_t * restrict src = src_reg_bank[src_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst + row;
+    sl_exec_int_t * restrict dst_row = dst + row;
     const uint8_t * restrict src_row = src + row;
 
-    *dst_row = (int64_t)(!!*src_row);
+    *dst_row = (sl_exec_int_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2i_reg_to_indir(struct sl_execution *exec,
-                                         uint8_t row,
+                                         sl_exec_row_t row,
                                          int dst_indir_reg,
                                          int dst_fixed_offset,
                                          int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
   const uint8_t * restrict src = src_reg_bank[src_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src + row;
 
-    *dst_row = (int64_t)(!!*src_row);
+    *dst_row = (sl_exec_int_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2i_reg_to_offset_reg(struct sl_execution *exec,
-                                              uint8_t row,
+                                              sl_exec_row_t row,
                                               int dst_base_reg,
                                               int dst_offset_reg,
                                               int dst_fixed_offset,
                                               int dst_offset_stepsize,
                                               int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
   const uint8_t * restrict src = src_reg_bank[src_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src + row;
 
-    *dst_row = (int64_t)(!!*src_row);
+    *dst_row = (sl_exec_int_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2i_reg_to_indir_offset(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_indir_reg,
                                                 int dst_offset_reg,
                                                 int dst_fixed_offset,
                                                 int dst_offset_stepsize,
                                                 int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
   const uint8_t * restrict src = src_reg_bank[src_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src + row;
 
-    *dst_row = (int64_t)(!!*src_row);
+    *dst_row = (sl_exec_int_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2i_indir_to_reg(struct sl_execution *exec,
-                                         uint8_t row,
+                                         sl_exec_row_t row,
                                          int dst_reg,
                                          int src_indir_reg,
                                          int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  int64_t * restrict dst = dst_reg_bank[dst_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  sl_exec_int_t * restrict dst = dst_reg_bank[dst_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst + row;
+    sl_exec_int_t * restrict dst_row = dst + row;
     const uint8_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
-    *dst_row = (int64_t)(!!*src_row);
+    *dst_row = (sl_exec_int_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2i_indir_to_indir(struct sl_execution *exec,
-                                           uint8_t row,
+                                           sl_exec_row_t row,
                                            int dst_indir_reg,
                                            int dst_fixed_offset,
                                            int src_indir_reg,
                                            int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
-    *dst_row = (int64_t)(!!*src_row);
+    *dst_row = (sl_exec_int_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2i_indir_to_offset_reg(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_base_reg,
                                                 int dst_offset_reg,
                                                 int dst_fixed_offset,
                                                 int dst_offset_stepsize,
                                                 int src_indir_reg,
                                                 int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
-    *dst_row = (int64_t)(!!*src_row);
+    *dst_row = (sl_exec_int_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2i_indir_to_indir_offset(struct sl_execution *exec,
-                                                  uint8_t row,
+                                                  sl_exec_row_t row,
                                                   int dst_indir_reg,
                                                   int dst_offset_reg,
                                                   int dst_fixed_offset,
                                                   int dst_offset_stepsize,
                                                   int src_indir_reg,
                                                   int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
-    *dst_row = (int64_t)(!!*src_row);
+    *dst_row = (sl_exec_int_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2i_offset_reg_to_reg(struct sl_execution *exec,
-                                              uint8_t row,
+                                              sl_exec_row_t row,
                                               int dst_reg,
                                               int src_base_reg,
                                               int src_offset_reg,
                                               int src_fixed_offset,
                                               int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  int64_t * restrict dst = dst_reg_bank[dst_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  sl_exec_int_t * restrict dst = dst_reg_bank[dst_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst + row;
+    sl_exec_int_t * restrict dst_row = dst + row;
     const uint8_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
-    *dst_row = (int64_t)(!!*src_row);
+    *dst_row = (sl_exec_int_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2i_offset_reg_to_indir(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_indir_reg,
                                                 int dst_fixed_offset,
                                                 int src_base_reg,
                                                 int src_offset_reg,
                                                 int src_fixed_offset,
                                                 int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
-    *dst_row = (int64_t)(!!*src_row);
+    *dst_row = (sl_exec_int_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2i_offset_reg_to_offset_reg(struct sl_execution *exec,
-                                                     uint8_t row,
+                                                     sl_exec_row_t row,
                                                      int dst_base_reg,
                                                      int dst_offset_reg,
                                                      int dst_fixed_offset,
@@ -3099,25 +3099,25 @@ static void sl_reg_move_b2i_offset_reg_to_offset_reg(struct sl_execution *exec,
                                                      int src_offset_reg,
                                                      int src_fixed_offset,
                                                      int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
-    *dst_row = (int64_t)(!!*src_row);
+    *dst_row = (sl_exec_int_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2i_offset_reg_to_indir_offset(struct sl_execution *exec,
-                                                       uint8_t row,
+                                                       sl_exec_row_t row,
                                                        int dst_indir_reg,
                                                        int dst_offset_reg,
                                                        int dst_fixed_offset,
@@ -3126,77 +3126,77 @@ static void sl_reg_move_b2i_offset_reg_to_indir_offset(struct sl_execution *exec
                                                        int src_offset_reg,
                                                        int src_fixed_offset,
                                                        int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
-    *dst_row = (int64_t)(!!*src_row);
+    *dst_row = (sl_exec_int_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2i_indir_offset_to_reg(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_reg,
                                                 int src_indir_reg,
                                                 int src_offset_reg,
                                                 int src_fixed_offset,
                                                 int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  int64_t * restrict dst = dst_reg_bank[dst_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  sl_exec_int_t * restrict dst = dst_reg_bank[dst_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst + row;
+    sl_exec_int_t * restrict dst_row = dst + row;
     const uint8_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
-    *dst_row = (int64_t)(!!*src_row);
+    *dst_row = (sl_exec_int_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2i_indir_offset_to_indir(struct sl_execution *exec,
-                                                  uint8_t row,
+                                                  sl_exec_row_t row,
                                                   int dst_indir_reg,
                                                   int dst_fixed_offset,
                                                   int src_indir_reg,
                                                   int src_offset_reg,
                                                   int src_fixed_offset,
                                                   int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
-    *dst_row = (int64_t)(!!*src_row);
+    *dst_row = (sl_exec_int_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2i_indir_offset_to_offset_reg(struct sl_execution *exec,
-                                                       uint8_t row,
+                                                       sl_exec_row_t row,
                                                        int dst_base_reg,
                                                        int dst_offset_reg,
                                                        int dst_fixed_offset,
@@ -3205,26 +3205,26 @@ static void sl_reg_move_b2i_indir_offset_to_offset_reg(struct sl_execution *exec
                                                        int src_offset_reg,
                                                        int src_fixed_offset,
                                                        int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
-    *dst_row = (int64_t)(!!*src_row);
+    *dst_row = (sl_exec_int_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b2i_indir_offset_to_indir_offset(struct sl_execution *exec,
-                                                         uint8_t row,
+                                                         sl_exec_row_t row,
                                                          int dst_indir_reg,
                                                          int dst_offset_reg,
                                                          int dst_fixed_offset,
@@ -3233,31 +3233,31 @@ static void sl_reg_move_b2i_indir_offset_to_indir_offset(struct sl_execution *ex
                                                          int src_offset_reg,
                                                          int src_fixed_offset,
                                                          int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
-  int64_t * restrict * restrict dst_reg_bank = exec->int_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_int_t * restrict * restrict dst_reg_bank = exec->int_regs_;
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
-    int64_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
+    sl_exec_int_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
-    *dst_row = (int64_t)(!!*src_row);
+    *dst_row = (sl_exec_int_t)(!!*src_row);
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b_reg_to_reg(struct sl_execution *exec,
-                                     uint8_t row,
+                                     sl_exec_row_t row,
                                      int dst_reg,
                                      int src_reg) {
   if (dst_reg == src_reg) return;
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
   uint8_t * restrict dst = dst_reg_bank[dst_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
@@ -3268,20 +3268,20 @@ static void sl_reg_move_b_reg_to_reg(struct sl_execution *exec,
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b_reg_to_indir(struct sl_execution *exec,
-                                       uint8_t row,
+                                       sl_exec_row_t row,
                                        int dst_indir_reg,
                                        int dst_fixed_offset,
                                        int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
   const uint8_t * restrict src = src_reg_bank[src_reg];
   for (;;) {
@@ -3290,22 +3290,22 @@ static void sl_reg_move_b_reg_to_indir(struct sl_execution *exec,
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b_reg_to_offset_reg(struct sl_execution *exec,
-                                            uint8_t row,
+                                            sl_exec_row_t row,
                                             int dst_base_reg,
                                             int dst_offset_reg,
                                             int dst_fixed_offset,
                                             int dst_offset_stepsize,
                                             int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
   const uint8_t * restrict src = src_reg_bank[src_reg];
   for (;;) {
@@ -3314,23 +3314,23 @@ static void sl_reg_move_b_reg_to_offset_reg(struct sl_execution *exec,
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b_reg_to_indir_offset(struct sl_execution *exec,
-                                              uint8_t row,
+                                              sl_exec_row_t row,
                                               int dst_indir_reg,
                                               int dst_offset_reg,
                                               int dst_fixed_offset,
                                               int dst_offset_stepsize,
                                               int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
   const uint8_t * restrict src = src_reg_bank[src_reg];
   for (;;) {
@@ -3339,160 +3339,160 @@ static void sl_reg_move_b_reg_to_indir_offset(struct sl_execution *exec,
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b_indir_to_reg(struct sl_execution *exec,
-                                       uint8_t row,
+                                       sl_exec_row_t row,
                                        int dst_reg,
                                        int src_indir_reg,
                                        int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
   uint8_t * restrict dst = dst_reg_bank[dst_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst + row;
     const uint8_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b_indir_to_indir(struct sl_execution *exec,
-                                         uint8_t row,
+                                         sl_exec_row_t row,
                                          int dst_indir_reg,
                                          int dst_fixed_offset,
                                          int src_indir_reg,
                                          int src_fixed_offset) {
   if ((dst_indir_reg == src_indir_reg) && (dst_fixed_offset == src_fixed_offset)) return;
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b_indir_to_offset_reg(struct sl_execution *exec,
-                                              uint8_t row,
+                                              sl_exec_row_t row,
                                               int dst_base_reg,
                                               int dst_offset_reg,
                                               int dst_fixed_offset,
                                               int dst_offset_stepsize,
                                               int src_indir_reg,
                                               int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b_indir_to_indir_offset(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_indir_reg,
                                                 int dst_offset_reg,
                                                 int dst_fixed_offset,
                                                 int dst_offset_stepsize,
                                                 int src_indir_reg,
                                                 int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src_reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b_offset_reg_to_reg(struct sl_execution *exec,
-                                            uint8_t row,
+                                            sl_exec_row_t row,
                                             int dst_reg,
                                             int src_base_reg,
                                             int src_offset_reg,
                                             int src_fixed_offset,
                                             int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
   uint8_t * restrict dst = dst_reg_bank[dst_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst + row;
     const uint8_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b_offset_reg_to_indir(struct sl_execution *exec,
-                                              uint8_t row,
+                                              sl_exec_row_t row,
                                               int dst_indir_reg,
                                               int dst_fixed_offset,
                                               int src_base_reg,
                                               int src_offset_reg,
                                               int src_fixed_offset,
                                               int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b_offset_reg_to_offset_reg(struct sl_execution *exec,
-                                                   uint8_t row,
+                                                   sl_exec_row_t row,
                                                    int dst_base_reg,
                                                    int dst_offset_reg,
                                                    int dst_fixed_offset,
@@ -3504,25 +3504,25 @@ static void sl_reg_move_b_offset_reg_to_offset_reg(struct sl_execution *exec,
   if ((dst_base_reg == src_base_reg) && (dst_offset_reg == src_offset_reg) && 
       (dst_fixed_offset == src_fixed_offset) && (dst_offset_stepsize == src_offset_stepsize))
     return;
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b_offset_reg_to_indir_offset(struct sl_execution *exec,
-                                                     uint8_t row,
+                                                     sl_exec_row_t row,
                                                      int dst_indir_reg,
                                                      int dst_offset_reg,
                                                      int dst_fixed_offset,
@@ -3531,77 +3531,77 @@ static void sl_reg_move_b_offset_reg_to_indir_offset(struct sl_execution *exec,
                                                      int src_offset_reg,
                                                      int src_fixed_offset,
                                                      int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src_reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b_indir_offset_to_reg(struct sl_execution *exec,
-                                              uint8_t row,
+                                              sl_exec_row_t row,
                                               int dst_reg,
                                               int src_indir_reg,
                                               int src_offset_reg,
                                               int src_fixed_offset,
                                               int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
   uint8_t * restrict dst = dst_reg_bank[dst_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst + row;
     const uint8_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b_indir_offset_to_indir(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_indir_reg,
                                                 int dst_fixed_offset,
                                                 int src_indir_reg,
                                                 int src_offset_reg,
                                                 int src_fixed_offset,
                                                 int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b_indir_offset_to_offset_reg(struct sl_execution *exec,
-                                                     uint8_t row,
+                                                     sl_exec_row_t row,
                                                      int dst_base_reg,
                                                      int dst_offset_reg,
                                                      int dst_fixed_offset,
@@ -3610,26 +3610,26 @@ static void sl_reg_move_b_indir_offset_to_offset_reg(struct sl_execution *exec,
                                                      int src_offset_reg,
                                                      int src_fixed_offset,
                                                      int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_b_indir_offset_to_indir_offset(struct sl_execution *exec,
-                                                       uint8_t row,
+                                                       sl_exec_row_t row,
                                                        int dst_indir_reg,
                                                        int dst_offset_reg,
                                                        int dst_fixed_offset,
@@ -3641,30 +3641,30 @@ static void sl_reg_move_b_indir_offset_to_indir_offset(struct sl_execution *exec
   if ((dst_indir_reg == src_indir_reg) && (dst_offset_reg == src_offset_reg) && 
       (dst_fixed_offset == src_fixed_offset) && (dst_offset_stepsize == src_offset_stepsize))
     return;
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   uint8_t * restrict * restrict dst_reg_bank = exec->bool_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   uint8_t * restrict * restrict src_reg_bank = exec->bool_regs_;
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     uint8_t * restrict dst_row = dst_reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     const uint8_t * restrict src_row = src_reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_s2d_reg_to_reg(struct sl_execution *exec,
-                                       uint8_t row,
+                                       sl_exec_row_t row,
                                        int dst_reg,
                                        int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_2D_regs_;
   void * restrict * restrict dst = reg_bank[dst_reg];
   void * const restrict * restrict src = reg_bank[src_reg];
@@ -3674,20 +3674,20 @@ static void sl_reg_move_s2d_reg_to_reg(struct sl_execution *exec,
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_s2d_reg_to_indir(struct sl_execution *exec,
-                                         uint8_t row,
+                                         sl_exec_row_t row,
                                          int dst_indir_reg,
                                          int dst_fixed_offset,
                                          int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_2D_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
   void * const restrict * restrict src = reg_bank[src_reg];
   for (;;) {
     void * restrict * restrict dst_row = reg_bank[dst_indir[row] + dst_fixed_offset] + row;
@@ -3695,22 +3695,22 @@ static void sl_reg_move_s2d_reg_to_indir(struct sl_execution *exec,
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_s2d_reg_to_offset_reg(struct sl_execution *exec,
-                                              uint8_t row,
+                                              sl_exec_row_t row,
                                               int dst_base_reg,
                                               int dst_offset_reg,
                                               int dst_fixed_offset,
                                               int dst_offset_stepsize,
                                               int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_2D_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   void * const restrict * restrict src = reg_bank[src_reg];
   for (;;) {
     void * restrict * restrict dst_row = reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
@@ -3718,23 +3718,23 @@ static void sl_reg_move_s2d_reg_to_offset_reg(struct sl_execution *exec,
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_s2d_reg_to_indir_offset(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_indir_reg,
                                                 int dst_offset_reg,
                                                 int dst_fixed_offset,
                                                 int dst_offset_stepsize,
                                                 int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_2D_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   void * const restrict * restrict src = reg_bank[src_reg];
   for (;;) {
     void * restrict * restrict dst_row = reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
@@ -3742,153 +3742,153 @@ static void sl_reg_move_s2d_reg_to_indir_offset(struct sl_execution *exec,
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_s2d_indir_to_reg(struct sl_execution *exec,
-                                         uint8_t row,
+                                         sl_exec_row_t row,
                                          int dst_reg,
                                          int src_indir_reg,
                                          int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_2D_regs_;
   void * restrict * restrict dst = reg_bank[dst_reg];
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     void * restrict * restrict dst_row = dst + row;
     void * const restrict * restrict src_row = reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_s2d_indir_to_indir(struct sl_execution *exec,
-                                           uint8_t row,
+                                           sl_exec_row_t row,
                                            int dst_indir_reg,
                                            int dst_fixed_offset,
                                            int src_indir_reg,
                                            int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_2D_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     void * restrict * restrict dst_row = reg_bank[dst_indir[row] + dst_fixed_offset] + row;
     void * const restrict * restrict src_row = reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_s2d_indir_to_offset_reg(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_base_reg,
                                                 int dst_offset_reg,
                                                 int dst_fixed_offset,
                                                 int dst_offset_stepsize,
                                                 int src_indir_reg,
                                                 int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_2D_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     void * restrict * restrict dst_row = reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     void * const restrict * restrict src_row = reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_s2d_indir_to_indir_offset(struct sl_execution *exec,
-                                                  uint8_t row,
+                                                  sl_exec_row_t row,
                                                   int dst_indir_reg,
                                                   int dst_offset_reg,
                                                   int dst_fixed_offset,
                                                   int dst_offset_stepsize,
                                                   int src_indir_reg,
                                                   int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_2D_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     void * restrict * restrict dst_row = reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     void * const restrict * restrict src_row = reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_s2d_offset_reg_to_reg(struct sl_execution *exec,
-                                              uint8_t row,
+                                              sl_exec_row_t row,
                                               int dst_reg,
                                               int src_base_reg,
                                               int src_offset_reg,
                                               int src_fixed_offset,
                                               int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_2D_regs_;
   void * restrict * restrict dst = reg_bank[dst_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     void * restrict * restrict dst_row = dst + row;
     void * const restrict * restrict src_row = reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_s2d_offset_reg_to_indir(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_indir_reg,
                                                 int dst_fixed_offset,
                                                 int src_base_reg,
                                                 int src_offset_reg,
                                                 int src_fixed_offset,
                                                 int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_2D_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     void * restrict * restrict dst_row = reg_bank[dst_indir[row] + dst_fixed_offset] + row;
     void * const restrict * restrict src_row = reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_s2d_offset_reg_to_offset_reg(struct sl_execution *exec,
-                                                     uint8_t row,
+                                                     sl_exec_row_t row,
                                                      int dst_base_reg,
                                                      int dst_offset_reg,
                                                      int dst_fixed_offset,
@@ -3897,24 +3897,24 @@ static void sl_reg_move_s2d_offset_reg_to_offset_reg(struct sl_execution *exec,
                                                      int src_offset_reg,
                                                      int src_fixed_offset,
                                                      int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_2D_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     void * restrict * restrict dst_row = reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     void * const restrict * restrict src_row = reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_s2d_offset_reg_to_indir_offset(struct sl_execution *exec,
-                                                       uint8_t row,
+                                                       sl_exec_row_t row,
                                                        int dst_indir_reg,
                                                        int dst_offset_reg,
                                                        int dst_fixed_offset,
@@ -3923,74 +3923,74 @@ static void sl_reg_move_s2d_offset_reg_to_indir_offset(struct sl_execution *exec
                                                        int src_offset_reg,
                                                        int src_fixed_offset,
                                                        int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_2D_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     void * restrict * restrict dst_row = reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     void * const restrict * restrict src_row = reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_s2d_indir_offset_to_reg(struct sl_execution *exec,
-                                                uint8_t row,
+                                                sl_exec_row_t row,
                                                 int dst_reg,
                                                 int src_indir_reg,
                                                 int src_offset_reg,
                                                 int src_fixed_offset,
                                                 int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_2D_regs_;
   void * restrict * restrict dst = reg_bank[dst_reg];
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     void * restrict * restrict dst_row = dst + row;
     void * const restrict * restrict src_row = reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_s2d_indir_offset_to_indir(struct sl_execution *exec,
-                                                  uint8_t row,
+                                                  sl_exec_row_t row,
                                                   int dst_indir_reg,
                                                   int dst_fixed_offset,
                                                   int src_indir_reg,
                                                   int src_offset_reg,
                                                   int src_fixed_offset,
                                                   int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_2D_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     void * restrict * restrict dst_row = reg_bank[dst_indir[row] + dst_fixed_offset] + row;
     void * const restrict * restrict src_row = reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_s2d_indir_offset_to_offset_reg(struct sl_execution *exec,
-                                                       uint8_t row,
+                                                       sl_exec_row_t row,
                                                        int dst_base_reg,
                                                        int dst_offset_reg,
                                                        int dst_fixed_offset,
@@ -3999,25 +3999,25 @@ static void sl_reg_move_s2d_indir_offset_to_offset_reg(struct sl_execution *exec
                                                        int src_offset_reg,
                                                        int src_fixed_offset,
                                                        int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_2D_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     void * restrict * restrict dst_row = reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     void * const restrict * restrict src_row = reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_s2d_indir_offset_to_indir_offset(struct sl_execution *exec,
-                                                         uint8_t row,
+                                                         sl_exec_row_t row,
                                                          int dst_indir_reg,
                                                          int dst_offset_reg,
                                                          int dst_fixed_offset,
@@ -4026,29 +4026,29 @@ static void sl_reg_move_s2d_indir_offset_to_indir_offset(struct sl_execution *ex
                                                          int src_offset_reg,
                                                          int src_fixed_offset,
                                                          int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_2D_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     void * restrict * restrict dst_row = reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     void * const restrict * restrict src_row = reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_sc_reg_to_reg(struct sl_execution *exec,
-                                      uint8_t row,
+                                      sl_exec_row_t row,
                                       int dst_reg,
                                       int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_cube_regs_;
   void * restrict * restrict dst = reg_bank[dst_reg];
   void * const restrict * restrict src = reg_bank[src_reg];
@@ -4058,20 +4058,20 @@ static void sl_reg_move_sc_reg_to_reg(struct sl_execution *exec,
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_sc_reg_to_indir(struct sl_execution *exec,
-                                        uint8_t row,
+                                        sl_exec_row_t row,
                                         int dst_indir_reg,
                                         int dst_fixed_offset,
                                         int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_cube_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
   void * const restrict * restrict src = reg_bank[src_reg];
   for (;;) {
     void * restrict * restrict dst_row = reg_bank[dst_indir[row] + dst_fixed_offset] + row;
@@ -4079,22 +4079,22 @@ static void sl_reg_move_sc_reg_to_indir(struct sl_execution *exec,
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_sc_reg_to_offset_reg(struct sl_execution *exec,
-                                             uint8_t row,
+                                             sl_exec_row_t row,
                                              int dst_base_reg,
                                              int dst_offset_reg,
                                              int dst_fixed_offset,
                                              int dst_offset_stepsize,
                                              int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_cube_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   void * const restrict * restrict src = reg_bank[src_reg];
   for (;;) {
     void * restrict * restrict dst_row = reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
@@ -4102,23 +4102,23 @@ static void sl_reg_move_sc_reg_to_offset_reg(struct sl_execution *exec,
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_sc_reg_to_indir_offset(struct sl_execution *exec,
-                                               uint8_t row,
+                                               sl_exec_row_t row,
                                                int dst_indir_reg,
                                                int dst_offset_reg,
                                                int dst_fixed_offset,
                                                int dst_offset_stepsize,
                                                int src_reg) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_cube_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
   void * const restrict * restrict src = reg_bank[src_reg];
   for (;;) {
     void * restrict * restrict dst_row = reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
@@ -4126,153 +4126,153 @@ static void sl_reg_move_sc_reg_to_indir_offset(struct sl_execution *exec,
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_sc_indir_to_reg(struct sl_execution *exec,
-                                        uint8_t row,
+                                        sl_exec_row_t row,
                                         int dst_reg,
                                         int src_indir_reg,
                                         int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_cube_regs_;
   void * restrict * restrict dst = reg_bank[dst_reg];
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     void * restrict * restrict dst_row = dst + row;
     void * const restrict * restrict src_row = reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_sc_indir_to_indir(struct sl_execution *exec,
-                                          uint8_t row,
+                                          sl_exec_row_t row,
                                           int dst_indir_reg,
                                           int dst_fixed_offset,
                                           int src_indir_reg,
                                           int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_cube_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     void * restrict * restrict dst_row = reg_bank[dst_indir[row] + dst_fixed_offset] + row;
     void * const restrict * restrict src_row = reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_sc_indir_to_offset_reg(struct sl_execution *exec,
-                                               uint8_t row,
+                                               sl_exec_row_t row,
                                                int dst_base_reg,
                                                int dst_offset_reg,
                                                int dst_fixed_offset,
                                                int dst_offset_stepsize,
                                                int src_indir_reg,
                                                int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_cube_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     void * restrict * restrict dst_row = reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     void * const restrict * restrict src_row = reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_sc_indir_to_indir_offset(struct sl_execution *exec,
-                                                 uint8_t row,
+                                                 sl_exec_row_t row,
                                                  int dst_indir_reg,
                                                  int dst_offset_reg,
                                                  int dst_fixed_offset,
                                                  int dst_offset_stepsize,
                                                  int src_indir_reg,
                                                  int src_fixed_offset) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_cube_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
   for (;;) {
     void * restrict * restrict dst_row = reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     void * const restrict * restrict src_row = reg_bank[src_indir[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_sc_offset_reg_to_reg(struct sl_execution *exec,
-                                             uint8_t row,
+                                             sl_exec_row_t row,
                                              int dst_reg,
                                              int src_base_reg,
                                              int src_offset_reg,
                                              int src_fixed_offset,
                                              int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_cube_regs_;
   void * restrict * restrict dst = reg_bank[dst_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     void * restrict * restrict dst_row = dst + row;
     void * const restrict * restrict src_row = reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_sc_offset_reg_to_indir(struct sl_execution *exec,
-                                               uint8_t row,
+                                               sl_exec_row_t row,
                                                int dst_indir_reg,
                                                int dst_fixed_offset,
                                                int src_base_reg,
                                                int src_offset_reg,
                                                int src_fixed_offset,
                                                int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_cube_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     void * restrict * restrict dst_row = reg_bank[dst_indir[row] + dst_fixed_offset] + row;
     void * const restrict * restrict src_row = reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_sc_offset_reg_to_offset_reg(struct sl_execution *exec,
-                                                    uint8_t row,
+                                                    sl_exec_row_t row,
                                                     int dst_base_reg,
                                                     int dst_offset_reg,
                                                     int dst_fixed_offset,
@@ -4281,24 +4281,24 @@ static void sl_reg_move_sc_offset_reg_to_offset_reg(struct sl_execution *exec,
                                                     int src_offset_reg,
                                                     int src_fixed_offset,
                                                     int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_cube_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     void * restrict * restrict dst_row = reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     void * const restrict * restrict src_row = reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_sc_offset_reg_to_indir_offset(struct sl_execution *exec,
-                                                      uint8_t row,
+                                                      sl_exec_row_t row,
                                                       int dst_indir_reg,
                                                       int dst_offset_reg,
                                                       int dst_fixed_offset,
@@ -4307,74 +4307,74 @@ static void sl_reg_move_sc_offset_reg_to_indir_offset(struct sl_execution *exec,
                                                       int src_offset_reg,
                                                       int src_fixed_offset,
                                                       int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_cube_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     void * restrict * restrict dst_row = reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     void * const restrict * restrict src_row = reg_bank[src_base_reg + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_sc_indir_offset_to_reg(struct sl_execution *exec,
-                                               uint8_t row,
+                                               sl_exec_row_t row,
                                                int dst_reg,
                                                int src_indir_reg,
                                                int src_offset_reg,
                                                int src_fixed_offset,
                                                int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_cube_regs_;
   void * restrict * restrict dst = reg_bank[dst_reg];
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     void * restrict * restrict dst_row = dst + row;
     void * const restrict * restrict src_row = reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_sc_indir_offset_to_indir(struct sl_execution *exec,
-                                                 uint8_t row,
+                                                 sl_exec_row_t row,
                                                  int dst_indir_reg,
                                                  int dst_fixed_offset,
                                                  int src_indir_reg,
                                                  int src_offset_reg,
                                                  int src_fixed_offset,
                                                  int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_cube_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     void * restrict * restrict dst_row = reg_bank[dst_indir[row] + dst_fixed_offset] + row;
     void * const restrict * restrict src_row = reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_sc_indir_offset_to_offset_reg(struct sl_execution *exec,
-                                                      uint8_t row,
+                                                      sl_exec_row_t row,
                                                       int dst_base_reg,
                                                       int dst_offset_reg,
                                                       int dst_fixed_offset,
@@ -4383,25 +4383,25 @@ static void sl_reg_move_sc_indir_offset_to_offset_reg(struct sl_execution *exec,
                                                       int src_offset_reg,
                                                       int src_fixed_offset,
                                                       int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_cube_regs_;
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     void * restrict * restrict dst_row = reg_bank[dst_base_reg + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     void * const restrict * restrict src_row = reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 static void sl_reg_move_sc_indir_offset_to_indir_offset(struct sl_execution *exec,
-                                                        uint8_t row,
+                                                        sl_exec_row_t row,
                                                         int dst_indir_reg,
                                                         int dst_offset_reg,
                                                         int dst_fixed_offset,
@@ -4410,26 +4410,26 @@ static void sl_reg_move_sc_indir_offset_to_indir_offset(struct sl_execution *exe
                                                         int src_offset_reg,
                                                         int src_fixed_offset,
                                                         int src_offset_stepsize) {
-  uint8_t * restrict chain_column = exec->exec_chain_reg_;
+  sl_exec_row_t * restrict chain_column = exec->exec_chain_reg_;
   void * restrict * restrict * restrict reg_bank = exec->sampler_cube_regs_;
-  const int64_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
-  const int64_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
-  const int64_t * restrict src_indir = exec->int_regs_[src_indir_reg];
-  const int64_t * restrict src_offset = exec->int_regs_[src_offset_reg];
+  const sl_exec_int_t * restrict dst_indir = exec->int_regs_[dst_indir_reg];
+  const sl_exec_int_t * restrict dst_offset = exec->int_regs_[dst_offset_reg];
+  const sl_exec_int_t * restrict src_indir = exec->int_regs_[src_indir_reg];
+  const sl_exec_int_t * restrict src_offset = exec->int_regs_[src_offset_reg];
   for (;;) {
     void * restrict * restrict dst_row = reg_bank[dst_indir[row] + dst_offset_stepsize * dst_offset[row] + dst_fixed_offset] + row;
     void * const restrict * restrict src_row = reg_bank[src_indir[row] + src_offset_stepsize * src_offset[row] + src_fixed_offset] + row;
 
     *dst_row = *src_row;
 
-    uint8_t delta = chain_column[row];
+    sl_exec_row_t delta = chain_column[row];
     if (!delta) return;
     row += delta;
   }
 }
 
 void sl_reg_move_crossframe(struct sl_execution *exec,
-                            uint8_t row,
+                            sl_exec_row_t row,
                             int from_frame, struct sl_reg_alloc *from_ra, struct sl_reg_alloc *from_ra_offset,
                             int to_frame, struct sl_reg_alloc *to_ra, struct sl_reg_alloc *to_ra_offset,
                             int from_offset_step_size, int to_offset_step_size,
@@ -7214,7 +7214,7 @@ else {
 }
 
 void sl_reg_move_crossframe_c2c(struct sl_execution *exec,
-                              uint8_t row,
+                              sl_exec_row_t row,
                               int from_frame, struct sl_reg_alloc *from_ra, struct sl_reg_alloc *from_ra_offset, int from_component,
                               int to_frame, struct sl_reg_alloc *to_ra, struct sl_reg_alloc *to_ra_offset, int to_component,
                               int from_offset_step_size, int to_offset_step_size,
@@ -9185,16 +9185,157 @@ void sl_reg_move_crossframe_c2c(struct sl_execution *exec,
   }
 }
 
+/* Column categories, in the order in which the SLIR_REG_MOVE_XXX conversions are enumerated. */
+#define SL_REG_EMIT_CAT_FLOAT 0
+#define SL_REG_EMIT_CAT_INT 1
+#define SL_REG_EMIT_CAT_BOOL 2
+#define SL_REG_EMIT_CAT_SAMPLER2D 3
+#define SL_REG_EMIT_CAT_SAMPLERCUBE 4
+
+/* Addressing modes, in the order in which the SLIR_REG_MOVE_XXX opcodes are enumerated. */
+#define SL_REG_EMIT_MODE_REG 0
+#define SL_REG_EMIT_MODE_INDIR 1
+#define SL_REG_EMIT_MODE_OFFSET_REG 2
+#define SL_REG_EMIT_MODE_INDIR_OFFSET 3
+
+/* One side (source or destination) of a register move, fully resolved to absolute register indices */
+struct sl_reg_emit_side {
+  int mode_;
+  int reg_; /* register (SL_REG_EMIT_MODE_REG), base register (SL_REG_EMIT_MODE_OFFSET_REG) or integer register holding the register (indirect modes) */
+  int offset_reg_;
+  int fixed_offset_;
+  int offset_stepsize_;
+};
+
+static int sl_reg_emit_category(sl_reg_alloc_kind_t kind, int *num_components) {
+  switch (kind) {
+    case slrak_float: *num_components = 1; return SL_REG_EMIT_CAT_FLOAT;
+    case slrak_vec2:  *num_components = 2; return SL_REG_EMIT_CAT_FLOAT;
+    case slrak_vec3:  *num_components = 3; return SL_REG_EMIT_CAT_FLOAT;
+    case slrak_vec4:  *num_components = 4; return SL_REG_EMIT_CAT_FLOAT;
+    case slrak_mat2:  *num_components = 4; return SL_REG_EMIT_CAT_FLOAT;
+    case slrak_mat3:  *num_components = 9; return SL_REG_EMIT_CAT_FLOAT;
+    case slrak_mat4:  *num_components = 16; return SL_REG_EMIT_CAT_FLOAT;
+    case slrak_int:   *num_components = 1; return SL_REG_EMIT_CAT_INT;
+    case slrak_ivec2: *num_components = 2; return SL_REG_EMIT_CAT_INT;
+    case slrak_ivec3: *num_components = 3; return SL_REG_EMIT_CAT_INT;
+    case slrak_ivec4: *num_components = 4; return SL_REG_EMIT_CAT_INT;
+    case slrak_bool:  *num_components = 1; return SL_REG_EMIT_CAT_BOOL;
+    case slrak_bvec2: *num_components = 2; return SL_REG_EMIT_CAT_BOOL;
+    case slrak_bvec3: *num_components = 3; return SL_REG_EMIT_CAT_BOOL;
+    case slrak_bvec4: *num_components = 4; return SL_REG_EMIT_CAT_BOOL;
+    case slrak_sampler2D: *num_components = 1; return SL_REG_EMIT_CAT_SAMPLER2D;
+    case slrak_samplerCube: *num_components = 1; return SL_REG_EMIT_CAT_SAMPLERCUBE;
+    default: *num_components = 0; return -1;
+  }
+}
+
+static int sl_reg_emit_frame_offset(struct sl_execution_frame *frame, int cat) {
+  switch (cat) {
+    case SL_REG_EMIT_CAT_FLOAT: return frame->local_float_offset_;
+    case SL_REG_EMIT_CAT_INT: return frame->local_int_offset_;
+    case SL_REG_EMIT_CAT_BOOL: return frame->local_bool_offset_;
+    case SL_REG_EMIT_CAT_SAMPLER2D: return frame->local_sampler2D_offset_;
+    case SL_REG_EMIT_CAT_SAMPLERCUBE: return frame->local_samplerCube_offset_;
+  }
+  return 0;
+}
+
+/* Resolves one side of the move the same way sl_reg_move_crossframe() does at runtime: direct registers are
+ * relative to the frame offset of their category, indirect and offset registers are integer registers. */
+static void sl_reg_emit_resolve(struct sl_reg_emit_side *side, struct sl_execution_frame *frame, int cat,
+                                struct sl_reg_alloc *ra, struct sl_reg_alloc *ra_offset, int component, int k, int offset_stepsize) {
+  int have_offset = ra_offset && (ra_offset->kind_ != slrak_void);
+  if (ra->is_indirect_) {
+    side->reg_ = (ra->local_frame_ ? frame->local_int_offset_ : 0) + ra->v_.regs_[component];
+    side->fixed_offset_ = k;
+  }
+  else {
+    side->reg_ = (ra->local_frame_ ? sl_reg_emit_frame_offset(frame, cat) : 0) + ra->v_.regs_[component] + k;
+    side->fixed_offset_ = 0;
+  }
+  if (have_offset) {
+    side->offset_reg_ = (ra_offset->local_frame_ ? frame->local_int_offset_ : 0) + ra_offset->v_.regs_[0];
+    side->offset_stepsize_ = offset_stepsize;
+    side->mode_ = ra->is_indirect_ ? SL_REG_EMIT_MODE_INDIR_OFFSET : SL_REG_EMIT_MODE_OFFSET_REG;
+  }
+  else {
+    side->offset_reg_ = 0;
+    side->offset_stepsize_ = 0;
+    side->mode_ = ra->is_indirect_ ? SL_REG_EMIT_MODE_INDIR : SL_REG_EMIT_MODE_REG;
+  }
+}
+
+static struct ir_temp *sl_reg_emit_bank_temp(struct ir_body *body, int cat, int reg) {
+  switch (cat) {
+    case SL_REG_EMIT_CAT_FLOAT: return ir_body_alloc_temp_banked_float(body, reg);
+    case SL_REG_EMIT_CAT_INT: return ir_body_alloc_temp_banked_int(body, reg);
+    case SL_REG_EMIT_CAT_BOOL: return ir_body_alloc_temp_banked_bool(body, reg);
+    case SL_REG_EMIT_CAT_SAMPLER2D: return ir_body_alloc_temp_banked_sampler2D(body, reg);
+    case SL_REG_EMIT_CAT_SAMPLERCUBE: return ir_body_alloc_temp_banked_samplerCube(body, reg);
+  }
+  return NULL;
+}
+
+static void sl_reg_emit_side_operands(struct ir_instr *instr, int cat, const struct sl_reg_emit_side *side, int is_dst) {
+  struct ir_body *body = instr->block_->body_;
+  switch (side->mode_) {
+    case SL_REG_EMIT_MODE_REG:
+      if (is_dst) ir_instr_append_def(instr, sl_reg_emit_bank_temp(body, cat, side->reg_));
+      else ir_instr_append_use(instr, sl_reg_emit_bank_temp(body, cat, side->reg_));
+      break;
+    case SL_REG_EMIT_MODE_INDIR:
+      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(body, side->reg_));
+      ir_instr_append_use(instr, ir_body_alloc_temp_liti(body, side->fixed_offset_));
+      break;
+    case SL_REG_EMIT_MODE_OFFSET_REG:
+      if (is_dst) ir_instr_append_def(instr, sl_reg_emit_bank_temp(body, cat, side->reg_));
+      else ir_instr_append_use(instr, sl_reg_emit_bank_temp(body, cat, side->reg_));
+      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(body, side->offset_reg_));
+      ir_instr_append_use(instr, ir_body_alloc_temp_liti(body, side->fixed_offset_));
+      ir_instr_append_use(instr, ir_body_alloc_temp_liti(body, side->offset_stepsize_));
+      break;
+    case SL_REG_EMIT_MODE_INDIR_OFFSET:
+      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(body, side->reg_));
+      ir_instr_append_use(instr, ir_body_alloc_temp_banked_int(body, side->offset_reg_));
+      ir_instr_append_use(instr, ir_body_alloc_temp_liti(body, side->fixed_offset_));
+      ir_instr_append_use(instr, ir_body_alloc_temp_liti(body, side->offset_stepsize_));
+      break;
+  }
+}
+
+/* Emits a single SLIR_REG_MOVE_XXX instruction, operands are in the same order as the arguments
+ * to the corresponding sl_reg_move_xxx_to_xxx() kernel, preceded by the execution chain. */
+static void sl_reg_emit_move_instr(struct ir_block *blk, struct ir_temp *chain_reg,
+                                   int from_cat, const struct sl_reg_emit_side *from,
+                                   int to_cat, const struct sl_reg_emit_side *to) {
+  int conversion;
+  if (from_cat == SL_REG_EMIT_CAT_SAMPLER2D) conversion = 9;
+  else if (from_cat == SL_REG_EMIT_CAT_SAMPLERCUBE) conversion = 10;
+  else conversion = from_cat * 3 + to_cat;
+
+  if ((from_cat == to_cat) && (from->mode_ == SL_REG_EMIT_MODE_REG) && (to->mode_ == SL_REG_EMIT_MODE_REG) && (from->reg_ == to->reg_)) {
+    /* Move onto itself, no-op */
+    return;
+  }
+
+  struct ir_instr *instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_REG_TO_REG + conversion * 16 + from->mode_ * 4 + to->mode_);
+  if (!instr) return;
+  ir_instr_append_use(instr, chain_reg);
+  sl_reg_emit_side_operands(instr, to_cat, to, 1);
+  sl_reg_emit_side_operands(instr, from_cat, from, 0);
+}
+
 void sl_reg_emit_move_crossframe(struct ir_block *blk,
                                  struct ir_temp *chain_reg,
                                  struct sl_execution_frame *from_frame, struct sl_reg_alloc *from_ra, struct sl_reg_alloc *from_ra_offset,
                                  struct sl_execution_frame *to_frame, struct sl_reg_alloc *to_ra, struct sl_reg_alloc *to_ra_offset,
                                  int from_offset_step_size, int to_offset_step_size,
                                  int array_quantity) {
-  size_t num_components = 0;
-  int scalar_to_scalar_conversion = 0;
-  size_t n;
-  int k;
+  int num_components = 0, to_num_components = 0;
+  int from_cat, to_cat;
+  int n, k;
+  if (!blk) return;
   switch (from_ra->kind_) {
     case slrak_array: {
       if (from_ra->kind_ != to_ra->kind_) return;
@@ -9206,2766 +9347,29 @@ void sl_reg_emit_move_crossframe(struct ir_block *blk,
       return;
     }
     case slrak_struct: {
+      size_t fi;
       if (from_ra->kind_ != to_ra->kind_) return;
       if (from_ra->v_.comp_.num_fields_ != to_ra->v_.comp_.num_fields_) return;
-      for (n = 0; n < from_ra->v_.comp_.num_fields_; ++n) {
-        sl_reg_emit_move_crossframe(blk, chain_reg, from_frame, from_ra->v_.comp_.fields_ + n, from_ra_offset, to_frame, to_ra->v_.comp_.fields_ + n, to_ra_offset, from_offset_step_size, to_offset_step_size, array_quantity);
+      for (fi = 0; fi < from_ra->v_.comp_.num_fields_; ++fi) {
+        sl_reg_emit_move_crossframe(blk, chain_reg, from_frame, from_ra->v_.comp_.fields_ + fi, from_ra_offset, to_frame, to_ra->v_.comp_.fields_ + fi, to_ra_offset, from_offset_step_size, to_offset_step_size, array_quantity);
       }
       return;
     }
-    case slrak_float: num_components = 1; scalar_to_scalar_conversion = 0x10; break;
-    case slrak_vec2:  num_components = 2; scalar_to_scalar_conversion = 0x10; break;
-    case slrak_vec3:  num_components = 3; scalar_to_scalar_conversion = 0x10; break;
-    case slrak_vec4:  num_components = 4; scalar_to_scalar_conversion = 0x10; break;
-    case slrak_mat2:  num_components = 4; scalar_to_scalar_conversion = 0x10; break;
-    case slrak_mat3:  num_components = 9; scalar_to_scalar_conversion = 0x10; break;
-    case slrak_mat4:  num_components = 16; scalar_to_scalar_conversion = 0x10; break;
-    case slrak_int:   num_components = 1; scalar_to_scalar_conversion = 0x20; break;
-    case slrak_ivec2: num_components = 2; scalar_to_scalar_conversion = 0x20; break;
-    case slrak_ivec3: num_components = 3; scalar_to_scalar_conversion = 0x20; break;
-    case slrak_ivec4: num_components = 4; scalar_to_scalar_conversion = 0x20; break;
-    case slrak_bool:  num_components = 1; scalar_to_scalar_conversion = 0x30; break;
-    case slrak_bvec2: num_components = 2; scalar_to_scalar_conversion = 0x30; break;
-    case slrak_bvec3: num_components = 3; scalar_to_scalar_conversion = 0x30; break;
-    case slrak_bvec4: num_components = 4; scalar_to_scalar_conversion = 0x30; break;
-  }
-  switch (to_ra->kind_) {
-    case slrak_float: if (num_components != 1) return; scalar_to_scalar_conversion += 0x1; break;
-    case slrak_vec2:  if (num_components != 2) return; scalar_to_scalar_conversion += 0x1; break;
-    case slrak_vec3:  if (num_components != 3) return; scalar_to_scalar_conversion += 0x1; break;
-    case slrak_vec4:  if (num_components != 4) return; scalar_to_scalar_conversion += 0x1; break;
-    case slrak_mat2:  if (num_components != 4) return; scalar_to_scalar_conversion += 0x1; break;
-    case slrak_mat3:  if (num_components != 9) return; scalar_to_scalar_conversion += 0x1; break;
-    case slrak_mat4:  if (num_components !=16) return; scalar_to_scalar_conversion += 0x1; break;
-    case slrak_int:   if (num_components != 1) return; scalar_to_scalar_conversion += 0x2; break;
-    case slrak_ivec2: if (num_components != 2) return; scalar_to_scalar_conversion += 0x2; break;
-    case slrak_ivec3: if (num_components != 3) return; scalar_to_scalar_conversion += 0x2; break;
-    case slrak_ivec4: if (num_components != 4) return; scalar_to_scalar_conversion += 0x2; break;
-    case slrak_bool:  if (num_components != 1) return; scalar_to_scalar_conversion += 0x3; break;
-    case slrak_bvec2: if (num_components != 2) return; scalar_to_scalar_conversion += 0x3; break;
-    case slrak_bvec3: if (num_components != 3) return; scalar_to_scalar_conversion += 0x3; break;
-    case slrak_bvec4: if (num_components != 4) return; scalar_to_scalar_conversion += 0x3; break;
-    default: if (scalar_to_scalar_conversion) return;
-  }
-  switch (from_ra->kind_) {
-    case slrak_float:
-    case slrak_vec2:
-    case slrak_vec3:
-    case slrak_vec4:
-    case slrak_mat2:
-    case slrak_mat3:
-    case slrak_mat4:
-    case slrak_int:
-    case slrak_ivec2:
-    case slrak_ivec3:
-    case slrak_ivec4:
-    case slrak_bool:
-    case slrak_bvec2:
-    case slrak_bvec3:
-    case slrak_bvec4: {
-      if (to_ra->is_indirect_) {
-        /* to is indirect */
-        if (from_ra->is_indirect_) {
-          /* from is indirect */
-          if (to_ra_offset && (to_ra_offset->kind_ != slrak_void)) {
-            /* have a to offset */
-            if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-              /* have a from offset */
-              switch (scalar_to_scalar_conversion) {
-                case 0x11: /* float to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_INDIR_OFFSET_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x11: float to float */
-                case 0x12: /* float to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_INDIR_OFFSET_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x12: float to int */
-                case 0x13: /* float to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_INDIR_OFFSET_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x13: float to bool */
-                case 0x21: /* int to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_INDIR_OFFSET_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x21: int to float */
-                case 0x22: /* int to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_INDIR_OFFSET_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x22: int to int */
-                case 0x23: /* int to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_INDIR_OFFSET_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x23: int to bool */
-                case 0x31: /* bool to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_INDIR_OFFSET_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x31: bool to float */
-                case 0x32: /* bool to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_INDIR_OFFSET_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x32: bool to int */
-                case 0x33: /* bool to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_INDIR_OFFSET_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x33: bool to bool */
-              } /* end scalar to scalar conversion switch */
-            }
-            else {
-              /* no from offset */
-              switch (scalar_to_scalar_conversion) {
-                case 0x11: /* float to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_INDIR_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x11: float to float */
-                case 0x12: /* float to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_INDIR_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x12: float to int */
-                case 0x13: /* float to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_INDIR_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x13: float to bool */
-                case 0x21: /* int to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_INDIR_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x21: int to float */
-                case 0x22: /* int to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_INDIR_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x22: int to int */
-                case 0x23: /* int to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_INDIR_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x23: int to bool */
-                case 0x31: /* bool to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_INDIR_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x31: bool to float */
-                case 0x32: /* bool to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_INDIR_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x32: bool to int */
-                case 0x33: /* bool to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_INDIR_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x33: bool to bool */
-              } /* end scalar to scalar conversion switch */
-            }
-          }
-          else {
-            /* no to offset */
-            if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-              /* have a from offset */
-              switch (scalar_to_scalar_conversion) {
-                case 0x11: /* float to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_INDIR_OFFSET_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x11: float to float */
-                case 0x12: /* float to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_INDIR_OFFSET_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x12: float to int */
-                case 0x13: /* float to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_INDIR_OFFSET_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x13: float to bool */
-                case 0x21: /* int to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_INDIR_OFFSET_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x21: int to float */
-                case 0x22: /* int to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_INDIR_OFFSET_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x22: int to int */
-                case 0x23: /* int to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_INDIR_OFFSET_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x23: int to bool */
-                case 0x31: /* bool to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_INDIR_OFFSET_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x31: bool to float */
-                case 0x32: /* bool to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_INDIR_OFFSET_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x32: bool to int */
-                case 0x33: /* bool to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_INDIR_OFFSET_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x33: bool to bool */
-              } /* end scalar to scalar conversion switch */
-            }
-            else {
-              /* no from offset */
-              switch (scalar_to_scalar_conversion) {
-                case 0x11: /* float to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_INDIR_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x11: float to float */
-                case 0x12: /* float to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_INDIR_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x12: float to int */
-                case 0x13: /* float to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_INDIR_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x13: float to bool */
-                case 0x21: /* int to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_INDIR_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x21: int to float */
-                case 0x22: /* int to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_INDIR_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x22: int to int */
-                case 0x23: /* int to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_INDIR_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x23: int to bool */
-                case 0x31: /* bool to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_INDIR_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x31: bool to float */
-                case 0x32: /* bool to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_INDIR_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x32: bool to int */
-                case 0x33: /* bool to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_INDIR_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x33: bool to bool */
-              } /* end scalar to scalar conversion switch */
-            }
-          }
-        }
-        else {
-          /* from is direct */
-          if (to_ra_offset && (to_ra_offset->kind_ != slrak_void)) {
-            /* have a to offset */
-            if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-              /* have a from offset */
-              switch (scalar_to_scalar_conversion) {
-                case 0x11: /* float to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_OFFSET_REG_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x11: float to float */
-                case 0x12: /* float to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_OFFSET_REG_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x12: float to int */
-                case 0x13: /* float to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_OFFSET_REG_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x13: float to bool */
-                case 0x21: /* int to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_OFFSET_REG_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x21: int to float */
-                case 0x22: /* int to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_OFFSET_REG_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x22: int to int */
-                case 0x23: /* int to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_OFFSET_REG_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x23: int to bool */
-                case 0x31: /* bool to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_OFFSET_REG_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x31: bool to float */
-                case 0x32: /* bool to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_OFFSET_REG_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x32: bool to int */
-                case 0x33: /* bool to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_OFFSET_REG_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x33: bool to bool */
-              } /* end scalar to scalar conversion switch */
-            }
-            else {
-              /* no from offset */
-              switch (scalar_to_scalar_conversion) {
-                case 0x11: /* float to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_REG_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x11: float to float */
-                case 0x12: /* float to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_REG_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x12: float to int */
-                case 0x13: /* float to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_REG_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x13: float to bool */
-                case 0x21: /* int to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_REG_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x21: int to float */
-                case 0x22: /* int to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_REG_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x22: int to int */
-                case 0x23: /* int to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_REG_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x23: int to bool */
-                case 0x31: /* bool to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_REG_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x31: bool to float */
-                case 0x32: /* bool to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_REG_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x32: bool to int */
-                case 0x33: /* bool to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_REG_TO_INDIR_OFFSET);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x33: bool to bool */
-              } /* end scalar to scalar conversion switch */
-            }
-          }
-          else {
-            /* no to offset */
-            if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-              /* have a from offset */
-              switch (scalar_to_scalar_conversion) {
-                case 0x11: /* float to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_OFFSET_REG_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x11: float to float */
-                case 0x12: /* float to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_OFFSET_REG_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x12: float to int */
-                case 0x13: /* float to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_OFFSET_REG_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x13: float to bool */
-                case 0x21: /* int to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_OFFSET_REG_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x21: int to float */
-                case 0x22: /* int to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_OFFSET_REG_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x22: int to int */
-                case 0x23: /* int to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_OFFSET_REG_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x23: int to bool */
-                case 0x31: /* bool to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_OFFSET_REG_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x31: bool to float */
-                case 0x32: /* bool to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_OFFSET_REG_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x32: bool to int */
-                case 0x33: /* bool to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_OFFSET_REG_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x33: bool to bool */
-              } /* end scalar to scalar conversion switch */
-            }
-            else {
-              /* no from offset */
-              switch (scalar_to_scalar_conversion) {
-                case 0x11: /* float to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_REG_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x11: float to float */
-                case 0x12: /* float to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_REG_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x12: float to int */
-                case 0x13: /* float to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_REG_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x13: float to bool */
-                case 0x21: /* int to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_REG_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x21: int to float */
-                case 0x22: /* int to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_REG_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x22: int to int */
-                case 0x23: /* int to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_REG_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x23: int to bool */
-                case 0x31: /* bool to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_REG_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x31: bool to float */
-                case 0x32: /* bool to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_REG_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x32: bool to int */
-                case 0x33: /* bool to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_REG_TO_INDIR);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] : to_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x33: bool to bool */
-              } /* end scalar to scalar conversion switch */
-            }
-          }
-        }
-      }
-      else {
-        /* to is direct */
-        if (from_ra->is_indirect_) {
-          /* from is indirect */
-          if (to_ra_offset && (to_ra_offset->kind_ != slrak_void)) {
-            /* have a to offset */
-            if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-              /* have a from offset */
-              switch (scalar_to_scalar_conversion) {
-                case 0x11: /* float to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_INDIR_OFFSET_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x11: float to float */
-                case 0x12: /* float to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_INDIR_OFFSET_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x12: float to int */
-                case 0x13: /* float to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_INDIR_OFFSET_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x13: float to bool */
-                case 0x21: /* int to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_INDIR_OFFSET_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x21: int to float */
-                case 0x22: /* int to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_INDIR_OFFSET_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x22: int to int */
-                case 0x23: /* int to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_INDIR_OFFSET_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x23: int to bool */
-                case 0x31: /* bool to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_INDIR_OFFSET_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x31: bool to float */
-                case 0x32: /* bool to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_INDIR_OFFSET_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x32: bool to int */
-                case 0x33: /* bool to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_INDIR_OFFSET_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x33: bool to bool */
-              } /* end scalar to scalar conversion switch */
-            }
-            else {
-              /* no from offset */
-              switch (scalar_to_scalar_conversion) {
-                case 0x11: /* float to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_INDIR_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x11: float to float */
-                case 0x12: /* float to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_INDIR_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x12: float to int */
-                case 0x13: /* float to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_INDIR_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x13: float to bool */
-                case 0x21: /* int to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_INDIR_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x21: int to float */
-                case 0x22: /* int to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_INDIR_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x22: int to int */
-                case 0x23: /* int to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_INDIR_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x23: int to bool */
-                case 0x31: /* bool to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_INDIR_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x31: bool to float */
-                case 0x32: /* bool to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_INDIR_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x32: bool to int */
-                case 0x33: /* bool to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_INDIR_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x33: bool to bool */
-              } /* end scalar to scalar conversion switch */
-            }
-          }
-          else {
-            /* no to offset */
-            if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-              /* have a from offset */
-              switch (scalar_to_scalar_conversion) {
-                case 0x11: /* float to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_INDIR_OFFSET_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x11: float to float */
-                case 0x12: /* float to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_INDIR_OFFSET_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x12: float to int */
-                case 0x13: /* float to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_INDIR_OFFSET_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x13: float to bool */
-                case 0x21: /* int to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_INDIR_OFFSET_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x21: int to float */
-                case 0x22: /* int to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_INDIR_OFFSET_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x22: int to int */
-                case 0x23: /* int to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_INDIR_OFFSET_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x23: int to bool */
-                case 0x31: /* bool to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_INDIR_OFFSET_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x31: bool to float */
-                case 0x32: /* bool to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_INDIR_OFFSET_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x32: bool to int */
-                case 0x33: /* bool to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_INDIR_OFFSET_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x33: bool to bool */
-              } /* end scalar to scalar conversion switch */
-            }
-            else {
-              /* no from offset */
-              switch (scalar_to_scalar_conversion) {
-                case 0x11: /* float to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_INDIR_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x11: float to float */
-                case 0x12: /* float to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_INDIR_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x12: float to int */
-                case 0x13: /* float to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_INDIR_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x13: float to bool */
-                case 0x21: /* int to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_INDIR_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x21: int to float */
-                case 0x22: /* int to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_INDIR_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x22: int to int */
-                case 0x23: /* int to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_INDIR_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x23: int to bool */
-                case 0x31: /* bool to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_INDIR_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x31: bool to float */
-                case 0x32: /* bool to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_INDIR_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x32: bool to int */
-                case 0x33: /* bool to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_INDIR_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] : from_ra->v_.regs_[n]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x33: bool to bool */
-              } /* end scalar to scalar conversion switch */
-            }
-          }
-        }
-        else {
-          /* from is direct */
-          if (to_ra_offset && (to_ra_offset->kind_ != slrak_void)) {
-            /* have a to offset */
-            if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-              /* have a from offset */
-              switch (scalar_to_scalar_conversion) {
-                case 0x11: /* float to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_OFFSET_REG_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x11: float to float */
-                case 0x12: /* float to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_OFFSET_REG_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x12: float to int */
-                case 0x13: /* float to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_OFFSET_REG_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x13: float to bool */
-                case 0x21: /* int to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_OFFSET_REG_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x21: int to float */
-                case 0x22: /* int to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_OFFSET_REG_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x22: int to int */
-                case 0x23: /* int to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_OFFSET_REG_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x23: int to bool */
-                case 0x31: /* bool to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_OFFSET_REG_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x31: bool to float */
-                case 0x32: /* bool to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_OFFSET_REG_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x32: bool to int */
-                case 0x33: /* bool to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_OFFSET_REG_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x33: bool to bool */
-              } /* end scalar to scalar conversion switch */
-            }
-            else {
-              /* no from offset */
-              switch (scalar_to_scalar_conversion) {
-                case 0x11: /* float to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_REG_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x11: float to float */
-                case 0x12: /* float to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_REG_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x12: float to int */
-                case 0x13: /* float to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_REG_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x13: float to bool */
-                case 0x21: /* int to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_REG_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x21: int to float */
-                case 0x22: /* int to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_REG_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x22: int to int */
-                case 0x23: /* int to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_REG_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x23: int to bool */
-                case 0x31: /* bool to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_REG_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x31: bool to float */
-                case 0x32: /* bool to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_REG_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x32: bool to int */
-                case 0x33: /* bool to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_REG_TO_OFFSET_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x33: bool to bool */
-              } /* end scalar to scalar conversion switch */
-            }
-          }
-          else {
-            /* no to offset */
-            if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-              /* have a from offset */
-              switch (scalar_to_scalar_conversion) {
-                case 0x11: /* float to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_OFFSET_REG_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x11: float to float */
-                case 0x12: /* float to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_OFFSET_REG_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x12: float to int */
-                case 0x13: /* float to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_OFFSET_REG_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x13: float to bool */
-                case 0x21: /* int to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_OFFSET_REG_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x21: int to float */
-                case 0x22: /* int to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_OFFSET_REG_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x22: int to int */
-                case 0x23: /* int to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_OFFSET_REG_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x23: int to bool */
-                case 0x31: /* bool to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_OFFSET_REG_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x31: bool to float */
-                case 0x32: /* bool to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_OFFSET_REG_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x32: bool to int */
-                case 0x33: /* bool to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_OFFSET_REG_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x33: bool to bool */
-              } /* end scalar to scalar conversion switch */
-            }
-            else {
-              /* no from offset */
-              switch (scalar_to_scalar_conversion) {
-                case 0x11: /* float to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_REG_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x11: float to float */
-                case 0x12: /* float to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_REG_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x12: float to int */
-                case 0x13: /* float to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_REG_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x13: float to bool */
-                case 0x21: /* int to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_REG_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x21: int to float */
-                case 0x22: /* int to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_REG_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x22: int to int */
-                case 0x23: /* int to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_REG_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x23: int to bool */
-                case 0x31: /* bool to float */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_REG_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x31: bool to float */
-                case 0x32: /* bool to int */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_REG_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x32: bool to int */
-                case 0x33: /* bool to bool */ {
-                  for (k = 0; k < array_quantity; ++k) {
-                    for (n = 0; n < num_components; ++n) {
-                      struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_REG_TO_REG);
-                      ir_instr_append_use(mov_instr, chain_reg);
-                      ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[n] + k : to_ra->v_.regs_[n] + k));
-                      ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[n] + k : from_ra->v_.regs_[n] + k));
-                    } /* end for n components */
-                  } /* end for k array_quantity */
-                  break;
-                } /* end case 0x33: bool to bool */
-              } /* end scalar to scalar conversion switch */
-            }
-          }
-        }
-      }
-      break;
-    }
-    case slrak_sampler2D: {
-      if (from_ra->kind_ != to_ra->kind_) return;
-      if (to_ra->is_indirect_) {
-        /* to is indirect */
-        if (from_ra->is_indirect_) {
-          /* from is indirect */
-          if (to_ra_offset && (to_ra_offset->kind_ != slrak_void)) {
-            /* have a to offset */
-            if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-              /* have a from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_S2D_INDIR_OFFSET_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[0] : to_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[0] : from_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-              }
-            }
-            else {
-              /* no from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_S2D_INDIR_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[0] : to_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[0] : from_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              }
-            }
-          }
-          else {
-            /* no to offset */
-            if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-              /* have a from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_S2D_INDIR_OFFSET_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[0] : to_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[0] : from_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-              }
-            }
-            else {
-              /* no from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_S2D_INDIR_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[0] : to_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[0] : from_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              }
-            }
-          }
-        }
-        else {
-          /* from is direct */
-          if (to_ra_offset && (to_ra_offset->kind_ != slrak_void)) {
-            /* have a to offset */
-            if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-              /* have a from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_S2D_OFFSET_REG_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[0] : to_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_sampler2D(blk->body_, from_ra->local_frame_ ? from_frame->local_sampler2D_offset_ + from_ra->v_.regs_[0] + k : from_ra->v_.regs_[0] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-              }
-            }
-            else {
-              /* no from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_S2D_REG_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[0] : to_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_sampler2D(blk->body_, from_ra->local_frame_ ? from_frame->local_sampler2D_offset_ + from_ra->v_.regs_[0] + k : from_ra->v_.regs_[0] + k));
-              }
-            }
-          }
-          else {
-            /* no to offset */
-            if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-              /* have a from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_S2D_OFFSET_REG_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[0] : to_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_sampler2D(blk->body_, from_ra->local_frame_ ? from_frame->local_sampler2D_offset_ + from_ra->v_.regs_[0] + k : from_ra->v_.regs_[0] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-              }
-            }
-            else {
-              /* no from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_S2D_REG_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[0] : to_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_sampler2D(blk->body_, from_ra->local_frame_ ? from_frame->local_sampler2D_offset_ + from_ra->v_.regs_[0] + k : from_ra->v_.regs_[0] + k));
-              }
-            }
-          }
-        }
-      }
-      else {
-        /* to is direct */
-        if (from_ra->is_indirect_) {
-          /* from is indirect */
-          if (to_ra_offset && (to_ra_offset->kind_ != slrak_void)) {
-            /* have a to offset */
-            if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-              /* have a from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_S2D_INDIR_OFFSET_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_sampler2D(blk->body_, to_ra->local_frame_ ? to_frame->local_sampler2D_offset_ + to_ra->v_.regs_[0] + k : to_ra->v_.regs_[0] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[0] : from_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-              }
-            }
-            else {
-              /* no from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_S2D_INDIR_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_sampler2D(blk->body_, to_ra->local_frame_ ? to_frame->local_sampler2D_offset_ + to_ra->v_.regs_[0] + k : to_ra->v_.regs_[0] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[0] : from_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              }
-            }
-          }
-          else {
-            /* no to offset */
-            if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-              /* have a from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_S2D_INDIR_OFFSET_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_sampler2D(blk->body_, to_ra->local_frame_ ? to_frame->local_sampler2D_offset_ + to_ra->v_.regs_[0] + k : to_ra->v_.regs_[0] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[0] : from_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-              }
-            }
-            else {
-              /* no from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_S2D_INDIR_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_sampler2D(blk->body_, to_ra->local_frame_ ? to_frame->local_sampler2D_offset_ + to_ra->v_.regs_[0] + k : to_ra->v_.regs_[0] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[0] : from_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              }
-            }
-          }
-        }
-        else {
-          /* from is direct */
-          if (to_ra_offset && (to_ra_offset->kind_ != slrak_void)) {
-            /* have a to offset */
-            if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-              /* have a from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_S2D_OFFSET_REG_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_sampler2D(blk->body_, to_ra->local_frame_ ? to_frame->local_sampler2D_offset_ + to_ra->v_.regs_[0] + k : to_ra->v_.regs_[0] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_sampler2D(blk->body_, from_ra->local_frame_ ? from_frame->local_sampler2D_offset_ + from_ra->v_.regs_[0] + k : from_ra->v_.regs_[0] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-              }
-            }
-            else {
-              /* no from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_S2D_REG_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_sampler2D(blk->body_, to_ra->local_frame_ ? to_frame->local_sampler2D_offset_ + to_ra->v_.regs_[0] + k : to_ra->v_.regs_[0] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_sampler2D(blk->body_, from_ra->local_frame_ ? from_frame->local_sampler2D_offset_ + from_ra->v_.regs_[0] + k : from_ra->v_.regs_[0] + k));
-              }
-            }
-          }
-          else {
-            /* no to offset */
-            if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-              /* have a from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_S2D_OFFSET_REG_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_sampler2D(blk->body_, to_ra->local_frame_ ? to_frame->local_sampler2D_offset_ + to_ra->v_.regs_[0] + k : to_ra->v_.regs_[0] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_sampler2D(blk->body_, from_ra->local_frame_ ? from_frame->local_sampler2D_offset_ + from_ra->v_.regs_[0] + k : from_ra->v_.regs_[0] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-              }
-            }
-            else {
-              /* no from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_S2D_REG_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_sampler2D(blk->body_, to_ra->local_frame_ ? to_frame->local_sampler2D_offset_ + to_ra->v_.regs_[0] + k : to_ra->v_.regs_[0] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_sampler2D(blk->body_, from_ra->local_frame_ ? from_frame->local_sampler2D_offset_ + from_ra->v_.regs_[0] + k : from_ra->v_.regs_[0] + k));
-              }
-            }
-          }
-        }
-      }
-      break;
-    }
-    case slrak_samplerCube: {
-      if (from_ra->kind_ != to_ra->kind_) return;
-      if (to_ra->is_indirect_) {
-        /* to is indirect */
-        if (from_ra->is_indirect_) {
-          /* from is indirect */
-          if (to_ra_offset && (to_ra_offset->kind_ != slrak_void)) {
-            /* have a to offset */
-            if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-              /* have a from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_SC_INDIR_OFFSET_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[0] : to_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[0] : from_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-              }
-            }
-            else {
-              /* no from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_SC_INDIR_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[0] : to_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[0] : from_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              }
-            }
-          }
-          else {
-            /* no to offset */
-            if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-              /* have a from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_SC_INDIR_OFFSET_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[0] : to_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[0] : from_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-              }
-            }
-            else {
-              /* no from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_SC_INDIR_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[0] : to_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[0] : from_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              }
-            }
-          }
-        }
-        else {
-          /* from is direct */
-          if (to_ra_offset && (to_ra_offset->kind_ != slrak_void)) {
-            /* have a to offset */
-            if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-              /* have a from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_SC_OFFSET_REG_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[0] : to_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_samplerCube(blk->body_, from_ra->local_frame_ ? from_frame->local_samplerCube_offset_ + from_ra->v_.regs_[0] + k : from_ra->v_.regs_[0] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-              }
-            }
-            else {
-              /* no from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_SC_REG_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[0] : to_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_samplerCube(blk->body_, from_ra->local_frame_ ? from_frame->local_samplerCube_offset_ + from_ra->v_.regs_[0] + k : from_ra->v_.regs_[0] + k));
-              }
-            }
-          }
-          else {
-            /* no to offset */
-            if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-              /* have a from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_SC_OFFSET_REG_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[0] : to_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_samplerCube(blk->body_, from_ra->local_frame_ ? from_frame->local_samplerCube_offset_ + from_ra->v_.regs_[0] + k : from_ra->v_.regs_[0] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-              }
-            }
-            else {
-              /* no from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_SC_REG_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[0] : to_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_samplerCube(blk->body_, from_ra->local_frame_ ? from_frame->local_samplerCube_offset_ + from_ra->v_.regs_[0] + k : from_ra->v_.regs_[0] + k));
-              }
-            }
-          }
-        }
-      }
-      else {
-        /* to is direct */
-        if (from_ra->is_indirect_) {
-          /* from is indirect */
-          if (to_ra_offset && (to_ra_offset->kind_ != slrak_void)) {
-            /* have a to offset */
-            if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-              /* have a from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_SC_INDIR_OFFSET_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_samplerCube(blk->body_, to_ra->local_frame_ ? to_frame->local_samplerCube_offset_ + to_ra->v_.regs_[0] + k : to_ra->v_.regs_[0] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[0] : from_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-              }
-            }
-            else {
-              /* no from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_SC_INDIR_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_samplerCube(blk->body_, to_ra->local_frame_ ? to_frame->local_samplerCube_offset_ + to_ra->v_.regs_[0] + k : to_ra->v_.regs_[0] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[0] : from_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              }
-            }
-          }
-          else {
-            /* no to offset */
-            if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-              /* have a from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_SC_INDIR_OFFSET_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_samplerCube(blk->body_, to_ra->local_frame_ ? to_frame->local_samplerCube_offset_ + to_ra->v_.regs_[0] + k : to_ra->v_.regs_[0] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[0] : from_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-              }
-            }
-            else {
-              /* no from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_SC_INDIR_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_samplerCube(blk->body_, to_ra->local_frame_ ? to_frame->local_samplerCube_offset_ + to_ra->v_.regs_[0] + k : to_ra->v_.regs_[0] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[0] : from_ra->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              }
-            }
-          }
-        }
-        else {
-          /* from is direct */
-          if (to_ra_offset && (to_ra_offset->kind_ != slrak_void)) {
-            /* have a to offset */
-            if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-              /* have a from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_SC_OFFSET_REG_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_samplerCube(blk->body_, to_ra->local_frame_ ? to_frame->local_samplerCube_offset_ + to_ra->v_.regs_[0] + k : to_ra->v_.regs_[0] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_samplerCube(blk->body_, from_ra->local_frame_ ? from_frame->local_samplerCube_offset_ + from_ra->v_.regs_[0] + k : from_ra->v_.regs_[0] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-              }
-            }
-            else {
-              /* no from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_SC_REG_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_samplerCube(blk->body_, to_ra->local_frame_ ? to_frame->local_samplerCube_offset_ + to_ra->v_.regs_[0] + k : to_ra->v_.regs_[0] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_samplerCube(blk->body_, from_ra->local_frame_ ? from_frame->local_samplerCube_offset_ + from_ra->v_.regs_[0] + k : from_ra->v_.regs_[0] + k));
-              }
-            }
-          }
-          else {
-            /* no to offset */
-            if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-              /* have a from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_SC_OFFSET_REG_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_samplerCube(blk->body_, to_ra->local_frame_ ? to_frame->local_samplerCube_offset_ + to_ra->v_.regs_[0] + k : to_ra->v_.regs_[0] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_samplerCube(blk->body_, from_ra->local_frame_ ? from_frame->local_samplerCube_offset_ + from_ra->v_.regs_[0] + k : from_ra->v_.regs_[0] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-              }
-            }
-            else {
-              /* no from offset */
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_SC_REG_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_samplerCube(blk->body_, to_ra->local_frame_ ? to_frame->local_samplerCube_offset_ + to_ra->v_.regs_[0] + k : to_ra->v_.regs_[0] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_samplerCube(blk->body_, from_ra->local_frame_ ? from_frame->local_samplerCube_offset_ + from_ra->v_.regs_[0] + k : from_ra->v_.regs_[0] + k));
-              }
-            }
-          }
-        }
-      }
+    default:
       break;
+  }
+  from_cat = sl_reg_emit_category(from_ra->kind_, &num_components);
+  to_cat = sl_reg_emit_category(to_ra->kind_, &to_num_components);
+  if ((from_cat < 0) || (to_cat < 0)) return;
+  if (num_components != to_num_components) return;
+  if (((from_cat >= SL_REG_EMIT_CAT_SAMPLER2D) || (to_cat >= SL_REG_EMIT_CAT_SAMPLER2D)) && (from_cat != to_cat)) return;
+
+  for (k = 0; k < array_quantity; ++k) {
+    for (n = 0; n < num_components; ++n) {
+      struct sl_reg_emit_side from, to;
+      sl_reg_emit_resolve(&from, from_frame, from_cat, from_ra, from_ra_offset, n, k, from_offset_step_size);
+      sl_reg_emit_resolve(&to, to_frame, to_cat, to_ra, to_ra_offset, n, k, to_offset_step_size);
+      sl_reg_emit_move_instr(blk, chain_reg, from_cat, &from, to_cat, &to);
     }
   }
 }
@@ -11976,1981 +9380,215 @@ void sl_reg_emit_move_crossframe_c2c(struct ir_block *blk,
                                      struct sl_execution_frame *to_frame, struct sl_reg_alloc *to_ra, struct sl_reg_alloc *to_ra_offset, int to_component,
                                      int from_offset_step_size, int to_offset_step_size,
                                      int array_quantity) {
-  size_t num_components = 0;
-  int scalar_to_scalar_conversion = 0;
+  int from_num_components = 0, to_num_components = 0;
+  int from_cat, to_cat;
   int k;
-  switch (from_ra->kind_) {
-    case slrak_array:
-    case slrak_struct: {
-      return;
-    }
-    case slrak_float: if (from_component >= 1) return; scalar_to_scalar_conversion = 0x10; break;
-    case slrak_vec2:  if (from_component >= 2) return; scalar_to_scalar_conversion = 0x10; break;
-    case slrak_vec3:  if (from_component >= 3) return; scalar_to_scalar_conversion = 0x10; break;
-    case slrak_vec4:  if (from_component >= 4) return; scalar_to_scalar_conversion = 0x10; break;
-    case slrak_mat2:  if (from_component >= 4) return; scalar_to_scalar_conversion = 0x10; break;
-    case slrak_mat3:  if (from_component >= 9) return; scalar_to_scalar_conversion = 0x10; break;
-    case slrak_mat4:  if (from_component >= 16) return; scalar_to_scalar_conversion = 0x10; break;
-    case slrak_int:   if (from_component >= 1) return; scalar_to_scalar_conversion = 0x20; break;
-    case slrak_ivec2: if (from_component >= 2) return; scalar_to_scalar_conversion = 0x20; break;
-    case slrak_ivec3: if (from_component >= 3) return; scalar_to_scalar_conversion = 0x20; break;
-    case slrak_ivec4: if (from_component >= 4) return; scalar_to_scalar_conversion = 0x20; break;
-    case slrak_bool:  if (from_component >= 1) return; scalar_to_scalar_conversion = 0x30; break;
-    case slrak_bvec2: if (from_component >= 2) return; scalar_to_scalar_conversion = 0x30; break;
-    case slrak_bvec3: if (from_component >= 3) return; scalar_to_scalar_conversion = 0x30; break;
-    case slrak_bvec4: if (from_component >= 4) return; scalar_to_scalar_conversion = 0x30; break;
-  }
-  switch (to_ra->kind_) {
-    case slrak_float: if (to_component >= 1) return; scalar_to_scalar_conversion += 0x1; break;
-    case slrak_vec2:  if (to_component >= 2) return; scalar_to_scalar_conversion += 0x1; break;
-    case slrak_vec3:  if (to_component >= 3) return; scalar_to_scalar_conversion += 0x1; break;
-    case slrak_vec4:  if (to_component >= 4) return; scalar_to_scalar_conversion += 0x1; break;
-    case slrak_mat2:  if (to_component >= 4) return; scalar_to_scalar_conversion += 0x1; break;
-    case slrak_mat3:  if (to_component >= 9) return; scalar_to_scalar_conversion += 0x1; break;
-    case slrak_mat4:  if (to_component >=16) return; scalar_to_scalar_conversion += 0x1; break;
-    case slrak_int:   if (to_component >= 1) return; scalar_to_scalar_conversion += 0x2; break;
-    case slrak_ivec2: if (to_component >= 2) return; scalar_to_scalar_conversion += 0x2; break;
-    case slrak_ivec3: if (to_component >= 3) return; scalar_to_scalar_conversion += 0x2; break;
-    case slrak_ivec4: if (to_component >= 4) return; scalar_to_scalar_conversion += 0x2; break;
-    case slrak_bool:  if (to_component >= 1) return; scalar_to_scalar_conversion += 0x3; break;
-    case slrak_bvec2: if (to_component >= 2) return; scalar_to_scalar_conversion += 0x3; break;
-    case slrak_bvec3: if (to_component >= 3) return; scalar_to_scalar_conversion += 0x3; break;
-    case slrak_bvec4: if (to_component >= 4) return; scalar_to_scalar_conversion += 0x3; break;
-    default: return;
-  }
-  if (to_ra->is_indirect_) {
-    /* to is indirect */
-    if (from_ra->is_indirect_) {
-      /* from is indirect */
-      if (to_ra_offset && (to_ra_offset->kind_ != slrak_void)) {
-        /* have a to offset */
-        if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-          /* have a from offset */
-          switch (scalar_to_scalar_conversion) {
-            case 0x11: /* float to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_INDIR_OFFSET_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x11: float to float */
-            case 0x12: /* float to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_INDIR_OFFSET_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x12: float to int */
-            case 0x13: /* float to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_INDIR_OFFSET_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x13: float to bool */
-            case 0x21: /* int to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_INDIR_OFFSET_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x21: int to float */
-            case 0x22: /* int to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_INDIR_OFFSET_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x22: int to int */
-            case 0x23: /* int to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_INDIR_OFFSET_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x23: int to bool */
-            case 0x31: /* bool to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_INDIR_OFFSET_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x31: bool to float */
-            case 0x32: /* bool to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_INDIR_OFFSET_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x32: bool to int */
-            case 0x33: /* bool to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_INDIR_OFFSET_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x33: bool to bool */
-          } /* end scalar to scalar conversion switch */
-        }
-        else {
-          /* no from offset */
-          switch (scalar_to_scalar_conversion) {
-            case 0x11: /* float to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_INDIR_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x11: float to float */
-            case 0x12: /* float to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_INDIR_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x12: float to int */
-            case 0x13: /* float to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_INDIR_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x13: float to bool */
-            case 0x21: /* int to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_INDIR_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x21: int to float */
-            case 0x22: /* int to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_INDIR_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x22: int to int */
-            case 0x23: /* int to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_INDIR_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x23: int to bool */
-            case 0x31: /* bool to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_INDIR_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x31: bool to float */
-            case 0x32: /* bool to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_INDIR_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x32: bool to int */
-            case 0x33: /* bool to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_INDIR_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x33: bool to bool */
-          } /* end scalar to scalar conversion switch */
-        }
-      }
-      else {
-        /* no to offset */
-        if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-          /* have a from offset */
-          switch (scalar_to_scalar_conversion) {
-            case 0x11: /* float to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_INDIR_OFFSET_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x11: float to float */
-            case 0x12: /* float to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_INDIR_OFFSET_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x12: float to int */
-            case 0x13: /* float to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_INDIR_OFFSET_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x13: float to bool */
-            case 0x21: /* int to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_INDIR_OFFSET_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x21: int to float */
-            case 0x22: /* int to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_INDIR_OFFSET_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x22: int to int */
-            case 0x23: /* int to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_INDIR_OFFSET_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x23: int to bool */
-            case 0x31: /* bool to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_INDIR_OFFSET_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x31: bool to float */
-            case 0x32: /* bool to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_INDIR_OFFSET_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x32: bool to int */
-            case 0x33: /* bool to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_INDIR_OFFSET_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x33: bool to bool */
-          } /* end scalar to scalar conversion switch */
-        }
-        else {
-          /* no from offset */
-          switch (scalar_to_scalar_conversion) {
-            case 0x11: /* float to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_INDIR_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x11: float to float */
-            case 0x12: /* float to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_INDIR_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x12: float to int */
-            case 0x13: /* float to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_INDIR_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x13: float to bool */
-            case 0x21: /* int to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_INDIR_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x21: int to float */
-            case 0x22: /* int to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_INDIR_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x22: int to int */
-            case 0x23: /* int to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_INDIR_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x23: int to bool */
-            case 0x31: /* bool to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_INDIR_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x31: bool to float */
-            case 0x32: /* bool to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_INDIR_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x32: bool to int */
-            case 0x33: /* bool to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_INDIR_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x33: bool to bool */
-          } /* end scalar to scalar conversion switch */
-        }
-      }
-    }
-    else {
-      /* from is direct */
-      if (to_ra_offset && (to_ra_offset->kind_ != slrak_void)) {
-        /* have a to offset */
-        if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-          /* have a from offset */
-          switch (scalar_to_scalar_conversion) {
-            case 0x11: /* float to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_OFFSET_REG_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x11: float to float */
-            case 0x12: /* float to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_OFFSET_REG_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x12: float to int */
-            case 0x13: /* float to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_OFFSET_REG_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x13: float to bool */
-            case 0x21: /* int to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_OFFSET_REG_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x21: int to float */
-            case 0x22: /* int to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_OFFSET_REG_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x22: int to int */
-            case 0x23: /* int to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_OFFSET_REG_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x23: int to bool */
-            case 0x31: /* bool to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_OFFSET_REG_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x31: bool to float */
-            case 0x32: /* bool to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_OFFSET_REG_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x32: bool to int */
-            case 0x33: /* bool to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_OFFSET_REG_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x33: bool to bool */
-          } /* end scalar to scalar conversion switch */
-        }
-        else {
-          /* no from offset */
-          switch (scalar_to_scalar_conversion) {
-            case 0x11: /* float to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_REG_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x11: float to float */
-            case 0x12: /* float to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_REG_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x12: float to int */
-            case 0x13: /* float to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_REG_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x13: float to bool */
-            case 0x21: /* int to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_REG_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x21: int to float */
-            case 0x22: /* int to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_REG_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x22: int to int */
-            case 0x23: /* int to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_REG_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x23: int to bool */
-            case 0x31: /* bool to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_REG_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x31: bool to float */
-            case 0x32: /* bool to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_REG_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x32: bool to int */
-            case 0x33: /* bool to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_REG_TO_INDIR_OFFSET);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x33: bool to bool */
-          } /* end scalar to scalar conversion switch */
-        }
-      }
-      else {
-        /* no to offset */
-        if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-          /* have a from offset */
-          switch (scalar_to_scalar_conversion) {
-            case 0x11: /* float to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_OFFSET_REG_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x11: float to float */
-            case 0x12: /* float to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_OFFSET_REG_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x12: float to int */
-            case 0x13: /* float to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_OFFSET_REG_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x13: float to bool */
-            case 0x21: /* int to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_OFFSET_REG_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x21: int to float */
-            case 0x22: /* int to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_OFFSET_REG_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x22: int to int */
-            case 0x23: /* int to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_OFFSET_REG_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x23: int to bool */
-            case 0x31: /* bool to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_OFFSET_REG_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x31: bool to float */
-            case 0x32: /* bool to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_OFFSET_REG_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x32: bool to int */
-            case 0x33: /* bool to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_OFFSET_REG_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x33: bool to bool */
-          } /* end scalar to scalar conversion switch */
-        }
-        else {
-          /* no from offset */
-          switch (scalar_to_scalar_conversion) {
-            case 0x11: /* float to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_REG_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x11: float to float */
-            case 0x12: /* float to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_REG_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x12: float to int */
-            case 0x13: /* float to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_REG_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x13: float to bool */
-            case 0x21: /* int to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_REG_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x21: int to float */
-            case 0x22: /* int to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_REG_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x22: int to int */
-            case 0x23: /* int to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_REG_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x23: int to bool */
-            case 0x31: /* bool to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_REG_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x31: bool to float */
-            case 0x32: /* bool to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_REG_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x32: bool to int */
-            case 0x33: /* bool to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_REG_TO_INDIR);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] : to_ra->v_.regs_[to_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x33: bool to bool */
-          } /* end scalar to scalar conversion switch */
-        }
-      }
-    }
-  }
-  else {
-    /* to is direct */
-    if (from_ra->is_indirect_) {
-      /* from is indirect */
-      if (to_ra_offset && (to_ra_offset->kind_ != slrak_void)) {
-        /* have a to offset */
-        if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-          /* have a from offset */
-          switch (scalar_to_scalar_conversion) {
-            case 0x11: /* float to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_INDIR_OFFSET_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x11: float to float */
-            case 0x12: /* float to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_INDIR_OFFSET_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x12: float to int */
-            case 0x13: /* float to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_INDIR_OFFSET_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x13: float to bool */
-            case 0x21: /* int to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_INDIR_OFFSET_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x21: int to float */
-            case 0x22: /* int to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_INDIR_OFFSET_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x22: int to int */
-            case 0x23: /* int to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_INDIR_OFFSET_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x23: int to bool */
-            case 0x31: /* bool to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_INDIR_OFFSET_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x31: bool to float */
-            case 0x32: /* bool to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_INDIR_OFFSET_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x32: bool to int */
-            case 0x33: /* bool to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_INDIR_OFFSET_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x33: bool to bool */
-          } /* end scalar to scalar conversion switch */
-        }
-        else {
-          /* no from offset */
-          switch (scalar_to_scalar_conversion) {
-            case 0x11: /* float to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_INDIR_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x11: float to float */
-            case 0x12: /* float to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_INDIR_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x12: float to int */
-            case 0x13: /* float to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_INDIR_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x13: float to bool */
-            case 0x21: /* int to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_INDIR_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x21: int to float */
-            case 0x22: /* int to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_INDIR_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x22: int to int */
-            case 0x23: /* int to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_INDIR_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x23: int to bool */
-            case 0x31: /* bool to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_INDIR_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x31: bool to float */
-            case 0x32: /* bool to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_INDIR_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x32: bool to int */
-            case 0x33: /* bool to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_INDIR_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x33: bool to bool */
-          } /* end scalar to scalar conversion switch */
-        }
-      }
-      else {
-        /* no to offset */
-        if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-          /* have a from offset */
-          switch (scalar_to_scalar_conversion) {
-            case 0x11: /* float to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_INDIR_OFFSET_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x11: float to float */
-            case 0x12: /* float to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_INDIR_OFFSET_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x12: float to int */
-            case 0x13: /* float to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_INDIR_OFFSET_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x13: float to bool */
-            case 0x21: /* int to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_INDIR_OFFSET_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x21: int to float */
-            case 0x22: /* int to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_INDIR_OFFSET_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x22: int to int */
-            case 0x23: /* int to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_INDIR_OFFSET_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x23: int to bool */
-            case 0x31: /* bool to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_INDIR_OFFSET_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x31: bool to float */
-            case 0x32: /* bool to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_INDIR_OFFSET_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x32: bool to int */
-            case 0x33: /* bool to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_INDIR_OFFSET_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x33: bool to bool */
-          } /* end scalar to scalar conversion switch */
-        }
-        else {
-          /* no from offset */
-          switch (scalar_to_scalar_conversion) {
-            case 0x11: /* float to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_INDIR_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x11: float to float */
-            case 0x12: /* float to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_INDIR_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x12: float to int */
-            case 0x13: /* float to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_INDIR_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x13: float to bool */
-            case 0x21: /* int to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_INDIR_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x21: int to float */
-            case 0x22: /* int to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_INDIR_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x22: int to int */
-            case 0x23: /* int to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_INDIR_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x23: int to bool */
-            case 0x31: /* bool to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_INDIR_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x31: bool to float */
-            case 0x32: /* bool to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_INDIR_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x32: bool to int */
-            case 0x33: /* bool to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_INDIR_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] : from_ra->v_.regs_[from_component]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x33: bool to bool */
-          } /* end scalar to scalar conversion switch */
-        }
-      }
-    }
-    else {
-      /* from is direct */
-      if (to_ra_offset && (to_ra_offset->kind_ != slrak_void)) {
-        /* have a to offset */
-        if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-          /* have a from offset */
-          switch (scalar_to_scalar_conversion) {
-            case 0x11: /* float to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_OFFSET_REG_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x11: float to float */
-            case 0x12: /* float to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_OFFSET_REG_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x12: float to int */
-            case 0x13: /* float to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_OFFSET_REG_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x13: float to bool */
-            case 0x21: /* int to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_OFFSET_REG_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x21: int to float */
-            case 0x22: /* int to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_OFFSET_REG_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x22: int to int */
-            case 0x23: /* int to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_OFFSET_REG_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x23: int to bool */
-            case 0x31: /* bool to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_OFFSET_REG_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x31: bool to float */
-            case 0x32: /* bool to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_OFFSET_REG_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x32: bool to int */
-            case 0x33: /* bool to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_OFFSET_REG_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x33: bool to bool */
-          } /* end scalar to scalar conversion switch */
-        }
-        else {
-          /* no from offset */
-          switch (scalar_to_scalar_conversion) {
-            case 0x11: /* float to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_REG_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x11: float to float */
-            case 0x12: /* float to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_REG_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x12: float to int */
-            case 0x13: /* float to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_REG_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x13: float to bool */
-            case 0x21: /* int to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_REG_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x21: int to float */
-            case 0x22: /* int to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_REG_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x22: int to int */
-            case 0x23: /* int to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_REG_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x23: int to bool */
-            case 0x31: /* bool to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_REG_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x31: bool to float */
-            case 0x32: /* bool to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_REG_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x32: bool to int */
-            case 0x33: /* bool to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_REG_TO_OFFSET_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra_offset->local_frame_ ? to_frame->local_int_offset_ + to_ra_offset->v_.regs_[0] : to_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, to_offset_step_size));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x33: bool to bool */
-          } /* end scalar to scalar conversion switch */
-        }
-      }
-      else {
-        /* no to offset */
-        if (from_ra_offset && (from_ra_offset->kind_ != slrak_void)) {
-          /* have a from offset */
-          switch (scalar_to_scalar_conversion) {
-            case 0x11: /* float to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_OFFSET_REG_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x11: float to float */
-            case 0x12: /* float to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_OFFSET_REG_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x12: float to int */
-            case 0x13: /* float to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_OFFSET_REG_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x13: float to bool */
-            case 0x21: /* int to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_OFFSET_REG_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x21: int to float */
-            case 0x22: /* int to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_OFFSET_REG_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x22: int to int */
-            case 0x23: /* int to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_OFFSET_REG_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x23: int to bool */
-            case 0x31: /* bool to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_OFFSET_REG_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x31: bool to float */
-            case 0x32: /* bool to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_OFFSET_REG_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x32: bool to int */
-            case 0x33: /* bool to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_OFFSET_REG_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra_offset->local_frame_ ? from_frame->local_int_offset_ + from_ra_offset->v_.regs_[0] : from_ra_offset->v_.regs_[0]));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, 0));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_litu(blk->body_, from_offset_step_size));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x33: bool to bool */
-          } /* end scalar to scalar conversion switch */
-        }
-        else {
-          /* no from offset */
-          switch (scalar_to_scalar_conversion) {
-            case 0x11: /* float to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F_REG_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x11: float to float */
-            case 0x12: /* float to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2I_REG_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x12: float to int */
-            case 0x13: /* float to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_F2B_REG_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, from_ra->local_frame_ ? from_frame->local_float_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x13: float to bool */
-            case 0x21: /* int to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2F_REG_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x21: int to float */
-            case 0x22: /* int to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I_REG_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x22: int to int */
-            case 0x23: /* int to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_I2B_REG_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, from_ra->local_frame_ ? from_frame->local_int_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x23: int to bool */
-            case 0x31: /* bool to float */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2F_REG_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_float(blk->body_, to_ra->local_frame_ ? to_frame->local_float_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x31: bool to float */
-            case 0x32: /* bool to int */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B2I_REG_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_int(blk->body_, to_ra->local_frame_ ? to_frame->local_int_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x32: bool to int */
-            case 0x33: /* bool to bool */ {
-              for (k = 0; k < array_quantity; ++k) {
-                struct ir_instr *mov_instr = ir_block_append_instr(blk, SLIR_REG_MOVE_B_REG_TO_REG);
-                ir_instr_append_use(mov_instr, chain_reg);
-                ir_instr_append_def(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, to_ra->local_frame_ ? to_frame->local_bool_offset_ + to_ra->v_.regs_[to_component] + k : to_ra->v_.regs_[to_component] + k));
-                ir_instr_append_use(mov_instr, ir_body_alloc_temp_banked_bool(blk->body_, from_ra->local_frame_ ? from_frame->local_bool_offset_ + from_ra->v_.regs_[from_component] + k : from_ra->v_.regs_[from_component] + k));
-              } /* end for k array_quantity */
-              break;
-            } /* end case 0x33: bool to bool */
-          } /* end scalar to scalar conversion switch */
-        }
-      }
-    }
+  if (!blk) return;
+  from_cat = sl_reg_emit_category(from_ra->kind_, &from_num_components);
+  to_cat = sl_reg_emit_category(to_ra->kind_, &to_num_components);
+  if ((from_cat < 0) || (from_cat > SL_REG_EMIT_CAT_BOOL)) return;
+  if ((to_cat < 0) || (to_cat > SL_REG_EMIT_CAT_BOOL)) return;
+  if (from_component >= from_num_components) return;
+  if (to_component >= to_num_components) return;
+
+  for (k = 0; k < array_quantity; ++k) {
+    struct sl_reg_emit_side from, to;
+    sl_reg_emit_resolve(&from, from_frame, from_cat, from_ra, from_ra_offset, from_component, k, from_offset_step_size);
+    sl_reg_emit_resolve(&to, to_frame, to_cat, to_ra, to_ra_offset, to_component, k, to_offset_step_size);
+    sl_reg_emit_move_instr(blk, chain_reg, from_cat, &from, to_cat, &to);
+  }
+}
+
+void sl_reg_move_instr(struct sl_execution *exec, sl_exec_row_t row, int instruction_code, const int *args) {
+  switch (instruction_code) {
+    case SLIR_REG_MOVE_F_REG_TO_REG: sl_reg_move_f_reg_to_reg(exec, row, args[0], args[1]); break;
+    case SLIR_REG_MOVE_F_REG_TO_INDIR: sl_reg_move_f_reg_to_indir(exec, row, args[0], args[1], args[2]); break;
+    case SLIR_REG_MOVE_F_REG_TO_OFFSET_REG: sl_reg_move_f_reg_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_F_REG_TO_INDIR_OFFSET: sl_reg_move_f_reg_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_F_INDIR_TO_REG: sl_reg_move_f_indir_to_reg(exec, row, args[0], args[1], args[2]); break;
+    case SLIR_REG_MOVE_F_INDIR_TO_INDIR: sl_reg_move_f_indir_to_indir(exec, row, args[0], args[1], args[2], args[3]); break;
+    case SLIR_REG_MOVE_F_INDIR_TO_OFFSET_REG: sl_reg_move_f_indir_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_F_INDIR_TO_INDIR_OFFSET: sl_reg_move_f_indir_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_F_OFFSET_REG_TO_REG: sl_reg_move_f_offset_reg_to_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_F_OFFSET_REG_TO_INDIR: sl_reg_move_f_offset_reg_to_indir(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_F_OFFSET_REG_TO_OFFSET_REG: sl_reg_move_f_offset_reg_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_F_OFFSET_REG_TO_INDIR_OFFSET: sl_reg_move_f_offset_reg_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_F_INDIR_OFFSET_TO_REG: sl_reg_move_f_indir_offset_to_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_F_INDIR_OFFSET_TO_INDIR: sl_reg_move_f_indir_offset_to_indir(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_F_INDIR_OFFSET_TO_OFFSET_REG: sl_reg_move_f_indir_offset_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_F_INDIR_OFFSET_TO_INDIR_OFFSET: sl_reg_move_f_indir_offset_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_F2I_REG_TO_REG: sl_reg_move_f2i_reg_to_reg(exec, row, args[0], args[1]); break;
+    case SLIR_REG_MOVE_F2I_REG_TO_INDIR: sl_reg_move_f2i_reg_to_indir(exec, row, args[0], args[1], args[2]); break;
+    case SLIR_REG_MOVE_F2I_REG_TO_OFFSET_REG: sl_reg_move_f2i_reg_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_F2I_REG_TO_INDIR_OFFSET: sl_reg_move_f2i_reg_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_F2I_INDIR_TO_REG: sl_reg_move_f2i_indir_to_reg(exec, row, args[0], args[1], args[2]); break;
+    case SLIR_REG_MOVE_F2I_INDIR_TO_INDIR: sl_reg_move_f2i_indir_to_indir(exec, row, args[0], args[1], args[2], args[3]); break;
+    case SLIR_REG_MOVE_F2I_INDIR_TO_OFFSET_REG: sl_reg_move_f2i_indir_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_F2I_INDIR_TO_INDIR_OFFSET: sl_reg_move_f2i_indir_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_F2I_OFFSET_REG_TO_REG: sl_reg_move_f2i_offset_reg_to_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_F2I_OFFSET_REG_TO_INDIR: sl_reg_move_f2i_offset_reg_to_indir(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_F2I_OFFSET_REG_TO_OFFSET_REG: sl_reg_move_f2i_offset_reg_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_F2I_OFFSET_REG_TO_INDIR_OFFSET: sl_reg_move_f2i_offset_reg_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_F2I_INDIR_OFFSET_TO_REG: sl_reg_move_f2i_indir_offset_to_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_F2I_INDIR_OFFSET_TO_INDIR: sl_reg_move_f2i_indir_offset_to_indir(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_F2I_INDIR_OFFSET_TO_OFFSET_REG: sl_reg_move_f2i_indir_offset_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_F2I_INDIR_OFFSET_TO_INDIR_OFFSET: sl_reg_move_f2i_indir_offset_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_F2B_REG_TO_REG: sl_reg_move_f2b_reg_to_reg(exec, row, args[0], args[1]); break;
+    case SLIR_REG_MOVE_F2B_REG_TO_INDIR: sl_reg_move_f2b_reg_to_indir(exec, row, args[0], args[1], args[2]); break;
+    case SLIR_REG_MOVE_F2B_REG_TO_OFFSET_REG: sl_reg_move_f2b_reg_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_F2B_REG_TO_INDIR_OFFSET: sl_reg_move_f2b_reg_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_F2B_INDIR_TO_REG: sl_reg_move_f2b_indir_to_reg(exec, row, args[0], args[1], args[2]); break;
+    case SLIR_REG_MOVE_F2B_INDIR_TO_INDIR: sl_reg_move_f2b_indir_to_indir(exec, row, args[0], args[1], args[2], args[3]); break;
+    case SLIR_REG_MOVE_F2B_INDIR_TO_OFFSET_REG: sl_reg_move_f2b_indir_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_F2B_INDIR_TO_INDIR_OFFSET: sl_reg_move_f2b_indir_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_F2B_OFFSET_REG_TO_REG: sl_reg_move_f2b_offset_reg_to_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_F2B_OFFSET_REG_TO_INDIR: sl_reg_move_f2b_offset_reg_to_indir(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_F2B_OFFSET_REG_TO_OFFSET_REG: sl_reg_move_f2b_offset_reg_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_F2B_OFFSET_REG_TO_INDIR_OFFSET: sl_reg_move_f2b_offset_reg_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_F2B_INDIR_OFFSET_TO_REG: sl_reg_move_f2b_indir_offset_to_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_F2B_INDIR_OFFSET_TO_INDIR: sl_reg_move_f2b_indir_offset_to_indir(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_F2B_INDIR_OFFSET_TO_OFFSET_REG: sl_reg_move_f2b_indir_offset_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_F2B_INDIR_OFFSET_TO_INDIR_OFFSET: sl_reg_move_f2b_indir_offset_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_I2F_REG_TO_REG: sl_reg_move_i2f_reg_to_reg(exec, row, args[0], args[1]); break;
+    case SLIR_REG_MOVE_I2F_REG_TO_INDIR: sl_reg_move_i2f_reg_to_indir(exec, row, args[0], args[1], args[2]); break;
+    case SLIR_REG_MOVE_I2F_REG_TO_OFFSET_REG: sl_reg_move_i2f_reg_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_I2F_REG_TO_INDIR_OFFSET: sl_reg_move_i2f_reg_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_I2F_INDIR_TO_REG: sl_reg_move_i2f_indir_to_reg(exec, row, args[0], args[1], args[2]); break;
+    case SLIR_REG_MOVE_I2F_INDIR_TO_INDIR: sl_reg_move_i2f_indir_to_indir(exec, row, args[0], args[1], args[2], args[3]); break;
+    case SLIR_REG_MOVE_I2F_INDIR_TO_OFFSET_REG: sl_reg_move_i2f_indir_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_I2F_INDIR_TO_INDIR_OFFSET: sl_reg_move_i2f_indir_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_I2F_OFFSET_REG_TO_REG: sl_reg_move_i2f_offset_reg_to_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_I2F_OFFSET_REG_TO_INDIR: sl_reg_move_i2f_offset_reg_to_indir(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_I2F_OFFSET_REG_TO_OFFSET_REG: sl_reg_move_i2f_offset_reg_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_I2F_OFFSET_REG_TO_INDIR_OFFSET: sl_reg_move_i2f_offset_reg_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_I2F_INDIR_OFFSET_TO_REG: sl_reg_move_i2f_indir_offset_to_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_I2F_INDIR_OFFSET_TO_INDIR: sl_reg_move_i2f_indir_offset_to_indir(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_I2F_INDIR_OFFSET_TO_OFFSET_REG: sl_reg_move_i2f_indir_offset_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_I2F_INDIR_OFFSET_TO_INDIR_OFFSET: sl_reg_move_i2f_indir_offset_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_I_REG_TO_REG: sl_reg_move_i_reg_to_reg(exec, row, args[0], args[1]); break;
+    case SLIR_REG_MOVE_I_REG_TO_INDIR: sl_reg_move_i_reg_to_indir(exec, row, args[0], args[1], args[2]); break;
+    case SLIR_REG_MOVE_I_REG_TO_OFFSET_REG: sl_reg_move_i_reg_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_I_REG_TO_INDIR_OFFSET: sl_reg_move_i_reg_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_I_INDIR_TO_REG: sl_reg_move_i_indir_to_reg(exec, row, args[0], args[1], args[2]); break;
+    case SLIR_REG_MOVE_I_INDIR_TO_INDIR: sl_reg_move_i_indir_to_indir(exec, row, args[0], args[1], args[2], args[3]); break;
+    case SLIR_REG_MOVE_I_INDIR_TO_OFFSET_REG: sl_reg_move_i_indir_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_I_INDIR_TO_INDIR_OFFSET: sl_reg_move_i_indir_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_I_OFFSET_REG_TO_REG: sl_reg_move_i_offset_reg_to_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_I_OFFSET_REG_TO_INDIR: sl_reg_move_i_offset_reg_to_indir(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_I_OFFSET_REG_TO_OFFSET_REG: sl_reg_move_i_offset_reg_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_I_OFFSET_REG_TO_INDIR_OFFSET: sl_reg_move_i_offset_reg_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_I_INDIR_OFFSET_TO_REG: sl_reg_move_i_indir_offset_to_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_I_INDIR_OFFSET_TO_INDIR: sl_reg_move_i_indir_offset_to_indir(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_I_INDIR_OFFSET_TO_OFFSET_REG: sl_reg_move_i_indir_offset_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_I_INDIR_OFFSET_TO_INDIR_OFFSET: sl_reg_move_i_indir_offset_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_I2B_REG_TO_REG: sl_reg_move_i2b_reg_to_reg(exec, row, args[0], args[1]); break;
+    case SLIR_REG_MOVE_I2B_REG_TO_INDIR: sl_reg_move_i2b_reg_to_indir(exec, row, args[0], args[1], args[2]); break;
+    case SLIR_REG_MOVE_I2B_REG_TO_OFFSET_REG: sl_reg_move_i2b_reg_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_I2B_REG_TO_INDIR_OFFSET: sl_reg_move_i2b_reg_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_I2B_INDIR_TO_REG: sl_reg_move_i2b_indir_to_reg(exec, row, args[0], args[1], args[2]); break;
+    case SLIR_REG_MOVE_I2B_INDIR_TO_INDIR: sl_reg_move_i2b_indir_to_indir(exec, row, args[0], args[1], args[2], args[3]); break;
+    case SLIR_REG_MOVE_I2B_INDIR_TO_OFFSET_REG: sl_reg_move_i2b_indir_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_I2B_INDIR_TO_INDIR_OFFSET: sl_reg_move_i2b_indir_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_I2B_OFFSET_REG_TO_REG: sl_reg_move_i2b_offset_reg_to_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_I2B_OFFSET_REG_TO_INDIR: sl_reg_move_i2b_offset_reg_to_indir(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_I2B_OFFSET_REG_TO_OFFSET_REG: sl_reg_move_i2b_offset_reg_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_I2B_OFFSET_REG_TO_INDIR_OFFSET: sl_reg_move_i2b_offset_reg_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_I2B_INDIR_OFFSET_TO_REG: sl_reg_move_i2b_indir_offset_to_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_I2B_INDIR_OFFSET_TO_INDIR: sl_reg_move_i2b_indir_offset_to_indir(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_I2B_INDIR_OFFSET_TO_OFFSET_REG: sl_reg_move_i2b_indir_offset_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_I2B_INDIR_OFFSET_TO_INDIR_OFFSET: sl_reg_move_i2b_indir_offset_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_B2F_REG_TO_REG: sl_reg_move_b2f_reg_to_reg(exec, row, args[0], args[1]); break;
+    case SLIR_REG_MOVE_B2F_REG_TO_INDIR: sl_reg_move_b2f_reg_to_indir(exec, row, args[0], args[1], args[2]); break;
+    case SLIR_REG_MOVE_B2F_REG_TO_OFFSET_REG: sl_reg_move_b2f_reg_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_B2F_REG_TO_INDIR_OFFSET: sl_reg_move_b2f_reg_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_B2F_INDIR_TO_REG: sl_reg_move_b2f_indir_to_reg(exec, row, args[0], args[1], args[2]); break;
+    case SLIR_REG_MOVE_B2F_INDIR_TO_INDIR: sl_reg_move_b2f_indir_to_indir(exec, row, args[0], args[1], args[2], args[3]); break;
+    case SLIR_REG_MOVE_B2F_INDIR_TO_OFFSET_REG: sl_reg_move_b2f_indir_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_B2F_INDIR_TO_INDIR_OFFSET: sl_reg_move_b2f_indir_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_B2F_OFFSET_REG_TO_REG: sl_reg_move_b2f_offset_reg_to_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_B2F_OFFSET_REG_TO_INDIR: sl_reg_move_b2f_offset_reg_to_indir(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_B2F_OFFSET_REG_TO_OFFSET_REG: sl_reg_move_b2f_offset_reg_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_B2F_OFFSET_REG_TO_INDIR_OFFSET: sl_reg_move_b2f_offset_reg_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_B2F_INDIR_OFFSET_TO_REG: sl_reg_move_b2f_indir_offset_to_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_B2F_INDIR_OFFSET_TO_INDIR: sl_reg_move_b2f_indir_offset_to_indir(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_B2F_INDIR_OFFSET_TO_OFFSET_REG: sl_reg_move_b2f_indir_offset_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_B2F_INDIR_OFFSET_TO_INDIR_OFFSET: sl_reg_move_b2f_indir_offset_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_B2I_REG_TO_REG: sl_reg_move_b2i_reg_to_reg(exec, row, args[0], args[1]); break;
+    case SLIR_REG_MOVE_B2I_REG_TO_INDIR: sl_reg_move_b2i_reg_to_indir(exec, row, args[0], args[1], args[2]); break;
+    case SLIR_REG_MOVE_B2I_REG_TO_OFFSET_REG: sl_reg_move_b2i_reg_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_B2I_REG_TO_INDIR_OFFSET: sl_reg_move_b2i_reg_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_B2I_INDIR_TO_REG: sl_reg_move_b2i_indir_to_reg(exec, row, args[0], args[1], args[2]); break;
+    case SLIR_REG_MOVE_B2I_INDIR_TO_INDIR: sl_reg_move_b2i_indir_to_indir(exec, row, args[0], args[1], args[2], args[3]); break;
+    case SLIR_REG_MOVE_B2I_INDIR_TO_OFFSET_REG: sl_reg_move_b2i_indir_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_B2I_INDIR_TO_INDIR_OFFSET: sl_reg_move_b2i_indir_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_B2I_OFFSET_REG_TO_REG: sl_reg_move_b2i_offset_reg_to_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_B2I_OFFSET_REG_TO_INDIR: sl_reg_move_b2i_offset_reg_to_indir(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_B2I_OFFSET_REG_TO_OFFSET_REG: sl_reg_move_b2i_offset_reg_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_B2I_OFFSET_REG_TO_INDIR_OFFSET: sl_reg_move_b2i_offset_reg_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_B2I_INDIR_OFFSET_TO_REG: sl_reg_move_b2i_indir_offset_to_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_B2I_INDIR_OFFSET_TO_INDIR: sl_reg_move_b2i_indir_offset_to_indir(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_B2I_INDIR_OFFSET_TO_OFFSET_REG: sl_reg_move_b2i_indir_offset_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_B2I_INDIR_OFFSET_TO_INDIR_OFFSET: sl_reg_move_b2i_indir_offset_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_B_REG_TO_REG: sl_reg_move_b_reg_to_reg(exec, row, args[0], args[1]); break;
+    case SLIR_REG_MOVE_B_REG_TO_INDIR: sl_reg_move_b_reg_to_indir(exec, row, args[0], args[1], args[2]); break;
+    case SLIR_REG_MOVE_B_REG_TO_OFFSET_REG: sl_reg_move_b_reg_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_B_REG_TO_INDIR_OFFSET: sl_reg_move_b_reg_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_B_INDIR_TO_REG: sl_reg_move_b_indir_to_reg(exec, row, args[0], args[1], args[2]); break;
+    case SLIR_REG_MOVE_B_INDIR_TO_INDIR: sl_reg_move_b_indir_to_indir(exec, row, args[0], args[1], args[2], args[3]); break;
+    case SLIR_REG_MOVE_B_INDIR_TO_OFFSET_REG: sl_reg_move_b_indir_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_B_INDIR_TO_INDIR_OFFSET: sl_reg_move_b_indir_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_B_OFFSET_REG_TO_REG: sl_reg_move_b_offset_reg_to_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_B_OFFSET_REG_TO_INDIR: sl_reg_move_b_offset_reg_to_indir(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_B_OFFSET_REG_TO_OFFSET_REG: sl_reg_move_b_offset_reg_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_B_OFFSET_REG_TO_INDIR_OFFSET: sl_reg_move_b_offset_reg_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_B_INDIR_OFFSET_TO_REG: sl_reg_move_b_indir_offset_to_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_B_INDIR_OFFSET_TO_INDIR: sl_reg_move_b_indir_offset_to_indir(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_B_INDIR_OFFSET_TO_OFFSET_REG: sl_reg_move_b_indir_offset_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_B_INDIR_OFFSET_TO_INDIR_OFFSET: sl_reg_move_b_indir_offset_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_S2D_REG_TO_REG: sl_reg_move_s2d_reg_to_reg(exec, row, args[0], args[1]); break;
+    case SLIR_REG_MOVE_S2D_REG_TO_INDIR: sl_reg_move_s2d_reg_to_indir(exec, row, args[0], args[1], args[2]); break;
+    case SLIR_REG_MOVE_S2D_REG_TO_OFFSET_REG: sl_reg_move_s2d_reg_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_S2D_REG_TO_INDIR_OFFSET: sl_reg_move_s2d_reg_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_S2D_INDIR_TO_REG: sl_reg_move_s2d_indir_to_reg(exec, row, args[0], args[1], args[2]); break;
+    case SLIR_REG_MOVE_S2D_INDIR_TO_INDIR: sl_reg_move_s2d_indir_to_indir(exec, row, args[0], args[1], args[2], args[3]); break;
+    case SLIR_REG_MOVE_S2D_INDIR_TO_OFFSET_REG: sl_reg_move_s2d_indir_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_S2D_INDIR_TO_INDIR_OFFSET: sl_reg_move_s2d_indir_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_S2D_OFFSET_REG_TO_REG: sl_reg_move_s2d_offset_reg_to_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_S2D_OFFSET_REG_TO_INDIR: sl_reg_move_s2d_offset_reg_to_indir(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_S2D_OFFSET_REG_TO_OFFSET_REG: sl_reg_move_s2d_offset_reg_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_S2D_OFFSET_REG_TO_INDIR_OFFSET: sl_reg_move_s2d_offset_reg_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_S2D_INDIR_OFFSET_TO_REG: sl_reg_move_s2d_indir_offset_to_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_S2D_INDIR_OFFSET_TO_INDIR: sl_reg_move_s2d_indir_offset_to_indir(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_S2D_INDIR_OFFSET_TO_OFFSET_REG: sl_reg_move_s2d_indir_offset_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_S2D_INDIR_OFFSET_TO_INDIR_OFFSET: sl_reg_move_s2d_indir_offset_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_SC_REG_TO_REG: sl_reg_move_sc_reg_to_reg(exec, row, args[0], args[1]); break;
+    case SLIR_REG_MOVE_SC_REG_TO_INDIR: sl_reg_move_sc_reg_to_indir(exec, row, args[0], args[1], args[2]); break;
+    case SLIR_REG_MOVE_SC_REG_TO_OFFSET_REG: sl_reg_move_sc_reg_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_SC_REG_TO_INDIR_OFFSET: sl_reg_move_sc_reg_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_SC_INDIR_TO_REG: sl_reg_move_sc_indir_to_reg(exec, row, args[0], args[1], args[2]); break;
+    case SLIR_REG_MOVE_SC_INDIR_TO_INDIR: sl_reg_move_sc_indir_to_indir(exec, row, args[0], args[1], args[2], args[3]); break;
+    case SLIR_REG_MOVE_SC_INDIR_TO_OFFSET_REG: sl_reg_move_sc_indir_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_SC_INDIR_TO_INDIR_OFFSET: sl_reg_move_sc_indir_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_SC_OFFSET_REG_TO_REG: sl_reg_move_sc_offset_reg_to_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_SC_OFFSET_REG_TO_INDIR: sl_reg_move_sc_offset_reg_to_indir(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_SC_OFFSET_REG_TO_OFFSET_REG: sl_reg_move_sc_offset_reg_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_SC_OFFSET_REG_TO_INDIR_OFFSET: sl_reg_move_sc_offset_reg_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_SC_INDIR_OFFSET_TO_REG: sl_reg_move_sc_indir_offset_to_reg(exec, row, args[0], args[1], args[2], args[3], args[4]); break;
+    case SLIR_REG_MOVE_SC_INDIR_OFFSET_TO_INDIR: sl_reg_move_sc_indir_offset_to_indir(exec, row, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+    case SLIR_REG_MOVE_SC_INDIR_OFFSET_TO_OFFSET_REG: sl_reg_move_sc_indir_offset_to_offset_reg(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
+    case SLIR_REG_MOVE_SC_INDIR_OFFSET_TO_INDIR_OFFSET: sl_reg_move_sc_indir_offset_to_indir_offset(exec, row, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]); break;
   }
 }
 
 void sl_reg_move(struct sl_execution *exec,
-                 uint8_t row,
+                 sl_exec_row_t row,
                  struct sl_reg_alloc *from_ra, struct sl_reg_alloc *from_ra_offset,
                  struct sl_reg_alloc *to_ra, struct sl_reg_alloc *to_ra_offset) {
   sl_reg_move_crossframe(exec, row, (int)(exec->num_execution_frames_ - 1), from_ra, from_ra_offset, (int)(exec->num_execution_frames_ - 1), to_ra, to_ra_offset, 1, 1, 1);
 }
 
 void sl_reg_move_c2c(struct sl_execution *exec,
-                     uint8_t row,
+                     sl_exec_row_t row,
                      struct sl_reg_alloc *from_ra, struct sl_reg_alloc *from_ra_offset, int from_component,
                      struct sl_reg_alloc *to_ra, struct sl_reg_alloc *to_ra_offset, int to_component) {
   sl_reg_move_crossframe_c2c(exec, row, (int)(exec->num_execution_frames_ - 1), from_ra, from_ra_offset, from_component, (int)(exec->num_execution_frames_ - 1), to_ra, to_ra_offset, to_component, 1, 1, 1);
@@ -25,33 +25,42 @@ extern "C" {
 #include <stdint.h>
 #endif
 
+#ifndef SL_EXECUTION_H_INCLUDED
+#define SL_EXECUTION_H_INCLUDED
+#include "sl_execution.h"
+#endif
+
 struct sl_execution;
 struct sl_reg_alloc;
 
 void sl_reg_move_crossframe(struct sl_execution *exec,
-                            uint8_t row,
+                            sl_exec_row_t row,
                             int from_frame, struct sl_reg_alloc *from_ra, struct sl_reg_alloc *from_ra_offset,
                             int to_frame, struct sl_reg_alloc *to_ra, struct sl_reg_alloc *to_ra_offset,
                             int from_offset_step_size, int to_offset_step_size,
                             int array_quantity);
 
 void sl_reg_move_crossframe_c2c(struct sl_execution *exec,
-                                uint8_t row,
+                                sl_exec_row_t row,
                                 int from_frame, struct sl_reg_alloc *from_ra, struct sl_reg_alloc *from_ra_offset, int from_component,
                                 int to_frame, struct sl_reg_alloc *to_ra, struct sl_reg_alloc *to_ra_offset, int to_component,
                                 int from_offset_step_size, int to_offset_step_size,
                                 int array_quantity);
 
 void sl_reg_move(struct sl_execution *exec,
-                 uint8_t row,
+                 sl_exec_row_t row,
                  struct sl_reg_alloc *from_ra, struct sl_reg_alloc *from_ra_offset,
                  struct sl_reg_alloc *to_ra, struct sl_reg_alloc *to_ra_offset);
 
 void sl_reg_move_c2c(struct sl_execution *exec,
-                     uint8_t row,
+                     sl_exec_row_t row,
                      struct sl_reg_alloc *from_ra, struct sl_reg_alloc *from_ra_offset, int from_component,
                      struct sl_reg_alloc *to_ra, struct sl_reg_alloc *to_ra_offset, int to_component);
 
+/* Executes a single SLIR_REG_MOVE_XXX instruction; args holds the register and offset operands in
+ * the order in which they are emitted by sl_reg_emit_move_crossframe(), excluding the execution chain. */
+void sl_reg_move_instr(struct sl_execution *exec, sl_exec_row_t row, int instruction_code, const int *args);
+
 void sl_reg_emit_move_crossframe(struct ir_block *blk,
                                  struct ir_temp *chain_reg,
                                  struct sl_execution_frame *from_frame, struct sl_reg_alloc *from_ra, struct sl_reg_alloc *from_ra_offset,
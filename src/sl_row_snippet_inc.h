@@ -0,0 +1,71 @@
+/* Copyright 2024 Kinglet B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* file is intended to be included at sites where a float operation snippet,
+ * evaluated per row, is desired, not compiled on its own
+ * Prior to including the snippet, you should define:
+ * #define ROW_SNIPPET_OPERATOR(row) <<your operator here, evaluated for row>>
+ *
+ * For instance, to add a scalar to a column:
+ * #define ROW_SNIPPET_OPERATOR(row) left_column[row] + right
+ *
+ * It assumes the following variables/parameters are in scope:
+ * row: of type "sl_exec_row_t"; the first row of the chain
+ * chain_column: of type "const sl_exec_row_t * restrict"; points to the chain column
+ * result_column: of type "float * restrict"; points to the destination
+ *
+ * Unlike the binop and unop snippets the operator is not limited to a fixed number of operand
+ * columns, so this serves kernels that mix columns with scalars (e.g. uniforms.)
+ */
+
+for (;;) {
+  sl_exec_row_t delta;
+
+  if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
+    do {
+      int n;
+      /* Try to elicit 8-wise SIMD instructions from auto-vectorization, e.g. AVX's VMULPS ymm0, ymm1, ymm2 */
+      for (n = 0; n < 8; n++) {
+        result_column[row + n] = ROW_SNIPPET_OPERATOR(row + n);
+      }
+
+      delta = chain_column[row + 7];
+      if (!delta) break;
+      row += 7 + delta;
+    } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
+  }
+  else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
+    do {
+      int n;
+      /* Try to elicit forth 4-wise SIMD instructions from auto-vectorization, e.g. SSE's MULPS xmm0, xmm1 */
+      for (n = 0; n < 4; n++) {
+        result_column[row + n] = ROW_SNIPPET_OPERATOR(row + n);
+      }
+      delta = chain_column[row + 3];
+      if (!delta) break;
+      row += 3 + delta;
+    } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
+  }
+  else {
+    do {
+      /* Not trying to evoke auto-vectorization, just get it done. */
+      result_column[row] = ROW_SNIPPET_OPERATOR(row);
+      delta = chain_column[row];
+      if (!delta) break;
+      row += delta;
+    } while (row & 3);
+  }
+  if (!delta) break;
+}
@@ -290,6 +290,9 @@ int sl_shader_compile(struct sl_shader *sh) {
       debug_file_prefix = "d";
       break;
   };
+  /* Write out the profile (if profiling) of the previous source, and start over for this one */
+  sl_exec_profile_source(&sh->exec_, filename, sh->source_, sh->source_length_);
+
   cr = glsl_es1_compiler_compile_mem(&cc, filename, sh->source_, sh->source_length_);
   const char *compilation_suffix = "";
   if (cr != GLSL_ES1_R_SUCCESS) {
@@ -0,0 +1,436 @@
+/* Copyright 2024 Kinglet B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STDINT_H_INCLUDED
+#define STDINT_H_INCLUDED
+#include <stdint.h>
+#endif
+
+#ifndef STDLIB_H_INCLUDED
+#define STDLIB_H_INCLUDED
+#include <stdlib.h>
+#endif
+
+#ifndef STRING_H_INCLUDED
+#define STRING_H_INCLUDED
+#include <string.h>
+#endif
+
+#ifndef MATH_H_INCLUDED
+#define MATH_H_INCLUDED
+#include <math.h>
+#endif
+
+#ifdef _WIN32
+#ifndef WINDOWS_H_INCLUDED
+#define WINDOWS_H_INCLUDED
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#endif
+#else
+#ifndef PTHREAD_H_INCLUDED
+#define PTHREAD_H_INCLUDED
+#include <pthread.h>
+#endif
+#endif
+
+#ifndef SL_REG_ALLOC_H_INCLUDED
+#define SL_REG_ALLOC_H_INCLUDED
+#include "sl_reg_alloc.h"
+#endif
+
+#ifndef SL_EXECUTION_H_INCLUDED
+#define SL_EXECUTION_H_INCLUDED
+#include "sl_execution.h"
+#endif
+
+#ifndef SL_SIMD_H_INCLUDED
+#define SL_SIMD_H_INCLUDED
+#include "sl_simd.h"
+#endif
+
+#if SL_SIMD_AVAILABLE
+#ifdef _MSC_VER
+#ifndef INTRIN_H_INCLUDED
+#define INTRIN_H_INCLUDED
+#include <intrin.h>
+#endif
+#else
+#ifndef CPUID_H_INCLUDED
+#define CPUID_H_INCLUDED
+#include <cpuid.h>
+#endif
+#endif
+#ifndef IMMINTRIN_H_INCLUDED
+#define IMMINTRIN_H_INCLUDED
+#include <immintrin.h>
+#endif
+#endif
+
+struct sl_simd_kernels g_sl_simd_ = { SLSIMD_GENERIC };
+
+#if SL_SIMD_AVAILABLE
+
+/* MSVC allows any intrinsic in any function, GCC and Clang need the instruction set enabled per function
+ * so the rest of the build does not depend on it. GCC would otherwise also fuse multiplies and adds into
+ * FMA where the instruction set has it (AVX-512), changing results between levels. */
+#if defined(__clang__)
+#define SL_SIMD_TARGET(isa) __attribute__((target(isa)))
+#elif defined(__GNUC__)
+#define SL_SIMD_TARGET(isa) __attribute__((target(isa), optimize("fp-contract=off")))
+#else
+#define SL_SIMD_TARGET(isa)
+#endif
+
+/* Bit casts and conversions for the scalar width; sl_simd_cvt_i32() returns INT32_MIN for NaN and out of
+ * range values, as CVTPS2DQ does. */
+static inline float sl_simd_i32_as_f(int32_t i) {
+  float f;
+  memcpy(&f, &i, sizeof(f));
+  return f;
+}
+
+static inline int32_t sl_simd_f_as_i32(float f) {
+  int32_t i;
+  memcpy(&i, &f, sizeof(i));
+  return i;
+}
+
+static inline int32_t sl_simd_cvt_i32(float f) {
+  if (!(f >= -2147483648.f && f < 2147483648.f)) return INT32_MIN;
+  return (int32_t)f;
+}
+
+/* Vector operations for each width, 1 being plain scalar C matching the generic kernels.
+ * V<n>_F, V<n>_I and V<n>_M are the float vector, int32 vector and comparison result types; V<n>_SEL(m, a, b)
+ * picks a where m holds and b elsewhere. V<n>_ROUND rounds to nearest even, V<n>_CVTI converts an integral
+ * float to int32, and V<n>_AS_I / V<n>_AS_F reinterpret the bits. V<n>_I_MULLO keeps the low 32 bits of
+ * the product, so it serves for unsigned operands too. */
+#define V1_F float
+#define V1_I int32_t
+#define V1_M int
+#define V1_LD(p) (*(p))
+#define V1_ST(p, v) (*(p) = (v))
+#define V1_SET1(x) (x)
+#define V1_ADD(a, b) ((a) + (b))
+#define V1_SUB(a, b) ((a) - (b))
+#define V1_MUL(a, b) ((a) * (b))
+#define V1_DIV(a, b) ((a) / (b))
+#define V1_NEG(a) (-(a))
+/* As MINPS and MAXPS, the second operand if either is NaN, so the scalar rows agree with the vector rows */
+#define V1_MIN(a, b) (((a) < (b)) ? (a) : (b))
+#define V1_MAX(a, b) (((a) > (b)) ? (a) : (b))
+#define V1_SQRT(a) sqrtf(a)
+#define V1_ROUND(a) nearbyintf(a)
+#define V1_XOR(a, b) sl_simd_i32_as_f(sl_simd_f_as_i32(a) ^ sl_simd_f_as_i32(b))
+#define V1_CMPLT(a, b) ((a) < (b))
+#define V1_CMPEQ(a, b) ((a) == (b))
+#define V1_ISNAN(a) ((a) != (a))
+#define V1_SEL(m, a, b) ((m) ? (a) : (b))
+#define V1_CVTI(a) sl_simd_cvt_i32(a)
+#define V1_CVTF(i) ((float)(i))
+#define V1_AS_I(a) sl_simd_f_as_i32(a)
+#define V1_AS_F(i) sl_simd_i32_as_f(i)
+#define V1_I_LD(p) (*(const int32_t *)(p))
+#define V1_I_ST(p, v) (*(int32_t *)(p) = (v))
+#define V1_I_SET1(x) ((int32_t)(x))
+#define V1_I_ADD(a, b) ((a) + (b))
+#define V1_I_SUB(a, b) ((a) - (b))
+#define V1_I_MULLO(a, b) ((int32_t)((uint32_t)(a) * (uint32_t)(b)))
+#define V1_I_AND(a, b) ((a) & (b))
+#define V1_I_OR(a, b) ((a) | (b))
+#define V1_I_SLLI(a, n) ((int32_t)((uint32_t)(a) << (n)))
+#define V1_I_SRLI(a, n) ((int32_t)((uint32_t)(a) >> (n)))
+#define V1_I_SRAI(a, n) ((a) >> (n))
+/* Non-zero if bit (a single bit) is set in a */
+#define V1_I_TESTBIT(a, bit) (((a) & (bit)) != 0)
+
+#define V4_F __m128
+#define V4_I __m128i
+#define V4_M __m128
+
+#define V4_LD(p) _mm_loadu_ps(p)
+#define V4_ST(p, v) _mm_storeu_ps(p, v)
+#define V4_SET1(x) _mm_set1_ps(x)
+#define V4_ADD(a, b) _mm_add_ps(a, b)
+#define V4_SUB(a, b) _mm_sub_ps(a, b)
+#define V4_MUL(a, b) _mm_mul_ps(a, b)
+#define V4_DIV(a, b) _mm_div_ps(a, b)
+#define V4_NEG(a) _mm_xor_ps(a, _mm_set1_ps(-0.f))
+#define V4_MIN(a, b) _mm_min_ps(a, b)
+#define V4_MAX(a, b) _mm_max_ps(a, b)
+#define V4_SQRT(a) _mm_sqrt_ps(a)
+#define V4_ROUND(a) _mm_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)
+#define V4_XOR(a, b) _mm_xor_ps(a, b)
+#define V4_CMPLT(a, b) _mm_cmplt_ps(a, b)
+#define V4_CMPEQ(a, b) _mm_cmpeq_ps(a, b)
+#define V4_ISNAN(a) _mm_cmpunord_ps(a, a)
+#define V4_SEL(m, a, b) _mm_blendv_ps(b, a, m)
+#define V4_CVTI(a) _mm_cvtps_epi32(a)
+#define V4_CVTF(i) _mm_cvtepi32_ps(i)
+#define V4_AS_I(a) _mm_castps_si128(a)
+#define V4_AS_F(i) _mm_castsi128_ps(i)
+#define V4_I_LD(p) _mm_loadu_si128((const __m128i *)(p))
+#define V4_I_ST(p, v) _mm_storeu_si128((__m128i *)(p), v)
+#define V4_I_SET1(x) _mm_set1_epi32(x)
+#define V4_I_ADD(a, b) _mm_add_epi32(a, b)
+#define V4_I_SUB(a, b) _mm_sub_epi32(a, b)
+#define V4_I_MULLO(a, b) _mm_mullo_epi32(a, b)
+#define V4_I_AND(a, b) _mm_and_si128(a, b)
+#define V4_I_OR(a, b) _mm_or_si128(a, b)
+#define V4_I_SLLI(a, n) _mm_slli_epi32(a, n)
+#define V4_I_SRLI(a, n) _mm_srli_epi32(a, n)
+#define V4_I_SRAI(a, n) _mm_srai_epi32(a, n)
+#define V4_I_TESTBIT(a, bit) _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(a, _mm_set1_epi32(bit)), _mm_set1_epi32(bit)))
+/* Stores the lanes whose bit is set in bits */
+#define V4_MST(p, bits, v) _mm_storeu_ps(p, _mm_blendv_ps(_mm_loadu_ps(p), v, _mm_castsi128_ps(V4_BITS_TO_LANES(bits))))
+#define V4_BITS_TO_LANES(bits) _mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32((int)(bits)), _mm_setr_epi32(1, 2, 4, 8)), _mm_setr_epi32(1, 2, 4, 8))
+
+#define V8_F __m256
+#define V8_I __m256i
+#define V8_M __m256
+#define V8_LD(p) _mm256_loadu_ps(p)
+#define V8_ST(p, v) _mm256_storeu_ps(p, v)
+#define V8_SET1(x) _mm256_set1_ps(x)
+#define V8_ADD(a, b) _mm256_add_ps(a, b)
+#define V8_SUB(a, b) _mm256_sub_ps(a, b)
+#define V8_MUL(a, b) _mm256_mul_ps(a, b)
+#define V8_DIV(a, b) _mm256_div_ps(a, b)
+#define V8_NEG(a) _mm256_xor_ps(a, _mm256_set1_ps(-0.f))
+#define V8_MIN(a, b) _mm256_min_ps(a, b)
+#define V8_MAX(a, b) _mm256_max_ps(a, b)
+#define V8_SQRT(a) _mm256_sqrt_ps(a)
+#define V8_ROUND(a) _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)
+#define V8_XOR(a, b) _mm256_xor_ps(a, b)
+#define V8_CMPLT(a, b) _mm256_cmp_ps(a, b, _CMP_LT_OQ)
+#define V8_CMPEQ(a, b) _mm256_cmp_ps(a, b, _CMP_EQ_OQ)
+#define V8_ISNAN(a) _mm256_cmp_ps(a, a, _CMP_UNORD_Q)
+#define V8_SEL(m, a, b) _mm256_blendv_ps(b, a, m)
+#define V8_CVTI(a) _mm256_cvtps_epi32(a)
+#define V8_CVTF(i) _mm256_cvtepi32_ps(i)
+#define V8_AS_I(a) _mm256_castps_si256(a)
+#define V8_AS_F(i) _mm256_castsi256_ps(i)
+#define V8_I_LD(p) _mm256_loadu_si256((const __m256i *)(p))
+#define V8_I_ST(p, v) _mm256_storeu_si256((__m256i *)(p), v)
+#define V8_I_SET1(x) _mm256_set1_epi32(x)
+#define V8_I_ADD(a, b) _mm256_add_epi32(a, b)
+#define V8_I_SUB(a, b) _mm256_sub_epi32(a, b)
+#define V8_I_MULLO(a, b) _mm256_mullo_epi32(a, b)
+#define V8_I_AND(a, b) _mm256_and_si256(a, b)
+#define V8_I_OR(a, b) _mm256_or_si256(a, b)
+#define V8_I_SLLI(a, n) _mm256_slli_epi32(a, n)
+#define V8_I_SRLI(a, n) _mm256_srli_epi32(a, n)
+#define V8_I_SRAI(a, n) _mm256_srai_epi32(a, n)
+#define V8_I_TESTBIT(a, bit) _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(a, _mm256_set1_epi32(bit)), _mm256_set1_epi32(bit)))
+#define V8_MST(p, bits, v) _mm256_maskstore_ps(p, V8_BITS_TO_LANES(bits), v)
+#define V8_BITS_TO_LANES(bits) _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32((int)(bits)), _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128)), \
+                                                  _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128))
+
+#define V16_F __m512
+#define V16_I __m512i
+#define V16_M __mmask16
+#define V16_LD(p) _mm512_loadu_ps(p)
+#define V16_ST(p, v) _mm512_storeu_ps(p, v)
+#define V16_SET1(x) _mm512_set1_ps(x)
+#define V16_ADD(a, b) _mm512_add_ps(a, b)
+#define V16_SUB(a, b) _mm512_sub_ps(a, b)
+#define V16_MUL(a, b) _mm512_mul_ps(a, b)
+#define V16_DIV(a, b) _mm512_div_ps(a, b)
+/* _mm512_xor_ps needs AVX-512DQ, stick to AVX-512F */
+#define V16_NEG(a) _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a), _mm512_set1_epi32((int)0x80000000)))
+#define V16_MIN(a, b) _mm512_min_ps(a, b)
+#define V16_MAX(a, b) _mm512_max_ps(a, b)
+#define V16_SQRT(a) _mm512_sqrt_ps(a)
+#define V16_ROUND(a) _mm512_roundscale_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)
+#define V16_XOR(a, b) _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a), _mm512_castps_si512(b)))
+#define V16_CMPLT(a, b) _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ)
+#define V16_CMPEQ(a, b) _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ)
+#define V16_ISNAN(a) _mm512_cmp_ps_mask(a, a, _CMP_UNORD_Q)
+#define V16_SEL(m, a, b) _mm512_mask_blend_ps(m, b, a)
+#define V16_CVTI(a) _mm512_cvtps_epi32(a)
+#define V16_CVTF(i) _mm512_cvtepi32_ps(i)
+#define V16_AS_I(a) _mm512_castps_si512(a)
+#define V16_AS_F(i) _mm512_castsi512_ps(i)
+#define V16_I_LD(p) _mm512_loadu_si512((const void *)(p))
+#define V16_I_ST(p, v) _mm512_storeu_si512((void *)(p), v)
+#define V16_I_SET1(x) _mm512_set1_epi32(x)
+#define V16_I_ADD(a, b) _mm512_add_epi32(a, b)
+#define V16_I_SUB(a, b) _mm512_sub_epi32(a, b)
+#define V16_I_MULLO(a, b) _mm512_mullo_epi32(a, b)
+#define V16_I_AND(a, b) _mm512_and_si512(a, b)
+#define V16_I_OR(a, b) _mm512_or_si512(a, b)
+#define V16_I_SLLI(a, n) _mm512_slli_epi32(a, n)
+#define V16_I_SRLI(a, n) _mm512_srli_epi32(a, n)
+#define V16_I_SRAI(a, n) _mm512_srai_epi32(a, n)
+#define V16_I_TESTBIT(a, bit) _mm512_test_epi32_mask(a, _mm512_set1_epi32(bit))
+#define V16_MST(p, bits, v) _mm512_mask_storeu_ps(p, (__mmask16)(bits), v)
+
+#define SL_SIMD_KERNELS_SUFFIX sse41
+#define SL_SIMD_KERNELS_WIDTH 4
+#define SL_SIMD_KERNELS_TARGET SL_SIMD_TARGET("sse4.1")
+#include "sl_simd_kernels_inc.h"
+#undef SL_SIMD_KERNELS_SUFFIX
+#undef SL_SIMD_KERNELS_WIDTH
+#undef SL_SIMD_KERNELS_TARGET
+
+#define SL_SIMD_KERNELS_SUFFIX avx2
+#define SL_SIMD_KERNELS_WIDTH 8
+#define SL_SIMD_KERNELS_TARGET SL_SIMD_TARGET("avx2")
+#include "sl_simd_kernels_inc.h"
+#undef SL_SIMD_KERNELS_SUFFIX
+#undef SL_SIMD_KERNELS_WIDTH
+#undef SL_SIMD_KERNELS_TARGET
+
+#define SL_SIMD_KERNELS_SUFFIX avx512
+#define SL_SIMD_KERNELS_WIDTH 16
+#define SL_SIMD_KERNELS_TARGET SL_SIMD_TARGET("avx512f")
+#include "sl_simd_kernels_inc.h"
+#undef SL_SIMD_KERNELS_SUFFIX
+#undef SL_SIMD_KERNELS_WIDTH
+#undef SL_SIMD_KERNELS_TARGET
+
+static void sl_simd_cpuid(unsigned int leaf, unsigned int regs[4]) {
+#ifdef _MSC_VER
+  int r[4];
+  __cpuid(r, 0);
+  if ((unsigned int)r[0] < leaf) {
+    regs[0] = regs[1] = regs[2] = regs[3] = 0;
+    return;
+  }
+  __cpuidex(r, (int)leaf, 0);
+  regs[0] = (unsigned int)r[0];
+  regs[1] = (unsigned int)r[1];
+  regs[2] = (unsigned int)r[2];
+  regs[3] = (unsigned int)r[3];
+#else
+  if (__get_cpuid_max(0, NULL) < leaf) {
+    regs[0] = regs[1] = regs[2] = regs[3] = 0;
+    return;
+  }
+  __cpuid_count(leaf, 0, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+/* Register state the OS saves on context switches (XCR0), only valid if CPUID reports OSXSAVE */
+static uint64_t sl_simd_xgetbv(void) {
+#ifdef _MSC_VER
+  return (uint64_t)_xgetbv(0);
+#else
+  uint32_t eax, edx;
+  __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return ((uint64_t)edx << 32) | eax;
+#endif
+}
+
+#endif /* SL_SIMD_AVAILABLE */
+
+sl_simd_level_t sl_simd_detect(void) {
+#if SL_SIMD_AVAILABLE
+  unsigned int leaf1[4], leaf7[4];
+  uint64_t xcr0;
+  sl_simd_cpuid(1, leaf1);
+  sl_simd_cpuid(7, leaf7);
+
+  /* CPUID leaf 1, ECX bit 19 */
+  if (!(leaf1[2] & (1 << 19))) return SLSIMD_GENERIC;
+
+  /* AVX needs the OS to save the YMM registers; leaf 1 ECX bit 27 is OSXSAVE, bit 28 is AVX, and
+   * XCR0 bits 1 and 2 the XMM and YMM state */
+  if ((leaf1[2] & ((1 << 27) | (1 << 28))) != ((1 << 27) | (1 << 28))) return SLSIMD_SSE41;
+  xcr0 = sl_simd_xgetbv();
+  if ((xcr0 & 0x6) != 0x6) return SLSIMD_SSE41;
+
+  /* CPUID leaf 7, EBX bit 5 */
+  if (!(leaf7[1] & (1 << 5))) return SLSIMD_SSE41;
+
+  /* AVX-512F is leaf 7 EBX bit 16, and XCR0 bits 5 to 7 the opmask and ZMM state */
+  if (!(leaf7[1] & (1 << 16))) return SLSIMD_AVX2;
+  if ((xcr0 & 0xE6) != 0xE6) return SLSIMD_AVX2;
+
+  return SLSIMD_AVX512;
+#else
+  return SLSIMD_GENERIC;
+#endif
+}
+
+sl_simd_level_t sl_simd_select(sl_simd_level_t level) {
+  struct sl_simd_kernels k;
+  sl_simd_level_t supported = sl_simd_detect();
+  if (level > supported) level = supported;
+
+  memset(&k, 0, sizeof(k));
+  k.level_ = level;
+#if SL_SIMD_AVAILABLE
+  switch (level) {
+    case SLSIMD_GENERIC:
+      break;
+    case SLSIMD_SSE41:
+      sl_simd_get_kernels_sse41(&k);
+      break;
+    case SLSIMD_AVX2:
+      sl_simd_get_kernels_avx2(&k);
+      break;
+    case SLSIMD_AVX512:
+      sl_simd_get_kernels_avx512(&k);
+      break;
+  }
+#endif
+  g_sl_simd_ = k;
+  return level;
+}
+
+static void sl_simd_select_default(void) {
+  const char *env = getenv("AEX_SL_SIMD");
+  sl_simd_level_t level = SLSIMD_AVX512;
+  if (env) {
+    if (!strcmp(env, "generic")) level = SLSIMD_GENERIC;
+    else if (!strcmp(env, "sse4.1")) level = SLSIMD_SSE41;
+    else if (!strcmp(env, "avx2")) level = SLSIMD_AVX2;
+    else if (!strcmp(env, "avx512")) level = SLSIMD_AVX512;
+  }
+  sl_simd_select(level);
+}
+
+#ifdef _WIN32
+static INIT_ONCE g_sl_simd_init_once_ = INIT_ONCE_STATIC_INIT;
+static BOOL CALLBACK sl_simd_select_default_once(PINIT_ONCE init_once, PVOID param, PVOID *context) {
+  sl_simd_select_default();
+  return TRUE;
+}
+#else
+static pthread_once_t g_sl_simd_init_once_ = PTHREAD_ONCE_INIT;
+#endif
+
+void sl_simd_init(void) {
+#ifdef _WIN32
+  InitOnceExecuteOnce(&g_sl_simd_init_once_, sl_simd_select_default_once, NULL, NULL);
+#else
+  pthread_once(&g_sl_simd_init_once_, sl_simd_select_default);
+#endif
+}
+
+sl_simd_level_t sl_simd_level(void) {
+  return g_sl_simd_.level_;
+}
+
+const char *sl_simd_level_name(sl_simd_level_t level) {
+  switch (level) {
+    case SLSIMD_GENERIC: return "generic";
+    case SLSIMD_SSE41: return "sse4.1";
+    case SLSIMD_AVX2: return "avx2";
+    case SLSIMD_AVX512: return "avx512";
+  }
+  return "unknown";
+}
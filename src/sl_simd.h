@@ -0,0 +1,186 @@
+/* Copyright 2024 Kinglet B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SL_SIMD_H
+#define SL_SIMD_H
+
+#ifndef STDINT_H_INCLUDED
+#define STDINT_H_INCLUDED
+#include <stdint.h>
+#endif
+
+#ifndef SL_EXECUTION_H_INCLUDED
+#define SL_EXECUTION_H_INCLUDED
+#include "sl_execution.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Hand-written SIMD variants of the float kernels, selected at runtime.
+ *
+ * The instruction set is picked once, upon creation of the first context, as the best level supported by
+ * the host (through CPUID.) The environment variable AEX_SL_SIMD ("generic", "sse4.1", "avx2" or
+ * "avx512") lowers it, e.g. to benchmark each level; sl_simd_select() does the same programmatically.
+ * All levels produce bit-identical results (no FMA is used) so the choice only affects speed.
+ *
+ * The exception is the transcendental builtins (sin, cos, exp, exp2, log, log2 and pow): the generic level
+ * calls libm for these, whereas the other levels have polynomial approximations that are only used when
+ * the shader runs in SLEA_SPEC accuracy mode, see sl_execution::accuracy_. These agree across the SIMD
+ * levels but not with libm. */
+
+/* The SIMD kernels are only available when building for x86 */
+#if defined(_M_X64) || defined(__x86_64__) || defined(_M_IX86) || defined(__i386__)
+#define SL_SIMD_AVAILABLE 1
+#else
+#define SL_SIMD_AVAILABLE 0
+#endif
+
+typedef enum sl_simd_level {
+  SLSIMD_GENERIC, /* portable C in the snippets, left to the compiler's auto-vectorization */
+  SLSIMD_SSE41,
+  SLSIMD_AVX2,
+  SLSIMD_AVX512
+} sl_simd_level_t;
+
+typedef void (*sl_simd_f_unop_fn)(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, const float *restrict opd_column);
+typedef void (*sl_simd_f_binop_fn)(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, const float *restrict left_column, const float *restrict right_column);
+typedef void (*sl_simd_f_ternop_fn)(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, const float *restrict first_column, const float *restrict second_column, const float *restrict third_column);
+typedef void (*sl_simd_f_dot_product2_fn)(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column,
+                                          const float *restrict left_0_column, const float *restrict left_1_column,
+                                          const float *restrict right_0_column, const float *restrict right_1_column);
+typedef void (*sl_simd_f_dot_product3_fn)(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column,
+                                          const float *restrict left_0_column, const float *restrict left_1_column, const float *restrict left_2_column,
+                                          const float *restrict right_0_column, const float *restrict right_1_column, const float *restrict right_2_column);
+typedef void (*sl_simd_f_dot_product4_fn)(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column,
+                                          const float *restrict left_0_column, const float *restrict left_1_column, const float *restrict left_2_column, const float *restrict left_3_column,
+                                          const float *restrict right_0_column, const float *restrict right_1_column, const float *restrict right_2_column, const float *restrict right_3_column);
+
+/* Matrix product, see sl_exec_f_matrix_product() */
+typedef void (*sl_simd_f_matrix_product_fn)(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, int num_rows, int inner, int num_cols,
+                                            float * const *result_columns, const float * const *left_columns, const float *left_scalars,
+                                            const float * const *right_columns, const float *right_scalars);
+
+/* Masked variants; mask holds SL_EXEC_CHAIN_MAX_NUM_ROWS bits, one for each row to compute. Rows outside the mask
+ * may be computed but are never stored. */
+typedef void (*sl_simd_f_unop_masked_fn)(const uint64_t *restrict mask, float *restrict result_column, const float *restrict opd_column);
+typedef void (*sl_simd_f_binop_masked_fn)(const uint64_t *restrict mask, float *restrict result_column, const float *restrict left_column, const float *restrict right_column);
+typedef void (*sl_simd_f_dot_product2_masked_fn)(const uint64_t *restrict mask, float *restrict result_column,
+                                                 const float *restrict left_0_column, const float *restrict left_1_column,
+                                                 const float *restrict right_0_column, const float *restrict right_1_column);
+typedef void (*sl_simd_f_dot_product3_masked_fn)(const uint64_t *restrict mask, float *restrict result_column,
+                                                 const float *restrict left_0_column, const float *restrict left_1_column, const float *restrict left_2_column,
+                                                 const float *restrict right_0_column, const float *restrict right_1_column, const float *restrict right_2_column);
+typedef void (*sl_simd_f_dot_product4_masked_fn)(const uint64_t *restrict mask, float *restrict result_column,
+                                                 const float *restrict left_0_column, const float *restrict left_1_column, const float *restrict left_2_column, const float *restrict left_3_column,
+                                                 const float *restrict right_0_column, const float *restrict right_1_column, const float *restrict right_2_column, const float *restrict right_3_column);
+typedef void (*sl_simd_f_matrix_product_masked_fn)(const uint64_t *restrict mask, int num_rows, int inner, int num_cols,
+                                                   float * const *result_columns, const float * const *left_columns, const float *left_scalars,
+                                                   const float * const *right_columns, const float *right_scalars);
+
+/* Texel blends for the 8 lanes sampled at once by texture2D_8() in sampler_2d.c. Texels hold up to 4 byte
+ * components, the first in the least significant byte, channels are [4][8] with the blend of component ch of
+ * lane n in channels[8 * ch + n]. */
+typedef void (*sl_simd_texel_bilinear_fn)(int num_components, const uint32_t *restrict texels, const uint32_t *restrict weights, uint32_t *restrict channels);
+typedef void (*sl_simd_texel_lerp_fn)(int num_components, uint32_t *restrict channels, const uint32_t *restrict weights,
+                                      const uint32_t *restrict other_channels, const uint32_t *restrict other_weights);
+
+/* Kernels for the selected level; a NULL entry means the generic implementation in the snippet is used. */
+struct sl_simd_kernels {
+  sl_simd_level_t level_;
+
+  sl_simd_f_binop_fn f_add_;
+  sl_simd_f_binop_fn f_sub_;
+  sl_simd_f_binop_fn f_mul_;
+  sl_simd_f_binop_fn f_div_;
+
+  sl_simd_f_unop_fn f_negate_;
+  sl_simd_f_unop_fn f_increment_;
+  sl_simd_f_unop_fn f_decrement_;
+
+  sl_simd_f_dot_product2_fn f_dot_product2_;
+  sl_simd_f_dot_product3_fn f_dot_product3_;
+  sl_simd_f_dot_product4_fn f_dot_product4_;
+
+  /* mat * vec, vec * mat and mat * mat, every operand column loaded once per group of rows */
+  sl_simd_f_matrix_product_fn f_matrix_product_;
+
+  /* clamp(x, minval, maxval) and mix(x, y, a), see aex_clampf() and aex_mixf() */
+  sl_simd_f_ternop_fn f_clamp_;
+  sl_simd_f_ternop_fn f_mix_;
+
+  /* inversesqrt(x), exactly 1.f / sqrtf(x) */
+  sl_simd_f_unop_fn f_inversesqrt_;
+
+  /* Approximations of sinf(), cosf(), expf(), exp2f(), logf(), log2f() and powf(). GLSL ES 1.00 sets no
+   * precision for them, these meet the bounds tester/ulptest1.c checks: sin and cos to an absolute error of
+   * 2^-11 in [-pi, pi], exp and exp2 to 3 + 2 |x| ULP, log and log2 to 3 ULP, or an absolute error of 2^-21
+   * in [0.5, 2], and pow as exp2(y * log2(x)). Only for SLEA_SPEC accuracy. */
+  sl_simd_f_unop_fn f_sin_;
+  sl_simd_f_unop_fn f_cos_;
+  sl_simd_f_unop_fn f_exp_;
+  sl_simd_f_unop_fn f_exp2_;
+  sl_simd_f_unop_fn f_log_;
+  sl_simd_f_unop_fn f_log2_;
+  sl_simd_f_binop_fn f_pow_;
+
+  sl_simd_f_binop_masked_fn f_add_masked_;
+  sl_simd_f_binop_masked_fn f_sub_masked_;
+  sl_simd_f_binop_masked_fn f_mul_masked_;
+  sl_simd_f_binop_masked_fn f_div_masked_;
+
+  sl_simd_f_unop_masked_fn f_negate_masked_;
+  sl_simd_f_unop_masked_fn f_increment_masked_;
+  sl_simd_f_unop_masked_fn f_decrement_masked_;
+
+  sl_simd_f_dot_product2_masked_fn f_dot_product2_masked_;
+  sl_simd_f_dot_product3_masked_fn f_dot_product3_masked_;
+  sl_simd_f_dot_product4_masked_fn f_dot_product4_masked_;
+
+  sl_simd_f_matrix_product_masked_fn f_matrix_product_masked_;
+
+  /* Bilinear: texels and weights are [4][8], the 4 texels around each lane and their weights; channels[ch][n]
+   * becomes the sum over k of byte ch of texels[k][n] times weights[k][n]. */
+  sl_simd_texel_bilinear_fn texel_bilinear_;
+  /* Lerp between mipmaps: channels[ch][n] becomes channels[ch][n] * weights[n] + other_channels[ch][n] * other_weights[n].
+   * Both wrap around at 32 bits, the caller keeps the sums in range. */
+  sl_simd_texel_lerp_fn texel_lerp_;
+};
+
+/* The currently selected kernels, referenced by the snippets' call sites. */
+extern struct sl_simd_kernels g_sl_simd_;
+
+/* Returns the best level supported by the host. */
+sl_simd_level_t sl_simd_detect(void);
+
+/* Selects the kernels for level, clamped to what the host supports; returns the level actually selected.
+ * Not synchronized with running shaders, call it while no shaders execute. */
+sl_simd_level_t sl_simd_select(sl_simd_level_t level);
+
+/* Selects the level upon first call, the detected level lowered by AEX_SL_SIMD, if set;
+ * subsequent calls do nothing. Called upon context creation. */
+void sl_simd_init(void);
+
+/* Returns the level of the currently selected kernels */
+sl_simd_level_t sl_simd_level(void);
+
+/* Returns a printable name for the level ("generic", "sse4.1", "avx2" or "avx512") */
+const char *sl_simd_level_name(sl_simd_level_t level);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* SL_SIMD_H */
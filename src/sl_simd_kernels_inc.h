@@ -0,0 +1,625 @@
+/* Copyright 2024 Kinglet B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* file is intended to be included by sl_simd.c once for each instruction set level, not compiled
+ * on its own
+ * Prior to including the file, you should define:
+ * #define SL_SIMD_KERNELS_SUFFIX <<suffix appended to the kernel names>>
+ * #define SL_SIMD_KERNELS_WIDTH <<widest vector in floats; 4, 8 or 16>>
+ * #define SL_SIMD_KERNELS_TARGET <<function attribute enabling the instruction set, if needed>>
+ *
+ * For instance:
+ * #define SL_SIMD_KERNELS_SUFFIX avx2
+ * #define SL_SIMD_KERNELS_WIDTH 8
+ * #define SL_SIMD_KERNELS_TARGET SL_SIMD_TARGET("avx2")
+ *
+ * The operators are written once in terms of the V<n>_xxx vector macros from sl_simd.c, with <n> being the
+ * width, and expanded for each width (1, being scalar, 4, 8 and 16) by the chain walk below, and for
+ * SL_SIMD_KERNELS_WIDTH by the masked walk.
+ */
+
+#if SL_SIMD_KERNELS_WIDTH >= 16
+/* 16 contiguous rows, aligned to 16 */
+#define SL_SIMD_KERNELS_WALK16(val) \
+    if (!(row & 15) && SL_EXEC_CHAIN_RUN_OF_16(chain_column, row)) { \
+      V16_ST(result_column + row, val(16, row)); \
+      delta = chain_column[row + 15]; \
+      if (!delta) break; \
+      row += 15 + delta; \
+      continue; \
+    }
+#else
+#define SL_SIMD_KERNELS_WALK16(val)
+#endif
+
+#if SL_SIMD_KERNELS_WIDTH >= 8
+#define SL_SIMD_KERNELS_ST8(val, r) V8_ST(result_column + (r), val(8, r))
+#else
+#define SL_SIMD_KERNELS_ST8(val, r) V4_ST(result_column + (r), val(4, r)); V4_ST(result_column + (r) + 4, val(4, (r) + 4))
+#endif
+
+/* Same walk as the snippets: the widest run of contiguous rows the alignment of row allows, down to
+ * a single row. val(w, r) is the value of w rows starting at row r. */
+#define SL_SIMD_KERNELS_WALK(val) \
+  for (;;) { \
+    sl_exec_row_t delta; \
+    SL_SIMD_KERNELS_WALK16(val) \
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) { \
+      SL_SIMD_KERNELS_ST8(val, row); \
+      delta = chain_column[row + 7]; \
+      if (!delta) break; \
+      row += 7 + delta; \
+    } \
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) { \
+      V4_ST(result_column + row, val(4, row)); \
+      delta = chain_column[row + 3]; \
+      if (!delta) break; \
+      row += 3 + delta; \
+    } \
+    else { \
+      V1_ST(result_column + row, val(1, row)); \
+      delta = chain_column[row]; \
+      if (!delta) break; \
+      row += delta; \
+    } \
+  }
+
+/* Masked walk: every block of SL_SIMD_KERNELS_WIDTH rows with any row in the mask is computed in full,
+ * and stored under the mask. */
+#if SL_SIMD_KERNELS_WIDTH >= 16
+#define SL_SIMD_KERNELS_MASKED_STEP(val, r, bits) \
+    if (bits == 0xFFFF) V16_ST(result_column + (r), val(16, r)); \
+    else V16_MST(result_column + (r), bits, val(16, r))
+#elif SL_SIMD_KERNELS_WIDTH >= 8
+#define SL_SIMD_KERNELS_MASKED_STEP(val, r, bits) \
+    if (bits == 0xFF) V8_ST(result_column + (r), val(8, r)); \
+    else V8_MST(result_column + (r), bits, val(8, r))
+#else
+#define SL_SIMD_KERNELS_MASKED_STEP(val, r, bits) \
+    if (bits == 0xF) V4_ST(result_column + (r), val(4, r)); \
+    else V4_MST(result_column + (r), bits, val(4, r))
+#endif
+
+#define SL_SIMD_KERNELS_WALK_MASKED(val) \
+  int row; \
+  for (row = 0; row < SL_EXEC_CHAIN_MAX_NUM_ROWS; row += SL_SIMD_KERNELS_WIDTH) { \
+    unsigned int bits = (unsigned int)(mask[row >> 6] >> (row & 63)) & ((1u << SL_SIMD_KERNELS_WIDTH) - 1); \
+    if (!bits) continue; \
+    SL_SIMD_KERNELS_MASKED_STEP(val, row, bits); \
+  }
+
+#define SL_SIMD_KERNELS_NAME_2(name, suffix) sl_simd_##name##_##suffix
+#define SL_SIMD_KERNELS_NAME_1(name, suffix) SL_SIMD_KERNELS_NAME_2(name, suffix)
+#define SL_SIMD_KERNELS_NAME(name) SL_SIMD_KERNELS_NAME_1(name, SL_SIMD_KERNELS_SUFFIX)
+
+#define SL_SIMD_KERNELS_BINOP(name, val) \
+static SL_SIMD_KERNELS_TARGET void SL_SIMD_KERNELS_NAME(name)(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, \
+                                                              const float *restrict left_column, const float *restrict right_column) { \
+  SL_SIMD_KERNELS_WALK(val) \
+} \
+static SL_SIMD_KERNELS_TARGET void SL_SIMD_KERNELS_NAME(name##_masked)(const uint64_t *restrict mask, float *restrict result_column, \
+                                                                       const float *restrict left_column, const float *restrict right_column) { \
+  SL_SIMD_KERNELS_WALK_MASKED(val) \
+}
+
+#define SL_SIMD_KERNELS_UNOP(name, val) \
+static SL_SIMD_KERNELS_TARGET void SL_SIMD_KERNELS_NAME(name)(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, \
+                                                              const float *restrict opd_column) { \
+  SL_SIMD_KERNELS_WALK(val) \
+} \
+static SL_SIMD_KERNELS_TARGET void SL_SIMD_KERNELS_NAME(name##_masked)(const uint64_t *restrict mask, float *restrict result_column, \
+                                                                       const float *restrict opd_column) { \
+  SL_SIMD_KERNELS_WALK_MASKED(val) \
+}
+
+#define SL_SIMD_KERNELS_TERNOP(name, val) \
+static SL_SIMD_KERNELS_TARGET void SL_SIMD_KERNELS_NAME(name)(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, \
+                                                              const float *restrict first_column, const float *restrict second_column, \
+                                                              const float *restrict third_column) { \
+  SL_SIMD_KERNELS_WALK(val) \
+}
+
+/* Kernels for the builtin functions, which always run over the execution chain, so without masked variants */
+#define SL_SIMD_KERNELS_BUILTIN_UNOP(name, val) \
+static SL_SIMD_KERNELS_TARGET void SL_SIMD_KERNELS_NAME(name)(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, \
+                                                              const float *restrict opd_column) { \
+  SL_SIMD_KERNELS_WALK(val) \
+}
+
+#define SL_SIMD_KERNELS_BUILTIN_BINOP(name, val) \
+static SL_SIMD_KERNELS_TARGET void SL_SIMD_KERNELS_NAME(name)(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, \
+                                                              const float *restrict left_column, const float *restrict right_column) { \
+  SL_SIMD_KERNELS_WALK(val) \
+}
+
+#define SL_SIMD_KERNELS_LD(w, col, r) V##w##_LD((col) + (r))
+
+#define SL_SIMD_KERNELS_ADD_VAL(w, r) V##w##_ADD(SL_SIMD_KERNELS_LD(w, left_column, r), SL_SIMD_KERNELS_LD(w, right_column, r))
+#define SL_SIMD_KERNELS_SUB_VAL(w, r) V##w##_SUB(SL_SIMD_KERNELS_LD(w, left_column, r), SL_SIMD_KERNELS_LD(w, right_column, r))
+#define SL_SIMD_KERNELS_MUL_VAL(w, r) V##w##_MUL(SL_SIMD_KERNELS_LD(w, left_column, r), SL_SIMD_KERNELS_LD(w, right_column, r))
+#define SL_SIMD_KERNELS_DIV_VAL(w, r) V##w##_DIV(SL_SIMD_KERNELS_LD(w, left_column, r), SL_SIMD_KERNELS_LD(w, right_column, r))
+
+#define SL_SIMD_KERNELS_NEGATE_VAL(w, r) V##w##_NEG(SL_SIMD_KERNELS_LD(w, opd_column, r))
+#define SL_SIMD_KERNELS_INCREMENT_VAL(w, r) V##w##_ADD(SL_SIMD_KERNELS_LD(w, opd_column, r), V##w##_SET1(1.f))
+#define SL_SIMD_KERNELS_DECREMENT_VAL(w, r) V##w##_SUB(SL_SIMD_KERNELS_LD(w, opd_column, r), V##w##_SET1(1.f))
+
+/* aex_clampf(x, minval, maxval) is fminf(fmaxf(x, minval), maxval); V_MAX and V_MIN return their second operand
+ * if either is NaN, so a NaN x clamps to minval as it does there, at every width. */
+#define SL_SIMD_KERNELS_CLAMP_VAL(w, r) \
+  V##w##_MIN(V##w##_MAX(SL_SIMD_KERNELS_LD(w, first_column, r), SL_SIMD_KERNELS_LD(w, second_column, r)), SL_SIMD_KERNELS_LD(w, third_column, r))
+
+/* aex_mixf(x, y, a) is x * (1.f - a) + y * a */
+#define SL_SIMD_KERNELS_MIX_VAL(w, r) \
+  V##w##_ADD(V##w##_MUL(SL_SIMD_KERNELS_LD(w, first_column, r), V##w##_SUB(V##w##_SET1(1.f), SL_SIMD_KERNELS_LD(w, third_column, r))), \
+             V##w##_MUL(SL_SIMD_KERNELS_LD(w, second_column, r), SL_SIMD_KERNELS_LD(w, third_column, r)))
+
+/* Sums are evaluated left to right, as in the generic kernels, so results are identical */
+#define SL_SIMD_KERNELS_DOT2_VAL(w, r) \
+  V##w##_ADD(V##w##_MUL(SL_SIMD_KERNELS_LD(w, left_0_column, r), SL_SIMD_KERNELS_LD(w, right_0_column, r)), \
+             V##w##_MUL(SL_SIMD_KERNELS_LD(w, left_1_column, r), SL_SIMD_KERNELS_LD(w, right_1_column, r)))
+
+#define SL_SIMD_KERNELS_DOT3_VAL(w, r) \
+  V##w##_ADD(V##w##_ADD(V##w##_MUL(SL_SIMD_KERNELS_LD(w, left_0_column, r), SL_SIMD_KERNELS_LD(w, right_0_column, r)), \
+                        V##w##_MUL(SL_SIMD_KERNELS_LD(w, left_1_column, r), SL_SIMD_KERNELS_LD(w, right_1_column, r))), \
+             V##w##_MUL(SL_SIMD_KERNELS_LD(w, left_2_column, r), SL_SIMD_KERNELS_LD(w, right_2_column, r)))
+
+#define SL_SIMD_KERNELS_DOT4_VAL(w, r) \
+  V##w##_ADD(V##w##_ADD(V##w##_ADD(V##w##_MUL(SL_SIMD_KERNELS_LD(w, left_0_column, r), SL_SIMD_KERNELS_LD(w, right_0_column, r)), \
+                                   V##w##_MUL(SL_SIMD_KERNELS_LD(w, left_1_column, r), SL_SIMD_KERNELS_LD(w, right_1_column, r))), \
+                        V##w##_MUL(SL_SIMD_KERNELS_LD(w, left_2_column, r), SL_SIMD_KERNELS_LD(w, right_2_column, r))), \
+             V##w##_MUL(SL_SIMD_KERNELS_LD(w, left_3_column, r), SL_SIMD_KERNELS_LD(w, right_3_column, r)))
+
+/* Polynomial approximations of the transcendental functions, for the SLEA_SPEC accuracy mode. Each is
+ * expanded for every width into a function sl_simd_<fn>_<width>_<suffix>(). The range reductions and
+ * polynomials are those of Cephes' single precision functions; all operations are plain IEEE adds,
+ * multiplies and compares so each width (and each level) produces the same bits.
+ *
+ * sl_simd_ldexp_<w>(p, n) is p * 2^n for integral n in [-151, 129], n is split in two halves so both
+ * scale factors are normal floats and results gradually underflow to denormals, or overflow to infinity. */
+#define SL_SIMD_KERNELS_MATH(w) \
+static SL_SIMD_KERNELS_TARGET V##w##_F SL_SIMD_KERNELS_NAME(ldexp_##w)(V##w##_F p, V##w##_F n) { \
+  V##w##_I ni = V##w##_CVTI(n); \
+  V##w##_I n1 = V##w##_I_SRAI(ni, 1); \
+  V##w##_I n2 = V##w##_I_SUB(ni, n1); \
+  p = V##w##_MUL(p, V##w##_AS_F(V##w##_I_SLLI(V##w##_I_ADD(n1, V##w##_I_SET1(127)), 23))); \
+  return V##w##_MUL(p, V##w##_AS_F(V##w##_I_SLLI(V##w##_I_ADD(n2, V##w##_I_SET1(127)), 23))); \
+} \
+\
+/* 2^x = 2^n * 2^f with n = round(x) and f in [-0.5, 0.5] */ \
+static SL_SIMD_KERNELS_TARGET V##w##_F SL_SIMD_KERNELS_NAME(exp2_##w)(V##w##_F x) { \
+  V##w##_F xc = V##w##_MAX(V##w##_MIN(x, V##w##_SET1(129.f)), V##w##_SET1(-151.f)); \
+  V##w##_F n = V##w##_ROUND(xc); \
+  V##w##_F f = V##w##_SUB(xc, n); \
+  V##w##_F p = V##w##_SET1(1.535336188319500e-4f); \
+  p = V##w##_ADD(V##w##_MUL(p, f), V##w##_SET1(1.339887440266574e-3f)); \
+  p = V##w##_ADD(V##w##_MUL(p, f), V##w##_SET1(9.618437357674640e-3f)); \
+  p = V##w##_ADD(V##w##_MUL(p, f), V##w##_SET1(5.550332471162809e-2f)); \
+  p = V##w##_ADD(V##w##_MUL(p, f), V##w##_SET1(2.402264791363012e-1f)); \
+  p = V##w##_ADD(V##w##_MUL(p, f), V##w##_SET1(6.931472028550421e-1f)); \
+  p = V##w##_ADD(V##w##_MUL(p, f), V##w##_SET1(1.f)); \
+  p = SL_SIMD_KERNELS_NAME(ldexp_##w)(p, n); \
+  return V##w##_SEL(V##w##_ISNAN(x), x, p); \
+} \
+\
+/* e^x = 2^n * e^r with n = round(x / ln 2) and r = x - n ln 2, ln 2 split in two so n ln 2 is exact */ \
+static SL_SIMD_KERNELS_TARGET V##w##_F SL_SIMD_KERNELS_NAME(exp_##w)(V##w##_F x) { \
+  V##w##_F xc = V##w##_MAX(V##w##_MIN(x, V##w##_SET1(89.f)), V##w##_SET1(-105.f)); \
+  V##w##_F n = V##w##_ROUND(V##w##_MUL(xc, V##w##_SET1(1.44269504088896341f))); \
+  V##w##_F r = V##w##_SUB(V##w##_SUB(xc, V##w##_MUL(n, V##w##_SET1(0.693359375f))), V##w##_MUL(n, V##w##_SET1(-2.12194440e-4f))); \
+  V##w##_F p = V##w##_SET1(1.9875691500e-4f); \
+  p = V##w##_ADD(V##w##_MUL(p, r), V##w##_SET1(1.3981999507e-3f)); \
+  p = V##w##_ADD(V##w##_MUL(p, r), V##w##_SET1(8.3334519073e-3f)); \
+  p = V##w##_ADD(V##w##_MUL(p, r), V##w##_SET1(4.1665795894e-2f)); \
+  p = V##w##_ADD(V##w##_MUL(p, r), V##w##_SET1(1.6666665459e-1f)); \
+  p = V##w##_ADD(V##w##_MUL(p, r), V##w##_SET1(5.0000001201e-1f)); \
+  p = V##w##_ADD(V##w##_ADD(V##w##_MUL(V##w##_MUL(p, r), r), r), V##w##_SET1(1.f)); \
+  p = SL_SIMD_KERNELS_NAME(ldexp_##w)(p, n); \
+  return V##w##_SEL(V##w##_ISNAN(x), x, p); \
+} \
+\
+/* x = m * 2^e with m in [sqrt(0.5), sqrt(2)]; sets *pz to m - 1, *py to ln(m) - (m - 1) and *pe to e. \
+ * Denormals are scaled up first; zero, negative, infinite and NaN x are left to the caller. */ \
+static SL_SIMD_KERNELS_TARGET void SL_SIMD_KERNELS_NAME(log_reduce_##w)(V##w##_F x, V##w##_F *pz, V##w##_F *py, V##w##_F *pe) { \
+  V##w##_M denormal = V##w##_CMPLT(x, V##w##_SET1(1.17549435e-38f)); \
+  V##w##_F xs = V##w##_SEL(denormal, V##w##_MUL(x, V##w##_SET1(8388608.f)), x); \
+  V##w##_I bits = V##w##_AS_I(xs); \
+  V##w##_F e = V##w##_CVTF(V##w##_I_SUB(V##w##_I_SRLI(bits, 23), V##w##_I_SET1(127))); \
+  V##w##_F m = V##w##_AS_F(V##w##_I_OR(V##w##_I_AND(bits, V##w##_I_SET1(0x007FFFFF)), V##w##_I_SET1(0x3F800000))); \
+  V##w##_M above = V##w##_CMPLT(V##w##_SET1(1.41421356f), m); \
+  V##w##_F z, zz, y; \
+  e = V##w##_SUB(e, V##w##_SEL(denormal, V##w##_SET1(23.f), V##w##_SET1(0.f))); \
+  m = V##w##_SEL(above, V##w##_MUL(m, V##w##_SET1(0.5f)), m); \
+  e = V##w##_SEL(above, V##w##_ADD(e, V##w##_SET1(1.f)), e); \
+  z = V##w##_SUB(m, V##w##_SET1(1.f)); \
+  zz = V##w##_MUL(z, z); \
+  y = V##w##_SET1(7.0376836292e-2f); \
+  y = V##w##_ADD(V##w##_MUL(y, z), V##w##_SET1(-1.1514610310e-1f)); \
+  y = V##w##_ADD(V##w##_MUL(y, z), V##w##_SET1(1.1676998740e-1f)); \
+  y = V##w##_ADD(V##w##_MUL(y, z), V##w##_SET1(-1.2420140846e-1f)); \
+  y = V##w##_ADD(V##w##_MUL(y, z), V##w##_SET1(1.4249322787e-1f)); \
+  y = V##w##_ADD(V##w##_MUL(y, z), V##w##_SET1(-1.6668057665e-1f)); \
+  y = V##w##_ADD(V##w##_MUL(y, z), V##w##_SET1(2.0000714765e-1f)); \
+  y = V##w##_ADD(V##w##_MUL(y, z), V##w##_SET1(-2.4999993993e-1f)); \
+  y = V##w##_ADD(V##w##_MUL(y, z), V##w##_SET1(3.3333331174e-1f)); \
+  y = V##w##_MUL(V##w##_MUL(y, z), zz); \
+  y = V##w##_SUB(y, V##w##_MUL(zz, V##w##_SET1(0.5f))); \
+  *pz = z; \
+  *py = y; \
+  *pe = e; \
+} \
+\
+/* log(0) is -inf, log(+inf) is +inf and log of a negative number NaN, as in libm */ \
+static SL_SIMD_KERNELS_TARGET V##w##_F SL_SIMD_KERNELS_NAME(log_special_##w)(V##w##_F x, V##w##_F v) { \
+  v = V##w##_SEL(V##w##_CMPEQ(x, V##w##_SET1(INFINITY)), x, v); \
+  v = V##w##_SEL(V##w##_CMPEQ(x, V##w##_SET1(0.f)), V##w##_SET1(-INFINITY), v); \
+  v = V##w##_SEL(V##w##_CMPLT(x, V##w##_SET1(0.f)), V##w##_SET1(NAN), v); \
+  return V##w##_SEL(V##w##_ISNAN(x), x, v); \
+} \
+\
+/* ln(x) = ln(m) + e ln 2, ln 2 split in two */ \
+static SL_SIMD_KERNELS_TARGET V##w##_F SL_SIMD_KERNELS_NAME(log_##w)(V##w##_F x) { \
+  V##w##_F z, y, e, v; \
+  SL_SIMD_KERNELS_NAME(log_reduce_##w)(x, &z, &y, &e); \
+  v = V##w##_ADD(y, V##w##_MUL(e, V##w##_SET1(-2.12194440e-4f))); \
+  v = V##w##_ADD(V##w##_ADD(z, v), V##w##_MUL(e, V##w##_SET1(0.693359375f))); \
+  return SL_SIMD_KERNELS_NAME(log_special_##w)(x, v); \
+} \
+\
+/* log2(x) = ln(m) log2(e) + e, with log2(e) - 1 applied separately to keep the precision near x = 1 */ \
+static SL_SIMD_KERNELS_TARGET V##w##_F SL_SIMD_KERNELS_NAME(log2_##w)(V##w##_F x) { \
+  V##w##_F z, y, e, v; \
+  SL_SIMD_KERNELS_NAME(log_reduce_##w)(x, &z, &y, &e); \
+  v = V##w##_MUL(y, V##w##_SET1(0.44269504088896340736f)); \
+  v = V##w##_ADD(v, V##w##_MUL(z, V##w##_SET1(0.44269504088896340736f))); \
+  v = V##w##_ADD(V##w##_ADD(V##w##_ADD(v, y), z), e); \
+  return SL_SIMD_KERNELS_NAME(log_special_##w)(x, v); \
+} \
+\
+/* pow(x, y) = 2^(y log2(x)), which is how GLSL defines it (and its precision) */ \
+static SL_SIMD_KERNELS_TARGET V##w##_F SL_SIMD_KERNELS_NAME(pow_##w)(V##w##_F x, V##w##_F y) { \
+  return SL_SIMD_KERNELS_NAME(exp2_##w)(V##w##_MUL(y, SL_SIMD_KERNELS_NAME(log2_##w)(x))); \
+} \
+\
+/* sin(x + q pi / 2) for r = x - n pi / 2 in [-pi/4, pi/4], pi / 2 split in three so n pi / 2 is exact for \
+ * |n| below 2^16; quadrant q picks the sine or cosine polynomial of r, and the sign. */ \
+static SL_SIMD_KERNELS_TARGET V##w##_F SL_SIMD_KERNELS_NAME(sin_quadrant_##w)(V##w##_F x, int q) { \
+  V##w##_F n = V##w##_ROUND(V##w##_MUL(x, V##w##_SET1(0.636619772367581343f))); \
+  V##w##_F r = V##w##_SUB(x, V##w##_MUL(n, V##w##_SET1(1.5703125f))); \
+  V##w##_F zz, s, c; \
+  V##w##_I quadrant = V##w##_I_ADD(V##w##_CVTI(n), V##w##_I_SET1(q)); \
+  r = V##w##_SUB(r, V##w##_MUL(n, V##w##_SET1(4.837512969970703125e-4f))); \
+  r = V##w##_SUB(r, V##w##_MUL(n, V##w##_SET1(7.54978995489188216e-8f))); \
+  zz = V##w##_MUL(r, r); \
+  s = V##w##_SET1(-1.9515295891e-4f); \
+  s = V##w##_ADD(V##w##_MUL(s, zz), V##w##_SET1(8.3321608736e-3f)); \
+  s = V##w##_ADD(V##w##_MUL(s, zz), V##w##_SET1(-1.6666654611e-1f)); \
+  s = V##w##_ADD(V##w##_MUL(V##w##_MUL(s, zz), r), r); \
+  c = V##w##_SET1(2.443315711809948e-5f); \
+  c = V##w##_ADD(V##w##_MUL(c, zz), V##w##_SET1(-1.388731625493765e-3f)); \
+  c = V##w##_ADD(V##w##_MUL(c, zz), V##w##_SET1(4.166664568298827e-2f)); \
+  c = V##w##_MUL(V##w##_MUL(c, zz), zz); \
+  c = V##w##_ADD(V##w##_SUB(c, V##w##_MUL(zz, V##w##_SET1(0.5f))), V##w##_SET1(1.f)); \
+  s = V##w##_SEL(V##w##_I_TESTBIT(quadrant, 1), c, s); \
+  return V##w##_XOR(s, V##w##_AS_F(V##w##_I_SLLI(V##w##_I_AND(quadrant, V##w##_I_SET1(2)), 30))); \
+}
+
+SL_SIMD_KERNELS_MATH(1)
+SL_SIMD_KERNELS_MATH(4)
+#if SL_SIMD_KERNELS_WIDTH >= 8
+SL_SIMD_KERNELS_MATH(8)
+#endif
+#if SL_SIMD_KERNELS_WIDTH >= 16
+SL_SIMD_KERNELS_MATH(16)
+#endif
+
+/* inversesqrt(x) is 1.f / sqrtf(x); both are correctly rounded, so this matches libm exactly */
+#define SL_SIMD_KERNELS_INVERSESQRT_VAL(w, r) V##w##_DIV(V##w##_SET1(1.f), V##w##_SQRT(SL_SIMD_KERNELS_LD(w, opd_column, r)))
+
+#define SL_SIMD_KERNELS_SIN_VAL(w, r) SL_SIMD_KERNELS_NAME(sin_quadrant_##w)(SL_SIMD_KERNELS_LD(w, opd_column, r), 0)
+#define SL_SIMD_KERNELS_COS_VAL(w, r) SL_SIMD_KERNELS_NAME(sin_quadrant_##w)(SL_SIMD_KERNELS_LD(w, opd_column, r), 1)
+#define SL_SIMD_KERNELS_EXP_VAL(w, r) SL_SIMD_KERNELS_NAME(exp_##w)(SL_SIMD_KERNELS_LD(w, opd_column, r))
+#define SL_SIMD_KERNELS_EXP2_VAL(w, r) SL_SIMD_KERNELS_NAME(exp2_##w)(SL_SIMD_KERNELS_LD(w, opd_column, r))
+#define SL_SIMD_KERNELS_LOG_VAL(w, r) SL_SIMD_KERNELS_NAME(log_##w)(SL_SIMD_KERNELS_LD(w, opd_column, r))
+#define SL_SIMD_KERNELS_LOG2_VAL(w, r) SL_SIMD_KERNELS_NAME(log2_##w)(SL_SIMD_KERNELS_LD(w, opd_column, r))
+#define SL_SIMD_KERNELS_POW_VAL(w, r) SL_SIMD_KERNELS_NAME(pow_##w)(SL_SIMD_KERNELS_LD(w, left_column, r), SL_SIMD_KERNELS_LD(w, right_column, r))
+
+SL_SIMD_KERNELS_BINOP(f_add, SL_SIMD_KERNELS_ADD_VAL)
+SL_SIMD_KERNELS_BINOP(f_sub, SL_SIMD_KERNELS_SUB_VAL)
+SL_SIMD_KERNELS_BINOP(f_mul, SL_SIMD_KERNELS_MUL_VAL)
+SL_SIMD_KERNELS_BINOP(f_div, SL_SIMD_KERNELS_DIV_VAL)
+
+SL_SIMD_KERNELS_UNOP(f_negate, SL_SIMD_KERNELS_NEGATE_VAL)
+SL_SIMD_KERNELS_UNOP(f_increment, SL_SIMD_KERNELS_INCREMENT_VAL)
+SL_SIMD_KERNELS_UNOP(f_decrement, SL_SIMD_KERNELS_DECREMENT_VAL)
+
+SL_SIMD_KERNELS_TERNOP(f_clamp, SL_SIMD_KERNELS_CLAMP_VAL)
+SL_SIMD_KERNELS_TERNOP(f_mix, SL_SIMD_KERNELS_MIX_VAL)
+
+SL_SIMD_KERNELS_BUILTIN_UNOP(f_inversesqrt, SL_SIMD_KERNELS_INVERSESQRT_VAL)
+SL_SIMD_KERNELS_BUILTIN_UNOP(f_sin, SL_SIMD_KERNELS_SIN_VAL)
+SL_SIMD_KERNELS_BUILTIN_UNOP(f_cos, SL_SIMD_KERNELS_COS_VAL)
+SL_SIMD_KERNELS_BUILTIN_UNOP(f_exp, SL_SIMD_KERNELS_EXP_VAL)
+SL_SIMD_KERNELS_BUILTIN_UNOP(f_exp2, SL_SIMD_KERNELS_EXP2_VAL)
+SL_SIMD_KERNELS_BUILTIN_UNOP(f_log, SL_SIMD_KERNELS_LOG_VAL)
+SL_SIMD_KERNELS_BUILTIN_UNOP(f_log2, SL_SIMD_KERNELS_LOG2_VAL)
+SL_SIMD_KERNELS_BUILTIN_BINOP(f_pow, SL_SIMD_KERNELS_POW_VAL)
+
+#define SL_SIMD_KERNELS_DOT2_PARAMS \
+  const float *restrict left_0_column, const float *restrict left_1_column, \
+  const float *restrict right_0_column, const float *restrict right_1_column
+#define SL_SIMD_KERNELS_DOT3_PARAMS \
+  const float *restrict left_0_column, const float *restrict left_1_column, const float *restrict left_2_column, \
+  const float *restrict right_0_column, const float *restrict right_1_column, const float *restrict right_2_column
+#define SL_SIMD_KERNELS_DOT4_PARAMS \
+  const float *restrict left_0_column, const float *restrict left_1_column, const float *restrict left_2_column, const float *restrict left_3_column, \
+  const float *restrict right_0_column, const float *restrict right_1_column, const float *restrict right_2_column, const float *restrict right_3_column
+
+static SL_SIMD_KERNELS_TARGET void SL_SIMD_KERNELS_NAME(f_dot_product2)(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, SL_SIMD_KERNELS_DOT2_PARAMS) {
+  SL_SIMD_KERNELS_WALK(SL_SIMD_KERNELS_DOT2_VAL)
+}
+
+static SL_SIMD_KERNELS_TARGET void SL_SIMD_KERNELS_NAME(f_dot_product3)(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, SL_SIMD_KERNELS_DOT3_PARAMS) {
+  SL_SIMD_KERNELS_WALK(SL_SIMD_KERNELS_DOT3_VAL)
+}
+
+static SL_SIMD_KERNELS_TARGET void SL_SIMD_KERNELS_NAME(f_dot_product4)(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, float *restrict result_column, SL_SIMD_KERNELS_DOT4_PARAMS) {
+  SL_SIMD_KERNELS_WALK(SL_SIMD_KERNELS_DOT4_VAL)
+}
+
+static SL_SIMD_KERNELS_TARGET void SL_SIMD_KERNELS_NAME(f_dot_product2_masked)(const uint64_t *restrict mask, float *restrict result_column, SL_SIMD_KERNELS_DOT2_PARAMS) {
+  SL_SIMD_KERNELS_WALK_MASKED(SL_SIMD_KERNELS_DOT2_VAL)
+}
+
+static SL_SIMD_KERNELS_TARGET void SL_SIMD_KERNELS_NAME(f_dot_product3_masked)(const uint64_t *restrict mask, float *restrict result_column, SL_SIMD_KERNELS_DOT3_PARAMS) {
+  SL_SIMD_KERNELS_WALK_MASKED(SL_SIMD_KERNELS_DOT3_VAL)
+}
+
+static SL_SIMD_KERNELS_TARGET void SL_SIMD_KERNELS_NAME(f_dot_product4_masked)(const uint64_t *restrict mask, float *restrict result_column, SL_SIMD_KERNELS_DOT4_PARAMS) {
+  SL_SIMD_KERNELS_WALK_MASKED(SL_SIMD_KERNELS_DOT4_VAL)
+}
+
+#define SL_SIMD_KERNELS_MATRIX_PRODUCT_PARAMS \
+  int num_rows, int inner, int num_cols, \
+  float * const *result_columns, const float * const *left_columns, const float *left_scalars, \
+  const float * const *right_columns, const float *right_scalars
+#define SL_SIMD_KERNELS_MATRIX_PRODUCT_ARGS \
+  num_rows, inner, num_cols, result_columns, left_columns, left_scalars, right_columns, right_scalars
+
+#define SL_SIMD_KERNELS_MATRIX_PRODUCT_ST(w, p, bits, v) V##w##_ST(p, v)
+#define SL_SIMD_KERNELS_MATRIX_PRODUCT_MST(w, p, bits, v) \
+  if ((bits) == ((1u << w) - 1)) V##w##_ST(p, v); \
+  else V##w##_MST(p, bits, v)
+
+/* w rows of sl_exec_f_matrix_product() from row onwards: every operand column is loaded (or its scalar broadcast)
+ * once, and all results are computed before any is stored, so results may be stored over the operands. Sums are
+ * evaluated left to right, as in the generic kernel, so results are identical. */
+#define SL_SIMD_KERNELS_MATRIX_PRODUCT_ROWS(name, w, store) \
+static SL_SIMD_KERNELS_TARGET void SL_SIMD_KERNELS_NAME(name)(int row, unsigned int bits, SL_SIMD_KERNELS_MATRIX_PRODUCT_PARAMS) { \
+  V##w##_F left[16], right[16], result[16]; \
+  int r, c, k; \
+  for (k = 0; k < (num_rows * inner); ++k) { \
+    left[k] = left_scalars ? V##w##_SET1(left_scalars[k]) : V##w##_LD(left_columns[k] + row); \
+  } \
+  for (k = 0; k < (inner * num_cols); ++k) { \
+    right[k] = right_scalars ? V##w##_SET1(right_scalars[k]) : V##w##_LD(right_columns[k] + row); \
+  } \
+  for (c = 0; c < num_cols; ++c) { \
+    for (r = 0; r < num_rows; ++r) { \
+      V##w##_F sum = V##w##_MUL(left[r], right[c * inner]); \
+      for (k = 1; k < inner; ++k) { \
+        sum = V##w##_ADD(sum, V##w##_MUL(left[k * num_rows + r], right[c * inner + k])); \
+      } \
+      result[c * num_rows + r] = sum; \
+    } \
+  } \
+  for (k = 0; k < (num_rows * num_cols); ++k) { \
+    store(w, result_columns[k] + row, bits, result[k]); \
+  } \
+}
+/* Expands w before it is pasted */
+#define SL_SIMD_KERNELS_MATRIX_PRODUCT_ROWS_W(name, w, store) SL_SIMD_KERNELS_MATRIX_PRODUCT_ROWS(name, w, store)
+
+SL_SIMD_KERNELS_MATRIX_PRODUCT_ROWS(f_matrix_product_rows_1, 1, SL_SIMD_KERNELS_MATRIX_PRODUCT_ST)
+SL_SIMD_KERNELS_MATRIX_PRODUCT_ROWS(f_matrix_product_rows_4, 4, SL_SIMD_KERNELS_MATRIX_PRODUCT_ST)
+#if SL_SIMD_KERNELS_WIDTH >= 8
+SL_SIMD_KERNELS_MATRIX_PRODUCT_ROWS(f_matrix_product_rows_8, 8, SL_SIMD_KERNELS_MATRIX_PRODUCT_ST)
+#endif
+#if SL_SIMD_KERNELS_WIDTH >= 16
+SL_SIMD_KERNELS_MATRIX_PRODUCT_ROWS(f_matrix_product_rows_16, 16, SL_SIMD_KERNELS_MATRIX_PRODUCT_ST)
+#endif
+SL_SIMD_KERNELS_MATRIX_PRODUCT_ROWS_W(f_matrix_product_rows_masked, SL_SIMD_KERNELS_WIDTH, SL_SIMD_KERNELS_MATRIX_PRODUCT_MST)
+
+static SL_SIMD_KERNELS_TARGET void SL_SIMD_KERNELS_NAME(f_matrix_product)(sl_exec_row_t row, sl_exec_row_t *restrict chain_column, SL_SIMD_KERNELS_MATRIX_PRODUCT_PARAMS) {
+  for (;;) {
+    sl_exec_row_t delta;
+#if SL_SIMD_KERNELS_WIDTH >= 16
+    if (!(row & 15) && SL_EXEC_CHAIN_RUN_OF_16(chain_column, row)) {
+      SL_SIMD_KERNELS_NAME(f_matrix_product_rows_16)((int)row, 0xFFFF, SL_SIMD_KERNELS_MATRIX_PRODUCT_ARGS);
+      delta = chain_column[row + 15];
+      if (!delta) break;
+      row += 15 + delta;
+      continue;
+    }
+#endif
+    if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
+#if SL_SIMD_KERNELS_WIDTH >= 8
+      SL_SIMD_KERNELS_NAME(f_matrix_product_rows_8)((int)row, 0xFF, SL_SIMD_KERNELS_MATRIX_PRODUCT_ARGS);
+#else
+      SL_SIMD_KERNELS_NAME(f_matrix_product_rows_4)((int)row, 0xF, SL_SIMD_KERNELS_MATRIX_PRODUCT_ARGS);
+      SL_SIMD_KERNELS_NAME(f_matrix_product_rows_4)((int)row + 4, 0xF, SL_SIMD_KERNELS_MATRIX_PRODUCT_ARGS);
+#endif
+      delta = chain_column[row + 7];
+      if (!delta) break;
+      row += 7 + delta;
+    }
+    else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
+      SL_SIMD_KERNELS_NAME(f_matrix_product_rows_4)((int)row, 0xF, SL_SIMD_KERNELS_MATRIX_PRODUCT_ARGS);
+      delta = chain_column[row + 3];
+      if (!delta) break;
+      row += 3 + delta;
+    }
+    else {
+      SL_SIMD_KERNELS_NAME(f_matrix_product_rows_1)((int)row, 0x1, SL_SIMD_KERNELS_MATRIX_PRODUCT_ARGS);
+      delta = chain_column[row];
+      if (!delta) break;
+      row += delta;
+    }
+  }
+}
+
+static SL_SIMD_KERNELS_TARGET void SL_SIMD_KERNELS_NAME(f_matrix_product_masked)(const uint64_t *restrict mask, SL_SIMD_KERNELS_MATRIX_PRODUCT_PARAMS) {
+  int row;
+  for (row = 0; row < SL_EXEC_CHAIN_MAX_NUM_ROWS; row += SL_SIMD_KERNELS_WIDTH) {
+    unsigned int bits = (unsigned int)(mask[row >> 6] >> (row & 63)) & ((1u << SL_SIMD_KERNELS_WIDTH) - 1);
+    if (!bits) continue;
+    SL_SIMD_KERNELS_NAME(f_matrix_product_rows_masked)(row, bits, SL_SIMD_KERNELS_MATRIX_PRODUCT_ARGS);
+  }
+}
+
+/* Texel blends, 8 lanes at a time in one vector where the width allows, in two otherwise */
+#if SL_SIMD_KERNELS_WIDTH >= 8
+#define SL_SIMD_KERNELS_TEXEL_WIDTH 8
+#define SL_SIMD_KERNELS_TEXEL(op) V8_##op
+#else
+#define SL_SIMD_KERNELS_TEXEL_WIDTH 4
+#define SL_SIMD_KERNELS_TEXEL(op) V4_##op
+#endif
+
+static SL_SIMD_KERNELS_TARGET void SL_SIMD_KERNELS_NAME(texel_bilinear)(int num_components, const uint32_t *restrict texels, const uint32_t *restrict weights, uint32_t *restrict channels) {
+  int n, ch;
+  for (n = 0; n < 8; n += SL_SIMD_KERNELS_TEXEL_WIDTH) {
+    SL_SIMD_KERNELS_TEXEL(I) t00 = SL_SIMD_KERNELS_TEXEL(I_LD)(texels + n);
+    SL_SIMD_KERNELS_TEXEL(I) t01 = SL_SIMD_KERNELS_TEXEL(I_LD)(texels + 8 + n);
+    SL_SIMD_KERNELS_TEXEL(I) t10 = SL_SIMD_KERNELS_TEXEL(I_LD)(texels + 16 + n);
+    SL_SIMD_KERNELS_TEXEL(I) t11 = SL_SIMD_KERNELS_TEXEL(I_LD)(texels + 24 + n);
+    SL_SIMD_KERNELS_TEXEL(I) w00 = SL_SIMD_KERNELS_TEXEL(I_LD)(weights + n);
+    SL_SIMD_KERNELS_TEXEL(I) w01 = SL_SIMD_KERNELS_TEXEL(I_LD)(weights + 8 + n);
+    SL_SIMD_KERNELS_TEXEL(I) w10 = SL_SIMD_KERNELS_TEXEL(I_LD)(weights + 16 + n);
+    SL_SIMD_KERNELS_TEXEL(I) w11 = SL_SIMD_KERNELS_TEXEL(I_LD)(weights + 24 + n);
+    SL_SIMD_KERNELS_TEXEL(I) byte_mask = SL_SIMD_KERNELS_TEXEL(I_SET1)(255);
+    for (ch = 0; ch < num_components; ++ch) {
+      SL_SIMD_KERNELS_TEXEL(I) c;
+      c = SL_SIMD_KERNELS_TEXEL(I_MULLO)(SL_SIMD_KERNELS_TEXEL(I_AND)(t00, byte_mask), w00);
+      c = SL_SIMD_KERNELS_TEXEL(I_ADD)(c, SL_SIMD_KERNELS_TEXEL(I_MULLO)(SL_SIMD_KERNELS_TEXEL(I_AND)(t01, byte_mask), w01));
+      c = SL_SIMD_KERNELS_TEXEL(I_ADD)(c, SL_SIMD_KERNELS_TEXEL(I_MULLO)(SL_SIMD_KERNELS_TEXEL(I_AND)(t10, byte_mask), w10));
+      c = SL_SIMD_KERNELS_TEXEL(I_ADD)(c, SL_SIMD_KERNELS_TEXEL(I_MULLO)(SL_SIMD_KERNELS_TEXEL(I_AND)(t11, byte_mask), w11));
+      SL_SIMD_KERNELS_TEXEL(I_ST)(channels + 8 * ch + n, c);
+      t00 = SL_SIMD_KERNELS_TEXEL(I_SRLI)(t00, 8);
+      t01 = SL_SIMD_KERNELS_TEXEL(I_SRLI)(t01, 8);
+      t10 = SL_SIMD_KERNELS_TEXEL(I_SRLI)(t10, 8);
+      t11 = SL_SIMD_KERNELS_TEXEL(I_SRLI)(t11, 8);
+    }
+  }
+}
+
+static SL_SIMD_KERNELS_TARGET void SL_SIMD_KERNELS_NAME(texel_lerp)(int num_components, uint32_t *restrict channels, const uint32_t *restrict weights,
+                                                                    const uint32_t *restrict other_channels, const uint32_t *restrict other_weights) {
+  int n, ch;
+  for (n = 0; n < 8; n += SL_SIMD_KERNELS_TEXEL_WIDTH) {
+    SL_SIMD_KERNELS_TEXEL(I) w = SL_SIMD_KERNELS_TEXEL(I_LD)(weights + n);
+    SL_SIMD_KERNELS_TEXEL(I) other_w = SL_SIMD_KERNELS_TEXEL(I_LD)(other_weights + n);
+    for (ch = 0; ch < num_components; ++ch) {
+      SL_SIMD_KERNELS_TEXEL(I) c = SL_SIMD_KERNELS_TEXEL(I_MULLO)(SL_SIMD_KERNELS_TEXEL(I_LD)(channels + 8 * ch + n), w);
+      c = SL_SIMD_KERNELS_TEXEL(I_ADD)(c, SL_SIMD_KERNELS_TEXEL(I_MULLO)(SL_SIMD_KERNELS_TEXEL(I_LD)(other_channels + 8 * ch + n), other_w));
+      SL_SIMD_KERNELS_TEXEL(I_ST)(channels + 8 * ch + n, c);
+    }
+  }
+}
+
+static void SL_SIMD_KERNELS_NAME(get_kernels)(struct sl_simd_kernels *k) {
+  k->f_add_ = SL_SIMD_KERNELS_NAME(f_add);
+  k->f_sub_ = SL_SIMD_KERNELS_NAME(f_sub);
+  k->f_mul_ = SL_SIMD_KERNELS_NAME(f_mul);
+  k->f_div_ = SL_SIMD_KERNELS_NAME(f_div);
+  k->f_negate_ = SL_SIMD_KERNELS_NAME(f_negate);
+  k->f_increment_ = SL_SIMD_KERNELS_NAME(f_increment);
+  k->f_decrement_ = SL_SIMD_KERNELS_NAME(f_decrement);
+  k->f_dot_product2_ = SL_SIMD_KERNELS_NAME(f_dot_product2);
+  k->f_dot_product3_ = SL_SIMD_KERNELS_NAME(f_dot_product3);
+  k->f_dot_product4_ = SL_SIMD_KERNELS_NAME(f_dot_product4);
+  k->f_matrix_product_ = SL_SIMD_KERNELS_NAME(f_matrix_product);
+  k->f_clamp_ = SL_SIMD_KERNELS_NAME(f_clamp);
+  k->f_mix_ = SL_SIMD_KERNELS_NAME(f_mix);
+  k->f_inversesqrt_ = SL_SIMD_KERNELS_NAME(f_inversesqrt);
+  k->f_sin_ = SL_SIMD_KERNELS_NAME(f_sin);
+  k->f_cos_ = SL_SIMD_KERNELS_NAME(f_cos);
+  k->f_exp_ = SL_SIMD_KERNELS_NAME(f_exp);
+  k->f_exp2_ = SL_SIMD_KERNELS_NAME(f_exp2);
+  k->f_log_ = SL_SIMD_KERNELS_NAME(f_log);
+  k->f_log2_ = SL_SIMD_KERNELS_NAME(f_log2);
+  k->f_pow_ = SL_SIMD_KERNELS_NAME(f_pow);
+
+  k->f_add_masked_ = SL_SIMD_KERNELS_NAME(f_add_masked);
+  k->f_sub_masked_ = SL_SIMD_KERNELS_NAME(f_sub_masked);
+  k->f_mul_masked_ = SL_SIMD_KERNELS_NAME(f_mul_masked);
+  k->f_div_masked_ = SL_SIMD_KERNELS_NAME(f_div_masked);
+  k->f_negate_masked_ = SL_SIMD_KERNELS_NAME(f_negate_masked);
+  k->f_increment_masked_ = SL_SIMD_KERNELS_NAME(f_increment_masked);
+  k->f_decrement_masked_ = SL_SIMD_KERNELS_NAME(f_decrement_masked);
+  k->f_dot_product2_masked_ = SL_SIMD_KERNELS_NAME(f_dot_product2_masked);
+  k->f_dot_product3_masked_ = SL_SIMD_KERNELS_NAME(f_dot_product3_masked);
+  k->f_dot_product4_masked_ = SL_SIMD_KERNELS_NAME(f_dot_product4_masked);
+  k->f_matrix_product_masked_ = SL_SIMD_KERNELS_NAME(f_matrix_product_masked);
+
+  k->texel_bilinear_ = SL_SIMD_KERNELS_NAME(texel_bilinear);
+  k->texel_lerp_ = SL_SIMD_KERNELS_NAME(texel_lerp);
+}
+
+#undef SL_SIMD_KERNELS_WALK16
+#undef SL_SIMD_KERNELS_TEXEL_WIDTH
+#undef SL_SIMD_KERNELS_TEXEL
+#undef SL_SIMD_KERNELS_ST8
+#undef SL_SIMD_KERNELS_WALK
+#undef SL_SIMD_KERNELS_MASKED_STEP
+#undef SL_SIMD_KERNELS_WALK_MASKED
+#undef SL_SIMD_KERNELS_NAME_2
+#undef SL_SIMD_KERNELS_NAME_1
+#undef SL_SIMD_KERNELS_NAME
+#undef SL_SIMD_KERNELS_BINOP
+#undef SL_SIMD_KERNELS_UNOP
+#undef SL_SIMD_KERNELS_TERNOP
+#undef SL_SIMD_KERNELS_BUILTIN_UNOP
+#undef SL_SIMD_KERNELS_BUILTIN_BINOP
+#undef SL_SIMD_KERNELS_MATH
+#undef SL_SIMD_KERNELS_MATRIX_PRODUCT_PARAMS
+#undef SL_SIMD_KERNELS_MATRIX_PRODUCT_ARGS
+#undef SL_SIMD_KERNELS_MATRIX_PRODUCT_ST
+#undef SL_SIMD_KERNELS_MATRIX_PRODUCT_MST
+#undef SL_SIMD_KERNELS_MATRIX_PRODUCT_ROWS
+#undef SL_SIMD_KERNELS_MATRIX_PRODUCT_ROWS_W
+#undef SL_SIMD_KERNELS_LD
+#undef SL_SIMD_KERNELS_ADD_VAL
+#undef SL_SIMD_KERNELS_SUB_VAL
+#undef SL_SIMD_KERNELS_MUL_VAL
+#undef SL_SIMD_KERNELS_DIV_VAL
+#undef SL_SIMD_KERNELS_NEGATE_VAL
+#undef SL_SIMD_KERNELS_INCREMENT_VAL
+#undef SL_SIMD_KERNELS_DECREMENT_VAL
+#undef SL_SIMD_KERNELS_CLAMP_VAL
+#undef SL_SIMD_KERNELS_MIX_VAL
+#undef SL_SIMD_KERNELS_DOT2_VAL
+#undef SL_SIMD_KERNELS_DOT3_VAL
+#undef SL_SIMD_KERNELS_DOT4_VAL
+#undef SL_SIMD_KERNELS_INVERSESQRT_VAL
+#undef SL_SIMD_KERNELS_SIN_VAL
+#undef SL_SIMD_KERNELS_COS_VAL
+#undef SL_SIMD_KERNELS_EXP_VAL
+#undef SL_SIMD_KERNELS_EXP2_VAL
+#undef SL_SIMD_KERNELS_LOG_VAL
+#undef SL_SIMD_KERNELS_LOG2_VAL
+#undef SL_SIMD_KERNELS_POW_VAL
+#undef SL_SIMD_KERNELS_DOT2_PARAMS
+#undef SL_SIMD_KERNELS_DOT3_PARAMS
+#undef SL_SIMD_KERNELS_DOT4_PARAMS
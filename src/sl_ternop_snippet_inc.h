@@ -24,11 +24,15 @@
  * #define TERNOP_SNIPPET_TYPE float
  *
  * It assumes the following variables/parameters are in scope:
- * chain_column: of type "const uint8_t * restrict"; points to the chain column
+ * chain_column: of type "const sl_exec_row_t * restrict"; points to the chain column
  * result_column: of type "TERNOP_SNIPPET_TYPE * restrict"; points to the destination
  * first_column: of type "const TERNOP_SNIPPET_TYPE * restrict"; points to the first operand
  * second_column: of type "const TERNOP_SNIPPET_TYPE * restrict"; points to the second operand
  * third_column: of type "const TERNOP_SNIPPET_TYPE * restrict"; points to the third operand
+ *
+ * Optionally, for float kernels, define:
+ * #define TERNOP_SNIPPET_SIMD_KERNEL <<kernel function pointer, see struct sl_simd_kernels>>
+ * in which case the kernel is called instead of the generic code below if it is not NULL.
  */
 
 #ifndef TERNOP_SNIPPET_RESULT_TYPE
@@ -36,11 +40,16 @@
 #define TERNOP_SNIPPET_UNDEF_RESULT_TYPE
 #endif
 
+#ifdef TERNOP_SNIPPET_SIMD_KERNEL
+if (TERNOP_SNIPPET_SIMD_KERNEL) {
+  TERNOP_SNIPPET_SIMD_KERNEL(row, chain_column, result_column, first_column, second_column, third_column);
+}
+else
+#endif
 for (;;) {
-  uint64_t chain;
-  uint8_t delta;
+  sl_exec_row_t delta;
 
-  if (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101)) {
+  if (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row)) {
     do {
       TERNOP_SNIPPET_RESULT_TYPE *restrict result = result_column + row;
       const TERNOP_SNIPPET_TYPE *restrict first = first_column + row;
@@ -52,12 +61,12 @@ for (;;) {
         result[n] = TERNOP_SNIPPET_OPERATOR((first[n]), (second[n]), (third[n]));
       }
 
-      delta = (chain & 0xFF00000000000000) >> 56;
+      delta = chain_column[row + 7];
       if (!delta) break;
       row += 7 + delta;
-    } while (!(row & 7) && (((chain = *(uint64_t *)(chain_column + row)) & 0xFFFFFFFFFFFFFFULL) == 0x01010101010101));
+    } while (!(row & 7) && SL_EXEC_CHAIN_RUN_OF_8(chain_column, row));
   }
-  else if (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101)) {
+  else if (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row)) {
     do {
       TERNOP_SNIPPET_RESULT_TYPE *restrict result = result_column + row;
       const TERNOP_SNIPPET_TYPE *restrict first = first_column + row;
@@ -68,10 +77,10 @@ for (;;) {
       for (n = 0; n < 4; n++) {
         result[n] = TERNOP_SNIPPET_OPERATOR((first[n]), (second[n]), (third[n]));
       }
-      delta = (chain & 0xFF000000) >> 24;
+      delta = chain_column[row + 3];
       if (!delta) break;
       row += 3 + delta;
-    } while (!(row & 3) && (((chain = *(uint32_t *)(chain_column + row)) & 0xFFFFFF) == 0x010101));
+    } while (!(row & 3) && SL_EXEC_CHAIN_RUN_OF_4(chain_column, row));
   }
   else {
     do {
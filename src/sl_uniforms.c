@@ -60,6 +60,8 @@
 static void sl_uniform_init(struct sl_uniform *u) {
   u->chain_ = NULL;
   u->fragment_variable_ = u->vertex_variable_ = u->debug_variable_ = NULL;
+  u->version_ = 0;
+  u->has_samplers_ = 0;
   u->slab_[0] = 0;
 }
 
@@ -68,6 +70,7 @@ static void sl_uniform_free(struct sl_uniform *u) {
 
 void sl_uniform_table_init(struct sl_uniform_table *ut) {
   ut->uniforms_ = NULL;
+  ut->version_ = 0;
 }
 
 void sl_uniform_table_cleanup(struct sl_uniform_table *ut) {
@@ -369,7 +372,7 @@ static int sl_uniform_get_ra_location_info(struct sl_reg_alloc *ra, size_t locat
   }
 }
 
-int sl_uniform_get_location_info(struct sl_uniform_table *ut, size_t location, void **pp_slab_memory, sl_reg_alloc_kind_t *plocation_type, size_t *pname_length, char *name_buf, size_t *pfinal_array_size, size_t *pentry_in_final_array) {
+static int sl_uniform_get_location_info_impl(struct sl_uniform_table *ut, size_t location, struct sl_uniform **pp_uniform, void **pp_slab_memory, sl_reg_alloc_kind_t *plocation_type, size_t *pname_length, char *name_buf, size_t *pfinal_array_size, size_t *pentry_in_final_array) {
   int r;
   size_t num_locations_remaining = location;
   struct sl_uniform *u = ut->uniforms_;
@@ -404,6 +407,7 @@ int sl_uniform_get_location_info(struct sl_uniform_table *ut, size_t location, v
         if (plocation_type) *plocation_type = location_type;
         if (pfinal_array_size) *pfinal_array_size = final_array_size;
         if (pentry_in_final_array) *pentry_in_final_array = entry_in_final_array;
+        if (pp_uniform) *pp_uniform = u;
         return 0;
       }
       else {
@@ -415,6 +419,19 @@ int sl_uniform_get_location_info(struct sl_uniform_table *ut, size_t location, v
   return SL_ERR_INVALID_ARG;
 }
 
+int sl_uniform_get_location_info(struct sl_uniform_table *ut, size_t location, void **pp_slab_memory, sl_reg_alloc_kind_t *plocation_type, size_t *pname_length, char *name_buf, size_t *pfinal_array_size, size_t *pentry_in_final_array) {
+  return sl_uniform_get_location_info_impl(ut, location, NULL, pp_slab_memory, plocation_type, pname_length, name_buf, pfinal_array_size, pentry_in_final_array);
+}
+
+int sl_uniform_get_location_info_for_update(struct sl_uniform_table *ut, size_t location, void **pp_slab_memory, sl_reg_alloc_kind_t *plocation_type, size_t *pfinal_array_size, size_t *pentry_in_final_array) {
+  struct sl_uniform *u = NULL;
+  int r;
+  r = sl_uniform_get_location_info_impl(ut, location, &u, pp_slab_memory, plocation_type, NULL, NULL, pfinal_array_size, pentry_in_final_array);
+  if (r) return r;
+  u->version_ = ++ut->version_;
+  return 0;
+}
+
 static int sl_uniform_get_ra_named_location(struct sl_reg_alloc *ra, const char *name, size_t *plocation) {
   int r;
   const char *cp = name;
@@ -619,6 +636,24 @@ int sl_uniform_get_named_location(struct sl_uniform_table *ut, const char *name,
 }
 
 
+static int sl_uniform_reg_alloc_has_samplers(struct sl_reg_alloc *ra) {
+  size_t n;
+  switch (ra->kind_) {
+    case slrak_array:
+      return sl_uniform_reg_alloc_has_samplers(ra->v_.array_.head_);
+    case slrak_struct:
+      for (n = 0; n < ra->v_.comp_.num_fields_; ++n) {
+        if (sl_uniform_reg_alloc_has_samplers(ra->v_.comp_.fields_ + n)) return 1;
+      }
+      return 0;
+    case slrak_sampler2D:
+    case slrak_samplerCube:
+      return 1;
+    default:
+      return 0;
+  }
+}
+
 int sl_uniform_table_add_uniform(struct sl_uniform_table *ut, struct sl_uniform **pp_uniform, struct sl_variable *vertex_side, struct sl_variable *fragment_side, struct sl_variable *debug_side) {
   if (!vertex_side && !fragment_side && !debug_side) return SL_ERR_INVALID_ARG;
   if ((vertex_side || fragment_side) && !sl_are_variables_compatible(vertex_side, fragment_side)) {
@@ -640,6 +675,7 @@ int sl_uniform_table_add_uniform(struct sl_uniform_table *ut, struct sl_uniform
   u->vertex_variable_ = vertex_side;
   u->fragment_variable_ = fragment_side;
   u->debug_variable_ = debug_side;
+  u->has_samplers_ = !!sl_uniform_reg_alloc_has_samplers(&var->reg_alloc_);
   memset(u->slab_, 0, slab_size);
   if (ut->uniforms_) {
     /* tail cyclic append to end */
@@ -744,8 +780,8 @@ static void sl_uniform_load_f(size_t num, float *dst, float val) {
   }
 }
 
-static void sl_uniform_load_i(size_t num, int64_t *dst, int64_t val) {
-  int64_t *restrict p = (int64_t * restrict)dst;
+static void sl_uniform_load_i(size_t num, sl_exec_int_t *dst, sl_exec_int_t val) {
+  sl_exec_int_t *restrict p = (sl_exec_int_t * restrict)dst;
   while (num--) {
     *p++ = val;
   }
@@ -847,7 +883,11 @@ int sl_uniform_load_ra_for_execution(struct sl_execution *exec, void *base_mem,
           case slrak_mat4:  num_components = 16; break;
         }
         for (n = 0; n < num_components; ++n) {
-          sl_uniform_load_f(exec->max_num_rows_, exec->float_regs_[ ra->v_.regs_[n] + reg_offset ], ((float *)(((char *)base_mem) + offset))[n]);
+          int reg = ra->v_.regs_[n] + reg_offset;
+          float val = ((float *)(((char *)base_mem) + offset))[n];
+          /* Bytecode reads the scalar, only broadcast if a column is also needed (see sl_exec_prep()) */
+          if (exec->float_uniforms_) exec->float_uniforms_[reg] = val;
+          if (exec->float_regs_[reg]) sl_uniform_load_f(exec->max_num_rows_, exec->float_regs_[reg], val);
         }
         *pnum_slab_bytes_consumed = offset - original_offset + num_components * sizeof(float);
         break;
@@ -879,7 +919,7 @@ int sl_uniform_load_ra_for_execution(struct sl_execution *exec, void *base_mem,
           case slrak_ivec4: num_components = 4; break;
         }
         for (n = 0; n < num_components; ++n) {
-          sl_uniform_load_i(exec->max_num_rows_, exec->int_regs_[ra->v_.regs_[n] + reg_offset ], ((int64_t *)(((char *)base_mem) + offset))[n]);
+          sl_uniform_load_i(exec->max_num_rows_, exec->int_regs_[ra->v_.regs_[n] + reg_offset ], (sl_exec_int_t)((int64_t *)(((char *)base_mem) + offset))[n]);
         }
         *pnum_slab_bytes_consumed = offset - original_offset + num_components * sizeof(int64_t);
         break;
@@ -37,6 +37,12 @@ struct sl_uniform {
 
   /* Vertex and/or fragment and/or debug shader variables, at least one must be non-NULL. */
   struct sl_variable *vertex_variable_, *fragment_variable_, *debug_variable_;
+
+  /* sl_uniform_table::version_ as of the last update to slab_, see sl_uniform_get_location_info_for_update() */
+  uint64_t version_;
+
+  /* Non-zero if the uniform is, or contains, a sampler; these depend on the texture units' bindings as well. */
+  int has_samplers_:1;
   
   /* Memory used to represent the data for this uniform; depends on the variable; 
    * this is a variable length array, the sl_uniform as a whole is allocated 
@@ -46,6 +52,9 @@ struct sl_uniform {
 
 struct sl_uniform_table {
   struct sl_uniform *uniforms_;
+
+  /* Incremented upon each update of a uniform */
+  uint64_t version_;
 };
 
 void sl_uniform_table_init(struct sl_uniform_table *ut);
@@ -56,6 +65,10 @@ int sl_uniform_table_add_uniform(struct sl_uniform_table *ut, struct sl_uniform
 int sl_uniform_get_named_location(struct sl_uniform_table *ut, const char *name, size_t *plocation);
 int sl_uniform_get_location_info(struct sl_uniform_table *ut, size_t location, void **pp_slab_memory, sl_reg_alloc_kind_t *plocation_type, size_t *pname_length, char *name_buf, size_t *pfinal_array_size, size_t *pentry_in_final_array);
 
+/* Same as sl_uniform_get_location_info(), for callers about to write to the slab memory returned; marks the
+ * uniform as updated so it is reloaded for execution by the next sl_program_load_uniforms_for_execution(). */
+int sl_uniform_get_location_info_for_update(struct sl_uniform_table *ut, size_t location, void **pp_slab_memory, sl_reg_alloc_kind_t *plocation_type, size_t *pfinal_array_size, size_t *pentry_in_final_array);
+
 /* Maximum possible length of a uniform location name, including a null terminator. */
 int sl_uniform_table_max_name_length(struct sl_uniform_table *ut, size_t *pmax_name_length);
 
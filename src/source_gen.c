@@ -246,7 +246,7 @@ void sg_printf(struct source_gen *sg, const char *fmt, ...) {
     return;
   }
 #else
-  len = vsnprintf(NULL, 0, fmt, cargs) + 1;
+  len = vsnprintf(NULL, 0, fmt, cargs);
 #endif
 
   va_end(cargs);
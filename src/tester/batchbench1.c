@@ -0,0 +1,193 @@
+/* Copyright 2024 Kinglet B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STDLIB_H_INCLUDED
+#define STDLIB_H_INCLUDED
+#include <stdlib.h>
+#endif
+
+#ifndef STDIO_H_INCLUDED
+#define STDIO_H_INCLUDED
+#include <stdio.h>
+#endif
+
+#ifndef STRING_H_INCLUDED
+#define STRING_H_INCLUDED
+#include <string.h>
+#endif
+
+#ifndef TIME_H_INCLUDED
+#define TIME_H_INCLUDED
+#include <time.h>
+#endif
+
+#ifdef USE_STANDARD_NON_AEX_GL_HEADERS
+#ifndef GLES2_GL2_H_INCLUDED
+#define GLES2_GL2_H_INCLUDED
+#include <GLES2/gl2.h>
+#endif
+#else
+#include "gl_es2_impl.h"
+
+#ifndef GLES2_GL2_H_INCLUDED
+#define GLES2_GL2_H_INCLUDED
+#define GL_GLES_PROTOTYPES 0  /* we will define the prototypes as static function pointers by including gl_es2_aex_func_map.c */
+#include <GLES2/gl2.h>
+#endif
+#include "gl_es2_aex_func_map.c"
+#endif
+
+#ifndef GL_ES2_CONTEXT_H_INCLUDED
+#define GL_ES2_CONTEXT_H_INCLUDED
+#include "gl_es2_context.h"
+#endif
+
+#ifndef SL_EXECUTION_H_INCLUDED
+#define SL_EXECUTION_H_INCLUDED
+#include "sl_execution.h"
+#endif
+
+/* Total number of fragments shaded for each batch width */
+#define BATCHBENCH1_NUM_FRAGMENTS (1 << 20)
+
+int print_shader_log(FILE *fp, GLuint shader);
+int print_program_log(FILE *fp, GLuint program);
+
+/* Runs the fragment shader of a program directly (bypassing rasterization) over the same number of fragments
+ * in batches of varying width, and reports the fragments per second for each. Widths beyond the rows
+ * the shader was allocated for (see sl_exec_batch_num_rows()) are skipped; set AEX_SL_BATCH_CACHE_BUDGET=0 and
+ * build with a larger SL_EXEC_CHAIN_MAX_NUM_ROWS to measure those. */
+int batchbench1(void) {
+  static const size_t batch_widths[] = { 64, 128, 256, 1024, 4096 };
+  int r = -1;
+  size_t n;
+
+  GLuint vertex_shader = glCreateShader(GL_VERTEX_SHADER);
+  const char *vsrc =
+    "attribute vec4 vgl_Position;\n"
+    "attribute vec4 v_color;\n"
+    "varying vec4 vertex_color;\n"
+    "void main() {\n"
+    "  vertex_color = v_color;\n"
+    "  gl_Position = vgl_Position;\n"
+    "}\n";
+  GLint vsrc_len = (int)strlen(vsrc);
+  glShaderSource(vertex_shader, 1, &vsrc, &vsrc_len);
+  glCompileShader(vertex_shader);
+
+  GLint vcompile_status = 0;
+  glGetShaderiv(vertex_shader, GL_COMPILE_STATUS, &vcompile_status);
+  if (vcompile_status == GL_FALSE) {
+    fprintf(stderr, "Failed to compile vertex shader. Diagnostics:\n");
+    print_shader_log(stderr, vertex_shader);
+    goto test_exit;
+  }
+
+  GLuint fragment_shader = glCreateShader(GL_FRAGMENT_SHADER);
+  const char *fsrc =
+    "precision highp float;\n"
+    "varying vec4 vertex_color;\n"
+    "void main() {\n"
+    "  vec4 c = vertex_color;\n"
+    "  float luma = dot(c.rgb, vec3(0.299, 0.587, 0.114));\n"
+    "  c.rgb = mix(c.rgb, vec3(luma), 0.25);\n"
+    "  if (luma > 0.5) {\n"
+    "    c.rgb = c.rgb * c.rgb;\n"
+    "  }\n"
+    "  gl_FragColor = clamp(c * 1.1 - vec4(0.05), 0.0, 1.0);\n"
+    "}\n";
+  GLint fsrc_len = (int)strlen(fsrc);
+  glShaderSource(fragment_shader, 1, &fsrc, &fsrc_len);
+  glCompileShader(fragment_shader);
+
+  GLint fcompile_status = 0;
+  glGetShaderiv(fragment_shader, GL_COMPILE_STATUS, &fcompile_status);
+  if (fcompile_status == GL_FALSE) {
+    fprintf(stderr, "Failed to compile fragment shader. Diagnostics:\n");
+    print_shader_log(stderr, fragment_shader);
+    goto test_exit;
+  }
+
+  GLuint program = glCreateProgram();
+  glAttachShader(program, vertex_shader);
+  glAttachShader(program, fragment_shader);
+  glLinkProgram(program);
+
+  GLint plink_status = 0;
+  glGetProgramiv(program, GL_LINK_STATUS, &plink_status);
+  if (plink_status == GL_FALSE) {
+    fprintf(stderr, "Failed to link program. Diagnostics:\n");
+    print_program_log(stderr, program);
+    goto test_exit;
+  }
+
+  struct gl_es2_context *c = gl_es2_ctx_dont_lock();
+  struct gl_es2_program *prog = (struct gl_es2_program *)not_find(&c->program_not_, (uintptr_t)program);
+  if (!prog) {
+    goto test_exit;
+  }
+
+  struct sl_shader *fs = &prog->fragment_shader_.shader_->shader_;
+  struct sl_execution *exec = &fs->exec_;
+  struct sl_function *fmain = sl_compilation_unit_find_function(&fs->cu_, "main");
+  struct sl_variable *vertex_color = sl_compilation_unit_find_variable(&fs->cu_, "vertex_color");
+  if (!fmain || !vertex_color) {
+    goto test_exit;
+  }
+
+  /* Spread the varying over the rows so both sides of the branch are taken */
+  size_t row;
+  for (n = 0; n < 4; ++n) {
+    float *column = exec->float_regs_[vertex_color->reg_alloc_.v_.regs_[n]];
+    for (row = 0; row < exec->max_num_rows_; ++row) {
+      column[row] = (float)((row * (n + 3)) % 17) / 16.f;
+    }
+  }
+
+  fprintf(stdout, "batchbench1: SL_EXEC_CHAIN_MAX_NUM_ROWS=%d\n", SL_EXEC_CHAIN_MAX_NUM_ROWS);
+  for (n = 0; n < sizeof(batch_widths) / sizeof(*batch_widths); ++n) {
+    size_t batch_width = batch_widths[n];
+    size_t num_batches = BATCHBENCH1_NUM_FRAGMENTS / batch_width;
+    size_t batch;
+    if (batch_width > exec->max_num_rows_) {
+      fprintf(stdout, "  %5zu rows per batch: n/a (shader has %zu rows allocated, see SL_EXEC_CHAIN_MAX_NUM_ROWS and AEX_SL_BATCH_CACHE_BUDGET)\n",
+              batch_width, exec->max_num_rows_);
+      continue;
+    }
+
+    clock_t start = clock();
+    for (batch = 0; batch < num_batches; ++batch) {
+      /* Set up execution chain, as primitive_assembly does for each batch of fragments */
+      for (row = 0; row < (batch_width - 1); ++row) {
+        exec->exec_chain_reg_[row] = 1;
+      }
+      exec->exec_chain_reg_[batch_width - 1] = 0;
+
+      if (sl_exec_run(exec, fmain, 0)) {
+        fprintf(stderr, "batchbench1: shader failed to run\n");
+        goto test_exit;
+      }
+    }
+    double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    if (seconds <= 0.) seconds = 1. / CLOCKS_PER_SEC;
+
+    fprintf(stdout, "  %5zu rows per batch: %.2f Mfragments/sec\n", batch_width, (num_batches * batch_width) / seconds / 1e6);
+  }
+
+  r = 0;
+test_exit:
+
+  return r;
+}
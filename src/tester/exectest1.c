@@ -0,0 +1,584 @@
+/* Copyright 2024 Kinglet B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STDLIB_H_INCLUDED
+#define STDLIB_H_INCLUDED
+#include <stdlib.h>
+#endif
+
+#ifndef STDIO_H_INCLUDED
+#define STDIO_H_INCLUDED
+#include <stdio.h>
+#endif
+
+#ifndef STRING_H_INCLUDED
+#define STRING_H_INCLUDED
+#include <string.h>
+#endif
+
+#ifndef STDINT_H_INCLUDED
+#define STDINT_H_INCLUDED
+#include <stdint.h>
+#endif
+
+#ifndef MATH_H_INCLUDED
+#define MATH_H_INCLUDED
+#include <math.h>
+#endif
+
+#ifdef USE_STANDARD_NON_AEX_GL_HEADERS
+#ifndef GLES2_GL2_H_INCLUDED
+#define GLES2_GL2_H_INCLUDED
+#include <GLES2/gl2.h>
+#endif
+#else
+#include "gl_es2_impl.h"
+
+#ifndef GLES2_GL2_H_INCLUDED
+#define GLES2_GL2_H_INCLUDED
+#define GL_GLES_PROTOTYPES 0  /* we will define the prototypes as static function pointers by including gl_es2_aex_func_map.c */
+#include <GLES2/gl2.h>
+#endif
+#include "gl_es2_aex_func_map.c"
+#endif
+
+#ifndef GL_ES2_CONTEXT_H_INCLUDED
+#define GL_ES2_CONTEXT_H_INCLUDED
+#include "gl_es2_context.h"
+#endif
+
+#ifndef SL_EXECUTION_H_INCLUDED
+#define SL_EXECUTION_H_INCLUDED
+#include "sl_execution.h"
+#endif
+
+/* Number of rows per batch (fewer if the execution holds fewer), and the number of distinct batches of input */
+#define EXECTEST1_NUM_ROWS 64
+#define EXECTEST1_NUM_BATCHES 8
+
+/* Row outcome, see exectest1_run_batch() */
+#define EXECTEST1_ROW_NOT_RUN 0
+#define EXECTEST1_ROW_SURVIVED 1
+#define EXECTEST1_ROW_DISCARDED 2
+
+/* The environment every case is checked against */
+#define EXECTEST1_REFERENCE_ENV "AEX_SL_EXEC=ast"
+
+int print_shader_log(FILE *fp, GLuint shader);
+int print_program_log(FILE *fp, GLuint program);
+int tester_apply_env(const char *settings, int undo);
+
+struct exectest1_uniform {
+  const char *name_;
+
+  /* GL_FLOAT, GL_INT, GL_FLOAT_VEC2/3/4 or GL_FLOAT_MAT2/3/4; selects the glUniformXXX call that sets values_ */
+  GLenum type_;
+  float values_[16];
+};
+
+struct exectest1_case {
+  const char *name_;
+
+  /* Fragment shader, reads "varying vec4 v" and writes gl_FragColor, may discard */
+  const char *fsrc_;
+
+  /* Environments to run the case in, each a space separated list of "NAME=value" settings (see tester_apply_env());
+   * every one must give the same gl_FragColor and discards as EXECTEST1_REFERENCE_ENV. */
+  const char *envs_[8];
+
+  struct exectest1_uniform uniforms_[4];
+
+  /* Non-zero if rows must be compacted (see AEX_SL_COMPACT_DENSITY) in at least one of the environments */
+  int compacts_;
+} exectest1_cases[] = {
+  /* Integer division by a constant 0 or -1 is not folded; the branch holding the divisions that would fault is
+   * never taken, the fold would fault in the compiler. */
+  { "div_i fold",
+    "precision highp float;\n"
+    "varying vec4 v;\n"
+    "void main() {\n"
+    "  int a = int(v.x * 16.0) - 8;\n"
+    "  int r = 0;\n"
+    "  if (v.y > 2.0) {\n"
+    "    int zero = 0;\n"
+    "    int minus_one = -1;\n"
+    "    int most_negative = -2147483647 - 1;\n"
+    "    r = 7 / zero + most_negative / minus_one;\n"
+    "  }\n"
+    "  else {\n"
+    "    int minus_one = -1;\n"
+    "    int three = 3;\n"
+    "    int seven = 7;\n"
+    "    r = a / minus_one + seven / minus_one + seven / three + (-seven) / three;\n"
+    "  }\n"
+    "  gl_FragColor = vec4(float(r), float(a / -1), v.z, v.w);\n"
+    "}\n",
+    { "AEX_SL_EXEC=bytecode AEX_SL_OPT=constprop", "AEX_SL_EXEC=bytecode AEX_SL_OPT=all" }
+  },
+  /* Values known before a chain split are redefined on some of its rows; what is known of them must not survive the
+   * join, nor leak from one side of the split into the other. */
+  { "facts across split and join",
+    "precision highp float;\n"
+    "varying vec4 v;\n"
+    "void main() {\n"
+    "  vec4 c = v;\n"
+    "  float k = 0.25;\n"
+    "  float p = c.x * c.y;\n"
+    "  float t = c.y;\n"
+    "  float d = 0.5;\n"
+    "  if (c.z > 0.5) {\n"
+    "    k = 0.75;\n"
+    "    c.x = c.w;\n"
+    "    t = c.z;\n"
+    "    d = c.x + 1.0;\n"
+    "  }\n"
+    "  else {\n"
+    "    float q = c.x * c.y;\n"
+    "    c.y = q + k;\n"
+    "  }\n"
+    "  float p2 = c.x * c.y;\n"
+    "  gl_FragColor = vec4(k + p, p2, t + d, k * t);\n"
+    "}\n",
+    { "AEX_SL_EXEC=bytecode AEX_SL_OPT=constprop", "AEX_SL_EXEC=bytecode AEX_SL_OPT=cse",
+      "AEX_SL_EXEC=bytecode AEX_SL_OPT=copyprop", "AEX_SL_EXEC=bytecode AEX_SL_OPT=dse",
+      "AEX_SL_EXEC=bytecode AEX_SL_OPT=all" }
+  },
+  /* The same, with rows discarded in one branch, and a loop whose body redefines what was known before it. */
+  { "facts across discard and loop",
+    "precision highp float;\n"
+    "varying vec4 v;\n"
+    "void main() {\n"
+    "  float s = 1.0;\n"
+    "  float m = v.x + v.y;\n"
+    "  if (v.w < 0.125) {\n"
+    "    s = 2.0;\n"
+    "    discard;\n"
+    "  }\n"
+    "  for (int i = 0; i < 3; ++i) {\n"
+    "    if (m > 0.5 + float(i) * 0.25) {\n"
+    "      m = m * 0.5;\n"
+    "      s = s + 1.0;\n"
+    "    }\n"
+    "  }\n"
+    "  float m2 = v.x + v.y;\n"
+    "  gl_FragColor = vec4(s, m, m2, s * m2);\n"
+    "}\n",
+    { "AEX_SL_EXEC=bytecode AEX_SL_OPT=constprop", "AEX_SL_EXEC=bytecode AEX_SL_OPT=cse",
+      "AEX_SL_EXEC=bytecode AEX_SL_OPT=copyprop", "AEX_SL_EXEC=bytecode AEX_SL_OPT=dse",
+      "AEX_SL_EXEC=bytecode AEX_SL_OPT=all" }
+  },
+  /* A value defined before a branch is read after the join, while both sides of the branch compute temporaries of
+   * their own; register allocation must not hand its register to any of them. Checked on bytecode and on the
+   * default JIT. */
+  { "regalloc live across branch",
+    "precision highp float;\n"
+    "varying vec4 v;\n"
+    "void main() {\n"
+    "  float keep = v.x * 3.0 + v.y;\n"
+    "  vec4 keep4 = v.wzyx * 0.5;\n"
+    "  vec4 r;\n"
+    "  if (v.z > 0.4) {\n"
+    "    float a = v.y * v.w + 1.0;\n"
+    "    float b = a * a - v.x;\n"
+    "    vec3 t = vec3(a, b, a + b) * v.yzw;\n"
+    "    r = vec4(t, b * 0.25);\n"
+    "  }\n"
+    "  else {\n"
+    "    vec4 a = v * v + vec4(2.0);\n"
+    "    vec4 b = a.yzwx - v;\n"
+    "    r = a * b + vec4(a.x);\n"
+    "  }\n"
+    "  gl_FragColor = r + vec4(keep) + keep4;\n"
+    "}\n",
+    { "AEX_SL_EXEC=bytecode AEX_SL_OPT=regalloc", "AEX_SL_EXEC=bytecode AEX_SL_OPT=all",
+      "AEX_SL_OPT=regalloc" }
+  },
+  /* Matrix products of every size, mat * vec, vec * mat and mat * mat, with both operands varying, and with the
+   * left or the right operand a uniform (the bytecode's SLBC_XXX_MUL_XXX_SC and _CS variants), on rows taking
+   * either side of a branch so they run over chains and, with AEX_SL_PREDICATION=masks, under masks. */
+  { "mat2 products",
+    "precision highp float;\n"
+    "varying vec4 v;\n"
+    "uniform mat2 um;\n"
+    "uniform vec4 uv;\n"
+    "void main() {\n"
+    "  mat2 m = mat2(v.x, v.y - 0.5, v.z, v.w + 0.25);\n"
+    "  vec2 a = m * v.zw + v.xy * m;\n"
+    "  mat2 p = m * m;\n"
+    "  vec2 b = vec2(0.0);\n"
+    "  mat2 q = mat2(0.0);\n"
+    "  if (v.z > 0.5) {\n"
+    "    b = um * v.xy + v.zw * um + uv.xy * m;\n"
+    "    q = um * m;\n"
+    "  }\n"
+    "  else {\n"
+    "    b = m * uv.zw;\n"
+    "    q = m * um;\n"
+    "  }\n"
+    "  gl_FragColor = vec4(a + b, p[0] + q[1] * 0.5 + p[1] * 0.25 + q[0] * 0.125);\n"
+    "}\n",
+    { "AEX_SL_EXEC=bytecode", "AEX_SL_EXEC=bytecode AEX_SL_OPT=none", "AEX_SL_EXEC=bytecode AEX_SL_PREDICATION=masks",
+      "AEX_SL_EXEC=bytecode AEX_SL_PREDICATION=chains", "AEX_SL_PREDICATION=masks" },
+    { { "um", GL_FLOAT_MAT2, { 1.5f, -0.5f, 0.25f, 2.f } }, { "uv", GL_FLOAT_VEC4, { 0.75f, -1.25f, 2.5f, 0.125f } } }
+  },
+  { "mat3 products",
+    "precision highp float;\n"
+    "varying vec4 v;\n"
+    "uniform mat3 um;\n"
+    "uniform vec4 uv;\n"
+    "void main() {\n"
+    "  mat3 m = mat3(v.xyz, v.yzw - vec3(0.5), v.zwx * 2.0);\n"
+    "  vec3 a = m * v.xyz + v.yzw * m;\n"
+    "  mat3 p = m * m;\n"
+    "  vec3 b = vec3(0.0);\n"
+    "  mat3 q = mat3(0.0);\n"
+    "  if (v.z > 0.5) {\n"
+    "    b = um * v.xyz + v.wzy * um + uv.xyz * m;\n"
+    "    q = um * m;\n"
+    "  }\n"
+    "  else {\n"
+    "    b = m * uv.yzw;\n"
+    "    q = m * um;\n"
+    "  }\n"
+    "  vec3 s = p[0] + q[1] * 0.5 + p[1] * 0.25 + q[0] * 0.125 + p[2] * 0.0625 + q[2] * 0.03125;\n"
+    "  gl_FragColor = vec4(a + b, s.x + s.y * 0.5 + s.z * 0.25);\n"
+    "}\n",
+    { "AEX_SL_EXEC=bytecode", "AEX_SL_EXEC=bytecode AEX_SL_OPT=none", "AEX_SL_EXEC=bytecode AEX_SL_PREDICATION=masks",
+      "AEX_SL_EXEC=bytecode AEX_SL_PREDICATION=chains", "AEX_SL_PREDICATION=masks" },
+    { { "um", GL_FLOAT_MAT3, { 1.5f, -0.5f, 0.25f, 2.f, 0.75f, -1.f, 0.5f, 3.f, -2.25f } },
+      { "uv", GL_FLOAT_VEC4, { 0.75f, -1.25f, 2.5f, 0.125f } } }
+  },
+  { "mat4 products",
+    "precision highp float;\n"
+    "varying vec4 v;\n"
+    "uniform mat4 um;\n"
+    "uniform vec4 uv;\n"
+    "void main() {\n"
+    "  mat4 m = mat4(v, v.yzwx - vec4(0.5), v.zwxy * 2.0, v.wxyz + vec4(0.25));\n"
+    "  vec4 a = m * v + v.wzyx * m;\n"
+    "  mat4 p = m * m;\n"
+    "  vec4 b = vec4(0.0);\n"
+    "  mat4 q = mat4(0.0);\n"
+    "  if (v.z > 0.5) {\n"
+    "    b = um * v + v.yxwz * um + uv * m;\n"
+    "    q = um * m;\n"
+    "  }\n"
+    "  else {\n"
+    "    b = m * uv;\n"
+    "    q = m * um;\n"
+    "  }\n"
+    "  gl_FragColor = a + b + p[0] + q[1] * 0.5 + p[1] * 0.25 + q[0] * 0.125 + p[2] * 0.0625 + q[2] * 0.03125 +\n"
+    "                 p[3] * 0.015625 + q[3] * 0.0078125;\n"
+    "}\n",
+    { "AEX_SL_EXEC=bytecode", "AEX_SL_EXEC=bytecode AEX_SL_OPT=none", "AEX_SL_EXEC=bytecode AEX_SL_PREDICATION=masks",
+      "AEX_SL_EXEC=bytecode AEX_SL_PREDICATION=chains", "AEX_SL_PREDICATION=masks" },
+    { { "um", GL_FLOAT_MAT4, { 1.5f, -0.5f, 0.25f, 2.f, 0.75f, -1.f, 0.5f, 3.f, -2.25f, 1.f, 0.125f, -0.75f, 2.f, 0.f, -1.5f, 0.5f } },
+      { "uv", GL_FLOAT_VEC4, { 0.75f, -1.25f, 2.5f, 0.125f } } }
+  },
+  /* Row compaction: about 5 in 17 rows, scattered, take the branch, whose kernels mix columns with uniforms read as
+   * scalars (the bytecode's SLBC_XXX_F_CS/_SC); registers written in the branch are read after the join, along with
+   * registers it only reads. */
+  { "compaction of a sparse branch",
+    "precision highp float;\n"
+    "varying vec4 v;\n"
+    "uniform float uk;\n"
+    "uniform float ub;\n"
+    "uniform int un;\n"
+    "void main() {\n"
+    "  float a = v.y * 2.0 + v.z;\n"
+    "  float b = v.w - 0.5;\n"
+    "  float c = 0.0;\n"
+    "  int i = int(v.w * 8.0);\n"
+    "  if (v.x > 0.7) {\n"
+    "    a = a * uk + v.z;\n"
+    "    b = (ub - b) * a;\n"
+    "    c = uk / (a + 2.0) - b / ub;\n"
+    "    a = a - uk * ub;\n"
+    "    i = i * un + 3;\n"
+    "    c = c * (v.y - ub) + float(i);\n"
+    "  }\n"
+    "  if (v.y < 0.25) {\n"
+    "    b = b + a * uk;\n"
+    "    c = c - (b - ub) / uk;\n"
+    "    a = (a + ub) * (b - uk);\n"
+    "    i = i - un;\n"
+    "  }\n"
+    "  gl_FragColor = vec4(a, b, c, float(i) + v.x);\n"
+    "}\n",
+    { "AEX_SL_EXEC=bytecode AEX_SL_COMPACT_DENSITY=100", "AEX_SL_EXEC=bytecode AEX_SL_COMPACT_DENSITY=100 AEX_SL_SPECIALIZE=none",
+      "AEX_SL_EXEC=bytecode AEX_SL_COMPACT_DENSITY=100 AEX_SL_PREDICATION=masks",
+      "AEX_SL_EXEC=bytecode AEX_SL_COMPACT_DENSITY=100 AEX_SL_PREDICATION=chains",
+      "AEX_SL_EXEC=bytecode AEX_SL_COMPACT_DENSITY=100 AEX_SL_OPT=none", "AEX_SL_EXEC=bytecode AEX_SL_COMPACT_DENSITY=0",
+      "AEX_SL_EXEC=bytecode" },
+    { { "uk", GL_FLOAT, { 1.5f } }, { "ub", GL_FLOAT, { -0.75f } }, { "un", GL_INT, { 3.f } } },
+    1
+  },
+};
+
+struct exectest1_results {
+  size_t num_rows_;
+
+  /* Number of times rows were compacted over all batches, see sl_program_take_compaction_stats() */
+  uint64_t num_compactions_;
+
+  /* EXECTEST1_NUM_BATCHES of 4 columns of num_rows_ gl_FragColor (zero for rows that did not survive), and
+   * EXECTEST1_NUM_BATCHES of num_rows_ EXECTEST1_ROW_XXX outcomes */
+  float colors_[EXECTEST1_NUM_BATCHES * 4 * EXECTEST1_NUM_ROWS];
+  uint8_t outcomes_[EXECTEST1_NUM_BATCHES * EXECTEST1_NUM_ROWS];
+};
+
+/* Runs batch number batch of num_rows rows on exec, storing gl_FragColor and the row outcomes (see exectest1_results) */
+static int exectest1_run_batch(struct sl_execution *exec, struct sl_function *fmain, const int *v_regs, const int *frag_color_regs,
+                               size_t num_rows, size_t batch, float *colors, uint8_t *outcomes) {
+  size_t row, n;
+  uint32_t chain;
+  sl_exec_row_t delta;
+
+  for (n = 0; n < 4; ++n) {
+    float *column = exec->float_regs_[v_regs[n]];
+    for (row = 0; row < num_rows; ++row) {
+      column[row] = (float)((row * (n + 3) + batch * 7) % 17) / 16.f;
+    }
+  }
+  for (row = 0; row < (num_rows - 1); ++row) {
+    exec->exec_chain_reg_[row] = 1;
+  }
+  exec->exec_chain_reg_[num_rows - 1] = 0;
+
+  if (sl_exec_run(exec, fmain, 0)) return -1;
+
+  memset(colors, 0, sizeof(float) * 4 * num_rows);
+  memset(outcomes, EXECTEST1_ROW_NOT_RUN, num_rows);
+  chain = exec->execution_points_[0].post_chain_;
+  if (chain != SL_EXEC_NO_CHAIN) {
+    row = (size_t)chain;
+    do {
+      outcomes[row] = EXECTEST1_ROW_SURVIVED;
+      for (n = 0; n < 4; ++n) {
+        colors[n * num_rows + row] = exec->float_regs_[frag_color_regs[n]][row];
+      }
+      delta = exec->exec_chain_reg_[row];
+      row += delta;
+    } while (delta);
+  }
+  chain = exec->execution_points_[0].alt_chain_;
+  if (chain != SL_EXEC_NO_CHAIN) {
+    row = (size_t)chain;
+    do {
+      outcomes[row] = EXECTEST1_ROW_DISCARDED;
+      delta = exec->exec_chain_reg_[row];
+      row += delta;
+    } while (delta);
+  }
+  return 0;
+}
+
+static GLuint exectest1_compile(GLenum type, const char *src) {
+  GLuint shader = glCreateShader(type);
+  GLint src_len = (GLint)strlen(src);
+  GLint compile_status = GL_FALSE;
+  glShaderSource(shader, 1, &src, &src_len);
+  glCompileShader(shader);
+  glGetShaderiv(shader, GL_COMPILE_STATUS, &compile_status);
+  if (compile_status == GL_FALSE) {
+    fprintf(stderr, "Failed to compile shader. Diagnostics:\n");
+    print_shader_log(stderr, shader);
+  }
+  return shader;
+}
+
+static void exectest1_set_uniforms(GLuint program, const struct exectest1_case *ec) {
+  size_t n;
+  for (n = 0; n < sizeof(ec->uniforms_) / sizeof(*ec->uniforms_); ++n) {
+    const struct exectest1_uniform *u = ec->uniforms_ + n;
+    GLint location;
+    if (!u->name_) break;
+    location = glGetUniformLocation(program, u->name_);
+    switch (u->type_) {
+      case GL_FLOAT: glUniform1f(location, u->values_[0]); break;
+      case GL_INT: glUniform1i(location, (GLint)u->values_[0]); break;
+      case GL_FLOAT_VEC2: glUniform2fv(location, 1, u->values_); break;
+      case GL_FLOAT_VEC3: glUniform3fv(location, 1, u->values_); break;
+      case GL_FLOAT_VEC4: glUniform4fv(location, 1, u->values_); break;
+      case GL_FLOAT_MAT2: glUniformMatrix2fv(location, 1, GL_FALSE, u->values_); break;
+      case GL_FLOAT_MAT3: glUniformMatrix3fv(location, 1, GL_FALSE, u->values_); break;
+      case GL_FLOAT_MAT4: glUniformMatrix4fv(location, 1, GL_FALSE, u->values_); break;
+    }
+  }
+}
+
+/* Builds the case's program in the environment env, and runs its fragment shader directly (bypassing rasterization)
+ * over all batches, storing the results in er. */
+static int exectest1_run(const struct exectest1_case *ec, const char *env, struct exectest1_results *er) {
+  int r = -1;
+  size_t n;
+  GLuint vertex_shader = 0, fragment_shader = 0, program = 0;
+  GLint link_status = GL_FALSE;
+  int v_regs[4], frag_color_regs[4];
+  struct sl_exec_compaction_stats compaction_stats;
+  const char *vsrc =
+    "attribute vec4 vgl_Position;\n"
+    "attribute vec4 v_color;\n"
+    "varying vec4 v;\n"
+    "void main() {\n"
+    "  v = v_color;\n"
+    "  gl_Position = vgl_Position;\n"
+    "}\n";
+
+  if (tester_apply_env(env, 0)) {
+    fprintf(stderr, "exectest1: cannot set environment \"%s\"\n", env);
+    goto test_exit;
+  }
+
+  vertex_shader = exectest1_compile(GL_VERTEX_SHADER, vsrc);
+  fragment_shader = exectest1_compile(GL_FRAGMENT_SHADER, ec->fsrc_);
+  program = glCreateProgram();
+  glAttachShader(program, vertex_shader);
+  glAttachShader(program, fragment_shader);
+  glLinkProgram(program);
+  glGetProgramiv(program, GL_LINK_STATUS, &link_status);
+  if (link_status == GL_FALSE) {
+    fprintf(stderr, "Failed to link program. Diagnostics:\n");
+    print_program_log(stderr, program);
+    goto test_exit;
+  }
+  glUseProgram(program);
+  exectest1_set_uniforms(program, ec);
+
+  struct gl_es2_context *c = gl_es2_ctx_dont_lock();
+  struct gl_es2_program *prog = (struct gl_es2_program *)not_find(&c->program_not_, (uintptr_t)program);
+  if (!prog) {
+    goto test_exit;
+  }
+  gl_es2_ctx_prepare_program_for_execution(c, prog);
+
+  struct sl_shader *fs = &prog->fragment_shader_.shader_->shader_;
+  struct sl_execution *exec = &fs->exec_;
+  struct sl_variable *v = sl_compilation_unit_find_variable(&fs->cu_, "v");
+  struct sl_variable *frag_color = sl_compilation_unit_find_variable(&fs->cu_, "gl_FragColor");
+  struct sl_function *fmain = sl_compilation_unit_find_function(&fs->cu_, "main");
+  if (!fmain || !v || !frag_color || !exec->max_num_rows_) {
+    goto test_exit;
+  }
+  for (n = 0; n < 4; ++n) {
+    v_regs[n] = v->reg_alloc_.v_.regs_[n];
+    frag_color_regs[n] = frag_color->reg_alloc_.v_.regs_[n];
+  }
+  er->num_rows_ = (exec->max_num_rows_ < EXECTEST1_NUM_ROWS) ? exec->max_num_rows_ : EXECTEST1_NUM_ROWS;
+  sl_program_take_compaction_stats(&prog->program_, &compaction_stats);
+  for (n = 0; n < EXECTEST1_NUM_BATCHES; ++n) {
+    if (exectest1_run_batch(exec, fmain, v_regs, frag_color_regs, er->num_rows_, n,
+                            er->colors_ + n * 4 * er->num_rows_, er->outcomes_ + n * er->num_rows_)) {
+      fprintf(stderr, "exectest1: \"%s\" failed to run with %s\n", ec->name_, env);
+      goto test_exit;
+    }
+  }
+  sl_program_take_compaction_stats(&prog->program_, &compaction_stats);
+  er->num_compactions_ = compaction_stats.compactions_;
+
+  r = 0;
+test_exit:
+  glUseProgram(0);
+  if (program) glDeleteProgram(program);
+  if (fragment_shader) glDeleteShader(fragment_shader);
+  if (vertex_shader) glDeleteShader(vertex_shader);
+  tester_apply_env(env, 1);
+  return r;
+}
+
+static int exectest1_same_float(float a, float b) {
+  if (isnan(a) || isnan(b)) return isnan(a) && isnan(b);
+  return fabsf(a - b) <= (1e-6f + 1e-5f * fabsf(b));
+}
+
+/* Returns the number of rows on which er differs from expected, printing the first */
+static size_t exectest1_compare(const struct exectest1_case *ec, const char *env, const struct exectest1_results *expected, const struct exectest1_results *er) {
+  size_t num_mismatches = 0;
+  size_t batch, row, n;
+  if (er->num_rows_ != expected->num_rows_) {
+    fprintf(stderr, "exectest1: \"%s\" ran %zu rows with %s, %zu with " EXECTEST1_REFERENCE_ENV "\n",
+            ec->name_, er->num_rows_, env, expected->num_rows_);
+    return 1;
+  }
+  for (batch = 0; batch < EXECTEST1_NUM_BATCHES; ++batch) {
+    const float *colors = er->colors_ + batch * 4 * er->num_rows_;
+    const float *expected_colors = expected->colors_ + batch * 4 * er->num_rows_;
+    const uint8_t *outcomes = er->outcomes_ + batch * er->num_rows_;
+    const uint8_t *expected_outcomes = expected->outcomes_ + batch * er->num_rows_;
+    for (row = 0; row < er->num_rows_; ++row) {
+      int same = outcomes[row] == expected_outcomes[row];
+      for (n = 0; same && (n < 4); ++n) {
+        same = exectest1_same_float(colors[n * er->num_rows_ + row], expected_colors[n * er->num_rows_ + row]);
+      }
+      if (!same) {
+        if (!num_mismatches) {
+          fprintf(stderr, "exectest1: \"%s\" with %s, batch %zu row %zu: outcome %d vec4(%f, %f, %f, %f), expected %d vec4(%f, %f, %f, %f)\n",
+                  ec->name_, env, batch, row,
+                  outcomes[row], colors[row], colors[er->num_rows_ + row], colors[2 * er->num_rows_ + row], colors[3 * er->num_rows_ + row],
+                  expected_outcomes[row], expected_colors[row], expected_colors[er->num_rows_ + row],
+                  expected_colors[2 * er->num_rows_ + row], expected_colors[3 * er->num_rows_ + row]);
+        }
+        num_mismatches++;
+      }
+    }
+  }
+  return num_mismatches;
+}
+
+/* Runs the fragment shader of each case directly in each of its environments, and checks its gl_FragColor and
+ * discards against the AST walker's (see EXECTEST1_REFERENCE_ENV), so each optimization pass, and each way of
+ * executing, can be tested in isolation on inputs that take both sides of every branch. */
+int exectest1(void) {
+  int r = -1;
+  size_t n, k;
+  size_t num_runs = 0, num_mismatches = 0;
+  struct exectest1_results *expected = (struct exectest1_results *)malloc(sizeof(struct exectest1_results));
+  struct exectest1_results *er = (struct exectest1_results *)malloc(sizeof(struct exectest1_results));
+  if (!expected || !er) {
+    goto test_exit;
+  }
+
+  for (n = 0; n < sizeof(exectest1_cases) / sizeof(*exectest1_cases); ++n) {
+    const struct exectest1_case *ec = exectest1_cases + n;
+    uint64_t num_compactions = 0;
+    if (exectest1_run(ec, EXECTEST1_REFERENCE_ENV, expected)) {
+      goto test_exit;
+    }
+    for (k = 0; k < sizeof(ec->envs_) / sizeof(*ec->envs_); ++k) {
+      if (!ec->envs_[k]) break;
+      if (exectest1_run(ec, ec->envs_[k], er)) {
+        goto test_exit;
+      }
+      num_mismatches += exectest1_compare(ec, ec->envs_[k], expected, er);
+      num_compactions += er->num_compactions_;
+      num_runs++;
+    }
+    if (ec->compacts_ && !num_compactions) {
+      /* Passing would not mean much */
+      fprintf(stderr, "exectest1: \"%s\" never compacted rows\n", ec->name_);
+      goto test_exit;
+    }
+  }
+  fprintf(stdout, "exectest1: %zu runs of %d batches, %zu mismatches\n", num_runs, EXECTEST1_NUM_BATCHES, num_mismatches);
+  if (num_mismatches) {
+    goto test_exit;
+  }
+
+  r = 0;
+test_exit:
+  if (expected) free(expected);
+  if (er) free(er);
+  return r;
+}
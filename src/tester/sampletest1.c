@@ -0,0 +1,354 @@
+/* Copyright 2024 Kinglet B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STDLIB_H_INCLUDED
+#define STDLIB_H_INCLUDED
+#include <stdlib.h>
+#endif
+
+#ifndef STDIO_H_INCLUDED
+#define STDIO_H_INCLUDED
+#include <stdio.h>
+#endif
+
+#ifndef STRING_H_INCLUDED
+#define STRING_H_INCLUDED
+#include <string.h>
+#endif
+
+#ifndef STDINT_H_INCLUDED
+#define STDINT_H_INCLUDED
+#include <stdint.h>
+#endif
+
+#ifndef MATH_H_INCLUDED
+#define MATH_H_INCLUDED
+#include <math.h>
+#endif
+
+#ifdef USE_STANDARD_NON_AEX_GL_HEADERS
+#ifndef GLES2_GL2_H_INCLUDED
+#define GLES2_GL2_H_INCLUDED
+#include <GLES2/gl2.h>
+#endif
+#else
+#include "gl_es2_impl.h"
+
+#ifndef GLES2_GL2_H_INCLUDED
+#define GLES2_GL2_H_INCLUDED
+#define GL_GLES_PROTOTYPES 0  /* we will define the prototypes as static function pointers by including gl_es2_aex_func_map.c */
+#include <GLES2/gl2.h>
+#endif
+#include "gl_es2_aex_func_map.c"
+#endif
+
+#ifndef GL_ES2_CONTEXT_H_INCLUDED
+#define GL_ES2_CONTEXT_H_INCLUDED
+#include "gl_es2_context.h"
+#endif
+
+#ifndef SL_EXECUTION_H_INCLUDED
+#define SL_EXECUTION_H_INCLUDED
+#include "sl_execution.h"
+#endif
+
+#ifndef SL_SIMD_H_INCLUDED
+#define SL_SIMD_H_INCLUDED
+#include "sl_simd.h"
+#endif
+
+/* Number of rows per batch (fewer if the execution holds fewer), and the number of distinct batches of input */
+#define SAMPLETEST1_NUM_ROWS 64
+#define SAMPLETEST1_NUM_BATCHES 8
+
+/* Size of the texture; not square, so a lane mixing up width and height shows */
+#define SAMPLETEST1_WIDTH 16
+#define SAMPLETEST1_HEIGHT 8
+
+int print_shader_log(FILE *fp, GLuint shader);
+int print_program_log(FILE *fp, GLuint program);
+
+/* The lod is passed in directly so each group of 8 rows can be made to all magnify or all minify, which is what
+ * texture2D_8() in sampler_2d.c needs to sample them together. */
+static const char *sampletest1_fsrc_ =
+  "precision highp float;\n"
+  "uniform sampler2D tex;\n"
+  "varying vec4 v;\n"
+  "void main() {\n"
+  "  gl_FragColor = texture2DLod(tex, v.xy, v.z);\n"
+  "}\n";
+
+/* Texture coordinates on and around the edges of the texture and of its texels, and far outside it for the
+ * wrap modes */
+static const float sampletest1_coords_[] = {
+  0.f, 1.f, -0.f, 0.5f, 0.5f / SAMPLETEST1_HEIGHT, 1.f - 0.5f / SAMPLETEST1_HEIGHT, 0.5f / SAMPLETEST1_WIDTH,
+  1.f - 0.5f / SAMPLETEST1_WIDTH, 1.f / SAMPLETEST1_WIDTH, 3.f / SAMPLETEST1_HEIGHT, 0.999999f, 1e-7f, -1e-7f,
+  -0.25f, -1.f, 1.25f, 2.f, -3.75f, 0.3f, 0.71f, 1000.3f, -1000.3f
+};
+
+/* Levels of detail that magnify (at most 0) and that minify (above the 0.5 texture2D() takes as c when the
+ * magnification filter is GL_LINEAR), including past the last mipmap */
+static const float sampletest1_magnify_lods_[] = { 0.f, -0.f, -0.25f, -1.f, -3.5f, -100.f };
+static const float sampletest1_minify_lods_[] = { 0.75f, 1.f, 1.3f, 1.5f, 2.f, 2.99f, 3.5f, 4.f, 7.25f, 100.f };
+
+static const GLenum sampletest1_formats_[] = { GL_RGBA, GL_RGB, GL_LUMINANCE_ALPHA, GL_LUMINANCE, GL_ALPHA };
+static const char *sampletest1_format_names_[] = { "RGBA", "RGB", "LUMINANCE_ALPHA", "LUMINANCE", "ALPHA" };
+static const int sampletest1_format_sizes_[] = { 4, 3, 2, 1, 1 };
+
+/* The first 2 need no mipmaps */
+static const GLenum sampletest1_min_filters_[] = {
+  GL_NEAREST, GL_LINEAR, GL_NEAREST_MIPMAP_NEAREST, GL_LINEAR_MIPMAP_NEAREST, GL_NEAREST_MIPMAP_LINEAR, GL_LINEAR_MIPMAP_LINEAR
+};
+static const char *sampletest1_min_filter_names_[] = {
+  "NEAREST", "LINEAR", "NEAREST_MIPMAP_NEAREST", "LINEAR_MIPMAP_NEAREST", "NEAREST_MIPMAP_LINEAR", "LINEAR_MIPMAP_LINEAR"
+};
+
+static const GLenum sampletest1_wraps_[] = { GL_REPEAT, GL_CLAMP_TO_EDGE, GL_MIRRORED_REPEAT };
+static const char *sampletest1_wrap_names_[] = { "REPEAT", "CLAMP_TO_EDGE", "MIRRORED_REPEAT" };
+
+#define SAMPLETEST1_COUNT(a) (sizeof(a) / sizeof(*(a)))
+
+struct sampletest1_config {
+  size_t format_, min_filter_, mag_filter_, wrap_s_, wrap_t_;
+  int mipmapped_;
+};
+
+static void sampletest1_print_config(FILE *fp, const struct sampletest1_config *cfg) {
+  fprintf(fp, "%s%s, min %s, mag %s, wrap %s %s", sampletest1_format_names_[cfg->format_], cfg->mipmapped_ ? " mipmapped" : "",
+          sampletest1_min_filter_names_[cfg->min_filter_], cfg->mag_filter_ ? "LINEAR" : "NEAREST",
+          sampletest1_wrap_names_[cfg->wrap_s_], sampletest1_wrap_names_[cfg->wrap_t_]);
+}
+
+/* Creates the texture for cfg, bound to texture unit 0; the texels are pseudo random so every one differs from its
+ * neighbours. */
+static GLuint sampletest1_create_texture(const struct sampletest1_config *cfg) {
+  uint8_t texels[SAMPLETEST1_WIDTH * SAMPLETEST1_HEIGHT * 4];
+  uint32_t seed = 12345;
+  size_t n;
+  GLuint tex = 0;
+  for (n = 0; n < sizeof(texels); ++n) {
+    seed = seed * 1664525u + 1013904223u;
+    texels[n] = (uint8_t)(seed >> 24);
+  }
+  glGenTextures(1, &tex);
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D, tex);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  glTexImage2D(GL_TEXTURE_2D, 0, sampletest1_formats_[cfg->format_], SAMPLETEST1_WIDTH, SAMPLETEST1_HEIGHT, 0,
+               sampletest1_formats_[cfg->format_], GL_UNSIGNED_BYTE, texels);
+  if (cfg->mipmapped_) glGenerateMipmap(GL_TEXTURE_2D);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, sampletest1_min_filters_[cfg->min_filter_]);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, cfg->mag_filter_ ? GL_LINEAR : GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, sampletest1_wraps_[cfg->wrap_s_]);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, sampletest1_wraps_[cfg->wrap_t_]);
+  return tex;
+}
+
+/* Runs the shader over the rows of batch, either all in one chain, so the aligned runs of 8 rows are sampled together
+ * by texture2D_8(), or one row per chain, so each is sampled by texture2D(), and stores the colors in colors[4][num_rows].
+ * Groups of 8 rows alternate between magnifying and minifying, the last group mixes both. */
+static int sampletest1_run_batch(struct sl_execution *exec, struct sl_function *fmain, const int *v_regs, const int *frag_color_regs,
+                                 size_t num_rows, size_t batch, int single_rows, float *colors) {
+  size_t row, n;
+  float *s_column = exec->float_regs_[v_regs[0]];
+  float *t_column = exec->float_regs_[v_regs[1]];
+  float *lod_column = exec->float_regs_[v_regs[2]];
+  float *w_column = exec->float_regs_[v_regs[3]];
+
+  for (row = 0; row < num_rows; ++row) {
+    size_t group = row / 8;
+    int minify = (int)((group + batch) & 1);
+    if (((group + 1) * 8) >= num_rows) minify = (int)(row & 1);
+    s_column[row] = sampletest1_coords_[(row * 3 + batch) % SAMPLETEST1_COUNT(sampletest1_coords_)];
+    t_column[row] = sampletest1_coords_[(row * 5 + batch * 2 + 1) % SAMPLETEST1_COUNT(sampletest1_coords_)];
+    lod_column[row] = minify ? sampletest1_minify_lods_[(row + batch) % SAMPLETEST1_COUNT(sampletest1_minify_lods_)]
+                             : sampletest1_magnify_lods_[(row + batch) % SAMPLETEST1_COUNT(sampletest1_magnify_lods_)];
+    w_column[row] = 1.f;
+  }
+
+  if (single_rows) {
+    for (row = 0; row < num_rows; ++row) {
+      exec->exec_chain_reg_[row] = 0;
+      if (sl_exec_run(exec, fmain, (int)row)) return -1;
+      for (n = 0; n < 4; ++n) {
+        colors[n * num_rows + row] = exec->float_regs_[frag_color_regs[n]][row];
+      }
+    }
+    return 0;
+  }
+
+  for (row = 0; row < (num_rows - 1); ++row) {
+    exec->exec_chain_reg_[row] = 1;
+  }
+  exec->exec_chain_reg_[num_rows - 1] = 0;
+  if (sl_exec_run(exec, fmain, 0)) return -1;
+  for (n = 0; n < 4; ++n) {
+    memcpy(colors + n * num_rows, exec->float_regs_[frag_color_regs[n]], sizeof(float) * num_rows);
+  }
+  return 0;
+}
+
+static GLuint sampletest1_compile(GLenum type, const char *src) {
+  GLuint shader = glCreateShader(type);
+  GLint src_len = (GLint)strlen(src);
+  GLint compile_status = GL_FALSE;
+  glShaderSource(shader, 1, &src, &src_len);
+  glCompileShader(shader);
+  glGetShaderiv(shader, GL_COMPILE_STATUS, &compile_status);
+  if (compile_status == GL_FALSE) {
+    fprintf(stderr, "Failed to compile shader. Diagnostics:\n");
+    print_shader_log(stderr, shader);
+  }
+  return shader;
+}
+
+/* Returns the number of rows that differ between colors and expected, printing the first */
+static size_t sampletest1_compare(const struct sampletest1_config *cfg, sl_simd_level_t level, size_t batch, size_t num_rows,
+                                  const float *colors, const float *expected) {
+  size_t num_mismatches = 0;
+  size_t row, n;
+  for (row = 0; row < num_rows; ++row) {
+    int same = 1;
+    for (n = 0; same && (n < 4); ++n) {
+      same = colors[n * num_rows + row] == expected[n * num_rows + row];
+    }
+    if (!same) {
+      if (!num_mismatches) {
+        fprintf(stderr, "sampletest1: ");
+        sampletest1_print_config(stderr, cfg);
+        fprintf(stderr, " with %s kernels, batch %zu row %zu: vec4(%f, %f, %f, %f), texture2D() gives vec4(%f, %f, %f, %f)\n",
+                sl_simd_level_name(level), batch, row,
+                colors[row], colors[num_rows + row], colors[2 * num_rows + row], colors[3 * num_rows + row],
+                expected[row], expected[num_rows + row], expected[2 * num_rows + row], expected[3 * num_rows + row]);
+      }
+      num_mismatches++;
+    }
+  }
+  return num_mismatches;
+}
+
+/* Checks that sampling 8 rows at once (texture2D_8() in sampler_2d.c) gives exactly what sampling each row on its
+ * own (texture2D()) does, for every format, filter and wrap mode, with and without mipmaps, on coordinates at the
+ * edges of the texture and its texels, and with the blends run by each level of SIMD kernels the host supports. */
+int sampletest1(void) {
+  int r = -1;
+  size_t n;
+  size_t num_runs = 0, num_mismatches = 0;
+  GLuint vertex_shader = 0, fragment_shader = 0, program = 0, tex = 0;
+  GLint link_status = GL_FALSE;
+  int v_regs[4], frag_color_regs[4];
+  sl_simd_level_t initial_level = sl_simd_level();
+  sl_simd_level_t supported = sl_simd_detect();
+  float *expected = (float *)malloc(sizeof(float) * 4 * SAMPLETEST1_NUM_ROWS);
+  float *colors = (float *)malloc(sizeof(float) * 4 * SAMPLETEST1_NUM_ROWS);
+  const char *vsrc =
+    "attribute vec4 vgl_Position;\n"
+    "attribute vec4 v_color;\n"
+    "varying vec4 v;\n"
+    "void main() {\n"
+    "  v = v_color;\n"
+    "  gl_Position = vgl_Position;\n"
+    "}\n";
+
+  if (!expected || !colors) {
+    goto test_exit;
+  }
+
+  vertex_shader = sampletest1_compile(GL_VERTEX_SHADER, vsrc);
+  fragment_shader = sampletest1_compile(GL_FRAGMENT_SHADER, sampletest1_fsrc_);
+  program = glCreateProgram();
+  glAttachShader(program, vertex_shader);
+  glAttachShader(program, fragment_shader);
+  glLinkProgram(program);
+  glGetProgramiv(program, GL_LINK_STATUS, &link_status);
+  if (link_status == GL_FALSE) {
+    fprintf(stderr, "Failed to link program. Diagnostics:\n");
+    print_program_log(stderr, program);
+    goto test_exit;
+  }
+  glUseProgram(program);
+  glUniform1i(glGetUniformLocation(program, "tex"), 0);
+
+  struct gl_es2_context *c = gl_es2_ctx_dont_lock();
+  struct gl_es2_program *prog = (struct gl_es2_program *)not_find(&c->program_not_, (uintptr_t)program);
+  if (!prog) {
+    goto test_exit;
+  }
+  struct sl_shader *fs = &prog->fragment_shader_.shader_->shader_;
+  struct sl_execution *exec = &fs->exec_;
+  struct sl_variable *v = sl_compilation_unit_find_variable(&fs->cu_, "v");
+  struct sl_variable *frag_color = sl_compilation_unit_find_variable(&fs->cu_, "gl_FragColor");
+  struct sl_function *fmain = sl_compilation_unit_find_function(&fs->cu_, "main");
+  if (!fmain || !v || !frag_color || !exec->max_num_rows_) {
+    goto test_exit;
+  }
+  for (n = 0; n < 4; ++n) {
+    v_regs[n] = v->reg_alloc_.v_.regs_[n];
+    frag_color_regs[n] = frag_color->reg_alloc_.v_.regs_[n];
+  }
+  size_t num_rows = (exec->max_num_rows_ < SAMPLETEST1_NUM_ROWS) ? exec->max_num_rows_ : SAMPLETEST1_NUM_ROWS;
+
+  struct sampletest1_config cfg;
+  for (cfg.format_ = 0; cfg.format_ < SAMPLETEST1_COUNT(sampletest1_formats_); ++cfg.format_) {
+    for (cfg.mipmapped_ = 0; cfg.mipmapped_ < 2; ++cfg.mipmapped_) {
+      size_t num_min_filters = cfg.mipmapped_ ? SAMPLETEST1_COUNT(sampletest1_min_filters_) : 2;
+      for (cfg.min_filter_ = 0; cfg.min_filter_ < num_min_filters; ++cfg.min_filter_) {
+        for (cfg.mag_filter_ = 0; cfg.mag_filter_ < 2; ++cfg.mag_filter_) {
+          for (cfg.wrap_s_ = 0; cfg.wrap_s_ < SAMPLETEST1_COUNT(sampletest1_wraps_); ++cfg.wrap_s_) {
+            size_t batch;
+            int level;
+            cfg.wrap_t_ = (cfg.wrap_s_ + cfg.min_filter_) % SAMPLETEST1_COUNT(sampletest1_wraps_);
+            tex = sampletest1_create_texture(&cfg);
+            gl_es2_ctx_prepare_program_for_execution(c, prog);
+            for (batch = 0; batch < SAMPLETEST1_NUM_BATCHES; ++batch) {
+              if (sampletest1_run_batch(exec, fmain, v_regs, frag_color_regs, num_rows, batch, 1, expected)) {
+                fprintf(stderr, "sampletest1: failed to run\n");
+                goto test_exit;
+              }
+              for (level = SLSIMD_GENERIC; level <= (int)supported; ++level) {
+                sl_simd_select((sl_simd_level_t)level);
+                if (sampletest1_run_batch(exec, fmain, v_regs, frag_color_regs, num_rows, batch, 0, colors)) {
+                  fprintf(stderr, "sampletest1: failed to run\n");
+                  goto test_exit;
+                }
+                num_mismatches += sampletest1_compare(&cfg, (sl_simd_level_t)level, batch, num_rows, colors, expected);
+                num_runs++;
+              }
+              sl_simd_select(initial_level);
+            }
+            glDeleteTextures(1, &tex);
+            tex = 0;
+          }
+        }
+      }
+    }
+  }
+  fprintf(stdout, "sampletest1: %zu runs of %zu rows, %zu mismatches\n", num_runs, num_rows, num_mismatches);
+  if (num_mismatches) {
+    goto test_exit;
+  }
+
+  r = 0;
+test_exit:
+  sl_simd_select(initial_level);
+  glUseProgram(0);
+  if (tex) glDeleteTextures(1, &tex);
+  if (program) glDeleteProgram(program);
+  if (fragment_shader) glDeleteShader(fragment_shader);
+  if (vertex_shader) glDeleteShader(vertex_shader);
+  if (expected) free(expected);
+  if (colors) free(colors);
+  return r;
+}
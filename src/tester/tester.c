@@ -28,6 +28,11 @@
 #include <string.h>
 #endif
 
+#ifndef LIMITS_H_INCLUDED
+#define LIMITS_H_INCLUDED
+#include <limits.h>
+#endif
+
 #ifdef USE_STANDARD_NON_AEX_GL_HEADERS
 #ifndef GLES2_GL2_H_INCLUDED
 #define GLES2_GL2_H_INCLUDED
@@ -47,11 +52,32 @@
 /* xx(name, description) */
 #define CODE_TESTS \
   xx(codetest1, "Clipping test") \
-  xx(slirtest1, "SL IR test")
+  xx(slirtest1, "SL IR test") \
+  xx(batchbench1, "Fragments/sec vs execution batch width") \
+  xx(ulptest1, "ULP error of the SIMD transcendental builtins vs libm") \
+  xx(threadtest1, "Same shader from several threads, each on its own execution context") \
+  xx(exectest1, "Shaders run directly on each optimization pass and execution mode vs the AST walker") \
+  xx(sampletest1, "texture2D on 8 rows at once vs one row at a time, per filter, wrap mode and SIMD level")
 
 struct shader_test_code {
   const char *code_;
   const char *expected_dump_;
+
+  /* Non-zero to run the shader over a full batch of rows rather than a single row, so the runs of 4 and 8
+   * rows are taken (all rows compute the same values, the dump is of the first.) */
+  int full_batch_;
+
+  /* Environments to run the test in besides the default one, each a space separated list of "NAME=value"
+   * settings in effect while the shader is created (see tester_apply_env()), e.g. "AEX_SL_EXEC=ast" to run it
+   * on the AST walker rather than SLIR. Every run must dump expected_dump_. */
+  const char *envs_[4];
+
+  /* Uniforms set with glUniform1f() (GL_FLOAT) or glUniform1i() (GL_INT) before the shader runs */
+  struct {
+    const char *name_;
+    GLenum type_;
+    float value_;
+  } uniforms_[2];
 } shader_tests[] = {
   /* 0 */
   { "void main(void) {\n"
@@ -163,6 +189,329 @@ struct shader_test_code {
     "}\n",
     "vec3(0.000000, 1.000000, 2.000000)\n"
     "vec3(3.000000, 4.000000, 5.000000)\n"
+  },
+
+  /* 11 - inlined functions (straight-line, returning at their end) next to one that returns early */
+  { "float sq(float x) {\n"
+    "  return x * x;\n"
+    "}\n"
+    "vec2 scale_add(vec2 a, float s) {\n"
+    "  vec2 r = a * s;\n"
+    "  return r + vec2(1.0, 2.0);\n"
+    "}\n"
+    "void bump(inout float v, out float w) {\n"
+    "  v += 1.0;\n"
+    "  w = v * 2.0;\n"
+    "}\n"
+    "float early(float x) {\n"
+    "  if (x > 1.0) return 1.0;\n"
+    "  return x;\n"
+    "}\n"
+    "void main(void) {\n"
+    "  float a = 3.0;\n"
+    "  float w;\n"
+    "  dump(sq(a) + sq(2.0));\n"
+    "  dump(sq(sq(a)));\n"
+    "  dump(scale_add(vec2(1.0, 2.0), a));\n"
+    "  bump(a, w);\n"
+    "  dump(a);\n"
+    "  dump(w);\n"
+    "  dump(early(a));\n"
+    "  dump(early(0.5));\n"
+    "}\n",
+    "13.000000\n"
+    "81.000000\n"
+    "vec2(4.000000, 8.000000)\n"
+    "4.000000\n"
+    "8.000000\n"
+    "1.000000\n"
+    "0.500000\n"
+  },
+
+  /* 12 - branches, loops and short-circuit operators on uniform conditions, which forward the whole chain to one
+   * side; the loop counter and x are not uniform and still split row by row. Run with k and n specialized on
+   * (folded as constants), with only the int n specialized on (the default), and with neither. */
+  { "uniform float k;\n"
+    "uniform int n;\n"
+    "void main(void) {\n"
+    "  float x;\n"
+    "  if (k > 1.0) x = 1.0; else x = -1.0;\n"
+    "  int i;\n"
+    "  for (i = 0; i < n; i++) {\n"
+    "    if (k < 1.0) x += 100.0;\n"
+    "    else x += 2.0;\n"
+    "  }\n"
+    "  dump(x);\n"
+    "  while (k > 1.0) {\n"
+    "    x += 1.0;\n"
+    "    if (x >= 10.0) break;\n"
+    "  }\n"
+    "  dump(x);\n"
+    "  dump((k > 1.0) && (x > 5.0));\n"
+    "  dump((k < 1.0) && (x > 5.0));\n"
+    "  dump((k > 1.0) || (x > 50.0));\n"
+    "  dump((k < 1.0) ? x : -x);\n"
+    "}\n",
+    "7.000000\n"
+    "10.000000\n"
+    "true\n"
+    "false\n"
+    "true\n"
+    "-10.000000\n",
+    1,
+    { "AEX_SL_SPECIALIZE=k,n", "AEX_SL_SPECIALIZE=none", "AEX_SL_EXEC=ast" },
+    { { "k", GL_FLOAT, 2.f }, { "n", GL_INT, 3.f } }
+  },
+
+  /* 13 - unrolled for loops: break on a value computed at runtime, continue, counting down with -=, the bound
+   * before the index in the condition, and a float index. The index must have the value after the loop
+   * that the loop would have left it with (the iteration of the break, or the first value failing the
+   * condition.) */
+  { "void main(void) {\n"
+    "  int i;\n"
+    "  float s = 0.0;\n"
+    "  float limit = 5.0;\n"
+    "  for (i = 0; i < 8; i++) {\n"
+    "    if (float(i) == limit) break;\n"
+    "    s += 1.0;\n"
+    "  }\n"
+    "  dump(s);\n"
+    "  dump(i);\n"
+    "  s = 0.0;\n"
+    "  for (i = 0; i < 6; i++) {\n"
+    "    if ((i == 2) || (i == 4)) continue;\n"
+    "    s += float(i);\n"
+    "  }\n"
+    "  dump(s);\n"
+    "  dump(i);\n"
+    "  s = 0.0;\n"
+    "  for (i = 10; i > 0; i -= 3) s += float(i);\n"
+    "  dump(s);\n"
+    "  dump(i);\n"
+    "  s = 0.0;\n"
+    "  for (i = 0; 9 > i; i += 2) s += 1.0;\n"
+    "  dump(s);\n"
+    "  dump(i);\n"
+    "  float f;\n"
+    "  s = 0.0;\n"
+    "  for (f = 0.5; f < 2.0; f += 0.5) s += f;\n"
+    "  dump(s);\n"
+    "  dump(f);\n"
+    "}\n",
+    "5.000000\n"
+    "5\n"
+    "9.000000\n"
+    "6\n"
+    "22.000000\n"
+    "-2\n"
+    "5.000000\n"
+    "10\n"
+    "3.000000\n"
+    "2.000000\n",
+    1
+  },
+
+  /* 14 - unroll size limit: with the default AEX_SL_UNROLL_MAX_SIZE of 512, a body of "s += 1.0;" counts 5
+   * (the statement, its 3 expression nodes and 1 for the iteration), so 102 iterations (510) are unrolled and
+   * 103 iterations (515) are just over the limit and remain a loop. Both must give the same results. */
+  { "void main(void) {\n"
+    "  int i, j;\n"
+    "  float s = 0.0;\n"
+    "  float t = 0.0;\n"
+    "  for (i = 0; i < 102; i++) s += 1.0;\n"
+    "  for (j = 0; j < 103; j++) t += 1.0;\n"
+    "  dump(s);\n"
+    "  dump(i);\n"
+    "  dump(t);\n"
+    "  dump(j);\n"
+    "}\n",
+    "102.000000\n"
+    "102\n"
+    "103.000000\n"
+    "103\n"
+  },
+
+  /* 15 - max(), clamp() and mix() kernels over a full batch, and the superinstructions fused from a multiply
+   * and an add, a linear interpolation, and a dot product followed by max() or clamp(). The inputs pass
+   * through max() so they are not folded into constants. */
+  { "void main(void) {\n"
+    "  float a = max(1.5, -9.0);\n"
+    "  float b = max(-2.5, -9.0);\n"
+    "  vec3 v = max(vec3(1.0, -4.0, 3.0), -9.0);\n"
+    "  vec3 w = max(vec3(2.0, -5.0, 0.5), -9.0);\n"
+    "  dump(max(a, b));\n"
+    "  dump(max(b, a * 2.0));\n"
+    "  dump(max(v, w));\n"
+    "  dump(max(v, 0.0));\n"
+    "  dump(clamp(v, -1.0, 2.0));\n"
+    "  dump(max(dot(v, w), 0.0));\n"
+    "  dump(max(dot(v, -w), 0.0));\n"
+    "  dump(clamp(dot(v, w), 0.0, 10.0));\n"
+    "  dump(a * b + a);\n"
+    "  dump(mix(a, b, 0.25));\n"
+    "  dump(a + (b - a) * 0.25);\n"
+    "}\n",
+    "1.500000\n"
+    "3.000000\n"
+    "vec3(2.000000, -4.000000, 3.000000)\n"
+    "vec3(1.000000, 0.000000, 3.000000)\n"
+    "vec3(1.000000, -1.000000, 2.000000)\n"
+    "23.500000\n"
+    "0.000000\n"
+    "10.000000\n"
+    "-2.250000\n"
+    "0.500000\n"
+    "0.500000\n",
+    1
+  },
+
+  /* 16 - moves whose source and destination may share a register: the destination is written (fully, partly,
+   * or only on the rows that take a branch) while the source is still live, so those moves must remain real
+   * copies. The inputs pass through max() so they are not folded into constants. */
+  { "void main(void) {\n"
+    "  vec2 a = max(vec2(1.0, 2.0), -9.0);\n"
+    "  vec2 b = a;\n"
+    "  b.x = 5.0;\n"
+    "  dump(a);\n"
+    "  dump(b);\n"
+    "  float u = max(1.0, -9.0);\n"
+    "  float w = max(2.0, -9.0);\n"
+    "  float tmp = u;\n"
+    "  u = w;\n"
+    "  w = tmp;\n"
+    "  dump(u);\n"
+    "  dump(w);\n"
+    "  float p = max(4.0, -9.0);\n"
+    "  float q = max(0.0, -9.0);\n"
+    "  if (p > 5.0) q = p;\n"
+    "  dump(q);\n"
+    "  if (p > 2.0) {\n"
+    "    q = p;\n"
+    "    q += 1.0;\n"
+    "  }\n"
+    "  dump(q);\n"
+    "  dump(p);\n"
+    "  float c = max(2.0, -9.0);\n"
+    "  float d = 0.0;\n"
+    "  for (int i = 0; i < 3; i++) {\n"
+    "    float t = c;\n"
+    "    c = c + 1.0;\n"
+    "    d += t;\n"
+    "  }\n"
+    "  dump(c);\n"
+    "  dump(d);\n"
+    "}\n",
+    "vec2(1.000000, 2.000000)\n"
+    "vec2(5.000000, 2.000000)\n"
+    "2.000000\n"
+    "1.000000\n"
+    "0.000000\n"
+    "5.000000\n"
+    "4.000000\n"
+    "5.000000\n"
+    "9.000000\n",
+    1
+  },
+
+  /* 17 - component-wise matrix arithmetic touches every component of every column, on SLIR and on the AST
+   * walker (where these once stopped after the first column.) */
+  { "void main(void) {\n"
+    "  mat2 a = mat2(1.0, 2.0, 3.0, 4.0);\n"
+    "  mat2 b = mat2(10.0, 20.0, 30.0, 40.0);\n"
+    "  dump(a + b);\n"
+    "  dump(b - a);\n"
+    "  dump(b / a);\n"
+    "  dump(8.0 / a);\n"
+    "  mat3 c = mat3(2.0, 4.0, 6.0, 8.0, 10.0, 12.0, 14.0, 16.0, 18.0);\n"
+    "  dump(c / 2.0);\n"
+    "  dump(c + 1.0);\n"
+    "  dump(1.0 - c);\n"
+    "  mat4 d = mat4(1.0);\n"
+    "  dump(d + d);\n"
+    "}\n",
+    "mat2(11.000000, 22.000000, 33.000000, 44.000000)\n"
+    "mat2(9.000000, 18.000000, 27.000000, 36.000000)\n"
+    "mat2(10.000000, 10.000000, 10.000000, 10.000000)\n"
+    "mat2(8.000000, 4.000000, 2.666667, 2.000000)\n"
+    "mat3(1.000000, 2.000000, 3.000000, 4.000000, 5.000000, 6.000000, 7.000000, 8.000000, 9.000000)\n"
+    "mat3(3.000000, 5.000000, 7.000000, 9.000000, 11.000000, 13.000000, 15.000000, 17.000000, 19.000000)\n"
+    "mat3(-1.000000, -3.000000, -5.000000, -7.000000, -9.000000, -11.000000, -13.000000, -15.000000, -17.000000)\n"
+    "mat4(2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000, 0.000000, 0.000000, 0.000000, 0.000000, 2.000000)\n",
+    0,
+    { "AEX_SL_EXEC=ast" }
+  },
+
+  /* 18 - the sequence operator, and copying out and inout parameters back to the arguments, including array
+   * elements at an index only known at runtime, on SLIR and on the AST walker. */
+  { "void split(in float x, out float whole, inout vec2 acc) {\n"
+    "  whole = floor(x);\n"
+    "  acc += vec2(x - whole, 1.0);\n"
+    "}\n"
+    "void main(void) {\n"
+    "  float a;\n"
+    "  float b = (a = 2.0, a * 3.0);\n"
+    "  dump(a);\n"
+    "  dump(b);\n"
+    "  float w = -1.0;\n"
+    "  vec2 acc = vec2(0.5, 0.0);\n"
+    "  split(3.25, w, acc);\n"
+    "  dump(w);\n"
+    "  dump(acc);\n"
+    "  float parts[2];\n"
+    "  vec2 accs[2];\n"
+    "  parts[0] = -1.0;\n"
+    "  accs[0] = vec2(0.0);\n"
+    "  accs[1] = vec2(0.0);\n"
+    "  int i = int(max(1.0, 0.0));\n"
+    "  split(1.5, parts[i], accs[i]);\n"
+    "  dump(parts[0]);\n"
+    "  dump(parts[1]);\n"
+    "  dump(accs[0]);\n"
+    "  dump(accs[1]);\n"
+    "}\n",
+    "2.000000\n"
+    "6.000000\n"
+    "3.000000\n"
+    "vec2(0.750000, 1.000000)\n"
+    "-1.000000\n"
+    "1.000000\n"
+    "vec2(0.000000, 0.000000)\n"
+    "vec2(0.500000, 1.000000)\n",
+    0,
+    { "AEX_SL_EXEC=ast" }
+  },
+
+  /* 19 - as 12, with uniform values taking the other side of every condition */
+  { "uniform float k;\n"
+    "uniform int n;\n"
+    "void main(void) {\n"
+    "  float x;\n"
+    "  if (k > 1.0) x = 1.0; else x = -1.0;\n"
+    "  int i;\n"
+    "  for (i = 0; i < n; i++) {\n"
+    "    if (k < 1.0) x += 100.0;\n"
+    "    else x += 2.0;\n"
+    "  }\n"
+    "  dump(x);\n"
+    "  while (k > 1.0) {\n"
+    "    x += 1.0;\n"
+    "    if (x >= 10.0) break;\n"
+    "  }\n"
+    "  dump(x);\n"
+    "  dump((k > 1.0) && (x > 5.0));\n"
+    "  dump((k < 1.0) && (x > 5.0));\n"
+    "  dump((k > 1.0) || (x > 50.0));\n"
+    "  dump((k < 1.0) ? x : -x);\n"
+    "}\n",
+    "199.000000\n"
+    "199.000000\n"
+    "false\n"
+    "true\n"
+    "true\n"
+    "199.000000\n",
+    1,
+    { "AEX_SL_SPECIALIZE=k,n", "AEX_SL_SPECIALIZE=none", "AEX_SL_EXEC=ast" },
+    { { "k", GL_FLOAT, 0.5f }, { "n", GL_INT, 2.f } }
   }
 };
 
@@ -237,80 +586,154 @@ int print_program_log(FILE *fp, GLuint program) {
   return 0;
 }
 
+/* Sets the environment variable name to value, or removes it if value is NULL. The AEX_SL_XXX variables are read
+ * when a shader is created, so tests set them beforehand to pick an engine or optimizer passes. */
+int tester_setenv(const char *name, const char *value) {
+#ifdef _WIN32
+  return _putenv_s(name, value ? value : "") ? -1 : 0;
+#else
+  if (!value) return unsetenv(name) ? -1 : 0;
+  return setenv(name, value, 1) ? -1 : 0;
+#endif
+}
 
-int main(int argc, char **argv) {
-  int num_successes = 0;
+/* Applies settings, a space separated list of "NAME=value", with tester_setenv(); or, if undo is non-zero,
+ * removes the variables it names again. */
+int tester_apply_env(const char *settings, int undo) {
+  char name[64], value[256];
+  while (settings && *settings) {
+    size_t len, name_len, value_len;
+    const char *eq;
+    if (*settings == ' ') {
+      settings++;
+      continue;
+    }
+    len = strcspn(settings, " ");
+    eq = (const char *)memchr(settings, '=', len);
+    name_len = eq ? (size_t)(eq - settings) : len;
+    value_len = eq ? (len - name_len - 1) : 0;
+    if ((name_len >= sizeof(name)) || (value_len >= sizeof(value))) return -1;
+    memcpy(name, settings, name_len);
+    name[name_len] = '\0';
+    if (value_len) memcpy(value, eq + 1, value_len);
+    value[value_len] = '\0';
+    if (tester_setenv(name, undo ? NULL : value)) return -1;
+    settings += len;
+  }
+  return 0;
+}
 
-  int rv;
-  rv = run_codetests();
-  if (rv) {
-    return EXIT_FAILURE;
+/* Runs shader test n in the environment env (see shader_test_code::envs_, NULL for the default), returns
+ * non-zero if it failed. */
+static int run_shader_test(size_t n, struct shader_test_code *stc, const char *env) {
+  int failed = 1;
+  if (tester_apply_env(env, 0)) {
+    fprintf(stderr, "Failed test #%zu, cannot set environment \"%s\"\n", n, env);
+    tester_apply_env(env, 1);
+    return 1;
   }
 
-  size_t first_selected_test = 0;
-  size_t end_selected_test = sizeof(shader_tests) / sizeof(*shader_tests);
+  int sh = glCreateShader(AEX_GL_DEBUG_SHADER);
+  check_for_and_print_gl_err(stderr);
+  glShaderSource(sh, 1, &stc->code_, NULL);
+  check_for_and_print_gl_err(stderr);
+  glCompileShader(sh);
+  check_for_and_print_gl_err(stderr);
 
-  //end_selected_test = 1 + (first_selected_test = 0);
+  GLint fcompile_status = 0;
+  glGetShaderiv(sh, GL_COMPILE_STATUS, &fcompile_status);
 
-  size_t n;
-  for (n = first_selected_test; n < end_selected_test; ++n) {
-    struct shader_test_code *stc = shader_tests + n;
-    int sh = glCreateShader(AEX_GL_DEBUG_SHADER);
-    check_for_and_print_gl_err(stderr);
-    glShaderSource(sh, 1, &stc->code_, NULL);
-    check_for_and_print_gl_err(stderr);
-    glCompileShader(sh);
-    check_for_and_print_gl_err(stderr);
+  if (fcompile_status == GL_FALSE) {
+    fprintf(stderr, "Failed to compile shader. Diagnostics:\n");
+    print_shader_log(stderr, sh);
+  }
 
-    GLint fcompile_status = 0;
-    glGetShaderiv(sh, GL_COMPILE_STATUS, &fcompile_status);
+  int prog = glCreateProgram();
+  check_for_and_print_gl_err(stderr);
+  glAttachShader(prog, sh);
+  check_for_and_print_gl_err(stderr);
+  glLinkProgram(prog);
+  check_for_and_print_gl_err(stderr);
 
-    if (fcompile_status == GL_FALSE) {
-      fprintf(stderr, "Failed to compile shader. Diagnostics:\n");
-      if (print_shader_log(stderr, sh)) {
-        /* Failure printing log */
-        return -1;
-      }
-    }
+  GLint plink_status = 0;
+  glGetProgramiv(prog, GL_LINK_STATUS, &plink_status);
 
-    int prog = glCreateProgram();
-    check_for_and_print_gl_err(stderr);
-    glAttachShader(prog, sh);
-    check_for_and_print_gl_err(stderr);
-    glLinkProgram(prog);
+  if (plink_status == GL_FALSE) {
+    fprintf(stderr, "Failed to link program. Diagnostics:\n");
+    print_program_log(stderr, prog);
+  }
+  else {
+    size_t u;
+    glUseProgram(prog);
     check_for_and_print_gl_err(stderr);
-
-    GLint plink_status = 0;
-    glGetProgramiv(prog, GL_LINK_STATUS, &plink_status);
-
-    if (plink_status == GL_FALSE) {
-      fprintf(stderr, "Failed to link program. Diagnostics:\n");
-      if (print_program_log(stderr, prog)) {
-        /* Failure printing log */
-        return -1;
+    for (u = 0; u < sizeof(stc->uniforms_) / sizeof(*stc->uniforms_); ++u) {
+      if (!stc->uniforms_[u].name_) break;
+      GLint location = glGetUniformLocation(prog, stc->uniforms_[u].name_);
+      if (stc->uniforms_[u].type_ == GL_INT) {
+        glUniform1i(location, (GLint)stc->uniforms_[u].value_);
+      }
+      else {
+        glUniform1f(location, stc->uniforms_[u].value_);
       }
+      check_for_and_print_gl_err(stderr);
+    }
+    if (stc->full_batch_) {
+      aex_gl_es2_run_debug_shader_rows(prog, INT_MAX);
     }
     else {
       aex_gl_es2_run_debug_shader(prog);
-      if (!check_for_and_print_gl_err(stderr)) {
-        const char *dump_output = aex_gl_es2_get_shader_debug_string(sh);
-        if (strcmp(dump_output, stc->expected_dump_)) {
-          fprintf(stderr, "Failed test #%zu\nExpected output:\n%sActual output:\n%s\n", n, stc->expected_dump_, dump_output);
-        }
-        else {
-          num_successes++;
-        }
+    }
+    if (!check_for_and_print_gl_err(stderr)) {
+      const char *dump_output = aex_gl_es2_get_shader_debug_string(sh);
+      if (strcmp(dump_output, stc->expected_dump_)) {
+        fprintf(stderr, "Failed test #%zu%s%s\nExpected output:\n%sActual output:\n%s\n", n,
+                env ? " with " : "", env ? env : "", stc->expected_dump_, dump_output);
       }
       else {
-        fprintf(stderr, "Failed test #%zu\n", n);
+        failed = 0;
       }
     }
+    else {
+      fprintf(stderr, "Failed test #%zu%s%s\n", n, env ? " with " : "", env ? env : "");
+    }
+  }
 
-    glDeleteProgram(prog);
-    check_for_and_print_gl_err(stderr);
+  glUseProgram(0);
+  check_for_and_print_gl_err(stderr);
 
-    glDeleteShader(sh);
-    check_for_and_print_gl_err(stderr);
+  glDeleteProgram(prog);
+  check_for_and_print_gl_err(stderr);
+
+  glDeleteShader(sh);
+  check_for_and_print_gl_err(stderr);
+
+  tester_apply_env(env, 1);
+  return failed;
+}
+
+int main(int argc, char **argv) {
+  int num_successes = 0;
+
+  int rv;
+  rv = run_codetests();
+  if (rv) {
+    return EXIT_FAILURE;
+  }
+
+  size_t first_selected_test = 0;
+  size_t end_selected_test = sizeof(shader_tests) / sizeof(*shader_tests);
+
+  //end_selected_test = 1 + (first_selected_test = 0);
+
+  size_t n;
+  for (n = first_selected_test; n < end_selected_test; ++n) {
+    struct shader_test_code *stc = shader_tests + n;
+    size_t env_index;
+    int failed = run_shader_test(n, stc, NULL);
+    for (env_index = 0; (env_index < sizeof(stc->envs_) / sizeof(*stc->envs_)) && stc->envs_[env_index]; ++env_index) {
+      failed |= run_shader_test(n, stc, stc->envs_[env_index]);
+    }
+    if (!failed) num_successes++;
   }
 
   fprintf(stdout, "%d / %zu tests passed\n", num_successes, (end_selected_test - first_selected_test));
@@ -0,0 +1,412 @@
+/* Copyright 2024 Kinglet B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STDLIB_H_INCLUDED
+#define STDLIB_H_INCLUDED
+#include <stdlib.h>
+#endif
+
+#ifndef STDIO_H_INCLUDED
+#define STDIO_H_INCLUDED
+#include <stdio.h>
+#endif
+
+#ifndef STRING_H_INCLUDED
+#define STRING_H_INCLUDED
+#include <string.h>
+#endif
+
+#ifndef STDINT_H_INCLUDED
+#define STDINT_H_INCLUDED
+#include <stdint.h>
+#endif
+
+#ifdef _WIN32
+#ifndef WINDOWS_H_INCLUDED
+#define WINDOWS_H_INCLUDED
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#endif
+#else
+#ifndef PTHREAD_H_INCLUDED
+#define PTHREAD_H_INCLUDED
+#include <pthread.h>
+#endif
+#endif
+
+#ifdef USE_STANDARD_NON_AEX_GL_HEADERS
+#ifndef GLES2_GL2_H_INCLUDED
+#define GLES2_GL2_H_INCLUDED
+#include <GLES2/gl2.h>
+#endif
+#else
+#include "gl_es2_impl.h"
+
+#ifndef GLES2_GL2_H_INCLUDED
+#define GLES2_GL2_H_INCLUDED
+#define GL_GLES_PROTOTYPES 0  /* we will define the prototypes as static function pointers by including gl_es2_aex_func_map.c */
+#include <GLES2/gl2.h>
+#endif
+#include "gl_es2_aex_func_map.c"
+#endif
+
+#ifndef GL_ES2_CONTEXT_H_INCLUDED
+#define GL_ES2_CONTEXT_H_INCLUDED
+#include "gl_es2_context.h"
+#endif
+
+#ifndef SL_EXECUTION_H_INCLUDED
+#define SL_EXECUTION_H_INCLUDED
+#include "sl_execution.h"
+#endif
+
+/* Number of threads running the shader at once, each on its own execution context */
+#define THREADTEST1_NUM_THREADS 8
+
+/* Number of distinct batches of input, and the number of times each thread runs all of them */
+#define THREADTEST1_NUM_BATCHES 32
+#define THREADTEST1_NUM_ITERATIONS 16
+
+/* Row outcome, see threadtest1_run_batch() */
+#define THREADTEST1_ROW_NOT_RUN 0
+#define THREADTEST1_ROW_SURVIVED 1
+#define THREADTEST1_ROW_DISCARDED 2
+
+int print_shader_log(FILE *fp, GLuint shader);
+int print_program_log(FILE *fp, GLuint program);
+int tester_apply_env(const char *settings, int undo);
+
+struct threadtest1_shader {
+  struct sl_function *fmain_;
+  int color_regs_[4];
+  int frag_color_regs_[4];
+  size_t num_rows_;
+};
+
+struct threadtest1_worker {
+  const struct threadtest1_shader *shader_;
+  struct sl_execution *exec_;
+  size_t first_batch_;
+
+  /* THREADTEST1_NUM_BATCHES of the colors and row outcomes of the single threaded run */
+  const float *expected_colors_;
+  const uint8_t *expected_outcomes_;
+
+  /* Scratch for the results of a single batch */
+  float *colors_;
+  uint8_t *outcomes_;
+
+  size_t num_mismatches_;
+  int failed_;
+};
+
+/* Runs batch number batch on exec, storing gl_FragColor of the rows that survived in colors (4 columns of
+ * num_rows_, zero for the rows that did not survive) and the THREADTEST1_ROW_XXX outcome of each row in outcomes. */
+static int threadtest1_run_batch(const struct threadtest1_shader *shader, struct sl_execution *exec, size_t batch, float *colors, uint8_t *outcomes) {
+  size_t row, n;
+  uint32_t chain;
+  sl_exec_row_t delta;
+
+  /* Some rows are discarded, the remainder take both sides of the branch */
+  for (n = 0; n < 4; ++n) {
+    float *column = exec->float_regs_[shader->color_regs_[n]];
+    for (row = 0; row < shader->num_rows_; ++row) {
+      column[row] = (float)((row * (n + 3) + batch * 7) % 17) / 16.f;
+    }
+  }
+  for (row = 0; row < (shader->num_rows_ - 1); ++row) {
+    exec->exec_chain_reg_[row] = 1;
+  }
+  exec->exec_chain_reg_[shader->num_rows_ - 1] = 0;
+
+  if (sl_exec_run(exec, shader->fmain_, 0)) return -1;
+
+  memset(colors, 0, sizeof(float) * 4 * shader->num_rows_);
+  memset(outcomes, THREADTEST1_ROW_NOT_RUN, shader->num_rows_);
+  chain = exec->execution_points_[0].post_chain_;
+  if (chain != SL_EXEC_NO_CHAIN) {
+    row = (size_t)chain;
+    do {
+      outcomes[row] = THREADTEST1_ROW_SURVIVED;
+      for (n = 0; n < 4; ++n) {
+        colors[n * shader->num_rows_ + row] = exec->float_regs_[shader->frag_color_regs_[n]][row];
+      }
+      delta = exec->exec_chain_reg_[row];
+      row += delta;
+    } while (delta);
+  }
+  chain = exec->execution_points_[0].alt_chain_;
+  if (chain != SL_EXEC_NO_CHAIN) {
+    row = (size_t)chain;
+    do {
+      outcomes[row] = THREADTEST1_ROW_DISCARDED;
+      delta = exec->exec_chain_reg_[row];
+      row += delta;
+    } while (delta);
+  }
+  return 0;
+}
+
+static void threadtest1_work(struct threadtest1_worker *w) {
+  size_t num_rows = w->shader_->num_rows_;
+  size_t iteration, n;
+  for (iteration = 0; iteration < THREADTEST1_NUM_ITERATIONS; ++iteration) {
+    for (n = 0; n < THREADTEST1_NUM_BATCHES; ++n) {
+      /* Each thread starts at a different batch, so threads run different inputs at the same time */
+      size_t batch = (w->first_batch_ + n) % THREADTEST1_NUM_BATCHES;
+      if (threadtest1_run_batch(w->shader_, w->exec_, batch, w->colors_, w->outcomes_)) {
+        w->failed_ = 1;
+        return;
+      }
+      /* Bit exact, the same program on the same input must give the same result on any context */
+      if (memcmp(w->colors_, w->expected_colors_ + batch * 4 * num_rows, sizeof(float) * 4 * num_rows) ||
+          memcmp(w->outcomes_, w->expected_outcomes_ + batch * num_rows, num_rows)) {
+        w->num_mismatches_++;
+      }
+    }
+  }
+}
+
+#ifdef _WIN32
+static DWORD WINAPI threadtest1_thread(LPVOID arg) {
+  threadtest1_work((struct threadtest1_worker *)arg);
+  return 0;
+}
+#else
+static void *threadtest1_thread(void *arg) {
+  threadtest1_work((struct threadtest1_worker *)arg);
+  return NULL;
+}
+#endif
+
+static GLuint threadtest1_compile(GLenum type, const char *src) {
+  GLuint shader = glCreateShader(type);
+  GLint src_len = (GLint)strlen(src);
+  GLint compile_status = GL_FALSE;
+  glShaderSource(shader, 1, &src, &src_len);
+  glCompileShader(shader);
+  glGetShaderiv(shader, GL_COMPILE_STATUS, &compile_status);
+  if (compile_status == GL_FALSE) {
+    fprintf(stderr, "Failed to compile shader. Diagnostics:\n");
+    print_shader_log(stderr, shader);
+  }
+  return shader;
+}
+
+/* Runs the fragment shader fsrc, built in the environment env (see tester_apply_env()), directly (bypassing
+ * rasterization) from THREADTEST1_NUM_THREADS threads at once, each on an execution context of its own (see
+ * sl_exec_init_context()), and checks that every batch gives exactly the same gl_FragColor and discards as when run
+ * on a single thread. If expect_replay is non-zero, the shader does not diverge, and every context must end up
+ * replaying the schedule of the AST walk it recorded (see sl_execution::trace_state_.) */
+static int threadtest1_run(const char *name, const char *fsrc, const char *env, int expect_replay) {
+  int r = -1;
+  size_t n;
+  struct sl_exec_pool pool;
+  struct threadtest1_shader shader;
+  struct threadtest1_worker workers[THREADTEST1_NUM_THREADS];
+  float *expected_colors = NULL;
+  uint8_t *expected_outcomes = NULL;
+  size_t num_threads_started = 0;
+  GLuint vertex_shader = 0, fragment_shader = 0, program = 0;
+  GLint link_status = GL_FALSE;
+#ifdef _WIN32
+  HANDLE threads[THREADTEST1_NUM_THREADS];
+#else
+  pthread_t threads[THREADTEST1_NUM_THREADS];
+#endif
+  const char *vsrc =
+    "attribute vec4 vgl_Position;\n"
+    "attribute vec4 v_color;\n"
+    "varying vec4 vertex_color;\n"
+    "void main() {\n"
+    "  vertex_color = v_color;\n"
+    "  gl_Position = vgl_Position;\n"
+    "}\n";
+
+  sl_exec_pool_init(&pool);
+  memset(workers, 0, sizeof(workers));
+
+  if (tester_apply_env(env, 0)) {
+    fprintf(stderr, "threadtest1: cannot set environment \"%s\"\n", env);
+    goto test_exit;
+  }
+
+  vertex_shader = threadtest1_compile(GL_VERTEX_SHADER, vsrc);
+  fragment_shader = threadtest1_compile(GL_FRAGMENT_SHADER, fsrc);
+  program = glCreateProgram();
+  glAttachShader(program, vertex_shader);
+  glAttachShader(program, fragment_shader);
+  glLinkProgram(program);
+  glGetProgramiv(program, GL_LINK_STATUS, &link_status);
+  if (link_status == GL_FALSE) {
+    fprintf(stderr, "Failed to link program. Diagnostics:\n");
+    print_program_log(stderr, program);
+    goto test_exit;
+  }
+
+  struct gl_es2_context *c = gl_es2_ctx_dont_lock();
+  struct gl_es2_program *prog = (struct gl_es2_program *)not_find(&c->program_not_, (uintptr_t)program);
+  if (!prog) {
+    goto test_exit;
+  }
+
+  struct sl_shader *fs = &prog->fragment_shader_.shader_->shader_;
+  struct sl_execution *exec = &fs->exec_;
+  struct sl_variable *vertex_color = sl_compilation_unit_find_variable(&fs->cu_, "vertex_color");
+  struct sl_variable *frag_color = sl_compilation_unit_find_variable(&fs->cu_, "gl_FragColor");
+  shader.fmain_ = sl_compilation_unit_find_function(&fs->cu_, "main");
+  if (!shader.fmain_ || !vertex_color || !frag_color || !exec->max_num_rows_) {
+    goto test_exit;
+  }
+  for (n = 0; n < 4; ++n) {
+    shader.color_regs_[n] = vertex_color->reg_alloc_.v_.regs_[n];
+    shader.frag_color_regs_[n] = frag_color->reg_alloc_.v_.regs_[n];
+  }
+  shader.num_rows_ = exec->max_num_rows_;
+
+  /* Reference results, single threaded on the shader's own execution */
+  expected_colors = (float *)malloc(sizeof(float) * 4 * shader.num_rows_ * THREADTEST1_NUM_BATCHES);
+  expected_outcomes = (uint8_t *)malloc(shader.num_rows_ * THREADTEST1_NUM_BATCHES);
+  if (!expected_colors || !expected_outcomes) {
+    goto test_exit;
+  }
+  for (n = 0; n < THREADTEST1_NUM_BATCHES; ++n) {
+    if (threadtest1_run_batch(&shader, exec, n, expected_colors + n * 4 * shader.num_rows_, expected_outcomes + n * shader.num_rows_)) {
+      fprintf(stderr, "threadtest1: %s shader failed to run\n", name);
+      goto test_exit;
+    }
+  }
+
+  if (sl_exec_pool_reset(&pool, exec, THREADTEST1_NUM_THREADS) || sl_exec_pool_sync(&pool)) {
+    fprintf(stderr, "threadtest1: failed to set up execution contexts\n");
+    goto test_exit;
+  }
+  for (n = 0; n < THREADTEST1_NUM_THREADS; ++n) {
+    struct threadtest1_worker *w = workers + n;
+    w->shader_ = &shader;
+    w->exec_ = pool.contexts_ + n;
+    w->first_batch_ = n * THREADTEST1_NUM_BATCHES / THREADTEST1_NUM_THREADS;
+    w->expected_colors_ = expected_colors;
+    w->expected_outcomes_ = expected_outcomes;
+    w->colors_ = (float *)malloc(sizeof(float) * 4 * shader.num_rows_);
+    w->outcomes_ = (uint8_t *)malloc(shader.num_rows_);
+    if (!w->colors_ || !w->outcomes_) {
+      goto test_exit;
+    }
+  }
+
+  for (num_threads_started = 0; num_threads_started < THREADTEST1_NUM_THREADS; ++num_threads_started) {
+#ifdef _WIN32
+    threads[num_threads_started] = CreateThread(NULL, 0, threadtest1_thread, workers + num_threads_started, 0, NULL);
+    if (!threads[num_threads_started]) break;
+#else
+    if (pthread_create(threads + num_threads_started, NULL, threadtest1_thread, workers + num_threads_started)) break;
+#endif
+  }
+  for (n = 0; n < num_threads_started; ++n) {
+#ifdef _WIN32
+    WaitForSingleObject(threads[n], INFINITE);
+    CloseHandle(threads[n]);
+#else
+    pthread_join(threads[n], NULL);
+#endif
+  }
+  if (num_threads_started != THREADTEST1_NUM_THREADS) {
+    fprintf(stderr, "threadtest1: failed to start threads\n");
+    goto test_exit;
+  }
+
+  size_t num_mismatches = 0;
+  for (n = 0; n < THREADTEST1_NUM_THREADS; ++n) {
+    if (workers[n].failed_) {
+      fprintf(stderr, "threadtest1: %s shader failed to run on thread %zu\n", name, n);
+      goto test_exit;
+    }
+    if (expect_replay && (pool.contexts_[n].trace_state_ != SLETS_READY)) {
+      fprintf(stderr, "threadtest1: %s shader is not replayed on thread %zu\n", name, n);
+      goto test_exit;
+    }
+    num_mismatches += workers[n].num_mismatches_;
+  }
+  if (expect_replay && (exec->trace_state_ != SLETS_READY)) {
+    fprintf(stderr, "threadtest1: %s shader is not replayed\n", name);
+    goto test_exit;
+  }
+  fprintf(stdout, "threadtest1: %s, %d threads x %d batches of %zu rows, %zu mismatches\n",
+          name, THREADTEST1_NUM_THREADS, THREADTEST1_NUM_BATCHES * THREADTEST1_NUM_ITERATIONS, shader.num_rows_, num_mismatches);
+  if (num_mismatches) {
+    goto test_exit;
+  }
+
+  r = 0;
+test_exit:
+  for (n = 0; n < THREADTEST1_NUM_THREADS; ++n) {
+    if (workers[n].colors_) free(workers[n].colors_);
+    if (workers[n].outcomes_) free(workers[n].outcomes_);
+  }
+  if (expected_colors) free(expected_colors);
+  if (expected_outcomes) free(expected_outcomes);
+  /* The contexts run the program's code, release them before it goes */
+  sl_exec_pool_cleanup(&pool);
+  if (program) glDeleteProgram(program);
+  if (fragment_shader) glDeleteShader(fragment_shader);
+  if (vertex_shader) glDeleteShader(vertex_shader);
+  tester_apply_env(env, 1);
+
+  return r;
+}
+
+/* The same shaders from several threads at once: one that branches and discards, as compiled by default (SLIR)
+ * and on the AST walker, and one that does not diverge on the AST walker, so its recorded schedule is replayed. */
+int threadtest1(void) {
+  const char *branching_fsrc =
+    "precision highp float;\n"
+    "varying vec4 vertex_color;\n"
+    "void main() {\n"
+    "  vec4 c = vertex_color;\n"
+    "  if (c.a < 0.125) {\n"
+    "    discard;\n"
+    "  }\n"
+    "  float luma = dot(c.rgb, vec3(0.299, 0.587, 0.114));\n"
+    "  if (luma > 0.5) {\n"
+    "    c.rgb = c.rgb * c.rgb;\n"
+    "  }\n"
+    "  else {\n"
+    "    c.rgb = sqrt(c.rgb) * 0.5;\n"
+    "  }\n"
+    "  float t = 0.0;\n"
+    "  for (int i = 0; i < 3; ++i) {\n"
+    "    t += sin(c.r * float(i + 1)) * 0.25;\n"
+    "  }\n"
+    "  gl_FragColor = clamp(vec4(c.rgb + vec3(t), c.a), 0.0, 1.0);\n"
+    "}\n";
+  const char *straight_fsrc =
+    "precision highp float;\n"
+    "varying vec4 vertex_color;\n"
+    "float luma(vec3 c) {\n"
+    "  return dot(c, vec3(0.299, 0.587, 0.114));\n"
+    "}\n"
+    "void main() {\n"
+    "  vec4 c = vertex_color;\n"
+    "  float l = luma(c.rgb);\n"
+    "  vec3 t = mix(c.rgb, vec3(l), 0.5) * sin(c.r * 3.0) + sqrt(c.gbr) * 0.25;\n"
+    "  gl_FragColor = clamp(vec4(t, c.a * l), 0.0, 1.0);\n"
+    "}\n";
+
+  if (threadtest1_run("default", branching_fsrc, NULL, 0)) return -1;
+  if (threadtest1_run("ast", branching_fsrc, "AEX_SL_EXEC=ast", 0)) return -1;
+  if (threadtest1_run("ast trace replay", straight_fsrc, "AEX_SL_EXEC=ast", 1)) return -1;
+  return 0;
+}
@@ -0,0 +1,331 @@
+/* Copyright 2024 Kinglet B.V.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STDINT_H_INCLUDED
+#define STDINT_H_INCLUDED
+#include <stdint.h>
+#endif
+
+#ifndef STDIO_H_INCLUDED
+#define STDIO_H_INCLUDED
+#include <stdio.h>
+#endif
+
+#ifndef STRING_H_INCLUDED
+#define STRING_H_INCLUDED
+#include <string.h>
+#endif
+
+#ifndef MATH_H_INCLUDED
+#define MATH_H_INCLUDED
+#include <math.h>
+#endif
+
+#ifndef SL_EXECUTION_H_INCLUDED
+#define SL_EXECUTION_H_INCLUDED
+#include "sl_execution.h"
+#endif
+
+#ifndef SL_SIMD_H_INCLUDED
+#define SL_SIMD_H_INCLUDED
+#include "sl_simd.h"
+#endif
+
+/* Number of inputs tested for each function */
+#define ULPTEST1_NUM_SAMPLES (1 << 18)
+
+enum ulptest1_fn {
+  ULPTEST1_SIN,
+  ULPTEST1_COS,
+  ULPTEST1_EXP,
+  ULPTEST1_EXP2,
+  ULPTEST1_LOG,
+  ULPTEST1_LOG2,
+  ULPTEST1_POW,
+  ULPTEST1_INVERSESQRT,
+  ULPTEST1_NUM_FNS
+};
+
+static const char *ulptest1_fn_names[ULPTEST1_NUM_FNS] = {
+  "sin", "cos", "exp", "exp2", "log", "log2", "pow", "inversesqrt"
+};
+
+static uint32_t ulptest1_rand_state_;
+
+static float ulptest1_rand(float lo, float hi) {
+  ulptest1_rand_state_ = ulptest1_rand_state_ * 1664525u + 1013904223u;
+  return lo + (hi - lo) * (float)(ulptest1_rand_state_ >> 8) / (float)(1 << 24);
+}
+
+/* A positive float with a random exponent in [2^lo_exp, 2^hi_exp) */
+static float ulptest1_rand_pos(int lo_exp, int hi_exp) {
+  return exp2f(ulptest1_rand((float)lo_exp, (float)hi_exp));
+}
+
+/* Distance between a and b in units in the last place; NaNs match each other, and nothing else. */
+static double ulptest1_ulps(float a, float b) {
+  int32_t ia, ib;
+  int64_t oa, ob;
+  if (isnan(a) || isnan(b)) return (isnan(a) && isnan(b)) ? 0. : INFINITY;
+  memcpy(&ia, &a, sizeof(ia));
+  memcpy(&ib, &b, sizeof(ib));
+  /* Map the sign-magnitude bits onto a monotonic integer line */
+  oa = (ia < 0) ? -(int64_t)(ia & 0x7FFFFFFF) : (int64_t)ia;
+  ob = (ib < 0) ? -(int64_t)(ib & 0x7FFFFFFF) : (int64_t)ib;
+  return (double)((oa > ob) ? (oa - ob) : (ob - oa));
+}
+
+/* Size of one unit in the last place at x */
+static double ulptest1_ulp_size(float x) {
+  int e;
+  if (!isfinite(x)) return INFINITY;
+  frexpf(x, &e);
+  if (e < -125) e = -125;
+  return ldexp(1., e - 24);
+}
+
+/* Error allowed for the function at the input (GLSL ES 1.00 sets none, these are the bounds of GLSL ES 3.00
+ * section 4.5.1), in ULP of the libm result ref,
+ * or, for sin and cos, as an absolute error in *pabs_bound */
+static double ulptest1_bound(enum ulptest1_fn fn, float x, float y, float ref, double *pabs_bound) {
+  *pabs_bound = 0.;
+  switch (fn) {
+    case ULPTEST1_SIN:
+    case ULPTEST1_COS:
+      *pabs_bound = ldexp(1., -11);
+      return 0.;
+    case ULPTEST1_EXP:
+    case ULPTEST1_EXP2:
+      return 3. + 2. * fabs(x);
+    case ULPTEST1_LOG:
+    case ULPTEST1_LOG2:
+      if (x >= .5f && x <= 2.f) {
+        *pabs_bound = ldexp(1., -21);
+        return 0.;
+      }
+      return 3.;
+    case ULPTEST1_POW: {
+      /* Inherited from exp2(y * log2(x)): the error of exp2 at t, plus that of log2(x) scaled by y, which
+       * is a relative error of ln(2) times the absolute error in t. */
+      float l = log2f(x);
+      double t = (double)y * l;
+      double log2_abs = (x >= .5f && x <= 2.f) ? ldexp(1., -21) : 3. * ulptest1_ulp_size(l);
+      double rel = (3. + 2. * fabs(t)) * ldexp(1., -24) + 0.6931471805599453 * (fabs(y) * log2_abs + ulptest1_ulp_size((float)t));
+      return rel * fabs(ref) / ulptest1_ulp_size(ref) + 1.;
+    }
+    case ULPTEST1_INVERSESQRT:
+      return 0.;
+    case ULPTEST1_NUM_FNS:
+      break;
+  }
+  return 0.;
+}
+
+static float ulptest1_libm(enum ulptest1_fn fn, float x, float y) {
+  switch (fn) {
+    case ULPTEST1_SIN: return sinf(x);
+    case ULPTEST1_COS: return cosf(x);
+    case ULPTEST1_EXP: return expf(x);
+    case ULPTEST1_EXP2: return exp2f(x);
+    case ULPTEST1_LOG: return logf(x);
+    case ULPTEST1_LOG2: return log2f(x);
+    case ULPTEST1_POW: return powf(x, y);
+    case ULPTEST1_INVERSESQRT: return 1.f / sqrtf(x);
+    case ULPTEST1_NUM_FNS: break;
+  }
+  return 0.f;
+}
+
+/* Inputs within the range GLSL specifies the precision for, plus the specials libm defines */
+static void ulptest1_inputs(enum ulptest1_fn fn, size_t sample, float *px, float *py) {
+  static const float specials[] = { 0.f, -0.f, 1.f, -1.f, INFINITY, -INFINITY, NAN, 1e-40f };
+  *py = 0.f;
+  if ((fn != ULPTEST1_SIN) && (fn != ULPTEST1_COS) && (fn != ULPTEST1_POW) && (sample < sizeof(specials) / sizeof(*specials))) {
+    *px = specials[sample];
+    return;
+  }
+  switch (fn) {
+    case ULPTEST1_SIN:
+    case ULPTEST1_COS:
+      *px = ulptest1_rand(-3.14159265f, 3.14159265f);
+      break;
+    case ULPTEST1_EXP:
+      *px = ulptest1_rand(-87.f, 88.f);
+      break;
+    case ULPTEST1_EXP2:
+      *px = ulptest1_rand(-126.f, 127.f);
+      break;
+    case ULPTEST1_LOG:
+    case ULPTEST1_LOG2:
+    case ULPTEST1_INVERSESQRT:
+      *px = (sample & 1) ? ulptest1_rand(.5f, 2.f) : ulptest1_rand_pos(-140, 127);
+      break;
+    case ULPTEST1_POW:
+      /* Bases and exponents as found in lighting, e.g. pow(max(dot(n, h), 0.0), shininess) */
+      *px = (sample & 1) ? ulptest1_rand(0.f, 1.f) : ulptest1_rand_pos(-10, 10);
+      *py = ulptest1_rand(-4.f, 128.f);
+      break;
+    case ULPTEST1_NUM_FNS:
+      break;
+  }
+}
+
+static int ulptest1_level(void) {
+  static sl_exec_row_t chain_column[SL_EXEC_CHAIN_MAX_NUM_ROWS];
+  static float x_column[SL_EXEC_CHAIN_MAX_NUM_ROWS];
+  static float y_column[SL_EXEC_CHAIN_MAX_NUM_ROWS];
+  static float result_column[SL_EXEC_CHAIN_MAX_NUM_ROWS];
+  static unsigned char in_chain[SL_EXEC_CHAIN_MAX_NUM_ROWS];
+  sl_simd_f_unop_fn unops[ULPTEST1_NUM_FNS] = {
+    g_sl_simd_.f_sin_, g_sl_simd_.f_cos_, g_sl_simd_.f_exp_, g_sl_simd_.f_exp2_,
+    g_sl_simd_.f_log_, g_sl_simd_.f_log2_, NULL, g_sl_simd_.f_inversesqrt_
+  };
+  int failures = 0;
+  size_t row, last_row;
+  int fn;
+
+  for (fn = 0; fn < ULPTEST1_NUM_FNS; ++fn) {
+    double max_ulps = 0., max_abs = 0.;
+    float worst_x = 0.f, worst_y = 0.f;
+    int fn_failures = 0;
+    size_t sample;
+
+    if ((fn == ULPTEST1_POW) ? !g_sl_simd_.f_pow_ : !unops[fn]) {
+      fprintf(stderr, "ulptest1: %s has no %s kernel\n", sl_simd_level_name(sl_simd_level()), ulptest1_fn_names[fn]);
+      failures++;
+      continue;
+    }
+
+    ulptest1_rand_state_ = 1;
+    for (sample = 0; sample < ULPTEST1_NUM_SAMPLES; sample += SL_EXEC_CHAIN_MAX_NUM_ROWS) {
+      /* Alternate between all rows, and a chain with gaps so the kernels' narrower runs are covered too */
+      last_row = 0;
+      for (row = 0; row < SL_EXEC_CHAIN_MAX_NUM_ROWS; ++row) {
+        ulptest1_inputs((enum ulptest1_fn)fn, sample + row, x_column + row, y_column + row);
+        in_chain[row] = !((sample / SL_EXEC_CHAIN_MAX_NUM_ROWS) & 1) || ((row % 5) != 2);
+        if (in_chain[row]) {
+          chain_column[last_row] = (sl_exec_row_t)(row - last_row);
+          last_row = row;
+        }
+      }
+      chain_column[last_row] = 0;
+      if (fn == ULPTEST1_POW) {
+        g_sl_simd_.f_pow_(0, chain_column, result_column, x_column, y_column);
+      }
+      else {
+        unops[fn](0, chain_column, result_column, x_column);
+      }
+      for (row = 0; row < SL_EXEC_CHAIN_MAX_NUM_ROWS; ++row) {
+        float x = x_column[row], y = y_column[row];
+        float ref, got;
+        double abs_bound, bound, ulps, abs_err;
+        if (!in_chain[row]) continue;
+        ref = ulptest1_libm((enum ulptest1_fn)fn, x, y);
+        got = result_column[row];
+        bound = ulptest1_bound((enum ulptest1_fn)fn, x, y, ref, &abs_bound);
+        ulps = ulptest1_ulps(got, ref);
+        abs_err = (ref == got) ? 0. : fabs((double)got - (double)ref);
+        if ((ulps > bound) && !(abs_bound && (abs_err <= abs_bound))) {
+          if (!fn_failures) {
+            fprintf(stderr, "ulptest1: %s %s(%.9g, %.9g) is %.9g, libm has %.9g (%.0f ULP, %.0f allowed)\n",
+                    sl_simd_level_name(sl_simd_level()), ulptest1_fn_names[fn], x, y, got, ref, ulps, bound);
+          }
+          fn_failures++;
+        }
+        if (ulps > max_ulps) {
+          max_ulps = ulps;
+          worst_x = x;
+          worst_y = y;
+        }
+        if (abs_bound && (abs_err > max_abs)) max_abs = abs_err;
+      }
+    }
+    /* The absolute error is where GLSL bounds that instead, i.e. sin and cos, and log and log2 in [0.5, 2] */
+    fprintf(stdout, "ulptest1: %-7s %-11s max %.0f ULP (at %g, %g), max absolute error %g%s\n",
+            sl_simd_level_name(sl_simd_level()), ulptest1_fn_names[fn], max_ulps, worst_x, worst_y, max_abs,
+            fn_failures ? ", FAILED" : "");
+    failures += fn_failures;
+  }
+
+  return failures;
+}
+
+/* Checks the clamp kernel at the selected level treats NaN the same in every row, whether it lands in a vector or
+ * in the scalar rows around it: x, minval or maxval NaN gives what MAXPS and MINPS give for them. */
+static int ulptest1_clamp_nan(void) {
+  static sl_exec_row_t chain_column[SL_EXEC_CHAIN_MAX_NUM_ROWS];
+  static float x_column[SL_EXEC_CHAIN_MAX_NUM_ROWS];
+  static float lo_column[SL_EXEC_CHAIN_MAX_NUM_ROWS];
+  static float hi_column[SL_EXEC_CHAIN_MAX_NUM_ROWS];
+  static float result_column[SL_EXEC_CHAIN_MAX_NUM_ROWS];
+  static unsigned char in_chain[SL_EXEC_CHAIN_MAX_NUM_ROWS];
+  size_t row, last_row = 0;
+  int failures = 0;
+  if (!g_sl_simd_.f_clamp_) return 0;
+  for (row = 0; row < SL_EXEC_CHAIN_MAX_NUM_ROWS; ++row) {
+    x_column[row] = ((row % 3) == 0) ? NAN : (float)row - 100.f;
+    lo_column[row] = ((row % 7) == 1) ? NAN : -50.f;
+    hi_column[row] = ((row % 11) == 2) ? NAN : 50.f;
+    result_column[row] = 0.f;
+    /* Gaps, so some runs are too short for the vector rows */
+    in_chain[row] = (row < 64) || ((row % 13) != 5);
+    if (in_chain[row]) {
+      chain_column[last_row] = (sl_exec_row_t)(row - last_row);
+      last_row = row;
+    }
+  }
+  chain_column[last_row] = 0;
+  g_sl_simd_.f_clamp_(0, chain_column, result_column, x_column, lo_column, hi_column);
+  for (row = 0; row < SL_EXEC_CHAIN_MAX_NUM_ROWS; ++row) {
+    float x = x_column[row], lo = lo_column[row], hi = hi_column[row];
+    float max = (x > lo) ? x : lo;
+    float ref = (max < hi) ? max : hi;
+    float got = result_column[row];
+    if (!in_chain[row]) continue;
+    if ((got != ref) && !((got != got) && (ref != ref))) {
+      if (!failures) {
+        fprintf(stderr, "ulptest1: %s clamp(%g, %g, %g) at row %d is %g, expected %g\n",
+                sl_simd_level_name(sl_simd_level()), x, lo, hi, (int)row, got, ref);
+      }
+      failures++;
+    }
+  }
+  return failures;
+}
+
+/* Measures the error of the transcendental SIMD kernels (see struct sl_simd_kernels) against libm for every
+ * level the host supports, and checks it stays within the bounds of ulptest1_bound(); also checks the clamp
+ * kernel's handling of NaN at each level. */
+int ulptest1(void) {
+  sl_simd_level_t initial_level = sl_simd_level();
+  sl_simd_level_t supported = sl_simd_detect();
+  int level;
+  int failures = 0;
+
+  if (supported == SLSIMD_GENERIC) {
+    fprintf(stdout, "ulptest1: no SIMD kernels on this host, SLEA_SPEC accuracy uses libm\n");
+    return 0;
+  }
+
+  for (level = SLSIMD_SSE41; level <= (int)supported; ++level) {
+    sl_simd_select((sl_simd_level_t)level);
+    failures += ulptest1_level();
+    failures += ulptest1_clamp_nan();
+  }
+
+  sl_simd_select(initial_level);
+
+  return failures ? -1 : 0;
+}